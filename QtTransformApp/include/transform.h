@@ -1,7 +1,9 @@
 #pragma once
 #include <QMainWindow>
 #include <QStringList>
+#include <memory>
 #include <MeshTypes.h>
+#include <AsyncConverter.h>
 
 QT_BEGIN_NAMESPACE
 namespace Ui { class transform; }
@@ -13,6 +15,7 @@ class QItemSelection;
 class QModelIndex;
 class QPoint;
 class QTimer;
+class QToolButton;
 class QTreeWidgetItem;
 
 class transform : public QMainWindow {
@@ -40,6 +43,8 @@ private slots:
 
 private:
     void showMeshDetailedInfo(const MeshData& meshData, const QString& filePath);
+    void showMeshPreview(const std::shared_ptr<const MeshData>& meshData);
+    void updatePreviewLevel();
 
 private:
     void setupFileBrowser();
@@ -51,10 +56,11 @@ private:
     bool isPathWritable(const QString& path) const;
     void validateExportPath();
     QString currentExportExt() const;
-    void updateMeshInfo(const QString& filePath);
+    void updateMeshInfo(const QString& filePath, const MeshData& meshData);
     void setRootPath(const QString& path);
     void selectFilesInTree(const QStringList& filePaths, bool clearSelection = true);
     void importMeshFile(const QString& filePath);
+    void cancelImports();
     bool isSupportedMeshFile(const QString& filePath) const;
     void updateCellStats(const MeshData& meshData);
     void updateAttributeInfo(const MeshData& meshData);
@@ -69,9 +75,17 @@ private:
         QString filePath;
         QString fileName;
         QString format;
-        MeshData meshData;
+        std::shared_ptr<const MeshData> meshData;  // 与导入任务、3D预览任务共享，避免复制大网格
     };
 
+    // 导入任务结果
+    struct ImportResult : JobResult {
+        std::shared_ptr<const MeshData> mesh;
+    };
+
+    // 3D预览状态（VTK 渲染对象与 LOD 层级，定义见 transform.cpp）
+    struct MeshPreview;
+
 private:
     Ui::transform* ui;
     MeshFileSystemModel* fileModel = nullptr;
@@ -80,8 +94,14 @@ private:
     QString exportFallbackPath;
     QString lastAutoExportPath;
     QTimer* exportProgressTimer = nullptr;
-    int exportProgressValue = 0;
     bool exportInProgress = false;
+    JobHandle<JobResult> exportJob;                        // 进行中的导出任务
+
+    // 进行中的导入任务（状态栏“取消”按钮可全部取消）
+    QList<JobHandle<ImportResult>> importJobs;
+    QToolButton* cancelImportButton = nullptr;
+
+    std::unique_ptr<MeshPreview> preview;
     
     // 已加载网格数据
     QList<LoadedMesh> loadedMeshes;
@@ -89,7 +109,7 @@ private:
 
 private:
     void setupLoadedMeshesTab();
-    void addLoadedMesh(const QString& filePath, const MeshData& meshData);
+    void addLoadedMesh(const QString& filePath, std::shared_ptr<const MeshData> meshData);
     void updateLoadedMeshesTree();
     void onLoadedMeshSelected(QTreeWidgetItem* item, int column);
     void onLoadedMeshContextMenuRequested(const QPoint& pos);
@@ -1,10 +1,18 @@
 #include "transform.h"
 
 #include <QApplication>
+#ifdef HAS_VTK_VIEWER
+#include <QSurfaceFormat>
+#include <QVTKOpenGLNativeWidget.h>
+#endif
 #pragma comment(lib, "user32.lib")
 
 int main(int argc, char *argv[])
 {
+#ifdef HAS_VTK_VIEWER
+    // 3D视图需要在创建 QApplication 之前设置 OpenGL 格式
+    QSurfaceFormat::setDefaultFormat(QVTKOpenGLNativeWidget::defaultFormat());
+#endif
     QApplication a(argc, argv);
     transform w;
     w.show();
@@ -9,6 +9,7 @@
 #include <QDragEnterEvent>
 #include <QDragMoveEvent>
 #include <QDropEvent>
+#include <QFile>
 #include <QFileDialog>
 #include <QFileInfo>
 #include <QFileSystemModel>
@@ -29,14 +30,19 @@
 #include <QStandardPaths>
 #include <QTableWidget>
 #include <QTextEdit>
+#include <QTimer>
 #include <QToolButton>
 #include <QTreeView>
 #include <QUrl>
-#include <QtConcurrent/QtConcurrent>
 
 
 
+#include <algorithm>
 #include <cmath>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include <vtkAppendFilter.h>
 #include <vtkDataSet.h>
@@ -57,12 +63,31 @@
 #include <vtkXMLUnstructuredGridReader.h>
 #include <vtkXMLUnstructuredGridWriter.h>
 
+#ifdef HAS_VTK_VIEWER
+#include <QVTKOpenGLNativeWidget.h>
+#include <vtkActor.h>
+#include <vtkCallbackCommand.h>
+#include <vtkCamera.h>
+#include <vtkCellArray.h>
+#include <vtkFloatArray.h>
+#include <vtkGenericOpenGLRenderWindow.h>
+#include <vtkIdTypeArray.h>
+#include <vtkMath.h>
+#include <vtkPoints.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkRenderer.h>
+#endif
+
 // Include MeshReader from src directory
+#include "MeshCache.h"
 #include "MeshReader.h"
 #include "MeshTypes.h"
 #include "MeshException.h"
 #include "VTKConverter.h"
 #include "MeshHelper.h"
+#include "MeshProcessor.h"
+#include "VTKBridge.h"
+#include "AsyncConverter.h"
 
 #ifdef HAS_VTK_IOCGNS
 #include <vtkCGNSReader.h>
@@ -80,7 +105,7 @@
 #endif
 #endif
 
-const QSet<QString> kSupportedExtensions = {"vtk", "vtu", "cgns", "msh", "obj", "off", "stl", "ply"};
+const QSet<QString> kSupportedExtensions = {"vtk", "vtu", "cgns", "msh", "obj", "off", "stl", "ply", "mcb"};
 
 struct ExportResult {
     bool ok = false;
@@ -105,96 +130,6 @@ vtkSmartPointer<vtkDataSet> extractFirstDataSet(vtkMultiBlockDataSet* multiBlock
     return nullptr;
 }
 
-vtkSmartPointer<vtkDataSet> loadMeshDataSet(const QString& filePath, QString* errorMessage)
-{
-    // 使用MeshReader::readAuto方法读取网格文件
-    const std::string filePathStd = filePath.toUtf8().toStdString();
-    MeshData meshData;
-    MeshErrorCode errorCode;
-    std::string errorMsg;
-    
-    bool success = MeshReader::readAuto(filePathStd, meshData, errorCode, errorMsg);
-    if (!success) {
-        if (errorMessage) {
-            *errorMessage = QString::fromStdString(errorMsg);
-        }
-        return nullptr;
-    }
-    
-    // 检查网格数据是否为空
-    if (meshData.isEmpty()) {
-        if (errorMessage) {
-            *errorMessage = "网格数据为空";
-        }
-        return nullptr;
-    }
-    
-    // 将MeshData转换为vtkUnstructuredGrid
-    vtkSmartPointer<vtkUnstructuredGrid> grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
-    
-    // 设置点数据
-    vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
-    size_t pointCount = meshData.points.size() / 3;
-    for (size_t i = 0; i < pointCount; ++i) {
-        float x = meshData.points[i * 3];
-        float y = meshData.points[i * 3 + 1];
-        float z = meshData.points[i * 3 + 2];
-        points->InsertNextPoint(x, y, z);
-    }
-    grid->SetPoints(points);
-    
-    // 设置单元数据
-    for (const auto& cell : meshData.cells) {
-        vtkIdType* pointIds = new vtkIdType[cell.pointIndices.size()];
-        for (size_t i = 0; i < cell.pointIndices.size(); ++i) {
-            pointIds[i] = cell.pointIndices[i];
-        }
-        
-        // 转换单元类型
-        int vtkCellType = 0;
-        switch (cell.type) {
-        case VtkCellType::VERTEX:
-            vtkCellType = VTK_VERTEX;
-            break;
-        case VtkCellType::LINE:
-            vtkCellType = VTK_LINE;
-            break;
-        case VtkCellType::TRIANGLE:
-            vtkCellType = VTK_TRIANGLE;
-            break;
-        case VtkCellType::QUAD:
-            vtkCellType = VTK_QUAD;
-            break;
-        case VtkCellType::TETRA:
-            vtkCellType = VTK_TETRA;
-            break;
-        case VtkCellType::HEXAHEDRON:
-            vtkCellType = VTK_HEXAHEDRON;
-            break;
-        case VtkCellType::WEDGE:
-            vtkCellType = VTK_WEDGE;
-            break;
-        case VtkCellType::PYRAMID:
-            vtkCellType = VTK_PYRAMID;
-            break;
-        case VtkCellType::TRIANGLE_STRIP:
-            vtkCellType = VTK_TRIANGLE_STRIP;
-            break;
-        case VtkCellType::POLYGON:
-            vtkCellType = VTK_POLYGON;
-            break;
-        default:
-            delete[] pointIds;
-            continue;
-        }
-        
-        grid->InsertNextCell(vtkCellType, static_cast<int>(cell.pointIndices.size()), pointIds);
-        delete[] pointIds;
-    }
-    
-    return grid;
-}
-
 vtkSmartPointer<vtkPolyData> toSurfaceMesh(vtkDataSet* dataSet)
 {
     if (!dataSet) {
@@ -258,6 +193,8 @@ ExportResult exportMeshFile(const QString& sourcePath,
         dstFormat = binary ? MeshFormat::STL_BINARY : MeshFormat::STL_ASCII;
     } else if (ext == "ply") {
         dstFormat = binary ? MeshFormat::PLY_BINARY : MeshFormat::PLY_ASCII;
+    } else if (ext == "mcb") {
+        dstFormat = MeshFormat::MESH_CACHE;
     } else {
         result.message = "不支持的目标格式";
         return result;
@@ -288,6 +225,79 @@ ExportResult exportMeshFile(const QString& sourcePath,
     return result;
 }
 
+#ifdef HAS_VTK_VIEWER
+// 3D预览：最精细层级的三角形上限与最粗层级的三角形数
+constexpr uint64_t kPreviewMaxTriangles = 2000000;
+constexpr uint64_t kPreviewMinTriangles = 20000;
+// 屏幕上每个三角形约占的像素数，再细的层级已看不出差别
+constexpr double kPreviewPixelsPerTriangle = 2.0;
+
+// 后台任务已生成、尚未交给界面的预览层级
+struct PreviewLevels {
+    std::mutex mutex;
+    std::vector<std::pair<vtkSmartPointer<vtkPolyData>, uint64_t>> levels;  // (层级, 三角形数)
+};
+
+/**
+ * @brief 将三角形层级转换为 vtkPolyData（在工作线程中执行，界面线程只切换映射器输入）
+ */
+vtkSmartPointer<vtkPolyData> toPreviewPolyData(const MeshData& level)
+{
+    auto coordinates = vtkSmartPointer<vtkFloatArray>::New();
+    coordinates->SetNumberOfComponents(3);
+    coordinates->SetNumberOfTuples(static_cast<vtkIdType>(level.points.size() / 3));
+    std::copy(level.points.begin(), level.points.end(), coordinates->GetPointer(0));
+    auto points = vtkSmartPointer<vtkPoints>::New();
+    points->SetData(coordinates);
+
+    auto offsets = vtkSmartPointer<vtkIdTypeArray>::New();
+    offsets->SetNumberOfValues(static_cast<vtkIdType>(level.cells.offsets.size()));
+    std::copy(level.cells.offsets.begin(), level.cells.offsets.end(), offsets->GetPointer(0));
+    auto connectivity = vtkSmartPointer<vtkIdTypeArray>::New();
+    connectivity->SetNumberOfValues(static_cast<vtkIdType>(level.cells.connectivity.size()));
+    std::copy(level.cells.connectivity.begin(), level.cells.connectivity.end(), connectivity->GetPointer(0));
+    auto polys = vtkSmartPointer<vtkCellArray>::New();
+    polys->SetData(offsets, connectivity);
+
+    auto polyData = vtkSmartPointer<vtkPolyData>::New();
+    polyData->SetPoints(points);
+    polyData->SetPolys(polys);
+    return polyData;
+}
+
+/**
+ * @brief 按网格在屏幕上覆盖的像素数选择层级：取三角形数不超过可分辨数量的最精细层级
+ * @param triangleCounts 各层级三角形数（由粗到细）
+ * @param coveredPixels 网格包围球投影覆盖的像素数
+ */
+size_t selectPreviewLevel(const std::vector<uint64_t>& triangleCounts, double coveredPixels)
+{
+    const double visibleTriangles = coveredPixels / kPreviewPixelsPerTriangle;
+    size_t level = 0;
+    while (level + 1 < triangleCounts.size() && static_cast<double>(triangleCounts[level + 1]) <= visibleTriangles) {
+        ++level;
+    }
+    return level;
+}
+#endif
+
+// 3D预览状态：只渲染网格边界表面，LOD 层级在后台由粗到细生成，按相机距离切换
+struct transform::MeshPreview {
+#ifdef HAS_VTK_VIEWER
+    QVTKOpenGLNativeWidget* widget = nullptr;
+    vtkSmartPointer<vtkRenderer> renderer;
+    vtkSmartPointer<vtkPolyDataMapper> mapper;
+    vtkSmartPointer<vtkActor> actor;
+    std::vector<vtkSmartPointer<vtkPolyData>> levels;  // 已到达的层级，由粗到细
+    std::vector<uint64_t> triangleCounts;
+    size_t shownLevel = 0;
+    double center[3] = {0.0, 0.0, 0.0};
+    double radius = 0.0;
+    JobHandle<JobResult> job;                           // 生成层级的后台任务
+    QTimer* pollTimer = nullptr;
+#endif
+};
+
 QString formatFileSize(qint64 bytes)
 {
     static const QStringList units = {"B", "KB", "MB", "GB", "TB"};
@@ -447,6 +457,14 @@ transform::transform(QWidget* parent)
     setupVTKWidget();
     setupLoadedMeshesTab();
     setupSplitterSizes();
+
+    // 导入在共享线程池中执行，状态栏按钮可取消进行中的导入
+    cancelImportButton = new QToolButton(this);
+    cancelImportButton->setText("取消");
+    cancelImportButton->setToolTip("取消正在进行的导入");
+    cancelImportButton->setVisible(false);
+    connect(cancelImportButton, &QToolButton::clicked, this, &transform::cancelImports);
+    statusBar()->addPermanentWidget(cancelImportButton);
 }
 
 void transform::setupSplitterSizes()
@@ -496,7 +514,7 @@ void transform::setupLoadedMeshesTab()
             this, &transform::onLoadedMeshContextMenuRequested);
 }
 
-void transform::addLoadedMesh(const QString& filePath, const MeshData& meshData)
+void transform::addLoadedMesh(const QString& filePath, std::shared_ptr<const MeshData> meshData)
 {
     QFileInfo info(filePath);
     QString fileName = info.fileName();
@@ -506,7 +524,7 @@ void transform::addLoadedMesh(const QString& filePath, const MeshData& meshData)
     mesh.filePath = filePath;
     mesh.fileName = fileName;
     mesh.format = format;
-    mesh.meshData = meshData;
+    mesh.meshData = std::move(meshData);
 
     loadedMeshes.append(mesh);
     updateLoadedMeshesTree();
@@ -569,6 +587,8 @@ void transform::onLoadedMeshSelected(QTreeWidgetItem* item, int column)
         formatText = "OFF";
     } else if (suffix == "ply") {
         formatText = "PLY";
+    } else if (suffix == "mcb") {
+        formatText = "Mesh Cache";
     }
 
     const QString sizeText = formatFileSize(info.size());
@@ -576,10 +596,10 @@ void transform::onLoadedMeshSelected(QTreeWidgetItem* item, int column)
 
     // 计算网格维度
     QString dimensionText = "-";
-    if (!mesh.meshData.cells.empty()) {
+    if (!mesh.meshData->cells.empty()) {
         // 简单判断维度：如果有四面体、六面体等3D单元，则为3D网格
         bool has3DCells = false;
-        for (const auto& cell : mesh.meshData.cells) {
+        for (const auto& cell : mesh.meshData->cells) {
             switch (cell.type) {
             case VtkCellType::TETRA:
             case VtkCellType::HEXAHEDRON:
@@ -615,10 +635,13 @@ void transform::onLoadedMeshSelected(QTreeWidgetItem* item, int column)
     }
 
     // 更新单元统计信息
-    updateCellStats(mesh.meshData);
+    updateCellStats(*mesh.meshData);
 
     // 更新属性信息
-    updateAttributeInfo(mesh.meshData);
+    updateAttributeInfo(*mesh.meshData);
+
+    // 3D视图切换到该网格
+    showMeshPreview(mesh.meshData);
 
     // 自动填充导出格式和路径
     if (ui->exportFormatCombo) {
@@ -792,14 +815,158 @@ void transform::viewSelectedMeshProperties()
         QString("文件路径: %1\n").arg(mesh.filePath) +
         QString("文件名称: %1\n").arg(mesh.fileName) +
         QString("文件格式: %1\n").arg(mesh.format) +
-        QString("点数量: %1\n").arg(mesh.meshData.points.size() / 3) +
-        QString("单元数量: %1").arg(mesh.meshData.cells.size()));
+        QString("点数量: %1\n").arg(mesh.meshData->points.size() / 3) +
+        QString("单元数量: %1").arg(mesh.meshData->cells.size()));
 }
 
 void transform::setupVTKWidget()
 {
-    // TODO: 实现VTK 3D视图的初始化
-    // 由于当前环境配置问题，暂时作为占位符
+    preview = std::make_unique<MeshPreview>();
+#ifdef HAS_VTK_VIEWER
+    preview->widget = new QVTKOpenGLNativeWidget(ui->vtkWidget);
+    auto renderWindow = vtkSmartPointer<vtkGenericOpenGLRenderWindow>::New();
+    preview->widget->setRenderWindow(renderWindow);
+
+    preview->renderer = vtkSmartPointer<vtkRenderer>::New();
+    preview->renderer->SetBackground(30.0 / 255.0, 60.0 / 255.0, 90.0 / 255.0);
+    renderWindow->AddRenderer(preview->renderer);
+
+    preview->mapper = vtkSmartPointer<vtkPolyDataMapper>::New();
+    preview->actor = vtkSmartPointer<vtkActor>::New();
+    preview->actor->SetMapper(preview->mapper);
+    preview->actor->VisibilityOff();
+    preview->renderer->AddActor(preview->actor);
+
+    // 每帧渲染前按相机距离切换 LOD 层级
+    auto levelCallback = vtkSmartPointer<vtkCallbackCommand>::New();
+    levelCallback->SetClientData(this);
+    levelCallback->SetCallback([](vtkObject*, unsigned long, void* clientData, void*) {
+        static_cast<transform*>(clientData)->updatePreviewLevel();
+    });
+    preview->renderer->AddObserver(vtkCommand::StartEvent, levelCallback);
+
+    ui->vtkWidgetLabel->hide();
+    ui->vtkWidgetLayout->addWidget(preview->widget);
+#endif
+}
+
+void transform::showMeshPreview(const std::shared_ptr<const MeshData>& meshData)
+{
+#ifdef HAS_VTK_VIEWER
+    if (!preview || !preview->widget || !meshData) {
+        return;
+    }
+
+    // 放弃上一个网格尚未生成完的层级
+    preview->job.cancel();
+    if (preview->pollTimer) {
+        preview->pollTimer->stop();
+        preview->pollTimer->deleteLater();
+        preview->pollTimer = nullptr;
+    }
+    preview->levels.clear();
+    preview->triangleCounts.clear();
+    preview->shownLevel = 0;
+    preview->actor->VisibilityOff();
+    preview->widget->renderWindow()->Render();
+
+    // 在共享线程池中提取边界表面并由粗到细生成层级，每生成一级即交给界面显示
+    auto ready = std::make_shared<PreviewLevels>();
+    const uint64_t memoryCost = meshData->points.size() * sizeof(float) + meshData->cells.connectivitySize() * sizeof(uint32_t);
+    const JobHandle<JobResult> job = AsyncConverter::submit<JobResult>([meshData, ready](JobResult& result) {
+        MeshProcessor::LodOptions options;
+        options.maxTriangles = kPreviewMaxTriangles;
+        options.minTriangles = kPreviewMinTriangles;
+        std::vector<MeshData> levels;
+        result.success = MeshProcessor::buildLevelsOfDetail(*meshData, levels, options, result.errorCode, result.errorMsg,
+            [&ready](size_t, const MeshData& level) {
+                vtkSmartPointer<vtkPolyData> polyData = toPreviewPolyData(level);
+                std::lock_guard<std::mutex> lock(ready->mutex);
+                ready->levels.emplace_back(polyData, static_cast<uint64_t>(level.cells.size()));
+            });
+    }, memoryCost);
+    preview->job = job;
+
+    auto* pollTimer = new QTimer(this);
+    pollTimer->setInterval(100);
+    preview->pollTimer = pollTimer;
+    connect(pollTimer, &QTimer::timeout, this, [this, job, ready, pollTimer] {
+        // 先判断任务是否结束：结束时所有层级都已放入 ready
+        const bool finished = job.isReady();
+        std::vector<std::pair<vtkSmartPointer<vtkPolyData>, uint64_t>> arrived;
+        {
+            std::lock_guard<std::mutex> lock(ready->mutex);
+            arrived.swap(ready->levels);
+        }
+        for (auto& [polyData, triangles] : arrived) {
+            preview->levels.push_back(polyData);
+            preview->triangleCounts.push_back(triangles);
+        }
+        if (!arrived.empty()) {
+            if (!preview->actor->GetVisibility()) {
+                // 最粗层级到达后立即显示并按其包围盒放置相机（边界表面与原网格包围盒相同），
+                // 更精细的层级到达后按相机距离切换
+                double box[6];
+                preview->levels.front()->GetBounds(box);
+                for (int axis = 0; axis < 3; ++axis) {
+                    preview->center[axis] = (box[axis * 2] + box[axis * 2 + 1]) / 2.0;
+                }
+                const double corner[3] = {box[1], box[3], box[5]};
+                preview->radius = std::sqrt(vtkMath::Distance2BetweenPoints(corner, preview->center));
+                preview->renderer->ResetCamera(box);
+                preview->shownLevel = 0;
+                preview->mapper->SetInputData(preview->levels.front());
+                preview->actor->VisibilityOn();
+            }
+            preview->widget->renderWindow()->Render();
+        }
+        if (!finished) {
+            return;
+        }
+
+        pollTimer->stop();
+        pollTimer->deleteLater();
+        preview->pollTimer = nullptr;
+        const JobResult& result = job.get();
+        if (!result.success && result.errorCode != MeshErrorCode::CANCELLED) {
+            statusBar()->showMessage(QString("3D预览生成失败：%1").arg(QString::fromUtf8(result.errorMsg.c_str())), 5000);
+        }
+    });
+    pollTimer->start();
+#else
+    Q_UNUSED(meshData);
+#endif
+}
+
+void transform::updatePreviewLevel()
+{
+#ifdef HAS_VTK_VIEWER
+    if (!preview || preview->levels.empty()) {
+        return;
+    }
+
+    // 网格包围球在屏幕上的投影半径（像素）；相机进入包围球时使用最精细层级
+    vtkCamera* camera = preview->renderer->GetActiveCamera();
+    const int* viewport = preview->renderer->GetSize();
+    const double halfHeight = viewport[1] / 2.0;
+    size_t level = preview->levels.size() - 1;
+    if (camera->GetParallelProjection()) {
+        const double radiusPixels = preview->radius / camera->GetParallelScale() * halfHeight;
+        level = selectPreviewLevel(preview->triangleCounts, vtkMath::Pi() * radiusPixels * radiusPixels);
+    } else {
+        const double distance = std::sqrt(vtkMath::Distance2BetweenPoints(camera->GetPosition(), preview->center));
+        if (distance > preview->radius) {
+            const double halfAngle = vtkMath::RadiansFromDegrees(camera->GetViewAngle() / 2.0);
+            const double radiusPixels = preview->radius / (distance * std::tan(halfAngle)) * halfHeight;
+            level = selectPreviewLevel(preview->triangleCounts, vtkMath::Pi() * radiusPixels * radiusPixels);
+        }
+    }
+
+    if (level != preview->shownLevel) {
+        preview->shownLevel = level;
+        preview->mapper->SetInputData(preview->levels[level]);
+    }
+#endif
 }
 
 void transform::appendExportLog(const QString& message, const QString& level)
@@ -888,6 +1055,12 @@ void transform::saveExportLog()
 
 transform::~transform()
 {
+    // 未完成的任务不再需要结果，尽快停止以释放线程池
+    cancelImports();
+    exportJob.cancel();
+#ifdef HAS_VTK_VIEWER
+    preview->job.cancel();
+#endif
     delete ui;
 }
 
@@ -1013,6 +1186,7 @@ void transform::setupExportPanel()
     ui->exportFormatCombo->addItem("OBJ (.obj)", "obj");
     ui->exportFormatCombo->addItem("OFF (.off)", "off");
     ui->exportFormatCombo->addItem("PLY (.ply)", "ply");
+    ui->exportFormatCombo->addItem("Mesh Cache (.mcb)", "mcb");
 
     if (ui->surfaceMeshRadio) {
         ui->surfaceMeshRadio->setToolTip("仅保留面单元");
@@ -1084,8 +1258,8 @@ void transform::setupExportPanel()
         exportProgressTimer = new QTimer(this);
         exportProgressTimer->setInterval(200);
         connect(exportProgressTimer, &QTimer::timeout, this, [this] {
-            exportProgressValue = qMin(exportProgressValue + 5, 95);
-            statusBar()->showMessage(QString("导出中：%1%").arg(exportProgressValue));
+            const int percent = static_cast<int>(exportJob.progress() * 100.0);
+            statusBar()->showMessage(QString("导出中：%1%").arg(percent));
         });
     }
 }
@@ -1235,41 +1409,6 @@ void transform::selectFilesInTree(const QStringList& filePaths, bool clearSelect
     }
 }
 
-struct ImportResult {
-    bool success;
-    MeshData meshData;
-    QString errorMessage;
-};
-
-ImportResult importMeshFileAsync(const QString& filePath)
-{
-    ImportResult result;
-    result.success = false;
-    
-    try {
-        // 使用 MeshReader 读取文件
-        MeshData meshData;
-        MeshErrorCode errorCode;
-        std::string errorMsg;
-        
-        const std::string filePathStd = filePath.toStdString();
-        bool success = MeshReader::readAuto(filePathStd, meshData, errorCode, errorMsg);
-        
-        if (success) {
-            result.success = true;
-            result.meshData = meshData;
-        } else {
-            result.errorMessage = QString::fromStdString(errorMsg);
-        }
-    } catch (const std::exception& e) {
-        result.errorMessage = QString::fromStdString(e.what());
-    } catch (...) {
-        result.errorMessage = "导入过程中发生未知错误";
-    }
-    
-    return result;
-}
-
 void transform::importMeshFile(const QString& filePath)
 {
     statusBar()->showMessage(QString("正在导入：%1").arg(QFileInfo(filePath).fileName()), 5000);
@@ -1300,68 +1439,108 @@ void transform::importMeshFile(const QString& filePath)
         return;
     }
     
-    // 使用QtConcurrent异步执行导入操作
-    auto future = QtConcurrent::run(importMeshFileAsync, filePath);
-    
-    auto* watcher = new QFutureWatcher<ImportResult>(this);
-    connect(watcher, &QFutureWatcher<ImportResult>::finished, this, [this, filePath, watcher] {
-        ImportResult result = watcher->result();
-        watcher->deleteLater();
-        
+    // 经解析缓存读取：源文件未改动时直接加载 .mcb，跳过文本解析
+    const std::string filePathStd = filePath.toUtf8().toStdString();
+    const std::string cacheDir = (QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/meshcache").toUtf8().toStdString();
+    const JobHandle<ImportResult> job = AsyncConverter::submit<ImportResult>(
+        [filePathStd, cacheDir](ImportResult& result) {
+            auto mesh = std::make_shared<MeshData>();
+            result.success = MeshCache::readCached(filePathStd, cacheDir, *mesh, result.errorCode, result.errorMsg);
+            if (result.success) {
+                result.mesh = std::move(mesh);
+            }
+        },
+        static_cast<uint64_t>(fileInfo.size()));
+    importJobs.append(job);
+    cancelImportButton->setVisible(true);
+
+    // 轮询任务进度与结果，结果在 GUI 线程处理
+    auto* pollTimer = new QTimer(this);
+    pollTimer->setInterval(100);
+    connect(pollTimer, &QTimer::timeout, this, [this, filePath, job, pollTimer] {
+        const QString fileName = QFileInfo(filePath).fileName();
+        if (!job.isReady()) {
+            const int percent = static_cast<int>(job.progress() * 100.0);
+            statusBar()->showMessage(QString("正在导入：%1 (%2%)").arg(fileName).arg(percent));
+            return;
+        }
+        pollTimer->stop();
+        pollTimer->deleteLater();
+        importJobs.removeIf([](const JobHandle<ImportResult>& pending) { return pending.isReady(); });
+        cancelImportButton->setVisible(!importJobs.isEmpty());
+
+        const ImportResult& result = job.get();
         if (result.success) {
             // 读取成功，更新网格信息
-            updateMeshInfo(filePath);
-            statusBar()->showMessage(QString("导入成功：%1").arg(QFileInfo(filePath).fileName()), 5000);
-            
+            updateMeshInfo(filePath, *result.mesh);
+            statusBar()->showMessage(QString("导入成功：%1").arg(fileName), 5000);
+
             // 更新单元统计信息
-            updateCellStats(result.meshData);
-            
+            updateCellStats(*result.mesh);
+
             // 更新属性信息
-            updateAttributeInfo(result.meshData);
-            
-            // 加载到已加载网格区域
-            addLoadedMesh(filePath, result.meshData);
-            
-            // TODO: 通知 3D 视图区刷新
+            updateAttributeInfo(*result.mesh);
+
+            // 加载到已加载网格区域（与任务结果共享网格数据）
+            addLoadedMesh(filePath, result.mesh);
+
+            // 3D视图显示边界表面，LOD 层级在后台生成
+            showMeshPreview(result.mesh);
+        } else if (result.errorCode == MeshErrorCode::CANCELLED) {
+            statusBar()->showMessage(QString("已取消导入：%1").arg(fileName), 5000);
         } else {
             // 读取失败，显示错误信息
-            statusBar()->showMessage(QString("导入失败：%1").arg(result.errorMessage), 5000);
-            QMessageBox::warning(this, "导入失败", result.errorMessage);
+            const QString errorMessage = QString::fromUtf8(result.errorMsg.c_str());
+            statusBar()->showMessage(QString("导入失败：%1").arg(errorMessage), 5000);
+            QMessageBox::warning(this, "导入失败", errorMessage);
         }
     });
-    
-    watcher->setFuture(future);
+    pollTimer->start();
 }
 
-void transform::updateMeshInfo(const QString& filePath)
+void transform::cancelImports()
+{
+    for (const auto& job : importJobs) {
+        job.cancel();
+    }
+}
+
+void transform::updateMeshInfo(const QString& filePath, const MeshData& meshData)
 {
     const QFileInfo info(filePath);
-    const QString suffix = info.suffix().toLower();
 
-    QString formatText = suffix;
-    if (suffix == "vtk") {
-        formatText = "VTK Legacy";
-    } else if (suffix == "vtu") {
-        formatText = "VTK XML";
-    } else if (suffix == "cgns") {
-        formatText = "CGNS";
-    } else if (suffix == "msh") {
-        formatText = "Gmsh";
-    } else if (suffix == "stl") {
-        formatText = "STL";
+    // 仅扫描文件头获取格式与网格类型，不重新解析整个网格
+    MeshMetadata metadata;
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+    std::string errorMsg;
+    const bool hasMetadata = MeshHelper::extractMetadata(filePath.toUtf8().toStdString(), metadata, errorCode, errorMsg);
+
+    QString formatText = info.suffix().toLower();
+    QString typeText = formatText;
+    if (hasMetadata) {
+        formatText = QString::fromStdString(MeshHelper::getFormatName(metadata.format));
+        if (metadata.meshType == MeshType::VOLUME_MESH) {
+            typeText = "体网格";
+        } else if (metadata.meshType == MeshType::SURFACE_MESH) {
+            typeText = "面网格";
+        } else {
+            typeText = formatText;
+        }
     }
 
     const QString sizeText = formatFileSize(info.size());
     const QString importTime = QDateTime::currentDateTime().toString("yyyy-MM-dd HH:mm:ss");
 
+    // 维度由已导入网格的 z 范围判断
     QString dimensionText = "-";
-    QString error;
-    vtkSmartPointer<vtkDataSet> dataSet = loadMeshDataSet(filePath, &error);
-    if (dataSet) {
-        double bounds[6] = {0, 0, 0, 0, 0, 0};
-        dataSet->GetBounds(bounds);
-        const double zSpan = bounds[5] - bounds[4];
-        const bool is2D = std::abs(zSpan) < 1e-6;
+    if (!meshData.points.empty()) {
+        float zMin = meshData.points[2];
+        float zMax = meshData.points[2];
+        for (size_t i = 2; i < meshData.points.size(); i += 3) {
+            zMin = (std::min)(zMin, meshData.points[i]);
+            zMax = (std::max)(zMax, meshData.points[i]);
+        }
+        const bool is2D = std::abs(zMax - zMin) < 1e-6f;
         dimensionText = is2D ? "2D" : "3D";
     }
 
@@ -1369,7 +1548,7 @@ void transform::updateMeshInfo(const QString& filePath)
         ui->meshNameValue->setText(info.fileName());
     }
     if (ui->meshTypeValue) {
-        ui->meshTypeValue->setText(formatText);
+        ui->meshTypeValue->setText(typeText);
     }
     if (ui->meshFormatValue) {
         ui->meshFormatValue->setText(formatText);
@@ -1516,7 +1695,7 @@ void transform::onOpenFileClicked()
         this,
         "打开网格文件",
         currentRootPath.isEmpty() ? QDir::homePath() : currentRootPath,
-        "网格文件 (*.vtk *.vtu *.cgns *.msh *.obj *.off *.stl *.ply);;VTK文件 (*.vtk *.vtu);;CGNS文件 (*.cgns);;Gmsh文件 (*.msh);;OBJ文件 (*.obj);;OFF文件 (*.off);;STL文件 (*.stl);;PLY文件 (*.ply);;所有文件 (*.*)"
+        "网格文件 (*.vtk *.vtu *.cgns *.msh *.obj *.off *.stl *.ply *.mcb);;VTK文件 (*.vtk *.vtu);;CGNS文件 (*.cgns);;Gmsh文件 (*.msh);;OBJ文件 (*.obj);;OFF文件 (*.off);;STL文件 (*.stl);;PLY文件 (*.ply);;所有文件 (*.*)"
     );
 
     if (files.isEmpty()) {
@@ -1625,6 +1804,12 @@ void transform::onExportNowClicked()
     }
 
     if (exportInProgress) {
+        // 导出中按钮用作“取消导出”，任务在下一个数据块边界停止
+        exportJob.cancel();
+        if (ui->exportNowButton) {
+            ui->exportNowButton->setEnabled(false);
+        }
+        appendExportLog("正在取消导出...", "WARNING");
         return;
     }
 
@@ -1699,13 +1884,8 @@ void transform::onExportNowClicked()
     }
 
     exportInProgress = true;
-    exportProgressValue = 5;
     if (ui->exportNowButton) {
-        ui->exportNowButton->setText("导出中...");
-        ui->exportNowButton->setEnabled(false);
-    }
-    if (exportProgressTimer) {
-        exportProgressTimer->start();
+        ui->exportNowButton->setText("取消导出");
     }
 
     appendExportLog(QString("开始导出：%1").arg(QFileInfo(sourcePath).fileName()), "INFO");
@@ -1713,24 +1893,32 @@ void transform::onExportNowClicked()
     appendExportLog(QString("导出路径：%1").arg(exportPath), "INFO");
     appendExportLog(QString("网格类型：%1").arg(isVolume ? "体网格" : "面网格"), "INFO");
     appendExportLog(QString("输出模式：%1").arg(isBinary ? "二进制" : "ASCII"), "INFO");
-    appendExportLog("正在准备导出数据...", "INFO");
-    appendExportLog("正在读取源文件...", "INFO");
-    appendExportLog(QString("进度：10%"), "INFO");
-    appendExportLog("正在处理网格数据...", "INFO");
-    appendExportLog(QString("进度：30%"), "INFO");
     appendExportLog("正在转换格式...", "INFO");
-    appendExportLog(QString("进度：60%"), "INFO");
-    appendExportLog("正在写入目标文件...", "INFO");
-    appendExportLog(QString("进度：80%"), "INFO");
 
-    auto future = QtConcurrent::run([sourcePath, exportPath, formatExt, isVolume, isBinary]() {
-        return exportMeshFile(sourcePath, exportPath, formatExt, !isVolume, isBinary);
-    });
+    // 导出任务与批量转换共用同一个线程池，大文件按源文件大小参与调度；
+    // 读取、处理与写入循环上报真实进度，取消后删除未写完的文件
+    const uint64_t sourceSize = static_cast<uint64_t>(std::max<qint64>(0, QFileInfo(sourcePath).size()));
+    exportJob = AsyncConverter::submit<JobResult>(
+        [sourcePath, exportPath, formatExt, isVolume, isBinary](JobResult& result) {
+            const ExportResult exported = exportMeshFile(sourcePath, exportPath, formatExt, !isVolume, isBinary);
+            result.success = exported.ok;
+            result.errorMsg = exported.message.toUtf8().toStdString();
+            const JobControl::Context context = JobControl::context();
+            if (!exported.ok && context.job && context.job->isCancelled()) {
+                QFile::remove(exportPath);
+            }
+        },
+        sourceSize);
 
-    auto* watcher = new QFutureWatcher<ExportResult>(this);
-    connect(watcher, &QFutureWatcher<ExportResult>::finished, this, [this, watcher, exportPath] {
-        const ExportResult result = watcher->result();
-        watcher->deleteLater();
+    auto* pollTimer = new QTimer(this);
+    pollTimer->setInterval(100);
+    connect(pollTimer, &QTimer::timeout, this, [this, pollTimer, exportPath] {
+        if (!exportJob.isReady()) {
+            return;
+        }
+        pollTimer->stop();
+        pollTimer->deleteLater();
+        const JobResult result = exportJob.get();
 
         if (exportProgressTimer) {
             exportProgressTimer->stop();
@@ -1742,9 +1930,11 @@ void transform::onExportNowClicked()
             ui->exportNowButton->setEnabled(true);
         }
 
-        appendExportLog(QString("进度：100%"), "INFO");
-
-        if (result.ok) {
+        const QString message = QString::fromUtf8(result.errorMsg.c_str());
+        if (result.errorCode == MeshErrorCode::CANCELLED) {
+            statusBar()->showMessage("导出已取消", 3000);
+            appendExportLog("导出已取消，未完成的文件已删除。", "WARNING");
+        } else if (result.success) {
             // 导出成功，绿色显示结果
             statusBar()->showMessage("导出成功", 3000);
             appendExportLog("导出成功！", "SUCCESS");
@@ -1753,12 +1943,15 @@ void transform::onExportNowClicked()
         } else {
             // 导出失败，红色显示结果
             statusBar()->showMessage("导出失败", 3000);
-            appendExportLog(QString("导出失败：%1").arg(result.message.isEmpty() ? "未知错误" : result.message), "ERROR");
+            appendExportLog(QString("导出失败：%1").arg(message.isEmpty() ? "未知错误" : message), "ERROR");
             appendExportLog("导出操作已终止。", "ERROR");
-            QMessageBox::warning(this, "导出失败", result.message.isEmpty() ? "导出失败" : result.message);
+            QMessageBox::warning(this, "导出失败", message.isEmpty() ? "导出失败" : message);
         }
     });
-    watcher->setFuture(future);
+    pollTimer->start();
+    if (exportProgressTimer) {
+        exportProgressTimer->start();
+    }
 }
 
 void transform::onTreeDoubleClicked(const QModelIndex& index)
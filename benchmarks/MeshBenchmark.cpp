@@ -0,0 +1,601 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "MeshConverter.h"
+#include "MeshReader.h"
+#include "MeshWriter.h"
+#include "Profiler.h"
+#include "TaskPool.h"
+#include "VTKBridge.h"
+#include "VTKConverter.h"
+#include "SyntheticMeshes.h"
+#include <vtkUnstructuredGrid.h>
+
+#ifndef MESH_BENCHMARK_BUILD_TYPE
+#define MESH_BENCHMARK_BUILD_TYPE "unknown"
+#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Benchmark configuration (command line)
+ */
+struct BenchmarkConfig {
+    std::string size = "medium";          // Preset: small, medium, large
+    uint32_t boxCells = 0;                // Cells per axis of the tet/hex boxes (0 = preset)
+    uint32_t sphereSegments = 0;          // Equator segments of the triangle sphere (0 = preset)
+    int repeat = 3;                       // Timed repetitions per measurement (median and minimum are reported)
+    std::vector<unsigned int> threads;    // Thread counts of the batch scaling run (empty = 1, 2, 4, ... hardware)
+    uint32_t batchFiles = 0;              // Files of the batch scaling run (0 = twice the hardware threads, at least 8)
+    std::vector<std::string> only;        // Restrict the I/O cases to these names (empty = all)
+    std::string workDir;                  // Scratch directory (empty = system temp)
+    std::string outPath = "benchmark_results.json"; // JSON result file
+    bool skipIo = false;                  // Skip the reader/writer cases
+    bool skipProcessing = false;          // Skip the processVTKData stages
+    bool skipBatch = false;               // Skip the batch scaling run
+};
+
+/**
+ * @brief Synthetic mesh of the run
+ */
+struct NamedMesh {
+    std::string name;
+    MeshData mesh;
+};
+
+/**
+ * @brief Format exercised by the I/O cases
+ */
+struct FormatCase {
+    const char* name;       // Case name in the results
+    MeshFormat format;      // Format written and read back
+    const char* extension;  // Output extension ("" = directory output)
+    bool surface;           // Run on the triangle sphere (else on the tet and hex boxes)
+    bool binary;            // FormatWriteOptions::isBinary
+    bool compress;          // FormatWriteOptions::compress
+    bool viaVTK;            // Written through VTKConverter::convertFromVTK (VTK writers)
+    VtkCompressor vtkCompressor = VtkCompressor::ZLIB; // FormatWriteOptions::vtkCompressor (compressed VTK XML)
+};
+
+const FormatCase FORMAT_CASES[] = {
+    {"stl_binary", MeshFormat::STL_BINARY, ".stl", true, true, false, false},
+    {"stl_ascii", MeshFormat::STL_ASCII, ".stl", true, false, false, false},
+    {"obj", MeshFormat::OBJ, ".obj", true, false, false, false},
+    {"ply_binary", MeshFormat::PLY_BINARY, ".ply", true, true, false, false},
+    {"ply_ascii", MeshFormat::PLY_ASCII, ".ply", true, false, false, false},
+    {"off", MeshFormat::OFF, ".off", true, false, false, false},
+    {"vtk_legacy", MeshFormat::VTK_LEGACY, ".vtk", false, true, false, true},
+    {"vtu", MeshFormat::VTK_XML, ".vtu", false, true, false, false},
+    {"vtu_zlib", MeshFormat::VTK_XML, ".vtu", false, true, true, false},
+    {"vtu_lz4", MeshFormat::VTK_XML, ".vtu", false, true, true, false, VtkCompressor::LZ4},
+    {"su2", MeshFormat::SU2, ".su2", false, false, false, false},
+    {"msh2_binary", MeshFormat::GMSH_V2, ".msh", false, true, false, false},
+    {"msh4_binary", MeshFormat::GMSH_V4, ".msh", false, true, false, false},
+    {"msh4_ascii", MeshFormat::GMSH_V4, ".msh", false, false, false, false},
+    {"cgns", MeshFormat::CGNS, ".cgns", false, true, false, false},
+    {"openfoam", MeshFormat::OPENFOAM, "", false, true, false, false},
+    {"mcb", MeshFormat::MESH_CACHE, ".mcb", false, true, false, false},
+    {"mcb_lz4", MeshFormat::MESH_CACHE, ".mcb", false, true, true, false},
+};
+
+/**
+ * @brief Median and minimum of repeated timings
+ */
+struct Timing {
+    double median = 0.0;
+    double min = 0.0;
+};
+
+Timing summarize(std::vector<double> seconds) {
+    Timing timing;
+    if (seconds.empty()) {
+        return timing;
+    }
+    std::sort(seconds.begin(), seconds.end());
+    timing.min = seconds.front();
+    timing.median = seconds.size() % 2 ? seconds[seconds.size() / 2]
+                                       : 0.5 * (seconds[seconds.size() / 2 - 1] + seconds[seconds.size() / 2]);
+    return timing;
+}
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+double toMB(uint64_t bytes) {
+    return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+/**
+ * @brief Minimal JSON emitter (objects and arrays of numbers and strings)
+ */
+class JsonWriter {
+public:
+    explicit JsonWriter(std::ostream& out) : out_(out) { out_ << std::setprecision(9); }
+
+    void beginObject(const char* key = nullptr) { open(key, '{'); }
+    void endObject() { close('}'); }
+    void beginArray(const char* key = nullptr) { open(key, '['); }
+    void endArray() { close(']'); }
+
+    void value(const char* key, const std::string& text) {
+        separate(key);
+        out_ << '"';
+        for (char ch : text) {
+            switch (ch) {
+                case '"': out_ << "\\\""; break;
+                case '\\': out_ << "\\\\"; break;
+                case '\n': out_ << "\\n"; break;
+                case '\t': out_ << "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(ch) < 0x20) {
+                        out_ << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(ch)
+                             << std::dec << std::setfill(' ');
+                    } else {
+                        out_ << ch;
+                    }
+            }
+        }
+        out_ << '"';
+    }
+    void value(const char* key, const char* text) { value(key, std::string(text)); }
+    void value(const char* key, double number) {
+        separate(key);
+        out_ << (std::isfinite(number) ? number : 0.0);
+    }
+    void value(const char* key, uint64_t number) {
+        separate(key);
+        out_ << number;
+    }
+    void value(const char* key, bool flag) {
+        separate(key);
+        out_ << (flag ? "true" : "false");
+    }
+
+private:
+    void separate(const char* key) {
+        if (!first_.empty()) {
+            if (!first_.back()) {
+                out_ << ',';
+            }
+            first_.back() = false;
+            out_ << '\n' << std::string(first_.size() * 2, ' ');
+        }
+        if (key) {
+            out_ << '"' << key << "\": ";
+        }
+    }
+    void open(const char* key, char bracket) {
+        separate(key);
+        out_ << bracket;
+        first_.push_back(true);
+    }
+    void close(char bracket) {
+        const bool empty = first_.back();
+        first_.pop_back();
+        if (!empty) {
+            out_ << '\n' << std::string(first_.size() * 2, ' ');
+        }
+        out_ << bracket;
+    }
+
+    std::ostream& out_;
+    std::vector<bool> first_;  // Per open container: no member written yet
+};
+
+/**
+ * @brief Write a mesh in one of the benchmarked formats
+ */
+bool writeCase(const FormatCase& formatCase, MeshData& mesh, const std::string& path, std::string& errorMsg) {
+    FormatWriteOptions options;
+    options.isBinary = formatCase.binary;
+    options.compress = formatCase.compress;
+    options.vtkCompressor = formatCase.vtkCompressor;
+    options.formatThreads = 0;
+    MeshErrorCode errorCode;
+    if (formatCase.viaVTK) {
+        return VTKConverter::convertFromVTK(VTKBridge::wrap(mesh), path, formatCase.format, options, errorCode, errorMsg);
+    }
+    return MeshWriter::write(mesh, path, formatCase.format, options, errorCode, errorMsg);
+}
+
+/**
+ * @brief Reader and writer throughput of every format on the synthetic meshes
+ */
+void runIoCases(const BenchmarkConfig& config, std::vector<NamedMesh>& meshes, const std::filesystem::path& workDir, JsonWriter& json) {
+    json.beginArray("io");
+    for (const FormatCase& formatCase : FORMAT_CASES) {
+        if (!config.only.empty() && std::find(config.only.begin(), config.only.end(), formatCase.name) == config.only.end()) {
+            continue;
+        }
+        for (NamedMesh& named : meshes) {
+            if ((named.name == "tri_sphere") != formatCase.surface) {
+                continue;
+            }
+            const std::filesystem::path path = workDir / (std::string(formatCase.name) + "_" + named.name + formatCase.extension);
+            const uint64_t cells = named.mesh.cells.size();
+            std::cerr << "[io] " << formatCase.name << " / " << named.name << std::endl;
+
+            json.beginObject();
+            json.value("format", formatCase.name);
+            json.value("mesh", named.name);
+            json.value("points", static_cast<uint64_t>(named.mesh.points.size() / 3));
+            json.value("cells", cells);
+
+            std::string errorMsg;
+            bool ok = true;
+            std::vector<double> writeSeconds;
+            std::vector<double> readSeconds;
+            uint64_t fileBytes = 0;
+            uint64_t readCells = 0;
+            {
+                for (int r = 0; r < config.repeat && ok; ++r) {
+                    std::error_code ec;
+                    std::filesystem::remove_all(path, ec);
+                    const Clock::time_point start = Clock::now();
+                    ok = writeCase(formatCase, named.mesh, path.string(), errorMsg);
+                    writeSeconds.push_back(secondsSince(start));
+                }
+                fileBytes = ok ? Profiler::pathBytes(path.string()) : 0;
+                for (int r = 0; r < config.repeat && ok; ++r) {
+                    MeshData readBack;
+                    MeshErrorCode errorCode;
+                    const Clock::time_point start = Clock::now();
+                    ok = MeshReader::readAuto(path.string(), readBack, errorCode, errorMsg);
+                    readSeconds.push_back(secondsSince(start));
+                    readCells = readBack.cells.size();
+                }
+            }
+
+            json.value("ok", ok);
+            if (!ok) {
+                json.value("error", errorMsg);
+            } else {
+                const Timing write = summarize(writeSeconds);
+                const Timing read = summarize(readSeconds);
+                json.value("fileBytes", fileBytes);
+                json.value("readCells", readCells);
+                json.value("writeSeconds", write.median);
+                json.value("writeSecondsMin", write.min);
+                json.value("writeMBps", write.median > 0.0 ? toMB(fileBytes) / write.median : 0.0);
+                json.value("writeCellsPerSecond", write.median > 0.0 ? cells / write.median : 0.0);
+                json.value("readSeconds", read.median);
+                json.value("readSecondsMin", read.min);
+                json.value("readMBps", read.median > 0.0 ? toMB(fileBytes) / read.median : 0.0);
+                json.value("readCellsPerSecond", read.median > 0.0 ? readCells / read.median : 0.0);
+            }
+            json.value("peakRssMB", toMB(Profiler::peakRssBytes()));
+            json.endObject();
+
+            std::error_code ec;
+            std::filesystem::remove_all(path, ec);
+        }
+    }
+    json.endArray();
+}
+
+/**
+ * @brief processVTKData timed one stage at a time (every other stage disabled)
+ */
+void runProcessingStages(const BenchmarkConfig& config, std::vector<NamedMesh>& meshes, JsonWriter& json) {
+    struct Stage {
+        const char* name;
+        std::function<void(VTKConverter::VTKProcessingOptions&)> enable;
+    };
+    const Stage stages[] = {
+        {"passthrough", [](VTKConverter::VTKProcessingOptions&) {}},
+        {"cleaning", [](VTKConverter::VTKProcessingOptions& o) { o.enableCleaning = true; }},
+        {"triangulation", [](VTKConverter::VTKProcessingOptions& o) { o.enableTriangulation = true; }},
+        {"decimation", [](VTKConverter::VTKProcessingOptions& o) { o.enableDecimation = true; o.decimationTarget = 0.5; }},
+        {"smoothing_laplacian", [](VTKConverter::VTKProcessingOptions& o) { o.enableSmoothing = true; }},
+        {"smoothing_taubin", [](VTKConverter::VTKProcessingOptions& o) { o.enableSmoothing = true; o.taubinSmoothing = true; }},
+        {"normals", [](VTKConverter::VTKProcessingOptions& o) { o.enableNormalComputation = true; }},
+    };
+
+    json.beginArray("processing");
+    for (NamedMesh& named : meshes) {
+        vtkSmartPointer<vtkUnstructuredGrid> input = VTKBridge::copy(named.mesh);
+        for (const Stage& stage : stages) {
+            // Volume meshes take the index-preserving path, where only cleaning does work
+            if (named.name != "tri_sphere" && std::string(stage.name) != "passthrough" && std::string(stage.name) != "cleaning") {
+                continue;
+            }
+            std::cerr << "[processing] " << stage.name << " / " << named.name << std::endl;
+            VTKConverter::VTKProcessingOptions options;
+            options.enableCleaning = false;
+            stage.enable(options);
+
+            std::vector<double> seconds;
+            bool ok = true;
+            std::string errorMsg;
+            uint64_t outputCells = 0;
+            {
+                for (int r = 0; r < config.repeat && ok; ++r) {
+                    vtkSmartPointer<vtkUnstructuredGrid> output;
+                    MeshErrorCode errorCode;
+                    const Clock::time_point start = Clock::now();
+                    ok = VTKConverter::processVTKData(input, options, output, errorCode, errorMsg);
+                    seconds.push_back(secondsSince(start));
+                    outputCells = ok && output ? static_cast<uint64_t>(output->GetNumberOfCells()) : 0;
+                }
+            }
+            const Timing timing = summarize(seconds);
+            json.beginObject();
+            json.value("stage", stage.name);
+            json.value("mesh", named.name);
+            json.value("ok", ok);
+            if (!ok) {
+                json.value("error", errorMsg);
+            }
+            json.value("inputCells", static_cast<uint64_t>(input->GetNumberOfCells()));
+            json.value("outputCells", outputCells);
+            json.value("seconds", timing.median);
+            json.value("secondsMin", timing.min);
+            json.value("cellsPerSecond", timing.median > 0.0 ? input->GetNumberOfCells() / timing.median : 0.0);
+            json.value("peakRssMB", toMB(Profiler::peakRssBytes()));
+            json.endObject();
+        }
+    }
+    json.endArray();
+}
+
+/**
+ * @brief MeshConverter::batchConvert wall time across pool sizes (STL binary -> PLY binary)
+ */
+void runBatchScaling(const BenchmarkConfig& config, const MeshData& sphere, const std::filesystem::path& workDir, JsonWriter& json) {
+    const unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned int> threadCounts = config.threads;
+    if (threadCounts.empty()) {
+        for (unsigned int t = 1; t < hardware; t *= 2) {
+            threadCounts.push_back(t);
+        }
+        threadCounts.push_back(hardware);
+    }
+    const uint32_t fileCount = config.batchFiles ? config.batchFiles : std::max(8u, 2 * hardware);
+
+    // Inputs: identical files, so every task costs the same and scaling is not skewed by sizes
+    const std::filesystem::path srcDir = workDir / "batch_src";
+    const std::filesystem::path dstDir = workDir / "batch_dst";
+    std::filesystem::create_directories(srcDir);
+    std::vector<std::string> srcFiles;
+    uint64_t inputBytes = 0;
+    {
+        FormatWriteOptions options;
+        MeshErrorCode errorCode;
+        std::string errorMsg;
+        const std::string first = (srcDir / "mesh_0.stl").string();
+        if (!MeshWriter::write(sphere, first, MeshFormat::STL_BINARY, options, errorCode, errorMsg)) {
+            std::cerr << "Batch input could not be written: " << errorMsg << std::endl;
+            return;
+        }
+        for (uint32_t i = 0; i < fileCount; ++i) {
+            const std::string path = (srcDir / ("mesh_" + std::to_string(i) + ".stl")).string();
+            if (i > 0) {
+                std::filesystem::copy_file(first, path, std::filesystem::copy_options::overwrite_existing);
+            }
+            srcFiles.push_back(path);
+            inputBytes += Profiler::pathBytes(path);
+        }
+    }
+
+    json.beginArray("batch");
+    double baseline = 0.0;
+    for (unsigned int threads : threadCounts) {
+        std::cerr << "[batch] " << threads << " threads, " << fileCount << " files" << std::endl;
+        TaskPool pool(threads);
+        BatchConvertOptions batchOptions;
+        batchOptions.pool = &pool;
+        FormatWriteOptions writeOptions;
+        std::vector<double> seconds;
+        uint64_t converted = 0;
+        {
+                for (int r = 0; r < config.repeat; ++r) {
+                std::error_code ec;
+                std::filesystem::remove_all(dstDir, ec);
+                std::unordered_map<std::string, std::pair<MeshErrorCode, std::string>> errorMap;
+                const Clock::time_point start = Clock::now();
+                converted = MeshConverter::batchConvert(srcFiles, dstDir.string(), MeshFormat::PLY_BINARY, writeOptions, errorMap, batchOptions);
+                seconds.push_back(secondsSince(start));
+            }
+        }
+        const Timing timing = summarize(seconds);
+        if (baseline == 0.0) {
+            baseline = timing.median;
+        }
+        json.beginObject();
+        json.value("threads", static_cast<uint64_t>(threads));
+        json.value("files", static_cast<uint64_t>(fileCount));
+        json.value("converted", converted);
+        json.value("inputBytes", inputBytes);
+        json.value("seconds", timing.median);
+        json.value("secondsMin", timing.min);
+        json.value("filesPerSecond", timing.median > 0.0 ? fileCount / timing.median : 0.0);
+        json.value("inputMBps", timing.median > 0.0 ? toMB(inputBytes) / timing.median : 0.0);
+        json.value("speedup", timing.median > 0.0 ? baseline / timing.median : 0.0);
+        json.value("peakRssMB", toMB(Profiler::peakRssBytes()));
+        json.endObject();
+    }
+    json.endArray();
+
+    std::error_code ec;
+    std::filesystem::remove_all(srcDir, ec);
+    std::filesystem::remove_all(dstDir, ec);
+}
+
+std::vector<std::string> splitList(const std::string& text) {
+    std::vector<std::string> items;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+void printUsage() {
+    std::cout << "Usage: mesh_benchmark [options]" << std::endl;
+    std::cout << "  --size <small|medium|large>  Mesh size preset (default medium)" << std::endl;
+    std::cout << "  --box <n>                    Cells per axis of the tet/hex boxes (overrides the preset)" << std::endl;
+    std::cout << "  --sphere <n>                 Equator segments of the triangle sphere (overrides the preset)" << std::endl;
+    std::cout << "  --repeat <n>                 Timed repetitions per measurement (default 3)" << std::endl;
+    std::cout << "  --threads <a,b,...>          Batch scaling thread counts (default 1, 2, 4, ... all cores)" << std::endl;
+    std::cout << "  --batch-files <n>            Files of the batch scaling run" << std::endl;
+    std::cout << "  --only <case,...>            Run only these I/O cases (e.g. stl_binary,msh4_binary)" << std::endl;
+    std::cout << "  --no-io | --no-processing | --no-batch   Skip a benchmark group" << std::endl;
+    std::cout << "  --work-dir <dir>             Scratch directory (default system temp)" << std::endl;
+    std::cout << "  --out <file>                 JSON result file (default benchmark_results.json)" << std::endl;
+}
+
+bool parseArguments(int argc, char* argv[], BenchmarkConfig& config) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        try {
+            if (arg == "--size" && hasValue) {
+                config.size = argv[++i];
+            } else if (arg == "--box" && hasValue) {
+                config.boxCells = static_cast<uint32_t>(std::stoul(argv[++i]));
+            } else if (arg == "--sphere" && hasValue) {
+                config.sphereSegments = static_cast<uint32_t>(std::stoul(argv[++i]));
+            } else if (arg == "--repeat" && hasValue) {
+                config.repeat = std::max(1, std::stoi(argv[++i]));
+            } else if (arg == "--threads" && hasValue) {
+                for (const std::string& item : splitList(argv[++i])) {
+                    config.threads.push_back(static_cast<unsigned int>(std::max(1ul, std::stoul(item))));
+                }
+            } else if (arg == "--batch-files" && hasValue) {
+                config.batchFiles = static_cast<uint32_t>(std::stoul(argv[++i]));
+            } else if (arg == "--only" && hasValue) {
+                config.only = splitList(argv[++i]);
+            } else if (arg == "--work-dir" && hasValue) {
+                config.workDir = argv[++i];
+            } else if (arg == "--out" && hasValue) {
+                config.outPath = argv[++i];
+            } else if (arg == "--no-io") {
+                config.skipIo = true;
+            } else if (arg == "--no-processing") {
+                config.skipProcessing = true;
+            } else if (arg == "--no-batch") {
+                config.skipBatch = true;
+            } else {
+                return false;
+            }
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+    if (config.size == "small") {
+        config.boxCells = config.boxCells ? config.boxCells : 20;
+        config.sphereSegments = config.sphereSegments ? config.sphereSegments : 128;
+    } else if (config.size == "medium") {
+        config.boxCells = config.boxCells ? config.boxCells : 50;
+        config.sphereSegments = config.sphereSegments ? config.sphereSegments : 512;
+    } else if (config.size == "large") {
+        config.boxCells = config.boxCells ? config.boxCells : 100;
+        config.sphereSegments = config.sphereSegments ? config.sphereSegments : 1536;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+/**
+ * @brief Reproducible benchmark of the readers, writers, processing stages and batch scaling
+ *
+ * All inputs are generated (SyntheticMeshes), results go to a JSON file whose schema is stable
+ * across releases so trends can be tracked. Files are read back right after being written, so
+ * read figures are warm page cache numbers.
+ */
+int main(int argc, char* argv[]) {
+    BenchmarkConfig config;
+    if (!parseArguments(argc, argv, config)) {
+        printUsage();
+        return 1;
+    }
+
+    std::error_code ec;
+    const std::filesystem::path workDir = (config.workDir.empty() ? std::filesystem::temp_directory_path(ec) : std::filesystem::path(config.workDir))
+        / ("mesh_benchmark_" + std::to_string(std::chrono::system_clock::now().time_since_epoch().count()));
+    std::filesystem::create_directories(workDir, ec);
+    if (ec) {
+        std::cerr << "Cannot create work directory " << workDir.string() << ": " << ec.message() << std::endl;
+        return 1;
+    }
+
+    std::cerr << "Generating meshes (box " << config.boxCells << ", sphere " << config.sphereSegments << ")" << std::endl;
+    std::vector<NamedMesh> meshes;
+    meshes.push_back({"tet_box", SyntheticMeshes::tetBox(config.boxCells)});
+    meshes.push_back({"hex_box", SyntheticMeshes::hexBox(config.boxCells)});
+    meshes.push_back({"tri_sphere", SyntheticMeshes::triSphere(config.sphereSegments)});
+
+    std::ofstream out(config.outPath);
+    if (!out.is_open()) {
+        std::cerr << "Cannot write " << config.outPath << std::endl;
+        return 1;
+    }
+    JsonWriter json(out);
+    json.beginObject();
+    json.value("schema", static_cast<uint64_t>(1));
+    json.value("suite", "mesh_benchmark");
+    json.value("timestamp", static_cast<uint64_t>(std::time(nullptr)));
+    json.beginObject("environment");
+    json.value("hardwareThreads", static_cast<uint64_t>(std::thread::hardware_concurrency()));
+    json.value("buildType", MESH_BENCHMARK_BUILD_TYPE);
+#if defined(__clang__)
+    json.value("compiler", std::string("clang ") + __clang_version__);
+#elif defined(__GNUC__)
+    json.value("compiler", std::string("gcc ") + __VERSION__);
+#elif defined(_MSC_VER)
+    json.value("compiler", "msvc " + std::to_string(_MSC_VER));
+#endif
+#if defined(_WIN32)
+    json.value("os", "windows");
+#elif defined(__APPLE__)
+    json.value("os", "macos");
+#else
+    json.value("os", "linux");
+#endif
+    json.endObject();
+    json.beginObject("config");
+    json.value("size", config.size);
+    json.value("boxCells", static_cast<uint64_t>(config.boxCells));
+    json.value("sphereSegments", static_cast<uint64_t>(config.sphereSegments));
+    json.value("repeat", static_cast<uint64_t>(config.repeat));
+    json.value("pageCache", "warm");
+    json.endObject();
+
+    if (!config.skipIo) {
+        runIoCases(config, meshes, workDir, json);
+    }
+    if (!config.skipProcessing) {
+        runProcessingStages(config, meshes, json);
+    }
+    if (!config.skipBatch) {
+        runBatchScaling(config, meshes.back().mesh, workDir, json);
+    }
+    json.value("peakRssMB", toMB(Profiler::peakRssBytes()));
+    json.endObject();
+    out << std::endl;
+
+    std::filesystem::remove_all(workDir, ec);
+    std::cerr << "Results written to " << config.outPath << std::endl;
+    return 0;
+}
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "MeshTypes.h"
+
+/**
+ * @brief Deterministic mesh generators of the benchmark suite
+ *
+ * The meshes depend only on their size parameter, so two runs (or two machines) benchmark the
+ * same bytes. Every mesh carries a float point scalar "pressure" and an INT32 cell scalar
+ * "region", so attribute handling is part of the measured work.
+ */
+namespace SyntheticMeshes {
+
+/**
+ * @brief Regular grid of n x n x n unit cells as hexahedra
+ * @param n Cells per axis
+ * @return Mesh with (n+1)^3 points and n^3 cells
+ */
+inline MeshData hexBox(uint32_t n) {
+    MeshData mesh;
+    const uint32_t m = n + 1;
+    mesh.points.reserve(static_cast<size_t>(m) * m * m * 3);
+    for (uint32_t k = 0; k < m; ++k) {
+        for (uint32_t j = 0; j < m; ++j) {
+            for (uint32_t i = 0; i < m; ++i) {
+                mesh.points.push_back(static_cast<float>(i));
+                mesh.points.push_back(static_cast<float>(j));
+                mesh.points.push_back(static_cast<float>(k));
+            }
+        }
+    }
+    auto id = [m](uint32_t i, uint32_t j, uint32_t k) { return (k * m + j) * m + i; };
+    std::vector<int32_t> region;
+    region.reserve(static_cast<size_t>(n) * n * n);
+    for (uint32_t k = 0; k < n; ++k) {
+        for (uint32_t j = 0; j < n; ++j) {
+            for (uint32_t i = 0; i < n; ++i) {
+                const uint32_t hex[8] = {
+                    id(i, j, k), id(i + 1, j, k), id(i + 1, j + 1, k), id(i, j + 1, k),
+                    id(i, j, k + 1), id(i + 1, j, k + 1), id(i + 1, j + 1, k + 1), id(i, j + 1, k + 1)
+                };
+                mesh.cells.addCell(VtkCellType::HEXAHEDRON, hex, 8);
+                region.push_back(static_cast<int32_t>(k));
+            }
+        }
+    }
+    std::vector<float> pressure(mesh.points.size() / 3);
+    for (size_t p = 0; p < pressure.size(); ++p) {
+        pressure[p] = mesh.points[p * 3] + 0.5f * mesh.points[p * 3 + 1] - 0.25f * mesh.points[p * 3 + 2];
+    }
+    mesh.pointData["pressure"] = MeshAttribute(std::move(pressure));
+    mesh.cellData["region"] = MeshAttribute(std::move(region));
+    mesh.calculateMetadata();
+    return mesh;
+}
+
+/**
+ * @brief Regular grid of n x n x n unit cells, each split into six positively oriented tetrahedra
+ * @param n Cells per axis
+ * @return Mesh with (n+1)^3 points and 6 n^3 cells
+ */
+inline MeshData tetBox(uint32_t n) {
+    MeshData hexes = hexBox(n);
+    MeshData mesh;
+    mesh.points = std::move(hexes.points);
+    mesh.pointData = std::move(hexes.pointData);
+
+    // Kuhn subdivision along the 0-6 diagonal (hexahedron corner numbering); orientation fixed once
+    int tets[6][4] = {{0, 1, 2, 6}, {0, 2, 3, 6}, {0, 3, 7, 6}, {0, 7, 4, 6}, {0, 4, 5, 6}, {0, 5, 1, 6}};
+    static const float corner[8][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}};
+    for (auto& tet : tets) {
+        float a[3], b[3], c[3];
+        for (int d = 0; d < 3; ++d) {
+            a[d] = corner[tet[1]][d] - corner[tet[0]][d];
+            b[d] = corner[tet[2]][d] - corner[tet[0]][d];
+            c[d] = corner[tet[3]][d] - corner[tet[0]][d];
+        }
+        const float volume = (a[1] * b[2] - a[2] * b[1]) * c[0] + (a[2] * b[0] - a[0] * b[2]) * c[1] + (a[0] * b[1] - a[1] * b[0]) * c[2];
+        if (volume < 0.0f) {
+            std::swap(tet[1], tet[2]);
+        }
+    }
+
+    const MeshAttribute& hexRegion = hexes.cellData.at("region");
+    const int32_t* regionValues = static_cast<const int32_t*>(hexRegion.data());
+    std::vector<int32_t> region;
+    region.reserve(hexes.cells.size() * 6);
+    for (size_t c = 0; c < hexes.cells.size(); ++c) {
+        const uint32_t* hex = hexes.cells.connectivity.data() + hexes.cells.offsets[c];
+        for (const auto& tet : tets) {
+            const uint32_t ids[4] = {hex[tet[0]], hex[tet[1]], hex[tet[2]], hex[tet[3]]};
+            mesh.cells.addCell(VtkCellType::TETRA, ids, 4);
+            region.push_back(regionValues[c]);
+        }
+    }
+    mesh.cellData["region"] = MeshAttribute(std::move(region));
+    mesh.calculateMetadata();
+    return mesh;
+}
+
+/**
+ * @brief Closed UV sphere of unit radius made of outward-facing triangles
+ * @param segments Segments around the equator (rings = segments / 2)
+ * @return Mesh with about segments^2 triangles
+ */
+inline MeshData triSphere(uint32_t segments) {
+    const double pi = 3.14159265358979323846;
+    segments = segments < 8 ? 8 : segments;
+    const uint32_t rings = segments / 2;
+    MeshData mesh;
+    mesh.points.reserve((static_cast<size_t>(rings - 1) * segments + 2) * 3);
+    mesh.points.insert(mesh.points.end(), {0.0f, 0.0f, 1.0f});
+    for (uint32_t r = 1; r < rings; ++r) {
+        const double theta = pi * r / rings;
+        for (uint32_t s = 0; s < segments; ++s) {
+            const double phi = 2.0 * pi * s / segments;
+            mesh.points.push_back(static_cast<float>(std::sin(theta) * std::cos(phi)));
+            mesh.points.push_back(static_cast<float>(std::sin(theta) * std::sin(phi)));
+            mesh.points.push_back(static_cast<float>(std::cos(theta)));
+        }
+    }
+    mesh.points.insert(mesh.points.end(), {0.0f, 0.0f, -1.0f});
+    const uint32_t south = static_cast<uint32_t>(mesh.points.size() / 3 - 1);
+    auto ring = [segments](uint32_t r, uint32_t s) { return 1 + (r - 1) * segments + s % segments; };
+
+    std::vector<int32_t> region;
+    auto addTriangle = [&](uint32_t a, uint32_t b, uint32_t c, uint32_t band) {
+        const uint32_t ids[3] = {a, b, c};
+        mesh.cells.addCell(VtkCellType::TRIANGLE, ids, 3);
+        region.push_back(static_cast<int32_t>(band));
+    };
+    for (uint32_t s = 0; s < segments; ++s) {
+        addTriangle(0, ring(1, s), ring(1, s + 1), 0);
+    }
+    for (uint32_t r = 1; r + 1 < rings; ++r) {
+        for (uint32_t s = 0; s < segments; ++s) {
+            addTriangle(ring(r, s), ring(r + 1, s), ring(r + 1, s + 1), r);
+            addTriangle(ring(r, s), ring(r + 1, s + 1), ring(r, s + 1), r);
+        }
+    }
+    for (uint32_t s = 0; s < segments; ++s) {
+        addTriangle(ring(rings - 1, s), south, ring(rings - 1, s + 1), rings - 1);
+    }
+
+    std::vector<float> pressure(mesh.points.size() / 3);
+    for (size_t p = 0; p < pressure.size(); ++p) {
+        pressure[p] = mesh.points[p * 3 + 2];
+    }
+    mesh.pointData["pressure"] = MeshAttribute(std::move(pressure));
+    mesh.cellData["region"] = MeshAttribute(std::move(region));
+    mesh.calculateMetadata();
+    return mesh;
+}
+
+} // namespace SyntheticMeshes
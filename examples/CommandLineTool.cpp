@@ -2,9 +2,12 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <algorithm>
 #include "MeshConverter.h"
+#include "ConversionPipeline.h"
 #include "MeshHelper.h"
+#include "Profiler.h"
 #include "VTKConverter.h"
 
 struct CommandLineOptions {
@@ -12,16 +15,31 @@ struct CommandLineOptions {
     std::string outputFile;
     std::string sourceFormat;
     std::string targetFormat;
+    std::vector<std::string> batchInputFiles;
+    std::string batchOutputDir;
+    size_t jobs = 0;
+    uint64_t memoryBudgetMB = 0;
+    unsigned int formatThreads = 1;
+    MeshReorder reorder = MeshReorder::NONE;
+    bool compress = false;
+    VtkCompressor vtkCompressor = VtkCompressor::ZLIB;
+    uint32_t vtkBlockSize = 1024 * 1024;
+    bool pipeline = false;
+    bool incremental = false;
+    bool stream = false;
     bool help = false;
     bool version = false;
     bool listFormats = false;
     bool verbose = false;
+    bool profile = false;
+    std::string profileTrace;
     VTKConverter::VTKProcessingOptions processingOptions;
 };
 
 void printHelp() {
     std::cout << "Mesh Format Converter Command Line Tool v1.0" << std::endl;
     std::cout << "Usage: meshconv [options] <input file> <output file>" << std::endl;
+    std::cout << "       meshconv --batch <output dir> -t <format> [options] <input files...>" << std::endl;
     std::cout << std::endl;
     std::cout << "Options:" << std::endl;
     std::cout << "  -h, --help             Show this help message" << std::endl;
@@ -29,11 +47,23 @@ void printHelp() {
     std::cout << "  -l, --list-formats     List supported formats" << std::endl;
     std::cout << "  -s, --source-format    Specify source file format" << std::endl;
     std::cout << "  -t, --target-format    Specify target file format" << std::endl;
-    std::cout << "  -V, --verbose          Enable verbose output" << std::endl;
+    std::cout << "  -V, --verbose          Enable verbose output (progress messages and stage timings)" << std::endl;
+    std::cout << "  --profile [trace.json] Print per-stage time, bytes, cells and peak memory; optionally write a Chrome trace" << std::endl;
+    std::cout << "  -b, --batch <dir>      Convert all input files into <dir> (requires --target-format)" << std::endl;
+    std::cout << "  -j, --jobs <n>         Maximum files converted at once in batch mode (0 = all cores; processing threads with --pipeline)" << std::endl;
+    std::cout << "  --memory-budget <MB>   Maximum total input size converted at once in batch mode" << std::endl;
+    std::cout << "  --stream               Convert block by block in bounded memory (stl, obj, ply, off, su2; no processing)" << std::endl;
+    std::cout << "  --pipeline             Batch mode: overlap read/process/write stages and report stage utilization" << std::endl;
+    std::cout << "  --incremental          Batch mode: skip files unchanged since the last run (manifest kept in the output dir)" << std::endl;
+    std::cout << "  --format-threads <n>   Threads formatting ASCII output (su2, stl, obj, ply, off) and compressing blocks (vtu, vtp, mcb); 0 = all cores, default 1" << std::endl;
+    std::cout << "  --compress <codec>     Compress the output: vtu/vtp block codec zlib, lz4 or lzma (mcb always uses lz4, cgns deflate)" << std::endl;
+    std::cout << "  --block-size <KB>      Uncompressed size of a vtu/vtp compression block (default 1024)" << std::endl;
+    std::cout << "  --reorder <curve>      Sort points and cells for locality before writing (hilbert, morton)" << std::endl;
     std::cout << "  --no-cleaning          Disable point cleaning" << std::endl;
     std::cout << "  --triangulate          Enable triangulation" << std::endl;
     std::cout << "  --decimate <factor>    Enable mesh decimation, specify factor(0.0-1.0)" << std::endl;
     std::cout << "  --smooth <iterations>  Enable mesh smoothing, specify iterations" << std::endl;
+    std::cout << "  --taubin               Use Taubin (volume-preserving) smoothing with --smooth" << std::endl;
     std::cout << "  --compute-normals      Compute normal vectors" << std::endl;
     std::cout << std::endl;
     std::cout << "Supported formats:" << std::endl;
@@ -44,6 +74,12 @@ void printHelp() {
     std::cout << "  meshconv input.stl output.vtk" << std::endl;
     std::cout << "  meshconv --source-format stl --target-format vtk input.stl output.vtk" << std::endl;
     std::cout << "  meshconv --decimate 0.5 --smooth 10 input.stl output.obj" << std::endl;
+    std::cout << "  meshconv --batch out -t vtu -j 4 --memory-budget 4096 a.cgns b.msh c.su2" << std::endl;
+    std::cout << "  meshconv --stream scan.stl scan.ply" << std::endl;
+    std::cout << "  meshconv --reorder hilbert input.msh output.vtu" << std::endl;
+    std::cout << "  meshconv --batch out -t stl --pipeline --smooth 10 a.obj b.ply c.off" << std::endl;
+    std::cout << "  meshconv --batch out -t vtu --incremental meshes/*.msh" << std::endl;
+    std::cout << "  meshconv --profile trace.json --decimate 0.5 scan.stl scan.ply" << std::endl;
 }
 
 void printVersion() {
@@ -68,6 +104,9 @@ void printSupportedFormats() {
     std::cout << "  OBJ (.obj)" << std::endl;
     std::cout << "  PLY ASCII/Binary (.ply)" << std::endl;
     std::cout << "  OFF (.off)" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Native formats:" << std::endl;
+    std::cout << "  Mesh Cache (.mcb)" << std::endl;
 }
 
 MeshFormat stringToFormat(const std::string& formatStr) {
@@ -83,6 +122,7 @@ MeshFormat stringToFormat(const std::string& formatStr) {
     if (lowerStr == "cgns") return MeshFormat::CGNS;
     if (lowerStr == "msh") return MeshFormat::GMSH_V4;
     if (lowerStr == "su2") return MeshFormat::SU2;
+    if (lowerStr == "mcb") return MeshFormat::MESH_CACHE;
     
     return MeshFormat::UNKNOWN;
 }
@@ -115,9 +155,95 @@ bool parseCommandLine(int argc, char* argv[], CommandLineOptions& options) {
             } else {
                 return false;
             }
+        } else if (arg == "-b" || arg == "--batch") {
+            if (i + 1 < argc) {
+                options.batchOutputDir = argv[i + 1];
+                i += 2;
+            } else {
+                return false;
+            }
+        } else if (arg == "-j" || arg == "--jobs") {
+            if (i + 1 < argc) {
+                options.jobs = static_cast<size_t>(std::stoul(argv[i + 1]));
+                i += 2;
+            } else {
+                return false;
+            }
+        } else if (arg == "--memory-budget") {
+            if (i + 1 < argc) {
+                options.memoryBudgetMB = std::stoull(argv[i + 1]);
+                i += 2;
+            } else {
+                return false;
+            }
+        } else if (arg == "--format-threads") {
+            if (i + 1 < argc) {
+                options.formatThreads = static_cast<unsigned int>(std::stoul(argv[i + 1]));
+                i += 2;
+            } else {
+                return false;
+            }
+        } else if (arg == "--compress") {
+            if (i + 1 < argc) {
+                const std::string codec = argv[i + 1];
+                if (codec == "zlib") {
+                    options.vtkCompressor = VtkCompressor::ZLIB;
+                } else if (codec == "lz4") {
+                    options.vtkCompressor = VtkCompressor::LZ4;
+                } else if (codec == "lzma") {
+                    options.vtkCompressor = VtkCompressor::LZMA;
+                } else {
+                    return false;
+                }
+                options.compress = true;
+                i += 2;
+            } else {
+                return false;
+            }
+        } else if (arg == "--block-size") {
+            if (i + 1 < argc) {
+                options.vtkBlockSize = static_cast<uint32_t>(std::stoul(argv[i + 1]) * 1024);
+                i += 2;
+            } else {
+                return false;
+            }
+        } else if (arg == "--reorder") {
+            if (i + 1 < argc) {
+                const std::string curve = argv[i + 1];
+                if (curve == "hilbert") {
+                    options.reorder = MeshReorder::HILBERT;
+                } else if (curve == "morton") {
+                    options.reorder = MeshReorder::MORTON;
+                } else {
+                    return false;
+                }
+                i += 2;
+            } else {
+                return false;
+            }
+        } else if (arg == "--stream") {
+            options.stream = true;
+            i++;
+        } else if (arg == "--pipeline") {
+            options.pipeline = true;
+            i++;
+        } else if (arg == "--incremental") {
+            options.incremental = true;
+            i++;
         } else if (arg == "-V" || arg == "--verbose") {
             options.verbose = true;
             i++;
+        } else if (arg == "--profile") {
+            options.profile = true;
+            i++;
+            // Optional trace file: a JSON path right after the flag
+            if (i < argc) {
+                const std::string next = argv[i];
+                if (next.size() > 5 && next.compare(next.size() - 5, 5, ".json") == 0) {
+                    options.profileTrace = next;
+                    i++;
+                }
+            }
         } else if (arg == "--no-cleaning") {
             options.processingOptions.enableCleaning = false;
             i++;
@@ -140,27 +266,162 @@ bool parseCommandLine(int argc, char* argv[], CommandLineOptions& options) {
             } else {
                 return false;
             }
+        } else if (arg == "--taubin") {
+            options.processingOptions.taubinSmoothing = true;
+            i++;
         } else if (arg == "--compute-normals") {
             options.processingOptions.enableNormalComputation = true;
             i++;
         } else if (arg[0] != '-') {
-            if (options.inputFile.empty()) {
-                options.inputFile = arg;
-                i++;
-            } else if (options.outputFile.empty()) {
-                options.outputFile = arg;
-                i++;
-            } else {
-                return false;
-            }
+            options.batchInputFiles.push_back(arg);
+            i++;
         } else {
             return false;
         }
     }
     
+    // Single conversion takes exactly <input file> <output file>
+    if (options.batchOutputDir.empty()) {
+        if (options.batchInputFiles.size() > 2) {
+            return false;
+        }
+        if (!options.batchInputFiles.empty()) {
+            options.inputFile = options.batchInputFiles[0];
+        }
+        if (options.batchInputFiles.size() > 1) {
+            options.outputFile = options.batchInputFiles[1];
+        }
+        options.batchInputFiles.clear();
+    }
+    
     return true;
 }
 
+/**
+ * @brief Profiling sinks of one run: attached from the options, reported when the run ends
+ */
+class ProfileSession {
+public:
+    explicit ProfileSession(const CommandLineOptions& options) : tracePath_(options.profileTrace) {
+        if (options.verbose) {
+            Profiler::addSink(std::make_shared<ConsoleProfileSink>(options.profile));
+        }
+        if (options.profile) {
+            summary_ = std::make_shared<StageSummarySink>();
+            Profiler::addSink(summary_);
+        }
+        if (!tracePath_.empty()) {
+            trace_ = std::make_shared<ChromeTraceSink>();
+            Profiler::addSink(trace_);
+        }
+    }
+
+    ~ProfileSession() {
+        Profiler::clearSinks();
+        if (summary_) {
+            std::cout << std::endl << "Profile:" << std::endl << summary_->toString();
+        }
+        if (trace_) {
+            std::string errorMsg;
+            if (trace_->write(tracePath_, errorMsg)) {
+                std::cout << "Trace written to " << tracePath_ << " (" << trace_->eventCount() << " events)" << std::endl;
+            } else {
+                std::cerr << errorMsg << std::endl;
+            }
+        }
+    }
+
+    ProfileSession(const ProfileSession&) = delete;
+    ProfileSession& operator=(const ProfileSession&) = delete;
+
+private:
+    std::string tracePath_;
+    std::shared_ptr<StageSummarySink> summary_;
+    std::shared_ptr<ChromeTraceSink> trace_;
+};
+
+int runPipelinedBatch(const CommandLineOptions& options, MeshFormat targetFormat) {
+    PipelineOptions pipelineOptions;
+    pipelineOptions.processThreads = options.jobs;
+    pipelineOptions.incremental = options.incremental;
+    
+    if (options.verbose) {
+        std::cout << "Batch output directory: " << options.batchOutputDir << std::endl;
+        std::cout << "Input files: " << options.batchInputFiles.size() << std::endl;
+        std::cout << "Processing threads: " << (options.jobs ? std::to_string(options.jobs) : "auto") << std::endl;
+        std::cout << "Queue capacity: " << pipelineOptions.queueCapacity << std::endl;
+    }
+    
+    FormatWriteOptions writeOptions;
+    writeOptions.formatThreads = options.formatThreads;
+    writeOptions.reorder = options.reorder;
+    writeOptions.compress = options.compress;
+    writeOptions.vtkCompressor = options.vtkCompressor;
+    writeOptions.vtkBlockSize = options.vtkBlockSize;
+    std::unordered_map<std::string, std::pair<MeshErrorCode, std::string>> errorMap;
+    PipelineReport report;
+    uint64_t successCount = ConversionPipeline::batchConvert(options.batchInputFiles, options.batchOutputDir,
+                                                             targetFormat, options.processingOptions, writeOptions,
+                                                             pipelineOptions, errorMap, report);
+    
+    for (const auto& [filePath, error] : errorMap) {
+        std::cerr << "Conversion failed: " << filePath << ": " << error.second
+                  << " (Error code: " << static_cast<int>(error.first) << ")" << std::endl;
+    }
+    std::cout << report.toString();
+    std::cout << "Up to date: " << successCount << " of " << options.batchInputFiles.size() << " files" << std::endl;
+    return errorMap.empty() ? 0 : 1;
+}
+
+int runBatch(const CommandLineOptions& options) {
+    if (options.batchInputFiles.empty()) {
+        std::cerr << "Error: Please specify input files for batch conversion" << std::endl;
+        return 1;
+    }
+    
+    MeshFormat targetFormat = stringToFormat(options.targetFormat);
+    if (targetFormat == MeshFormat::UNKNOWN) {
+        std::cerr << "Error: Batch conversion requires a supported --target-format" << std::endl;
+        return 1;
+    }
+    
+    if (options.pipeline) {
+        return runPipelinedBatch(options, targetFormat);
+    }
+    
+    BatchConvertOptions batchOptions;
+    batchOptions.maxConcurrency = options.jobs;
+    batchOptions.memoryBudget = options.memoryBudgetMB * 1024 * 1024;
+    batchOptions.incremental = options.incremental;
+    
+    if (options.verbose) {
+        std::cout << "Batch output directory: " << options.batchOutputDir << std::endl;
+        std::cout << "Input files: " << options.batchInputFiles.size() << std::endl;
+        std::cout << "Worker threads: " << TaskPool::shared().threadCount() << std::endl;
+        std::cout << "Concurrency cap: " << (options.jobs ? std::to_string(options.jobs) : "none") << std::endl;
+        std::cout << "Memory budget: " << (options.memoryBudgetMB ? std::to_string(options.memoryBudgetMB) + " MB" : "none") << std::endl;
+    }
+    
+    FormatWriteOptions writeOptions;
+    writeOptions.formatThreads = options.formatThreads;
+    writeOptions.reorder = options.reorder;
+    writeOptions.compress = options.compress;
+    writeOptions.vtkCompressor = options.vtkCompressor;
+    writeOptions.vtkBlockSize = options.vtkBlockSize;
+    std::unordered_map<std::string, std::pair<MeshErrorCode, std::string>> errorMap;
+    BatchConvertReport report;
+    MeshConverter::batchConvert(options.batchInputFiles, options.batchOutputDir,
+                                targetFormat, writeOptions, errorMap, batchOptions, &report);
+    
+    for (const auto& [filePath, error] : errorMap) {
+        std::cerr << "Conversion failed: " << filePath << ": " << error.second
+                  << " (Error code: " << static_cast<int>(error.first) << ")" << std::endl;
+    }
+    std::cout << "Converted " << report.converted << ", skipped " << report.skipped << ", failed " << report.failed
+              << " of " << options.batchInputFiles.size() << " files" << std::endl;
+    return errorMap.empty() ? 0 : 1;
+}
+
 int main(int argc, char* argv[]) {
     CommandLineOptions options;
     
@@ -184,6 +445,12 @@ int main(int argc, char* argv[]) {
         return 0;
     }
     
+    ProfileSession profileSession(options);
+    
+    if (!options.batchOutputDir.empty()) {
+        return runBatch(options);
+    }
+    
     if (options.inputFile.empty() || options.outputFile.empty()) {
         std::cerr << "Error: Please specify input and output files" << std::endl;
         printHelp();
@@ -262,12 +529,31 @@ int main(int argc, char* argv[]) {
         std::cout << "  - Mesh decimation: " << (options.processingOptions.enableDecimation ? "Enabled (" + std::to_string(options.processingOptions.decimationTarget) + ")" : "Disabled") << std::endl;
         std::cout << "  - Mesh smoothing: " << (options.processingOptions.enableSmoothing ? "Enabled (" + std::to_string(options.processingOptions.smoothingIterations) + " iterations)" : "Disabled") << std::endl;
         std::cout << "  - Normal computation: " << (options.processingOptions.enableNormalComputation ? "Enabled" : "Disabled") << std::endl;
+        std::cout << "  - Reordering: " << (options.reorder == MeshReorder::HILBERT ? "Hilbert" : options.reorder == MeshReorder::MORTON ? "Morton" : "Disabled") << std::endl;
     }
     
     FormatWriteOptions writeOptions;
+    writeOptions.formatThreads = options.formatThreads;
+    writeOptions.reorder = options.reorder;
+    writeOptions.compress = options.compress;
+    writeOptions.vtkCompressor = options.vtkCompressor;
+    writeOptions.vtkBlockSize = options.vtkBlockSize;
     MeshErrorCode errorCode;
     std::string errorMsg;
     
+    if (options.stream) {
+        if (options.verbose) {
+            std::cout << "Streaming conversion: VTK processing and reordering options are not applied" << std::endl;
+        }
+        if (!MeshConverter::convertStreaming(options.inputFile, options.outputFile, sourceFormat, targetFormat,
+                                             writeOptions, MeshStreamOptions(), errorCode, errorMsg)) {
+            std::cerr << "Conversion failed: " << errorMsg << " (Error code: " << static_cast<int>(errorCode) << ")" << std::endl;
+            return 1;
+        }
+        std::cout << "Conversion successful!" << std::endl;
+        return 0;
+    }
+    
     bool success = VTKConverter::convert(
         options.inputFile,
         options.outputFile,
@@ -60,6 +60,21 @@ std::string cellTypeToString(VtkCellType type) {
     }
 }
 
+/**
+ * @brief Convert AttributeType to string
+ * @param type Attribute element type
+ * @return String representation
+ */
+std::string attributeTypeToString(AttributeType type) {
+    switch (type) {
+        case AttributeType::INT32: return "int32";
+        case AttributeType::INT64: return "int64";
+        case AttributeType::FLOAT32: return "float";
+        case AttributeType::FLOAT64: return "double";
+        default: return "Unknown";
+    }
+}
+
 /**
  * @brief Convert MeshErrorCode to string
  * @param code Error code
@@ -76,6 +91,7 @@ std::string errorCodeToString(MeshErrorCode code) {
         case MeshErrorCode::PARAM_INVALID: return "Parameter invalid";
         case MeshErrorCode::DEPENDENCY_MISSING: return "Dependency missing";
         case MeshErrorCode::FORMAT_VERSION_INVALID: return "Format version invalid";
+        case MeshErrorCode::CANCELLED: return "Cancelled";
         default: return "Unknown error";
     }
 }
@@ -129,21 +145,23 @@ int main(int argc, char* argv[]) {
         if (!meshData.pointData.empty()) {
             std::cout << "\nPoint attributes:" << std::endl;
             for (const auto& [name, data] : meshData.pointData) {
-                std::cout << "  - " << name << " (" << data.size() / meshData.metadata.pointCount << " components)" << std::endl;
+                std::cout << "  - " << name << " (" << data.componentsFor(meshData.metadata.pointCount) << " components, "
+                          << attributeTypeToString(data.type()) << ")" << std::endl;
             }
         }
         
         if (!meshData.cellData.empty()) {
             std::cout << "\nCell attributes:" << std::endl;
             for (const auto& [name, data] : meshData.cellData) {
-                std::cout << "  - " << name << " (" << data.size() / meshData.metadata.cellCount << " components)" << std::endl;
+                std::cout << "  - " << name << " (" << data.componentsFor(meshData.metadata.cellCount) << " components, "
+                          << attributeTypeToString(data.type()) << ")" << std::endl;
                 
                 // Verify temperature and pressure attributes specifically
                 if (name == "temperature" || name == "pressure") {
                     std::cout << "    Values: ";
                     size_t valuesToShow = std::min(static_cast<size_t>(5), data.size());
                     for (size_t i = 0; i < valuesToShow; ++i) {
-                        std::cout << data[i];
+                        std::cout << data.value(i);
                         if (i < valuesToShow - 1) {
                             std::cout << ", ";
                         }
@@ -154,10 +172,10 @@ int main(int argc, char* argv[]) {
                     std::cout << std::endl;
                     
                     // Calculate number of components
-                    int numComponents = data.size() / meshData.metadata.cellCount;
+                    int numComponents = data.components();
                     
                     // Verify data type and format
-                    std::cout << "    Data type: float" << std::endl;
+                    std::cout << "    Data type: " << attributeTypeToString(data.type()) << std::endl;
                     std::cout << "    Total values: " << data.size() << std::endl;
                     std::cout << "    Components per cell: " << numComponents << std::endl;
                     std::cout << "    Expected values: " << meshData.metadata.cellCount * numComponents << std::endl;
@@ -0,0 +1,218 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "JobControl.h"
+#include "MeshTypes.h"
+#include "TaskPool.h"
+#include "VTKConverter.h"
+
+/**
+ * @brief Outcome of an asynchronous job
+ */
+struct JobResult {
+    bool success = false;                              // Whether the job succeeded
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;  // Error code (CANCELLED when cancel() stopped the job)
+    std::string errorMsg;                              // Error message (UTF-8)
+};
+
+/**
+ * @brief Outcome of an asynchronous read
+ */
+template<typename MeshT>
+struct MeshReadResult : JobResult {
+    MeshT mesh;                                        // Mesh read (empty unless success)
+};
+
+/**
+ * @brief Scheduling options of an asynchronous job
+ */
+struct AsyncOptions {
+    TaskPool* pool = nullptr;                          // Pool running the job (nullptr = TaskPool::shared())
+    std::shared_ptr<TaskPool::TaskGroup> group;        // Optional admission group (e.g. one import at a time)
+};
+
+/**
+ * @brief Handle of an asynchronous job: result future, progress and cancellation
+ * Copies share the job. Dropping every handle neither waits for nor cancels the job.
+ */
+template<typename Result>
+class JobHandle {
+public:
+    JobHandle() = default;
+
+    bool valid() const { return control_ != nullptr; }                                 // Whether the handle refers to a job
+    const std::shared_future<Result>& future() const { return future_; }               // Future of the result
+    const Result& get() const { return future_.get(); }                                // Block until the result is available
+    double progress() const { return control_ ? control_->progress() : 0.0; }          // Completed fraction in [0, 1]
+    void cancel() const { if (control_) control_->cancel(); }                          // Stop the job at its next chunk boundary
+    bool isCancelled() const { return control_ && control_->isCancelled(); }           // Whether cancel() was called
+
+    /**
+     * @brief Whether the result is available (never blocks)
+     */
+    bool isReady() const {
+        return future_.valid() && future_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+private:
+    friend class AsyncConverter;
+
+    JobHandle(std::shared_ptr<JobControl> control, std::shared_future<Result> future)
+        : control_(std::move(control)), future_(std::move(future)) {}
+
+    std::shared_ptr<JobControl> control_;
+    std::shared_future<Result> future_;
+};
+
+/**
+ * @brief Non-blocking counterparts of the MeshReader, MeshWriter, MeshConverter and VTKConverter
+ * entry points
+ *
+ * Every call queues one task on the shared work-stealing pool (the input size is its memory cost)
+ * and returns at once. The task runs the blocking entry point with a JobControl bound, so the
+ * reader and writer loops report fractional progress and stop at their next chunk boundary once
+ * the job is cancelled; a cancelled job completes with MeshErrorCode::CANCELLED and removes its
+ * partial output. Formats parsed or written entirely by VTK or CGNS library calls report progress
+ * at stage boundaries (and through VTK progress events where the library sends them).
+ *
+ * Completion callbacks run on the pool worker right after the future becomes ready; they must be
+ * quick and must not block on other jobs (post to the GUI thread instead). Jobs must not call
+ * MeshConverter::batchConvert(), which waits on the pool.
+ */
+class AsyncConverter {
+public:
+    template<typename Result>
+    using Callback = std::function<void(const Result&)>;
+
+    /**
+     * @brief Queue arbitrary work as a job (e.g. a cached read or a custom pipeline)
+     * Call as AsyncConverter::submit<MyResult>(...). Library calls made by the work report to the job.
+     * @param work Fills in the result (Result derives from JobResult); exceptions become errors
+     * @param memoryCost Estimated peak memory in bytes (pool admission and ordering)
+     * @param onComplete Called with the result after success, failure and cancellation (optional)
+     * @param options Pool and admission group
+     * @return Job handle
+     */
+    template<typename Result>
+    static JobHandle<Result> submit(std::function<void(Result&)> work,
+                                    uint64_t memoryCost = 0,
+                                    Callback<Result> onComplete = nullptr,
+                                    const AsyncOptions& options = AsyncOptions());
+
+    /**
+     * @brief Read a mesh file (MeshReader::readAuto) in the background
+     * @param filePath File path (UTF-8)
+     * @param readOptions Read options
+     * @param onComplete Completion callback (optional)
+     * @param options Pool and admission group
+     * @return Job handle; the result holds the mesh (MeshData or MeshData64)
+     */
+    template<typename MeshT>
+    static JobHandle<MeshReadResult<MeshT>> read(const std::string& filePath,
+                                                 const FormatReadOptions& readOptions = FormatReadOptions(),
+                                                 Callback<MeshReadResult<MeshT>> onComplete = nullptr,
+                                                 const AsyncOptions& options = AsyncOptions());
+
+    /**
+     * @brief Write a mesh (MeshWriter::write) in the background
+     * @param meshData Mesh to write (kept alive by the job)
+     * @param filePath Output file path (UTF-8)
+     * @param targetFormat Target format
+     * @param writeOptions Write options
+     * @param onComplete Completion callback (optional)
+     * @param options Pool and admission group
+     * @return Job handle
+     */
+    static JobHandle<JobResult> write(std::shared_ptr<const MeshData> meshData,
+                                      const std::string& filePath,
+                                      MeshFormat targetFormat,
+                                      const FormatWriteOptions& writeOptions = FormatWriteOptions(),
+                                      Callback<JobResult> onComplete = nullptr,
+                                      const AsyncOptions& options = AsyncOptions());
+
+    /**
+     * @brief Convert a file (MeshConverter::convert) in the background
+     * @param srcFilePath Source file path (UTF-8)
+     * @param dstFilePath Target file path (UTF-8)
+     * @param srcFormat Source format (MeshFormat::UNKNOWN = auto detect)
+     * @param dstFormat Target format
+     * @param writeOptions Target format write options
+     * @param onComplete Completion callback (optional)
+     * @param options Pool and admission group
+     * @return Job handle
+     */
+    static JobHandle<JobResult> convert(const std::string& srcFilePath,
+                                        const std::string& dstFilePath,
+                                        MeshFormat srcFormat,
+                                        MeshFormat dstFormat,
+                                        const FormatWriteOptions& writeOptions = FormatWriteOptions(),
+                                        Callback<JobResult> onComplete = nullptr,
+                                        const AsyncOptions& options = AsyncOptions());
+
+    /**
+     * @brief Convert a file through VTK processing (VTKConverter::convert) in the background
+     * @param srcFilePath Source file path (UTF-8)
+     * @param dstFilePath Target file path (UTF-8)
+     * @param srcFormat Source format
+     * @param dstFormat Target format
+     * @param processingOptions VTK processing options
+     * @param writeOptions Target format write options
+     * @param onComplete Completion callback (optional)
+     * @param options Pool and admission group
+     * @return Job handle
+     */
+    static JobHandle<JobResult> convertVTK(const std::string& srcFilePath,
+                                           const std::string& dstFilePath,
+                                           MeshFormat srcFormat,
+                                           MeshFormat dstFormat,
+                                           const VTKConverter::VTKProcessingOptions& processingOptions,
+                                           const FormatWriteOptions& writeOptions = FormatWriteOptions(),
+                                           Callback<JobResult> onComplete = nullptr,
+                                           const AsyncOptions& options = AsyncOptions());
+
+private:
+    /**
+     * @brief Run the work of a job with the job bound to the calling thread and settle its outcome
+     * @param job Job state
+     * @param[in,out] result Result filled in by the work
+     * @param work Work to run (skipped when the job was cancelled while queued)
+     */
+    static void runJob(JobControl& job, JobResult& result, const std::function<void()>& work);
+};
+
+/**
+ * @brief Queue arbitrary work as a job
+ * @param work Fills in the result
+ * @param memoryCost Estimated peak memory in bytes
+ * @param onComplete Completion callback (optional)
+ * @param options Pool and admission group
+ * @return Job handle
+ */
+template<typename Result>
+JobHandle<Result> AsyncConverter::submit(std::function<void(Result&)> work,
+                                         uint64_t memoryCost,
+                                         Callback<Result> onComplete,
+                                         const AsyncOptions& options) {
+    static_assert(std::is_base_of<JobResult, Result>::value, "Job results must derive from JobResult");
+    auto control = std::make_shared<JobControl>();
+    auto promise = std::make_shared<std::promise<Result>>();
+    std::shared_future<Result> future = promise->get_future().share();
+
+    TaskPool& pool = options.pool ? *options.pool : TaskPool::shared();
+    pool.submit([control, promise, future, work = std::move(work), onComplete = std::move(onComplete)]() {
+        Result result;
+        runJob(*control, result, [&work, &result]() { work(result); });
+        promise->set_value(std::move(result));
+        if (onComplete) {
+            onComplete(future.get());
+        }
+    }, memoryCost, options.group);
+    return JobHandle<Result>(std::move(control), std::move(future));
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include "MeshTypes.h"
+
+/**
+ * @brief Local faces of a 3D cell type (VTK corner order, outward-facing winding)
+ */
+struct CellFaceTable {
+    uint8_t pointCount;      // Points of the cell
+    uint8_t faceCount;       // Faces of the cell
+    uint8_t faceSize[6];     // Corners of each face (3 or 4)
+    uint8_t corners[6][4];   // Cell-local corner indices of each face
+};
+
+inline constexpr CellFaceTable TETRA_FACES = {4, 4, {3, 3, 3, 3},
+    {{0, 1, 3}, {1, 2, 3}, {2, 0, 3}, {0, 2, 1}}};
+inline constexpr CellFaceTable HEXAHEDRON_FACES = {8, 6, {4, 4, 4, 4, 4, 4},
+    {{0, 4, 7, 3}, {1, 2, 6, 5}, {0, 1, 5, 4}, {3, 7, 6, 2}, {0, 3, 2, 1}, {4, 5, 6, 7}}};
+inline constexpr CellFaceTable WEDGE_FACES = {6, 5, {3, 3, 4, 4, 4},
+    {{0, 1, 2}, {3, 5, 4}, {0, 3, 4, 1}, {1, 4, 5, 2}, {2, 5, 3, 0}}};
+inline constexpr CellFaceTable PYRAMID_FACES = {5, 5, {4, 3, 3, 3, 3},
+    {{0, 3, 2, 1}, {0, 1, 4}, {1, 2, 4}, {2, 3, 4}, {3, 0, 4}}};
+
+/**
+ * @brief Get the face table of a cell type
+ * @param type Cell type
+ * @return Face table, nullptr for cells that are not 3D (they have no faces to enumerate)
+ */
+inline const CellFaceTable* cellFaceTable(VtkCellType type) {
+    switch (type) {
+        case VtkCellType::TETRA: return &TETRA_FACES;
+        case VtkCellType::HEXAHEDRON: return &HEXAHEDRON_FACES;
+        case VtkCellType::WEDGE: return &WEDGE_FACES;
+        case VtkCellType::PYRAMID: return &PYRAMID_FACES;
+        default: return nullptr;
+    }
+}
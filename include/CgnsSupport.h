@@ -0,0 +1,162 @@
+#pragma once
+
+#ifdef HAVE_CGNS
+
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include "MeshTypes.h"
+#include "cgnslib.h"
+
+/**
+ * @brief Description of a CGNS element type
+ */
+struct CgnsElementInfo {
+    VtkCellType cellType = VtkCellType::VERTEX; // Linear VTK cell built from the corner nodes
+    int cornerCount = 0;                        // Leading corner nodes kept in the VTK cell (0 = unsupported type)
+    int dimension = 0;                          // Topological dimension (0..3)
+};
+
+/**
+ * @brief Look up a fixed-size CGNS element type
+ * Higher-order elements map to their linear VTK cell: CGNS lists the corner nodes first.
+ * @param type CGNS element type
+ * @return Element description (cornerCount == 0 for MIXED, NGON_n, NFACE_n and unknown types)
+ */
+inline CgnsElementInfo cgnsElementInfo(ElementType_t type) {
+    switch (type) {
+        case NODE:
+            return {VtkCellType::VERTEX, 1, 0};
+        case BAR_2: case BAR_3: case BAR_4:
+            return {VtkCellType::LINE, 2, 1};
+        case TRI_3: case TRI_6: case TRI_9: case TRI_10:
+            return {VtkCellType::TRIANGLE, 3, 2};
+        case QUAD_4: case QUAD_8: case QUAD_9: case QUAD_12: case QUAD_16:
+            return {VtkCellType::QUAD, 4, 2};
+        case TETRA_4: case TETRA_10: case TETRA_16: case TETRA_20:
+            return {VtkCellType::TETRA, 4, 3};
+        case PYRA_5: case PYRA_13: case PYRA_14: case PYRA_21: case PYRA_29: case PYRA_30:
+            return {VtkCellType::PYRAMID, 5, 3};
+        case PENTA_6: case PENTA_15: case PENTA_18: case PENTA_24: case PENTA_38: case PENTA_40:
+            return {VtkCellType::WEDGE, 6, 3};
+        case HEXA_8: case HEXA_20: case HEXA_27: case HEXA_32: case HEXA_56: case HEXA_64:
+            return {VtkCellType::HEXAHEDRON, 8, 3};
+        default:
+            return {};
+    }
+}
+
+/**
+ * @brief CGNS element type of a linear VTK cell
+ * @param cellType VTK cell type
+ * @return CGNS element type (NGON_n for polygons, ElementTypeNull for triangle strips)
+ */
+inline ElementType_t cgnsElementType(VtkCellType cellType) {
+    switch (cellType) {
+        case VtkCellType::VERTEX: return NODE;
+        case VtkCellType::LINE: return BAR_2;
+        case VtkCellType::TRIANGLE: return TRI_3;
+        case VtkCellType::QUAD: return QUAD_4;
+        case VtkCellType::TETRA: return TETRA_4;
+        case VtkCellType::HEXAHEDRON: return HEXA_8;
+        case VtkCellType::WEDGE: return PENTA_6;
+        case VtkCellType::PYRAMID: return PYRA_5;
+        case VtkCellType::POLYGON: return NGON_n;
+        default: return ElementTypeNull;
+    }
+}
+
+/**
+ * @brief Map a CGNS data type to an attribute element type
+ * @param dataType CGNS data type
+ * @param[out] type Attribute element type
+ * @return Whether the data type is numeric
+ */
+inline bool cgnsAttributeType(DataType_t dataType, AttributeType& type) {
+    switch (dataType) {
+        case Integer: type = AttributeType::INT32; return true;
+        case LongInteger: type = AttributeType::INT64; return true;
+        case RealSingle: type = AttributeType::FLOAT32; return true;
+        case RealDouble: type = AttributeType::FLOAT64; return true;
+        default: return false;
+    }
+}
+
+/**
+ * @brief CGNS data type of an attribute element type
+ * @param type Attribute element type
+ * @return CGNS data type
+ */
+inline DataType_t cgnsDataType(AttributeType type) {
+    switch (type) {
+        case AttributeType::INT32: return Integer;
+        case AttributeType::INT64: return LongInteger;
+        case AttributeType::FLOAT32: return RealSingle;
+        default: return RealDouble;
+    }
+}
+
+/**
+ * @brief Lock guarding every call into the CGNS library
+ * The mid-level library keeps its open files, error message and configuration in globals, so
+ * calls from different threads (and different readers/writers) must not overlap. Zones are
+ * converted outside the lock. The lock is recursive so CgnsFile can be used while it is held.
+ * @return Process-wide CGNS library mutex
+ */
+inline std::recursive_mutex& cgnsLibraryMutex() {
+    static std::recursive_mutex mutex;
+    return mutex;
+}
+
+/**
+ * @brief Throw the current CGNS library error if a call failed (caller holds the library lock)
+ * @param status Return value of the CGNS call
+ * @param action Description of the failed action
+ */
+inline void cgnsCheck(int status, const char* action) {
+    if (status != CG_OK) {
+        throw std::runtime_error(std::string(action) + ": " + cg_get_error());
+    }
+}
+
+/**
+ * @brief Open CGNS file, closed on destruction (takes the library lock itself)
+ */
+class CgnsFile {
+public:
+    /**
+     * @brief Open a CGNS file
+     * @param filePath File path (UTF-8 encoded)
+     * @param mode CG_MODE_READ or CG_MODE_WRITE
+     */
+    CgnsFile(const std::string& filePath, int mode) {
+        std::lock_guard<std::recursive_mutex> lock(cgnsLibraryMutex());
+        cgnsCheck(cg_open(filePath.c_str(), mode, &file_), "Failed to open CGNS file");
+    }
+
+    ~CgnsFile() {
+        if (file_ >= 0) {
+            std::lock_guard<std::recursive_mutex> lock(cgnsLibraryMutex());
+            cg_close(file_);
+        }
+    }
+
+    CgnsFile(const CgnsFile&) = delete;
+    CgnsFile& operator=(const CgnsFile&) = delete;
+
+    /**
+     * @brief Close the file and report errors of the final flush (caller holds the library lock)
+     */
+    void close() {
+        const int file = file_;
+        file_ = -1;
+        cgnsCheck(cg_close(file), "Failed to close CGNS file");
+    }
+
+    int id() const { return file_; }
+
+private:
+    int file_ = -1;
+};
+
+#endif
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "MeshTypes.h"
+
+/**
+ * @brief Record of previous batch conversions, used to skip unchanged files (incremental batches)
+ *
+ * For every source the manifest keeps a content hash, the size and modification time it was
+ * hashed at, a fingerprint of the conversion settings and the output path and size. A file is
+ * up to date when the settings and output path match, the output still exists with its recorded
+ * size and the source content is unchanged. Size and modification time are checked first: the
+ * source is only hashed again when one of them moved, so an unchanged tree costs one stat per
+ * file. Directory outputs (OpenFOAM cases) are measured over their whole tree. The manifest is
+ * a small text file, rewritten atomically by save().
+ *
+ * lookup/record/forget may be called from concurrent conversion tasks.
+ */
+class ConversionManifest {
+public:
+    /**
+     * @brief What the manifest knows about one source
+     */
+    struct Entry {
+        std::string dstFilePath;     // Output written for the source (UTF-8)
+        uint64_t srcSize = 0;        // Source size in bytes when hashed
+        int64_t srcModified = 0;     // Source modification time when hashed (file clock ticks)
+        uint64_t contentHash = 0;    // Content hash of the source (hashFile)
+        uint64_t settingsHash = 0;   // Fingerprint of the conversion settings
+        uint64_t dstSize = 0;        // Output size in bytes after the conversion (whole tree for directories)
+    };
+
+    /**
+     * @brief Default manifest of a target directory: <dstDir>/.meshconv-manifest
+     * @param dstDir Target directory (UTF-8)
+     * @return Manifest path
+     */
+    static std::string defaultPath(const std::string& dstDir);
+
+    /**
+     * @brief Load a manifest (a missing file is an empty manifest; malformed lines are dropped)
+     * @param manifestPath Manifest path (UTF-8)
+     */
+    void load(const std::string& manifestPath);
+
+    /**
+     * @brief Write the manifest back to the path it was loaded from (temporary file + rename)
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @return Whether saving is successful
+     */
+    bool save(std::string& errorMsg) const;
+
+    /**
+     * @brief Check whether a source still converts to its recorded output
+     * @param srcFilePath Source file path (UTF-8)
+     * @param dstFilePath Output file path the conversion would write (UTF-8)
+     * @param settingsHash Fingerprint of the conversion settings (settingsHash)
+     * @param[out] current Current identity of the source (contentHash 0 if it could not be read);
+     *                     pass it to record() once the conversion succeeded
+     * @param threads Hashing threads (0 = hardware concurrency)
+     * @return Whether the conversion can be skipped
+     */
+    bool lookup(const std::string& srcFilePath,
+                const std::string& dstFilePath,
+                uint64_t settingsHash,
+                Entry& current,
+                unsigned int threads = 1);
+
+    /**
+     * @brief Record a successful conversion (the output size is taken from the file)
+     * @param srcFilePath Source file path (UTF-8)
+     * @param entry Source identity from lookup()
+     */
+    void record(const std::string& srcFilePath, Entry entry);
+
+    /**
+     * @brief Drop the record of a source (failed conversion: retried by the next run)
+     * @param srcFilePath Source file path (UTF-8)
+     */
+    void forget(const std::string& srcFilePath);
+
+    /**
+     * @brief Fingerprint of the settings every conversion of a batch shares
+     * @param dstFormat Target format
+     * @param writeOptions Target format write options
+     * @param readOptions Source read options
+     * @param extraSettings Fingerprint of further settings (e.g. processing options, 0 = none)
+     * @return Settings hash
+     */
+    static uint64_t settingsHash(MeshFormat dstFormat,
+                                 const FormatWriteOptions& writeOptions,
+                                 const FormatReadOptions& readOptions = FormatReadOptions(),
+                                 uint64_t extraSettings = 0);
+
+    /**
+     * @brief 64-bit XXH64 hash of a byte range
+     * @param data First byte
+     * @param size Byte count
+     * @param seed Hash seed
+     * @return Hash value
+     */
+    static uint64_t hashBytes(const void* data, size_t size, uint64_t seed = 0);
+
+    /**
+     * @brief Content hash of a file: XXH64 of 16 MiB chunks (hashed in parallel over a mapping),
+     *        combined with XXH64 over the chunk hashes
+     * @param filePath File path (UTF-8)
+     * @param[out] hash Content hash
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @param threads Hashing threads (0 = hardware concurrency)
+     * @return Whether hashing is successful
+     */
+    static bool hashFile(const std::string& filePath, uint64_t& hash, std::string& errorMsg, unsigned int threads = 0);
+
+    size_t size() const { return entries_.size(); }  // Number of recorded sources
+
+private:
+    std::string path_;                                // Manifest file
+    std::unordered_map<std::string, Entry> entries_;  // Key = absolute source path
+    mutable std::mutex mutex_;                        // Guards entries_
+};
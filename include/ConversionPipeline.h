@@ -0,0 +1,101 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include "MeshTypes.h"
+#include "MeshException.h"
+#include "VTKConverter.h"
+
+/**
+ * @brief Staged batch conversion options
+ */
+struct PipelineOptions {
+    size_t readThreads = 1;              // Reader stage threads (disk + parsing)
+    size_t processThreads = 0;           // Processing stage threads (0 = hardware concurrency minus the I/O stages, at least 1)
+    size_t writeThreads = 1;             // Writer stage threads
+    size_t queueCapacity = 2;            // Meshes buffered between two stages; a full queue stalls the stage before it
+    FormatReadOptions readOptions;       // Options passed to the reader stage
+    bool incremental = false;            // Skip files whose content, settings and output are unchanged since the last run
+    std::string manifestPath;            // Manifest of an incremental batch (empty = ConversionManifest::defaultPath(dstDir))
+};
+
+/**
+ * @brief Time accounting of one pipeline stage (seconds summed over the stage threads)
+ */
+struct PipelineStageStats {
+    std::string name;                    // Stage name ("read", "process", "write")
+    size_t threads = 0;                  // Threads running the stage
+    uint64_t items = 0;                  // Files that completed the stage
+    uint64_t failures = 0;               // Files that failed in the stage
+    double busySeconds = 0.0;            // Time spent doing stage work
+    double inputWaitSeconds = 0.0;       // Time blocked on an empty input queue (stage starved)
+    double outputWaitSeconds = 0.0;      // Time blocked on a full output queue (backpressure)
+
+    /**
+     * @brief Fraction of the stage's thread time spent working
+     * @param wallSeconds Wall time of the whole pipeline
+     * @return Utilization in [0, 1]
+     */
+    double utilization(double wallSeconds) const {
+        const double capacity = wallSeconds * static_cast<double>(threads);
+        return capacity > 0.0 ? busySeconds / capacity : 0.0;
+    }
+};
+
+/**
+ * @brief Per-stage utilization report of a pipelined batch
+ */
+struct PipelineReport {
+    double wallSeconds = 0.0;            // Wall time of the whole batch
+    uint64_t skipped = 0;                // Files skipped as up to date (incremental)
+    PipelineStageStats read;             // Reader stage
+    PipelineStageStats process;          // Processing stage
+    PipelineStageStats write;            // Writer stage
+
+    /**
+     * @brief Get the stage limiting the batch (highest utilization)
+     * @return Bottleneck stage
+     */
+    const PipelineStageStats& bottleneck() const;
+
+    /**
+     * @brief Format the report as a small table
+     * @return Multi-line report text
+     */
+    std::string toString() const;
+};
+
+/**
+ * @brief Pipelined batch conversion: read → process → write
+ * Each stage runs on its own threads and hands meshes to the next stage through a bounded
+ * queue, so reading and writing of some files overlaps with the VTK processing of others.
+ */
+class ConversionPipeline {
+public:
+    /**
+     * @brief Batch convert multiple files through the staged pipeline
+     * Files are read largest first. The processing stage runs VTKConverter::processVTKData and
+     * the writer stage VTKConverter::convertFromVTK. With pipelineOptions.incremental the reader
+     * stage skips files the ConversionManifest reports as up to date (processing options are part
+     * of the settings fingerprint).
+     * @param srcFilePaths Source file path list (UTF-8)
+     * @param dstDir Target directory (UTF-8)
+     * @param dstFormat Target format
+     * @param processingOptions VTK processing options applied to every mesh
+     * @param writeOptions Target format write options
+     * @param pipelineOptions Stage threads and queue capacity
+     * @param[out] errorMap Output error information for each file (key=source file path, value=(errorCode, errorMsg))
+     * @param[out] report Output per-stage utilization
+     * @return Number of files whose output is up to date (converted or skipped)
+     */
+    static uint64_t batchConvert(const std::vector<std::string>& srcFilePaths,
+                                 const std::string& dstDir,
+                                 MeshFormat dstFormat,
+                                 const VTKConverter::VTKProcessingOptions& processingOptions,
+                                 const FormatWriteOptions& writeOptions,
+                                 const PipelineOptions& pipelineOptions,
+                                 std::unordered_map<std::string, std::pair<MeshErrorCode, std::string>>& errorMap,
+                                 PipelineReport& report);
+};
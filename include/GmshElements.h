@@ -0,0 +1,75 @@
+#pragma once
+
+#include "MeshTypes.h"
+
+/**
+ * @brief Description of a Gmsh element type (MSH 2.2/4.1 numbering)
+ */
+struct GmshElementInfo {
+    VtkCellType cellType = VtkCellType::VERTEX; // Linear VTK cell built from the corner nodes
+    int nodeCount = 0;                          // Nodes stored per element (0 = unknown type)
+    int cornerCount = 0;                        // Leading corner nodes kept in the VTK cell
+    int dimension = 0;                          // Topological dimension (0..3)
+};
+
+/**
+ * @brief Look up a Gmsh element type
+ * Higher-order elements map to their linear VTK cell: Gmsh lists the corner nodes first.
+ * @param gmshType Gmsh element type number
+ * @return Element description (nodeCount == 0 for unknown types)
+ */
+inline GmshElementInfo gmshElementInfo(int gmshType) {
+    switch (gmshType) {
+        case 15: return {VtkCellType::VERTEX, 1, 1, 0};
+        case 1:  return {VtkCellType::LINE, 2, 2, 1};
+        case 8:  return {VtkCellType::LINE, 3, 2, 1};
+        case 26: return {VtkCellType::LINE, 4, 2, 1};
+        case 27: return {VtkCellType::LINE, 5, 2, 1};
+        case 28: return {VtkCellType::LINE, 6, 2, 1};
+        case 2:  return {VtkCellType::TRIANGLE, 3, 3, 2};
+        case 9:  return {VtkCellType::TRIANGLE, 6, 3, 2};
+        case 20: return {VtkCellType::TRIANGLE, 9, 3, 2};
+        case 21: return {VtkCellType::TRIANGLE, 10, 3, 2};
+        case 22: return {VtkCellType::TRIANGLE, 12, 3, 2};
+        case 23: return {VtkCellType::TRIANGLE, 15, 3, 2};
+        case 24: return {VtkCellType::TRIANGLE, 15, 3, 2};
+        case 25: return {VtkCellType::TRIANGLE, 21, 3, 2};
+        case 3:  return {VtkCellType::QUAD, 4, 4, 2};
+        case 10: return {VtkCellType::QUAD, 9, 4, 2};
+        case 16: return {VtkCellType::QUAD, 8, 4, 2};
+        case 4:  return {VtkCellType::TETRA, 4, 4, 3};
+        case 11: return {VtkCellType::TETRA, 10, 4, 3};
+        case 29: return {VtkCellType::TETRA, 20, 4, 3};
+        case 30: return {VtkCellType::TETRA, 35, 4, 3};
+        case 31: return {VtkCellType::TETRA, 56, 4, 3};
+        case 5:  return {VtkCellType::HEXAHEDRON, 8, 8, 3};
+        case 12: return {VtkCellType::HEXAHEDRON, 27, 8, 3};
+        case 17: return {VtkCellType::HEXAHEDRON, 20, 8, 3};
+        case 6:  return {VtkCellType::WEDGE, 6, 6, 3};
+        case 13: return {VtkCellType::WEDGE, 18, 6, 3};
+        case 18: return {VtkCellType::WEDGE, 15, 6, 3};
+        case 7:  return {VtkCellType::PYRAMID, 5, 5, 3};
+        case 14: return {VtkCellType::PYRAMID, 14, 5, 3};
+        case 19: return {VtkCellType::PYRAMID, 13, 5, 3};
+        default: return {};
+    }
+}
+
+/**
+ * @brief Gmsh element type of a linear VTK cell
+ * @param cellType VTK cell type
+ * @return Gmsh element type number (0 when the cell has no Gmsh equivalent, e.g. polygons)
+ */
+inline int gmshElementType(VtkCellType cellType) {
+    switch (cellType) {
+        case VtkCellType::VERTEX: return 15;
+        case VtkCellType::LINE: return 1;
+        case VtkCellType::TRIANGLE: return 2;
+        case VtkCellType::QUAD: return 3;
+        case VtkCellType::TETRA: return 4;
+        case VtkCellType::HEXAHEDRON: return 5;
+        case VtkCellType::WEDGE: return 6;
+        case VtkCellType::PYRAMID: return 7;
+        default: return 0;
+    }
+}
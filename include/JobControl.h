@@ -0,0 +1,197 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+
+class JobStep;
+
+/**
+ * @brief Thrown at a chunk boundary once the running job has been cancelled
+ * Library code turns it into an error return like any other exception (or lets it reach the job
+ * runner); the job then reports MeshErrorCode::CANCELLED.
+ */
+class JobCancelled : public std::runtime_error {
+public:
+    JobCancelled() : std::runtime_error("Cancelled") {}
+};
+
+/**
+ * @brief Progress and cancellation state of one asynchronous job (see AsyncConverter)
+ *
+ * A job is bound to the thread running it (Binding), and runParallel() hands the binding on to
+ * its worker threads. Reader and writer loops report progress and check for cancellation through
+ * JobStep, ProgressMeter and checkpoint(), which do nothing on threads without a job, so the
+ * blocking entry points behave exactly as before when called directly.
+ */
+class JobControl {
+public:
+    /**
+     * @brief What a thread is working for: the job and its innermost progress step
+     */
+    struct Context {
+        JobControl* job = nullptr;   // Job of the thread (nullptr = none)
+        JobStep* step = nullptr;     // Innermost progress step (nullptr = progress not reported)
+    };
+
+    /**
+     * @brief Binds a context to the calling thread for its lifetime (restores the previous one)
+     */
+    class Binding {
+    public:
+        explicit Binding(const Context& context);
+        ~Binding();
+
+        Binding(const Binding&) = delete;
+        Binding& operator=(const Binding&) = delete;
+
+    private:
+        Context previous_;
+    };
+
+    void cancel() { cancelled_.store(true, std::memory_order_relaxed); }                    // Request cooperative cancellation
+    bool isCancelled() const { return cancelled_.load(std::memory_order_relaxed); }          // Whether cancel() was called
+    double progress() const { return progress_.load(std::memory_order_relaxed); }           // Completed fraction in [0, 1]
+
+    /**
+     * @brief Raise the progress (never lowers it, so reports from parallel workers may race)
+     * @param fraction Completed fraction (clamped to [0, 1])
+     */
+    void raiseProgress(double fraction);
+
+    /**
+     * @brief Context bound to the calling thread (empty outside jobs)
+     * Out of line so the thread-local state stays inside the library (Windows exports functions, not data).
+     */
+    static Context context();
+
+    /**
+     * @brief Chunk boundary: throw JobCancelled if the job of the calling thread was cancelled
+     */
+    static void checkpoint();
+
+private:
+    std::atomic<bool> cancelled_{false};
+    std::atomic<double> progress_{0.0};
+};
+
+/**
+ * @brief Part of the progress scale of a job, measured in work units (bytes parsed, items written, ...)
+ *
+ * A step created inside another step covers [begin, end] of it; work inside the step advances the
+ * job in proportion to the units credited against setUnits(). Leaving the step moves the job to its
+ * end (unless the job was cancelled). On threads without a job, or under a context whose progress
+ * is not reported, the step is inactive and every call returns immediately.
+ */
+class JobStep {
+public:
+    /**
+     * @brief Open a step inside the innermost step of the calling thread and make it the innermost one
+     * @param begin Start of the step as a fraction of the enclosing step
+     * @param end End of the step as a fraction of the enclosing step
+     */
+    JobStep(double begin, double end);
+
+    /**
+     * @brief Root step of a job covering its whole progress scale (not bound to any thread)
+     * @param job Job whose progress the step drives
+     */
+    explicit JobStep(JobControl& job);
+
+    ~JobStep();
+
+    JobStep(const JobStep&) = delete;
+    JobStep& operator=(const JobStep&) = delete;
+
+    bool active() const { return job_ != nullptr; }                                     // Whether progress is reported
+    void setUnits(uint64_t units) { totalUnits_.store(units, std::memory_order_relaxed); } // Work units of the whole step
+
+    /**
+     * @brief Credit completed work units (thread-safe)
+     * @param units Units completed since the last call
+     */
+    void advance(uint64_t units);
+
+    /**
+     * @brief Report the completed fraction directly (e.g. from a VTK progress event)
+     * @param fraction Completed fraction of the step
+     */
+    void setFraction(double fraction);
+
+private:
+    JobControl* job_ = nullptr;        // Job driven by the step (nullptr = inactive)
+    bool bound_ = false;               // Whether the constructor made the step the thread's innermost one
+    JobControl::Context previous_;     // Context restored by the destructor
+    double base_ = 0.0;                // Job progress at the start of the step
+    double span_ = 0.0;                // Share of the job's progress scale covered by the step
+    std::atomic<uint64_t> doneUnits_{0};
+    std::atomic<uint64_t> totalUnits_{0};
+};
+
+/**
+ * @brief Work counter for tight loops: credits units to the innermost step in batches of
+ * flushUnits (the chunk boundary), which is also where a cancelled job stops the loop
+ * Captures the thread's context once, so add() costs a compare on threads without a job.
+ */
+class ProgressMeter {
+public:
+    static constexpr uint64_t DEFAULT_FLUSH_UNITS = 1024 * 1024; // Units per credit (1 MB of text)
+
+    /**
+     * @brief Constructor
+     * @param flushUnits Units accumulated before they are credited and cancellation is checked
+     */
+    explicit ProgressMeter(uint64_t flushUnits = DEFAULT_FLUSH_UNITS)
+        : context_(JobControl::context()), flushUnits_(flushUnits) {}
+
+    ~ProgressMeter() {
+        if (context_.step && pending_) {
+            context_.step->advance(pending_);
+        }
+    }
+
+    ProgressMeter(const ProgressMeter&) = delete;
+    ProgressMeter& operator=(const ProgressMeter&) = delete;
+
+    bool active() const { return context_.job != nullptr; } // Whether the loop runs for a job
+
+    /**
+     * @brief Count completed work; throws JobCancelled at a chunk boundary of a cancelled job
+     * @param units Units completed
+     */
+    void add(uint64_t units) {
+        if (context_.job && (pending_ += units) >= flushUnits_) {
+            flush();
+        }
+    }
+
+    /**
+     * @brief Count completed work given as a running position (e.g. bytes consumed by a tokenizer)
+     * @param position Units completed since the meter was created
+     */
+    void reach(uint64_t position) {
+        if (context_.job) {
+            add(position - reached_);
+            reached_ = position;
+        }
+    }
+
+    /**
+     * @brief Credit the pending units now and check for cancellation
+     */
+    void flush() {
+        if (context_.step) {
+            context_.step->advance(pending_);
+        }
+        pending_ = 0;
+        if (context_.job && context_.job->isCancelled()) {
+            throw JobCancelled();
+        }
+    }
+
+private:
+    const JobControl::Context context_;
+    const uint64_t flushUnits_;
+    uint64_t pending_ = 0;   // Units counted but not yet credited
+    uint64_t reached_ = 0;   // Last position passed to reach()
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+
+/**
+ * @brief Read-only memory-mapped file (mmap on POSIX, MapViewOfFile on Windows)
+ * The mapping is released when the object is destroyed or close() is called.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Map a whole file read-only
+     * @param filePath File path (UTF-8 encoded)
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @return Whether mapping is successful (an empty file maps to size 0)
+     */
+    bool open(const std::string& filePath, std::string& errorMsg);
+
+    /**
+     * @brief Release the mapping
+     */
+    void close();
+
+    /**
+     * @brief Tell the OS that a range will not be read again (streaming readers)
+     * The pages are dropped from the resident set; reading them later faults them back in.
+     * @param offset First byte of the range
+     * @param length Length of the range in bytes
+     */
+    void discard(size_t offset, size_t length);
+
+    bool isOpen() const { return opened_; }     // Whether a file is mapped
+    const char* data() const { return data_; }  // First byte of the mapping (nullptr for empty files)
+    size_t size() const { return size_; }       // Mapped size in bytes
+
+private:
+    const char* data_ = nullptr;  // Mapped view
+    size_t size_ = 0;             // File size in bytes
+    bool opened_ = false;         // Whether open() succeeded
+#ifdef _WIN32
+    void* fileHandle_ = nullptr;    // HANDLE of the file
+    void* mappingHandle_ = nullptr; // HANDLE of the file mapping
+#endif
+};
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "MeshTypes.h"
+#include "MeshException.h"
+
+/**
+ * @brief Native binary mesh cache (.mcb)
+ *
+ * The file is a fixed header, a table of contents and one 64-byte aligned section per array
+ * (points, cell types, cell offsets, connectivity, every point/cell attribute, metadata).
+ * Arrays are stored in their in-memory layout (little-endian, MeshData or MeshData64 widths,
+ * attributes in their native element type), so loading maps the file and copies each section
+ * straight into its vector: there is no parse step. Sections may be LZ4-compressed in
+ * independent 4 MiB blocks (FormatWriteOptions::compress); blocks are compressed and
+ * decompressed in parallel.
+ *
+ * The header also records the source file (size and modification time) and a fingerprint of
+ * the read options, which lets the file serve as a parse cache for the source it came from.
+ */
+class MeshCache {
+public:
+    /**
+     * @brief Identity of a cached source file
+     */
+    struct SourceKey {
+        std::string path;          // Absolute source path (UTF-8, empty = not a cache file)
+        uint64_t size = 0;         // Source size in bytes
+        int64_t modified = 0;      // Source modification time (file clock ticks)
+        uint64_t optionsHash = 0;  // Fingerprint of the read options the mesh was read with
+    };
+
+    /**
+     * @brief Write a mesh cache file
+     * @param meshData Input mesh data (stored in its own layout)
+     * @param filePath Output file path (UTF-8 encoded)
+     * @param options Write options (compress = LZ4 sections, formatThreads = compression threads)
+     * @param source Source identity recorded in the header (empty path for a plain .mcb file)
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @return Whether writing is successful
+     */
+    template<typename Real, typename Index>
+    static bool writeFile(const BasicMeshData<Real, Index>& meshData,
+                          const std::string& filePath,
+                          const FormatWriteOptions& options,
+                          const SourceKey& source,
+                          MeshErrorCode& errorCode,
+                          std::string& errorMsg);
+
+    /**
+     * @brief Read a mesh cache file
+     * A file written in the other layout is widened (float -> double, 32 -> 64 bit) or narrowed
+     * (fails if an index does not fit).
+     * @param filePath File path (UTF-8 encoded)
+     * @param[out] meshData Output mesh data
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @param threads Decompression threads (0 = hardware concurrency)
+     * @return Whether reading is successful
+     */
+    template<typename Real, typename Index>
+    static bool readFile(const std::string& filePath,
+                         BasicMeshData<Real, Index>& meshData,
+                         MeshErrorCode& errorCode,
+                         std::string& errorMsg,
+                         unsigned int threads = 0);
+
+    /**
+     * @brief Read only the header and metadata section of a mesh cache file
+     * @param filePath File path (UTF-8 encoded)
+     * @param[out] metadata Stored metadata (point/cell counts from the header)
+     * @param[out] source Source identity recorded in the header
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @return Whether the file is a valid mesh cache
+     */
+    static bool readHeader(const std::string& filePath,
+                           MeshMetadata& metadata,
+                           SourceKey& source,
+                           MeshErrorCode& errorCode,
+                           std::string& errorMsg);
+
+    /**
+     * @brief Check whether a file starts with the mesh cache signature
+     * @param filePath File path (UTF-8 encoded)
+     * @return Whether the file is a mesh cache file
+     */
+    static bool isCacheFile(const std::string& filePath);
+
+    /**
+     * @brief Identity of a source file as the cache records it
+     * @param sourcePath Source file path (UTF-8 encoded)
+     * @param options Read options the mesh is read with
+     * @param[out] key Source identity
+     * @return Whether the source exists
+     */
+    static bool sourceKey(const std::string& sourcePath, const FormatReadOptions& options, SourceKey& key);
+
+    /**
+     * @brief Cache file of a source: <cacheDir>/<hash of the absolute source path>.mcb
+     * @param sourcePath Source file path (UTF-8 encoded)
+     * @param cacheDir Cache directory (UTF-8 encoded)
+     * @return Cache file path
+     */
+    static std::string cachePath(const std::string& sourcePath, const std::string& cacheDir);
+
+    /**
+     * @brief Load the cached mesh of a source if the cache is still valid
+     * The cache is valid when path, size, modification time and read options all match.
+     * @param sourcePath Source file path (UTF-8 encoded)
+     * @param cacheDir Cache directory (UTF-8 encoded)
+     * @param[out] meshData Cached mesh (cleared on a miss)
+     * @param options Read options the mesh is wanted with
+     * @return Whether the mesh came from the cache
+     */
+    static bool load(const std::string& sourcePath,
+                     const std::string& cacheDir,
+                     MeshData& meshData,
+                     const FormatReadOptions& options = FormatReadOptions());
+
+    /**
+     * @brief Store the mesh read from a source in the cache (atomic replace of the cache file)
+     * @param sourcePath Source file path (UTF-8 encoded)
+     * @param cacheDir Cache directory (UTF-8 encoded, created if missing)
+     * @param meshData Mesh read from the source
+     * @param options Read options the mesh was read with
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @return Whether the cache file was written
+     */
+    static bool store(const std::string& sourcePath,
+                      const std::string& cacheDir,
+                      const MeshData& meshData,
+                      const FormatReadOptions& options,
+                      MeshErrorCode& errorCode,
+                      std::string& errorMsg);
+
+    /**
+     * @brief Read a mesh through the cache: load it if valid, else MeshReader::readAuto and store it
+     * A failure to store the cache does not fail the read.
+     * @param sourcePath Source file path (UTF-8 encoded)
+     * @param cacheDir Cache directory (UTF-8 encoded)
+     * @param[out] meshData Output mesh data
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @param options Read options
+     * @param[out] cacheHit Whether the mesh came from the cache (optional)
+     * @return Whether reading is successful
+     */
+    static bool readCached(const std::string& sourcePath,
+                           const std::string& cacheDir,
+                           MeshData& meshData,
+                           MeshErrorCode& errorCode,
+                           std::string& errorMsg,
+                           const FormatReadOptions& options = FormatReadOptions(),
+                           bool* cacheHit = nullptr);
+};
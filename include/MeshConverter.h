@@ -9,6 +9,28 @@
 #include "MeshReader.h"
 #include "MeshWriter.h"
 #include "MeshHelper.h"
+#include "MeshStream.h"
+#include "TaskPool.h"
+
+/**
+ * @brief Batch conversion scheduling options
+ */
+struct BatchConvertOptions {
+    size_t maxConcurrency = 0;           // Maximum files converted at once (0 = all pool workers)
+    uint64_t memoryBudget = 0;           // Maximum summed size in bytes of inputs converted at once (0 = unlimited)
+    TaskPool* pool = nullptr;            // Pool running the conversions (nullptr = TaskPool::shared())
+    bool incremental = false;            // Skip files whose content, settings and output are unchanged since the last run
+    std::string manifestPath;            // Manifest of an incremental batch (empty = ConversionManifest::defaultPath(dstDir))
+};
+
+/**
+ * @brief Outcome counts of a batch
+ */
+struct BatchConvertReport {
+    uint64_t converted = 0;              // Files converted by this run
+    uint64_t skipped = 0;                // Files left alone because their output is up to date (incremental)
+    uint64_t failed = 0;                 // Files that failed (listed in the error map)
+};
 
 /**
  * @brief Format conversion module
@@ -35,20 +57,51 @@ public:
                        MeshErrorCode& errorCode,
                        std::string& errorMsg);
 
+    /**
+     * @brief Single file format conversion in bounded memory
+     * Reads the source block by block (MeshStreamReader) and hands every block to an incremental
+     * writer (MeshStreamWriter), so the mesh is never materialized as a whole. Supported for
+     * STL, OBJ, PLY, OFF and SU2 on both sides.
+     * @param srcFilePath Source file path (UTF-8)
+     * @param dstFilePath Target file path (UTF-8)
+     * @param srcFormat Source format (MeshFormat::UNKNOWN=auto detect)
+     * @param dstFormat Target format
+     * @param writeOptions Target format write options
+     * @param streamOptions Block size and spool directory
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message
+     * @return Whether conversion is successful
+     */
+    static bool convertStreaming(const std::string& srcFilePath,
+                                 const std::string& dstFilePath,
+                                 MeshFormat srcFormat,
+                                 MeshFormat dstFormat,
+                                 const FormatWriteOptions& writeOptions,
+                                 const MeshStreamOptions& streamOptions,
+                                 MeshErrorCode& errorCode,
+                                 std::string& errorMsg);
+
     /**
      * @brief Batch convert multiple files
      * @param srcFilePaths Source file path list (UTF-8)
      * @param dstDir Target directory (UTF-8)
      * @param dstFormat Target format
      * @param writeOptions Target format write options
+     * With batchOptions.incremental a ConversionManifest kept with the outputs records every
+     * successful conversion; files whose source content, settings and output did not change
+     * since it was written are skipped.
      * @param[out] errorMap Output error information for each file (key=source file path, value=(errorCode, errorMsg))
-     * @return Number of successfully converted files
+     * @param batchOptions Scheduling options (largest files are started first) and incremental mode
+     * @param[out] report Output converted/skipped/failed counts (optional)
+     * @return Number of files whose output is up to date (converted or skipped)
      */
     static uint64_t batchConvert(const std::vector<std::string>& srcFilePaths,
                                 const std::string& dstDir,
                                 MeshFormat dstFormat,
                                 const FormatWriteOptions& writeOptions,
-                                std::unordered_map<std::string, std::pair<MeshErrorCode, std::string>>& errorMap);
+                                std::unordered_map<std::string, std::pair<MeshErrorCode, std::string>>& errorMap,
+                                const BatchConvertOptions& batchOptions = BatchConvertOptions(),
+                                BatchConvertReport* report = nullptr);
 
 private:
     /**
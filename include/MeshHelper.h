@@ -25,6 +25,16 @@ public:
      */
     static MeshFormat detectFormatFromExtension(const std::string& filePath);
 
+    /**
+     * @brief Tell binary from ASCII STL by content
+     * A file of exactly 84 + 50 * n bytes, n being the triangle count at offset 80, is binary even
+     * when its 80-byte header starts with "solid" (as many exporters write); otherwise the
+     * "solid" keyword marks ASCII. Agrees with MeshReader::readSTL.
+     * @param filePath File path (UTF-8)
+     * @return MeshFormat::STL_BINARY or MeshFormat::STL_ASCII (STL_BINARY if the file cannot be read)
+     */
+    static MeshFormat detectSTLEncoding(const std::string& filePath);
+
     /**
      * @brief Check if a format is supported
      * @param format Mesh format to check
@@ -54,6 +64,10 @@ public:
 
     /**
      * @brief Extract mesh metadata (without loading complete geometry/topology data, improves performance)
+     * Counts come from format headers only (STL triangle count, PLY element lines, OFF counts,
+     * SU2 NPOIN/NELEM, VTK POINTS/CELLS and Piece attributes, Gmsh $Nodes/$Elements, OpenFOAM
+     * owner note). Section payloads between headers are skipped, never parsed; formats without
+     * header counts (OBJ, ASCII STL, CGNS) leave pointCountKnown/cellCountKnown false.
      * @param filePath File path (UTF-8)
      * @param[out] metadata Output metadata
      * @param[out] errorCode Output error code
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "MeshTypes.h"
+
+/**
+ * @brief Instruction set used by the vectorized mesh kernels
+ */
+enum class SimdLevel {
+    SCALAR = 0,  // Portable C++
+    SSE2 = 1,    // x86 baseline (4 floats per instruction)
+    AVX2 = 2,    // x86 with AVX2 (8 floats per instruction)
+    NEON = 3     // ARMv8 Advanced SIMD
+};
+
+/**
+ * @brief Parts of a mesh scan (combine with |)
+ */
+enum MeshScanParts : unsigned int {
+    SCAN_BOUNDS = 1,      // Bounding box of the points
+    SCAN_INDICES = 2,     // Largest point index referenced by the cells
+    SCAN_CELL_TYPES = 4,  // Per-type cell histogram and volume/surface classification
+    SCAN_ALL = 7
+};
+
+/**
+ * @brief Result of one fused scan over points, connectivity and cell types
+ */
+struct MeshScanResult {
+    float bounds[6] = {0, 0, 0, 0, 0, 0};     // [minX, maxX, minY, maxY, minZ, maxZ] (min > max when there are no points)
+    uint32_t maxPointIndex = 0;               // Largest connectivity entry (0 when there is none)
+    bool indicesValid = true;                 // Whether every connectivity entry is below the point count
+    std::array<uint64_t, 256> cellTypeCount{}; // Cells per VtkCellType value
+    bool hasVolumeCells = false;              // Whether any tetra/hexahedron/wedge/pyramid is present
+};
+
+/**
+ * @brief Vectorized, multithreaded whole-mesh kernels
+ *
+ * scan() computes the requested parts in one parallel region: every task walks its slice of the
+ * points, the connectivity and the cell types once. Bounds and index maxima use SSE2, AVX2 or
+ * NEON, picked at run time from what the CPU supports; results are identical for every level
+ * (NaN coordinates are ignored, as by the scalar std::min/std::max loop).
+ */
+class MeshKernels {
+public:
+    /**
+     * @brief Scan a mesh
+     * @param meshData Mesh data
+     * @param parts Parts to compute (MeshScanParts flags)
+     * @param threads Worker threads (0 = hardware concurrency, 1 = serial)
+     * @return Scan result (parts not requested keep their defaults)
+     */
+    static MeshScanResult scan(const MeshData& meshData, unsigned int parts = SCAN_ALL, unsigned int threads = 0);
+
+    /**
+     * @brief Count cells per type (shared by every coordinate/index layout)
+     * @param types Cell type array
+     * @param threads Worker threads (0 = hardware concurrency, 1 = serial)
+     * @return Cells per VtkCellType value
+     */
+    static std::array<uint64_t, 256> countCellTypes(const std::vector<VtkCellType>& types, unsigned int threads = 0);
+
+    /**
+     * @brief Check whether a cell type histogram contains tetrahedra, hexahedra, wedges or pyramids
+     * @param cellTypeCount Cells per VtkCellType value
+     * @return Whether the mesh has volume cells
+     */
+    static bool hasVolumeCells(const std::array<uint64_t, 256>& cellTypeCount);
+
+    /**
+     * @brief Get the instruction set the kernels currently use
+     * @return Active SIMD level (the best supported one unless overridden)
+     */
+    static SimdLevel simdLevel();
+
+    /**
+     * @brief Get the best instruction set supported by this CPU
+     * @return Detected SIMD level
+     */
+    static SimdLevel detectSimdLevel();
+
+    /**
+     * @brief Override the instruction set (benchmarks, tests); unsupported levels fall back to SCALAR
+     * @param level Requested SIMD level
+     */
+    static void setSimdLevel(SimdLevel level);
+
+    /**
+     * @brief Get display name of a SIMD level
+     * @param level SIMD level
+     * @return Name (e.g. "AVX2")
+     */
+    static const char* simdLevelName(SimdLevel level);
+};
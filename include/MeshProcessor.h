@@ -2,6 +2,8 @@
 
 #include <string>
 #include <cstdint>
+#include <functional>
+#include <vector>
 #include "MeshTypes.h"
 #include "MeshException.h"
 
@@ -11,11 +13,75 @@
  */
 class MeshProcessor {
 public:
+    /**
+     * @brief Smoothing algorithm
+     */
+    enum class SmoothingMethod {
+        LAPLACIAN,  // Move each point toward the average of its neighbours (shrinks the mesh)
+        TAUBIN      // Alternate a shrinking (lambda) and an inflating (mu) pass, no shrinkage
+    };
+
+    /**
+     * @brief Mesh smoothing options
+     */
+    struct SmoothingOptions {
+        SmoothingMethod method = SmoothingMethod::LAPLACIAN;
+        int iterations = 20;           // Iterations (a Taubin iteration is one lambda and one mu pass)
+        float relaxation = 0.5f;       // Laplacian factor / Taubin lambda (0-1)
+        float passBand = 0.1f;         // Taubin pass-band frequency k_PB (mu = 1 / (k_PB - 1/lambda))
+        bool preserveBoundary = true;  // Keep boundary points fixed (open surface edges, outer faces of volumes)
+        unsigned int threads = 0;      // Worker threads (0 = hardware concurrency)
+    };
+
+    /**
+     * @brief Mesh simplification options
+     */
+    struct SimplificationOptions {
+        float targetReduction = 0.5f;  // Fraction of triangles to remove (0-1)
+        bool preserveBoundary = true;  // Pin open boundary edges with penalty quadrics
+        unsigned int threads = 0;      // Worker threads for partitioned decimation (0 = hardware concurrency, 1 = serial)
+    };
+
+    /**
+     * @brief Point welding options
+     */
+    struct WeldOptions {
+        float tolerance = 0.0f;             // Merge distance (0 = identical positions only)
+        bool relativeTolerance = false;     // Tolerance is a fraction of the bounding-box diagonal
+        bool averageMerged = false;         // Average positions and point data of merged points (false = keep the first point)
+        bool removeDegenerateCells = true;  // Drop polygons/lines that collapse, shrink polygons that lose corners
+        unsigned int threads = 0;           // Worker threads (0 = hardware concurrency)
+    };
+
+    /**
+     * @brief Space-filling-curve reordering options
+     */
+    struct ReorderOptions {
+        MeshReorder curve = MeshReorder::HILBERT;  // Curve (NONE = copy unchanged)
+        bool reorderPoints = true;                 // Sort points by the curve code of their position
+        bool reorderCells = true;                  // Sort cells by the curve code of their centroid
+        unsigned int threads = 0;                  // Worker threads (0 = hardware concurrency)
+    };
+
+    /**
+     * @brief Level-of-detail chain options (display of large meshes)
+     */
+    struct LodOptions {
+        uint64_t maxTriangles = 2000000;   // Triangle budget of the finest level (larger surfaces are decimated to it)
+        uint64_t minTriangles = 20000;     // Triangles below which no coarser level is built
+        float levelRatio = 0.25f;          // Triangle ratio between consecutive levels (0-1)
+        unsigned int threads = 0;          // Worker threads for decimation (0 = hardware concurrency)
+    };
+
     /**
      * @brief Extract surface mesh from volume mesh (generate closed shell)
+     * Faces of tetrahedra, hexahedra, wedges and pyramids are keyed by their sorted point indices;
+     * keys are hash-bucketed, and each bucket is sorted and deduplicated in parallel. Output faces
+     * keep the winding of their owning cell (outward normals), unused points are dropped, and each
+     * face carries the cell data of its owning cell. Cells of lower dimension are ignored.
      * @param volumeMesh Input volume mesh data
      * @param[out] surfaceMesh Output surface mesh data
-     * @param includeBoundaryOnly Whether to extract only boundary cells (true=only boundary, false=all surfaces)
+     * @param includeBoundaryOnly Whether to extract only boundary faces (true=faces used by one cell, false=every distinct face once)
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message
      * @return Whether processing is successful
@@ -43,9 +109,9 @@ public:
     static bool computeBounds(const MeshData& meshData, std::vector<float>& bounds);
 
     /**
-     * @brief Mesh smoothing
+     * @brief Mesh smoothing (Laplacian, boundary points fixed)
      * @param meshData Input mesh data
-     * @param[out] smoothedMesh Output smoothed mesh data
+     * @param[out] smoothedMesh Output smoothed mesh data (may be the input)
      * @param iterations Smoothing iteration count
      * @param relaxation Relaxation factor (0-1)
      * @param[out] errorCode Output error code
@@ -59,6 +125,40 @@ public:
                           MeshErrorCode& errorCode,
                           std::string& errorMsg);
 
+    /**
+     * @brief Mesh smoothing with explicit options
+     * Points are moved along the edges of all cells (surface and volume); topology and
+     * attributes are kept.
+     * @param meshData Input mesh data
+     * @param[out] smoothedMesh Output smoothed mesh data (may be the input)
+     * @param options Smoothing options
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message
+     * @return Whether processing is successful
+     */
+    static bool smoothMesh(const MeshData& meshData,
+                          MeshData& smoothedMesh,
+                          const SmoothingOptions& options,
+                          MeshErrorCode& errorCode,
+                          std::string& errorMsg);
+
+    /**
+     * @brief Smooth a point array in place
+     * A point-to-point adjacency (CSR) is built once from the cell edges; every pass is a
+     * double-buffered parallel sweep over the points.
+     * @param[in,out] points Point coordinates (xyz)
+     * @param cells Cells defining the point neighbourhoods
+     * @param options Smoothing options
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message
+     * @return Whether processing is successful
+     */
+    static bool smoothPoints(std::vector<float>& points,
+                            const MeshData::CellArray& cells,
+                            const SmoothingOptions& options,
+                            MeshErrorCode& errorCode,
+                            std::string& errorMsg);
+
     /**
      * @brief Mesh simplification
      * @param meshData Input mesh data
@@ -74,6 +174,88 @@ public:
                             MeshErrorCode& errorCode,
                             std::string& errorMsg);
 
+    /**
+     * @brief Mesh simplification with explicit options (quadric error edge collapse)
+     * Polygonal cells are triangulated and decimated; point data is interpolated along each
+     * collapsed edge and every output triangle keeps the cell data of its source cell. Large
+     * meshes are split into spatial slabs decimated in parallel with their shared vertices
+     * locked, followed by a pass that collapses across the seams. The slab count depends on the
+     * triangle count only, so the output does not change with the thread count. Volume cells are rejected;
+     * points and lines are dropped.
+     * @param meshData Input surface mesh data
+     * @param[out] simplifiedMesh Output triangle mesh (may be the input)
+     * @param options Simplification options
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message
+     * @return Whether processing is successful
+     */
+    static bool simplifyMesh(const MeshData& meshData,
+                            MeshData& simplifiedMesh,
+                            const SimplificationOptions& options,
+                            MeshErrorCode& errorCode,
+                            std::string& errorMsg);
+
+    /**
+     * @brief Merge coincident points (spatial hash over a uniform grid) and remap the cells
+     * Each point merges into the lowest-index point within the tolerance, transitively. Points
+     * are hashed into cells twice the tolerance wide, so every query visits at most eight cells;
+     * hashing, sorting and queries run in parallel. Cells of all types (including volume cells)
+     * are remapped, point data follows the merged points and cell data follows the kept cells.
+     * @param meshData Input mesh data
+     * @param[out] weldedMesh Output mesh data (may be the input)
+     * @param options Welding options
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message
+     * @return Whether processing is successful
+     */
+    static bool weldPoints(const MeshData& meshData,
+                          MeshData& weldedMesh,
+                          const WeldOptions& options,
+                          MeshErrorCode& errorCode,
+                          std::string& errorMsg);
+
+    /**
+     * @brief Reorder points and cells along a space-filling curve for memory locality
+     * Coordinates are quantized to 21 bits per axis over the bounding cube and mapped to Morton
+     * or Hilbert codes; points (by position) and cells (by centroid) are sorted with a stable
+     * parallel radix sort. Cell connectivity is remapped, point and cell data are permuted
+     * with their entities, so the reordered mesh describes the same geometry.
+     * @param meshData Input mesh data
+     * @param[out] reorderedMesh Output mesh data (may be the input)
+     * @param options Reordering options
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message
+     * @return Whether processing is successful
+     */
+    static bool reorderMesh(const MeshData& meshData,
+                           MeshData& reorderedMesh,
+                           const ReorderOptions& options,
+                           MeshErrorCode& errorCode,
+                           std::string& errorMsg);
+
+    /**
+     * @brief Build a level-of-detail chain for display: the boundary surface, then decimated copies
+     * Volume meshes are reduced to their boundary faces (extractSurfaceFromVolume) so interior cells
+     * never reach the renderer. Levels hold triangles only, without attributes, and are produced
+     * coarsest first, each decimated from the full surface, so a coarse level is available after one
+     * decimation pass and the following levels refine it. The finest level keeps the surface
+     * unchanged when it fits in maxTriangles. Inside a job each level is a progress step and
+     * cancellation is checked between levels.
+     * @param meshData Input mesh (volume or surface)
+     * @param[out] levels Output levels, coarsest first
+     * @param options Level-of-detail options
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message
+     * @param onLevel Called with the index and mesh of every level as soon as it is built (optional)
+     * @return Whether processing is successful
+     */
+    static bool buildLevelsOfDetail(const MeshData& meshData,
+                                   std::vector<MeshData>& levels,
+                                   const LodOptions& options,
+                                   MeshErrorCode& errorCode,
+                                   std::string& errorMsg,
+                                   const std::function<void(size_t, const MeshData&)>& onLevel = nullptr);
+
 private:
     /**
      * @brief Check if point index is valid
@@ -17,12 +17,32 @@ public:
      * @param[out] meshData Output mesh data
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message (UTF-8)
+     * @param options Read options (format-specific configurations)
      * @return Whether reading is successful (true=success, false=failure)
      */
     static bool readAuto(const std::string& filePath,
                          MeshData& meshData,
                          MeshErrorCode& errorCode,
-                         std::string& errorMsg);
+                         std::string& errorMsg,
+                         const FormatReadOptions& options = FormatReadOptions());
+
+    /**
+     * @brief Automatically detect file format and read mesh data with double coordinates and 64-bit indices
+     * Gmsh, SU2, CGNS and OpenFOAM are read directly in double precision; VTK keeps the
+     * precision of the VTK reader output. STL, OBJ, PLY and OFF are parsed in single precision
+     * (STL stores float32) and widened. Point welding is not applied in this layout.
+     * @param filePath File path (UTF-8 encoded)
+     * @param[out] meshData Output mesh data
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @param options Read options (format-specific configurations)
+     * @return Whether reading is successful
+     */
+    static bool readAuto(const std::string& filePath,
+                         MeshData64& meshData,
+                         MeshErrorCode& errorCode,
+                         std::string& errorMsg,
+                         const FormatReadOptions& options = FormatReadOptions());
 
     /**
      * @brief Read VTK format file (supports Legacy/XML automatic detection)
@@ -38,47 +58,78 @@ public:
                         std::string& errorMsg);
 
     /**
-     * @brief Read CGNS format file
+     * @brief Read CGNS format file (all selected zones of one base merged into one mesh)
+     * Zones are bulk-read (cg_coord_read/cg_elements_read) and converted in parallel. Structured
+     * zones become lines/quads/hexahedra, higher-order elements keep their corner nodes, and
+     * Vertex/CellCenter FlowSolution fields become point/cell data (<name>X/Y/Z as one vector).
+     * Merged zones are not welded at their interfaces (see FormatReadOptions::weldPoints); the
+     * source zone of each cell is stored as INT32 cell data "cgns:zone".
      * @param filePath File path (UTF-8 encoded)
      * @param[out] meshData Output mesh data
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message (UTF-8)
-     * @param baseIndex CGNS Base index (default 0, first Base)
-     * @param zoneIndex CGNS Zone index (default 0, first Zone)
+     * @param options Read options (cgnsBase, cgnsZones, readThreads)
      * @return Whether reading is successful
      */
+    template<typename Real, typename Index>
     static bool readCGNS(const std::string& filePath,
-                         MeshData& meshData,
+                         BasicMeshData<Real, Index>& meshData,
                          MeshErrorCode& errorCode,
                          std::string& errorMsg,
-                         int baseIndex = 0,
-                         int zoneIndex = 0);
+                         const FormatReadOptions& options = FormatReadOptions());
 
     /**
-     * @brief Read Gmsh format file (supports v2/v4 automatic detection)
+     * @brief Read CGNS format file into one mesh per zone
+     * @param filePath File path (UTF-8 encoded)
+     * @param[out] zones Output meshes in selection order (metadata.blockName holds the zone name)
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @param options Read options (cgnsBase, cgnsZones, readThreads)
+     * @return Whether reading is successful
+     */
+    template<typename Real, typename Index>
+    static bool readCGNSZones(const std::string& filePath,
+                              std::vector<BasicMeshData<Real, Index>>& zones,
+                              MeshErrorCode& errorCode,
+                              std::string& errorMsg,
+                              const FormatReadOptions& options = FormatReadOptions());
+
+    /**
+     * @brief Read Gmsh format file (MSH 2.2/4.1, ASCII or binary)
+     * Native, re-entrant parser over a memory-mapped view (no global Gmsh API state), so Gmsh
+     * files can be read on several threads at once. Higher-order elements keep their corner
+     * nodes; physical groups become metadata.physicalRegions/physicalRegionTags and the
+     * "gmsh:physical"/"gmsh:geometrical" cell data arrays.
+     * Instantiated for MeshData and MeshData64 (Gmsh node coordinates are double).
      * @param filePath File path (UTF-8 encoded)
      * @param[out] meshData Output mesh data
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message (UTF-8)
+     * @param options Read options (readThreads enables chunk-parallel parsing)
      * @return Whether reading is successful
      */
+    template<typename Real, typename Index>
     static bool readGmsh(const std::string& filePath,
-                         MeshData& meshData,
+                         BasicMeshData<Real, Index>& meshData,
                          MeshErrorCode& errorCode,
-                         std::string& errorMsg);
+                         std::string& errorMsg,
+                         const FormatReadOptions& options = FormatReadOptions());
 
     /**
      * @brief Read STL format file (ASCII/Binary)
+     * Binary files are parsed straight from a memory-mapped view.
      * @param filePath File path (UTF-8 encoded)
      * @param[out] meshData Output mesh data
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message (UTF-8)
+     * @param options Read options (stlWeldVertices produces an indexed mesh)
      * @return Whether reading is successful
      */
     static bool readSTL(const std::string& filePath,
                         MeshData& meshData,
                         MeshErrorCode& errorCode,
-                        std::string& errorMsg);
+                        std::string& errorMsg,
+                        const FormatReadOptions& options = FormatReadOptions());
 
     /**
      * @brief Read OBJ format file
@@ -86,12 +137,15 @@ public:
      * @param[out] meshData Output mesh data
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message (UTF-8)
+     * @param options Read options (readThreads enables chunk-parallel parsing of large files;
+     *                the result is identical to the serial reader)
      * @return Whether reading is successful
      */
     static bool readOBJ(const std::string& filePath,
                         MeshData& meshData,
                         MeshErrorCode& errorCode,
-                        std::string& errorMsg);
+                        std::string& errorMsg,
+                        const FormatReadOptions& options = FormatReadOptions());
 
     /**
      * @brief Read PLY format file (ASCII/Binary)
@@ -125,25 +179,56 @@ public:
      * @param[out] meshData Output mesh data
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message (UTF-8)
-     * @return Whether reading is successful
+     * @param options Read options (readThreads enables chunk-parallel parsing of large files;
+     *                the result is identical to the serial reader)
+     * @return Whether reading is successful (instantiated for MeshData and MeshData64)
      */
+    template<typename Real, typename Index>
     static bool readSU2(const std::string& filePath,
-                        MeshData& meshData,
+                        BasicMeshData<Real, Index>& meshData,
                         MeshErrorCode& errorCode,
-                        std::string& errorMsg);
+                        std::string& errorMsg,
+                        const FormatReadOptions& options = FormatReadOptions());
 
     /**
-     * @brief Read OpenFOAM format file
-     * @param filePath File path (UTF-8 encoded)
+     * @brief Read OpenFOAM polyMesh (ASCII or binary FoamFile lists)
+     * points, faces, owner, neighbour and boundary are read concurrently. Hexahedra, wedges,
+     * pyramids and tetrahedra are recognized from their faces; other polyhedra are split into
+     * pyramids/tetrahedra around an added centre point ("foam:cell" holds the source cell).
+     * With openFoamPatches the boundary faces follow as polygons tagged by INT32 cell data
+     * "foam:patch" (index into metadata.physicalRegions/physicalRegionTypes, -1 for volume
+     * cells). Without a reconstructed mesh the processor* directories are read in parallel and
+     * merged ("foam:processor"); pointProcAddressing, if present, merges the interface points.
+     * @param filePath Case directory, its constant directory or the polyMesh directory (UTF-8 encoded)
      * @param[out] meshData Output mesh data
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message (UTF-8)
+     * @param options Read options (openFoamPatches, readThreads)
      * @return Whether reading is successful
      */
+    template<typename Real, typename Index>
     static bool readOpenFOAM(const std::string& filePath,
-                             MeshData& meshData,
+                             BasicMeshData<Real, Index>& meshData,
                              MeshErrorCode& errorCode,
-                             std::string& errorMsg);
+                             std::string& errorMsg,
+                             const FormatReadOptions& options = FormatReadOptions());
+
+    /**
+     * @brief Read native binary mesh cache file (.mcb, see MeshCache)
+     * Sections are copied (or LZ4-decompressed in parallel) straight into the mesh arrays.
+     * @param filePath File path (UTF-8 encoded)
+     * @param[out] meshData Output mesh data
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @param options Read options (readThreads)
+     * @return Whether reading is successful
+     */
+    template<typename Real, typename Index>
+    static bool readMeshCache(const std::string& filePath,
+                              BasicMeshData<Real, Index>& meshData,
+                              MeshErrorCode& errorCode,
+                              std::string& errorMsg,
+                              const FormatReadOptions& options = FormatReadOptions());
 
     /**
      * @brief Detect format from file header
@@ -161,11 +246,13 @@ public:
      * @param filePath File path (UTF-8 encoded)
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message (UTF-8)
+     * @param options Read options (format-specific configurations)
      * @return vtkUnstructuredGrid pointer, returns nullptr on failure
      */
     static vtkSmartPointer<vtkUnstructuredGrid> readAutoToVTK(const std::string& filePath,
                                                               MeshErrorCode& errorCode,
-                                                              std::string& errorMsg);
+                                                              std::string& errorMsg,
+                                                              const FormatReadOptions& options = FormatReadOptions());
 
     /**
      * @brief Read VTK format file as vtkUnstructuredGrid
@@ -183,48 +270,52 @@ public:
      * @param filePath File path (UTF-8 encoded)
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message (UTF-8)
-     * @param baseIndex CGNS Base index (default 0, first Base)
-     * @param zoneIndex CGNS Zone index (default 0, first Zone)
+     * @param options Read options (cgnsBase, cgnsZones, readThreads)
      * @return vtkUnstructuredGrid pointer, returns nullptr on failure
      */
     static vtkSmartPointer<vtkUnstructuredGrid> readCGNSToVTK(const std::string& filePath,
-                                                              MeshErrorCode& errorCode,
-                                                              std::string& errorMsg,
-                                                              int baseIndex = 0,
-                                                              int zoneIndex = 0);
+                                                             MeshErrorCode& errorCode,
+                                                             std::string& errorMsg,
+                                                             const FormatReadOptions& options = FormatReadOptions());
 
     /**
      * @brief Read Gmsh format file as vtkUnstructuredGrid
      * @param filePath File path (UTF-8 encoded)
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message (UTF-8)
+     * @param options Read options (readThreads enables chunk-parallel parsing)
      * @return vtkUnstructuredGrid pointer, returns nullptr on failure
      */
     static vtkSmartPointer<vtkUnstructuredGrid> readGmshToVTK(const std::string& filePath,
                                                               MeshErrorCode& errorCode,
-                                                              std::string& errorMsg);
+                                                              std::string& errorMsg,
+                                                              const FormatReadOptions& options = FormatReadOptions());
 
     /**
      * @brief Read STL format file as vtkUnstructuredGrid
      * @param filePath File path (UTF-8 encoded)
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message (UTF-8)
+     * @param options Read options (stlWeldVertices produces an indexed mesh)
      * @return vtkUnstructuredGrid pointer, returns nullptr on failure
      */
     static vtkSmartPointer<vtkUnstructuredGrid> readSTLToVTK(const std::string& filePath,
                                                              MeshErrorCode& errorCode,
-                                                             std::string& errorMsg);
+                                                             std::string& errorMsg,
+                                                             const FormatReadOptions& options = FormatReadOptions());
 
     /**
      * @brief Read OBJ format file as vtkUnstructuredGrid
      * @param filePath File path (UTF-8 encoded)
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message (UTF-8)
+     * @param options Read options (readThreads enables chunk-parallel parsing)
      * @return vtkUnstructuredGrid pointer, returns nullptr on failure
      */
     static vtkSmartPointer<vtkUnstructuredGrid> readOBJToVTK(const std::string& filePath,
                                                              MeshErrorCode& errorCode,
-                                                             std::string& errorMsg);
+                                                             std::string& errorMsg,
+                                                             const FormatReadOptions& options = FormatReadOptions());
 
     /**
      * @brief Read PLY format file as vtkUnstructuredGrid
@@ -253,22 +344,26 @@ public:
      * @param filePath File path (UTF-8 encoded)
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message (UTF-8)
+     * @param options Read options (readThreads enables chunk-parallel parsing)
      * @return vtkUnstructuredGrid pointer, returns nullptr on failure
      */
     static vtkSmartPointer<vtkUnstructuredGrid> readSU2ToVTK(const std::string& filePath,
                                                              MeshErrorCode& errorCode,
-                                                             std::string& errorMsg);
+                                                             std::string& errorMsg,
+                                                             const FormatReadOptions& options = FormatReadOptions());
 
     /**
      * @brief Read OpenFOAM format file as vtkUnstructuredGrid
-     * @param filePath File path (UTF-8 encoded)
+     * @param filePath Case directory, its constant directory or the polyMesh directory (UTF-8 encoded)
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message (UTF-8)
+     * @param options Read options (openFoamPatches, readThreads)
      * @return vtkUnstructuredGrid pointer, returns nullptr on failure
      */
     static vtkSmartPointer<vtkUnstructuredGrid> readOpenFOAMToVTK(const std::string& filePath,
                                                                   MeshErrorCode& errorCode,
-                                                                  std::string& errorMsg);
+                                                                  std::string& errorMsg,
+                                                                  const FormatReadOptions& options = FormatReadOptions());
 
 private:
     /**
@@ -279,35 +374,34 @@ private:
     static bool fileExists(const std::string& filePath);
 
     /**
-     * @brief Read ASCII STL format
-     * @param file Input file stream
+     * @brief Read ASCII STL format from a mapped buffer
+     * @param data File contents
+     * @param size File size in bytes
      * @param[out] meshData Output mesh data
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message (UTF-8)
      * @return Whether reading is successful
      */
-    static bool readSTLASCII(std::ifstream& file,
+    static bool readSTLASCII(const char* data,
+                             size_t size,
                              MeshData& meshData,
                              MeshErrorCode& errorCode,
                              std::string& errorMsg);
 
     /**
-     * @brief Read Binary STL format
-     * @param file Input file stream
+     * @brief Read Binary STL format from a mapped buffer
+     * @param data File contents
+     * @param size File size in bytes
      * @param[out] meshData Output mesh data
+     * @param weldVertices Whether to merge bit-identical vertices
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message (UTF-8)
      * @return Whether reading is successful
      */
-    static bool readSTLBinary(std::ifstream& file,
+    static bool readSTLBinary(const char* data,
+                              size_t size,
                               MeshData& meshData,
+                              bool weldVertices,
                               MeshErrorCode& errorCode,
                               std::string& errorMsg);
-
-    /**
-     * @brief Convert MeshData to vtkUnstructuredGrid
-     * @param meshData Input mesh data
-     * @return vtkUnstructuredGrid pointer
-     */
-    static vtkSmartPointer<vtkUnstructuredGrid> meshDataToVTK(const MeshData& meshData);
 };
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include "MeshTypes.h"
+#include "MeshException.h"
+
+/**
+ * @brief Streaming conversion options
+ */
+struct MeshStreamOptions {
+    size_t blockBytes = 64 * 1024 * 1024; // Approximate input bytes parsed per block (bounds reader memory)
+    std::string tempDirectory;            // Directory for writer spool files (empty = next to the output file)
+};
+
+/**
+ * @brief Description of a mesh stream, known once the reader has parsed the file header
+ */
+struct MeshStreamInfo {
+    MeshFormat format = MeshFormat::UNKNOWN; // Source format
+    MeshType meshType = MeshType::UNKNOWN;   // Volume/surface mesh type (from the format)
+    uint64_t pointCount = 0;                 // Total points (valid when pointCountKnown)
+    uint64_t cellCount = 0;                  // Total cells (valid when cellCountKnown)
+    bool pointCountKnown = false;            // Whether the header declares the point count
+    bool cellCountKnown = false;             // Whether the header declares the cell count
+    bool blockLocalCells = false;            // Whether cells only reference points of their own block (STL)
+};
+
+/**
+ * @brief One block of a mesh stream
+ * Points arrive in file order; cell point indices are global (they may refer to points of
+ * earlier or, for SU2, later blocks).
+ */
+struct MeshBlock {
+    uint64_t firstPoint = 0;     // Global index of the first point of this block
+    uint64_t firstCell = 0;      // Global index of the first cell of this block
+    std::vector<float> points;   // xyz coordinates, length = pointCount*3
+    MeshData::CellArray cells;   // Cells with global point indices
+
+    size_t pointCount() const { return points.size() / 3; }
+    bool empty() const { return points.empty() && cells.empty(); }
+    void clear();
+};
+
+/**
+ * @brief Chunked mesh reader: emits point and cell blocks without materializing the whole mesh
+ *
+ * The file is memory-mapped and parsed one block at a time; pages already consumed are handed
+ * back to the OS, so resident memory stays around one block regardless of the file size.
+ * Supported formats: STL (ASCII/binary), OBJ, PLY (ASCII/binary little endian), OFF, SU2.
+ */
+class MeshStreamReader {
+public:
+    virtual ~MeshStreamReader() = default;
+
+    /**
+     * @brief Open a file for streaming and parse its header
+     * @param filePath File path (UTF-8 encoded)
+     * @param format Source format (MeshFormat::UNKNOWN = auto detect)
+     * @param options Streaming options
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @return Reader positioned at the first block, nullptr on failure
+     */
+    static std::unique_ptr<MeshStreamReader> open(const std::string& filePath,
+                                                  MeshFormat format,
+                                                  const MeshStreamOptions& options,
+                                                  MeshErrorCode& errorCode,
+                                                  std::string& errorMsg);
+
+    /**
+     * @brief Check whether a format can be read as a stream
+     * @param format Mesh format
+     * @return Whether open() accepts the format
+     */
+    static bool supportsFormat(MeshFormat format);
+
+    /**
+     * @brief Get stream description
+     * @return Stream info
+     */
+    const MeshStreamInfo& info() const { return info_; }
+
+    /**
+     * @brief Check whether all blocks were read
+     * @return Whether the stream is exhausted
+     */
+    bool atEnd() const { return atEnd_; }
+
+    /**
+     * @brief Read the next block
+     * @param[out] block Output block (cleared first; may be empty at the end of the stream)
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @return Whether reading is successful
+     */
+    bool readBlock(MeshBlock& block, MeshErrorCode& errorCode, std::string& errorMsg);
+
+protected:
+    MeshStreamReader() = default;
+
+    /**
+     * @brief Parse the next block into a cleared block (firstPoint/firstCell already set)
+     * Implementations set atEnd_ after the last block.
+     */
+    virtual bool parseBlock(MeshBlock& block, MeshErrorCode& errorCode, std::string& errorMsg) = 0;
+
+    MeshStreamInfo info_;          // Stream description
+    MeshStreamOptions options_;    // Streaming options
+    bool atEnd_ = false;           // Whether the stream is exhausted
+    uint64_t pointsRead_ = 0;      // Points emitted so far
+    uint64_t cellsRead_ = 0;       // Cells emitted so far
+};
+
+/**
+ * @brief Incremental mesh writer: consumes point and cell blocks as they are read
+ *
+ * Sections that must precede data not yet seen (e.g. PLY/OFF faces before all vertices are
+ * known, SU2 points after the elements, STL facets that need point coordinates) are spooled
+ * to temporary files and merged in finish(). Counts in headers are patched in place.
+ * Supported formats: STL (ASCII/binary), OBJ, PLY (ASCII/binary little endian), OFF, SU2.
+ * Surface formats keep polygonal cells only; SU2 keeps all linear cell types.
+ */
+class MeshStreamWriter {
+public:
+    virtual ~MeshStreamWriter();
+
+    /**
+     * @brief Create the output file and write its header
+     * @param filePath Output file path (UTF-8 encoded)
+     * @param format Target format (STL_ASCII/PLY_ASCII write text, STL_BINARY/PLY_BINARY binary)
+     * @param writeOptions Write options (precision, STL solid name)
+     * @param sourceInfo Description of the stream that will be written
+     * @param options Streaming options
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @return Writer ready for writeBlock(), nullptr on failure
+     */
+    static std::unique_ptr<MeshStreamWriter> create(const std::string& filePath,
+                                                    MeshFormat format,
+                                                    const FormatWriteOptions& writeOptions,
+                                                    const MeshStreamInfo& sourceInfo,
+                                                    const MeshStreamOptions& options,
+                                                    MeshErrorCode& errorCode,
+                                                    std::string& errorMsg);
+
+    /**
+     * @brief Check whether a format can be written as a stream
+     * @param format Mesh format
+     * @return Whether create() accepts the format
+     */
+    static bool supportsFormat(MeshFormat format);
+
+    /**
+     * @brief Consume one block
+     * @param block Block read from a MeshStreamReader (or built by the caller)
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @return Whether writing is successful
+     */
+    virtual bool writeBlock(const MeshBlock& block, MeshErrorCode& errorCode, std::string& errorMsg) = 0;
+
+    /**
+     * @brief Merge spooled sections, patch header counts and close the file
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @return Whether writing is successful
+     */
+    virtual bool finish(MeshErrorCode& errorCode, std::string& errorMsg) = 0;
+
+    /**
+     * @brief Get number of points written so far
+     * @return Point count
+     */
+    uint64_t pointsWritten() const { return pointsWritten_; }
+
+    /**
+     * @brief Get number of cells written so far
+     * @return Cell count (cells dropped by the target format are not counted)
+     */
+    uint64_t cellsWritten() const { return cellsWritten_; }
+
+protected:
+    MeshStreamWriter() = default;
+
+    uint64_t pointsWritten_ = 0;   // Points consumed
+    uint64_t cellsWritten_ = 0;    // Cells stored in the output
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "MeshTypes.h"
+
+/**
+ * @brief Parsers for line-aligned blocks of ASCII mesh files
+ * Shared by the whole-file readers (MeshReader, which parses blocks in parallel) and the
+ * streaming readers (MeshStreamReader, which parses one block at a time).
+ */
+class MeshTextParser {
+public:
+    /**
+     * @brief Parse result of one OBJ chunk
+     */
+    struct ObjChunk {
+        std::vector<float> vertices;     // "v" lines
+        MeshData::CellArray lines;       // "l" lines
+        MeshData::CellArray faces;       // "f" lines with at least 3 vertices
+        std::string error;               // First parse error of the chunk (empty if none)
+    };
+
+    /**
+     * @brief Parse result of one chunk of a Gmsh element section
+     */
+    struct GmshElementChunk {
+        BasicCellArray<uint64_t> cells;      // Connectivity holds Gmsh node tags until they are resolved
+        std::vector<int32_t> physicalTags;   // Physical group of each element (0 = none)
+        std::vector<int32_t> entityTags;     // Elementary entity of each element
+        std::string error;                   // First parse error of the chunk (empty if none)
+    };
+
+    /**
+     * @brief Parse the "v", "f" and "l" lines of an OBJ text chunk
+     * OBJ indices are absolute, so chunks need no index fix-up when they are concatenated.
+     * @param chunkText Line-aligned part of the file
+     * @param[out] chunk Parse result
+     */
+    static void parseOBJChunk(std::string_view chunkText, ObjChunk& chunk);
+
+    /**
+     * @brief Parse the element lines of an SU2 NELEM section
+     * Lines with an unknown element type are skipped; the trailing element index is dropped.
+     * @param blockText Line-aligned part of the section
+     * @param[out] cells Parsed cells (32- or 64-bit indices)
+     */
+    template<typename Index>
+    static void parseSU2Elements(std::string_view blockText, BasicCellArray<Index>& cells);
+
+    /**
+     * @brief Parse the point lines of an SU2 NPOIN section
+     * Lines without the expected coordinates and point index are skipped.
+     * @param blockText Line-aligned part of the section
+     * @param ndime Mesh dimension (2 or 3)
+     * @param[out] points Parsed xyz coordinates (z = 0 for 2D meshes), parsed directly in the
+     *             target precision (float or double)
+     */
+    template<typename Real>
+    static void parseSU2Points(std::string_view blockText, int ndime, std::vector<Real>& points);
+
+    /**
+     * @brief Parse the "tag x y z" lines of an MSH 2.2 $Nodes section
+     * @param blockText Line-aligned part of the section
+     * @param[out] tags Node tags in file order
+     * @param[out] points Parsed xyz coordinates (float or double)
+     */
+    template<typename Real>
+    static void parseGmshNodes(std::string_view blockText, std::vector<uint64_t>& tags, std::vector<Real>& points);
+
+    /**
+     * @brief Parse the tag lines of an MSH 4.1 node block
+     * @param blockText Line-aligned part of the block
+     * @param[out] values Node tags
+     */
+    static void parseGmshNodeTags(std::string_view blockText, std::vector<uint64_t>& values);
+
+    /**
+     * @brief Parse the "x y z [u v w]" lines of an MSH 4.1 node block
+     * @param blockText Line-aligned part of the block
+     * @param[out] values xyz coordinates (parametric coordinates are dropped)
+     */
+    template<typename Real>
+    static void parseGmshCoordinates(std::string_view blockText, std::vector<Real>& values);
+
+    /**
+     * @brief Parse the "id type ntags tags... nodes..." lines of an MSH 2.2 $Elements section
+     * Lines with an unknown element type are skipped; higher-order elements keep their corners.
+     * @param blockText Line-aligned part of the section
+     * @param[out] chunk Parse result
+     */
+    static void parseGmshElements(std::string_view blockText, GmshElementChunk& chunk);
+
+    /**
+     * @brief Parse the "id nodes..." lines of an MSH 4.1 element block
+     * @param blockText Line-aligned part of the block
+     * @param gmshType Element type of the block (must be known to gmshElementInfo)
+     * @param entityTag Entity the block belongs to
+     * @param physicalTag Physical group of the entity (0 = none)
+     * @param[out] chunk Parse result
+     */
+    static void parseGmshElementBlock(std::string_view blockText, int gmshType, int entityTag, int physicalTag,
+                                      GmshElementChunk& chunk);
+};
@@ -1,9 +1,16 @@
 #pragma once
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <initializer_list>
+#include <type_traits>
+#include <variant>
 
 /**
  * @brief Mesh data type (volume/surface)
@@ -33,13 +40,16 @@ enum class MeshFormat {
     OBJ = 10,          // OBJ (.obj)
     PLY_ASCII = 11,    // PLY ASCII (.ply)
     PLY_BINARY = 12,   // PLY Binary (.ply)
-    OFF = 13           // OFF (.off)
+    OFF = 13,          // OFF (.off)
+    // Native formats
+    MESH_CACHE = 14    // Binary mesh cache (.mcb)
 };
 
 /**
  * @brief VTK cell type (mapping VTK native definition)
+ * @note Stored as one byte so that cell type arrays share layout with vtkUnsignedCharArray
  */
-enum class VtkCellType {
+enum class VtkCellType : uint8_t {
     VERTEX = 1,
     LINE = 3,
     TRIANGLE = 5,
@@ -53,6 +63,24 @@ enum class VtkCellType {
     POLYGON = 7
 };
 
+/**
+ * @brief Space-filling curve used to reorder points and cells for memory locality
+ */
+enum class MeshReorder {
+    NONE = 0,     // Keep the source order
+    MORTON = 1,   // Z-order curve (interleaved coordinate bits)
+    HILBERT = 2   // Hilbert curve (no long jumps between consecutive entries)
+};
+
+/**
+ * @brief Block codec of compressed VTK XML output (the reader is told by the file's compressor attribute)
+ */
+enum class VtkCompressor {
+    ZLIB = 0,  // vtkZLibDataCompressor (readable by every VTK version)
+    LZ4 = 1,   // vtkLZ4DataCompressor (fastest, VTK 8.1+)
+    LZMA = 2   // vtkLZMADataCompressor (smallest, VTK 8.1+)
+};
+
 /**
  * @brief Error code definition
  */
@@ -65,7 +93,8 @@ enum class MeshErrorCode {
     MESH_EMPTY = 5,             // Mesh data is empty
     PARAM_INVALID = 6,          // Invalid parameter
     DEPENDENCY_MISSING = 7,     // Dependency library missing (e.g. CGNS API not loaded)
-    FORMAT_VERSION_INVALID = 8  // Format version incompatible (e.g. Gmsh v1 format)
+    FORMAT_VERSION_INVALID = 8, // Format version incompatible (e.g. Gmsh v1 format)
+    CANCELLED = 9               // Asynchronous job cancelled before it finished
 };
 
 /**
@@ -77,11 +106,36 @@ struct MeshMetadata {
     MeshFormat format = MeshFormat::UNKNOWN; // Source format
     uint64_t pointCount = 0;             // Point count
     uint64_t cellCount = 0;             // Cell count
+    bool pointCountKnown = false;        // Whether pointCount is valid (false when a header scan cannot tell)
+    bool cellCountKnown = false;         // Whether cellCount is valid (false when a header scan cannot tell)
     std::unordered_map<VtkCellType, uint64_t> cellTypeCount; // Count of each cell type
     std::vector<std::string> physicalRegions; // Physical region names (e.g. CFD boundary conditions)
+    std::vector<int> physicalRegionTags;      // Numeric tag of each physical region (Gmsh physical group; empty if unknown)
+    std::vector<std::string> physicalRegionTypes; // Boundary type of each physical region (OpenFOAM patch type; empty if unknown)
     std::vector<std::string> pointDataNames;  // Point attribute names (e.g. pressure, velocity)
     std::vector<std::string> cellDataNames;   // Cell attribute names (e.g. Jacobian, skewness)
     std::string formatVersion;           // Format version (e.g. VTK 4.2, Gmsh 4.1)
+    std::string blockName;               // Name of the source block (e.g. CGNS zone; empty if unnamed)
+    uint64_t sourceBytes = 0;            // Bytes parsed by the reader (0 if not measured)
+    double readThroughputMBps = 0.0;     // Reader parse throughput in MB/s (0 if not measured)
+};
+
+/**
+ * @brief Format read options (format-specific configurations)
+ */
+struct FormatReadOptions {
+    // STL-specific options
+    bool stlWeldVertices = false;        // Merge bit-identical facet corners into shared points (indexed mesh)
+    // Text reader options
+    unsigned int readThreads = 0;        // Worker threads for chunk-parallel OBJ/SU2/Gmsh parsing, CGNS zones and OpenFOAM processors/cells (0 = hardware concurrency, 1 = serial)
+    // CGNS-specific options
+    int cgnsBase = 0;                    // CGNS Base index (0-based)
+    std::vector<int> cgnsZones;          // CGNS Zone indices to read (0-based, empty = every zone of the base)
+    // OpenFOAM-specific options
+    bool openFoamPatches = true;         // Add boundary patch faces as polygon cells (cell data "foam:patch")
+    // Common options
+    bool weldPoints = false;             // Merge coincident points of any format after reading (MeshProcessor::weldPoints)
+    float weldTolerance = 0.0f;          // Absolute weld distance (0 = identical positions only)
 };
 
 /**
@@ -91,9 +145,13 @@ struct FormatWriteOptions {
     // Common options
     bool isBinary = true;                // Whether to use binary storage (default true, prioritize performance)
     int precision = 6;                   // Floating point precision (valid for ASCII format)
-    bool compress = false;               // Whether to compress (only supported by VTK XML/CGNS)
+    bool compress = false;               // Whether to compress (only supported by VTK XML/CGNS/mesh cache)
+    unsigned int formatThreads = 1;      // Threads formatting ASCII point/element sections (0 = hardware concurrency, 1 = serial)
+    MeshReorder reorder = MeshReorder::NONE; // Sort points and cells along a space-filling curve before writing
     // VTK-specific options
     bool vtkPreserveAllAttributes = true; // Whether to preserve all attribute data
+    VtkCompressor vtkCompressor = VtkCompressor::ZLIB; // Codec of compressed VTK XML blocks (with compress)
+    uint32_t vtkBlockSize = 1024 * 1024;  // Uncompressed bytes per VTK XML compression block (rounded up to 8)
     // CGNS-specific options
     std::string cgnsBaseName = "Base1";  // CGNS Base name
     std::string cgnsZoneName = "Zone1";  // CGNS Zone name
@@ -105,25 +163,233 @@ struct FormatWriteOptions {
 };
 
 /**
- * @brief Mesh core data (geometry + topology + attributes)
+ * @brief Element type of a mesh attribute (native precision of the source array)
  */
-class MeshData {
+enum class AttributeType : uint8_t {
+    INT32 = 0,    // 32-bit signed integers (region ids, flags)
+    INT64 = 1,    // 64-bit signed integers (global ids)
+    FLOAT32 = 2,  // Single precision
+    FLOAT64 = 3   // Double precision
+};
+
+/**
+ * @brief Typed attribute array: one contiguous buffer of tupleCount * components values
+ *
+ * Values are tuple-interleaved (tuple i occupies [i*components, (i+1)*components)) and kept in
+ * the precision of the source array, so ids and double fields survive a conversion unchanged.
+ * A std::vector<T> (T = int32_t, int64_t, float, double) or a braced float list converts
+ * implicitly into a single-component attribute; such flat lists may still hold several values
+ * per tuple, which componentsFor() infers from the length.
+ */
+class MeshAttribute {
 public:
-    // Geometry data: point coordinates (x,y,z), stored contiguously
-    std::vector<float> points; // Length = pointCount*3, index: i*3=x, i*3+1=y, i*3+2=z
-    
-    // Topology data: cell connectivity
+    using Storage = std::variant<std::vector<int32_t>, std::vector<int64_t>, std::vector<float>, std::vector<double>>;
+
+    MeshAttribute() = default;
+    MeshAttribute(AttributeType type, int components, size_t tupleCount = 0);
+    template<typename T>
+    MeshAttribute(std::vector<T> values, int components = 1) : storage_(std::move(values)), components_(components) {}
+    MeshAttribute(std::initializer_list<float> values) : storage_(std::vector<float>(values)) {}
+
+    // Layout
+    AttributeType type() const { return static_cast<AttributeType>(storage_.index()); }
+    int components() const { return components_; }
+    void setComponents(int components) { components_ = components > 0 ? components : 1; }
+    size_t size() const;                  // Number of scalar values
+    size_t tupleCount() const { return size() / static_cast<size_t>(components_); }
+    bool empty() const { return size() == 0; }
+    size_t elementSize() const;           // Bytes per scalar value
+    int componentsFor(size_t tuples) const; // Tuple width for a tuple count (0 = length does not fit)
+
+    // Raw and typed access
+    void* data();
+    const void* data() const;
+    template<typename T> bool holds() const { return std::holds_alternative<std::vector<T>>(storage_); }
+    template<typename T> std::vector<T>& values() { return std::get<std::vector<T>>(storage_); }
+    template<typename T> const std::vector<T>& values() const { return std::get<std::vector<T>>(storage_); }
+    template<typename Fn> decltype(auto) visit(Fn&& fn) { return std::visit(std::forward<Fn>(fn), storage_); }
+    template<typename Fn> decltype(auto) visit(Fn&& fn) const { return std::visit(std::forward<Fn>(fn), storage_); }
+
+    // Converting access (integers are rounded on store)
+    double value(size_t index) const;
+    void setValue(size_t index, double value);
+    std::vector<float> toFloat() const;
+
+    // Editing
+    void resize(size_t tuples);
+    void clear();
+
+    bool operator==(const MeshAttribute& other) const {
+        return components_ == other.components_ && storage_ == other.storage_;
+    }
+    bool operator!=(const MeshAttribute& other) const { return !(*this == other); }
+
+private:
+    Storage storage_{std::vector<float>()};
+    int components_ = 1;
+};
+
+/**
+ * @brief Convert a double to an attribute element type (integers are rounded to nearest)
+ * @param value Source value
+ * @return Converted value
+ */
+template<typename T>
+T attributeCast(double value) {
+    if constexpr (std::is_integral_v<T>) {
+        return static_cast<T>(value < 0.0 ? value - 0.5 : value + 0.5);
+    } else {
+        return static_cast<T>(value);
+    }
+}
+
+// Named attribute arrays of a mesh
+using AttributeMap = std::unordered_map<std::string, MeshAttribute>;
+
+/**
+ * @brief Cell connectivity in compressed sparse row (CSR) layout
+ *
+ * Same layout as vtkCellArray: cell i uses connectivity[offsets[i] .. offsets[i+1]).
+ * Invariant: offsets.size() == types.size() + 1 and offsets.front() == 0.
+ * push_back()/operator[]/iteration mimic std::vector<Cell> so existing code keeps working
+ * while hot paths read the flat arrays directly.
+ * @tparam Index Point index and offset type (uint32_t or uint64_t)
+ */
+template<typename Index>
+class BasicCellArray {
+public:
+    using IndexType = Index;
+
+    // Topology data: single cell (legacy per-cell form, used by the CellArray adapter)
     struct Cell {
         VtkCellType type;      // Cell type
-        std::vector<uint32_t> pointIndices; // Point indices contained in the cell (starting from 0)
+        std::vector<Index> pointIndices; // Point indices contained in the cell (starting from 0)
+    };
+
+    /**
+     * @brief Read-only view of the point indices of one cell (does not own data)
+     */
+    struct PointIndexView {
+        const Index* ptr = nullptr; // First point index of the cell
+        size_t count = 0;           // Number of point indices
+
+        const Index* begin() const { return ptr; }
+        const Index* end() const { return ptr + count; }
+        const Index* data() const { return ptr; }
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+        Index operator[](size_t i) const { return ptr[i]; }
+    };
+
+    /**
+     * @brief Read-only view of one cell stored in CellArray
+     */
+    struct CellView {
+        VtkCellType type;              // Cell type
+        PointIndexView pointIndices;   // Point indices contained in the cell
+
+        Cell toCell() const { return Cell{type, std::vector<Index>(pointIndices.begin(), pointIndices.end())}; }
     };
-    std::vector<Cell> cells;   // All cells
+
+    std::vector<VtkCellType> types;  // Cell type of each cell, length = cellCount
+    std::vector<Index> offsets{0};   // Start of each cell in connectivity, length = cellCount+1
+    std::vector<Index> connectivity; // Point indices of all cells, stored contiguously
+
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = CellView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = CellView;
+
+        const_iterator() = default;
+        const_iterator(const BasicCellArray* array, size_t index) : array_(array), index_(index) {}
+
+        CellView operator*() const { return (*array_)[index_]; }
+        CellView operator[](difference_type n) const { return (*array_)[index_ + n]; }
+        const_iterator& operator++() { ++index_; return *this; }
+        const_iterator operator++(int) { const_iterator tmp = *this; ++index_; return tmp; }
+        const_iterator& operator--() { --index_; return *this; }
+        const_iterator operator--(int) { const_iterator tmp = *this; --index_; return tmp; }
+        const_iterator& operator+=(difference_type n) { index_ += n; return *this; }
+        const_iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+        const_iterator operator+(difference_type n) const { return const_iterator(array_, index_ + n); }
+        const_iterator operator-(difference_type n) const { return const_iterator(array_, index_ - n); }
+        difference_type operator-(const const_iterator& other) const {
+            return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+        }
+        bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const const_iterator& other) const { return index_ != other.index_; }
+        bool operator<(const const_iterator& other) const { return index_ < other.index_; }
+
+    private:
+        const BasicCellArray* array_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    // Size and capacity
+    size_t size() const { return types.size(); }
+    bool empty() const { return types.empty(); }
+    size_t connectivitySize() const { return connectivity.size(); }
+    void clear();
+    void reserve(size_t cellCount, size_t connectivityCount = 0);
+
+    // Element access
+    CellView operator[](size_t i) const {
+        return CellView{types[i], PointIndexView{connectivity.data() + offsets[i], cellSize(i)}};
+    }
+    size_t cellSize(size_t i) const { return static_cast<size_t>(offsets[i + 1] - offsets[i]); }
+    const Index* cellPoints(size_t i) const { return connectivity.data() + offsets[i]; }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size()); }
+
+    // Appending cells
+    void addCell(VtkCellType type, const Index* pointIndices, size_t count);
+    void addCell(VtkCellType type, std::initializer_list<Index> pointIndices) {
+        addCell(type, pointIndices.begin(), pointIndices.size());
+    }
+    void addCell(VtkCellType type, const std::vector<Index>& pointIndices) {
+        addCell(type, pointIndices.data(), pointIndices.size());
+    }
+    void push_back(const Cell& cell) { addCell(cell.type, cell.pointIndices); }
+    void append(const BasicCellArray& other, Index pointOffset = 0);
+
+    // Conversion from/to the legacy per-cell form
+    void assign(const std::vector<Cell>& cells);
+    std::vector<Cell> toCells() const;
+};
+
+/**
+ * @brief Mesh core data (geometry + topology + attributes)
+ *
+ * Coordinate and index widths are template parameters so that every reader, writer and
+ * kernel is compiled for one layout with no per-element branching. MeshData (float xyz,
+ * 32-bit indices) is the default compact layout; MeshData64 (double xyz, 64-bit indices)
+ * keeps full coordinate precision and addresses more than 4G point references.
+ * @tparam Real Coordinate type (float or double)
+ * @tparam Index Point index and offset type (uint32_t or uint64_t)
+ */
+template<typename Real, typename Index>
+class BasicMeshData {
+public:
+    using RealType = Real;
+    using IndexType = Index;
+    using CellArray = BasicCellArray<Index>;
+    using Cell = typename CellArray::Cell;
+    using PointIndexView = typename CellArray::PointIndexView;
+    using CellView = typename CellArray::CellView;
+
+    // Geometry data: point coordinates (x,y,z), stored contiguously
+    std::vector<Real> points; // Length = pointCount*3, index: i*3=x, i*3+1=y, i*3+2=z
+
+    CellArray cells;           // All cells
     
-    // Attribute data: point attributes (name->value list)
-    std::unordered_map<std::string, std::vector<float>> pointData;
+    // Attribute data: point attributes (name->typed array, one tuple per point)
+    AttributeMap pointData;
     
-    // Attribute data: cell attributes (name->value list)
-    std::unordered_map<std::string, std::vector<float>> cellData;
+    // Attribute data: cell attributes (name->typed array, one tuple per cell)
+    AttributeMap cellData;
     
     // Metadata
     MeshMetadata metadata;
@@ -133,3 +399,41 @@ public:
     bool isEmpty() const;                  // Check if empty
     void calculateMetadata();              // Calculate metadata from geometry/topology data
 };
+
+// Compact default layout: float coordinates, 32-bit indices
+using MeshData = BasicMeshData<float, uint32_t>;
+
+// Precision layout: double coordinates, 64-bit indices
+using MeshData64 = BasicMeshData<double, uint64_t>;
+
+// Both layouts are instantiated once in MeshTypes.cpp
+extern template class BasicCellArray<uint32_t>;
+extern template class BasicCellArray<uint64_t>;
+extern template class BasicMeshData<float, uint32_t>;
+extern template class BasicMeshData<double, uint64_t>;
+
+/**
+ * @brief Convert a mesh between coordinate/index layouts (attributes and metadata are copied)
+ * @param source Source mesh
+ * @param[out] target Output mesh
+ * @return Whether every point index and offset fits the target index type
+ */
+template<typename TargetReal, typename TargetIndex, typename SourceReal, typename SourceIndex>
+bool convertMeshData(const BasicMeshData<SourceReal, SourceIndex>& source, BasicMeshData<TargetReal, TargetIndex>& target) {
+    if constexpr (sizeof(TargetIndex) < sizeof(SourceIndex)) {
+        const SourceIndex limit = static_cast<SourceIndex>(std::numeric_limits<TargetIndex>::max());
+        const std::vector<SourceIndex>& connectivity = source.cells.connectivity;
+        if (source.cells.offsets.back() > limit || source.points.size() / 3 > static_cast<size_t>(limit)
+            || std::any_of(connectivity.begin(), connectivity.end(), [limit](SourceIndex id) { return id > limit; })) {
+            return false;
+        }
+    }
+    target.points.assign(source.points.begin(), source.points.end());
+    target.cells.types = source.cells.types;
+    target.cells.offsets.assign(source.cells.offsets.begin(), source.cells.offsets.end());
+    target.cells.connectivity.assign(source.cells.connectivity.begin(), source.cells.connectivity.end());
+    target.pointData = source.pointData;
+    target.cellData = source.cellData;
+    target.metadata = source.metadata;
+    return true;
+}
@@ -28,6 +28,25 @@ public:
                       MeshErrorCode& errorCode,
                       std::string& errorMsg);
 
+    /**
+     * @brief Write double-precision / 64-bit index mesh data to specified format file
+     * SU2, Gmsh and CGNS are written at full precision. Other formats, and reordering, go through the compact
+     * layout: coordinates are rounded to float and indices must fit in 32 bits.
+     * @param meshData Input mesh data
+     * @param filePath Output file path (UTF-8 encoded)
+     * @param targetFormat Target format
+     * @param options Write options (format-specific configurations)
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @return Whether writing is successful
+     */
+    static bool write(const MeshData64& meshData,
+                      const std::string& filePath,
+                      MeshFormat targetFormat,
+                      const FormatWriteOptions& options,
+                      MeshErrorCode& errorCode,
+                      std::string& errorMsg);
+
     /**
      * @brief Write VTK format file (automatically distinguish Legacy/XML)
      * @param meshData Input mesh data
@@ -46,7 +65,29 @@ public:
                          std::string& errorMsg);
 
     /**
-     * @brief Write CGNS format file
+     * @brief Write VTK XML file (.vtu unstructured grid, .vtp poly data) with raw appended data
+     * Arrays stream from the mesh into one appended binary section. With compress they are split
+     * into blocks of vtkBlockSize bytes compressed with vtkCompressor on formatThreads threads.
+     * Poly data holds vertices, lines, polygons and strips only.
+     * @param meshData Input mesh data (Float32/Float64 points, UInt32/UInt64 connectivity)
+     * @param filePath Output file path (UTF-8 encoded)
+     * @param options Write options (compress, vtkCompressor, vtkBlockSize, formatThreads, vtkPreserveAllAttributes)
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message
+     * @return Whether writing is successful
+     */
+    template<typename Real, typename Index>
+    static bool writeVTKXML(const BasicMeshData<Real, Index>& meshData,
+                            const std::string& filePath,
+                            const FormatWriteOptions& options,
+                            MeshErrorCode& errorCode,
+                            std::string& errorMsg);
+
+    /**
+     * @brief Write CGNS format file (one unstructured zone in an HDF5 file)
+     * One section per cell type, cells of the base dimension first; point and cell data become
+     * Vertex/CellCenter FlowSolution fields (3-component data as <name>X/Y/Z). With compress the
+     * datasets are stored chunked and deflate-compressed. Triangle strips are skipped.
      * @param meshData Input mesh data
      * @param filePath Output file path (UTF-8 encoded)
      * @param options Write options (need to specify cgnsBaseName/cgnsZoneName etc.)
@@ -54,23 +95,48 @@ public:
      * @param[out] errorMsg Output error message
      * @return Whether writing is successful
      */
-    static bool writeCGNS(const MeshData& meshData,
+    template<typename Real, typename Index>
+    static bool writeCGNS(const BasicMeshData<Real, Index>& meshData,
                           const std::string& filePath,
                           const FormatWriteOptions& options,
                           MeshErrorCode& errorCode,
                           std::string& errorMsg);
 
     /**
-     * @brief Write Gmsh format file
+     * @brief Write several meshes as the zones of one CGNS base (HDF5 file)
+     * Zones are converted in parallel (formatThreads) and written in order.
+     * @param zones Zone meshes (metadata.blockName names the zone; cgnsZoneName_<n> if empty)
+     * @param filePath Output file path (UTF-8 encoded)
+     * @param options Write options (cgnsBaseName, cgnsZoneName, cgnsDimension, compress, formatThreads)
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message
+     * @return Whether writing is successful
+     */
+    template<typename Real, typename Index>
+    static bool writeCGNSZones(const std::vector<BasicMeshData<Real, Index>>& zones,
+                               const std::string& filePath,
+                               const FormatWriteOptions& options,
+                               MeshErrorCode& errorCode,
+                               std::string& errorMsg);
+
+    /**
+     * @brief Write Gmsh format file (MSH 2.2 or 4.1, ASCII or binary by options.isBinary)
+     * Native writer, safe to run on several threads. Cells are grouped by entity and element
+     * type; with gmshPreservePhysicalGroups the "gmsh:physical"/"gmsh:geometrical" cell data
+     * and metadata.physicalRegions of a Gmsh read are written back. Polygons and triangle
+     * strips have no Gmsh element type and are skipped.
      * @param meshData Input mesh data
      * @param filePath Output file path (UTF-8 encoded)
+     * @param isVersion4 Whether to write MSH 4.1 (false = MSH 2.2)
      * @param options Write options
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message
      * @return Whether writing is successful
      */
-    static bool writeGmsh(const MeshData& meshData,
+    template<typename Real, typename Index>
+    static bool writeGmsh(const BasicMeshData<Real, Index>& meshData,
                           const std::string& filePath,
+                          bool isVersion4,
                           const FormatWriteOptions& options,
                           MeshErrorCode& errorCode,
                           std::string& errorMsg);
@@ -144,26 +210,51 @@ public:
      * @param[out] errorMsg Output error message
      * @return Whether writing is successful
      */
-    static bool writeSU2(const MeshData& meshData,
+    template<typename Real, typename Index>
+    static bool writeSU2(const BasicMeshData<Real, Index>& meshData,
                         const std::string& filePath,
                         const FormatWriteOptions& options,
                         MeshErrorCode& errorCode,
                         std::string& errorMsg);
 
     /**
-     * @brief Write OpenFOAM format file
+     * @brief Write OpenFOAM polyMesh (points, faces, owner, neighbour, boundary)
+     * Faces are derived from the tetrahedra, hexahedra, wedges and pyramids: shared faces become
+     * internal faces in upper-triangular order (owner < neighbour), the rest boundary faces.
+     * Triangles/quads tagged by cell data "foam:patch" (or "gmsh:physical") name the patches
+     * (metadata.physicalRegions/physicalRegionTypes); uncovered boundary faces go to
+     * "defaultFaces". The five files are written concurrently; with isBinary the lists are
+     * binary (faces as faceCompactList), labels are 64-bit only when the counts need it.
+     * @param meshData Input mesh data
+     * @param filePath Case, constant or polyMesh directory (UTF-8 encoded, created if missing)
+     * @param options Write options (isBinary, precision, formatThreads)
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message
+     * @return Whether writing is successful
+     */
+    template<typename Real, typename Index>
+    static bool writeOpenFOAM(const BasicMeshData<Real, Index>& meshData,
+                              const std::string& filePath,
+                              const FormatWriteOptions& options,
+                              MeshErrorCode& errorCode,
+                              std::string& errorMsg);
+
+    /**
+     * @brief Write native binary mesh cache file (.mcb, see MeshCache)
+     * Arrays are stored in the layout of meshData, so MeshData64 keeps full precision.
      * @param meshData Input mesh data
      * @param filePath Output file path (UTF-8 encoded)
-     * @param options Write options
+     * @param options Write options (compress = LZ4 sections, formatThreads = compression threads)
      * @param[out] errorCode Output error code
      * @param[out] errorMsg Output error message
      * @return Whether writing is successful
      */
-    static bool writeOpenFOAM(const MeshData& meshData,
-                             const std::string& filePath,
-                             const FormatWriteOptions& options,
-                             MeshErrorCode& errorCode,
-                             std::string& errorMsg);
+    template<typename Real, typename Index>
+    static bool writeMeshCache(const BasicMeshData<Real, Index>& meshData,
+                               const std::string& filePath,
+                               const FormatWriteOptions& options,
+                               MeshErrorCode& errorCode,
+                               std::string& errorMsg);
 
     // --------------------------------------------------------------------------
     // VTK intermediate format related methods
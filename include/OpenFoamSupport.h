@@ -0,0 +1,77 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+
+/**
+ * @brief Check whether a directory holds a polyMesh (owner file, plain or gzip-compressed)
+ * @param meshDirectory polyMesh directory
+ * @return Whether the owner file exists
+ */
+inline bool openFoamHasMesh(const std::filesystem::path& meshDirectory) {
+    std::error_code ec;
+    return std::filesystem::exists(meshDirectory / "owner", ec) || std::filesystem::exists(meshDirectory / "owner.gz", ec);
+}
+
+/**
+ * @brief polyMesh directory of an OpenFOAM case
+ * Accepts the case directory (mesh in constant/polyMesh), the constant directory or the
+ * polyMesh directory itself. The result need not exist (writers create it).
+ * @param casePath Case, constant or polyMesh directory (UTF-8 encoded)
+ * @return polyMesh directory
+ */
+inline std::filesystem::path openFoamMeshDirectory(const std::string& casePath) {
+    const std::filesystem::path path = std::filesystem::u8path(casePath);
+    std::error_code ec;
+    if (path.filename() == "polyMesh" || openFoamHasMesh(path)) {
+        return path;
+    }
+    if (path.filename() == "constant" || std::filesystem::is_directory(path / "polyMesh", ec)) {
+        return path / "polyMesh";
+    }
+    return path / "constant" / "polyMesh";
+}
+
+/**
+ * @brief polyMesh directories of a decomposed case (processor0, processor1, ... in rank order)
+ * @param casePath Case directory (UTF-8 encoded)
+ * @return polyMesh directory of every processorN subdirectory (empty if the case is not decomposed)
+ */
+inline std::vector<std::filesystem::path> openFoamProcessorDirectories(const std::string& casePath) {
+    std::vector<std::pair<long, std::filesystem::path>> ranks;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(std::filesystem::u8path(casePath), ec)) {
+        const std::string name = entry.path().filename().string();
+        if (!entry.is_directory(ec) || name.size() <= 9 || name.compare(0, 9, "processor") != 0
+            || name.find_first_not_of("0123456789", 9) != std::string::npos) {
+            continue;
+        }
+        const std::filesystem::path polyMesh = entry.path() / "constant" / "polyMesh";
+        if (openFoamHasMesh(polyMesh)) {
+            ranks.emplace_back(std::strtol(name.c_str() + 9, nullptr, 10), polyMesh);
+        }
+    }
+    std::sort(ranks.begin(), ranks.end());
+    std::vector<std::filesystem::path> directories;
+    for (auto& rank : ranks) {
+        directories.push_back(std::move(rank.second));
+    }
+    return directories;
+}
+
+/**
+ * @brief Check whether a path is an OpenFOAM case (reconstructed polyMesh or processor* directories)
+ * @param casePath Case, constant or polyMesh directory (UTF-8 encoded)
+ * @return Whether a polyMesh can be read from the path
+ */
+inline bool isOpenFoamCase(const std::string& casePath) {
+    std::error_code ec;
+    if (!std::filesystem::is_directory(std::filesystem::u8path(casePath), ec)) {
+        return false;
+    }
+    return openFoamHasMesh(openFoamMeshDirectory(casePath)) || !openFoamProcessorDirectories(casePath).empty();
+}
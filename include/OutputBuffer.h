@@ -0,0 +1,242 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <vector>
+#include "ParallelFor.h"
+
+/**
+ * @brief Write-behind buffer for mesh writers: text and binary records are formatted into a
+ * large in-memory block that is handed to the OS with a single write once it fills up
+ *
+ * Numbers are formatted with std::to_chars (locale independent, no stream state), floats in
+ * "%g" style (significant digits) or "%f" style (decimals, same as std::fixed). Payloads larger
+ * than half the buffer (e.g. a binary point array) are written straight from the caller's
+ * memory without being copied.
+ *
+ * A buffer that was never opened is an in-memory text block: it grows instead of flushing,
+ * and pending() returns everything appended so far. These blocks let appendFormatted() format
+ * chunks of a section on several threads.
+ */
+class OutputBuffer {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 4 * 1024 * 1024; // Bytes buffered per write
+
+    /**
+     * @brief Constructor
+     * @param capacity Buffer size in bytes
+     */
+    explicit OutputBuffer(size_t capacity = DEFAULT_CAPACITY);
+    ~OutputBuffer();
+
+    OutputBuffer(const OutputBuffer&) = delete;
+    OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+    /**
+     * @brief Create (truncate) the output file
+     * @param filePath File path (UTF-8 encoded)
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @return Whether the file was opened
+     */
+    bool open(const std::string& filePath, std::string& errorMsg);
+
+    /**
+     * @brief Flush the buffer and close the file
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @return Whether every byte reached the file
+     */
+    bool close(std::string& errorMsg);
+
+    /**
+     * @brief Hand the buffered bytes to the OS
+     * @return Whether writing is successful
+     */
+    bool flush();
+
+    /**
+     * @brief Overwrite bytes appended earlier (e.g. a size header written before its payload)
+     * @param offset Position of the first byte (from the start of the output)
+     * @param data Replacement bytes
+     * @param size Number of bytes (the range must already have been appended)
+     * @return Whether writing is successful
+     */
+    bool patch(uint64_t offset, const void* data, size_t size);
+
+    bool failed() const { return failed_; }                  // Whether a write failed
+    uint64_t bytesWritten() const { return flushed_ + used_; } // Bytes appended so far
+    std::string_view pending() const { return std::string_view(buffer_.data(), used_); } // Bytes not yet flushed
+    void clear() { used_ = 0; }                                // Drop pending bytes (in-memory blocks)
+
+    /**
+     * @brief Append raw bytes
+     * @param data Bytes to append
+     * @param size Number of bytes
+     */
+    void append(const void* data, size_t size) {
+        if (size > buffer_.size() / 2) {
+            appendLarge(data, size);
+            return;
+        }
+        reserve(size);
+        std::memcpy(buffer_.data() + used_, data, size);
+        used_ += size;
+    }
+
+    void append(std::string_view text) { append(text.data(), text.size()); }
+
+    void append(char ch) {
+        reserve(1);
+        buffer_[used_++] = ch;
+    }
+
+    /**
+     * @brief Append the in-memory representation of a trivially copyable value (binary formats)
+     * @param value Value to append
+     */
+    template<typename T>
+    void appendBinary(const T& value) {
+        append(&value, sizeof(T));
+    }
+
+    /**
+     * @brief Append an integer in decimal
+     * @param value Integer value
+     */
+    template<typename T>
+    void appendInt(T value) {
+        reserve(MAX_NUMBER_CHARS);
+        const auto result = std::to_chars(buffer_.data() + used_, buffer_.data() + buffer_.size(), value);
+        used_ = static_cast<size_t>(result.ptr - buffer_.data());
+    }
+
+    /**
+     * @brief Append a float with a number of significant digits ("%g" style)
+     * @param value Float value
+     * @param precision Significant digits (clamped to 1..9, enough to round-trip a float)
+     */
+    void appendFloat(float value, int precision) {
+        reserve(MAX_NUMBER_CHARS);
+        const int digits = precision < 1 ? 1 : (precision > 9 ? 9 : precision);
+        const auto result = std::to_chars(buffer_.data() + used_, buffer_.data() + buffer_.size(),
+                                          value, std::chars_format::general, digits);
+        used_ = static_cast<size_t>(result.ptr - buffer_.data());
+    }
+
+    /**
+     * @brief Append a double with a number of significant digits ("%g" style)
+     * @param value Double value
+     * @param precision Significant digits (clamped to 1..17, enough to round-trip a double)
+     */
+    void appendFloat(double value, int precision) {
+        reserve(MAX_NUMBER_CHARS);
+        const int digits = precision < 1 ? 1 : (precision > 17 ? 17 : precision);
+        const auto result = std::to_chars(buffer_.data() + used_, buffer_.data() + buffer_.size(),
+                                          value, std::chars_format::general, digits);
+        used_ = static_cast<size_t>(result.ptr - buffer_.data());
+    }
+
+    /**
+     * @brief Append a float with a fixed number of decimals ("%f" style, as std::fixed)
+     * @param value Float value
+     * @param decimals Digits after the decimal point (clamped to 0..MAX_FIXED_DECIMALS)
+     */
+    void appendFixed(float value, int decimals) {
+        reserve(MAX_NUMBER_CHARS);
+        const int digits = decimals < 0 ? 0 : (decimals > MAX_FIXED_DECIMALS ? MAX_FIXED_DECIMALS : decimals);
+        const auto result = std::to_chars(buffer_.data() + used_, buffer_.data() + buffer_.size(),
+                                          value, std::chars_format::fixed, digits);
+        used_ = static_cast<size_t>(result.ptr - buffer_.data());
+    }
+
+    /**
+     * @brief Append a double with a fixed number of decimals ("%f" style, as std::fixed)
+     * @param value Double value
+     * @param decimals Digits after the decimal point (clamped to 0..MAX_FIXED_DECIMALS)
+     */
+    void appendFixed(double value, int decimals) {
+        reserve(MAX_DOUBLE_CHARS);
+        const int digits = decimals < 0 ? 0 : (decimals > MAX_FIXED_DECIMALS ? MAX_FIXED_DECIMALS : decimals);
+        const auto result = std::to_chars(buffer_.data() + used_, buffer_.data() + buffer_.size(),
+                                          value, std::chars_format::fixed, digits);
+        used_ = static_cast<size_t>(result.ptr - buffer_.data());
+    }
+
+private:
+    // Upper bound on formatted number length (fixed-notation float: sign, 39 digits, point, decimals)
+    static constexpr size_t MAX_NUMBER_CHARS = 96;
+    static constexpr int MAX_FIXED_DECIMALS = 48;
+    // Fixed-notation double: sign, 309 digits, point, decimals
+    static constexpr size_t MAX_DOUBLE_CHARS = 384;
+
+    void reserve(size_t size) {
+        if (used_ + size > buffer_.size()) {
+            makeRoom(size);
+        }
+    }
+    void makeRoom(size_t size);
+    void appendLarge(const void* data, size_t size);
+
+    std::vector<char> buffer_; // Pending bytes
+    size_t used_ = 0;          // Bytes pending in buffer_
+    uint64_t flushed_ = 0;     // Bytes already handed to the OS
+    bool failed_ = false;      // Whether a write failed
+    std::ofstream file_;       // Unbuffered output file
+    std::string filePath_;     // Output file path (for error messages)
+};
+
+/**
+ * @brief Format a section of items and append it to a buffer in item order
+ * With more than one task, chunks of itemsPerChunk items are formatted into in-memory blocks on
+ * parallel threads, one round of chunks at a time (memory stays around taskCount blocks), and
+ * each round is appended in order; the result is byte-identical to serial formatting.
+ * Inside a job (JobControl) the items are credited to the current progress step chunk by chunk,
+ * and a cancelled job stops between chunks.
+ * @param out Destination buffer
+ * @param itemCount Number of items (points, elements, ...)
+ * @param itemsPerChunk Items formatted per chunk (smaller sections are formatted serially)
+ * @param threads Formatting threads (0 = hardware concurrency, 1 = serial)
+ * @param format Callable taking (OutputBuffer& sink, size_t begin, size_t end), formatting [begin, end)
+ */
+template<typename FormatFn>
+void appendFormatted(OutputBuffer& out, size_t itemCount, size_t itemsPerChunk, unsigned int threads, FormatFn&& format) {
+    itemsPerChunk = (std::max<size_t>)(1, itemsPerChunk);
+    const size_t taskCount = threads == 1 ? 1 : parallelTaskCount(itemCount, itemsPerChunk, threads);
+    ProgressMeter meter(itemsPerChunk);
+    if (taskCount <= 1) {
+        if (!meter.active()) {
+            format(out, 0, itemCount);
+            return;
+        }
+        for (size_t begin = 0; begin < itemCount; begin += itemsPerChunk) {
+            const size_t end = (std::min)(itemCount, begin + itemsPerChunk);
+            format(out, begin, end);
+            meter.add(end - begin);
+        }
+        return;
+    }
+
+    const size_t chunkCount = (itemCount + itemsPerChunk - 1) / itemsPerChunk;
+    std::vector<std::unique_ptr<OutputBuffer>> blocks(taskCount);
+    for (auto& block : blocks) {
+        block = std::make_unique<OutputBuffer>();
+    }
+    for (size_t firstChunk = 0; firstChunk < chunkCount; firstChunk += taskCount) {
+        const size_t roundChunks = (std::min)(taskCount, chunkCount - firstChunk);
+        runParallel(roundChunks, [&](size_t task) {
+            OutputBuffer& block = *blocks[task];
+            block.clear();
+            const size_t begin = (firstChunk + task) * itemsPerChunk;
+            format(block, begin, (std::min)(itemCount, begin + itemsPerChunk));
+        });
+        for (size_t task = 0; task < roundChunks; ++task) {
+            out.append(blocks[task]->pending());
+        }
+        meter.add((std::min)(itemCount, (firstChunk + roundChunks) * itemsPerChunk) - firstChunk * itemsPerChunk);
+    }
+}
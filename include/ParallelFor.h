@@ -0,0 +1,180 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include "JobControl.h"
+
+/**
+ * @brief Number of tasks a data-parallel loop is split into
+ * @param workItems Number of work items (cells, points, bytes, ...)
+ * @param minItemsPerTask Minimum items per task (smaller loops run serially)
+ * @param threads Requested worker threads (0 = hardware concurrency)
+ * @return Task count (1 = serial)
+ */
+inline size_t parallelTaskCount(size_t workItems, size_t minItemsPerTask, unsigned int threads = 0) {
+    const size_t threadCount = threads ? threads : std::max(1u, std::thread::hardware_concurrency());
+    return std::max<size_t>(1, std::min(threadCount, workItems / std::max<size_t>(1, minItemsPerTask)));
+}
+
+/**
+ * @brief Run task(0..taskCount-1) on separate threads and wait for all of them
+ * The first exception thrown by a task is rethrown on the calling thread.
+ * Threads are spawned per call (no TaskPool workers are occupied), so it suits CPU-bound kernels
+ * that run long enough to amortize thread start-up. The workers inherit the caller's job binding
+ * (JobControl), and every task start is a cancellation checkpoint.
+ * @param taskCount Number of tasks
+ * @param task Task callable taking the task index
+ */
+template<typename TaskFn>
+void runParallel(size_t taskCount, TaskFn&& task) {
+    if (taskCount <= 1) {
+        if (taskCount == 1) {
+            JobControl::checkpoint();
+            task(0);
+        }
+        return;
+    }
+    const JobControl::Context job = JobControl::context();
+    std::vector<std::exception_ptr> errors(taskCount);
+    auto guardedTask = [&task, &errors, &job](size_t index) {
+        try {
+            JobControl::Binding binding(job);
+            JobControl::checkpoint();
+            task(index);
+        } catch (...) {
+            errors[index] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(taskCount - 1);
+    for (size_t i = 1; i < taskCount; ++i) {
+        try {
+            workers.emplace_back(guardedTask, i);
+        } catch (const std::system_error&) {
+            // Out of threads: run the task inline
+            guardedTask(i);
+        }
+    }
+    guardedTask(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+/**
+ * @brief Split [0, itemCount) into taskCount contiguous ranges and run body(begin, end) on each
+ * @param itemCount Number of items
+ * @param taskCount Number of ranges (see parallelTaskCount)
+ * @param body Callable taking (begin, end, taskIndex)
+ */
+template<typename BodyFn>
+void parallelForRanges(size_t itemCount, size_t taskCount, BodyFn&& body) {
+    taskCount = std::max<size_t>(1, std::min(taskCount, std::max<size_t>(1, itemCount)));
+    runParallel(taskCount, [&](size_t task) {
+        body(itemCount * task / taskCount, itemCount * (task + 1) / taskCount, task);
+    });
+}
+
+/**
+ * @brief Sort a random-access range on several threads
+ * Contiguous chunks are sorted in parallel, then merged pairwise in parallel rounds.
+ * The result equals std::sort for strict total orders (ties may be ordered differently).
+ * @param first Start of the range
+ * @param last End of the range
+ * @param less Strict weak ordering
+ * @param taskCount Number of chunks (see parallelTaskCount)
+ */
+template<typename RandomIt, typename Compare>
+void parallelSort(RandomIt first, RandomIt last, Compare less, size_t taskCount) {
+    const size_t itemCount = static_cast<size_t>(last - first);
+    taskCount = std::max<size_t>(1, std::min(taskCount, itemCount));
+    if (taskCount == 1) {
+        std::sort(first, last, less);
+        return;
+    }
+    std::vector<size_t> bounds(taskCount + 1);
+    for (size_t i = 0; i <= taskCount; ++i) {
+        bounds[i] = itemCount * i / taskCount;
+    }
+    runParallel(taskCount, [&](size_t task) {
+        std::sort(first + bounds[task], first + bounds[task + 1], less);
+    });
+    for (size_t width = 1; width < taskCount; width *= 2) {
+        runParallel((taskCount + 2 * width - 1) / (2 * width), [&](size_t merge) {
+            const size_t low = merge * 2 * width;
+            const size_t middle = std::min(low + width, taskCount);
+            const size_t high = std::min(low + 2 * width, taskCount);
+            if (middle < high) {
+                std::inplace_merge(first + bounds[low], first + bounds[middle], first + bounds[high], less);
+            }
+        });
+    }
+}
+
+/**
+ * @brief Stable LSD radix sort of (key, value) pairs on several threads
+ * Each pass counts its 11-bit digit per chunk in parallel, turns the counts into per-chunk
+ * scatter offsets and scatters in parallel; passes whose digit is the same for every key are
+ * skipped. Equal keys keep their input order, so the result does not depend on taskCount.
+ * @param keys Keys (sorted on return)
+ * @param values Values permuted along with the keys (same length as keys)
+ * @param keyBits Number of low key bits that are significant (higher bits must be zero)
+ * @param taskCount Number of chunks (see parallelTaskCount)
+ */
+template<typename Value>
+void parallelRadixSort(std::vector<uint64_t>& keys, std::vector<Value>& values, unsigned int keyBits, size_t taskCount) {
+    constexpr unsigned int DIGIT_BITS = 11;
+    constexpr size_t BUCKETS = size_t(1) << DIGIT_BITS;
+    const size_t itemCount = keys.size();
+    taskCount = std::max<size_t>(1, std::min(taskCount, std::max<size_t>(1, itemCount)));
+    std::vector<uint64_t> keyScratch(itemCount);
+    std::vector<Value> valueScratch(itemCount);
+    std::vector<size_t> counts(taskCount * BUCKETS);
+    for (unsigned int shift = 0; shift < keyBits; shift += DIGIT_BITS) {
+        std::fill(counts.begin(), counts.end(), 0);
+        parallelForRanges(itemCount, taskCount, [&](size_t begin, size_t end, size_t task) {
+            size_t* taskCounts = &counts[task * BUCKETS];
+            for (size_t i = begin; i < end; ++i) {
+                taskCounts[(keys[i] >> shift) & (BUCKETS - 1)]++;
+            }
+        });
+
+        // Bucket-major, chunk-minor prefix sum: chunk t scatters after chunks 0..t-1 in each bucket
+        size_t offset = 0;
+        bool constantDigit = false;
+        for (size_t bucket = 0; bucket < BUCKETS; ++bucket) {
+            size_t bucketTotal = 0;
+            for (size_t task = 0; task < taskCount; ++task) {
+                const size_t count = counts[task * BUCKETS + bucket];
+                counts[task * BUCKETS + bucket] = offset + bucketTotal;
+                bucketTotal += count;
+            }
+            constantDigit = constantDigit || bucketTotal == itemCount;
+            offset += bucketTotal;
+        }
+        if (constantDigit) {
+            continue;
+        }
+
+        parallelForRanges(itemCount, taskCount, [&](size_t begin, size_t end, size_t task) {
+            size_t* taskOffsets = &counts[task * BUCKETS];
+            for (size_t i = begin; i < end; ++i) {
+                const size_t target = taskOffsets[(keys[i] >> shift) & (BUCKETS - 1)]++;
+                keyScratch[target] = keys[i];
+                valueScratch[target] = std::move(values[i]);
+            }
+        });
+        keys.swap(keyScratch);
+        values.swap(valueScratch);
+    }
+}
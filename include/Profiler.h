@@ -0,0 +1,269 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief One instrumentation record delivered to the profile sinks
+ */
+struct ProfileEvent {
+    enum class Type {
+        STAGE,    // Timed stage (ProfileScope)
+        COUNTER,  // Counter sample (Profiler::counter)
+        MESSAGE   // Progress message (Profiler::message)
+    };
+
+    Type type = Type::STAGE;
+    const char* category = "";   // Stage category: "read", "convert", "filter" or "write" (static string)
+    std::string name;            // Stage, counter or message text
+    std::string detail;          // Stage subject, e.g. the file path (may be empty)
+    uint64_t startNs = 0;        // Start time in nanoseconds since the profiler epoch
+    uint64_t durationNs = 0;     // Stage duration in nanoseconds
+    uint32_t threadId = 0;       // Small sequential id of the emitting thread
+    uint64_t bytes = 0;          // Bytes read or written by the stage
+    uint64_t inputCells = 0;     // Cells entering the stage
+    uint64_t cells = 0;          // Cells produced by the stage
+    uint64_t rssBytes = 0;       // Resident set size at the end of the stage
+    uint64_t peakGrowthBytes = 0;// Rise of the process peak resident set during the stage
+    double value = 0.0;          // Counter value
+};
+
+/**
+ * @brief Receiver of profile events
+ * Sinks are called under the profiler lock, one event at a time, from the thread that emitted
+ * the event; they need no locking of their own but should return quickly.
+ */
+class ProfileSink {
+public:
+    virtual ~ProfileSink() = default;
+
+    /**
+     * @brief Handle one event
+     * @param event Stage, counter or message
+     */
+    virtual void onEvent(const ProfileEvent& event) = 0;
+};
+
+/**
+ * @brief Process-wide instrumentation switchboard
+ *
+ * Library stages report through ProfileScope, Profiler::counter and Profiler::message. Nothing
+ * is measured or formatted unless a sink is attached: with no sink every hook costs one call and
+ * one relaxed atomic load. Memory figures are process-wide resident set sizes, so stages running
+ * concurrently see each other's allocations.
+ */
+class Profiler {
+public:
+    /**
+     * @brief Whether any sink is attached (instrumentation hooks return immediately otherwise)
+     * Out of line so the flag stays inside the library (Windows exports functions, not data).
+     */
+    static bool enabled();
+
+    /**
+     * @brief Attach a sink
+     * @param sink Sink receiving every event from now on
+     */
+    static void addSink(std::shared_ptr<ProfileSink> sink);
+
+    /**
+     * @brief Attach a callback (wrapped in a sink)
+     * @param callback Function receiving every event from now on
+     * @return Sink to pass to removeSink()
+     */
+    static std::shared_ptr<ProfileSink> addCallback(std::function<void(const ProfileEvent&)> callback);
+
+    /**
+     * @brief Detach a sink
+     * @param sink Sink returned by addCallback() or passed to addSink()
+     */
+    static void removeSink(const std::shared_ptr<ProfileSink>& sink);
+
+    /**
+     * @brief Detach every sink (instrumentation is disabled afterwards)
+     */
+    static void clearSinks();
+
+    /**
+     * @brief Record a counter sample
+     * @param name Counter name
+     * @param value Counter value
+     */
+    static void counter(const char* name, double value) {
+        if (enabled()) {
+            emitCounter(name, value);
+        }
+    }
+
+    /**
+     * @brief Report a progress message (formerly printed to std::cout)
+     * Build expensive messages only when enabled() is true.
+     * @param text Message text
+     */
+    static void message(const std::string& text) {
+        if (enabled()) {
+            emitMessage(text);
+        }
+    }
+
+    /**
+     * @brief Nanoseconds since the profiler epoch (first use in the process)
+     */
+    static uint64_t nowNs();
+
+    /**
+     * @brief Current resident set size of the process in bytes (0 if unavailable)
+     */
+    static uint64_t currentRssBytes();
+
+    /**
+     * @brief Peak resident set size of the process in bytes since start (0 if unavailable)
+     */
+    static uint64_t peakRssBytes();
+
+    /**
+     * @brief Size of a file, or of all files below a directory (OpenFOAM cases), for stage byte counts
+     * @param path File or directory path (UTF-8)
+     * @return Size in bytes (0 if it cannot be determined)
+     */
+    static uint64_t pathBytes(const std::string& path);
+
+    /**
+     * @brief Small sequential id of the calling thread (1, 2, ... in order of first use)
+     */
+    static uint32_t threadId();
+
+private:
+    friend class ProfileScope;
+
+    static void emit(const ProfileEvent& event);
+    static void emitCounter(const char* name, double value);
+    static void emitMessage(const std::string& text);
+
+};
+
+/**
+ * @brief Scoped stage timer: emits a STAGE event when it goes out of scope
+ * Does nothing (no clock read, no allocation) while the profiler is disabled.
+ */
+class ProfileScope {
+public:
+    /**
+     * @brief Start a stage
+     * @param category Stage category ("read", "convert", "filter", "write"; static string)
+     * @param name Stage name (static string)
+     * @param detail Stage subject, e.g. the file path
+     */
+    ProfileScope(const char* category, const char* name, const std::string& detail = std::string())
+        : active_(Profiler::enabled()) {
+        if (active_) {
+            begin(category, name, detail);
+        }
+    }
+
+    ~ProfileScope() {
+        if (active_) {
+            end();
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    bool active() const { return active_; }                            // Whether the stage is being recorded
+    void setName(const std::string& name) { if (active_) event_.name = name; } // Rename once known (e.g. the detected format)
+    void setBytes(uint64_t bytes) { bytes_ = bytes; }                   // Bytes read or written
+    void setInputCells(uint64_t cells) { inputCells_ = cells; }         // Cells entering the stage
+    void setCells(uint64_t cells) { cells_ = cells; }                   // Cells produced by the stage
+
+private:
+    void begin(const char* category, const char* name, const std::string& detail);
+    void end();
+
+    const bool active_;
+    uint64_t bytes_ = 0;
+    uint64_t inputCells_ = 0;
+    uint64_t cells_ = 0;
+    ProfileEvent event_;       // Filled in by begin(), completed by end()
+    uint64_t startPeakRss_ = 0;
+};
+
+/**
+ * @brief Sink printing messages and stage timings to std::cout (verbose console output)
+ */
+class ConsoleProfileSink : public ProfileSink {
+public:
+    /**
+     * @brief Constructor
+     * @param stages Also print one line per finished stage
+     */
+    explicit ConsoleProfileSink(bool stages = true) : stages_(stages) {}
+
+    void onEvent(const ProfileEvent& event) override;
+
+private:
+    const bool stages_;
+};
+
+/**
+ * @brief Sink aggregating stages per category and name (count, time, bytes, cells, peak growth)
+ */
+class StageSummarySink : public ProfileSink {
+public:
+    /**
+     * @brief Aggregate of one stage
+     */
+    struct StageTotals {
+        uint64_t count = 0;           // Finished stages
+        double seconds = 0.0;         // Summed wall time
+        double maxSeconds = 0.0;      // Longest single stage
+        uint64_t bytes = 0;           // Summed bytes
+        uint64_t cells = 0;           // Summed output cells
+        uint64_t peakGrowthBytes = 0; // Largest rise of the process peak resident set
+    };
+
+    void onEvent(const ProfileEvent& event) override;
+
+    /**
+     * @brief Aggregates keyed by (category, name), in key order
+     */
+    const std::map<std::pair<std::string, std::string>, StageTotals>& totals() const { return totals_; }
+
+    /**
+     * @brief Human-readable table of the aggregates, plus the process peak resident set
+     * Call once the profiled work has finished (or after removeSink()).
+     */
+    std::string toString() const;
+
+private:
+    std::map<std::pair<std::string, std::string>, StageTotals> totals_;
+};
+
+/**
+ * @brief Sink collecting events for the Chrome trace event format (chrome://tracing, Perfetto)
+ * Stages become complete ("X") events with their counters as args, counters become "C" events.
+ */
+class ChromeTraceSink : public ProfileSink {
+public:
+    void onEvent(const ProfileEvent& event) override;
+
+    /**
+     * @brief Write the collected events as a Chrome trace JSON file
+     * Call once the profiled work has finished (or after removeSink()).
+     * @param filePath Output file path (UTF-8)
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @return Whether writing is successful
+     */
+    bool write(const std::string& filePath, std::string& errorMsg) const;
+
+    size_t eventCount() const { return events_.size(); }  // Collected events
+
+private:
+    std::vector<ProfileEvent> events_;
+};
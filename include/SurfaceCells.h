@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include "MeshTypes.h"
+
+/**
+ * @brief Call a function for every polygonal face of a range of cells
+ * Triangle strips are split into triangles; points, lines and volume cells are skipped.
+ * @param cells Cells to visit
+ * @param begin First cell of the range
+ * @param end One past the last cell of the range
+ * @param face Callback taking (const Index* indices, size_t count)
+ */
+template<typename Index, typename FaceFn>
+void forEachFace(const BasicCellArray<Index>& cells, size_t begin, size_t end, FaceFn&& face) {
+    for (size_t i = begin; i < end; ++i) {
+        const Index* indices = cells.cellPoints(i);
+        const size_t count = cells.cellSize(i);
+        switch (cells.types[i]) {
+            case VtkCellType::TRIANGLE:
+            case VtkCellType::QUAD:
+            case VtkCellType::POLYGON:
+                if (count >= 3) {
+                    face(indices, count);
+                }
+                break;
+            case VtkCellType::TRIANGLE_STRIP:
+                for (size_t k = 0; k + 2 < count; ++k) {
+                    // Every second strip triangle is flipped to keep a consistent winding
+                    const Index triangle[3] = {indices[k], indices[k + (k % 2 ? 2 : 1)], indices[k + (k % 2 ? 1 : 2)]};
+                    face(triangle, 3);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Call a function for every polygonal face of a cell array
+ * @param cells Cells to visit
+ * @param face Callback taking (const Index* indices, size_t count)
+ */
+template<typename Index, typename FaceFn>
+void forEachFace(const BasicCellArray<Index>& cells, FaceFn&& face) {
+    forEachFace(cells, 0, cells.size(), face);
+}
+
+/**
+ * @brief Call a function for every triangle of a range of cells (polygons are fan-triangulated)
+ * @param cells Cells to visit
+ * @param begin First cell of the range
+ * @param end One past the last cell of the range
+ * @param triangle Callback taking (Index a, Index b, Index c)
+ */
+template<typename Index, typename TriangleFn>
+void forEachTriangle(const BasicCellArray<Index>& cells, size_t begin, size_t end, TriangleFn&& triangle) {
+    forEachFace(cells, begin, end, [&triangle](const Index* indices, size_t count) {
+        for (size_t k = 1; k + 1 < count; ++k) {
+            triangle(indices[0], indices[k], indices[k + 1]);
+        }
+    });
+}
+
+/**
+ * @brief Call a function for every triangle of a cell array (polygons are fan-triangulated)
+ * @param cells Cells to visit
+ * @param triangle Callback taking (Index a, Index b, Index c)
+ */
+template<typename Index, typename TriangleFn>
+void forEachTriangle(const BasicCellArray<Index>& cells, TriangleFn&& triangle) {
+    forEachTriangle(cells, 0, cells.size(), triangle);
+}
+
+/**
+ * @brief Call a function for every SU2 element of a range of cells, in cell order
+ * SU2 element ids equal VTK cell type ids. Polygons and triangle strips are split into triangles
+ * where they stand, so element numbering follows the cell order; other cell types are skipped.
+ * @param cells Cells to visit
+ * @param begin First cell of the range
+ * @param end One past the last cell of the range
+ * @param element Callback taking (int su2Type, const Index* indices, size_t count)
+ */
+template<typename Index, typename ElementFn>
+void forEachSU2Element(const BasicCellArray<Index>& cells, size_t begin, size_t end, ElementFn&& element) {
+    for (size_t i = begin; i < end; ++i) {
+        switch (cells.types[i]) {
+            case VtkCellType::VERTEX:
+            case VtkCellType::LINE:
+            case VtkCellType::TRIANGLE:
+            case VtkCellType::QUAD:
+            case VtkCellType::TETRA:
+            case VtkCellType::HEXAHEDRON:
+            case VtkCellType::WEDGE:
+            case VtkCellType::PYRAMID:
+                element(static_cast<int>(cells.types[i]), cells.cellPoints(i), cells.cellSize(i));
+                break;
+            case VtkCellType::POLYGON:
+            case VtkCellType::TRIANGLE_STRIP:
+                forEachTriangle(cells, i, i + 1, [&element](Index a, Index b, Index c) {
+                    const Index triangle[3] = {a, b, c};
+                    element(static_cast<int>(VtkCellType::TRIANGLE), triangle, 3);
+                });
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Unit normal of a triangle from its right-handed corner order
+ * @param a First corner (xyz)
+ * @param b Second corner (xyz)
+ * @param c Third corner (xyz)
+ * @param[out] normal Unit normal (zero for degenerate triangles)
+ */
+inline void facetNormal(const float* a, const float* b, const float* c, float normal[3]) {
+    const float u[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+    const float v[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+    normal[0] = u[1] * v[2] - u[2] * v[1];
+    normal[1] = u[2] * v[0] - u[0] * v[2];
+    normal[2] = u[0] * v[1] - u[1] * v[0];
+    const float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+    if (length > 0.0f) {
+        normal[0] /= length;
+        normal[1] /= length;
+        normal[2] /= length;
+    }
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Persistent work-stealing thread pool for coarse tasks (one file conversion per task)
+ *
+ * Every worker owns a task queue with one deque per TaskGroup ("lane"), each sorted by
+ * estimated memory cost. A worker starts the largest pending task, taking it from its own
+ * queue when costs tie and stealing from the other queues otherwise; only lane heads are
+ * compared, so picking a task costs O(workers x groups) whatever the number of pending tasks.
+ * Tasks may belong to a TaskGroup, which caps how many of its tasks run at once and how much
+ * memory they may hold together.
+ */
+class TaskPool {
+public:
+    /**
+     * @brief Admission limits and completion tracking for a set of related tasks
+     * Create it with std::make_shared and pass it to submit(); wait() blocks until every task
+     * submitted with the group has finished. Do not call wait() from a pool worker.
+     */
+    class TaskGroup {
+    public:
+        /**
+         * @brief Constructor
+         * @param maxConcurrency Maximum tasks of this group running at once (0 = unlimited)
+         * @param memoryBudget Maximum summed memory cost of running tasks in bytes (0 = unlimited);
+         *                     a task larger than the budget still runs, but only on its own
+         */
+        explicit TaskGroup(size_t maxConcurrency = 0, uint64_t memoryBudget = 0)
+            : maxConcurrency_(maxConcurrency), memoryBudget_(memoryBudget) {}
+
+        /**
+         * @brief Block until all tasks submitted with this group have finished
+         */
+        void wait();
+
+    private:
+        friend class TaskPool;
+
+        bool admits(uint64_t memoryCost) const;
+
+        const size_t maxConcurrency_;  // Concurrency cap
+        const uint64_t memoryBudget_;  // Memory budget in bytes
+        size_t running_ = 0;           // Tasks currently running (guarded by the pool mutex)
+        uint64_t memoryInUse_ = 0;     // Memory cost of running tasks (guarded by the pool mutex)
+        // Completion tracking (guarded by doneMutex_)
+        size_t unfinished_ = 0;
+        std::mutex doneMutex_;
+        std::condition_variable doneCondition_;
+    };
+
+    /**
+     * @brief Constructor
+     * @param threadCount Number of worker threads (0 = hardware concurrency)
+     */
+    explicit TaskPool(size_t threadCount = 0);
+
+    /**
+     * @brief Destructor, finishes queued tasks and joins the workers
+     */
+    ~TaskPool();
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    /**
+     * @brief Process-wide pool shared by MeshConverter, the command line tool and the Qt app
+     * @return Shared pool (hardware concurrency workers)
+     */
+    static TaskPool& shared();
+
+    /**
+     * @brief Queue a task
+     * Tasks must not throw; exceptions escaping a task are swallowed.
+     * @param task Task to run
+     * @param memoryCost Estimated peak memory of the task in bytes (used for admission and ordering)
+     * @param group Optional group providing limits and wait()
+     */
+    void submit(std::function<void()> task,
+                uint64_t memoryCost = 0,
+                const std::shared_ptr<TaskGroup>& group = nullptr);
+
+    /**
+     * @brief Queue several tasks, largest memory cost first, spread across the worker deques
+     * @param tasks Tasks to run
+     * @param memoryCosts Estimated peak memory of each task in bytes (same size as tasks)
+     * @param group Optional group providing limits and wait()
+     */
+    void submitBatch(std::vector<std::function<void()>> tasks,
+                     const std::vector<uint64_t>& memoryCosts,
+                     const std::shared_ptr<TaskGroup>& group = nullptr);
+
+    /**
+     * @brief Get number of worker threads
+     * @return Worker count
+     */
+    size_t threadCount() const { return workers_.size(); }
+
+private:
+    struct Task {
+        std::function<void()> run;
+        uint64_t memoryCost = 0;
+        std::shared_ptr<TaskGroup> group;
+    };
+
+    // Pending tasks of one group in one worker queue
+    struct Lane {
+        TaskGroup* group = nullptr;  // nullptr = tasks without a group
+        std::deque<Task> tasks;      // Sorted largest first, taken from the front
+    };
+
+    void workerLoop(size_t workerIndex);
+    bool takeTask(size_t workerIndex, Task& task);
+
+    std::vector<std::thread> workers_;
+    std::vector<std::vector<Lane>> queues_;  // One queue per worker, one non-empty lane per group
+    size_t nextQueue_ = 0;                   // Round-robin target for submissions
+    size_t pendingTasks_ = 0;                // Tasks in all lanes
+    bool heldBack_ = false;                  // Whether a worker skipped tasks of a group at its limits
+    bool stopping_ = false;
+    std::mutex mutex_;                       // Guards the queues, group admission counters and flags
+    std::condition_variable condition_;
+};
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+/**
+ * @brief Locale-independent tokenizer over an in-memory text buffer (e.g. a MappedFile view)
+ *
+ * Numbers are parsed with std::from_chars, which avoids the per-call locale and stream state
+ * overhead of std::istringstream. Tokens and lines are returned as std::string_view into the
+ * buffer, so the buffer must outlive every view handed out.
+ *
+ * A tokenizer constructed on a single line (from nextLine()) is the line-level helper:
+ * token reads never cross the end of that line.
+ */
+class TextTokenizer {
+public:
+    TextTokenizer() = default;
+    TextTokenizer(const char* data, size_t size) : begin_(data), cur_(data), end_(data + size) {}
+    explicit TextTokenizer(std::string_view text) : TextTokenizer(text.data(), text.size()) {}
+
+    bool atEnd() const { return cur_ == end_; }                          // Whether the whole buffer was consumed
+    size_t position() const { return static_cast<size_t>(cur_ - begin_); } // Bytes consumed so far
+    size_t size() const { return static_cast<size_t>(end_ - begin_); }     // Buffer size in bytes
+    const char* current() const { return cur_; }                          // Current read position
+    std::string_view rest() const { return std::string_view(cur_, static_cast<size_t>(end_ - cur_)); } // Unread text
+    void skip(size_t bytes) { cur_ += bytes < static_cast<size_t>(end_ - cur_) ? bytes : static_cast<size_t>(end_ - cur_); } // Advance over binary data
+
+    /**
+     * @brief Read the next line (without the trailing "\n" or "\r\n")
+     * @param[out] line Line contents
+     * @return Whether a line was read (false at end of buffer)
+     */
+    bool nextLine(std::string_view& line) {
+        if (cur_ == end_) {
+            return false;
+        }
+        const char* lineEnd = static_cast<const char*>(std::memchr(cur_, '\n', static_cast<size_t>(end_ - cur_)));
+        const char* next = lineEnd ? lineEnd + 1 : end_;
+        if (!lineEnd) {
+            lineEnd = end_;
+        }
+        if (lineEnd != cur_ && lineEnd[-1] == '\r') {
+            --lineEnd;
+        }
+        line = std::string_view(cur_, static_cast<size_t>(lineEnd - cur_));
+        cur_ = next;
+        return true;
+    }
+
+    /**
+     * @brief Skip whitespace (including line breaks) before the next token
+     */
+    void skipWhitespace() {
+        while (cur_ != end_ && isSpace(*cur_)) {
+            ++cur_;
+        }
+    }
+
+    /**
+     * @brief Read the next whitespace-delimited token
+     * @param[out] token Token contents
+     * @return Whether a token was read (false at end of buffer)
+     */
+    bool nextToken(std::string_view& token) {
+        skipWhitespace();
+        if (cur_ == end_) {
+            return false;
+        }
+        const char* start = cur_;
+        while (cur_ != end_ && !isSpace(*cur_)) {
+            ++cur_;
+        }
+        token = std::string_view(start, static_cast<size_t>(cur_ - start));
+        return true;
+    }
+
+    /**
+     * @brief Read the next number (same tokenization as operator>>: leading whitespace skipped,
+     * parsing stops at the first character that is not part of the number)
+     * @param[out] value Parsed value (unchanged on failure)
+     * @return Whether a number was read
+     */
+    template<typename T>
+    bool next(T& value) {
+        skipWhitespace();
+        const char* numberEnd = parseNumber(cur_, end_, value);
+        if (!numberEnd) {
+            return false;
+        }
+        cur_ = numberEnd;
+        return true;
+    }
+
+    /**
+     * @brief Parse a number from the start of [first, last)
+     * @param first Start of text
+     * @param last End of text
+     * @param[out] value Parsed value (unchanged on failure)
+     * @return Pointer past the parsed number, or nullptr on failure
+     */
+    template<typename T>
+    static const char* parseNumber(const char* first, const char* last, T& value) {
+        static_assert(std::is_arithmetic_v<T>, "parseNumber requires an arithmetic type");
+        // std::from_chars rejects the leading '+' that streams accept
+        if (first != last && *first == '+') {
+            ++first;
+        }
+        const auto result = std::from_chars(first, last, value);
+        if (result.ec == std::errc()) {
+            return result.ptr;
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            if (result.ec == std::errc::result_out_of_range) {
+                // Denormals and overflow: clamp the way strtod does
+                double clamped = 0.0;
+                const char* clampedEnd = parseOutOfRange(first, result.ptr, clamped);
+                value = static_cast<T>(clamped);
+                return clampedEnd;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Parse a whole token as a number
+     * @param token Token text
+     * @param[out] value Parsed value
+     * @return Whether the token starts with a valid number
+     */
+    template<typename T>
+    static bool parse(std::string_view token, T& value) {
+        return parseNumber(token.data(), token.data() + token.size(), value) != nullptr;
+    }
+
+    /**
+     * @brief Strip leading and trailing whitespace
+     * @param text Input text
+     * @return Trimmed view into the same text
+     */
+    static std::string_view trim(std::string_view text) {
+        size_t first = 0;
+        while (first < text.size() && isSpace(text[first])) {
+            ++first;
+        }
+        size_t last = text.size();
+        while (last > first && isSpace(text[last - 1])) {
+            --last;
+        }
+        return text.substr(first, last - first);
+    }
+
+    /**
+     * @brief Strip leading whitespace
+     * @param text Input text
+     * @return Trimmed view into the same text
+     */
+    static std::string_view trimLeft(std::string_view text) {
+        size_t first = 0;
+        while (first < text.size() && isSpace(text[first])) {
+            ++first;
+        }
+        return text.substr(first);
+    }
+
+    static bool startsWith(std::string_view text, std::string_view prefix) {
+        return text.size() >= prefix.size() && text.compare(0, prefix.size(), prefix) == 0;
+    }
+
+    static bool isSpace(char ch) {
+        return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' || ch == '\v' || ch == '\f';
+    }
+
+    /**
+     * @brief Convert bytes parsed in a time span to MB/s
+     * @param bytes Bytes parsed
+     * @param seconds Elapsed time in seconds
+     * @return Throughput in MB/s (0 when the time span is empty)
+     */
+    static double throughputMBps(size_t bytes, double seconds) {
+        return seconds > 0.0 ? static_cast<double>(bytes) / (1024.0 * 1024.0) / seconds : 0.0;
+    }
+
+private:
+    /**
+     * @brief Fallback for values std::from_chars reports as out of range
+     * @param first Start of the number
+     * @param last End of the number as reported by std::from_chars
+     * @param[out] value Clamped value
+     * @return Pointer past the number
+     */
+    static const char* parseOutOfRange(const char* first, const char* last, double& value);
+
+    const char* begin_ = nullptr; // Start of buffer
+    const char* cur_ = nullptr;   // Current read position
+    const char* end_ = nullptr;   // End of buffer
+};
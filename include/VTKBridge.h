@@ -0,0 +1,88 @@
+#pragma once
+
+#include <string>
+#include <vtkSmartPointer.h>
+#include <vtkUnstructuredGrid.h>
+#include "MeshTypes.h"
+
+class vtkAlgorithm;
+
+/**
+ * @brief Buffer-sharing bridge between MeshData and vtkUnstructuredGrid
+ *
+ * MeshData stores points as contiguous float xyz and cells in the same CSR layout as
+ * vtkCellArray, so the VTK side can reference the MeshData buffers directly instead of
+ * inserting points and cells one by one. Attributes map to the VTK array of their element type
+ * (vtkTypeInt32Array, vtkTypeInt64Array, vtkFloatArray, vtkDoubleArray) in both directions.
+ * Every function exists for both layouts: MeshData shares float points and 32-bit cell
+ * arrays, MeshData64 shares double points and 64-bit cell arrays.
+ */
+class VTKBridge {
+public:
+    /**
+     * @brief Check whether MeshData buffers can be handed to VTK without copying
+     * Requires connectivity addressable by the signed VTK index array of the layout (32-bit for
+     * MeshData, 64-bit for MeshData64) and matching point counts for fixed-size cells.
+     * @param meshData Input mesh data
+     * @return Whether zero-copy sharing is possible
+     */
+    static bool canShare(const MeshData& meshData);
+    static bool canShare(const MeshData64& meshData);
+
+    /**
+     * @brief Wrap MeshData buffers as a vtkUnstructuredGrid without copying (borrowed)
+     * The grid references meshData memory (VTK save=1): meshData must outlive the grid and must
+     * not be resized while the grid is in use. Falls back to copy() when canShare() is false.
+     * @param meshData Input mesh data
+     * @return vtkUnstructuredGrid pointer
+     */
+    static vtkSmartPointer<vtkUnstructuredGrid> wrap(MeshData& meshData);
+    static vtkSmartPointer<vtkUnstructuredGrid> wrap(MeshData64& meshData);
+
+    /**
+     * @brief Move MeshData buffers into a vtkUnstructuredGrid without copying (owned by VTK)
+     * Buffer ownership is transferred to the VTK arrays and released when they are destroyed.
+     * meshData is left empty. Falls back to copy() when canShare() is false.
+     * @param meshData Input mesh data (moved from)
+     * @return vtkUnstructuredGrid pointer
+     */
+    static vtkSmartPointer<vtkUnstructuredGrid> adopt(MeshData&& meshData);
+    static vtkSmartPointer<vtkUnstructuredGrid> adopt(MeshData64&& meshData);
+
+    /**
+     * @brief Copy MeshData into a new vtkUnstructuredGrid
+     * Unsupported cell types and cells with an unexpected point count are skipped together
+     * with their cell data tuples.
+     * @param meshData Input mesh data
+     * @return vtkUnstructuredGrid pointer
+     */
+    static vtkSmartPointer<vtkUnstructuredGrid> copy(const MeshData& meshData);
+    static vtkSmartPointer<vtkUnstructuredGrid> copy(const MeshData64& meshData);
+
+    /**
+     * @brief Convert vtkUnstructuredGrid to MeshData using bulk array copies
+     * Reads the raw point, cell type, offset and connectivity arrays instead of GetCell() per cell.
+     * @param grid Input VTK unstructured grid
+     * @param[out] meshData Output mesh data
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message (UTF-8)
+     * @return Whether conversion is successful
+     */
+    static bool toMeshData(vtkUnstructuredGrid* grid,
+                           MeshData& meshData,
+                           MeshErrorCode& errorCode,
+                           std::string& errorMsg);
+    static bool toMeshData(vtkUnstructuredGrid* grid,
+                           MeshData64& meshData,
+                           MeshErrorCode& errorCode,
+                           std::string& errorMsg);
+
+    /**
+     * @brief Forward the progress events of a VTK reader, filter or writer to the job of the
+     * calling thread (JobControl), and abort its execution once the job is cancelled
+     * Does nothing outside jobs. Call JobControl::checkpoint() after Update() so that the partial
+     * output of an aborted algorithm is never used.
+     * @param algorithm Algorithm about to be updated
+     */
+    static void observeJob(vtkAlgorithm* algorithm);
+};
@@ -22,9 +22,10 @@ public:
         double decimationTarget = 0.5;        // Target reduction factor (0.0-1.0)
         bool enableSmoothing = false;         // Enable mesh smoothing
         int smoothingIterations = 20;         // Number of smoothing iterations
-        double smoothingRelaxation = 0.1;     // Smoothing relaxation factor
+        double smoothingRelaxation = 0.1;     // Smoothing relaxation factor (Taubin lambda)
+        bool taubinSmoothing = false;         // Use Taubin (non-shrinking) instead of Laplacian smoothing
         bool enableNormalComputation = false; // Enable normal vector computation
-        bool preserveTopology = true;         // Preserve topology during processing
+        bool preserveTopology = true;         // Preserve topology during processing (decimation keeps open boundaries)
     };
 
     /**
@@ -0,0 +1,187 @@
+#include "AsyncConverter.h"
+#include "MeshConverter.h"
+#include "MeshException.h"
+#include "MeshReader.h"
+#include "MeshWriter.h"
+#include <filesystem>
+#include <system_error>
+
+namespace {
+
+/**
+ * @brief Input size of a job (file, or directory tree for OpenFOAM cases), used as its memory cost
+ * @param filePath Input path (UTF-8)
+ * @return Size in bytes (0 if unknown)
+ */
+uint64_t inputBytes(const std::string& filePath) {
+    std::error_code error;
+    const std::filesystem::path path = std::filesystem::u8path(filePath);
+    if (!std::filesystem::is_directory(path, error)) {
+        const uintmax_t size = std::filesystem::file_size(path, error);
+        return error ? 0 : static_cast<uint64_t>(size);
+    }
+    uint64_t total = 0;
+    for (std::filesystem::recursive_directory_iterator it(path, error), end; !error && it != end; it.increment(error)) {
+        if (it->is_regular_file(error)) {
+            total += static_cast<uint64_t>(it->file_size(error));
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Remove the partial output of a write that was stopped by cancellation
+ * @param result Result of the write
+ * @param filePath Output file path (UTF-8)
+ */
+void removeCancelledOutput(const JobResult& result, const std::string& filePath) {
+    const JobControl::Context context = JobControl::context();
+    if (!result.success && context.job && context.job->isCancelled()) {
+        std::error_code error;
+        std::filesystem::remove(std::filesystem::u8path(filePath), error);
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Run the work of a job with the job bound to the calling thread and settle its outcome
+ * @param job Job state
+ * @param[in,out] result Result filled in by the work
+ * @param work Work to run (skipped when the job was cancelled while queued)
+ */
+void AsyncConverter::runJob(JobControl& job, JobResult& result, const std::function<void()>& work) {
+    if (!job.isCancelled()) {
+        JobStep root(job);
+        JobControl::Binding binding({&job, &root});
+        try {
+            work();
+        } catch (const JobCancelled&) {
+            result.success = false;
+        } catch (const MeshException& e) {
+            result.success = false;
+            result.errorCode = e.getErrorCode();
+            result.errorMsg = e.what();
+        } catch (const std::exception& e) {
+            result.success = false;
+            result.errorCode = MeshErrorCode::READ_FAILED;
+            result.errorMsg = std::string("Job failed: ") + e.what();
+        }
+    }
+
+    // Work that finished before it noticed the cancellation keeps its result
+    if (!result.success && job.isCancelled()) {
+        result.errorCode = MeshErrorCode::CANCELLED;
+        result.errorMsg = "Cancelled";
+    } else if (result.success) {
+        job.raiseProgress(1.0);
+    }
+}
+
+/**
+ * @brief Read a mesh file in the background
+ * @param filePath File path (UTF-8)
+ * @param readOptions Read options
+ * @param onComplete Completion callback (optional)
+ * @param options Pool and admission group
+ * @return Job handle
+ */
+template<typename MeshT>
+JobHandle<MeshReadResult<MeshT>> AsyncConverter::read(const std::string& filePath,
+                                                      const FormatReadOptions& readOptions,
+                                                      Callback<MeshReadResult<MeshT>> onComplete,
+                                                      const AsyncOptions& options) {
+    return submit<MeshReadResult<MeshT>>([filePath, readOptions](MeshReadResult<MeshT>& result) {
+        result.success = MeshReader::readAuto(filePath, result.mesh, result.errorCode, result.errorMsg, readOptions);
+        if (!result.success) {
+            result.mesh.clear();
+        }
+    }, inputBytes(filePath), std::move(onComplete), options);
+}
+
+template JobHandle<MeshReadResult<MeshData>> AsyncConverter::read(const std::string&, const FormatReadOptions&,
+    Callback<MeshReadResult<MeshData>>, const AsyncOptions&);
+template JobHandle<MeshReadResult<MeshData64>> AsyncConverter::read(const std::string&, const FormatReadOptions&,
+    Callback<MeshReadResult<MeshData64>>, const AsyncOptions&);
+
+/**
+ * @brief Write a mesh in the background
+ * @param meshData Mesh to write (kept alive by the job)
+ * @param filePath Output file path (UTF-8)
+ * @param targetFormat Target format
+ * @param writeOptions Write options
+ * @param onComplete Completion callback (optional)
+ * @param options Pool and admission group
+ * @return Job handle
+ */
+JobHandle<JobResult> AsyncConverter::write(std::shared_ptr<const MeshData> meshData,
+                                           const std::string& filePath,
+                                           MeshFormat targetFormat,
+                                           const FormatWriteOptions& writeOptions,
+                                           Callback<JobResult> onComplete,
+                                           const AsyncOptions& options) {
+    const uint64_t meshBytes = meshData
+        ? meshData->points.size() * sizeof(float) + meshData->cells.connectivitySize() * sizeof(uint32_t)
+        : 0;
+    return submit<JobResult>([meshData, filePath, targetFormat, writeOptions](JobResult& result) {
+        if (!meshData) {
+            result.errorCode = MeshErrorCode::PARAM_INVALID;
+            result.errorMsg = "No mesh to write";
+            return;
+        }
+        result.success = MeshWriter::write(*meshData, filePath, targetFormat, writeOptions, result.errorCode, result.errorMsg);
+        removeCancelledOutput(result, filePath);
+    }, meshBytes, std::move(onComplete), options);
+}
+
+/**
+ * @brief Convert a file in the background
+ * @param srcFilePath Source file path (UTF-8)
+ * @param dstFilePath Target file path (UTF-8)
+ * @param srcFormat Source format (MeshFormat::UNKNOWN = auto detect)
+ * @param dstFormat Target format
+ * @param writeOptions Target format write options
+ * @param onComplete Completion callback (optional)
+ * @param options Pool and admission group
+ * @return Job handle
+ */
+JobHandle<JobResult> AsyncConverter::convert(const std::string& srcFilePath,
+                                             const std::string& dstFilePath,
+                                             MeshFormat srcFormat,
+                                             MeshFormat dstFormat,
+                                             const FormatWriteOptions& writeOptions,
+                                             Callback<JobResult> onComplete,
+                                             const AsyncOptions& options) {
+    return submit<JobResult>([=](JobResult& result) {
+        result.success = MeshConverter::convert(srcFilePath, dstFilePath, srcFormat, dstFormat, writeOptions,
+                                                result.errorCode, result.errorMsg);
+        removeCancelledOutput(result, dstFilePath);
+    }, inputBytes(srcFilePath), std::move(onComplete), options);
+}
+
+/**
+ * @brief Convert a file through VTK processing in the background
+ * @param srcFilePath Source file path (UTF-8)
+ * @param dstFilePath Target file path (UTF-8)
+ * @param srcFormat Source format
+ * @param dstFormat Target format
+ * @param processingOptions VTK processing options
+ * @param writeOptions Target format write options
+ * @param onComplete Completion callback (optional)
+ * @param options Pool and admission group
+ * @return Job handle
+ */
+JobHandle<JobResult> AsyncConverter::convertVTK(const std::string& srcFilePath,
+                                                const std::string& dstFilePath,
+                                                MeshFormat srcFormat,
+                                                MeshFormat dstFormat,
+                                                const VTKConverter::VTKProcessingOptions& processingOptions,
+                                                const FormatWriteOptions& writeOptions,
+                                                Callback<JobResult> onComplete,
+                                                const AsyncOptions& options) {
+    return submit<JobResult>([=](JobResult& result) {
+        result.success = VTKConverter::convert(srcFilePath, dstFilePath, srcFormat, dstFormat, processingOptions,
+                                               writeOptions, result.errorCode, result.errorMsg);
+        removeCancelledOutput(result, dstFilePath);
+    }, inputBytes(srcFilePath), std::move(onComplete), options);
+}
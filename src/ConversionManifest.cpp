@@ -0,0 +1,426 @@
+#include "ConversionManifest.h"
+#include "MappedFile.h"
+#include "ParallelFor.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr char MANIFEST_HEADER[] = "# meshconv manifest 1";
+
+// Bytes hashed per chunk of a file (chunks are hashed in parallel)
+constexpr size_t HASH_CHUNK_BYTES = 16 * 1024 * 1024;
+
+constexpr uint64_t XXH_PRIME1 = 11400714785074694791ull;
+constexpr uint64_t XXH_PRIME2 = 14029467366897019727ull;
+constexpr uint64_t XXH_PRIME3 = 1609587929392839161ull;
+constexpr uint64_t XXH_PRIME4 = 9650029242287828579ull;
+constexpr uint64_t XXH_PRIME5 = 2870177450012600261ull;
+
+inline uint64_t rotl64(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t read64(const unsigned char* p) {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint32_t read32(const unsigned char* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint64_t xxhRound(uint64_t acc, uint64_t input) {
+    acc += input * XXH_PRIME2;
+    return rotl64(acc, 31) * XXH_PRIME1;
+}
+
+inline uint64_t xxhMergeRound(uint64_t acc, uint64_t value) {
+    acc ^= xxhRound(0, value);
+    return acc * XXH_PRIME1 + XXH_PRIME4;
+}
+
+/**
+ * @brief Serializer of setting values into one byte string for hashing
+ * Fields are appended one by one (never whole structs, whose padding is undefined).
+ */
+class SettingsBytes {
+public:
+    template<typename T>
+    SettingsBytes& add(T value) {
+        bytes_.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        return *this;
+    }
+    SettingsBytes& add(const std::string& text) {
+        add<uint64_t>(text.size());
+        bytes_.append(text);
+        return *this;
+    }
+    const std::string& bytes() const { return bytes_; }
+
+private:
+    std::string bytes_;
+};
+
+/**
+ * @brief Absolute, normalized UTF-8 form of a source path (the manifest key)
+ */
+std::string manifestKey(const std::string& srcFilePath) {
+    std::error_code ec;
+    std::filesystem::path path = std::filesystem::absolute(std::filesystem::u8path(srcFilePath), ec);
+    if (ec) {
+        path = std::filesystem::u8path(srcFilePath);
+    }
+    return path.lexically_normal().u8string();
+}
+
+/**
+ * @brief Size and modification time of a file, or of a directory tree (OpenFOAM case output)
+ * A directory reports the summed size of its regular files and the latest modification time
+ * found in the tree, so adding, removing or rewriting any file inside it is noticed.
+ * @return Whether the path exists
+ */
+bool statFile(const std::string& filePath, uint64_t& size, int64_t& modified) {
+    const std::filesystem::path path = std::filesystem::u8path(filePath);
+    std::error_code ec;
+    auto writeTime = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return false;
+    }
+    if (!std::filesystem::is_directory(path, ec)) {
+        const uintmax_t fileSize = std::filesystem::file_size(path, ec);
+        if (ec) {
+            return false;
+        }
+        size = static_cast<uint64_t>(fileSize);
+        modified = static_cast<int64_t>(writeTime.time_since_epoch().count());
+        return true;
+    }
+    uint64_t treeBytes = 0;
+    for (std::filesystem::recursive_directory_iterator it(path, ec), end; !ec && it != end; it.increment(ec)) {
+        std::error_code entryEc;
+        const auto entryTime = it->last_write_time(entryEc);
+        if (!entryEc && entryTime > writeTime) {
+            writeTime = entryTime;
+        }
+        if (it->is_regular_file(entryEc)) {
+            treeBytes += static_cast<uint64_t>(it->file_size(entryEc));
+        }
+    }
+    if (ec) {
+        return false;
+    }
+    size = treeBytes;
+    modified = static_cast<int64_t>(writeTime.time_since_epoch().count());
+    return true;
+}
+
+} // namespace
+
+/**
+ * @brief Default manifest of a target directory
+ * @param dstDir Target directory (UTF-8)
+ * @return Manifest path
+ */
+std::string ConversionManifest::defaultPath(const std::string& dstDir) {
+    return (std::filesystem::u8path(dstDir) / ".meshconv-manifest").u8string();
+}
+
+/**
+ * @brief Load a manifest
+ * Line format: contentHash settingsHash srcSize srcModified dstSize (tab separated), then the
+ * source and output paths, each terminated by a tab or the end of the line.
+ * @param manifestPath Manifest path (UTF-8)
+ */
+void ConversionManifest::load(const std::string& manifestPath) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    path_ = manifestPath;
+    entries_.clear();
+
+    std::ifstream file(std::filesystem::u8path(manifestPath));
+    std::string line;
+    if (!file.is_open() || !std::getline(file, line) || line != MANIFEST_HEADER) {
+        // Missing, foreign or older manifests start the batch from scratch
+        return;
+    }
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        std::string contentHash, settingsHash, srcSize, srcModified, dstSize, srcPath, dstPath;
+        if (!std::getline(fields, contentHash, '\t') || !std::getline(fields, settingsHash, '\t')
+            || !std::getline(fields, srcSize, '\t') || !std::getline(fields, srcModified, '\t')
+            || !std::getline(fields, dstSize, '\t') || !std::getline(fields, srcPath, '\t')
+            || !std::getline(fields, dstPath, '\t')) {
+            continue;
+        }
+        try {
+            Entry entry;
+            entry.contentHash = std::stoull(contentHash, nullptr, 16);
+            entry.settingsHash = std::stoull(settingsHash, nullptr, 16);
+            entry.srcSize = std::stoull(srcSize);
+            entry.srcModified = std::stoll(srcModified);
+            entry.dstSize = std::stoull(dstSize);
+            entry.dstFilePath = dstPath;
+            entries_[srcPath] = std::move(entry);
+        } catch (const std::exception&) {
+            // Malformed line: the source is simply converted again
+        }
+    }
+}
+
+/**
+ * @brief Write the manifest back to the path it was loaded from
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @return Whether saving is successful
+ */
+bool ConversionManifest::save(std::string& errorMsg) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (path_.empty()) {
+        errorMsg = "Manifest was not loaded";
+        return false;
+    }
+    const std::filesystem::path path = std::filesystem::u8path(path_);
+    std::filesystem::path temporaryPath = path;
+    temporaryPath += ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::trunc);
+        if (!file.is_open()) {
+            errorMsg = "Cannot write manifest: " + path_;
+            return false;
+        }
+        file << MANIFEST_HEADER << '\n';
+        for (const auto& [srcPath, entry] : entries_) {
+            file << std::hex << entry.contentHash << '\t' << entry.settingsHash << '\t' << std::dec
+                 << entry.srcSize << '\t' << entry.srcModified << '\t' << entry.dstSize << '\t'
+                 << srcPath << '\t' << entry.dstFilePath << '\n';
+        }
+        if (!file.flush()) {
+            errorMsg = "Cannot write manifest: " + path_;
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(temporaryPath, path, ec);
+    if (ec) {
+        std::filesystem::remove(temporaryPath, ec);
+        errorMsg = "Cannot replace manifest " + path_ + ": " + ec.message();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Check whether a source still converts to its recorded output
+ * @param srcFilePath Source file path (UTF-8)
+ * @param dstFilePath Output file path the conversion would write (UTF-8)
+ * @param settingsHash Fingerprint of the conversion settings
+ * @param[out] current Current identity of the source
+ * @param threads Hashing threads
+ * @return Whether the conversion can be skipped
+ */
+bool ConversionManifest::lookup(const std::string& srcFilePath,
+                                const std::string& dstFilePath,
+                                uint64_t settingsHash,
+                                Entry& current,
+                                unsigned int threads) {
+    current = Entry();
+    current.dstFilePath = dstFilePath;
+    current.settingsHash = settingsHash;
+    // Paths with separators cannot be stored: such sources are always converted
+    if (srcFilePath.find_first_of("\t\n") != std::string::npos || dstFilePath.find_first_of("\t\n") != std::string::npos
+        || !statFile(srcFilePath, current.srcSize, current.srcModified)) {
+        return false;
+    }
+
+    Entry recorded;
+    bool known = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = entries_.find(manifestKey(srcFilePath));
+        if (it != entries_.end()) {
+            recorded = it->second;
+            known = true;
+        }
+    }
+
+    uint64_t dstSize = 0;
+    int64_t dstModified = 0;
+    const bool reusable = known && recorded.settingsHash == settingsHash && recorded.dstFilePath == dstFilePath
+        && statFile(dstFilePath, dstSize, dstModified) && dstSize == recorded.dstSize;
+
+    // Unchanged size and time: trust the recorded hash instead of reading the source again
+    if (reusable && recorded.srcSize == current.srcSize && recorded.srcModified == current.srcModified) {
+        current.contentHash = recorded.contentHash;
+        return true;
+    }
+
+    std::string errorMsg;
+    if (!hashFile(srcFilePath, current.contentHash, errorMsg, threads)) {
+        current.contentHash = 0;
+        return false;
+    }
+    if (reusable && recorded.srcSize == current.srcSize && recorded.contentHash == current.contentHash) {
+        // Touched but unchanged: remember the new time so the next run skips the hash as well
+        current.dstSize = recorded.dstSize;
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_[manifestKey(srcFilePath)] = current;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Record a successful conversion
+ * @param srcFilePath Source file path (UTF-8)
+ * @param entry Source identity from lookup()
+ */
+void ConversionManifest::record(const std::string& srcFilePath, Entry entry) {
+    // A zero hash means lookup() could not identify the source
+    int64_t dstModified = 0;
+    if (entry.contentHash == 0 || !statFile(entry.dstFilePath, entry.dstSize, dstModified)) {
+        forget(srcFilePath);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_[manifestKey(srcFilePath)] = std::move(entry);
+}
+
+/**
+ * @brief Drop the record of a source
+ * @param srcFilePath Source file path (UTF-8)
+ */
+void ConversionManifest::forget(const std::string& srcFilePath) {
+    const std::string key = manifestKey(srcFilePath);
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.erase(key);
+}
+
+/**
+ * @brief Fingerprint of the settings every conversion of a batch shares
+ * @param dstFormat Target format
+ * @param writeOptions Target format write options
+ * @param readOptions Source read options
+ * @param extraSettings Fingerprint of further settings
+ * @return Settings hash
+ */
+uint64_t ConversionManifest::settingsHash(MeshFormat dstFormat,
+                                          const FormatWriteOptions& writeOptions,
+                                          const FormatReadOptions& readOptions,
+                                          uint64_t extraSettings) {
+    // Thread counts do not change the output and are left out
+    SettingsBytes settings;
+    settings.add(static_cast<int32_t>(dstFormat))
+        .add(writeOptions.isBinary)
+        .add(writeOptions.precision)
+        .add(writeOptions.compress)
+        .add(static_cast<int32_t>(writeOptions.reorder))
+        .add(writeOptions.vtkPreserveAllAttributes)
+        .add(static_cast<int32_t>(writeOptions.vtkCompressor))
+        .add(writeOptions.vtkBlockSize)
+        .add(writeOptions.cgnsBaseName)
+        .add(writeOptions.cgnsZoneName)
+        .add(writeOptions.cgnsDimension)
+        .add(writeOptions.gmshPreservePhysicalGroups)
+        .add(writeOptions.stlSolidName)
+        .add(readOptions.stlWeldVertices)
+        .add(readOptions.cgnsBase)
+        .add<uint64_t>(readOptions.cgnsZones.size());
+    for (int zone : readOptions.cgnsZones) {
+        settings.add(zone);
+    }
+    settings.add(readOptions.openFoamPatches)
+        .add(readOptions.weldPoints)
+        .add(readOptions.weldTolerance)
+        .add(extraSettings);
+    return hashBytes(settings.bytes().data(), settings.bytes().size());
+}
+
+/**
+ * @brief 64-bit XXH64 hash of a byte range
+ * @param data First byte
+ * @param size Byte count
+ * @param seed Hash seed
+ * @return Hash value
+ */
+uint64_t ConversionManifest::hashBytes(const void* data, size_t size, uint64_t seed) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    const unsigned char* const end = p + size;
+    uint64_t hash;
+    if (size >= 32) {
+        uint64_t v1 = seed + XXH_PRIME1 + XXH_PRIME2;
+        uint64_t v2 = seed + XXH_PRIME2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - XXH_PRIME1;
+        const unsigned char* const limit = end - 32;
+        do {
+            v1 = xxhRound(v1, read64(p));
+            v2 = xxhRound(v2, read64(p + 8));
+            v3 = xxhRound(v3, read64(p + 16));
+            v4 = xxhRound(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+        hash = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+        hash = xxhMergeRound(hash, v1);
+        hash = xxhMergeRound(hash, v2);
+        hash = xxhMergeRound(hash, v3);
+        hash = xxhMergeRound(hash, v4);
+    } else {
+        hash = seed + XXH_PRIME5;
+    }
+    hash += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        hash ^= xxhRound(0, read64(p));
+        hash = rotl64(hash, 27) * XXH_PRIME1 + XXH_PRIME4;
+    }
+    if (p + 4 <= end) {
+        hash ^= static_cast<uint64_t>(read32(p)) * XXH_PRIME1;
+        hash = rotl64(hash, 23) * XXH_PRIME2 + XXH_PRIME3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        hash ^= static_cast<uint64_t>(*p) * XXH_PRIME5;
+        hash = rotl64(hash, 11) * XXH_PRIME1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= XXH_PRIME2;
+    hash ^= hash >> 29;
+    hash *= XXH_PRIME3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+/**
+ * @brief Content hash of a file
+ * @param filePath File path (UTF-8)
+ * @param[out] hash Content hash
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @param threads Hashing threads
+ * @return Whether hashing is successful
+ */
+bool ConversionManifest::hashFile(const std::string& filePath, uint64_t& hash, std::string& errorMsg, unsigned int threads) {
+    MappedFile file;
+    if (!file.open(filePath, errorMsg)) {
+        return false;
+    }
+    const size_t chunkCount = std::max<size_t>(1, (file.size() + HASH_CHUNK_BYTES - 1) / HASH_CHUNK_BYTES);
+    std::vector<uint64_t> chunkHashes(chunkCount + 1);
+    parallelForRanges(chunkCount, parallelTaskCount(chunkCount, 1, threads), [&](size_t begin, size_t end, size_t) {
+        for (size_t chunk = begin; chunk < end; ++chunk) {
+            const size_t offset = chunk * HASH_CHUNK_BYTES;
+            const size_t size = std::min(HASH_CHUNK_BYTES, file.size() - offset);
+            chunkHashes[chunk] = hashBytes(file.data() + offset, size);
+        }
+    });
+    chunkHashes[chunkCount] = static_cast<uint64_t>(file.size());
+    hash = hashBytes(chunkHashes.data(), chunkHashes.size() * sizeof(uint64_t));
+    return true;
+}
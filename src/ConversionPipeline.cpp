@@ -0,0 +1,402 @@
+#include "ConversionPipeline.h"
+#include "BoundedQueue.h"
+#include "ConversionManifest.h"
+#include "MeshReader.h"
+#include "MeshHelper.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <system_error>
+#include <thread>
+#include <vtkUnstructuredGrid.h>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Mesh travelling between two pipeline stages
+ */
+struct PipelineItem {
+    const std::string* srcFilePath = nullptr;
+    vtkSmartPointer<vtkUnstructuredGrid> grid;
+    ConversionManifest::Entry source;  // Source identity recorded once written (incremental)
+};
+
+/**
+ * @brief Seconds elapsed since a time point
+ * @param start Start time
+ * @return Elapsed seconds
+ */
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Time accumulated by one stage thread, merged into the stage stats when the thread ends
+ */
+struct StageClock {
+    double busySeconds = 0.0;
+    double inputWaitSeconds = 0.0;
+    double outputWaitSeconds = 0.0;
+    uint64_t items = 0;
+    uint64_t failures = 0;
+
+    void mergeInto(PipelineStageStats& stats, std::mutex& mutex) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        stats.busySeconds += busySeconds;
+        stats.inputWaitSeconds += inputWaitSeconds;
+        stats.outputWaitSeconds += outputWaitSeconds;
+        stats.items += items;
+        stats.failures += failures;
+    }
+};
+
+/**
+ * @brief Generate target file path (same naming as MeshConverter::batchConvert)
+ * @param srcFilePath Source file path
+ * @param dstDir Target directory
+ * @param dstFormat Target format
+ * @return Target file path
+ */
+std::string pipelineDstFilePath(const std::string& srcFilePath, const std::string& dstDir, MeshFormat dstFormat) {
+    std::filesystem::path dstPath(dstDir);
+    dstPath /= std::filesystem::path(srcFilePath).stem().string() + MeshHelper::getFormatExtension(dstFormat);
+    return dstPath.string();
+}
+
+/**
+ * @brief Fingerprint of the processing options (part of the incremental settings hash)
+ * @param options VTK processing options
+ * @return Hash of the option values
+ */
+uint64_t processingOptionsHash(const VTKConverter::VTKProcessingOptions& options) {
+    const double values[] = {
+        static_cast<double>(options.enableCleaning),
+        static_cast<double>(options.enableTriangulation),
+        static_cast<double>(options.enableDecimation),
+        options.decimationTarget,
+        static_cast<double>(options.enableSmoothing),
+        static_cast<double>(options.smoothingIterations),
+        options.smoothingRelaxation,
+        static_cast<double>(options.taubinSmoothing),
+        static_cast<double>(options.enableNormalComputation),
+        static_cast<double>(options.preserveTopology)
+    };
+    return ConversionManifest::hashBytes(values, sizeof(values));
+}
+
+} // namespace
+
+// ==============================
+// PipelineReport
+// ==============================
+
+/**
+ * @brief Get the stage limiting the batch (highest utilization)
+ * @return Bottleneck stage
+ */
+const PipelineStageStats& PipelineReport::bottleneck() const {
+    const PipelineStageStats* limiting = &read;
+    for (const PipelineStageStats* stage : {&process, &write}) {
+        if (stage->utilization(wallSeconds) > limiting->utilization(wallSeconds)) {
+            limiting = stage;
+        }
+    }
+    return *limiting;
+}
+
+/**
+ * @brief Format the report as a small table
+ * @return Multi-line report text
+ */
+std::string PipelineReport::toString() const {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2);
+    out << "Pipeline wall time: " << wallSeconds << " s" << std::endl;
+    if (skipped > 0) {
+        out << "Skipped (up to date): " << skipped << " files" << std::endl;
+    }
+    out << "stage    threads  files  failed  busy(s)  starved(s)  blocked(s)  utilization" << std::endl;
+    for (const PipelineStageStats* stage : {&read, &process, &write}) {
+        out << std::left << std::setw(9) << stage->name << std::right
+            << std::setw(7) << stage->threads
+            << std::setw(7) << stage->items
+            << std::setw(8) << stage->failures
+            << std::setw(9) << stage->busySeconds
+            << std::setw(12) << stage->inputWaitSeconds
+            << std::setw(12) << stage->outputWaitSeconds
+            << std::setw(12) << stage->utilization(wallSeconds) * 100.0 << "%" << std::endl;
+    }
+    out << "Bottleneck: " << bottleneck().name << std::endl;
+    return out.str();
+}
+
+// ==============================
+// ConversionPipeline
+// ==============================
+
+/**
+ * @brief Batch convert multiple files through the staged pipeline
+ * @param srcFilePaths Source file path list (UTF-8)
+ * @param dstDir Target directory (UTF-8)
+ * @param dstFormat Target format
+ * @param processingOptions VTK processing options applied to every mesh
+ * @param writeOptions Target format write options
+ * @param pipelineOptions Stage threads and queue capacity
+ * @param[out] errorMap Output error information for each file (key=source file path, value=(errorCode, errorMsg))
+ * @param[out] report Output per-stage utilization
+ * @return Number of successfully converted files
+ */
+uint64_t ConversionPipeline::batchConvert(const std::vector<std::string>& srcFilePaths,
+                                          const std::string& dstDir,
+                                          MeshFormat dstFormat,
+                                          const VTKConverter::VTKProcessingOptions& processingOptions,
+                                          const FormatWriteOptions& writeOptions,
+                                          const PipelineOptions& pipelineOptions,
+                                          std::unordered_map<std::string, std::pair<MeshErrorCode, std::string>>& errorMap,
+                                          PipelineReport& report) {
+    const size_t readThreads = std::max<size_t>(1, pipelineOptions.readThreads);
+    const size_t writeThreads = std::max<size_t>(1, pipelineOptions.writeThreads);
+    size_t processThreads = pipelineOptions.processThreads;
+    if (processThreads == 0) {
+        const size_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+        processThreads = hardwareThreads > readThreads + writeThreads ? hardwareThreads - readThreads - writeThreads : 1;
+    }
+
+    report = PipelineReport();
+    report.read.name = "read";
+    report.read.threads = readThreads;
+    report.process.name = "process";
+    report.process.threads = processThreads;
+    report.write.name = "write";
+    report.write.threads = writeThreads;
+
+    // Ensure target directory exists
+    std::error_code dirError;
+    std::filesystem::create_directories(dstDir, dirError);
+    if (dirError && !std::filesystem::is_directory(dstDir)) {
+        errorMap.clear();
+        for (const auto& filePath : srcFilePaths) {
+            errorMap[filePath] = {MeshErrorCode::WRITE_FAILED, "Cannot create target directory: " + dstDir};
+        }
+        return 0;
+    }
+
+    // Incremental mode: the manifest of the previous runs decides which files can be skipped
+    ConversionManifest manifest;
+    uint64_t settingsHash = 0;
+    std::atomic<uint64_t> skippedCount{0};
+    if (pipelineOptions.incremental) {
+        manifest.load(pipelineOptions.manifestPath.empty() ? ConversionManifest::defaultPath(dstDir) : pipelineOptions.manifestPath);
+        settingsHash = ConversionManifest::settingsHash(dstFormat, writeOptions, pipelineOptions.readOptions,
+                                                        processingOptionsHash(processingOptions));
+    }
+
+    // Read largest inputs first so the longest conversions start early
+    std::vector<uint64_t> fileSizes(srcFilePaths.size(), 0);
+    for (size_t i = 0; i < srcFilePaths.size(); ++i) {
+        std::error_code sizeError;
+        const uintmax_t fileSize = std::filesystem::file_size(srcFilePaths[i], sizeError);
+        fileSizes[i] = sizeError ? 0 : static_cast<uint64_t>(fileSize);
+    }
+    std::vector<size_t> order(srcFilePaths.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&fileSizes](size_t a, size_t b) {
+        return fileSizes[a] > fileSizes[b];
+    });
+
+    BoundedQueue<PipelineItem> readQueue(pipelineOptions.queueCapacity);     // read → process
+    BoundedQueue<PipelineItem> processQueue(pipelineOptions.queueCapacity);  // process → write
+    std::atomic<size_t> nextFile{0};
+    std::atomic<size_t> readersLeft{readThreads};
+    std::atomic<size_t> processorsLeft{processThreads};
+    std::atomic<uint64_t> successCount{0};
+    std::mutex resultMutex;  // Guards errorMap and report
+
+    auto recordError = [&](const std::string& srcFilePath, MeshErrorCode errorCode, const std::string& errorMsg) {
+        std::lock_guard<std::mutex> lock(resultMutex);
+        errorMap[srcFilePath] = {errorCode, errorMsg};
+    };
+
+    auto readerLoop = [&]() {
+        StageClock clock;
+        for (;;) {
+            const size_t position = nextFile.fetch_add(1);
+            if (position >= order.size()) {
+                break;
+            }
+            const std::string& srcFilePath = srcFilePaths[order[position]];
+
+            Clock::time_point start = Clock::now();
+            MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+            std::string errorMsg;
+            PipelineItem item;
+            item.srcFilePath = &srcFilePath;
+            if (pipelineOptions.incremental
+                && manifest.lookup(srcFilePath, pipelineDstFilePath(srcFilePath, dstDir, dstFormat), settingsHash, item.source)) {
+                clock.busySeconds += secondsSince(start);
+                skippedCount++;
+                continue;
+            }
+            try {
+                if (!std::filesystem::exists(srcFilePath)) {
+                    errorCode = MeshErrorCode::FILE_NOT_EXIST;
+                    errorMsg = "Source file does not exist: " + srcFilePath;
+                } else {
+                    item.grid = MeshReader::readAutoToVTK(srcFilePath, errorCode, errorMsg, pipelineOptions.readOptions);
+                    if (item.grid && (item.grid->GetNumberOfPoints() == 0 || item.grid->GetNumberOfCells() == 0)) {
+                        item.grid = nullptr;
+                        errorCode = MeshErrorCode::MESH_EMPTY;
+                        errorMsg = "No points or cells found in VTK data";
+                    }
+                }
+            } catch (const std::exception& e) {
+                item.grid = nullptr;
+                errorCode = MeshErrorCode::READ_FAILED;
+                errorMsg = e.what();
+            }
+            clock.busySeconds += secondsSince(start);
+
+            if (!item.grid) {
+                clock.failures++;
+                if (pipelineOptions.incremental) {
+                    manifest.forget(srcFilePath);
+                }
+                recordError(srcFilePath, errorCode, "Read failed: " + errorMsg);
+                continue;
+            }
+            clock.items++;
+
+            start = Clock::now();
+            readQueue.push(std::move(item));
+            clock.outputWaitSeconds += secondsSince(start);
+        }
+        clock.mergeInto(report.read, resultMutex);
+        if (readersLeft.fetch_sub(1) == 1) {
+            readQueue.close();
+        }
+    };
+
+    auto processorLoop = [&]() {
+        StageClock clock;
+        for (;;) {
+            PipelineItem item;
+            Clock::time_point start = Clock::now();
+            const bool received = readQueue.pop(item);
+            clock.inputWaitSeconds += secondsSince(start);
+            if (!received) {
+                break;
+            }
+
+            start = Clock::now();
+            MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+            std::string errorMsg;
+            vtkSmartPointer<vtkUnstructuredGrid> processedGrid;
+            bool success = false;
+            try {
+                success = VTKConverter::processVTKData(item.grid, processingOptions, processedGrid, errorCode, errorMsg);
+            } catch (const std::exception& e) {
+                errorCode = MeshErrorCode::PARAM_INVALID;
+                errorMsg = e.what();
+            }
+            item.grid = nullptr;  // Release the unprocessed mesh before waiting on the writer
+            clock.busySeconds += secondsSince(start);
+
+            if (!success || !processedGrid) {
+                clock.failures++;
+                if (pipelineOptions.incremental) {
+                    manifest.forget(*item.srcFilePath);
+                }
+                recordError(*item.srcFilePath, errorCode, "Processing failed: " + errorMsg);
+                continue;
+            }
+            clock.items++;
+
+            item.grid = processedGrid;
+            start = Clock::now();
+            processQueue.push(std::move(item));
+            clock.outputWaitSeconds += secondsSince(start);
+        }
+        clock.mergeInto(report.process, resultMutex);
+        if (processorsLeft.fetch_sub(1) == 1) {
+            processQueue.close();
+        }
+    };
+
+    auto writerLoop = [&]() {
+        StageClock clock;
+        for (;;) {
+            PipelineItem item;
+            Clock::time_point start = Clock::now();
+            const bool received = processQueue.pop(item);
+            clock.inputWaitSeconds += secondsSince(start);
+            if (!received) {
+                break;
+            }
+
+            start = Clock::now();
+            const std::string dstFilePath = pipelineDstFilePath(*item.srcFilePath, dstDir, dstFormat);
+            MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+            std::string errorMsg;
+            bool success = false;
+            try {
+                success = VTKConverter::convertFromVTK(item.grid, dstFilePath, dstFormat, writeOptions, errorCode, errorMsg);
+            } catch (const std::exception& e) {
+                errorCode = MeshErrorCode::WRITE_FAILED;
+                errorMsg = e.what();
+            }
+            item.grid = nullptr;
+            clock.busySeconds += secondsSince(start);
+
+            if (pipelineOptions.incremental) {
+                if (success) {
+                    item.source.dstFilePath = dstFilePath;
+                    manifest.record(*item.srcFilePath, std::move(item.source));
+                } else {
+                    manifest.forget(*item.srcFilePath);
+                }
+            }
+            if (!success) {
+                clock.failures++;
+                recordError(*item.srcFilePath, errorCode, "Write failed: " + errorMsg);
+                continue;
+            }
+            clock.items++;
+            successCount++;
+        }
+        clock.mergeInto(report.write, resultMutex);
+    };
+
+    // Dedicated stage threads: they block on the queues, so they must not occupy TaskPool workers
+    const Clock::time_point batchStart = Clock::now();
+    std::vector<std::thread> threads;
+    threads.reserve(readThreads + processThreads + writeThreads);
+    for (size_t i = 0; i < readThreads; ++i) {
+        threads.emplace_back(readerLoop);
+    }
+    for (size_t i = 0; i < processThreads; ++i) {
+        threads.emplace_back(processorLoop);
+    }
+    for (size_t i = 0; i < writeThreads; ++i) {
+        threads.emplace_back(writerLoop);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    report.wallSeconds = secondsSince(batchStart);
+    report.skipped = skippedCount.load();
+
+    // A manifest that cannot be saved only costs the next run its skips
+    if (pipelineOptions.incremental) {
+        std::string manifestError;
+        manifest.save(manifestError);
+    }
+
+    return successCount.load() + report.skipped;
+}
@@ -0,0 +1,119 @@
+#include "JobControl.h"
+#include <algorithm>
+
+namespace {
+
+thread_local JobControl::Context currentContext;  // Job and innermost step of this thread
+
+} // namespace
+
+// ==============================
+// JobControl
+// ==============================
+
+/**
+ * @brief Bind a context to the calling thread
+ * @param context Job and innermost step
+ */
+JobControl::Binding::Binding(const Context& context) : previous_(currentContext) {
+    currentContext = context;
+}
+
+/**
+ * @brief Restore the context that was bound before
+ */
+JobControl::Binding::~Binding() {
+    currentContext = previous_;
+}
+
+/**
+ * @brief Raise the progress (never lowers it, so reports from parallel workers may race)
+ * @param fraction Completed fraction (clamped to [0, 1])
+ */
+void JobControl::raiseProgress(double fraction) {
+    fraction = std::min(1.0, std::max(0.0, fraction));
+    double current = progress_.load(std::memory_order_relaxed);
+    while (current < fraction && !progress_.compare_exchange_weak(current, fraction, std::memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @brief Context bound to the calling thread (empty outside jobs)
+ */
+JobControl::Context JobControl::context() {
+    return currentContext;
+}
+
+/**
+ * @brief Chunk boundary: throw JobCancelled if the job of the calling thread was cancelled
+ */
+void JobControl::checkpoint() {
+    if (currentContext.job && currentContext.job->isCancelled()) {
+        throw JobCancelled();
+    }
+}
+
+// ==============================
+// JobStep
+// ==============================
+
+/**
+ * @brief Open a step inside the innermost step of the calling thread and make it the innermost one
+ * @param begin Start of the step as a fraction of the enclosing step
+ * @param end End of the step as a fraction of the enclosing step
+ */
+JobStep::JobStep(double begin, double end) : previous_(currentContext) {
+    JobStep* parent = previous_.step;
+    if (!parent || !parent->job_) {
+        return;
+    }
+    job_ = parent->job_;
+    base_ = parent->base_ + parent->span_ * begin;
+    span_ = parent->span_ * std::max(0.0, end - begin);
+    currentContext.step = this;
+    bound_ = true;
+}
+
+/**
+ * @brief Root step of a job covering its whole progress scale (not bound to any thread)
+ * @param job Job whose progress the step drives
+ */
+JobStep::JobStep(JobControl& job) : job_(&job), base_(0.0), span_(1.0) {}
+
+/**
+ * @brief Move the job to the end of the step and restore the enclosing step
+ * The root step leaves the final progress to the job runner, and cancelled jobs keep theirs.
+ */
+JobStep::~JobStep() {
+    if (bound_) {
+        if (!job_->isCancelled()) {
+            job_->raiseProgress(base_ + span_);
+        }
+        currentContext = previous_;
+    }
+}
+
+/**
+ * @brief Credit completed work units (thread-safe)
+ * @param units Units completed since the last call
+ */
+void JobStep::advance(uint64_t units) {
+    if (!job_) {
+        return;
+    }
+    const uint64_t done = doneUnits_.fetch_add(units, std::memory_order_relaxed) + units;
+    const uint64_t total = totalUnits_.load(std::memory_order_relaxed);
+    if (total > 0) {
+        setFraction(static_cast<double>(done) / static_cast<double>(total));
+    }
+}
+
+/**
+ * @brief Report the completed fraction directly (e.g. from a VTK progress event)
+ * @param fraction Completed fraction of the step
+ */
+void JobStep::setFraction(double fraction) {
+    if (job_) {
+        job_->raiseProgress(base_ + span_ * std::min(1.0, std::max(0.0, fraction)));
+    }
+}
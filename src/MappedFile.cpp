@@ -0,0 +1,179 @@
+#include "MappedFile.h"
+
+#include <algorithm>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Destructor, releases the mapping
+ */
+MappedFile::~MappedFile() {
+    close();
+}
+
+/**
+ * @brief Move constructor
+ * @param other Mapping to take over
+ */
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+/**
+ * @brief Move assignment
+ * @param other Mapping to take over
+ * @return This object
+ */
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        opened_ = std::exchange(other.opened_, false);
+#ifdef _WIN32
+        fileHandle_ = std::exchange(other.fileHandle_, nullptr);
+        mappingHandle_ = std::exchange(other.mappingHandle_, nullptr);
+#endif
+    }
+    return *this;
+}
+
+/**
+ * @brief Map a whole file read-only
+ * @param filePath File path (UTF-8 encoded)
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @return Whether mapping is successful
+ */
+bool MappedFile::open(const std::string& filePath, std::string& errorMsg) {
+    close();
+
+#ifdef _WIN32
+    int wideSize = MultiByteToWideChar(CP_UTF8, 0, filePath.c_str(), static_cast<int>(filePath.size()), NULL, 0);
+    std::wstring widePath(wideSize, 0);
+    MultiByteToWideChar(CP_UTF8, 0, filePath.c_str(), static_cast<int>(filePath.size()), &widePath[0], wideSize);
+
+    HANDLE file = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        errorMsg = "Failed to open file: " + filePath;
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        errorMsg = "Failed to query file size: " + filePath;
+        return false;
+    }
+
+    fileHandle_ = file;
+    size_ = static_cast<size_t>(fileSize.QuadPart);
+    if (size_ > 0) {
+        HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (!mapping) {
+            close();
+            errorMsg = "Failed to create file mapping: " + filePath;
+            return false;
+        }
+        mappingHandle_ = mapping;
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            close();
+            errorMsg = "Failed to map file: " + filePath;
+            return false;
+        }
+        data_ = static_cast<const char*>(view);
+    }
+#else
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        errorMsg = "Failed to open file: " + filePath;
+        return false;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0) {
+        ::close(fd);
+        errorMsg = "Failed to query file size: " + filePath;
+        return false;
+    }
+
+    size_ = static_cast<size_t>(fileStat.st_size);
+    if (size_ > 0) {
+        void* view = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view == MAP_FAILED) {
+            ::close(fd);
+            size_ = 0;
+            errorMsg = "Failed to map file: " + filePath;
+            return false;
+        }
+        // Readers scan front to back
+        madvise(view, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(view);
+    }
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+#endif
+
+    opened_ = true;
+    return true;
+}
+
+/**
+ * @brief Release the mapping
+ */
+void MappedFile::close() {
+#ifdef _WIN32
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mappingHandle_) {
+        CloseHandle(static_cast<HANDLE>(mappingHandle_));
+    }
+    if (fileHandle_) {
+        CloseHandle(static_cast<HANDLE>(fileHandle_));
+    }
+    mappingHandle_ = nullptr;
+    fileHandle_ = nullptr;
+#else
+    if (data_) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    opened_ = false;
+}
+
+/**
+ * @brief Tell the OS that a range will not be read again (streaming readers)
+ * @param offset First byte of the range
+ * @param length Length of the range in bytes
+ */
+void MappedFile::discard(size_t offset, size_t length) {
+    if (!data_ || offset >= size_) {
+        return;
+    }
+    length = (std::min)(length, size_ - offset);  // Parenthesized against the windows.h min macro
+#ifdef _WIN32
+    // Unlocking an unlocked range just removes the pages from the working set
+    VirtualUnlock(const_cast<char*>(data_) + offset, length);
+#else
+    // Only whole pages inside the range can be dropped
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t first = (offset + pageSize - 1) / pageSize * pageSize;
+    const size_t last = (offset + length) / pageSize * pageSize;
+    if (last > first) {
+        madvise(const_cast<char*>(data_) + first, last - first, MADV_DONTNEED);
+    }
+#endif
+}
@@ -0,0 +1,937 @@
+#include "MeshCache.h"
+#include "MappedFile.h"
+#include "MeshReader.h"
+#include "OutputBuffer.h"
+#include "ParallelFor.h"
+#include "TextTokenizer.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vtkLZ4DataCompressor.h>
+#include <vtkNew.h>
+
+namespace {
+
+constexpr char MCB_MAGIC[8] = {'M', 'C', 'B', 'M', 'E', 'S', 'H', '\0'};
+constexpr uint32_t MCB_VERSION = 1;
+constexpr uint32_t MCB_BYTE_ORDER = 0x01020304;   // Reads back differently on a big-endian host
+constexpr uint32_t FLAG_DOUBLE_POINTS = 1u << 0;  // Coordinates are float64 (else float32)
+constexpr uint32_t FLAG_INDEX64 = 1u << 1;        // Offsets and connectivity are uint64 (else uint32)
+
+// Payloads start at multiples of this (cache lines; keeps mapped arrays aligned for any element type)
+constexpr uint64_t SECTION_ALIGNMENT = 64;
+
+// Bytes per independently compressed block, and the smallest section worth compressing
+constexpr size_t COMPRESSION_BLOCK_BYTES = 4 * 1024 * 1024;
+constexpr size_t COMPRESSION_MIN_BYTES = 64 * 1024;
+
+// Bytes per task when an uncompressed section is copied out of the mapping
+constexpr size_t COPY_BYTES_PER_TASK = 16 * 1024 * 1024;
+
+/**
+ * @brief Fixed file header (little-endian)
+ */
+struct McbHeader {
+    char magic[8];            // MCB_MAGIC
+    uint32_t version;         // MCB_VERSION
+    uint32_t flags;           // FLAG_* layout bits
+    uint32_t byteOrder;       // MCB_BYTE_ORDER as written
+    uint32_t sectionCount;    // Entries in the table of contents
+    uint64_t tocOffset;       // File offset of the table of contents
+    uint64_t pointCount;      // Points of the mesh
+    uint64_t cellCount;       // Cells of the mesh
+    uint64_t sourceSize;      // Source file size (cache files)
+    int64_t sourceModified;   // Source modification time (cache files)
+    uint64_t optionsHash;     // Read options fingerprint (cache files)
+    uint64_t reserved[7];     // Zero
+};
+static_assert(sizeof(McbHeader) == 128, "McbHeader layout");
+
+/**
+ * @brief Section kinds
+ */
+enum class SectionKind : uint32_t {
+    POINTS = 1,             // xyz of every point
+    CELL_TYPES = 2,         // One byte per cell
+    CELL_OFFSETS = 3,       // cellCount + 1 offsets
+    CELL_CONNECTIVITY = 4,  // Point indices of all cells
+    POINT_DATA = 5,         // One point attribute (named)
+    CELL_DATA = 6,          // One cell attribute (named)
+    METADATA = 7,           // Serialized MeshMetadata
+    SOURCE_PATH = 8         // Absolute source path (cache files)
+};
+
+/**
+ * @brief Section codecs
+ */
+enum class SectionCodec : uint8_t {
+    RAW = 0,  // Payload is the array bytes
+    LZ4 = 1   // Payload is uint32 compressed block sizes followed by the LZ4 blocks
+};
+
+/**
+ * @brief Table of contents entry
+ */
+struct McbSection {
+    uint32_t kind;         // SectionKind
+    uint8_t codec;         // SectionCodec
+    uint8_t elementType;   // AttributeType of attribute sections
+    uint16_t reserved;     // Zero
+    uint32_t components;   // Components per tuple of attribute sections
+    uint32_t nameLength;   // Attribute name bytes
+    uint64_t nameOffset;   // File offset of the attribute name
+    uint64_t offset;       // File offset of the payload
+    uint64_t storedBytes;  // Payload bytes
+    uint64_t rawBytes;     // Array bytes after decompression
+};
+static_assert(sizeof(McbSection) == 48, "McbSection layout");
+
+/**
+ * @brief Section being written: its entry, the array it stores and the compressed payload if any
+ */
+struct PendingSection {
+    McbSection entry{};
+    const void* data = nullptr; // Array bytes
+    std::string name;           // Attribute name
+    std::vector<char> packed;   // Compressed payload (empty = stored raw)
+};
+
+/**
+ * @brief FNV-1a hash (cache file names and read option fingerprints)
+ */
+class Fnv1a {
+public:
+    void add(const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash_ = (hash_ ^ bytes[i]) * 0x100000001b3ull;
+        }
+    }
+    template<typename T>
+    void addValue(const T& value) { add(&value, sizeof(T)); }
+    uint64_t value() const { return hash_; }
+
+private:
+    uint64_t hash_ = 0xcbf29ce484222325ull;
+};
+
+/**
+ * @brief Append-only little-endian serializer of the metadata section
+ */
+class BlobWriter {
+public:
+    template<typename T>
+    void put(T value) { bytes_.append(reinterpret_cast<const char*>(&value), sizeof(T)); }
+    void putString(const std::string& text) {
+        put<uint64_t>(text.size());
+        bytes_.append(text);
+    }
+    void putStrings(const std::vector<std::string>& texts) {
+        put<uint64_t>(texts.size());
+        for (const std::string& text : texts) {
+            putString(text);
+        }
+    }
+    const std::string& bytes() const { return bytes_; }
+
+private:
+    std::string bytes_;
+};
+
+/**
+ * @brief Bounds-checked reader of the metadata section (throws std::runtime_error when truncated)
+ */
+class BlobReader {
+public:
+    BlobReader(const char* data, size_t size) : cur_(data), end_(data + size) {}
+
+    template<typename T>
+    T get() {
+        require(sizeof(T));
+        T value;
+        std::memcpy(&value, cur_, sizeof(T));
+        cur_ += sizeof(T);
+        return value;
+    }
+    std::string getString() {
+        const uint64_t size = get<uint64_t>();
+        require(size);
+        std::string text(cur_, static_cast<size_t>(size));
+        cur_ += size;
+        return text;
+    }
+    std::vector<std::string> getStrings() {
+        const uint64_t count = get<uint64_t>();
+        require(count * sizeof(uint64_t));
+        std::vector<std::string> texts(static_cast<size_t>(count));
+        for (std::string& text : texts) {
+            text = getString();
+        }
+        return texts;
+    }
+
+private:
+    void require(uint64_t bytes) const {
+        if (bytes > static_cast<uint64_t>(end_ - cur_)) {
+            throw std::runtime_error("truncated metadata section");
+        }
+    }
+
+    const char* cur_;
+    const char* end_;
+};
+
+/**
+ * @brief Serialize the metadata (counts are taken from the header on load)
+ */
+std::string serializeMetadata(const MeshMetadata& metadata) {
+    BlobWriter blob;
+    blob.putString(metadata.fileName);
+    blob.put<int32_t>(static_cast<int32_t>(metadata.meshType));
+    blob.put<int32_t>(static_cast<int32_t>(metadata.format));
+    blob.put<uint64_t>(metadata.cellTypeCount.size());
+    for (const auto& [type, count] : metadata.cellTypeCount) {
+        blob.put<uint8_t>(static_cast<uint8_t>(type));
+        blob.put<uint64_t>(count);
+    }
+    blob.putStrings(metadata.physicalRegions);
+    blob.put<uint64_t>(metadata.physicalRegionTags.size());
+    for (int tag : metadata.physicalRegionTags) {
+        blob.put<int32_t>(tag);
+    }
+    blob.putStrings(metadata.physicalRegionTypes);
+    blob.putStrings(metadata.pointDataNames);
+    blob.putStrings(metadata.cellDataNames);
+    blob.putString(metadata.formatVersion);
+    blob.putString(metadata.blockName);
+    blob.put<uint64_t>(metadata.sourceBytes);
+    return blob.bytes();
+}
+
+/**
+ * @brief Restore the metadata written by serializeMetadata
+ */
+void deserializeMetadata(const char* data, size_t size, MeshMetadata& metadata) {
+    BlobReader blob(data, size);
+    metadata.fileName = blob.getString();
+    metadata.meshType = static_cast<MeshType>(blob.get<int32_t>());
+    metadata.format = static_cast<MeshFormat>(blob.get<int32_t>());
+    const uint64_t typeCount = blob.get<uint64_t>();
+    metadata.cellTypeCount.clear();
+    for (uint64_t i = 0; i < typeCount; ++i) {
+        const VtkCellType type = static_cast<VtkCellType>(blob.get<uint8_t>());
+        metadata.cellTypeCount[type] = blob.get<uint64_t>();
+    }
+    metadata.physicalRegions = blob.getStrings();
+    metadata.physicalRegionTags.resize(static_cast<size_t>(blob.get<uint64_t>()));
+    for (int& tag : metadata.physicalRegionTags) {
+        tag = blob.get<int32_t>();
+    }
+    metadata.physicalRegionTypes = blob.getStrings();
+    metadata.pointDataNames = blob.getStrings();
+    metadata.cellDataNames = blob.getStrings();
+    metadata.formatVersion = blob.getString();
+    metadata.blockName = blob.getString();
+    metadata.sourceBytes = blob.get<uint64_t>();
+}
+
+/**
+ * @brief Compress a section in independent LZ4 blocks on parallel threads
+ * @param section Section (packed is filled, left empty if compression does not pay off)
+ * @param threads Compression threads
+ */
+void compressSection(PendingSection& section, unsigned int threads) {
+    const size_t rawBytes = static_cast<size_t>(section.entry.rawBytes);
+    const size_t blockCount = (rawBytes + COMPRESSION_BLOCK_BYTES - 1) / COMPRESSION_BLOCK_BYTES;
+    std::vector<std::vector<char>> blocks(blockCount);
+    const unsigned char* source = static_cast<const unsigned char*>(section.data);
+    std::vector<char> blockFailed(blockCount, 0);
+    parallelForRanges(blockCount, parallelTaskCount(blockCount, 1, threads), [&](size_t begin, size_t end, size_t) {
+        vtkNew<vtkLZ4DataCompressor> compressor;
+        for (size_t b = begin; b < end; ++b) {
+            const size_t offset = b * COMPRESSION_BLOCK_BYTES;
+            const size_t size = std::min(COMPRESSION_BLOCK_BYTES, rawBytes - offset);
+            blocks[b].resize(compressor->GetMaximumCompressionSpace(size));
+            const size_t packed = compressor->Compress(source + offset, size,
+                                                       reinterpret_cast<unsigned char*>(blocks[b].data()), blocks[b].size());
+            blockFailed[b] = packed == 0;
+            blocks[b].resize(packed);
+        }
+    });
+    const bool failed = std::find(blockFailed.begin(), blockFailed.end(), 1) != blockFailed.end();
+
+    size_t storedBytes = blockCount * sizeof(uint32_t);
+    for (const std::vector<char>& block : blocks) {
+        storedBytes += block.size();
+    }
+    if (failed || storedBytes >= rawBytes) {
+        return;
+    }
+    section.packed.resize(storedBytes);
+    char* out = section.packed.data();
+    for (const std::vector<char>& block : blocks) {
+        const uint32_t size = static_cast<uint32_t>(block.size());
+        std::memcpy(out, &size, sizeof(size));
+        out += sizeof(size);
+    }
+    for (const std::vector<char>& block : blocks) {
+        std::memcpy(out, block.data(), block.size());
+        out += block.size();
+    }
+    section.entry.codec = static_cast<uint8_t>(SectionCodec::LZ4);
+    section.entry.storedBytes = storedBytes;
+}
+
+/**
+ * @brief Copy or decompress a section payload into its array
+ * @param file Mapped file
+ * @param section Table of contents entry (bounds already validated)
+ * @param destination Array of section.rawBytes bytes
+ * @param threads Worker threads
+ */
+void decodeSection(const MappedFile& file, const McbSection& section, void* destination, unsigned int threads) {
+    const char* payload = file.data() + section.offset;
+    char* target = static_cast<char*>(destination);
+    const size_t rawBytes = static_cast<size_t>(section.rawBytes);
+    if (section.codec == static_cast<uint8_t>(SectionCodec::RAW)) {
+        parallelForRanges(rawBytes, parallelTaskCount(rawBytes, COPY_BYTES_PER_TASK, threads), [&](size_t begin, size_t end, size_t) {
+            std::memcpy(target + begin, payload + begin, end - begin);
+        });
+        return;
+    }
+    if (section.codec != static_cast<uint8_t>(SectionCodec::LZ4)) {
+        throw std::runtime_error("unknown section codec " + std::to_string(section.codec));
+    }
+
+    const size_t blockCount = (rawBytes + COMPRESSION_BLOCK_BYTES - 1) / COMPRESSION_BLOCK_BYTES;
+    if (blockCount * sizeof(uint32_t) > section.storedBytes) {
+        throw std::runtime_error("truncated compressed section");
+    }
+    std::vector<uint64_t> blockOffset(blockCount + 1, blockCount * sizeof(uint32_t));
+    for (size_t b = 0; b < blockCount; ++b) {
+        uint32_t size;
+        std::memcpy(&size, payload + b * sizeof(uint32_t), sizeof(size));
+        blockOffset[b + 1] = blockOffset[b] + size;
+    }
+    if (blockOffset.back() > section.storedBytes) {
+        throw std::runtime_error("truncated compressed section");
+    }
+    std::vector<char> blockFailed(blockCount, 0);
+    parallelForRanges(blockCount, parallelTaskCount(blockCount, 1, threads), [&](size_t begin, size_t end, size_t) {
+        vtkNew<vtkLZ4DataCompressor> compressor;
+        for (size_t b = begin; b < end; ++b) {
+            const size_t size = std::min(COMPRESSION_BLOCK_BYTES, rawBytes - b * COMPRESSION_BLOCK_BYTES);
+            const size_t unpacked = compressor->Uncompress(
+                reinterpret_cast<const unsigned char*>(payload + blockOffset[b]), static_cast<size_t>(blockOffset[b + 1] - blockOffset[b]),
+                reinterpret_cast<unsigned char*>(target + b * COMPRESSION_BLOCK_BYTES), size);
+            blockFailed[b] = unpacked != size;
+        }
+    });
+    if (std::find(blockFailed.begin(), blockFailed.end(), 1) != blockFailed.end()) {
+        throw std::runtime_error("corrupt compressed section");
+    }
+}
+
+/**
+ * @brief Load an array section stored with element type Stored into a vector of Target
+ * Same types are decoded in place; otherwise the values are converted (integer targets must hold every value).
+ */
+template<typename Stored, typename Target>
+void loadArray(const MappedFile& file, const McbSection& section, size_t count, std::vector<Target>& values, unsigned int threads) {
+    if (section.rawBytes != count * sizeof(Stored)) {
+        throw std::runtime_error("section size does not match the mesh counts");
+    }
+    values.resize(count);
+    if constexpr (std::is_same_v<Stored, Target>) {
+        decodeSection(file, section, values.data(), threads);
+    } else {
+        std::vector<Stored> stored(count);
+        decodeSection(file, section, stored.data(), threads);
+        if constexpr (std::is_integral_v<Target> && sizeof(Target) < sizeof(Stored)) {
+            if (std::any_of(stored.begin(), stored.end(), [](Stored value) {
+                    return value > static_cast<Stored>(std::numeric_limits<Target>::max()); })) {
+                throw std::runtime_error("indices exceed the 32-bit range; read into MeshData64");
+            }
+        }
+        std::transform(stored.begin(), stored.end(), values.begin(), [](Stored value) { return static_cast<Target>(value); });
+    }
+}
+
+/**
+ * @brief Validated header and table of contents of a mapped cache file
+ */
+struct McbContents {
+    McbHeader header{};
+    std::vector<McbSection> sections;
+};
+
+/**
+ * @brief Validate the header and every section range of a mapped file
+ * @param file Mapped file
+ * @param[out] contents Header and table of contents
+ */
+void readContents(const MappedFile& file, McbContents& contents) {
+    if (file.size() < sizeof(McbHeader)) {
+        throw std::runtime_error("file too small for a mesh cache header");
+    }
+    std::memcpy(&contents.header, file.data(), sizeof(McbHeader));
+    const McbHeader& header = contents.header;
+    if (std::memcmp(header.magic, MCB_MAGIC, sizeof(MCB_MAGIC)) != 0) {
+        throw std::runtime_error("not a mesh cache file");
+    }
+    if (header.byteOrder != MCB_BYTE_ORDER) {
+        throw std::runtime_error("mesh cache was written with a different byte order");
+    }
+    if (header.version != MCB_VERSION) {
+        throw std::runtime_error("unsupported mesh cache version " + std::to_string(header.version));
+    }
+    const uint64_t size = file.size();
+    if (header.tocOffset > size || header.sectionCount > (size - header.tocOffset) / sizeof(McbSection)) {
+        throw std::runtime_error("truncated table of contents");
+    }
+    contents.sections.resize(header.sectionCount);
+    std::memcpy(contents.sections.data(), file.data() + header.tocOffset, header.sectionCount * sizeof(McbSection));
+    for (const McbSection& section : contents.sections) {
+        if (section.offset > size || section.storedBytes > size - section.offset
+            || section.nameOffset > size || section.nameLength > size - section.nameOffset
+            || (section.codec == static_cast<uint8_t>(SectionCodec::RAW) && section.storedBytes != section.rawBytes)) {
+            throw std::runtime_error("section exceeds the file");
+        }
+    }
+}
+
+/**
+ * @brief Fingerprint of the read options that change the mesh a reader produces
+ */
+uint64_t readOptionsHash(const FormatReadOptions& options) {
+    Fnv1a hash;
+    hash.addValue(options.stlWeldVertices);
+    hash.addValue(options.cgnsBase);
+    hash.add(options.cgnsZones.data(), options.cgnsZones.size() * sizeof(int));
+    hash.addValue(options.openFoamPatches);
+    hash.addValue(options.weldPoints);
+    hash.addValue(options.weldPoints ? options.weldTolerance : 0.0f);
+    return hash.value();
+}
+
+/**
+ * @brief Absolute, normalized UTF-8 form of a path (the identity of a source in the cache)
+ */
+std::string absoluteSourcePath(const std::string& sourcePath) {
+    std::error_code ec;
+    std::filesystem::path path = std::filesystem::absolute(std::filesystem::u8path(sourcePath), ec);
+    if (ec) {
+        path = std::filesystem::u8path(sourcePath);
+    }
+    return path.lexically_normal().u8string();
+}
+
+} // namespace
+
+/**
+ * @brief Write a mesh cache file
+ * @param meshData Input mesh data
+ * @param filePath Output file path (UTF-8 encoded)
+ * @param options Write options (compress, formatThreads)
+ * @param source Source identity recorded in the header
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @return Whether writing is successful
+ */
+template<typename Real, typename Index>
+bool MeshCache::writeFile(const BasicMeshData<Real, Index>& meshData,
+                          const std::string& filePath,
+                          const FormatWriteOptions& options,
+                          const SourceKey& source,
+                          MeshErrorCode& errorCode,
+                          std::string& errorMsg) {
+    const size_t pointCount = meshData.points.size() / 3;
+    const size_t cellCount = meshData.cells.size();
+    if (meshData.cells.offsets.size() != cellCount + 1 || meshData.cells.offsets.back() != meshData.cells.connectivity.size()) {
+        errorCode = MeshErrorCode::PARAM_INVALID;
+        errorMsg = "Cell offsets do not match the connectivity";
+        return false;
+    }
+
+    // 1. Sections in file order (attributes sorted by name so equal meshes give equal files)
+    std::vector<PendingSection> sections;
+    auto addSection = [&](SectionKind kind, const void* data, size_t bytes) -> PendingSection& {
+        PendingSection& section = sections.emplace_back();
+        section.entry.kind = static_cast<uint32_t>(kind);
+        section.entry.rawBytes = bytes;
+        section.entry.storedBytes = bytes;
+        section.data = data;
+        return section;
+    };
+    addSection(SectionKind::POINTS, meshData.points.data(), pointCount * 3 * sizeof(Real));
+    addSection(SectionKind::CELL_TYPES, meshData.cells.types.data(), cellCount * sizeof(VtkCellType));
+    addSection(SectionKind::CELL_OFFSETS, meshData.cells.offsets.data(), (cellCount + 1) * sizeof(Index));
+    addSection(SectionKind::CELL_CONNECTIVITY, meshData.cells.connectivity.data(), meshData.cells.connectivity.size() * sizeof(Index));
+    auto addAttributes = [&](SectionKind kind, const AttributeMap& attributes) {
+        std::vector<const std::pair<const std::string, MeshAttribute>*> sorted;
+        for (const auto& entry : attributes) {
+            sorted.push_back(&entry);
+        }
+        std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+        for (const auto* entry : sorted) {
+            const MeshAttribute& attribute = entry->second;
+            PendingSection& section = addSection(kind, attribute.data(), attribute.size() * attribute.elementSize());
+            section.entry.elementType = static_cast<uint8_t>(attribute.type());
+            section.entry.components = static_cast<uint32_t>(attribute.components());
+            section.name = entry->first;
+        }
+    };
+    addAttributes(SectionKind::POINT_DATA, meshData.pointData);
+    addAttributes(SectionKind::CELL_DATA, meshData.cellData);
+    const std::string metadata = serializeMetadata(meshData.metadata);
+    addSection(SectionKind::METADATA, metadata.data(), metadata.size());
+    if (!source.path.empty()) {
+        addSection(SectionKind::SOURCE_PATH, source.path.data(), source.path.size());
+    }
+
+    // 2. Optional LZ4 compression of the large arrays
+    if (options.compress) {
+        for (PendingSection& section : sections) {
+            if (section.entry.rawBytes >= COMPRESSION_MIN_BYTES) {
+                compressSection(section, options.formatThreads);
+            }
+        }
+    }
+
+    // 3. Layout: header, table of contents, attribute names, aligned payloads
+    McbHeader header{};
+    std::memcpy(header.magic, MCB_MAGIC, sizeof(MCB_MAGIC));
+    header.version = MCB_VERSION;
+    header.flags = (sizeof(Real) == sizeof(double) ? FLAG_DOUBLE_POINTS : 0u) | (sizeof(Index) == sizeof(uint64_t) ? FLAG_INDEX64 : 0u);
+    header.byteOrder = MCB_BYTE_ORDER;
+    header.sectionCount = static_cast<uint32_t>(sections.size());
+    header.tocOffset = sizeof(McbHeader);
+    header.pointCount = pointCount;
+    header.cellCount = cellCount;
+    header.sourceSize = source.size;
+    header.sourceModified = source.modified;
+    header.optionsHash = source.optionsHash;
+
+    uint64_t offset = header.tocOffset + sections.size() * sizeof(McbSection);
+    for (PendingSection& section : sections) {
+        section.entry.nameOffset = offset;
+        section.entry.nameLength = static_cast<uint32_t>(section.name.size());
+        offset += section.name.size();
+    }
+    for (PendingSection& section : sections) {
+        offset = (offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+        section.entry.offset = offset;
+        offset += section.entry.storedBytes;
+    }
+
+    // 4. Write (large payloads go straight from the mesh arrays to the file)
+    OutputBuffer out;
+    if (!out.open(filePath, errorMsg)) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        return false;
+    }
+    out.appendBinary(header);
+    for (const PendingSection& section : sections) {
+        out.appendBinary(section.entry);
+    }
+    for (const PendingSection& section : sections) {
+        out.append(section.name);
+    }
+    static const char padding[SECTION_ALIGNMENT] = {};
+    for (const PendingSection& section : sections) {
+        out.append(padding, static_cast<size_t>(section.entry.offset - out.bytesWritten()));
+        if (section.packed.empty()) {
+            out.append(section.data, static_cast<size_t>(section.entry.rawBytes));
+        } else {
+            out.append(section.packed.data(), section.packed.size());
+        }
+    }
+    if (!out.close(errorMsg)) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        return false;
+    }
+    errorCode = MeshErrorCode::SUCCESS;
+    errorMsg.clear();
+    return true;
+}
+
+template bool MeshCache::writeFile(const MeshData&, const std::string&, const FormatWriteOptions&, const SourceKey&, MeshErrorCode&, std::string&);
+template bool MeshCache::writeFile(const MeshData64&, const std::string&, const FormatWriteOptions&, const SourceKey&, MeshErrorCode&, std::string&);
+
+/**
+ * @brief Read a mesh cache file
+ * @param filePath File path (UTF-8 encoded)
+ * @param[out] meshData Output mesh data
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @param threads Decompression threads
+ * @return Whether reading is successful
+ */
+template<typename Real, typename Index>
+bool MeshCache::readFile(const std::string& filePath,
+                         BasicMeshData<Real, Index>& meshData,
+                         MeshErrorCode& errorCode,
+                         std::string& errorMsg,
+                         unsigned int threads) {
+    meshData.clear();
+    const auto startTime = std::chrono::steady_clock::now();
+    MappedFile file;
+    if (!file.open(filePath, errorMsg)) {
+        errorCode = MeshErrorCode::READ_FAILED;
+        return false;
+    }
+
+    try {
+        McbContents contents;
+        readContents(file, contents);
+        const McbHeader& header = contents.header;
+        const bool doublePoints = (header.flags & FLAG_DOUBLE_POINTS) != 0;
+        const bool index64 = (header.flags & FLAG_INDEX64) != 0;
+        if (header.pointCount > std::numeric_limits<size_t>::max() / 3
+            || (sizeof(Index) < sizeof(uint64_t) && header.pointCount > std::numeric_limits<Index>::max())) {
+            throw std::runtime_error("point count exceeds the index range; read into MeshData64");
+        }
+        const size_t pointCount = static_cast<size_t>(header.pointCount);
+        const size_t cellCount = static_cast<size_t>(header.cellCount);
+        const size_t indexBytes = index64 ? sizeof(uint64_t) : sizeof(uint32_t);
+
+        bool hasPoints = false;
+        bool hasTypes = false;
+        bool hasOffsets = false;
+        bool hasConnectivity = false;
+        for (const McbSection& section : contents.sections) {
+            switch (static_cast<SectionKind>(section.kind)) {
+                case SectionKind::POINTS:
+                    if (doublePoints) {
+                        loadArray<double>(file, section, pointCount * 3, meshData.points, threads);
+                    } else {
+                        loadArray<float>(file, section, pointCount * 3, meshData.points, threads);
+                    }
+                    hasPoints = true;
+                    break;
+                case SectionKind::CELL_TYPES:
+                    loadArray<VtkCellType>(file, section, cellCount, meshData.cells.types, threads);
+                    hasTypes = true;
+                    break;
+                case SectionKind::CELL_OFFSETS:
+                    if (index64) {
+                        loadArray<uint64_t>(file, section, cellCount + 1, meshData.cells.offsets, threads);
+                    } else {
+                        loadArray<uint32_t>(file, section, cellCount + 1, meshData.cells.offsets, threads);
+                    }
+                    hasOffsets = true;
+                    break;
+                case SectionKind::CELL_CONNECTIVITY: {
+                    const size_t count = static_cast<size_t>(section.rawBytes / indexBytes);
+                    if (index64) {
+                        loadArray<uint64_t>(file, section, count, meshData.cells.connectivity, threads);
+                    } else {
+                        loadArray<uint32_t>(file, section, count, meshData.cells.connectivity, threads);
+                    }
+                    hasConnectivity = true;
+                    break;
+                }
+                case SectionKind::POINT_DATA:
+                case SectionKind::CELL_DATA: {
+                    if (section.elementType > static_cast<uint8_t>(AttributeType::FLOAT64) || section.components == 0) {
+                        throw std::runtime_error("invalid attribute section");
+                    }
+                    MeshAttribute attribute(static_cast<AttributeType>(section.elementType), static_cast<int>(section.components));
+                    const size_t valueBytes = attribute.elementSize();
+                    if (section.rawBytes % (valueBytes * section.components) != 0) {
+                        throw std::runtime_error("attribute size is not a whole number of tuples");
+                    }
+                    attribute.resize(static_cast<size_t>(section.rawBytes / (valueBytes * section.components)));
+                    decodeSection(file, section, attribute.data(), threads);
+                    AttributeMap& attributes = static_cast<SectionKind>(section.kind) == SectionKind::POINT_DATA
+                        ? meshData.pointData : meshData.cellData;
+                    attributes[std::string(file.data() + section.nameOffset, section.nameLength)] = std::move(attribute);
+                    break;
+                }
+                case SectionKind::METADATA: {
+                    std::vector<char> blob(static_cast<size_t>(section.rawBytes));
+                    decodeSection(file, section, blob.data(), threads);
+                    deserializeMetadata(blob.data(), blob.size(), meshData.metadata);
+                    break;
+                }
+                default:
+                    // Unknown sections (newer writers) and the source path are skipped
+                    break;
+            }
+        }
+        if (!hasPoints || !hasTypes || !hasOffsets || !hasConnectivity) {
+            throw std::runtime_error("missing mesh section");
+        }
+
+        // Structural checks: every cell range and point index inside its array
+        const std::vector<Index>& offsets = meshData.cells.offsets;
+        if (offsets.front() != 0 || offsets.back() != meshData.cells.connectivity.size()
+            || !std::is_sorted(offsets.begin(), offsets.end())) {
+            throw std::runtime_error("inconsistent cell offsets");
+        }
+        const std::vector<Index>& connectivity = meshData.cells.connectivity;
+        const size_t taskCount = parallelTaskCount(connectivity.size(), COPY_BYTES_PER_TASK / sizeof(Index), threads);
+        std::vector<char> badIndex(taskCount, 0);
+        parallelForRanges(connectivity.size(), taskCount, [&](size_t begin, size_t end, size_t task) {
+            for (size_t i = begin; i < end; ++i) {
+                badIndex[task] |= connectivity[i] >= pointCount;
+            }
+        });
+        if (std::find(badIndex.begin(), badIndex.end(), 1) != badIndex.end()) {
+            throw std::runtime_error("point index exceeds the point count");
+        }
+
+        meshData.metadata.pointCount = pointCount;
+        meshData.metadata.cellCount = cellCount;
+        meshData.metadata.pointCountKnown = true;
+        meshData.metadata.cellCountKnown = true;
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        meshData.metadata.readThroughputMBps = TextTokenizer::throughputMBps(file.size(), seconds);
+    } catch (const std::exception& e) {
+        meshData.clear();
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = "Error reading mesh cache " + filePath + ": " + e.what();
+        return false;
+    }
+
+    errorCode = MeshErrorCode::SUCCESS;
+    errorMsg.clear();
+    return true;
+}
+
+template bool MeshCache::readFile(const std::string&, MeshData&, MeshErrorCode&, std::string&, unsigned int);
+template bool MeshCache::readFile(const std::string&, MeshData64&, MeshErrorCode&, std::string&, unsigned int);
+
+/**
+ * @brief Read only the header and metadata section of a mesh cache file
+ * @param filePath File path (UTF-8 encoded)
+ * @param[out] metadata Stored metadata
+ * @param[out] source Source identity
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @return Whether the file is a valid mesh cache
+ */
+bool MeshCache::readHeader(const std::string& filePath,
+                           MeshMetadata& metadata,
+                           SourceKey& source,
+                           MeshErrorCode& errorCode,
+                           std::string& errorMsg) {
+    source = SourceKey();
+    MappedFile file;
+    if (!file.open(filePath, errorMsg)) {
+        errorCode = MeshErrorCode::READ_FAILED;
+        return false;
+    }
+    try {
+        McbContents contents;
+        readContents(file, contents);
+        for (const McbSection& section : contents.sections) {
+            if (section.kind == static_cast<uint32_t>(SectionKind::METADATA)) {
+                std::vector<char> blob(static_cast<size_t>(section.rawBytes));
+                decodeSection(file, section, blob.data(), 1);
+                deserializeMetadata(blob.data(), blob.size(), metadata);
+            } else if (section.kind == static_cast<uint32_t>(SectionKind::SOURCE_PATH)
+                       && section.codec == static_cast<uint8_t>(SectionCodec::RAW)) {
+                source.path.assign(file.data() + section.offset, static_cast<size_t>(section.rawBytes));
+            }
+        }
+        metadata.pointCount = contents.header.pointCount;
+        metadata.cellCount = contents.header.cellCount;
+        metadata.pointCountKnown = true;
+        metadata.cellCountKnown = true;
+        source.size = contents.header.sourceSize;
+        source.modified = contents.header.sourceModified;
+        source.optionsHash = contents.header.optionsHash;
+    } catch (const std::exception& e) {
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = "Error reading mesh cache " + filePath + ": " + e.what();
+        return false;
+    }
+    errorCode = MeshErrorCode::SUCCESS;
+    errorMsg.clear();
+    return true;
+}
+
+/**
+ * @brief Check whether a file starts with the mesh cache signature
+ * @param filePath File path (UTF-8 encoded)
+ * @return Whether the file is a mesh cache file
+ */
+bool MeshCache::isCacheFile(const std::string& filePath) {
+    std::ifstream file(std::filesystem::u8path(filePath), std::ios::binary);
+    char magic[sizeof(MCB_MAGIC)] = {};
+    return file.read(magic, sizeof(magic)) && std::memcmp(magic, MCB_MAGIC, sizeof(MCB_MAGIC)) == 0;
+}
+
+/**
+ * @brief Identity of a source file as the cache records it
+ * @param sourcePath Source file path (UTF-8 encoded)
+ * @param options Read options
+ * @param[out] key Source identity
+ * @return Whether the source exists
+ */
+bool MeshCache::sourceKey(const std::string& sourcePath, const FormatReadOptions& options, SourceKey& key) {
+    key = SourceKey();
+    const std::filesystem::path path = std::filesystem::u8path(sourcePath);
+    std::error_code ec;
+    const auto modified = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return false;
+    }
+    // Directory sources (OpenFOAM cases) have no size; their modification time still changes
+    const uintmax_t size = std::filesystem::is_regular_file(path, ec) ? std::filesystem::file_size(path, ec) : 0;
+    if (ec) {
+        return false;
+    }
+    key.path = absoluteSourcePath(sourcePath);
+    key.size = static_cast<uint64_t>(size);
+    key.modified = static_cast<int64_t>(modified.time_since_epoch().count());
+    key.optionsHash = readOptionsHash(options);
+    return true;
+}
+
+/**
+ * @brief Cache file of a source
+ * @param sourcePath Source file path (UTF-8 encoded)
+ * @param cacheDir Cache directory (UTF-8 encoded)
+ * @return Cache file path
+ */
+std::string MeshCache::cachePath(const std::string& sourcePath, const std::string& cacheDir) {
+    const std::string source = absoluteSourcePath(sourcePath);
+    Fnv1a hash;
+    hash.add(source.data(), source.size());
+    char name[17];
+    static const char HEX[] = "0123456789abcdef";
+    for (int i = 0; i < 16; ++i) {
+        name[i] = HEX[(hash.value() >> (60 - 4 * i)) & 0xf];
+    }
+    name[16] = '\0';
+    return (std::filesystem::u8path(cacheDir) / (std::string(name) + ".mcb")).u8string();
+}
+
+/**
+ * @brief Load the cached mesh of a source if the cache is still valid
+ * @param sourcePath Source file path (UTF-8 encoded)
+ * @param cacheDir Cache directory (UTF-8 encoded)
+ * @param[out] meshData Cached mesh
+ * @param options Read options
+ * @return Whether the mesh came from the cache
+ */
+bool MeshCache::load(const std::string& sourcePath,
+                     const std::string& cacheDir,
+                     MeshData& meshData,
+                     const FormatReadOptions& options) {
+    meshData.clear();
+    SourceKey current;
+    if (!sourceKey(sourcePath, options, current)) {
+        return false;
+    }
+    const std::string path = cachePath(sourcePath, cacheDir);
+    std::error_code ec;
+    if (!std::filesystem::exists(std::filesystem::u8path(path), ec)) {
+        return false;
+    }
+
+    MeshMetadata metadata;
+    SourceKey cached;
+    MeshErrorCode errorCode;
+    std::string errorMsg;
+    if (!readHeader(path, metadata, cached, errorCode, errorMsg) || cached.path != current.path
+        || cached.size != current.size || cached.modified != current.modified || cached.optionsHash != current.optionsHash) {
+        return false;
+    }
+    return readFile(path, meshData, errorCode, errorMsg, options.readThreads);
+}
+
+/**
+ * @brief Store the mesh read from a source in the cache
+ * The file is written under a temporary name and renamed, so concurrent readers never see a
+ * partial cache file.
+ * @param sourcePath Source file path (UTF-8 encoded)
+ * @param cacheDir Cache directory (UTF-8 encoded)
+ * @param meshData Mesh read from the source
+ * @param options Read options the mesh was read with
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @return Whether the cache file was written
+ */
+bool MeshCache::store(const std::string& sourcePath,
+                      const std::string& cacheDir,
+                      const MeshData& meshData,
+                      const FormatReadOptions& options,
+                      MeshErrorCode& errorCode,
+                      std::string& errorMsg) {
+    SourceKey key;
+    if (!sourceKey(sourcePath, options, key)) {
+        errorCode = MeshErrorCode::FILE_NOT_EXIST;
+        errorMsg = "Source file does not exist: " + sourcePath;
+        return false;
+    }
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::u8path(cacheDir), ec);
+    if (ec) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        errorMsg = "Cannot create cache directory: " + ec.message();
+        return false;
+    }
+
+    const std::string path = cachePath(sourcePath, cacheDir);
+    const std::string temporaryPath = path + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+    if (!writeFile(meshData, temporaryPath, FormatWriteOptions(), key, errorCode, errorMsg)) {
+        std::filesystem::remove(std::filesystem::u8path(temporaryPath), ec);
+        return false;
+    }
+    std::filesystem::rename(std::filesystem::u8path(temporaryPath), std::filesystem::u8path(path), ec);
+    if (ec) {
+        std::filesystem::remove(std::filesystem::u8path(temporaryPath), ec);
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        errorMsg = "Cannot replace cache file " + path + ": " + ec.message();
+        return false;
+    }
+    errorCode = MeshErrorCode::SUCCESS;
+    errorMsg.clear();
+    return true;
+}
+
+/**
+ * @brief Read a mesh through the cache
+ * @param sourcePath Source file path (UTF-8 encoded)
+ * @param cacheDir Cache directory (UTF-8 encoded)
+ * @param[out] meshData Output mesh data
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @param options Read options
+ * @param[out] cacheHit Whether the mesh came from the cache
+ * @return Whether reading is successful
+ */
+bool MeshCache::readCached(const std::string& sourcePath,
+                           const std::string& cacheDir,
+                           MeshData& meshData,
+                           MeshErrorCode& errorCode,
+                           std::string& errorMsg,
+                           const FormatReadOptions& options,
+                           bool* cacheHit) {
+    const bool hit = load(sourcePath, cacheDir, meshData, options);
+    if (cacheHit) {
+        *cacheHit = hit;
+    }
+    if (hit) {
+        errorCode = MeshErrorCode::SUCCESS;
+        errorMsg.clear();
+        return true;
+    }
+    if (!MeshReader::readAuto(sourcePath, meshData, errorCode, errorMsg, options)) {
+        return false;
+    }
+    // A cache that cannot be written only costs the next load its speed-up
+    MeshErrorCode storeCode;
+    std::string storeMsg;
+    store(sourcePath, cacheDir, meshData, options, storeCode, storeMsg);
+    return true;
+}
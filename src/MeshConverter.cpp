@@ -1,7 +1,11 @@
 #include "MeshConverter.h"
+#include "ConversionManifest.h"
+#include "JobControl.h"
 #include <filesystem>
-#include <thread>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <system_error>
 
 /**
  * @brief Generate target file path
@@ -81,15 +85,19 @@ bool MeshConverter::convert(const std::string& srcFilePath,
     MeshErrorCode readErrorCode;
     std::string readErrorMsg;
 
+    // Inside a job, reading and writing each take half of the progress scale
     bool readSuccess = false;
-    if (srcFormat == MeshFormat::UNKNOWN) {
-        // Auto-detect format and read
-        readSuccess = MeshReader::readAuto(srcFilePath, meshData, readErrorCode, readErrorMsg);
-    } else {
-        // Read according to specified format
-        // Need to call corresponding read method based on specific format
-        // Temporarily use readAuto as default implementation
-        readSuccess = MeshReader::readAuto(srcFilePath, meshData, readErrorCode, readErrorMsg);
+    {
+        JobStep readStep(0.0, 0.5);
+        if (srcFormat == MeshFormat::UNKNOWN) {
+            // Auto-detect format and read
+            readSuccess = MeshReader::readAuto(srcFilePath, meshData, readErrorCode, readErrorMsg);
+        } else {
+            // Read according to specified format
+            // Need to call corresponding read method based on specific format
+            // Temporarily use readAuto as default implementation
+            readSuccess = MeshReader::readAuto(srcFilePath, meshData, readErrorCode, readErrorMsg);
+        }
     }
 
     if (!readSuccess) {
@@ -101,6 +109,7 @@ bool MeshConverter::convert(const std::string& srcFilePath,
     // Write mesh data
     MeshErrorCode writeErrorCode;
     std::string writeErrorMsg;
+    JobStep writeStep(0.5, 1.0);
     bool writeSuccess = MeshWriter::write(meshData, dstFilePath, dstFormat, writeOptions, writeErrorCode, writeErrorMsg);
 
     if (!writeSuccess) {
@@ -112,6 +121,70 @@ bool MeshConverter::convert(const std::string& srcFilePath,
     return true;
 }
 
+/**
+ * @brief Single file format conversion in bounded memory
+ * @param srcFilePath Source file path (UTF-8)
+ * @param dstFilePath Target file path (UTF-8)
+ * @param srcFormat Source format (MeshFormat::UNKNOWN=auto detect)
+ * @param dstFormat Target format
+ * @param writeOptions Target format write options
+ * @param streamOptions Block size and spool directory
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message
+ * @return Whether conversion is successful
+ */
+bool MeshConverter::convertStreaming(const std::string& srcFilePath,
+                                     const std::string& dstFilePath,
+                                     MeshFormat srcFormat,
+                                     MeshFormat dstFormat,
+                                     const FormatWriteOptions& writeOptions,
+                                     const MeshStreamOptions& streamOptions,
+                                     MeshErrorCode& errorCode,
+                                     std::string& errorMsg) {
+    if (!MeshStreamWriter::supportsFormat(dstFormat)) {
+        errorCode = MeshErrorCode::FORMAT_UNSUPPORTED;
+        errorMsg = "Streaming write not supported for target format";
+        return false;
+    }
+
+    std::unique_ptr<MeshStreamReader> reader = MeshStreamReader::open(srcFilePath, srcFormat, streamOptions, errorCode, errorMsg);
+    if (!reader) {
+        errorMsg = "Read failed: " + errorMsg;
+        return false;
+    }
+    std::unique_ptr<MeshStreamWriter> writer =
+        MeshStreamWriter::create(dstFilePath, dstFormat, writeOptions, reader->info(), streamOptions, errorCode, errorMsg);
+    if (!writer) {
+        errorMsg = "Write failed: " + errorMsg;
+        return false;
+    }
+
+    // Only one block is held in memory at a time
+    bool success = true;
+    MeshBlock block;
+    while (success && !reader->atEnd()) {
+        if (!reader->readBlock(block, errorCode, errorMsg)) {
+            errorMsg = "Read failed: " + errorMsg;
+            success = false;
+        } else if (!writer->writeBlock(block, errorCode, errorMsg)) {
+            errorMsg = "Write failed: " + errorMsg;
+            success = false;
+        }
+    }
+    if (success && !writer->finish(errorCode, errorMsg)) {
+        errorMsg = "Write failed: " + errorMsg;
+        success = false;
+    }
+
+    if (!success) {
+        // Do not leave a truncated output behind
+        writer.reset();
+        std::error_code removeError;
+        std::filesystem::remove(dstFilePath, removeError);
+    }
+    return success;
+}
+
 /**
  * @brief Batch convert multiple files
  * @param srcFilePaths Source file path list (UTF-8)
@@ -119,62 +192,105 @@ bool MeshConverter::convert(const std::string& srcFilePath,
  * @param dstFormat Target format
  * @param writeOptions Target format write options
  * @param[out] errorMap Output error information for each file (key=source file path, value=(errorCode, errorMsg))
- * @return Number of successfully converted files
+ * @param batchOptions Scheduling options (largest files are started first) and incremental mode
+ * @param[out] report Output converted/skipped/failed counts (optional)
+ * @return Number of files whose output is up to date (converted or skipped)
  */
 uint64_t MeshConverter::batchConvert(const std::vector<std::string>& srcFilePaths,
                                     const std::string& dstDir,
                                     MeshFormat dstFormat,
                                     const FormatWriteOptions& writeOptions,
-                                    std::unordered_map<std::string, std::pair<MeshErrorCode, std::string>>& errorMap) {
+                                    std::unordered_map<std::string, std::pair<MeshErrorCode, std::string>>& errorMap,
+                                    const BatchConvertOptions& batchOptions,
+                                    BatchConvertReport* report) {
+    BatchConvertReport counts;
+
     // Ensure target directory exists
     if (!ensureDstDirExists(dstDir)) {
         errorMap.clear();
         for (const auto& filePath : srcFilePaths) {
             errorMap[filePath] = {MeshErrorCode::WRITE_FAILED, "Cannot create target directory: " + dstDir};
         }
+        counts.failed = srcFilePaths.size();
+        if (report) {
+            *report = counts;
+        }
         return 0;
     }
 
-    // Number of successfully converted files
-    uint64_t successCount = 0;
-    std::mutex errorMapMutex;
+    // Incremental mode: the manifest of the previous runs decides which files can be skipped
+    ConversionManifest manifest;
+    uint64_t settingsHash = 0;
+    if (batchOptions.incremental) {
+        manifest.load(batchOptions.manifestPath.empty() ? ConversionManifest::defaultPath(dstDir) : batchOptions.manifestPath);
+        settingsHash = ConversionManifest::settingsHash(dstFormat, writeOptions);
+    }
 
-    // Use multi-threading for batch conversion
-    std::vector<std::thread> threads;
-    const size_t maxThreads = std::thread::hardware_concurrency();
-    size_t currentThread = 0;
+    std::mutex errorMapMutex;  // Guards errorMap and counts
 
+    // One task per file; the input size is the memory estimate used for ordering and admission
+    std::vector<std::function<void()>> tasks;
+    std::vector<uint64_t> memoryCosts;
+    tasks.reserve(srcFilePaths.size());
+    memoryCosts.reserve(srcFilePaths.size());
     for (const auto& srcFilePath : srcFilePaths) {
-        threads.emplace_back([&, srcFilePath]() {
+        std::error_code sizeError;
+        const uintmax_t fileSize = std::filesystem::file_size(srcFilePath, sizeError);
+        memoryCosts.push_back(sizeError ? 0 : static_cast<uint64_t>(fileSize));
+
+        tasks.emplace_back([&, srcFilePath]() {
             std::string dstFilePath = generateDstFilePath(srcFilePath, dstDir, dstFormat);
             MeshErrorCode errorCode;
             std::string errorMsg;
 
-            bool success = convert(srcFilePath, dstFilePath, MeshFormat::UNKNOWN, dstFormat, writeOptions, errorCode, errorMsg);
+            ConversionManifest::Entry source;
+            if (batchOptions.incremental && manifest.lookup(srcFilePath, dstFilePath, settingsHash, source)) {
+                std::lock_guard<std::mutex> lock(errorMapMutex);
+                counts.skipped++;
+                return;
+            }
+
+            bool success = false;
+            try {
+                success = convert(srcFilePath, dstFilePath, MeshFormat::UNKNOWN, dstFormat, writeOptions, errorCode, errorMsg);
+            } catch (const std::exception& e) {
+                errorCode = MeshErrorCode::WRITE_FAILED;
+                errorMsg = std::string("Conversion error: ") + e.what();
+            }
+
+            if (batchOptions.incremental) {
+                if (success) {
+                    manifest.record(srcFilePath, std::move(source));
+                } else {
+                    manifest.forget(srcFilePath);
+                }
+            }
 
             if (success) {
                 std::lock_guard<std::mutex> lock(errorMapMutex);
-                successCount++;
+                counts.converted++;
             } else {
                 std::lock_guard<std::mutex> lock(errorMapMutex);
+                counts.failed++;
                 errorMap[srcFilePath] = {errorCode, errorMsg};
             }
         });
-
-        currentThread++;
-        if (currentThread >= maxThreads) {
-            for (auto& thread : threads) {
-                thread.join();
-            }
-            threads.clear();
-            currentThread = 0;
-        }
     }
 
-    // Wait for remaining threads to complete
-    for (auto& thread : threads) {
-        thread.join();
+    // Run on the work-stealing pool and wait for the whole batch
+    TaskPool& pool = batchOptions.pool ? *batchOptions.pool : TaskPool::shared();
+    auto group = std::make_shared<TaskPool::TaskGroup>(batchOptions.maxConcurrency, batchOptions.memoryBudget);
+    pool.submitBatch(std::move(tasks), memoryCosts, group);
+    group->wait();
+
+    // A manifest that cannot be saved only costs the next run its skips
+    if (batchOptions.incremental) {
+        std::string manifestError;
+        manifest.save(manifestError);
     }
 
-    return successCount;
+    if (report) {
+        *report = counts;
+    }
+    return counts.converted + counts.skipped;
 }
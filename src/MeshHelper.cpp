@@ -1,7 +1,13 @@
 #include "MeshHelper.h"
+#include "MappedFile.h"
+#include "MeshCache.h"
+#include "OpenFoamSupport.h"
+#include "TextTokenizer.h"
 #include <fstream>
 #include <filesystem>
 #include <algorithm>
+#include <cstring>
+#include <string_view>
 
 /**
  * @brief Get file extension from file path
@@ -56,18 +62,7 @@ MeshFormat MeshHelper::detectFormat(const std::string& filePath) {
     } else if (ext == ".stl") {
         // Check if STL is ASCII or Binary if file exists
         if (fileExists) {
-            std::ifstream file(filePath, std::ios::binary);
-            if (file.is_open()) {
-                char header[80] = {0};
-                file.read(header, sizeof(header));
-                std::string headerStr(header);
-                if (headerStr.find("solid") != std::string::npos || headerStr.find("SOLID") != std::string::npos) {
-                    return MeshFormat::STL_ASCII;
-                } else {
-                    return MeshFormat::STL_BINARY;
-                }
-                file.close();
-            }
+            return detectSTLEncoding(filePath);
         }
         return MeshFormat::STL_BINARY; // Default to binary
     } else if (ext == ".obj") {
@@ -97,7 +92,9 @@ MeshFormat MeshHelper::detectFormat(const std::string& filePath) {
         return MeshFormat::OFF;
     } else if (ext == ".su2") {
         return MeshFormat::SU2;
-    } else if (fileExists && std::filesystem::is_directory(filePath) && std::filesystem::exists(filePath + "/polyMesh")) {
+    } else if (ext == ".mcb") {
+        return MeshFormat::MESH_CACHE;
+    } else if (fileExists && isOpenFoamCase(filePath)) {
         return MeshFormat::OPENFOAM;
     }
 
@@ -106,9 +103,11 @@ MeshFormat MeshHelper::detectFormat(const std::string& filePath) {
     if (file.is_open()) {
         char header[128] = {0};
         file.read(header, sizeof(header));
-        std::string headerStr(header);
+        std::string headerStr(header, static_cast<size_t>(file.gcount()));
 
-        if (headerStr.find("# vtk") != std::string::npos) {
+        if (headerStr.compare(0, 8, std::string("MCBMESH\0", 8)) == 0) {
+            return MeshFormat::MESH_CACHE;
+        } else if (headerStr.find("# vtk") != std::string::npos) {
             return MeshFormat::VTK_LEGACY;
         } else if (headerStr.find("<?xml") != std::string::npos && headerStr.find("VTKFile") != std::string::npos) {
             return MeshFormat::VTK_XML;
@@ -132,6 +131,751 @@ MeshFormat MeshHelper::detectFormat(const std::string& filePath) {
     return MeshFormat::UNKNOWN;
 }
 
+namespace {
+
+// Largest header region searched for VTK XML <Piece> tags before giving up on inline data
+constexpr size_t kXmlHeaderScanBytes = 1024 * 1024;
+
+/**
+ * @brief Read the line starting at a position (without the trailing "\n" or "\r\n")
+ * @param text Whole file text
+ * @param[in,out] pos Line start, advanced past the line break
+ * @param[out] line Line contents
+ * @return Whether a line was read (false at end of text)
+ */
+bool readLine(std::string_view text, size_t& pos, std::string_view& line) {
+    if (pos >= text.size()) {
+        return false;
+    }
+    TextTokenizer tokenizer(text.data() + pos, text.size() - pos);
+    tokenizer.nextLine(line);
+    pos += tokenizer.position();
+    return true;
+}
+
+/**
+ * @brief Read the next non-empty, non-comment line
+ * @param text Whole file text
+ * @param[in,out] pos Line start, advanced past the returned line
+ * @param[out] line Trimmed line contents
+ * @param commentChar Character starting a comment line ('\0' = no comments)
+ * @return Whether a line was found
+ */
+bool readContentLine(std::string_view text, size_t& pos, std::string_view& line, char commentChar) {
+    while (readLine(text, pos, line)) {
+        line = TextTokenizer::trim(line);
+        if (!line.empty() && line.front() != commentChar) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Find the start of the next line that begins with a given keyword (byte search, no parsing)
+ * @param text Whole file text
+ * @param from Search start
+ * @param keyword Keyword the line must start with
+ * @return Offset of the line start, or npos
+ */
+size_t findLineStartingWith(std::string_view text, size_t from, std::string_view keyword) {
+    if (from == 0 && TextTokenizer::startsWith(text, keyword)) {
+        return 0;
+    }
+    const std::string needle = "\n" + std::string(keyword);
+    const size_t found = text.find(needle, from == 0 ? 0 : from - 1);
+    return found == std::string_view::npos ? std::string_view::npos : found + 1;
+}
+
+/**
+ * @brief Find the next line of a legacy VTK ASCII file that starts with a keyword
+ * Data lines start with a digit, sign or dot, keyword lines with an upper case letter.
+ * @param text Whole file text
+ * @param from Search start
+ * @return Offset of the keyword line, or text size if there is none
+ */
+size_t findNextKeywordLine(std::string_view text, size_t from) {
+    size_t pos = from;
+    while (pos < text.size()) {
+        size_t first = pos;
+        while (first < text.size() && (text[first] == ' ' || text[first] == '\t')) {
+            ++first;
+        }
+        if (first < text.size() && text[first] >= 'A' && text[first] <= 'Z') {
+            return pos;
+        }
+        const void* lineEnd = std::memchr(text.data() + first, '\n', text.size() - first);
+        if (!lineEnd) {
+            break;
+        }
+        pos = static_cast<size_t>(static_cast<const char*>(lineEnd) - text.data()) + 1;
+    }
+    return text.size();
+}
+
+/**
+ * @brief Get the value of an XML attribute inside a tag
+ * @param tag Tag text (from '<' to '>')
+ * @param name Attribute name
+ * @return Attribute value (empty if absent)
+ */
+std::string_view xmlAttribute(std::string_view tag, std::string_view name) {
+    size_t pos = 0;
+    while ((pos = tag.find(name, pos)) != std::string_view::npos) {
+        const bool wordStart = pos > 0 && TextTokenizer::isSpace(tag[pos - 1]);
+        size_t valuePos = pos + name.size();
+        pos = valuePos;
+        if (!wordStart || valuePos + 1 >= tag.size() || tag[valuePos] != '=') {
+            continue;
+        }
+        const char quote = tag[valuePos + 1];
+        if (quote != '"' && quote != '\'') {
+            continue;
+        }
+        const size_t valueEnd = tag.find(quote, valuePos + 2);
+        if (valueEnd == std::string_view::npos) {
+            break;
+        }
+        return tag.substr(valuePos + 2, valueEnd - valuePos - 2);
+    }
+    return {};
+}
+
+/**
+ * @brief Size in bytes of a legacy VTK data type name
+ * @param typeName Type name from a POINTS/OFFSETS line (e.g. "float", "vtktypeint64")
+ * @return Size in bytes (0 = unknown type)
+ */
+size_t legacyTypeSize(std::string_view typeName) {
+    if (typeName == "float" || typeName == "int" || typeName == "unsigned_int" ||
+        typeName == "vtktypeint32" || typeName == "vtktypeuint32") {
+        return 4;
+    }
+    if (typeName == "double" || typeName == "long" || typeName == "unsigned_long" ||
+        typeName == "vtkIdType" || typeName == "vtktypeint64" || typeName == "vtktypeuint64") {
+        return 8;
+    }
+    if (typeName == "short" || typeName == "unsigned_short") {
+        return 2;
+    }
+    if (typeName == "char" || typeName == "unsigned_char" || typeName == "bit") {
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Derive the mesh type from a cell type histogram
+ * @param cellTypeCount Cell type histogram
+ * @return Mesh type (UNKNOWN for an empty histogram)
+ */
+MeshType meshTypeFromCellTypes(const std::unordered_map<VtkCellType, uint64_t>& cellTypeCount) {
+    if (cellTypeCount.empty()) {
+        return MeshType::UNKNOWN;
+    }
+    for (VtkCellType type : {VtkCellType::TETRA, VtkCellType::HEXAHEDRON, VtkCellType::WEDGE, VtkCellType::PYRAMID}) {
+        if (cellTypeCount.count(type)) {
+            return MeshType::VOLUME_MESH;
+        }
+    }
+    return MeshType::SURFACE_MESH;
+}
+
+/**
+ * @brief STL: binary files store the triangle count at offset 80, ASCII files have no counts
+ */
+bool scanSTLHeader(std::string_view text, MeshFormat format, MeshMetadata& metadata,
+                   MeshErrorCode& errorCode, std::string& errorMsg) {
+    metadata.meshType = MeshType::SURFACE_MESH;
+    uint32_t triangleCount = 0;
+    if (text.size() >= 84) {
+        std::memcpy(&triangleCount, text.data() + 80, sizeof(triangleCount));
+    }
+    // Binary files whose 80-byte header starts with "solid" are recognized by their exact size
+    const bool binaryLayout = text.size() >= 84 && text.size() == 84 + static_cast<uint64_t>(triangleCount) * 50;
+    if (format == MeshFormat::STL_ASCII && !binaryLayout) {
+        metadata.formatVersion = "ascii";
+        return true;
+    }
+    metadata.formatVersion = "binary";
+    if (text.size() < 84) {
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = "Binary STL file is shorter than its 84-byte header";
+        return false;
+    }
+    // Facets are not indexed: every triangle carries its own three corners
+    metadata.pointCount = static_cast<uint64_t>(triangleCount) * 3;
+    metadata.cellCount = triangleCount;
+    metadata.pointCountKnown = true;
+    metadata.cellCountKnown = true;
+    if (triangleCount > 0) {
+        metadata.cellTypeCount[VtkCellType::TRIANGLE] = triangleCount;
+    }
+    return true;
+}
+
+/**
+ * @brief PLY: counts come from the "element vertex/face N" header lines
+ */
+bool scanPLYHeader(std::string_view text, MeshMetadata& metadata, MeshErrorCode& errorCode, std::string& errorMsg) {
+    metadata.meshType = MeshType::SURFACE_MESH;
+    size_t pos = 0;
+    std::string_view line;
+    if (!readLine(text, pos, line) || TextTokenizer::trim(line) != "ply") {
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = "PLY file does not start with 'ply'";
+        return false;
+    }
+    while (readLine(text, pos, line)) {
+        TextTokenizer tokenizer(line);
+        std::string_view keyword;
+        if (!tokenizer.nextToken(keyword)) {
+            continue;
+        }
+        if (keyword == "end_header") {
+            return true;
+        }
+        if (keyword == "format") {
+            metadata.formatVersion = std::string(TextTokenizer::trim(tokenizer.rest()));
+        } else if (keyword == "element") {
+            std::string_view name;
+            uint64_t count = 0;
+            if (!tokenizer.nextToken(name) || !tokenizer.next(count)) {
+                continue;
+            }
+            if (name == "vertex") {
+                metadata.pointCount = count;
+                metadata.pointCountKnown = true;
+            } else if (name == "face") {
+                metadata.cellCount = count;
+                metadata.cellCountKnown = true;
+            }
+        }
+    }
+    errorCode = MeshErrorCode::READ_FAILED;
+    errorMsg = "PLY header has no end_header line";
+    return false;
+}
+
+/**
+ * @brief OFF: the counts follow the "OFF" keyword (same line or the next non-comment line)
+ */
+bool scanOFFHeader(std::string_view text, MeshMetadata& metadata, MeshErrorCode& errorCode, std::string& errorMsg) {
+    metadata.meshType = MeshType::SURFACE_MESH;
+    size_t pos = 0;
+    std::string_view line;
+    if (!readContentLine(text, pos, line, '#')) {
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = "OFF file is empty";
+        return false;
+    }
+    TextTokenizer tokenizer(line);
+    std::string_view keyword;
+    tokenizer.nextToken(keyword);
+    if (keyword.find("OFF") == std::string_view::npos) {
+        // Header keyword is optional: the first line already holds the counts
+        tokenizer = TextTokenizer(line);
+    } else {
+        metadata.formatVersion = std::string(keyword);
+        if (tokenizer.atEnd() || TextTokenizer::trim(tokenizer.rest()).empty()) {
+            if (!readContentLine(text, pos, line, '#')) {
+                errorCode = MeshErrorCode::READ_FAILED;
+                errorMsg = "OFF file has no vertex/face counts";
+                return false;
+            }
+            tokenizer = TextTokenizer(line);
+        }
+    }
+    uint64_t vertexCount = 0;
+    uint64_t faceCount = 0;
+    if (!tokenizer.next(vertexCount) || !tokenizer.next(faceCount)) {
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = "Invalid OFF vertex/face count line";
+        return false;
+    }
+    metadata.pointCount = vertexCount;
+    metadata.cellCount = faceCount;
+    metadata.pointCountKnown = true;
+    metadata.cellCountKnown = true;
+    return true;
+}
+
+/**
+ * @brief SU2: NDIME/NELEM/NPOIN keyword lines
+ * NPOIN usually follows the element section, which is skipped with a byte search.
+ */
+bool scanSU2Header(std::string_view text, MeshMetadata& metadata, MeshErrorCode& errorCode, std::string& errorMsg) {
+    metadata.meshType = MeshType::VOLUME_MESH;
+    auto keywordValue = [](std::string_view line, std::string_view key, uint64_t& value) {
+        if (!TextTokenizer::startsWith(line, key)) {
+            return false;
+        }
+        const size_t separator = line.find('=');
+        return separator != std::string_view::npos && TextTokenizer::parse(TextTokenizer::trim(line.substr(separator + 1)), value);
+    };
+
+    size_t pos = 0;
+    std::string_view line;
+    while (readContentLine(text, pos, line, '%')) {
+        uint64_t value = 0;
+        if (keywordValue(line, "NDIME", value)) {
+            metadata.formatVersion = "NDIME=" + std::to_string(value);
+            if (value == 2) {
+                metadata.meshType = MeshType::SURFACE_MESH;
+            }
+        } else if (keywordValue(line, "NELEM", value)) {
+            metadata.cellCount = value;
+            metadata.cellCountKnown = true;
+            if (metadata.pointCountKnown) {
+                return true;
+            }
+            // Skip the element lines without parsing them
+            pos = findLineStartingWith(text, pos, "NPOIN");
+            if (pos == std::string_view::npos) {
+                break;
+            }
+        } else if (keywordValue(line, "NPOIN", value)) {
+            metadata.pointCount = value;
+            metadata.pointCountKnown = true;
+            if (metadata.cellCountKnown) {
+                return true;
+            }
+            pos = findLineStartingWith(text, pos, "NELEM");
+            if (pos == std::string_view::npos) {
+                break;
+            }
+        } else if (TextTokenizer::startsWith(line, "NZONE")) {
+            // Multi-zone files: report the first zone only
+            continue;
+        } else if (!metadata.cellCountKnown && !metadata.pointCountKnown && line.find('=') == std::string_view::npos) {
+            break;
+        }
+    }
+    if (!metadata.cellCountKnown && !metadata.pointCountKnown) {
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = "SU2 file has no NELEM/NPOIN keywords";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Legacy VTK: POINTS/CELLS/DIMENSIONS section headers
+ * Binary section payloads are skipped by size; ASCII payloads by looking for the next keyword line.
+ */
+bool scanVTKLegacyHeader(std::string_view text, MeshMetadata& metadata, MeshErrorCode& errorCode, std::string& errorMsg) {
+    size_t pos = 0;
+    std::string_view versionLine;
+    std::string_view title;
+    std::string_view encoding;
+    std::string_view dataset;
+    if (!readLine(text, pos, versionLine) || versionLine.find("vtk DataFile Version") == std::string_view::npos ||
+        !readLine(text, pos, title) || !readContentLine(text, pos, encoding, '\0') ||
+        !readContentLine(text, pos, dataset, '\0')) {
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = "Invalid legacy VTK header";
+        return false;
+    }
+    metadata.formatVersion = std::string(TextTokenizer::trim(versionLine.substr(versionLine.find("Version") + 7)));
+    const bool binary = TextTokenizer::startsWith(encoding, "BINARY");
+    int majorVersion = 0;
+    TextTokenizer::parse(metadata.formatVersion, majorVersion);
+    // Version 5 cell sections store offsets (count + 1) and connectivity as two typed arrays
+    const bool offsetsLayout = majorVersion >= 5;
+
+    // Skip the payload of a section holding `count` values of `typeName`
+    auto skipPayload = [&](uint64_t count, std::string_view typeName) {
+        if (!binary) {
+            pos = findNextKeywordLine(text, pos);
+            return true;
+        }
+        const size_t typeSize = legacyTypeSize(typeName);
+        if (typeSize == 0 || count > (text.size() - pos) / typeSize) {
+            return false;
+        }
+        pos += static_cast<size_t>(count) * typeSize;
+        return true;
+    };
+    // Skip a cell section (CELLS or a POLYDATA cell list) and return its cell count
+    auto skipCellSection = [&](uint64_t first, uint64_t second, uint64_t& cellCount) {
+        if (!offsetsLayout) {
+            cellCount = first;
+            return skipPayload(second, "int");
+        }
+        cellCount = first > 0 ? first - 1 : 0;
+        for (std::string_view arrayName : {"OFFSETS", "CONNECTIVITY"}) {
+            std::string_view arrayLine;
+            if (!readContentLine(text, pos, arrayLine, '\0') || !TextTokenizer::startsWith(arrayLine, arrayName)) {
+                return false;
+            }
+            TextTokenizer arrayTokens(arrayLine);
+            std::string_view keyword;
+            std::string_view typeName;
+            arrayTokens.nextToken(keyword);
+            arrayTokens.nextToken(typeName);
+            if (!skipPayload(arrayName == std::string_view("OFFSETS") ? first : second, typeName)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::string_view line;
+    bool polyData = dataset.find("POLYDATA") != std::string_view::npos;
+    while (readContentLine(text, pos, line, '\0')) {
+        TextTokenizer tokenizer(line);
+        std::string_view keyword;
+        tokenizer.nextToken(keyword);
+        uint64_t first = 0;
+        uint64_t second = 0;
+        if (keyword == "POINTS") {
+            std::string_view typeName;
+            if (!tokenizer.next(first) || !tokenizer.nextToken(typeName)) {
+                break;
+            }
+            metadata.pointCount = first;
+            metadata.pointCountKnown = true;
+            if (!skipPayload(first * 3, typeName)) {
+                break;
+            }
+        } else if (keyword == "DIMENSIONS") {
+            uint64_t dims[3] = {1, 1, 1};
+            tokenizer.next(dims[0]);
+            tokenizer.next(dims[1]);
+            tokenizer.next(dims[2]);
+            uint64_t cells = 1;
+            for (uint64_t dim : dims) {
+                cells *= dim > 1 ? dim - 1 : 1;
+            }
+            metadata.pointCount = dims[0] * dims[1] * dims[2];
+            metadata.cellCount = cells;
+            metadata.pointCountKnown = true;
+            metadata.cellCountKnown = true;
+            metadata.meshType = (dims[0] > 1 && dims[1] > 1 && dims[2] > 1) ? MeshType::VOLUME_MESH : MeshType::SURFACE_MESH;
+            return true;
+        } else if (keyword == "CELLS") {
+            if (!tokenizer.next(first) || !tokenizer.next(second)) {
+                break;
+            }
+            uint64_t cellCount = 0;
+            skipCellSection(first, second, cellCount);
+            metadata.cellCount = cellCount;
+            metadata.cellCountKnown = true;
+            break;
+        } else if (polyData && (keyword == "VERTICES" || keyword == "LINES" || keyword == "POLYGONS" || keyword == "TRIANGLE_STRIPS")) {
+            if (!tokenizer.next(first) || !tokenizer.next(second)) {
+                break;
+            }
+            uint64_t cellCount = 0;
+            const bool skipped = skipCellSection(first, second, cellCount);
+            metadata.cellCount += cellCount;
+            metadata.cellCountKnown = true;
+            metadata.meshType = MeshType::SURFACE_MESH;
+            if (!skipped) {
+                break;
+            }
+        } else if (keyword == "POINT_DATA" || keyword == "CELL_DATA" || keyword == "CELL_TYPES" || keyword == "FIELD") {
+            break;
+        } else if (!binary) {
+            pos = findNextKeywordLine(text, pos);
+        }
+    }
+    if (!polyData && metadata.cellCountKnown && metadata.meshType == MeshType::UNKNOWN) {
+        metadata.meshType = MeshType::VOLUME_MESH;
+    }
+    return true;
+}
+
+/**
+ * @brief VTK XML: NumberOfPoints/NumberOfCells attributes of the <Piece> tags
+ * Array names are collected from the PointData/CellData blocks of the first piece.
+ */
+bool scanVTKXMLHeader(std::string_view text, MeshMetadata& metadata, MeshErrorCode& errorCode, std::string& errorMsg) {
+    const size_t fileTagPos = text.substr(0, (std::min)(text.size(), kXmlHeaderScanBytes)).find("<VTKFile");
+    if (fileTagPos == std::string_view::npos) {
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = "VTK XML file has no <VTKFile> tag";
+        return false;
+    }
+    auto tagAt = [&](size_t tagPos) {
+        const size_t tagEnd = text.find('>', tagPos);
+        return text.substr(tagPos, tagEnd == std::string_view::npos ? std::string_view::npos : tagEnd - tagPos + 1);
+    };
+    const std::string_view fileTag = tagAt(fileTagPos);
+    const std::string_view datasetType = xmlAttribute(fileTag, "type");
+    metadata.formatVersion = std::string(xmlAttribute(fileTag, "version"));
+    if (!datasetType.empty()) {
+        metadata.formatVersion += " (" + std::string(datasetType) + ")";
+    }
+
+    // Piece tags of appended-data files all precede <AppendedData>; inline files are only searched in the header region
+    size_t searchEnd = text.find("<AppendedData", fileTagPos);
+    if (searchEnd == std::string_view::npos) {
+        searchEnd = (std::min)(text.size(), kXmlHeaderScanBytes);
+    }
+    const std::string_view header = text.substr(0, searchEnd);
+
+    auto addCount = [](std::string_view tag, std::string_view name, uint64_t& total) {
+        uint64_t value = 0;
+        const std::string_view valueText = xmlAttribute(tag, name);
+        if (!valueText.empty() && TextTokenizer::parse(valueText, value)) {
+            total += value;
+            return true;
+        }
+        return false;
+    };
+
+    size_t piecePos = fileTagPos;
+    bool firstPiece = true;
+    while ((piecePos = header.find("<Piece", piecePos)) != std::string_view::npos) {
+        const std::string_view pieceTag = tagAt(piecePos);
+        piecePos += pieceTag.size();
+        if (addCount(pieceTag, "NumberOfPoints", metadata.pointCount)) {
+            metadata.pointCountKnown = true;
+        }
+        bool hasCells = addCount(pieceTag, "NumberOfCells", metadata.cellCount);
+        for (std::string_view polyName : {"NumberOfVerts", "NumberOfLines", "NumberOfStrips", "NumberOfPolys"}) {
+            if (addCount(pieceTag, polyName, metadata.cellCount)) {
+                hasCells = true;
+                metadata.meshType = MeshType::SURFACE_MESH;
+            }
+        }
+        // Structured pieces: sizes follow from the extent
+        const std::string_view extent = xmlAttribute(pieceTag, "Extent");
+        if (!hasCells && !extent.empty()) {
+            TextTokenizer tokenizer(extent);
+            int64_t bounds[6] = {0, 0, 0, 0, 0, 0};
+            for (int64_t& bound : bounds) {
+                tokenizer.next(bound);
+            }
+            uint64_t points = 1;
+            uint64_t cells = 1;
+            for (int axis = 0; axis < 3; ++axis) {
+                const uint64_t span = static_cast<uint64_t>((std::max)(bounds[axis * 2 + 1] - bounds[axis * 2], int64_t(0)));
+                points *= span + 1;
+                cells *= span > 0 ? span : 1;
+            }
+            metadata.pointCount += points;
+            metadata.cellCount += cells;
+            metadata.pointCountKnown = true;
+            hasCells = true;
+        }
+        metadata.cellCountKnown = metadata.cellCountKnown || hasCells;
+
+        if (firstPiece) {
+            firstPiece = false;
+            const size_t pieceEnd = header.find("</Piece>", piecePos);
+            const std::string_view piece = header.substr(piecePos, pieceEnd == std::string_view::npos ? std::string_view::npos : pieceEnd - piecePos);
+            // Array names inside a <PointData>/<CellData> block
+            auto collectNames = [&](std::string_view blockTag, std::vector<std::string>& names) {
+                const size_t blockPos = piece.find("<" + std::string(blockTag));
+                if (blockPos == std::string_view::npos) {
+                    return;
+                }
+                const size_t blockEnd = piece.find("</" + std::string(blockTag), blockPos);
+                const std::string_view block = piece.substr(blockPos, blockEnd == std::string_view::npos ? std::string_view::npos : blockEnd - blockPos);
+                size_t arrayPos = 0;
+                while ((arrayPos = block.find("<DataArray", arrayPos)) != std::string_view::npos) {
+                    const size_t arrayTagEnd = block.find('>', arrayPos);
+                    const std::string_view arrayTag = block.substr(arrayPos, arrayTagEnd == std::string_view::npos ? std::string_view::npos : arrayTagEnd - arrayPos);
+                    const std::string_view name = xmlAttribute(arrayTag, "Name");
+                    if (!name.empty()) {
+                        names.emplace_back(name);
+                    }
+                    arrayPos += arrayTag.size();
+                }
+            };
+            collectNames("PointData", metadata.pointDataNames);
+            collectNames("CellData", metadata.cellDataNames);
+        }
+    }
+    if (metadata.meshType == MeshType::UNKNOWN && (datasetType == "UnstructuredGrid" || datasetType == "StructuredGrid" || datasetType == "ImageData" || datasetType == "RectilinearGrid")) {
+        metadata.meshType = MeshType::VOLUME_MESH;
+    }
+    return true;
+}
+
+/**
+ * @brief Gmsh: $MeshFormat version, $PhysicalNames, and the $Nodes/$Elements section headers
+ * Section payloads are skipped with a byte search for the matching $End marker.
+ */
+bool scanGmshHeader(std::string_view text, MeshMetadata& metadata, MeshErrorCode& errorCode, std::string& errorMsg) {
+    metadata.meshType = MeshType::VOLUME_MESH;
+    size_t pos = findLineStartingWith(text, 0, "$MeshFormat");
+    std::string_view line;
+    if (pos == std::string_view::npos || !readLine(text, pos, line) || !readLine(text, pos, line)) {
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = "Gmsh file has no $MeshFormat section";
+        return false;
+    }
+    TextTokenizer formatTokens(line);
+    std::string_view version;
+    int fileType = 0;
+    size_t dataSize = sizeof(size_t);
+    formatTokens.nextToken(version);
+    formatTokens.next(fileType);
+    formatTokens.next(dataSize);
+    metadata.formatVersion = std::string(version);
+    const bool binary = fileType == 1;
+    const bool version4 = TextTokenizer::startsWith(version, "4");
+
+    // Read the count at the start of a section (ASCII line, or packed size_t values in binary v4)
+    auto sectionCount = [&](size_t sectionPos, uint64_t& count) {
+        size_t dataPos = sectionPos;
+        std::string_view headerLine;
+        if (!readLine(text, dataPos, headerLine)) {
+            return false;
+        }
+        if (binary && version4) {
+            // numEntityBlocks, numNodes/numElements, minTag, maxTag
+            if (dataSize != sizeof(uint64_t) || text.size() - dataPos < 2 * sizeof(uint64_t)) {
+                return false;
+            }
+            std::memcpy(&count, text.data() + dataPos + sizeof(uint64_t), sizeof(uint64_t));
+            return true;
+        }
+        if (!readLine(text, dataPos, headerLine)) {
+            return false;
+        }
+        TextTokenizer tokenizer(headerLine);
+        if (version4) {
+            uint64_t entityBlocks = 0;
+            tokenizer.next(entityBlocks);
+        }
+        return tokenizer.next(count);
+    };
+
+    const size_t namesPos = findLineStartingWith(text, pos, "$PhysicalNames");
+    const size_t nodesPos = findLineStartingWith(text, pos, "$Nodes");
+    if (namesPos != std::string_view::npos && (nodesPos == std::string_view::npos || namesPos < nodesPos)) {
+        size_t namePos = namesPos;
+        readLine(text, namePos, line);
+        uint64_t nameCount = 0;
+        if (readLine(text, namePos, line) && TextTokenizer::parse(TextTokenizer::trim(line), nameCount)) {
+            for (uint64_t i = 0; i < nameCount && readLine(text, namePos, line); ++i) {
+                const size_t open = line.find('"');
+                const size_t close = open == std::string_view::npos ? open : line.find('"', open + 1);
+                if (close != std::string_view::npos) {
+                    metadata.physicalRegions.emplace_back(line.substr(open + 1, close - open - 1));
+                }
+            }
+        }
+    }
+
+    if (nodesPos != std::string_view::npos && sectionCount(nodesPos, metadata.pointCount)) {
+        metadata.pointCountKnown = true;
+    }
+    const size_t nodesEnd = nodesPos == std::string_view::npos ? pos : findLineStartingWith(text, nodesPos, "$EndNodes");
+    const size_t elementsPos = nodesEnd == std::string_view::npos ? nodesEnd : findLineStartingWith(text, nodesEnd, "$Elements");
+    if (elementsPos != std::string_view::npos && sectionCount(elementsPos, metadata.cellCount)) {
+        metadata.cellCountKnown = true;
+    }
+    return true;
+}
+
+/**
+ * @brief OpenFOAM: counts from the "note" entry of polyMesh/owner, patch names from polyMesh/boundary
+ * Falls back to the list size at the top of polyMesh/points when the owner note is missing.
+ * Decomposed cases only report the patch names of processor0 (counts stay unknown).
+ */
+bool scanOpenFOAMHeader(const std::string& caseDir, MeshMetadata& metadata, MeshErrorCode& errorCode, std::string& errorMsg) {
+    metadata.meshType = MeshType::VOLUME_MESH;
+    std::filesystem::path polyMesh = openFoamMeshDirectory(caseDir);
+    const bool decomposed = !openFoamHasMesh(polyMesh);
+    if (decomposed) {
+        const std::vector<std::filesystem::path> processors = openFoamProcessorDirectories(caseDir);
+        if (processors.empty()) {
+            errorCode = MeshErrorCode::READ_FAILED;
+            errorMsg = "No polyMesh found in OpenFOAM case: " + caseDir;
+            return false;
+        }
+        polyMesh = processors.front();
+    }
+
+    // Read at most the first bytes of a (possibly huge) file
+    auto readHead = [](const std::filesystem::path& path, size_t maxBytes) {
+        std::string head;
+        std::ifstream file(path, std::ios::binary);
+        if (file.is_open()) {
+            head.resize(maxBytes);
+            file.read(&head[0], static_cast<std::streamsize>(maxBytes));
+            head.resize(static_cast<size_t>(file.gcount()));
+        }
+        return head;
+    };
+    auto noteCount = [](std::string_view note, std::string_view key, uint64_t& value) {
+        const size_t keyPos = note.find(key);
+        return keyPos != std::string_view::npos && TextTokenizer::parse(note.substr(keyPos + key.size()), value);
+    };
+    // List size: first line after the FoamFile dictionary that holds only a number
+    auto listSize = [](std::string_view head, uint64_t& value) {
+        const size_t dictEnd = head.find('}');
+        size_t pos = dictEnd == std::string_view::npos ? 0 : dictEnd + 1;
+        std::string_view line;
+        while (readLine(head, pos, line)) {
+            line = TextTokenizer::trim(line);
+            if (line.empty() || TextTokenizer::startsWith(line, "//")) {
+                continue;
+            }
+            return TextTokenizer::parse(line, value);
+        }
+        return false;
+    };
+
+    const std::string ownerHead = decomposed ? std::string() : readHead(polyMesh / "owner", 4096);
+    const size_t notePos = ownerHead.find("note");
+    if (notePos != std::string::npos) {
+        const std::string_view note = std::string_view(ownerHead).substr(notePos, ownerHead.find(';', notePos) - notePos);
+        metadata.pointCountKnown = noteCount(note, "nPoints:", metadata.pointCount);
+        metadata.cellCountKnown = noteCount(note, "nCells:", metadata.cellCount);
+    }
+    if (!metadata.pointCountKnown && !decomposed) {
+        const std::string pointsHead = readHead(polyMesh / "points", 4096);
+        if (pointsHead.empty()) {
+            errorCode = MeshErrorCode::READ_FAILED;
+            errorMsg = "Cannot open OpenFOAM points file: " + (polyMesh / "points").string();
+            return false;
+        }
+        metadata.pointCountKnown = listSize(pointsHead, metadata.pointCount);
+    }
+
+    // Patch names: top-level dictionary keys of the boundary list
+    const std::string boundary = readHead(polyMesh / "boundary", 1024 * 1024);
+    const size_t dictEnd = boundary.find('}');
+    const size_t listOpen = dictEnd == std::string::npos ? dictEnd : boundary.find('(', dictEnd);
+    if (listOpen != std::string::npos) {
+        int depth = 0;
+        std::string word;
+        for (size_t i = listOpen + 1; i < boundary.size(); ++i) {
+            const char ch = boundary[i];
+            if (ch == '{') {
+                // Processor interfaces are interior faces of the reconstructed mesh
+                if (depth == 0 && !word.empty() && word.compare(0, 12, "procBoundary") != 0) {
+                    metadata.physicalRegions.push_back(word);
+                }
+                ++depth;
+                word.clear();
+            } else if (ch == '}') {
+                --depth;
+            } else if (depth == 0) {
+                if (ch == ')') {
+                    break;
+                }
+                if (TextTokenizer::isSpace(ch)) {
+                    continue;
+                }
+                if (TextTokenizer::isSpace(boundary[i - 1])) {
+                    word.clear();
+                }
+                word.push_back(ch);
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
 /**
  * @brief Extract mesh metadata (without loading full geometry/topology data, improve performance)
  * @param filePath File path (UTF-8)
@@ -160,19 +904,75 @@ bool MeshHelper::extractMetadata(const std::string& filePath,
     }
 
     // Fill basic metadata
+    metadata = MeshMetadata();
     metadata.fileName = std::filesystem::path(filePath).filename().string();
     metadata.format = format;
-
-    // Extract detailed metadata based on format
-    // Basic metadata extraction logic here
-    // For complex formats, need to use corresponding libraries
-
-    // Temporarily return success, but only fill basic information
-    metadata.meshType = MeshType::UNKNOWN;
-    metadata.pointCount = 0;
-    metadata.cellCount = 0;
     metadata.formatVersion = "unknown";
 
+    // Counts are taken from headers only: the mesh body is never parsed
+    bool success = true;
+    if (format == MeshFormat::OPENFOAM) {
+        success = scanOpenFOAMHeader(filePath, metadata, errorCode, errorMsg);
+    } else if (format == MeshFormat::OBJ) {
+        // OBJ has no header: counts stay unknown
+        metadata.meshType = MeshType::SURFACE_MESH;
+    } else if (format == MeshFormat::CGNS) {
+        // CGNS zone sizes live in HDF5 nodes and need the CGNS library to read
+        metadata.meshType = MeshType::VOLUME_MESH;
+    } else if (format == MeshFormat::MESH_CACHE) {
+        // The metadata section holds the full metadata of the cached mesh
+        MeshCache::SourceKey source;
+        success = MeshCache::readHeader(filePath, metadata, source, errorCode, errorMsg);
+        metadata.fileName = std::filesystem::path(filePath).filename().string();
+        metadata.format = format;
+    } else {
+        // Mapping is cheap: only the pages actually inspected are read from disk
+        MappedFile file;
+        std::string mapError;
+        if (!file.open(filePath, mapError)) {
+            errorCode = MeshErrorCode::READ_FAILED;
+            errorMsg = mapError;
+            return false;
+        }
+        const std::string_view text(file.data(), file.size());
+        switch (format) {
+            case MeshFormat::STL_ASCII:
+            case MeshFormat::STL_BINARY:
+                success = scanSTLHeader(text, format, metadata, errorCode, errorMsg);
+                break;
+            case MeshFormat::PLY_ASCII:
+            case MeshFormat::PLY_BINARY:
+                success = scanPLYHeader(text, metadata, errorCode, errorMsg);
+                break;
+            case MeshFormat::OFF:
+                success = scanOFFHeader(text, metadata, errorCode, errorMsg);
+                break;
+            case MeshFormat::SU2:
+                success = scanSU2Header(text, metadata, errorCode, errorMsg);
+                break;
+            case MeshFormat::VTK_LEGACY:
+                success = scanVTKLegacyHeader(text, metadata, errorCode, errorMsg);
+                break;
+            case MeshFormat::VTK_XML:
+                success = scanVTKXMLHeader(text, metadata, errorCode, errorMsg);
+                break;
+            case MeshFormat::GMSH_V2:
+            case MeshFormat::GMSH_V4:
+                success = scanGmshHeader(text, metadata, errorCode, errorMsg);
+                break;
+            default:
+                break;
+        }
+    }
+    if (!success) {
+        return false;
+    }
+    if (metadata.meshType == MeshType::UNKNOWN) {
+        metadata.meshType = meshTypeFromCellTypes(metadata.cellTypeCount);
+    }
+
+    errorCode = MeshErrorCode::SUCCESS;
+    errorMsg.clear();
     return true;
 }
 
@@ -206,6 +1006,8 @@ std::string MeshHelper::getFormatExtension(MeshFormat format) {
             return ".ply";
         case MeshFormat::OFF:
             return ".off";
+        case MeshFormat::MESH_CACHE:
+            return ".mcb";
         default:
             return "";
     }
@@ -244,6 +1046,8 @@ std::string MeshHelper::getFormatName(MeshFormat format) {
             return "PLY Binary";
         case MeshFormat::OFF:
             return "OFF";
+        case MeshFormat::MESH_CACHE:
+            return "Mesh Cache";
         default:
             return "Unknown";
     }
@@ -285,6 +1089,8 @@ MeshFormat MeshHelper::detectFormatFromExtension(const std::string& filePath) {
             return MeshFormat::OFF;
         } else if (ext == ".su2") {
             return MeshFormat::SU2;
+        } else if (ext == ".mcb") {
+            return MeshFormat::MESH_CACHE;
         }
         
         return MeshFormat::UNKNOWN;
@@ -293,6 +1099,34 @@ MeshFormat MeshHelper::detectFormatFromExtension(const std::string& filePath) {
     }
 }
 
+/**
+ * @brief Tell binary from ASCII STL by content (exact binary size first, then the "solid" keyword)
+ * @param filePath File path (UTF-8)
+ * @return MeshFormat::STL_BINARY or MeshFormat::STL_ASCII
+ */
+MeshFormat MeshHelper::detectSTLEncoding(const std::string& filePath) {
+    std::error_code ec;
+    const std::filesystem::path path = std::filesystem::u8path(filePath);
+    const uint64_t fileSize = std::filesystem::file_size(path, ec);
+    std::ifstream file(path, std::ios::binary);
+    if (ec || !file.is_open()) {
+        return MeshFormat::STL_BINARY;
+    }
+    char header[84] = {0};
+    file.read(header, sizeof(header));
+    const size_t headerSize = static_cast<size_t>(file.gcount());
+    if (headerSize == sizeof(header)) {
+        uint32_t triangleCount;
+        std::memcpy(&triangleCount, header + 80, sizeof(triangleCount));
+        if (fileSize == 84 + static_cast<uint64_t>(triangleCount) * 50) {
+            return MeshFormat::STL_BINARY;
+        }
+    }
+    std::string keyword(header, std::min<size_t>(headerSize, 5));
+    std::transform(keyword.begin(), keyword.end(), keyword.begin(), ::tolower);
+    return keyword == "solid" ? MeshFormat::STL_ASCII : MeshFormat::STL_BINARY;
+}
+
 /**
  * @brief Check if a format is supported
  * @param format Mesh format to check
@@ -313,6 +1147,7 @@ bool MeshHelper::isSupportedFormat(MeshFormat format) {
         case MeshFormat::PLY_ASCII:
         case MeshFormat::PLY_BINARY:
         case MeshFormat::OFF:
+        case MeshFormat::MESH_CACHE:
             return true;
         default:
             return false;
@@ -337,7 +1172,8 @@ std::vector<MeshFormat> MeshHelper::getSupportedFormats() {
         MeshFormat::OBJ,
         MeshFormat::PLY_ASCII,
         MeshFormat::PLY_BINARY,
-        MeshFormat::OFF
+        MeshFormat::OFF,
+        MeshFormat::MESH_CACHE
     };
 }
 
@@ -359,7 +1195,8 @@ std::vector<std::string> MeshHelper::getSupportedFormatNames() {
         "OBJ (.obj)",
         "PLY ASCII (.ply)",
         "PLY Binary (.ply)",
-        "OFF (.off)"
+        "OFF (.off)",
+        "Mesh Cache (.mcb)"
     };
 }
 
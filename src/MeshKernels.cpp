@@ -0,0 +1,463 @@
+#include "MeshKernels.h"
+#include "ParallelFor.h"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define MESH_KERNELS_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define MESH_TARGET_AVX2
+#else
+#define MESH_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define MESH_KERNELS_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+// Array entries per task below which the scan runs serially
+constexpr size_t PARALLEL_MIN_SCAN_ITEMS = 1024 * 1024;
+
+// Bounding box accumulator [minX, maxX, minY, maxY, minZ, maxZ]
+using Bounds = float[6];
+
+/**
+ * @brief Kernels of one instruction set
+ */
+struct KernelTable {
+    void (*bounds)(const float* points, size_t count, float* bounds);     // Grow bounds by count xyz points
+    uint32_t (*maxIndex)(const uint32_t* indices, size_t count);          // Largest entry (0 when count == 0)
+};
+
+void boundsScalar(const float* points, size_t count, float* bounds) {
+    for (size_t i = 0; i < count; ++i) {
+        for (int axis = 0; axis < 3; ++axis) {
+            const float value = points[i * 3 + axis];
+            bounds[axis * 2] = std::min(bounds[axis * 2], value);
+            bounds[axis * 2 + 1] = std::max(bounds[axis * 2 + 1], value);
+        }
+    }
+}
+
+uint32_t maxIndexScalar(const uint32_t* indices, size_t count) {
+    uint32_t maximum = 0;
+    for (size_t i = 0; i < count; ++i) {
+        maximum = std::max(maximum, indices[i]);
+    }
+    return maximum;
+}
+
+/**
+ * @brief Fold per-lane accumulators back into per-axis bounds
+ * Lane k of a block of whole points always holds coordinate k % 3.
+ */
+void foldLanes(const float* low, const float* high, size_t lanes, float* bounds) {
+    for (size_t k = 0; k < lanes; ++k) {
+        const size_t axis = k % 3;
+        bounds[axis * 2] = std::min(bounds[axis * 2], low[k]);
+        bounds[axis * 2 + 1] = std::max(bounds[axis * 2 + 1], high[k]);
+    }
+}
+
+#if defined(MESH_KERNELS_X86)
+
+// The min/max instructions return their second operand when the first is NaN, so the
+// accumulator is always passed second and NaN coordinates are skipped like std::min does
+
+void boundsSse2(const float* points, size_t count, float* bounds) {
+    const size_t blocks = count / 4;  // 4 points = 12 floats = 3 registers
+    if (blocks > 0) {
+        __m128 low[3];
+        __m128 high[3];
+        for (int r = 0; r < 3; ++r) {
+            low[r] = _mm_set1_ps(std::numeric_limits<float>::max());
+            high[r] = _mm_set1_ps(std::numeric_limits<float>::lowest());
+        }
+        for (size_t b = 0; b < blocks; ++b) {
+            const float* block = points + b * 12;
+            for (int r = 0; r < 3; ++r) {
+                const __m128 values = _mm_loadu_ps(block + r * 4);
+                low[r] = _mm_min_ps(values, low[r]);
+                high[r] = _mm_max_ps(values, high[r]);
+            }
+        }
+        float lowLanes[12];
+        float highLanes[12];
+        for (int r = 0; r < 3; ++r) {
+            _mm_storeu_ps(lowLanes + r * 4, low[r]);
+            _mm_storeu_ps(highLanes + r * 4, high[r]);
+        }
+        foldLanes(lowLanes, highLanes, 12, bounds);
+    }
+    boundsScalar(points + blocks * 12, count - blocks * 4, bounds);
+}
+
+uint32_t maxIndexSse2(const uint32_t* indices, size_t count) {
+    // SSE2 has no unsigned 32-bit max: compare with the sign bit flipped and blend
+    const size_t blocks = count / 4;
+    uint32_t maximum = 0;
+    if (blocks > 0) {
+        const __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000u));
+        __m128i biasedMax = bias;  // Biased zero
+        for (size_t b = 0; b < blocks; ++b) {
+            const __m128i values = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + b * 4)), bias);
+            const __m128i greater = _mm_cmpgt_epi32(values, biasedMax);
+            biasedMax = _mm_or_si128(_mm_and_si128(greater, values), _mm_andnot_si128(greater, biasedMax));
+        }
+        uint32_t lanes[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), _mm_xor_si128(biasedMax, bias));
+        maximum = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+    }
+    return std::max(maximum, maxIndexScalar(indices + blocks * 4, count - blocks * 4));
+}
+
+MESH_TARGET_AVX2 void boundsAvx2(const float* points, size_t count, float* bounds) {
+    const size_t blocks = count / 8;  // 8 points = 24 floats = 3 registers
+    if (blocks > 0) {
+        __m256 low[3];
+        __m256 high[3];
+        for (int r = 0; r < 3; ++r) {
+            low[r] = _mm256_set1_ps(std::numeric_limits<float>::max());
+            high[r] = _mm256_set1_ps(std::numeric_limits<float>::lowest());
+        }
+        for (size_t b = 0; b < blocks; ++b) {
+            const float* block = points + b * 24;
+            for (int r = 0; r < 3; ++r) {
+                const __m256 values = _mm256_loadu_ps(block + r * 8);
+                low[r] = _mm256_min_ps(values, low[r]);
+                high[r] = _mm256_max_ps(values, high[r]);
+            }
+        }
+        float lowLanes[24];
+        float highLanes[24];
+        for (int r = 0; r < 3; ++r) {
+            _mm256_storeu_ps(lowLanes + r * 8, low[r]);
+            _mm256_storeu_ps(highLanes + r * 8, high[r]);
+        }
+        foldLanes(lowLanes, highLanes, 24, bounds);
+    }
+    boundsScalar(points + blocks * 24, count - blocks * 8, bounds);
+}
+
+MESH_TARGET_AVX2 uint32_t maxIndexAvx2(const uint32_t* indices, size_t count) {
+    const size_t blocks = count / 8;
+    uint32_t maximum = 0;
+    if (blocks > 0) {
+        __m256i blockMax = _mm256_setzero_si256();
+        for (size_t b = 0; b < blocks; ++b) {
+            blockMax = _mm256_max_epu32(blockMax, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + b * 8)));
+        }
+        uint32_t lanes[8];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), blockMax);
+        maximum = *std::max_element(lanes, lanes + 8);
+    }
+    return std::max(maximum, maxIndexScalar(indices + blocks * 8, count - blocks * 8));
+}
+
+/**
+ * @brief Check AVX2 support (CPU feature and OS-enabled YMM state)
+ */
+bool cpuSupportsAvx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    const bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+    __cpuidex(info, 7, 0);
+    return osSavesYmm && (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#elif defined(MESH_KERNELS_NEON)
+
+// vminnmq/vmaxnmq return the number when one operand is NaN, matching std::min/std::max here
+
+void boundsNeon(const float* points, size_t count, float* bounds) {
+    const size_t blocks = count / 4;  // 4 points = 12 floats = 3 registers
+    if (blocks > 0) {
+        float32x4_t low[3];
+        float32x4_t high[3];
+        for (int r = 0; r < 3; ++r) {
+            low[r] = vdupq_n_f32(std::numeric_limits<float>::max());
+            high[r] = vdupq_n_f32(std::numeric_limits<float>::lowest());
+        }
+        for (size_t b = 0; b < blocks; ++b) {
+            const float* block = points + b * 12;
+            for (int r = 0; r < 3; ++r) {
+                const float32x4_t values = vld1q_f32(block + r * 4);
+                low[r] = vminnmq_f32(low[r], values);
+                high[r] = vmaxnmq_f32(high[r], values);
+            }
+        }
+        float lowLanes[12];
+        float highLanes[12];
+        for (int r = 0; r < 3; ++r) {
+            vst1q_f32(lowLanes + r * 4, low[r]);
+            vst1q_f32(highLanes + r * 4, high[r]);
+        }
+        foldLanes(lowLanes, highLanes, 12, bounds);
+    }
+    boundsScalar(points + blocks * 12, count - blocks * 4, bounds);
+}
+
+uint32_t maxIndexNeon(const uint32_t* indices, size_t count) {
+    const size_t blocks = count / 4;
+    uint32_t maximum = 0;
+    if (blocks > 0) {
+        uint32x4_t blockMax = vdupq_n_u32(0);
+        for (size_t b = 0; b < blocks; ++b) {
+            blockMax = vmaxq_u32(blockMax, vld1q_u32(indices + b * 4));
+        }
+        maximum = vmaxvq_u32(blockMax);
+    }
+    return std::max(maximum, maxIndexScalar(indices + blocks * 4, count - blocks * 4));
+}
+
+#endif
+
+/**
+ * @brief Check whether this build and CPU can run a SIMD level
+ */
+bool isSupported(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::SCALAR:
+            return true;
+#if defined(MESH_KERNELS_X86)
+        case SimdLevel::SSE2:
+            return true;
+        case SimdLevel::AVX2:
+            return cpuSupportsAvx2();
+#elif defined(MESH_KERNELS_NEON)
+        case SimdLevel::NEON:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Kernel table of a supported SIMD level
+ */
+KernelTable kernelTable(SimdLevel level) {
+    switch (level) {
+#if defined(MESH_KERNELS_X86)
+        case SimdLevel::SSE2:
+            return {boundsSse2, maxIndexSse2};
+        case SimdLevel::AVX2:
+            return {boundsAvx2, maxIndexAvx2};
+#elif defined(MESH_KERNELS_NEON)
+        case SimdLevel::NEON:
+            return {boundsNeon, maxIndexNeon};
+#endif
+        default:
+            return {boundsScalar, maxIndexScalar};
+    }
+}
+
+// Active level (-1 = not detected yet)
+std::atomic<int> activeLevel{-1};
+
+/**
+ * @brief Count cell types of a range (four sub-histograms hide store-to-load latency on runs
+ * of equal types, which are the common case)
+ */
+void countTypeRange(const VtkCellType* types, size_t count, std::array<uint64_t, 256>& histogram) {
+    std::vector<uint64_t> counts(4 * 256, 0);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        counts[static_cast<uint8_t>(types[i])]++;
+        counts[256 + static_cast<uint8_t>(types[i + 1])]++;
+        counts[512 + static_cast<uint8_t>(types[i + 2])]++;
+        counts[768 + static_cast<uint8_t>(types[i + 3])]++;
+    }
+    for (; i < count; ++i) {
+        counts[static_cast<uint8_t>(types[i])]++;
+    }
+    for (size_t t = 0; t < 256; ++t) {
+        histogram[t] += counts[t] + counts[256 + t] + counts[512 + t] + counts[768 + t];
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Scan a mesh
+ * @param meshData Mesh data
+ * @param parts Parts to compute (MeshScanParts flags)
+ * @param threads Worker threads (0 = hardware concurrency, 1 = serial)
+ * @return Scan result (parts not requested keep their defaults)
+ */
+MeshScanResult MeshKernels::scan(const MeshData& meshData, unsigned int parts, unsigned int threads) {
+    const KernelTable kernels = kernelTable(simdLevel());
+    const size_t pointCount = meshData.points.size() / 3;
+    const std::vector<uint32_t>& connectivity = meshData.cells.connectivity;
+    const std::vector<VtkCellType>& types = meshData.cells.types;
+    const bool scanBounds = (parts & SCAN_BOUNDS) != 0;
+    const bool scanIndices = (parts & SCAN_INDICES) != 0;
+    const bool scanTypes = (parts & SCAN_CELL_TYPES) != 0;
+
+    // Every task takes the same fraction of each array, so work stays balanced across parts
+    size_t workItems = 0;
+    workItems = std::max(workItems, scanBounds ? meshData.points.size() : 0);
+    workItems = std::max(workItems, scanIndices ? connectivity.size() : 0);
+    workItems = std::max(workItems, scanTypes ? types.size() : 0);
+    const size_t taskCount = parallelTaskCount(workItems, PARALLEL_MIN_SCAN_ITEMS, threads);
+
+    struct Partial {
+        float bounds[6];
+        uint32_t maxIndex = 0;
+        std::array<uint64_t, 256> cellTypeCount{};
+    };
+    std::vector<Partial> partials(taskCount);
+    runParallel(taskCount, [&](size_t task) {
+        Partial& partial = partials[task];
+        auto slice = [task, taskCount](size_t count, size_t& begin) {
+            begin = count * task / taskCount;
+            return count * (task + 1) / taskCount - begin;
+        };
+        size_t begin = 0;
+        if (scanBounds) {
+            for (int axis = 0; axis < 3; ++axis) {
+                partial.bounds[axis * 2] = std::numeric_limits<float>::max();
+                partial.bounds[axis * 2 + 1] = std::numeric_limits<float>::lowest();
+            }
+            const size_t count = slice(pointCount, begin);
+            kernels.bounds(meshData.points.data() + begin * 3, count, partial.bounds);
+        }
+        if (scanIndices) {
+            const size_t count = slice(connectivity.size(), begin);
+            partial.maxIndex = kernels.maxIndex(connectivity.data() + begin, count);
+        }
+        if (scanTypes) {
+            const size_t count = slice(types.size(), begin);
+            countTypeRange(types.data() + begin, count, partial.cellTypeCount);
+        }
+    });
+
+    MeshScanResult result;
+    if (scanBounds) {
+        for (int axis = 0; axis < 3; ++axis) {
+            result.bounds[axis * 2] = std::numeric_limits<float>::max();
+            result.bounds[axis * 2 + 1] = std::numeric_limits<float>::lowest();
+        }
+        for (const Partial& partial : partials) {
+            for (int axis = 0; axis < 3; ++axis) {
+                result.bounds[axis * 2] = std::min(result.bounds[axis * 2], partial.bounds[axis * 2]);
+                result.bounds[axis * 2 + 1] = std::max(result.bounds[axis * 2 + 1], partial.bounds[axis * 2 + 1]);
+            }
+        }
+    }
+    if (scanIndices) {
+        for (const Partial& partial : partials) {
+            result.maxPointIndex = std::max(result.maxPointIndex, partial.maxIndex);
+        }
+        result.indicesValid = connectivity.empty() || result.maxPointIndex < pointCount;
+    }
+    if (scanTypes) {
+        for (const Partial& partial : partials) {
+            for (size_t t = 0; t < 256; ++t) {
+                result.cellTypeCount[t] += partial.cellTypeCount[t];
+            }
+        }
+        result.hasVolumeCells = hasVolumeCells(result.cellTypeCount);
+    }
+    return result;
+}
+
+/**
+ * @brief Count cells per type (shared by every coordinate/index layout)
+ * @param types Cell type array
+ * @param threads Worker threads (0 = hardware concurrency, 1 = serial)
+ * @return Cells per VtkCellType value
+ */
+std::array<uint64_t, 256> MeshKernels::countCellTypes(const std::vector<VtkCellType>& types, unsigned int threads) {
+    const size_t taskCount = parallelTaskCount(types.size(), PARALLEL_MIN_SCAN_ITEMS, threads);
+    std::vector<std::array<uint64_t, 256>> partials(taskCount, std::array<uint64_t, 256>{});
+    parallelForRanges(types.size(), taskCount, [&](size_t begin, size_t end, size_t task) {
+        countTypeRange(types.data() + begin, end - begin, partials[task]);
+    });
+    std::array<uint64_t, 256> result{};
+    for (const auto& partial : partials) {
+        for (size_t t = 0; t < 256; ++t) {
+            result[t] += partial[t];
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Check whether a cell type histogram contains tetrahedra, hexahedra, wedges or pyramids
+ * @param cellTypeCount Cells per VtkCellType value
+ * @return Whether the mesh has volume cells
+ */
+bool MeshKernels::hasVolumeCells(const std::array<uint64_t, 256>& cellTypeCount) {
+    return cellTypeCount[static_cast<uint8_t>(VtkCellType::TETRA)] > 0 ||
+           cellTypeCount[static_cast<uint8_t>(VtkCellType::HEXAHEDRON)] > 0 ||
+           cellTypeCount[static_cast<uint8_t>(VtkCellType::WEDGE)] > 0 ||
+           cellTypeCount[static_cast<uint8_t>(VtkCellType::PYRAMID)] > 0;
+}
+
+/**
+ * @brief Get the instruction set the kernels currently use
+ * @return Active SIMD level (the best supported one unless overridden)
+ */
+SimdLevel MeshKernels::simdLevel() {
+    int level = activeLevel.load(std::memory_order_relaxed);
+    if (level < 0) {
+        level = static_cast<int>(detectSimdLevel());
+        activeLevel.store(level, std::memory_order_relaxed);
+    }
+    return static_cast<SimdLevel>(level);
+}
+
+/**
+ * @brief Get the best instruction set supported by this CPU
+ * @return Detected SIMD level
+ */
+SimdLevel MeshKernels::detectSimdLevel() {
+    for (SimdLevel level : {SimdLevel::AVX2, SimdLevel::NEON, SimdLevel::SSE2}) {
+        if (isSupported(level)) {
+            return level;
+        }
+    }
+    return SimdLevel::SCALAR;
+}
+
+/**
+ * @brief Override the instruction set (benchmarks, tests); unsupported levels fall back to SCALAR
+ * @param level Requested SIMD level
+ */
+void MeshKernels::setSimdLevel(SimdLevel level) {
+    activeLevel.store(static_cast<int>(isSupported(level) ? level : SimdLevel::SCALAR), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Get display name of a SIMD level
+ * @param level SIMD level
+ * @return Name (e.g. "AVX2")
+ */
+const char* MeshKernels::simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::SSE2:
+            return "SSE2";
+        case SimdLevel::AVX2:
+            return "AVX2";
+        case SimdLevel::NEON:
+            return "NEON";
+        default:
+            return "scalar";
+    }
+}
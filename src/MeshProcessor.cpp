@@ -1,6 +1,1505 @@
 #include "MeshProcessor.h"
+#include "CellFaces.h"
+#include "JobControl.h"
+#include "MeshKernels.h"
+#include "ParallelFor.h"
+#include "SurfaceCells.h"
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <limits>
+#include <memory>
+#include <unordered_map>
+
+namespace {
+
+// Cells per task below which face enumeration runs serially
+constexpr size_t PARALLEL_MIN_CELLS = 64 * 1024;
+// Face-key buckets per task: buckets are sorted independently, so more buckets balance better
+constexpr size_t BUCKETS_PER_TASK = 4;
+// Padding for the unused fourth slot of a triangle face key
+constexpr uint32_t NO_POINT = std::numeric_limits<uint32_t>::max();
+// Points per task below which smoothing sweeps run serially
+constexpr size_t PARALLEL_MIN_POINTS = 16 * 1024;
+
+/**
+ * @brief Canonical face key (sorted point indices) and the face it came from
+ */
+struct FaceRecord {
+    uint32_t key[4];  // Ascending point indices, NO_POINT-padded for triangles
+    uint64_t face;    // Global face index (cell face offset + local face)
+
+    bool operator<(const FaceRecord& other) const {
+        for (int i = 0; i < 4; ++i) {
+            if (key[i] != other.key[i]) {
+                return key[i] < other.key[i];
+            }
+        }
+        return face < other.face;
+    }
+    bool sameKey(const FaceRecord& other) const {
+        return key[0] == other.key[0] && key[1] == other.key[1] && key[2] == other.key[2] && key[3] == other.key[3];
+    }
+};
+
+/**
+ * @brief Build the canonical key of one cell face
+ * @param cellPoints Point indices of the cell
+ * @param table Face table of the cell type
+ * @param localFace Face index within the cell
+ * @param face Global face index
+ * @return Face record
+ */
+inline FaceRecord makeFaceRecord(const uint32_t* cellPoints, const CellFaceTable& table, size_t localFace, uint64_t face) {
+    FaceRecord record;
+    const uint8_t size = table.faceSize[localFace];
+    for (uint8_t i = 0; i < 4; ++i) {
+        record.key[i] = i < size ? cellPoints[table.corners[localFace][i]] : NO_POINT;
+    }
+    // Sorting network for four keys
+    auto order = [&record](int a, int b) {
+        if (record.key[b] < record.key[a]) {
+            std::swap(record.key[a], record.key[b]);
+        }
+    };
+    order(0, 1);
+    order(2, 3);
+    order(0, 2);
+    order(1, 3);
+    order(1, 2);
+    record.face = face;
+    return record;
+}
+
+/**
+ * @brief Bucket of a face key (keys of one face always land in the same bucket)
+ * @param record Face record
+ * @param bucketCount Number of buckets
+ * @return Bucket index
+ */
+inline size_t faceBucket(const FaceRecord& record, size_t bucketCount) {
+    uint64_t hash = (static_cast<uint64_t>(record.key[0]) << 32) ^ record.key[1];
+    hash ^= ((static_cast<uint64_t>(record.key[2]) << 32) ^ record.key[3]) * 0x9E3779B97F4A7C15ULL;
+    hash = (hash ^ (hash >> 31)) * 0xBF58476D1CE4E5B9ULL;
+    return static_cast<size_t>((hash ^ (hash >> 29)) % bucketCount);
+}
+
+/**
+ * @brief Edges of a 3D cell type (cell-local corner pairs)
+ */
+struct CellEdgeTable {
+    uint8_t edgeCount;       // Edges of the cell
+    uint8_t corners[12][2];  // Cell-local corner indices of each edge
+};
+
+const CellEdgeTable TETRA_EDGES = {6, {{0, 1}, {1, 2}, {2, 0}, {0, 3}, {1, 3}, {2, 3}}};
+const CellEdgeTable HEXAHEDRON_EDGES = {12, {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {4, 5}, {5, 6},
+                                             {6, 7}, {7, 4}, {0, 4}, {1, 5}, {2, 6}, {3, 7}}};
+const CellEdgeTable WEDGE_EDGES = {9, {{0, 1}, {1, 2}, {2, 0}, {3, 4}, {4, 5}, {5, 3}, {0, 3}, {1, 4}, {2, 5}}};
+const CellEdgeTable PYRAMID_EDGES = {8, {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {0, 4}, {1, 4}, {2, 4}, {3, 4}}};
+
+/**
+ * @brief Get the edge table of a 3D cell type
+ * @param type Cell type
+ * @return Edge table, nullptr for cells that are not 3D
+ */
+const CellEdgeTable* cellEdgeTable(VtkCellType type) {
+    switch (type) {
+        case VtkCellType::TETRA: return &TETRA_EDGES;
+        case VtkCellType::HEXAHEDRON: return &HEXAHEDRON_EDGES;
+        case VtkCellType::WEDGE: return &WEDGE_EDGES;
+        case VtkCellType::PYRAMID: return &PYRAMID_EDGES;
+        default: return nullptr;
+    }
+}
+
+/**
+ * @brief Call a function for every edge of a cell (edges shared with other cells are repeated)
+ * Lines are treated as polylines, polygons as closed loops; vertices have no edges.
+ * @param cells Cell array
+ * @param cell Cell index
+ * @param edge Callback taking (uint32_t a, uint32_t b)
+ */
+template<typename EdgeFn>
+void forEachCellEdge(const MeshData::CellArray& cells, size_t cell, EdgeFn&& edge) {
+    const uint32_t* p = cells.cellPoints(cell);
+    const size_t count = cells.cellSize(cell);
+    switch (cells.types[cell]) {
+        case VtkCellType::LINE:
+            for (size_t k = 0; k + 1 < count; ++k) {
+                edge(p[k], p[k + 1]);
+            }
+            break;
+        case VtkCellType::TRIANGLE:
+        case VtkCellType::QUAD:
+        case VtkCellType::POLYGON:
+            if (count >= 2) {
+                for (size_t k = 0; k < count; ++k) {
+                    edge(p[k], p[(k + 1) % count]);
+                }
+            }
+            break;
+        case VtkCellType::TRIANGLE_STRIP:
+            for (size_t k = 0; k + 1 < count; ++k) {
+                edge(p[k], p[k + 1]);
+                if (k + 2 < count) {
+                    edge(p[k], p[k + 2]);
+                }
+            }
+            break;
+        default:
+            if (const CellEdgeTable* table = cellEdgeTable(cells.types[cell])) {
+                for (uint8_t e = 0; e < table->edgeCount; ++e) {
+                    edge(p[table->corners[e][0]], p[table->corners[e][1]]);
+                }
+            }
+            break;
+    }
+}
+
+/**
+ * @brief Point-to-point adjacency in CSR form (neighbours of point i are
+ * neighbors[offsets[i] .. offsets[i + 1]), sorted and unique)
+ */
+struct PointAdjacency {
+    std::vector<uint64_t> offsets;
+    std::vector<uint32_t> neighbors;
+};
+
+/**
+ * @brief Build the point adjacency of a cell array
+ * Directed edge entries are counted and scattered once, then every point's list is sorted and
+ * deduplicated in parallel and the lists are compacted.
+ * @param cells Cells (point indices already validated)
+ * @param pointCount Number of points
+ * @param threads Worker threads (0 = hardware concurrency)
+ * @param[out] adjacency Output adjacency
+ */
+void buildPointAdjacency(const MeshData::CellArray& cells, size_t pointCount, unsigned int threads,
+                         PointAdjacency& adjacency) {
+    std::vector<uint64_t> offsets(pointCount + 1, 0);
+    for (size_t c = 0; c < cells.size(); ++c) {
+        forEachCellEdge(cells, c, [&offsets](uint32_t a, uint32_t b) {
+            if (a != b) {
+                offsets[a + 1]++;
+                offsets[b + 1]++;
+            }
+        });
+    }
+    for (size_t i = 0; i < pointCount; ++i) {
+        offsets[i + 1] += offsets[i];
+    }
+
+    std::vector<uint32_t> entries(offsets[pointCount]);
+    std::vector<uint64_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (size_t c = 0; c < cells.size(); ++c) {
+        forEachCellEdge(cells, c, [&](uint32_t a, uint32_t b) {
+            if (a != b) {
+                entries[cursor[a]++] = b;
+                entries[cursor[b]++] = a;
+            }
+        });
+    }
+    cursor.clear();
+    cursor.shrink_to_fit();
+
+    // Sort and deduplicate each list in place, then compact
+    const size_t taskCount = parallelTaskCount(pointCount, PARALLEL_MIN_POINTS, threads);
+    std::vector<uint64_t> uniqueCounts(pointCount + 1, 0);
+    parallelForRanges(pointCount, taskCount, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) {
+            uint32_t* first = entries.data() + offsets[i];
+            uint32_t* last = entries.data() + offsets[i + 1];
+            std::sort(first, last);
+            uniqueCounts[i + 1] = static_cast<uint64_t>(std::unique(first, last) - first);
+        }
+    });
+    for (size_t i = 0; i < pointCount; ++i) {
+        uniqueCounts[i + 1] += uniqueCounts[i];
+    }
+    adjacency.neighbors.resize(uniqueCounts[pointCount]);
+    parallelForRanges(pointCount, taskCount, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) {
+            std::copy(entries.begin() + offsets[i], entries.begin() + offsets[i] + (uniqueCounts[i + 1] - uniqueCounts[i]),
+                      adjacency.neighbors.begin() + uniqueCounts[i]);
+        }
+    });
+    adjacency.offsets = std::move(uniqueCounts);
+}
+
+/**
+ * @brief Mark the boundary points of a mesh
+ * With 3D cells, boundary points lie on faces used by one cell; otherwise on polygon edges
+ * used by one face.
+ * @param cells Cells (point indices already validated)
+ * @param pointCount Number of points
+ * @param[out] boundary Per-point flag (1 = boundary)
+ */
+void markBoundaryPoints(const MeshData::CellArray& cells, size_t pointCount, std::vector<uint8_t>& boundary) {
+    boundary.assign(pointCount, 0);
+    const bool hasVolumeCells = std::any_of(cells.types.begin(), cells.types.end(),
+        [](VtkCellType type) { return cellFaceTable(type) != nullptr; });
+
+    if (hasVolumeCells) {
+        std::vector<FaceRecord> faces;
+        for (size_t c = 0; c < cells.size(); ++c) {
+            const CellFaceTable* table = cellFaceTable(cells.types[c]);
+            if (!table) {
+                continue;
+            }
+            for (size_t f = 0; f < table->faceCount; ++f) {
+                faces.push_back(makeFaceRecord(cells.cellPoints(c), *table, f, 0));
+            }
+        }
+        std::sort(faces.begin(), faces.end());
+        for (size_t first = 0; first < faces.size();) {
+            size_t run = first + 1;
+            while (run < faces.size() && faces[run].sameKey(faces[first])) {
+                ++run;
+            }
+            if (run - first == 1) {
+                for (uint32_t point : faces[first].key) {
+                    if (point != NO_POINT) {
+                        boundary[point] = 1;
+                    }
+                }
+            }
+            first = run;
+        }
+        return;
+    }
+
+    std::vector<uint64_t> edges;
+    for (size_t c = 0; c < cells.size(); ++c) {
+        const VtkCellType type = cells.types[c];
+        if (type != VtkCellType::TRIANGLE && type != VtkCellType::QUAD &&
+            type != VtkCellType::POLYGON && type != VtkCellType::TRIANGLE_STRIP) {
+            continue;
+        }
+        forEachCellEdge(cells, c, [&edges](uint32_t a, uint32_t b) {
+            if (a != b) {
+                edges.push_back((static_cast<uint64_t>((std::min)(a, b)) << 32) | (std::max)(a, b));
+            }
+        });
+    }
+    std::sort(edges.begin(), edges.end());
+    for (size_t first = 0; first < edges.size();) {
+        size_t run = first + 1;
+        while (run < edges.size() && edges[run] == edges[first]) {
+            ++run;
+        }
+        if (run - first == 1) {
+            boundary[static_cast<size_t>(edges[first] >> 32)] = 1;
+            boundary[static_cast<size_t>(edges[first] & 0xFFFFFFFFu)] = 1;
+        }
+        first = run;
+    }
+}
+
+/**
+ * @brief One smoothing pass: next = p + factor * weight * (mean(neighbours) - p)
+ * The update is branch free: fixed and isolated points have weight 0.
+ * @param adjacency Point adjacency
+ * @param inverseDegree Per-point 1/degree (0 for points that must not move)
+ * @param factor Pass factor (Laplacian relaxation, Taubin lambda or mu)
+ * @param current Current positions (xyz)
+ * @param[out] next Updated positions (xyz)
+ * @param taskCount Number of parallel tasks
+ */
+void smoothingPass(const PointAdjacency& adjacency, const std::vector<float>& inverseDegree, float factor,
+                   const float* current, float* next, size_t taskCount) {
+    const size_t pointCount = inverseDegree.size();
+    const uint64_t* offsets = adjacency.offsets.data();
+    const uint32_t* neighbors = adjacency.neighbors.data();
+    const float* weights = inverseDegree.data();
+    parallelForRanges(pointCount, taskCount, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) {
+            float sx = 0.0f;
+            float sy = 0.0f;
+            float sz = 0.0f;
+            for (uint64_t k = offsets[i]; k < offsets[i + 1]; ++k) {
+                const float* q = current + static_cast<size_t>(neighbors[k]) * 3;
+                sx += q[0];
+                sy += q[1];
+                sz += q[2];
+            }
+            const float* p = current + i * 3;
+            const float w = weights[i];
+            const float f = w > 0.0f ? factor : 0.0f;
+            next[i * 3] = p[0] + f * (sx * w - p[0]);
+            next[i * 3 + 1] = p[1] + f * (sy * w - p[1]);
+            next[i * 3 + 2] = p[2] + f * (sz * w - p[2]);
+        }
+    });
+}
+
+// Triangles per partition below which decimation runs serially
+constexpr size_t PARALLEL_MIN_TRIANGLES = 256 * 1024;
+// Upper bound of the decimation partitions (the layout depends on the mesh only, never on the thread count)
+constexpr size_t MAX_DECIMATION_PARTITIONS = 16;
+// Weight of the perpendicular planes that pin open boundary edges (relative to face planes)
+constexpr double BOUNDARY_PENALTY = 1000.0;
+// Histogram bins along the split axis used to cut triangles into equal-sized slabs
+constexpr size_t PARTITION_BINS = 4096;
+// Vertex state bits of the decimator
+constexpr uint8_t VERTEX_LOCKED = 1;    // Must not move or be removed (partition seam)
+constexpr uint8_t VERTEX_BOUNDARY = 2;  // Lies on an open boundary edge
+constexpr uint8_t VERTEX_REMOVED = 4;   // Collapsed into another vertex
+// Partition id of vertices shared by several partitions
+constexpr uint32_t SEAM_PARTITION = NO_POINT;
+
+/**
+ * @brief Symmetric 4x4 error quadric (Garland-Heckbert), stored as its upper triangle
+ */
+struct Quadric {
+    double q[10] = {};  // a11 a12 a13 a14 a22 a23 a24 a33 a34 a44
+
+    void addPlane(double a, double b, double c, double d, double weight) {
+        q[0] += weight * a * a; q[1] += weight * a * b; q[2] += weight * a * c; q[3] += weight * a * d;
+        q[4] += weight * b * b; q[5] += weight * b * c; q[6] += weight * b * d;
+        q[7] += weight * c * c; q[8] += weight * c * d;
+        q[9] += weight * d * d;
+    }
+
+    Quadric& operator+=(const Quadric& other) {
+        for (int i = 0; i < 10; ++i) {
+            q[i] += other.q[i];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Squared distance error of a position
+     * @param p Position (xyz)
+     * @return Error value
+     */
+    double error(const double* p) const {
+        const double x = p[0];
+        const double y = p[1];
+        const double z = p[2];
+        return q[0] * x * x + 2.0 * q[1] * x * y + 2.0 * q[2] * x * z + 2.0 * q[3] * x
+             + q[4] * y * y + 2.0 * q[5] * y * z + 2.0 * q[6] * y
+             + q[7] * z * z + 2.0 * q[8] * z + q[9];
+    }
+
+    /**
+     * @brief Position minimizing the error (solves the 3x3 system by Cramer's rule)
+     * @param[out] p Optimal position
+     * @return Whether the system is well conditioned
+     */
+    bool optimum(double* p) const {
+        const double det = q[0] * (q[4] * q[7] - q[5] * q[5])
+                         - q[1] * (q[1] * q[7] - q[5] * q[2])
+                         + q[2] * (q[1] * q[5] - q[4] * q[2]);
+        const double trace = q[0] + q[4] + q[7];
+        if (!(std::abs(det) > 1e-10 * trace * trace * trace)) {
+            return false;
+        }
+        const double bx = -q[3];
+        const double by = -q[6];
+        const double bz = -q[8];
+        p[0] = (bx * (q[4] * q[7] - q[5] * q[5]) - q[1] * (by * q[7] - q[5] * bz) + q[2] * (by * q[5] - q[4] * bz)) / det;
+        p[1] = (q[0] * (by * q[7] - q[5] * bz) - bx * (q[1] * q[7] - q[5] * q[2]) + q[2] * (q[1] * bz - by * q[2])) / det;
+        p[2] = (q[0] * (q[4] * bz - by * q[5]) - q[1] * (q[1] * bz - by * q[2]) + bx * (q[1] * q[5] - q[4] * q[2])) / det;
+        return std::isfinite(p[0]) && std::isfinite(p[1]) && std::isfinite(p[2]);
+    }
+};
+
+/**
+ * @brief Quadric-error edge-collapse decimator over a triangle corner table
+ *
+ * Every triangle owns three corners; each vertex links the corners that reference it into a
+ * singly linked list (firstCorner_/nextCorner_), so the structure costs two indices per corner.
+ * Removed triangles keep their slots (all corners set to NO_POINT) and are unlinked lazily.
+ * Each vertex queues only its cheapest edge in an addressable min-heap, so a collapse updates
+ * the entries of the touched vertices in place instead of leaving stale candidates behind.
+ */
+class QuadricDecimator {
+public:
+    std::vector<double> positions;   // xyz per vertex
+    std::vector<double> attributes;  // attributeWidth interpolated point values per vertex
+    size_t attributeWidth = 0;
+    std::vector<uint32_t> corners;   // Three vertices per triangle, NO_POINT for removed triangles
+    std::vector<Quadric> quadrics;   // Accumulated error quadric per vertex
+    std::vector<uint8_t> flags;      // VERTEX_* bits per vertex
+    size_t liveTriangles = 0;
+
+    /**
+     * @brief Link corners, detect open boundaries and accumulate the initial quadrics
+     * positions and corners must be filled first; flags may be preset with VERTEX_LOCKED.
+     * @param preserveBoundary Whether to add penalty planes along open boundary edges
+     */
+    void build(bool preserveBoundary) {
+        const size_t vertexCount = positions.size() / 3;
+        const size_t triangleCount = corners.size() / 3;
+        flags.resize(vertexCount, 0);
+        quadrics.assign(vertexCount, Quadric());
+        firstCorner_.assign(vertexCount, NO_POINT);
+        nextCorner_.assign(corners.size(), NO_POINT);
+        mark_.assign(vertexCount, 0);
+        count_.assign(vertexCount, 0);
+        bestCost_.assign(vertexCount, 0.0f);
+        bestPartner_.assign(vertexCount, NO_POINT);
+        heapIndex_.assign(vertexCount, NO_POINT);
+        heap_.clear();
+        markId_ = 0;
+        liveTriangles = 0;
+
+        for (size_t t = 0; t < triangleCount; ++t) {
+            if (corners[t * 3] == NO_POINT) {
+                continue;
+            }
+            liveTriangles++;
+            double normal[3];
+            const double area = triangleNormal(t, normal);
+            const double* p = vertexPosition(corners[t * 3]);
+            const double d = -(normal[0] * p[0] + normal[1] * p[1] + normal[2] * p[2]);
+            for (size_t k = 0; k < 3; ++k) {
+                const uint32_t c = static_cast<uint32_t>(t * 3 + k);
+                quadrics[corners[c]].addPlane(normal[0], normal[1], normal[2], d, area);
+                nextCorner_[c] = firstCorner_[corners[c]];
+                firstCorner_[corners[c]] = c;
+            }
+        }
+
+        // Open boundary edges are the edges used by a single triangle; each one is found from the
+        // vertex it leaves in its triangle's winding
+        for (uint32_t v = 0; v < vertexCount; ++v) {
+            const uint32_t id = nextMark();
+            forEachCorner(v, [&](uint32_t c) {
+                for (uint32_t n : {cornerVertex(c, 1), cornerVertex(c, 2)}) {
+                    if (mark_[n] != id) {
+                        mark_[n] = id;
+                        count_[n] = 0;
+                    }
+                    count_[n]++;
+                }
+            });
+            forEachCorner(v, [&](uint32_t c) {
+                // The edge v -> next corner is directed the way its triangle is wound
+                const uint32_t n = cornerVertex(c, 1);
+                if (count_[n] != 1) {
+                    return;
+                }
+                flags[v] |= VERTEX_BOUNDARY;
+                flags[n] |= VERTEX_BOUNDARY;
+                if (preserveBoundary) {
+                    addBoundaryPlane(c / 3, v, n);
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief Queue the cheapest edge of selected vertices
+     * @param seeds Per-vertex selection (nullptr = all vertices)
+     */
+    void seed(const std::vector<uint8_t>* seeds) {
+        for (uint32_t v = 0; v < firstCorner_.size(); ++v) {
+            if (!seeds || (*seeds)[v]) {
+                refresh(v, false);
+            }
+        }
+    }
+
+    /**
+     * @brief Collapse the cheapest valid edges until the triangle budget is met
+     * @param targetTriangles Triangles to keep
+     */
+    void run(size_t targetTriangles) {
+        double position[3];
+        while (liveTriangles > targetTriangles && !heap_.empty()) {
+            const uint32_t v = heap_.front();
+            const uint32_t v0 = std::min(v, bestPartner_[v]);
+            const uint32_t v1 = std::max(v, bestPartner_[v]);
+            collapseCost(v0, v1, position);
+            if (canCollapse(v0, v1, position)) {
+                collapse(v0, v1, position);
+            } else {
+                // Fall back to the vertex's cheapest edge that can collapse (or drop it)
+                refresh(v, true);
+            }
+        }
+    }
+
+private:
+    std::vector<uint32_t> firstCorner_;  // Head of each vertex's corner list
+    std::vector<uint32_t> nextCorner_;   // Next corner of the same vertex
+    std::vector<uint32_t> mark_;         // Scratch visit marks (compared against markId_)
+    std::vector<uint32_t> count_;        // Scratch per-vertex counters
+    std::vector<uint32_t> gathered_;     // Scratch corner / vertex list
+    std::vector<std::pair<float, uint32_t>> candidates_;  // Scratch (cost, neighbour) list
+    uint32_t markId_ = 0;
+    std::vector<float> bestCost_;        // Cost of each vertex's cheapest edge
+    std::vector<uint32_t> bestPartner_;  // Other endpoint of that edge
+    std::vector<uint32_t> heapIndex_;    // Position in heap_, NO_POINT when not queued
+    std::vector<uint32_t> heap_;         // Binary min-heap of vertices by bestCost_
+
+    uint32_t nextMark() {
+        if (++markId_ == 0) {
+            std::fill(mark_.begin(), mark_.end(), 0);
+            markId_ = 1;
+        }
+        return markId_;
+    }
+
+    const double* vertexPosition(uint32_t v) const { return positions.data() + static_cast<size_t>(v) * 3; }
+
+    // Vertex `step` corners after corner c within its triangle (0 = the corner's own vertex)
+    uint32_t cornerVertex(uint32_t c, uint32_t step) const { return corners[c - c % 3 + (c % 3 + step) % 3]; }
+
+    /**
+     * @brief Visit the live corners of a vertex, unlinking corners of removed triangles
+     */
+    template<typename Fn>
+    void forEachCorner(uint32_t v, Fn&& fn) {
+        uint32_t* link = &firstCorner_[v];
+        while (*link != NO_POINT) {
+            const uint32_t c = *link;
+            if (corners[c] != v) {
+                *link = nextCorner_[c];
+                continue;
+            }
+            link = &nextCorner_[c];
+            fn(c);
+        }
+    }
+
+    /**
+     * @brief Unit normal of a triangle, with one corner optionally moved
+     * @param t Triangle
+     * @param[out] normal Unit normal (zero when degenerate)
+     * @param moved Corner vertex to replace (NO_POINT = none)
+     * @param movedTo Replacement position
+     * @return Twice the triangle area
+     */
+    double triangleNormal(size_t t, double* normal, uint32_t moved = NO_POINT, const double* movedTo = nullptr) const {
+        normal[0] = normal[1] = normal[2] = 0.0;
+        if (corners[t * 3] == NO_POINT) {
+            return 0.0;
+        }
+        const double* p[3];
+        for (size_t k = 0; k < 3; ++k) {
+            p[k] = corners[t * 3 + k] == moved ? movedTo : vertexPosition(corners[t * 3 + k]);
+        }
+        const double u[3] = {p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2]};
+        const double w[3] = {p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2]};
+        normal[0] = u[1] * w[2] - u[2] * w[1];
+        normal[1] = u[2] * w[0] - u[0] * w[2];
+        normal[2] = u[0] * w[1] - u[1] * w[0];
+        const double length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        if (length > 0.0) {
+            normal[0] /= length;
+            normal[1] /= length;
+            normal[2] /= length;
+        }
+        return length;
+    }
+
+    /**
+     * @brief Pin an open boundary edge with a plane through the edge, perpendicular to its face
+     */
+    void addBoundaryPlane(size_t t, uint32_t a, uint32_t b) {
+        double faceNormal[3];
+        triangleNormal(t, faceNormal);
+        const double* pa = vertexPosition(a);
+        const double* pb = vertexPosition(b);
+        const double edge[3] = {pb[0] - pa[0], pb[1] - pa[1], pb[2] - pa[2]};
+        double normal[3] = {edge[1] * faceNormal[2] - edge[2] * faceNormal[1],
+                            edge[2] * faceNormal[0] - edge[0] * faceNormal[2],
+                            edge[0] * faceNormal[1] - edge[1] * faceNormal[0]};
+        const double length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        if (length == 0.0) {
+            return;
+        }
+        for (double& component : normal) {
+            component /= length;
+        }
+        const double d = -(normal[0] * pa[0] + normal[1] * pa[1] + normal[2] * pa[2]);
+        const double weight = BOUNDARY_PENALTY * (edge[0] * edge[0] + edge[1] * edge[1] + edge[2] * edge[2]);
+        quadrics[a].addPlane(normal[0], normal[1], normal[2], d, weight);
+        quadrics[b].addPlane(normal[0], normal[1], normal[2], d, weight);
+    }
+
+    /**
+     * @brief Cost and target position of collapsing v1 into v0
+     */
+    double collapseCost(uint32_t v0, uint32_t v1, double* position) const {
+        Quadric quadric = quadrics[v0];
+        quadric += quadrics[v1];
+        const double* a = vertexPosition(v0);
+        const double* b = vertexPosition(v1);
+        const double mid[3] = {(a[0] + b[0]) * 0.5, (a[1] + b[1]) * 0.5, (a[2] + b[2]) * 0.5};
+        bool solved = quadric.optimum(position);
+        if (solved) {
+            // Nearly flat neighbourhoods give ill-conditioned optima far away from the edge; keeping
+            // the optimum inside the sphere spanned by the edge also keeps attribute interpolation
+            // along the edge meaningful
+            double offset = 0.0;
+            double lengthSquared = 0.0;
+            for (size_t k = 0; k < 3; ++k) {
+                offset += (position[k] - mid[k]) * (position[k] - mid[k]);
+                lengthSquared += (b[k] - a[k]) * (b[k] - a[k]);
+            }
+            solved = offset * 4.0 <= lengthSquared;
+        }
+        if (!solved) {
+            // Singular system (flat or linear neighbourhood): best of the endpoints and the midpoint
+            const double* best = a;
+            double bestError = quadric.error(a);
+            for (const double* option : {b, static_cast<const double*>(mid)}) {
+                const double optionError = quadric.error(option);
+                if (optionError < bestError) {
+                    best = option;
+                    bestError = optionError;
+                }
+            }
+            std::copy(best, best + 3, position);
+        }
+        return std::max(0.0, quadric.error(position));
+    }
+
+    bool heapLess(uint32_t a, uint32_t b) const {
+        return bestCost_[a] < bestCost_[b] || (bestCost_[a] == bestCost_[b] && a < b);
+    }
+
+    void heapSwap(size_t i, size_t j) {
+        std::swap(heap_[i], heap_[j]);
+        heapIndex_[heap_[i]] = static_cast<uint32_t>(i);
+        heapIndex_[heap_[j]] = static_cast<uint32_t>(j);
+    }
+
+    void siftUp(size_t i) {
+        while (i > 0 && heapLess(heap_[i], heap_[(i - 1) / 2])) {
+            heapSwap(i, (i - 1) / 2);
+            i = (i - 1) / 2;
+        }
+    }
+
+    void siftDown(size_t i) {
+        for (;;) {
+            size_t smallest = i;
+            for (size_t child = 2 * i + 1; child <= 2 * i + 2 && child < heap_.size(); ++child) {
+                if (heapLess(heap_[child], heap_[smallest])) {
+                    smallest = child;
+                }
+            }
+            if (smallest == i) {
+                return;
+            }
+            heapSwap(i, smallest);
+            i = smallest;
+        }
+    }
+
+    void heapRemove(uint32_t v) {
+        const uint32_t i = heapIndex_[v];
+        if (i == NO_POINT) {
+            return;
+        }
+        heapSwap(i, heap_.size() - 1);
+        heap_.pop_back();
+        heapIndex_[v] = NO_POINT;
+        if (i < heap_.size()) {
+            siftUp(i);
+            siftDown(heapIndex_[heap_[i]] == i ? i : heapIndex_[heap_[i]]);
+        }
+    }
+
+    /**
+     * @brief Recompute the cheapest edge of a vertex and update its heap entry
+     * @param v Vertex
+     * @param validate Whether to skip edges that fail canCollapse() (after a rejected collapse)
+     */
+    void refresh(uint32_t v, bool validate) {
+        if (flags[v] & (VERTEX_LOCKED | VERTEX_REMOVED)) {
+            heapRemove(v);
+            return;
+        }
+        const uint32_t id = nextMark();
+        double position[3];
+        candidates_.clear();
+        forEachCorner(v, [&](uint32_t c) {
+            for (uint32_t n : {cornerVertex(c, 1), cornerVertex(c, 2)}) {
+                if (mark_[n] == id || (flags[n] & VERTEX_LOCKED)) {
+                    continue;
+                }
+                mark_[n] = id;
+                candidates_.emplace_back(static_cast<float>(collapseCost(std::min(v, n), std::max(v, n), position)), n);
+            }
+        });
+        std::sort(candidates_.begin(), candidates_.end());
+        uint32_t partner = NO_POINT;
+        float cost = 0.0f;
+        for (const auto& candidate : candidates_) {
+            if (validate) {
+                const uint32_t v0 = std::min(v, candidate.second);
+                const uint32_t v1 = std::max(v, candidate.second);
+                collapseCost(v0, v1, position);
+                if (!canCollapse(v0, v1, position)) {
+                    continue;
+                }
+            }
+            partner = candidate.second;
+            cost = candidate.first;
+            break;
+        }
+        if (partner == NO_POINT) {
+            heapRemove(v);
+            return;
+        }
+        bestCost_[v] = cost;
+        bestPartner_[v] = partner;
+        if (heapIndex_[v] == NO_POINT) {
+            heapIndex_[v] = static_cast<uint32_t>(heap_.size());
+            heap_.push_back(v);
+        }
+        siftUp(heapIndex_[v]);
+        siftDown(heapIndex_[v]);
+    }
+
+    /**
+     * @brief Check that collapsing v1 into v0 at position keeps the mesh manifold and unflipped
+     */
+    bool canCollapse(uint32_t v0, uint32_t v1, const double* position) {
+        // Link condition: the endpoints may only share the apexes of the triangles on the edge
+        const uint32_t id = nextMark();
+        uint32_t shared = 0;
+        forEachCorner(v0, [&](uint32_t c) {
+            const uint32_t a = cornerVertex(c, 1);
+            const uint32_t b = cornerVertex(c, 2);
+            mark_[a] = id;
+            mark_[b] = id;
+            if (a == v1 || b == v1) {
+                shared++;
+            }
+        });
+        if (shared == 0 || shared > 2) {
+            return false;
+        }
+        const uint32_t counted = nextMark();
+        uint32_t common = 0;
+        forEachCorner(v1, [&](uint32_t c) {
+            for (uint32_t n : {cornerVertex(c, 1), cornerVertex(c, 2)}) {
+                if (n != v0 && mark_[n] == id) {
+                    mark_[n] = counted;
+                    common++;
+                }
+            }
+        });
+        if (common != shared) {
+            return false;
+        }
+        // An interior edge between two boundary vertices would pinch the surface
+        if (shared == 2 && (flags[v0] & VERTEX_BOUNDARY) && (flags[v1] & VERTEX_BOUNDARY)) {
+            return false;
+        }
+
+        // Surviving triangles around either endpoint must not flip or degenerate
+        bool valid = true;
+        for (uint32_t v : {v0, v1}) {
+            forEachCorner(v, [&](uint32_t c) {
+                const uint32_t a = cornerVertex(c, 1);
+                const uint32_t b = cornerVertex(c, 2);
+                if (!valid || a == v0 || a == v1 || b == v0 || b == v1) {
+                    return;
+                }
+                double before[3];
+                double after[3];
+                triangleNormal(c / 3, before);
+                const double area = triangleNormal(c / 3, after, v, position);
+                if (area <= 0.0 || before[0] * after[0] + before[1] * after[1] + before[2] * after[2] < 0.2) {
+                    valid = false;
+                }
+            });
+        }
+        return valid;
+    }
+
+    /**
+     * @brief Store the point attributes at the collapse position in v0
+     * Attributes are interpolated barycentrically in the triangle around v0 or v1 that contains
+     * the projected position (exact for linearly varying data), otherwise along the edge.
+     */
+    void interpolateAttributes(uint32_t v0, uint32_t v1, const double* position) {
+        uint32_t containing = NO_POINT;
+        double weights[3] = {0.0, 0.0, 0.0};
+        double bestScore = -1e-6;  // Smallest barycentric coordinate of the best triangle so far
+        for (uint32_t v : {v0, v1}) {
+            forEachCorner(v, [&](uint32_t c) {
+                const uint32_t base = c - c % 3;
+                const double* a = vertexPosition(corners[base]);
+                const double* b = vertexPosition(corners[base + 1]);
+                const double* d = vertexPosition(corners[base + 2]);
+                double e0[3], e1[3], e2[3];
+                for (size_t k = 0; k < 3; ++k) {
+                    e0[k] = b[k] - a[k];
+                    e1[k] = d[k] - a[k];
+                    e2[k] = position[k] - a[k];
+                }
+                const double d00 = e0[0] * e0[0] + e0[1] * e0[1] + e0[2] * e0[2];
+                const double d01 = e0[0] * e1[0] + e0[1] * e1[1] + e0[2] * e1[2];
+                const double d11 = e1[0] * e1[0] + e1[1] * e1[1] + e1[2] * e1[2];
+                const double d20 = e2[0] * e0[0] + e2[1] * e0[1] + e2[2] * e0[2];
+                const double d21 = e2[0] * e1[0] + e2[1] * e1[1] + e2[2] * e1[2];
+                const double denominator = d00 * d11 - d01 * d01;
+                if (!(denominator > 0.0)) {
+                    return;
+                }
+                const double wb = (d11 * d20 - d01 * d21) / denominator;
+                const double wd = (d00 * d21 - d01 * d20) / denominator;
+                const double wa = 1.0 - wb - wd;
+                const double score = std::min(wa, std::min(wb, wd));
+                if (score > bestScore) {
+                    bestScore = score;
+                    containing = base;
+                    weights[0] = wa;
+                    weights[1] = wb;
+                    weights[2] = wd;
+                }
+            });
+        }
+
+        double* target = attributes.data() + static_cast<size_t>(v0) * attributeWidth;
+        if (containing != NO_POINT) {
+            const double* source[3];
+            for (size_t k = 0; k < 3; ++k) {
+                source[k] = attributes.data() + static_cast<size_t>(corners[containing + k]) * attributeWidth;
+            }
+            for (size_t k = 0; k < attributeWidth; ++k) {
+                target[k] = weights[0] * source[0][k] + weights[1] * source[1][k] + weights[2] * source[2][k];
+            }
+            return;
+        }
+        const double* a = vertexPosition(v0);
+        const double* b = vertexPosition(v1);
+        const double edge[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+        const double lengthSquared = edge[0] * edge[0] + edge[1] * edge[1] + edge[2] * edge[2];
+        double t = 0.5;
+        if (lengthSquared > 0.0) {
+            t = ((position[0] - a[0]) * edge[0] + (position[1] - a[1]) * edge[1] + (position[2] - a[2]) * edge[2]) / lengthSquared;
+            t = std::min(1.0, std::max(0.0, t));
+        }
+        const double* source = attributes.data() + static_cast<size_t>(v1) * attributeWidth;
+        for (size_t k = 0; k < attributeWidth; ++k) {
+            target[k] += t * (source[k] - target[k]);
+        }
+    }
+
+    /**
+     * @brief Collapse v1 into v0 and move v0 to position
+     */
+    void collapse(uint32_t v0, uint32_t v1, const double* position) {
+        if (attributeWidth > 0) {
+            interpolateAttributes(v0, v1, position);
+        }
+        gathered_.clear();
+        forEachCorner(v1, [&](uint32_t c) { gathered_.push_back(c); });
+        for (uint32_t c : gathered_) {
+            const uint32_t base = c - c % 3;
+            if (corners[base] == v0 || corners[base + 1] == v0 || corners[base + 2] == v0) {
+                corners[base] = corners[base + 1] = corners[base + 2] = NO_POINT;
+                liveTriangles--;
+            } else {
+                corners[c] = v0;
+            }
+        }
+        // Splice v1's corner list in front of v0's (dead entries are dropped on the next visit)
+        if (firstCorner_[v1] != NO_POINT) {
+            uint32_t tail = firstCorner_[v1];
+            while (nextCorner_[tail] != NO_POINT) {
+                tail = nextCorner_[tail];
+            }
+            nextCorner_[tail] = firstCorner_[v0];
+            firstCorner_[v0] = firstCorner_[v1];
+            firstCorner_[v1] = NO_POINT;
+        }
+
+        std::copy(position, position + 3, positions.begin() + static_cast<size_t>(v0) * 3);
+        quadrics[v0] += quadrics[v1];
+        flags[v0] |= flags[v1] & VERTEX_BOUNDARY;
+        flags[v1] |= VERTEX_REMOVED;
+
+        // Only the edges around v0 changed: neighbours whose best edge survives just compare
+        // it against their edge to v0
+        heapRemove(v1);
+        gathered_.clear();
+        const uint32_t id = nextMark();
+        forEachCorner(v0, [&](uint32_t c) {
+            for (uint32_t n : {cornerVertex(c, 1), cornerVertex(c, 2)}) {
+                if (mark_[n] != id) {
+                    mark_[n] = id;
+                    gathered_.push_back(n);
+                }
+            }
+        });
+        refresh(v0, false);
+        for (size_t i = 0; i < gathered_.size(); ++i) {
+            const uint32_t n = gathered_[i];
+            if (heapIndex_[n] == NO_POINT || bestPartner_[n] == v0 || bestPartner_[n] == v1) {
+                refresh(n, false);
+                continue;
+            }
+            double edgePosition[3];
+            const float cost = static_cast<float>(collapseCost(std::min(n, v0), std::max(n, v0), edgePosition));
+            if (cost < bestCost_[n]) {
+                bestCost_[n] = cost;
+                bestPartner_[n] = v0;
+                siftUp(heapIndex_[n]);
+            }
+        }
+    }
+};
+
+/**
+ * @brief Split triangles into slabs of similar size along the longest bounding-box axis
+ * @param positions Vertex positions (xyz)
+ * @param corners Triangle corners
+ * @param partitionCount Number of slabs
+ * @param[out] partitionOf Slab of each triangle
+ */
+void partitionTriangles(const std::vector<double>& positions, const std::vector<uint32_t>& corners,
+                        size_t partitionCount, std::vector<uint32_t>& partitionOf) {
+    const size_t triangleCount = corners.size() / 3;
+    double lower[3] = {std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+    double upper[3] = {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+    for (size_t i = 0; i < positions.size(); i += 3) {
+        for (size_t axis = 0; axis < 3; ++axis) {
+            lower[axis] = (std::min)(lower[axis], positions[i + axis]);
+            upper[axis] = (std::max)(upper[axis], positions[i + axis]);
+        }
+    }
+    size_t axis = 0;
+    for (size_t a = 1; a < 3; ++a) {
+        if (upper[a] - lower[a] > upper[axis] - lower[axis]) {
+            axis = a;
+        }
+    }
+    const double extent = upper[axis] - lower[axis];
+    const double scale = extent > 0.0 ? static_cast<double>(PARTITION_BINS) / extent : 0.0;
+
+    // Centroid histogram, then equal-count bin ranges per slab
+    std::vector<uint32_t> binOf(triangleCount);
+    std::vector<size_t> histogram(PARTITION_BINS, 0);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        double centroid = 0.0;
+        for (size_t k = 0; k < 3; ++k) {
+            centroid += positions[static_cast<size_t>(corners[t * 3 + k]) * 3 + axis] / 3.0;
+        }
+        const size_t bin = (std::min)(PARTITION_BINS - 1, static_cast<size_t>((centroid - lower[axis]) * scale));
+        binOf[t] = static_cast<uint32_t>(bin);
+        histogram[bin]++;
+    }
+    std::vector<uint32_t> partitionOfBin(PARTITION_BINS);
+    size_t seen = 0;
+    for (size_t bin = 0; bin < PARTITION_BINS; ++bin) {
+        partitionOfBin[bin] = static_cast<uint32_t>((std::min)(partitionCount - 1, seen * partitionCount / (std::max<size_t>)(1, triangleCount)));
+        seen += histogram[bin];
+    }
+    partitionOf.resize(triangleCount);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        partitionOf[t] = partitionOfBin[binOf[t]];
+    }
+}
+
+/**
+ * @brief Decimate spatial partitions independently with their shared vertices locked
+ * Surviving triangles and vertices are written back into the global decimator arrays; the
+ * global pass that follows unlocks the seams and finishes the budget.
+ * @param mesh Global working mesh (positions, attributes and corners filled, not built)
+ * @param partitionCount Number of partitions
+ * @param threads Worker threads (0 = hardware concurrency); partitions are dealt round-robin to them
+ * @param keepRatio Fraction of triangles each partition keeps
+ * @param preserveBoundary Whether to pin open boundary edges
+ * @param[out] seams Per-vertex flag of the vertices shared between partitions
+ * @param[out] carried Per-vertex flag of the vertices whose quadric was accumulated by a partition
+ */
+void decimatePartitions(QuadricDecimator& mesh, size_t partitionCount, unsigned int threads, double keepRatio, bool preserveBoundary,
+                        std::vector<uint8_t>& seams, std::vector<uint8_t>& carried) {
+    const size_t vertexCount = mesh.positions.size() / 3;
+    const size_t triangleCount = mesh.corners.size() / 3;
+    std::vector<uint32_t> partitionOf;
+    partitionTriangles(mesh.positions, mesh.corners, partitionCount, partitionOf);
+
+    // A vertex used by triangles of two partitions is a seam vertex
+    std::vector<uint32_t> vertexPartition(vertexCount, NO_POINT - 1);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        for (size_t k = 0; k < 3; ++k) {
+            uint32_t& owner = vertexPartition[mesh.corners[t * 3 + k]];
+            if (owner == NO_POINT - 1) {
+                owner = partitionOf[t];
+            } else if (owner != partitionOf[t]) {
+                owner = SEAM_PARTITION;
+            }
+        }
+    }
+    seams.assign(vertexCount, 0);
+    carried.assign(vertexCount, 0);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        seams[v] = vertexPartition[v] == SEAM_PARTITION;
+    }
+    std::vector<std::vector<uint32_t>> trianglesOf(partitionCount);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        trianglesOf[partitionOf[t]].push_back(static_cast<uint32_t>(t));
+    }
+    std::vector<Quadric> carriedQuadrics(vertexCount);
+    std::vector<size_t> seamTriangles(partitionCount, 0);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        const uint32_t* triangle = mesh.corners.data() + t * 3;
+        if (seams[triangle[0]] || seams[triangle[1]] || seams[triangle[2]]) {
+            seamTriangles[partitionOf[t]]++;
+        }
+    }
+
+    auto decimatePartition = [&](size_t partition) {
+        const std::vector<uint32_t>& triangles = trianglesOf[partition];
+        QuadricDecimator local;
+        local.attributeWidth = mesh.attributeWidth;
+        std::vector<uint32_t> globalOf;
+        std::unordered_map<uint32_t, uint32_t> localOf;
+        localOf.reserve(triangles.size());
+        local.corners.resize(triangles.size() * 3);
+        for (size_t i = 0; i < triangles.size(); ++i) {
+            for (size_t k = 0; k < 3; ++k) {
+                const uint32_t global = mesh.corners[triangles[i] * 3 + k];
+                auto inserted = localOf.emplace(global, static_cast<uint32_t>(globalOf.size()));
+                if (inserted.second) {
+                    globalOf.push_back(global);
+                }
+                local.corners[i * 3 + k] = inserted.first->second;
+            }
+        }
+        local.positions.resize(globalOf.size() * 3);
+        local.attributes.resize(globalOf.size() * mesh.attributeWidth);
+        local.flags.resize(globalOf.size(), 0);
+        for (size_t v = 0; v < globalOf.size(); ++v) {
+            std::copy_n(mesh.positions.begin() + static_cast<size_t>(globalOf[v]) * 3, 3, local.positions.begin() + v * 3);
+            std::copy_n(mesh.attributes.begin() + static_cast<size_t>(globalOf[v]) * mesh.attributeWidth, mesh.attributeWidth,
+                        local.attributes.begin() + v * mesh.attributeWidth);
+            if (seams[globalOf[v]]) {
+                local.flags[v] = VERTEX_LOCKED;
+            }
+        }
+        local.build(preserveBoundary);
+        local.seed(nullptr);
+        // Triangles at the seam cannot collapse yet; their share of the budget is left to the global pass
+        const size_t interior = triangles.size() - seamTriangles[partition];
+        local.run(static_cast<size_t>(static_cast<double>(interior) * keepRatio) + seamTriangles[partition]);
+
+        // Write back: triangles keep their global slots; interior vertices are owned by this partition
+        for (size_t i = 0; i < triangles.size(); ++i) {
+            for (size_t k = 0; k < 3; ++k) {
+                const uint32_t v = local.corners[i * 3 + k];
+                mesh.corners[triangles[i] * 3 + k] = v == NO_POINT ? NO_POINT : globalOf[v];
+            }
+        }
+        for (size_t v = 0; v < globalOf.size(); ++v) {
+            const uint32_t global = globalOf[v];
+            if (seams[global] || (local.flags[v] & VERTEX_REMOVED)) {
+                continue;
+            }
+            std::copy_n(local.positions.begin() + v * 3, 3, mesh.positions.begin() + static_cast<size_t>(global) * 3);
+            std::copy_n(local.attributes.begin() + v * mesh.attributeWidth, mesh.attributeWidth,
+                        mesh.attributes.begin() + static_cast<size_t>(global) * mesh.attributeWidth);
+            carriedQuadrics[global] = local.quadrics[v];
+            carried[global] = 1;
+        }
+    };
+    const size_t workerCount = parallelTaskCount(partitionCount, 1, threads);
+    runParallel(workerCount, [&](size_t worker) {
+        for (size_t partition = worker; partition < partitionCount; partition += workerCount) {
+            JobControl::checkpoint();
+            decimatePartition(partition);
+        }
+    });
+
+    // Rebuild globally, then restore the history of vertices that were decimated in a partition
+    mesh.build(preserveBoundary);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        if (carried[v]) {
+            mesh.quadrics[v] = carriedQuadrics[v];
+        }
+    }
+}
+
+// Points per task below which welding runs serially
+constexpr size_t PARALLEL_MIN_WELD_POINTS = 64 * 1024;
+
+/**
+ * @brief Mix three 64-bit words into a well-distributed hash (grid cells and float bit patterns)
+ */
+uint64_t mixKey(uint64_t x, uint64_t y, uint64_t z) {
+    uint64_t h = x * 0x9E3779B97F4A7C15ull;
+    h ^= (y + 0x632BE59BD9B4E019ull) * 0xC2B2AE3D27D4EB4Full;
+    h ^= z * 0x165667B19E3779F9ull;
+    h ^= h >> 31;
+    h *= 0xBF58476D1CE4E5B9ull;
+    return h ^ (h >> 29);
+}
+
+/**
+ * @brief Spatial hash over a uniform grid: points sorted by cell key plus an open-addressing
+ * table from key to the run of points in that cell
+ */
+class PointGrid {
+public:
+    /**
+     * @brief Build the grid
+     * @param points Point coordinates (xyz)
+     * @param origin Grid origin (minimum corner of the bounds)
+     * @param cellSize Cell edge length (0 = one cell per distinct bit pattern)
+     * @param taskCount Number of parallel tasks
+     */
+    PointGrid(const std::vector<float>& points, const double* origin, double cellSize, size_t taskCount)
+        : points_(points), cellSize_(cellSize) {
+        std::copy(origin, origin + 3, origin_);
+        const size_t pointCount = points.size() / 3;
+        entries_.resize(pointCount);
+        parallelForRanges(pointCount, taskCount, [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) {
+                int64_t cell[3];
+                entries_[i] = {keyOf(&points[i * 3], cell), static_cast<uint32_t>(i)};
+            }
+        });
+        parallelSort(entries_.begin(), entries_.end(), std::less<std::pair<uint64_t, uint32_t>>(), taskCount);
+
+        size_t runs = 0;
+        for (size_t i = 0; i < entries_.size(); ++i) {
+            runs += i == 0 || entries_[i].first != entries_[i - 1].first;
+        }
+        size_t capacity = 16;
+        while (capacity < runs * 2) {
+            capacity <<= 1;
+        }
+        slots_.assign(capacity, {0, NO_POINT, 0});
+        for (size_t begin = 0; begin < entries_.size();) {
+            size_t end = begin + 1;
+            while (end < entries_.size() && entries_[end].first == entries_[begin].first) {
+                ++end;
+            }
+            size_t slot = entries_[begin].first & (capacity - 1);
+            while (slots_[slot].begin != NO_POINT) {
+                slot = (slot + 1) & (capacity - 1);
+            }
+            slots_[slot] = {entries_[begin].first, static_cast<uint32_t>(begin), static_cast<uint32_t>(end - begin)};
+            begin = end;
+        }
+    }
+
+    /**
+     * @brief Lowest point index within the tolerance of a point (exact grids: same bit pattern)
+     * Cells are twice the tolerance wide, so the tolerance ball of a point overlaps at most the
+     * 2x2x2 block of cells nearest to it.
+     * @param i Point index
+     * @param toleranceSquared Squared merge distance
+     * @return Lowest matching index (i itself when no lower point matches)
+     */
+    uint32_t lowestMatch(uint32_t i, double toleranceSquared) const {
+        const float* p = &points_[static_cast<size_t>(i) * 3];
+        int64_t cell[3];
+        const uint64_t ownKey = keyOf(p, cell);
+        uint32_t best = i;
+        if (cellSize_ == 0.0) {
+            scanCell(ownKey, [&](uint32_t j) {
+                if (std::memcmp(&points_[static_cast<size_t>(j) * 3], p, sizeof(float) * 3) == 0
+                    || samePosition(&points_[static_cast<size_t>(j) * 3], p)) {
+                    best = j;
+                    return false;
+                }
+                return true;
+            }, best);
+            return best;
+        }
+        int64_t step[3];
+        for (size_t k = 0; k < 3; ++k) {
+            const double position = (static_cast<double>(p[k]) - origin_[k]) / cellSize_;
+            step[k] = position - std::floor(position) < 0.5 ? -1 : 1;
+        }
+        for (int corner = 0; corner < 8; ++corner) {
+            const uint64_t key = mixKey(static_cast<uint64_t>(cell[0] + ((corner & 1) ? step[0] : 0)),
+                                        static_cast<uint64_t>(cell[1] + ((corner & 2) ? step[1] : 0)),
+                                        static_cast<uint64_t>(cell[2] + ((corner & 4) ? step[2] : 0)));
+            scanCell(key, [&](uint32_t j) {
+                const float* q = &points_[static_cast<size_t>(j) * 3];
+                const double dx = static_cast<double>(q[0]) - p[0];
+                const double dy = static_cast<double>(q[1]) - p[1];
+                const double dz = static_cast<double>(q[2]) - p[2];
+                if (dx * dx + dy * dy + dz * dz <= toleranceSquared) {
+                    best = j;
+                    return false;
+                }
+                return true;
+            }, best);
+        }
+        return best;
+    }
+
+private:
+    struct CellRun {
+        uint64_t key;
+        uint32_t begin;  // First entry of the run, NO_POINT for empty slots
+        uint32_t count;
+    };
+
+    static bool samePosition(const float* a, const float* b) {
+        return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+    }
+
+    uint64_t keyOf(const float* p, int64_t* cell) const {
+        if (cellSize_ == 0.0) {
+            // Exact welding: -0.0 and +0.0 hash alike, everything else by bit pattern
+            uint32_t bits[3];
+            for (size_t k = 0; k < 3; ++k) {
+                const float value = p[k] == 0.0f ? 0.0f : p[k];
+                std::memcpy(&bits[k], &value, sizeof(float));
+            }
+            cell[0] = bits[0];
+            cell[1] = bits[1];
+            cell[2] = bits[2];
+        } else {
+            for (size_t k = 0; k < 3; ++k) {
+                cell[k] = static_cast<int64_t>(std::floor((static_cast<double>(p[k]) - origin_[k]) / cellSize_));
+            }
+        }
+        return mixKey(static_cast<uint64_t>(cell[0]), static_cast<uint64_t>(cell[1]), static_cast<uint64_t>(cell[2]));
+    }
+
+    /**
+     * @brief Visit the points of a cell in ascending index order while visit() returns true,
+     * stopping at indices that cannot improve on `limit`
+     */
+    template<typename VisitFn>
+    void scanCell(uint64_t key, VisitFn&& visit, uint32_t limit) const {
+        const size_t mask = slots_.size() - 1;
+        for (size_t slot = key & mask; slots_[slot].begin != NO_POINT; slot = (slot + 1) & mask) {
+            if (slots_[slot].key != key) {
+                continue;
+            }
+            const CellRun& run = slots_[slot];
+            for (uint32_t e = run.begin; e < run.begin + run.count && entries_[e].second < limit; ++e) {
+                if (!visit(entries_[e].second)) {
+                    return;
+                }
+            }
+            return;
+        }
+    }
+
+    const std::vector<float>& points_;
+    double origin_[3];
+    double cellSize_;
+    std::vector<std::pair<uint64_t, uint32_t>> entries_;  // (cell key, point) sorted by key, then index
+    std::vector<CellRun> slots_;
+};
+
+/**
+ * @brief Remove repeated points from a cell after welding
+ * @param[in,out] type Cell type (polygons that lost corners become triangles or polygons)
+ * @param indices Remapped cell points
+ * @param count Number of cell points
+ * @param[out] kept Remaining points in cell order
+ * @return Whether the cell is still valid (false = collapsed, drop it)
+ */
+bool cleanWeldedCell(VtkCellType& type, const uint32_t* indices, size_t count, std::vector<uint32_t>& kept) {
+    kept.assign(indices, indices + count);
+    switch (type) {
+        case VtkCellType::TRIANGLE:
+        case VtkCellType::QUAD:
+        case VtkCellType::POLYGON: {
+            // Drop cyclically consecutive repeats; the remaining loop must still span an area
+            size_t size = 0;
+            for (size_t k = 0; k < count; ++k) {
+                if (size == 0 || kept[size - 1] != indices[k]) {
+                    kept[size++] = indices[k];
+                }
+            }
+            while (size > 1 && kept[size - 1] == kept[0]) {
+                --size;
+            }
+            kept.resize(size);
+            if (size < 3) {
+                return false;
+            }
+            if (size != count) {
+                type = size == 3 ? VtkCellType::TRIANGLE : VtkCellType::POLYGON;
+            }
+            return true;
+        }
+        case VtkCellType::LINE:
+            return count != 2 || indices[0] != indices[1];
+        default:
+            return true;
+    }
+}
+
+/**
+ * @brief Check that connectivity and attribute arrays are consistent with the point and cell counts
+ * @param meshData Mesh data
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message
+ * @return Whether the arrays are consistent
+ */
+bool validateMeshArrays(const MeshData& meshData, MeshErrorCode& errorCode, std::string& errorMsg) {
+    const size_t pointCount = meshData.points.size() / 3;
+    const size_t cellCount = meshData.cells.size();
+    const MeshScanResult scan = MeshKernels::scan(meshData, SCAN_INDICES);
+    if (!scan.indicesValid) {
+        errorCode = MeshErrorCode::PARAM_INVALID;
+        errorMsg = "Cell connectivity contains invalid point index: " + std::to_string(scan.maxPointIndex);
+        return false;
+    }
+    for (const auto& [name, data] : meshData.pointData) {
+        if (!data.empty() && data.componentsFor(pointCount) == 0) {
+            errorCode = MeshErrorCode::PARAM_INVALID;
+            errorMsg = "Point attribute '" + name + "' data length does not match point count";
+            return false;
+        }
+    }
+    for (const auto& [name, data] : meshData.cellData) {
+        if (!data.empty() && data.componentsFor(cellCount) == 0) {
+            errorCode = MeshErrorCode::PARAM_INVALID;
+            errorMsg = "Cell attribute '" + name + "' data length does not match cell count";
+            return false;
+        }
+    }
+    return true;
+}
+
+// Points or cells per task below which reordering runs serially
+constexpr size_t PARALLEL_MIN_REORDER_ITEMS = 64 * 1024;
+// Quantization bits per axis (three axes fill a 63-bit curve code)
+constexpr unsigned int CURVE_BITS = 21;
+
+/**
+ * @brief Spread the low 21 bits of a value so that two zero bits follow each bit
+ */
+uint64_t spreadBits3(uint32_t value) {
+    uint64_t x = value & 0x1FFFFFu;
+    x = (x | (x << 32)) & 0x001F00000000FFFFull;
+    x = (x | (x << 16)) & 0x001F0000FF0000FFull;
+    x = (x | (x << 8)) & 0x100F00F00F00F00Full;
+    x = (x | (x << 4)) & 0x10C30C30C30C30C3ull;
+    x = (x | (x << 2)) & 0x1249249249249249ull;
+    return x;
+}
+
+/**
+ * @brief Morton (Z-order) code of a quantized position
+ */
+uint64_t mortonCode(uint32_t x, uint32_t y, uint32_t z) {
+    return (spreadBits3(x) << 2) | (spreadBits3(y) << 1) | spreadBits3(z);
+}
+
+/**
+ * @brief Hilbert code of a quantized position (Skilling's transpose algorithm)
+ */
+uint64_t hilbertCode(uint32_t x, uint32_t y, uint32_t z) {
+    uint32_t axes[3] = {x, y, z};
+    // Inverse undo of the per-level rotations and reflections (branch-free: the bit tests are
+    // data dependent and would mispredict about half of the time)
+    for (unsigned int level = CURVE_BITS - 1; level > 0; --level) {
+        const uint32_t p = (1u << level) - 1;
+        for (int i = 0; i < 3; ++i) {
+            const uint32_t set = 0u - ((axes[i] >> level) & 1u);
+            const uint32_t t = (axes[0] ^ axes[i]) & p & ~set;
+            axes[0] ^= (p & set) | t;
+            axes[i] ^= t;
+        }
+    }
+    // Gray encode
+    axes[1] ^= axes[0];
+    axes[2] ^= axes[1];
+    uint32_t t = 0;
+    for (unsigned int level = CURVE_BITS - 1; level > 0; --level) {
+        t ^= ((1u << level) - 1) & (0u - ((axes[2] >> level) & 1u));
+    }
+    for (uint32_t& axis : axes) {
+        axis ^= t;
+    }
+    // The transposed index interleaves with the first axis most significant
+    return mortonCode(axes[0], axes[1], axes[2]);
+}
+
+/**
+ * @brief Maps positions to curve codes over a bounding cube
+ */
+class CurveEncoder {
+public:
+    CurveEncoder(const std::vector<float>& bounds, MeshReorder curve) : hilbert_(curve == MeshReorder::HILBERT) {
+        double extent = 0.0;
+        for (int axis = 0; axis < 3; ++axis) {
+            origin_[axis] = bounds[axis * 2];
+            extent = std::max(extent, static_cast<double>(bounds[axis * 2 + 1]) - bounds[axis * 2]);
+        }
+        // One scale for all axes keeps the cells of the curve cubic
+        scale_ = extent > 0.0 ? static_cast<double>((1u << CURVE_BITS) - 1) / extent : 0.0;
+    }
+
+    uint64_t encode(double x, double y, double z) const {
+        const uint32_t q[3] = {quantize(x, 0), quantize(y, 1), quantize(z, 2)};
+        return hilbert_ ? hilbertCode(q[0], q[1], q[2]) : mortonCode(q[0], q[1], q[2]);
+    }
+
+private:
+    uint32_t quantize(double value, int axis) const {
+        const double scaled = (value - origin_[axis]) * scale_;
+        // Negated comparison also maps NaN to zero
+        if (!(scaled > 0.0)) {
+            return 0;
+        }
+        return static_cast<uint32_t>(std::min(scaled, static_cast<double>((1u << CURVE_BITS) - 1)));
+    }
+
+    double origin_[3] = {0.0, 0.0, 0.0};
+    double scale_ = 0.0;
+    bool hilbert_;
+};
+
+/**
+ * @brief Gather attribute tuples into a new attribute of the same element type
+ * @param source Source attribute
+ * @param components Components per tuple (MeshAttribute::componentsFor; 0 gives an empty result)
+ * @param count Number of output tuples
+ * @param sourceIndex Output tuple -> source tuple index
+ * @param taskCount Number of parallel tasks
+ * @return Gathered attribute
+ */
+template<typename IndexFn>
+MeshAttribute gatherTuples(const MeshAttribute& source, int components, size_t count,
+                           const IndexFn& sourceIndex, size_t taskCount) {
+    if (components <= 0) {
+        return MeshAttribute(source.type(), 1);
+    }
+    MeshAttribute result(source.type(), components, count);
+    const size_t width = static_cast<size_t>(components);
+    source.visit([&](const auto& values) {
+        using T = typename std::decay_t<decltype(values)>::value_type;
+        T* target = result.values<T>().data();
+        parallelForRanges(count, taskCount, [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) {
+                std::copy_n(values.data() + static_cast<size_t>(sourceIndex(i)) * width, width, target + i * width);
+            }
+        });
+    });
+    return result;
+}
+
+/**
+ * @brief Geometry-only triangle copy of the polygonal cells of a mesh (lines, points and volume cells are dropped)
+ * @param meshData Input mesh data
+ * @return Mesh with the same points and one triangle per fan piece
+ */
+MeshData triangleSurface(const MeshData& meshData) {
+    MeshData surface;
+    surface.points = meshData.points;
+    forEachTriangle(meshData.cells, [&surface](uint32_t a, uint32_t b, uint32_t c) {
+        const uint32_t indices[3] = {a, b, c};
+        surface.cells.addCell(VtkCellType::TRIANGLE, indices, 3);
+    });
+    return surface;
+}
+
+} // namespace
 
 /**
  * @brief Check if point index is valid
@@ -14,9 +1513,13 @@ bool MeshProcessor::isValidPointIndex(uint32_t pointIndex, uint64_t pointCount)
 
 /**
  * @brief Extract surface mesh from volume mesh (generate closed shell)
+ * Faces of tetrahedra, hexahedra, wedges and pyramids are keyed by their sorted point indices;
+ * keys are hash-bucketed, and each bucket is sorted and deduplicated in parallel. Output faces
+ * keep the winding of their owning cell (outward normals), unused points are dropped, and each
+ * face carries the cell data of its owning cell. Cells of lower dimension are ignored.
  * @param volumeMesh Input volume mesh data
  * @param[out] surfaceMesh Output surface mesh data
- * @param includeBoundaryOnly Whether to extract only boundary cells (true=only boundary, false=all surfaces)
+ * @param includeBoundaryOnly Whether to extract only boundary faces (true=faces used by one cell, false=every distinct face once)
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message
  * @return Whether processing is successful
@@ -33,26 +1536,227 @@ bool MeshProcessor::extractSurfaceFromVolume(const MeshData& volumeMesh,
         return false;
     }
 
-    // Check if it is volume mesh
-    if (volumeMesh.metadata.meshType != MeshType::VOLUME_MESH) {
+    // Check if it is volume mesh
+    if (volumeMesh.metadata.meshType != MeshType::VOLUME_MESH) {
+        errorCode = MeshErrorCode::PARAM_INVALID;
+        errorMsg = "Input mesh is not volume mesh";
+        return false;
+    }
+
+    const MeshData::CellArray& cells = volumeMesh.cells;
+    const size_t cellCount = cells.size();
+    const uint64_t pointCount = volumeMesh.points.size() / 3;
+    const size_t taskCount = parallelTaskCount(cellCount, PARALLEL_MIN_CELLS);
+    const size_t bucketCount = taskCount == 1 ? 1 : taskCount * BUCKETS_PER_TASK;
+
+    // 1. Validate cells and count faces per (task, bucket); tasks own contiguous cell ranges
+    std::vector<std::vector<uint64_t>> bucketCounts(taskCount, std::vector<uint64_t>(bucketCount, 0));
+    std::vector<uint64_t> taskFaces(taskCount, 0);
+    std::vector<size_t> invalidCell(taskCount, std::numeric_limits<size_t>::max());
+    parallelForRanges(cellCount, taskCount, [&](size_t begin, size_t end, size_t task) {
+        std::vector<uint64_t>& counts = bucketCounts[task];
+        for (size_t c = begin; c < end; ++c) {
+            const CellFaceTable* table = cellFaceTable(cells.types[c]);
+            if (!table) {
+                continue;
+            }
+            const uint32_t* cellPoints = cells.cellPoints(c);
+            bool valid = cells.cellSize(c) >= table->pointCount;
+            for (uint8_t k = 0; valid && k < table->pointCount; ++k) {
+                valid = isValidPointIndex(cellPoints[k], pointCount);
+            }
+            if (!valid) {
+                invalidCell[task] = c;
+                return;
+            }
+            taskFaces[task] += table->faceCount;
+            if (bucketCount == 1) {
+                counts[0] += table->faceCount;
+                continue;
+            }
+            for (size_t f = 0; f < table->faceCount; ++f) {
+                counts[faceBucket(makeFaceRecord(cellPoints, *table, f, 0), bucketCount)]++;
+            }
+        }
+    });
+    for (size_t cell : invalidCell) {
+        if (cell != std::numeric_limits<size_t>::max()) {
+            errorCode = MeshErrorCode::PARAM_INVALID;
+            errorMsg = "Cell " + std::to_string(cell) + " has too few points or an invalid point index";
+            return false;
+        }
+    }
+
+    // Prefix sums: global face index base per task, record slot per (task, bucket)
+    std::vector<uint64_t> faceBase(taskCount + 1, 0);
+    for (size_t t = 0; t < taskCount; ++t) {
+        faceBase[t + 1] = faceBase[t] + taskFaces[t];
+    }
+    const uint64_t totalFaces = faceBase[taskCount];
+    if (totalFaces == 0) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Input mesh contains no 3D cells";
+        return false;
+    }
+    std::vector<uint64_t> bucketStart(bucketCount + 1, 0);
+    std::vector<std::vector<uint64_t>> cursors(taskCount, std::vector<uint64_t>(bucketCount, 0));
+    for (size_t b = 0; b < bucketCount; ++b) {
+        uint64_t position = bucketStart[b];
+        for (size_t t = 0; t < taskCount; ++t) {
+            cursors[t][b] = position;
+            position += bucketCounts[t][b];
+        }
+        bucketStart[b + 1] = position;
+    }
+
+    // 2. Scatter face records into their buckets (same ranges, so face indices follow cell order)
+    std::unique_ptr<FaceRecord[]> records(new FaceRecord[totalFaces]);
+    parallelForRanges(cellCount, taskCount, [&](size_t begin, size_t end, size_t task) {
+        std::vector<uint64_t>& cursor = cursors[task];
+        uint64_t face = faceBase[task];
+        for (size_t c = begin; c < end; ++c) {
+            const CellFaceTable* table = cellFaceTable(cells.types[c]);
+            if (!table) {
+                continue;
+            }
+            const uint32_t* cellPoints = cells.cellPoints(c);
+            for (size_t f = 0; f < table->faceCount; ++f) {
+                const FaceRecord record = makeFaceRecord(cellPoints, *table, f, face++);
+                records[cursor[bucketCount == 1 ? 0 : faceBucket(record, bucketCount)]++] = record;
+            }
+        }
+    });
+
+    // 3. Sort each bucket and keep faces whose key occurs once (or the first copy of every key)
+    std::unique_ptr<uint8_t[]> keepFace(new uint8_t[totalFaces]());
+    runParallel(taskCount, [&](size_t task) {
+        for (size_t b = task; b < bucketCount; b += taskCount) {
+            FaceRecord* first = records.get() + bucketStart[b];
+            FaceRecord* last = records.get() + bucketStart[b + 1];
+            std::sort(first, last);
+            while (first != last) {
+                FaceRecord* run = first + 1;
+                while (run != last && run->sameKey(*first)) {
+                    ++run;
+                }
+                if (!includeBoundaryOnly || run - first == 1) {
+                    keepFace[first->face] = 1;
+                }
+                first = run;
+            }
+        }
+    });
+    records.reset();
+
+    // 4. Count kept faces and corners per task, then emit them in cell order
+    std::vector<uint64_t> keptFaces(taskCount + 1, 0);
+    std::vector<uint64_t> keptCorners(taskCount + 1, 0);
+    parallelForRanges(cellCount, taskCount, [&](size_t begin, size_t end, size_t task) {
+        uint64_t face = faceBase[task];
+        for (size_t c = begin; c < end; ++c) {
+            const CellFaceTable* table = cellFaceTable(cells.types[c]);
+            if (!table) {
+                continue;
+            }
+            for (size_t f = 0; f < table->faceCount; ++f, ++face) {
+                if (keepFace[face]) {
+                    keptFaces[task + 1]++;
+                    keptCorners[task + 1] += table->faceSize[f];
+                }
+            }
+        }
+    });
+    for (size_t t = 0; t < taskCount; ++t) {
+        keptFaces[t + 1] += keptFaces[t];
+        keptCorners[t + 1] += keptCorners[t];
+    }
+    if (keptCorners[taskCount] > std::numeric_limits<uint32_t>::max()) {
         errorCode = MeshErrorCode::PARAM_INVALID;
-        errorMsg = "Input mesh is not volume mesh";
+        errorMsg = "Surface connectivity exceeds 32-bit offsets";
         return false;
     }
 
-    // Clear output mesh
-    surfaceMesh.clear();
+    MeshData surface;
+    MeshData::CellArray& faces = surface.cells;
+    faces.types.resize(keptFaces[taskCount]);
+    faces.offsets.assign(keptFaces[taskCount] + 1, 0);
+    faces.connectivity.resize(keptCorners[taskCount]);
+    std::vector<size_t> ownerCell(keptFaces[taskCount]);
+    parallelForRanges(cellCount, taskCount, [&](size_t begin, size_t end, size_t task) {
+        uint64_t face = faceBase[task];
+        size_t out = keptFaces[task];
+        uint32_t corner = static_cast<uint32_t>(keptCorners[task]);
+        for (size_t c = begin; c < end; ++c) {
+            const CellFaceTable* table = cellFaceTable(cells.types[c]);
+            if (!table) {
+                continue;
+            }
+            const uint32_t* cellPoints = cells.cellPoints(c);
+            for (size_t f = 0; f < table->faceCount; ++f, ++face) {
+                if (!keepFace[face]) {
+                    continue;
+                }
+                const uint8_t size = table->faceSize[f];
+                for (uint8_t k = 0; k < size; ++k) {
+                    faces.connectivity[corner++] = cellPoints[table->corners[f][k]];
+                }
+                faces.types[out] = size == 3 ? VtkCellType::TRIANGLE : VtkCellType::QUAD;
+                faces.offsets[out + 1] = corner;
+                ownerCell[out] = c;
+                ++out;
+            }
+        }
+    });
+    keepFace.reset();
+
+    // 5. Keep only the points used by the surface (renumbered in their original order)
+    std::vector<uint32_t> pointRemap(pointCount, NO_POINT);
+    for (uint32_t pointIndex : faces.connectivity) {
+        pointRemap[pointIndex] = 0;
+    }
+    std::vector<uint32_t> keptPoints;
+    keptPoints.reserve(faces.connectivity.size() / 2);
+    for (uint64_t p = 0; p < pointCount; ++p) {
+        if (pointRemap[p] != NO_POINT) {
+            pointRemap[p] = static_cast<uint32_t>(keptPoints.size());
+            keptPoints.push_back(static_cast<uint32_t>(p));
+        }
+    }
+    const size_t connectivityTasks = parallelTaskCount(faces.connectivity.size(), PARALLEL_MIN_CELLS);
+    parallelForRanges(faces.connectivity.size(), connectivityTasks, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) {
+            faces.connectivity[i] = pointRemap[faces.connectivity[i]];
+        }
+    });
 
-    // Implementation of surface extraction from volume mesh
-    // Basic idea:
-    // 1. Iterate through all faces of cells
-    // 2. Count occurrence of each face
-    // 3. Only keep faces with occurrence count 1 (boundary faces)
+    // Gather per-point arrays for the kept points and per-cell arrays from each face's owning
+    // cell (arrays whose length fits neither count are dropped)
+    auto keptPoint = [&keptPoints](size_t i) { return keptPoints[i]; };
+    auto owner = [&ownerCell](size_t i) { return ownerCell[i]; };
+    const size_t pointTasks = parallelTaskCount(keptPoints.size(), PARALLEL_MIN_CELLS);
+    const size_t faceTasks = parallelTaskCount(ownerCell.size(), PARALLEL_MIN_CELLS);
+    surface.points.resize(keptPoints.size() * 3);
+    parallelForRanges(keptPoints.size(), pointTasks, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) {
+            std::copy_n(volumeMesh.points.begin() + static_cast<size_t>(keptPoints[i]) * 3, 3, surface.points.begin() + i * 3);
+        }
+    });
+    for (const auto& [name, data] : volumeMesh.pointData) {
+        if (const int components = data.componentsFor(pointCount)) {
+            surface.pointData[name] = gatherTuples(data, components, keptPoints.size(), keptPoint, pointTasks);
+        }
+    }
+    for (const auto& [name, data] : volumeMesh.cellData) {
+        if (const int components = data.componentsFor(cellCount)) {
+            surface.cellData[name] = gatherTuples(data, components, ownerCell.size(), owner, faceTasks);
+        }
+    }
 
-    // Temporarily return unimplemented
-    errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
-    errorMsg = "Surface extraction from volume mesh is not implemented";
-    return false;
+    surface.calculateMetadata();
+    surface.metadata.fileName = volumeMesh.metadata.fileName;
+    surface.metadata.format = volumeMesh.metadata.format;
+    surfaceMesh = std::move(surface);
+    return true;
 }
 
 /**
@@ -76,20 +1780,23 @@ bool MeshProcessor::validateMesh(const MeshData& meshData, std::string& errorMsg
 
     uint64_t pointCount = meshData.points.size() / 3;
 
-    // Check cell data
-    for (size_t i = 0; i < meshData.cells.size(); i++) {
-        const auto& cell = meshData.cells[i];
-        for (uint32_t pointIndex : cell.pointIndices) {
-            if (!isValidPointIndex(pointIndex, pointCount)) {
-                errorMsg = "Cell " + std::to_string(i) + " contains invalid point index: " + std::to_string(pointIndex);
-                return false;
+    // Check cell data: one vectorized pass finds the largest index; only a failing mesh is
+    // walked cell by cell to report the first offending cell
+    if (!MeshKernels::scan(meshData, SCAN_INDICES).indicesValid) {
+        for (size_t i = 0; i < meshData.cells.size(); i++) {
+            const auto& cell = meshData.cells[i];
+            for (uint32_t pointIndex : cell.pointIndices) {
+                if (!isValidPointIndex(pointIndex, pointCount)) {
+                    errorMsg = "Cell " + std::to_string(i) + " contains invalid point index: " + std::to_string(pointIndex);
+                    return false;
+                }
             }
         }
     }
 
     // Check point attribute data
     for (const auto& [name, data] : meshData.pointData) {
-        if (!data.empty() && data.size() % pointCount != 0) {
+        if (!data.empty() && data.componentsFor(pointCount) == 0) {
             errorMsg = "Point attribute '" + name + "' data length does not match point count";
             return false;
         }
@@ -98,7 +1805,7 @@ bool MeshProcessor::validateMesh(const MeshData& meshData, std::string& errorMsg
     // Check cell attribute data
     uint64_t cellCount = meshData.cells.size();
     for (const auto& [name, data] : meshData.cellData) {
-        if (!data.empty() && data.size() % cellCount != 0) {
+        if (!data.empty() && data.componentsFor(cellCount) == 0) {
             errorMsg = "Cell attribute '" + name + "' data length does not match cell count";
             return false;
         }
@@ -119,44 +1826,17 @@ bool MeshProcessor::computeBounds(const MeshData& meshData, std::vector<float>&
         return false;
     }
 
-    // Initialize bounding box
-    float minX = std::numeric_limits<float>::max();
-    float maxX = std::numeric_limits<float>::lowest();
-    float minY = std::numeric_limits<float>::max();
-    float maxY = std::numeric_limits<float>::lowest();
-    float minZ = std::numeric_limits<float>::max();
-    float maxZ = std::numeric_limits<float>::lowest();
-
-    // Iterate through all points
-    for (size_t i = 0; i < meshData.points.size(); i += 3) {
-        float x = meshData.points[i];
-        float y = meshData.points[i + 1];
-        float z = meshData.points[i + 2];
-
-        minX = std::min(minX, x);
-        maxX = std::max(maxX, x);
-        minY = std::min(minY, y);
-        maxY = std::max(maxY, y);
-        minZ = std::min(minZ, z);
-        maxZ = std::max(maxZ, z);
-    }
-
-    // Fill output
-    bounds.clear();
-    bounds.push_back(minX);
-    bounds.push_back(maxX);
-    bounds.push_back(minY);
-    bounds.push_back(maxY);
-    bounds.push_back(minZ);
-    bounds.push_back(maxZ);
+    // Vectorized, multithreaded min/max over the coordinate array
+    const MeshScanResult scan = MeshKernels::scan(meshData, SCAN_BOUNDS);
+    bounds.assign(scan.bounds, scan.bounds + 6);
 
     return true;
 }
 
 /**
- * @brief Mesh smoothing
+ * @brief Mesh smoothing (Laplacian, boundary points fixed)
  * @param meshData Input mesh data
- * @param[out] smoothedMesh Output smoothed mesh data
+ * @param[out] smoothedMesh Output smoothed mesh data (may be the input)
  * @param iterations Smoothing iterations
  * @param relaxation Relaxation factor (0-1)
  * @param[out] errorCode Output error code
@@ -169,36 +1849,145 @@ bool MeshProcessor::smoothMesh(const MeshData& meshData,
                               float relaxation,
                               MeshErrorCode& errorCode,
                               std::string& errorMsg) {
+    SmoothingOptions options;
+    options.iterations = iterations;
+    options.relaxation = relaxation;
+    return smoothMesh(meshData, smoothedMesh, options, errorCode, errorMsg);
+}
+
+/**
+ * @brief Mesh smoothing with explicit options
+ * @param meshData Input mesh data
+ * @param[out] smoothedMesh Output smoothed mesh data (may be the input)
+ * @param options Smoothing options
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message
+ * @return Whether processing is successful
+ */
+bool MeshProcessor::smoothMesh(const MeshData& meshData,
+                              MeshData& smoothedMesh,
+                              const SmoothingOptions& options,
+                              MeshErrorCode& errorCode,
+                              std::string& errorMsg) {
+    // Check if input mesh is empty
+    if (meshData.isEmpty()) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Input mesh data is empty";
+        return false;
+    }
+
+    std::vector<float> points = meshData.points;
+    if (!smoothPoints(points, meshData.cells, options, errorCode, errorMsg)) {
+        return false;
+    }
+
+    if (&smoothedMesh != &meshData) {
+        smoothedMesh.cells = meshData.cells;
+        smoothedMesh.pointData = meshData.pointData;
+        smoothedMesh.cellData = meshData.cellData;
+    }
+    smoothedMesh.points = std::move(points);
+    smoothedMesh.calculateMetadata();
+    return true;
+}
+
+/**
+ * @brief Smooth a point array in place
+ * Laplacian: p += relaxation * (mean(neighbours) - p) per iteration.
+ * Taubin: a lambda pass (relaxation) followed by a mu pass with mu = 1 / (k_PB - 1/lambda) < -lambda,
+ * which undoes the shrinkage of the lambda pass while still damping high frequencies.
+ * @param[in,out] points Point coordinates (xyz)
+ * @param cells Cells defining the point neighbourhoods
+ * @param options Smoothing options
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message
+ * @return Whether processing is successful
+ */
+bool MeshProcessor::smoothPoints(std::vector<float>& points,
+                                const MeshData::CellArray& cells,
+                                const SmoothingOptions& options,
+                                MeshErrorCode& errorCode,
+                                std::string& errorMsg) {
     // Check input parameters
-    if (iterations < 0) {
+    if (options.iterations < 0) {
         errorCode = MeshErrorCode::PARAM_INVALID;
         errorMsg = "Iteration count cannot be negative";
         return false;
     }
 
-    if (relaxation < 0.0f || relaxation > 1.0f) {
+    if (options.relaxation < 0.0f || options.relaxation > 1.0f) {
         errorCode = MeshErrorCode::PARAM_INVALID;
         errorMsg = "Relaxation factor must be between 0-1";
         return false;
     }
 
-    // Check if input mesh is empty
-    if (meshData.isEmpty()) {
-        errorCode = MeshErrorCode::MESH_EMPTY;
-        errorMsg = "Input mesh data is empty";
-        return false;
+    float mu = 0.0f;
+    if (options.method == SmoothingMethod::TAUBIN) {
+        if (options.relaxation <= 0.0f || options.passBand <= 0.0f || options.passBand >= 1.0f / options.relaxation) {
+            errorCode = MeshErrorCode::PARAM_INVALID;
+            errorMsg = "Taubin smoothing needs 0 < lambda <= 1 and 0 < pass band < 1/lambda";
+            return false;
+        }
+        mu = 1.0f / (options.passBand - 1.0f / options.relaxation);
+    }
+
+    const size_t pointCount = points.size() / 3;
+    for (size_t i = 0; i < cells.connectivity.size(); ++i) {
+        if (!isValidPointIndex(cells.connectivity[i], pointCount)) {
+            errorCode = MeshErrorCode::PARAM_INVALID;
+            errorMsg = "Cell connectivity contains invalid point index: " + std::to_string(cells.connectivity[i]);
+            return false;
+        }
+    }
+    for (size_t c = 0; c < cells.size(); ++c) {
+        const CellEdgeTable* table = cellEdgeTable(cells.types[c]);
+        if (table && cells.cellSize(c) < cellFaceTable(cells.types[c])->pointCount) {
+            errorCode = MeshErrorCode::PARAM_INVALID;
+            errorMsg = "Cell " + std::to_string(c) + " has too few points";
+            return false;
+        }
+    }
+    if (options.iterations == 0 || options.relaxation == 0.0f || pointCount == 0) {
+        errorCode = MeshErrorCode::SUCCESS;
+        errorMsg.clear();
+        return true;
+    }
+
+    // Adjacency and per-point weights are built once for all iterations
+    PointAdjacency adjacency;
+    buildPointAdjacency(cells, pointCount, options.threads, adjacency);
+    std::vector<uint8_t> boundary;
+    if (options.preserveBoundary) {
+        markBoundaryPoints(cells, pointCount, boundary);
+    }
+    std::vector<float> inverseDegree(pointCount, 0.0f);
+    for (size_t i = 0; i < pointCount; ++i) {
+        const uint64_t degree = adjacency.offsets[i + 1] - adjacency.offsets[i];
+        if (degree > 0 && (boundary.empty() || !boundary[i])) {
+            inverseDegree[i] = 1.0f / static_cast<float>(degree);
+        }
     }
 
-    // Implementation of mesh smoothing
-    // Basic idea:
-    // 1. For each point, compute average of its neighboring points
-    // 2. Move point position according to relaxation factor
-    // 3. Iterate for specified number of times
+    // Double-buffered sweeps: every pass reads one buffer and writes the other
+    const size_t taskCount = parallelTaskCount(pointCount, PARALLEL_MIN_POINTS, options.threads);
+    std::vector<float> scratch(points.size());
+    float* current = points.data();
+    float* next = scratch.data();
+    for (int iteration = 0; iteration < options.iterations; ++iteration) {
+        smoothingPass(adjacency, inverseDegree, options.relaxation, current, next, taskCount);
+        std::swap(current, next);
+        if (options.method == SmoothingMethod::TAUBIN) {
+            smoothingPass(adjacency, inverseDegree, mu, current, next, taskCount);
+            std::swap(current, next);
+        }
+    }
+    if (current != points.data()) {
+        points.swap(scratch);
+    }
 
-    // Temporarily return unimplemented
-    errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
-    errorMsg = "Mesh smoothing is not implemented";
-    return false;
+    errorCode = MeshErrorCode::SUCCESS;
+    errorMsg.clear();
+    return true;
 }
 
 /**
@@ -215,8 +2004,29 @@ bool MeshProcessor::simplifyMesh(const MeshData& meshData,
                                float targetReduction,
                                MeshErrorCode& errorCode,
                                std::string& errorMsg) {
+    SimplificationOptions options;
+    options.targetReduction = targetReduction;
+    return simplifyMesh(meshData, simplifiedMesh, options, errorCode, errorMsg);
+}
+
+/**
+ * @brief Mesh simplification with explicit options
+ * Polygons are fan-triangulated, then edges are collapsed in order of increasing quadric error
+ * (Garland-Heckbert) while the link condition holds and no surviving triangle flips.
+ * @param meshData Input mesh data
+ * @param[out] simplifiedMesh Output simplified mesh data (may be the input)
+ * @param options Simplification options
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message
+ * @return Whether processing is successful
+ */
+bool MeshProcessor::simplifyMesh(const MeshData& meshData,
+                               MeshData& simplifiedMesh,
+                               const SimplificationOptions& options,
+                               MeshErrorCode& errorCode,
+                               std::string& errorMsg) {
     // Check input parameters
-    if (targetReduction < 0.0f || targetReduction >= 1.0f) {
+    if (options.targetReduction < 0.0f || options.targetReduction >= 1.0f) {
         errorCode = MeshErrorCode::PARAM_INVALID;
         errorMsg = "Target reduction ratio must be between 0-1";
         return false;
@@ -229,15 +2039,528 @@ bool MeshProcessor::simplifyMesh(const MeshData& meshData,
         return false;
     }
 
-    // Implementation of mesh simplification
-    // Basic idea:
-    // 1. Use edge collapse algorithm
-    // 2. Compute collapse cost for edges
-    // 3. Collapse edges in order of increasing cost
-    // 4. Until target reduction ratio is reached
+    const MeshData::CellArray& cells = meshData.cells;
+    const size_t pointCount = meshData.points.size() / 3;
+    const size_t cellCount = cells.size();
+    for (size_t c = 0; c < cellCount; ++c) {
+        if (cellFaceTable(cells.types[c])) {
+            errorCode = MeshErrorCode::PARAM_INVALID;
+            errorMsg = "Mesh simplification requires a surface mesh (extract the surface first)";
+            return false;
+        }
+    }
+    for (uint32_t pointIndex : cells.connectivity) {
+        if (!isValidPointIndex(pointIndex, pointCount)) {
+            errorCode = MeshErrorCode::PARAM_INVALID;
+            errorMsg = "Cell connectivity contains invalid point index: " + std::to_string(pointIndex);
+            return false;
+        }
+    }
+
+    // Working mesh: double positions, interleaved point attributes, one triangle per fan piece
+    QuadricDecimator mesh;
+    std::vector<uint32_t> sourceCell;
+    mesh.positions.assign(meshData.points.begin(), meshData.points.begin() + pointCount * 3);
+    for (size_t c = 0; c < cellCount; ++c) {
+        forEachTriangle(cells, c, c + 1, [&](uint32_t a, uint32_t b, uint32_t d) {
+            if (a != b && b != d && a != d) {
+                mesh.corners.insert(mesh.corners.end(), {a, b, d});
+                sourceCell.push_back(static_cast<uint32_t>(c));
+            }
+        });
+    }
+    if (sourceCell.empty()) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Input mesh has no polygonal cells";
+        return false;
+    }
+
+    // Point attributes are interpolated in double and converted back to their own type
+    std::vector<std::pair<std::string, size_t>> pointArrays;
+    for (const auto& [name, data] : meshData.pointData) {
+        const int components = data.componentsFor(pointCount);
+        if (data.empty() || components == 0) {
+            errorCode = MeshErrorCode::PARAM_INVALID;
+            errorMsg = "Point attribute '" + name + "' data length does not match point count";
+            return false;
+        }
+        pointArrays.emplace_back(name, static_cast<size_t>(components));
+        mesh.attributeWidth += static_cast<size_t>(components);
+    }
+    for (const auto& [name, data] : meshData.cellData) {
+        if (data.empty() || data.componentsFor(cellCount) == 0) {
+            errorCode = MeshErrorCode::PARAM_INVALID;
+            errorMsg = "Cell attribute '" + name + "' data length does not match cell count";
+            return false;
+        }
+    }
+    mesh.attributes.resize(pointCount * mesh.attributeWidth);
+    size_t column = 0;
+    for (const auto& [name, components] : pointArrays) {
+        meshData.pointData.at(name).visit([&, components = components](const auto& values) {
+            for (size_t v = 0; v < pointCount; ++v) {
+                std::copy_n(values.begin() + v * components, components, mesh.attributes.begin() + v * mesh.attributeWidth + column);
+            }
+        });
+        column += components;
+    }
+
+    // Decimate: partitions in parallel with locked seams, then a global pass around the seams
+    const double keepRatio = 1.0 - static_cast<double>(options.targetReduction);
+    const size_t targetTriangles = static_cast<size_t>(static_cast<double>(sourceCell.size()) * keepRatio);
+    const size_t partitionCount = std::min(MAX_DECIMATION_PARTITIONS, sourceCell.size() / PARALLEL_MIN_TRIANGLES);
+    if (partitionCount > 1) {
+        std::vector<uint8_t> seams;
+        std::vector<uint8_t> carried;
+        decimatePartitions(mesh, partitionCount, options.threads, keepRatio, options.preserveBoundary, seams, carried);
+        mesh.seed(&seams);
+    } else {
+        mesh.build(options.preserveBoundary);
+        mesh.seed(nullptr);
+    }
+    mesh.run(targetTriangles);
+
+    // Compact surviving points and triangles
+    std::vector<uint32_t> newIndex(pointCount, NO_POINT);
+    std::vector<uint32_t> oldIndex;
+    MeshData result;
+    std::vector<uint32_t> keptSource;
+    keptSource.reserve(mesh.liveTriangles);
+    result.cells.types.reserve(mesh.liveTriangles);
+    result.cells.offsets.reserve(mesh.liveTriangles + 1);
+    result.cells.connectivity.reserve(mesh.liveTriangles * 3);
+    for (size_t t = 0; t < sourceCell.size(); ++t) {
+        const uint32_t* triangle = mesh.corners.data() + t * 3;
+        if (triangle[0] == NO_POINT) {
+            continue;
+        }
+        uint32_t indices[3];
+        for (size_t k = 0; k < 3; ++k) {
+            uint32_t& mapped = newIndex[triangle[k]];
+            if (mapped == NO_POINT) {
+                mapped = static_cast<uint32_t>(oldIndex.size());
+                oldIndex.push_back(triangle[k]);
+            }
+            indices[k] = mapped;
+        }
+        result.cells.addCell(VtkCellType::TRIANGLE, indices, 3);
+        keptSource.push_back(sourceCell[t]);
+    }
+
+    result.points.resize(oldIndex.size() * 3);
+    for (size_t v = 0; v < oldIndex.size(); ++v) {
+        for (size_t k = 0; k < 3; ++k) {
+            result.points[v * 3 + k] = static_cast<float>(mesh.positions[static_cast<size_t>(oldIndex[v]) * 3 + k]);
+        }
+    }
+    column = 0;
+    for (const auto& [name, components] : pointArrays) {
+        const MeshAttribute& source = meshData.pointData.at(name);
+        MeshAttribute& data = result.pointData[name] = MeshAttribute(source.type(), static_cast<int>(components), oldIndex.size());
+        data.visit([&, components = components](auto& values) {
+            using T = typename std::decay_t<decltype(values)>::value_type;
+            for (size_t v = 0; v < oldIndex.size(); ++v) {
+                const double* interpolated = mesh.attributes.data() + static_cast<size_t>(oldIndex[v]) * mesh.attributeWidth + column;
+                for (size_t k = 0; k < components; ++k) {
+                    values[v * components + k] = attributeCast<T>(interpolated[k]);
+                }
+            }
+        });
+        column += components;
+    }
+    // Every output triangle carries the cell data of the cell it was cut from
+    auto keptCell = [&keptSource](size_t t) { return keptSource[t]; };
+    for (const auto& [name, data] : meshData.cellData) {
+        result.cellData[name] = gatherTuples(data, data.componentsFor(cellCount), keptSource.size(), keptCell, 1);
+    }
+
+    simplifiedMesh = std::move(result);
+    simplifiedMesh.calculateMetadata();
+    errorCode = MeshErrorCode::SUCCESS;
+    errorMsg.clear();
+    return true;
+}
+
+/**
+ * @brief Merge coincident points and remap the cells
+ * @param meshData Input mesh data
+ * @param[out] weldedMesh Output mesh data (may be the input)
+ * @param options Welding options
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message
+ * @return Whether processing is successful
+ */
+bool MeshProcessor::weldPoints(const MeshData& meshData,
+                             MeshData& weldedMesh,
+                             const WeldOptions& options,
+                             MeshErrorCode& errorCode,
+                             std::string& errorMsg) {
+    // Check input parameters
+    if (!(options.tolerance >= 0.0f)) {
+        errorCode = MeshErrorCode::PARAM_INVALID;
+        errorMsg = "Weld tolerance cannot be negative";
+        return false;
+    }
+
+    // Check if input mesh is empty
+    if (meshData.isEmpty()) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Input mesh data is empty";
+        return false;
+    }
+
+    if (!validateMeshArrays(meshData, errorCode, errorMsg)) {
+        return false;
+    }
+    const size_t pointCount = meshData.points.size() / 3;
+    const size_t cellCount = meshData.cells.size();
+
+    // Grid cells are twice the tolerance wide (see PointGrid::lowestMatch)
+    std::vector<float> bounds;
+    computeBounds(meshData, bounds);
+    const double origin[3] = {bounds[0], bounds[2], bounds[4]};
+    const double extent = std::sqrt(static_cast<double>(bounds[1] - bounds[0]) * (bounds[1] - bounds[0])
+                                  + static_cast<double>(bounds[3] - bounds[2]) * (bounds[3] - bounds[2])
+                                  + static_cast<double>(bounds[5] - bounds[4]) * (bounds[5] - bounds[4]));
+    double tolerance = options.relativeTolerance ? options.tolerance * extent : options.tolerance;
+    if (tolerance > 0.0 && extent / tolerance > 1e15) {
+        tolerance = 0.0;  // Below float resolution: only identical positions can merge
+    }
+
+    // Every point points at the lowest-index point within the tolerance; chains resolve to
+    // the root in one ascending sweep because parents always have lower indices
+    const size_t taskCount = parallelTaskCount(pointCount, PARALLEL_MIN_WELD_POINTS, options.threads);
+    std::vector<uint32_t> root(pointCount);
+    {
+        const PointGrid grid(meshData.points, origin, tolerance * 2.0, taskCount);
+        const double toleranceSquared = tolerance * tolerance;
+        parallelForRanges(pointCount, taskCount, [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) {
+                root[i] = grid.lowestMatch(static_cast<uint32_t>(i), toleranceSquared);
+            }
+        });
+    }
+    std::vector<uint32_t> newIndex(pointCount);
+    std::vector<uint32_t> groupSize;
+    for (size_t i = 0; i < pointCount; ++i) {
+        if (root[i] == i) {
+            newIndex[i] = static_cast<uint32_t>(groupSize.size());
+            groupSize.push_back(0);
+        } else {
+            root[i] = root[root[i]];
+            newIndex[i] = newIndex[root[i]];
+        }
+        groupSize[newIndex[i]]++;
+    }
+    const size_t weldedCount = groupSize.size();
+
+    // Points and point data: the first point of each group, or the group average (summed in
+    // double; integer arrays are rounded back to the nearest value)
+    MeshData result;
+    auto gather = [&](const auto* source, size_t components, auto* target) {
+        using T = std::remove_pointer_t<decltype(target)>;
+        if (!options.averageMerged) {
+            for (size_t i = 0; i < pointCount; ++i) {
+                if (root[i] == i) {
+                    std::copy_n(source + i * components, components, target + static_cast<size_t>(newIndex[i]) * components);
+                }
+            }
+            return;
+        }
+        std::vector<double> sums(weldedCount * components, 0.0);
+        for (size_t i = 0; i < pointCount; ++i) {
+            for (size_t k = 0; k < components; ++k) {
+                sums[static_cast<size_t>(newIndex[i]) * components + k] += static_cast<double>(source[i * components + k]);
+            }
+        }
+        for (size_t p = 0; p < weldedCount; ++p) {
+            for (size_t k = 0; k < components; ++k) {
+                target[p * components + k] = attributeCast<T>(sums[p * components + k] / groupSize[p]);
+            }
+        }
+    };
+    result.points.resize(weldedCount * 3);
+    gather(meshData.points.data(), 3, result.points.data());
+    for (const auto& [name, data] : meshData.pointData) {
+        const int components = data.componentsFor(pointCount);
+        MeshAttribute& welded = result.pointData[name] = MeshAttribute(data.type(), std::max(components, 1), components ? weldedCount : 0);
+        data.visit([&](const auto& values) {
+            using T = typename std::decay_t<decltype(values)>::value_type;
+            gather(values.data(), static_cast<size_t>(components), welded.values<T>().data());
+        });
+    }
+
+    // Cells of every type are remapped; surface cells that collapsed are dropped
+    result.cells = meshData.cells;
+    std::vector<uint32_t>& connectivity = result.cells.connectivity;
+    parallelForRanges(connectivity.size(), taskCount, [&](size_t begin, size_t end, size_t) {
+        for (size_t k = begin; k < end; ++k) {
+            connectivity[k] = newIndex[connectivity[k]];
+        }
+    });
+    result.cellData = meshData.cellData;
+    result.metadata = meshData.metadata;
+    if (options.removeDegenerateCells && weldedCount < pointCount) {
+        MeshData::CellArray cleaned;
+        std::vector<uint32_t> keptCells;
+        std::vector<uint32_t> kept;
+        bool changed = false;
+        for (size_t c = 0; c < cellCount; ++c) {
+            VtkCellType type = result.cells.types[c];
+            const size_t size = result.cells.cellSize(c);
+            if (!cleanWeldedCell(type, result.cells.cellPoints(c), size, kept)) {
+                changed = true;
+                continue;
+            }
+            changed = changed || kept.size() != size;
+            cleaned.addCell(type, kept.data(), kept.size());
+            keptCells.push_back(static_cast<uint32_t>(c));
+        }
+        if (changed) {
+            result.cells = std::move(cleaned);
+            auto keptCell = [&keptCells](size_t c) { return keptCells[c]; };
+            for (auto& [name, data] : result.cellData) {
+                data = gatherTuples(data, data.componentsFor(cellCount), keptCells.size(), keptCell, 1);
+            }
+        }
+    }
+
+    weldedMesh = std::move(result);
+    weldedMesh.calculateMetadata();
+    errorCode = MeshErrorCode::SUCCESS;
+    errorMsg.clear();
+    return true;
+}
+
+/**
+ * @brief Reorder points and cells along a space-filling curve for memory locality
+ * Coordinates are quantized to 21 bits per axis over the bounding cube and mapped to Morton
+ * or Hilbert codes; points (by position) and cells (by centroid) are sorted with a stable
+ * parallel radix sort. Cell connectivity is remapped, point and cell data are permuted
+ * with their entities, so the reordered mesh describes the same geometry.
+ * @param meshData Input mesh data
+ * @param[out] reorderedMesh Output mesh data (may be the input)
+ * @param options Reordering options
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message
+ * @return Whether processing is successful
+ */
+bool MeshProcessor::reorderMesh(const MeshData& meshData,
+                               MeshData& reorderedMesh,
+                               const ReorderOptions& options,
+                               MeshErrorCode& errorCode,
+                               std::string& errorMsg) {
+    // Check if input mesh is empty
+    if (meshData.isEmpty()) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Input mesh data is empty";
+        return false;
+    }
+    if (!validateMeshArrays(meshData, errorCode, errorMsg)) {
+        return false;
+    }
+    if (options.curve == MeshReorder::NONE || (!options.reorderPoints && !options.reorderCells)) {
+        if (&reorderedMesh != &meshData) {
+            reorderedMesh = meshData;
+        }
+        errorCode = MeshErrorCode::SUCCESS;
+        errorMsg.clear();
+        return true;
+    }
+
+    const size_t pointCount = meshData.points.size() / 3;
+    const size_t cellCount = meshData.cells.size();
+    std::vector<float> bounds;
+    computeBounds(meshData, bounds);
+    const CurveEncoder encoder(bounds, options.curve);
+    const unsigned int codeBits = CURVE_BITS * 3;
+
+    MeshData result;
+    result.metadata = meshData.metadata;
+
+    // Points: sort by the code of their position, then remap the connectivity
+    std::vector<uint32_t> newPointIndex;
+    if (options.reorderPoints) {
+        const size_t taskCount = parallelTaskCount(pointCount, PARALLEL_MIN_REORDER_ITEMS, options.threads);
+        std::vector<uint64_t> codes(pointCount);
+        std::vector<uint32_t> order(pointCount);
+        const float* points = meshData.points.data();
+        parallelForRanges(pointCount, taskCount, [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) {
+                codes[i] = encoder.encode(points[i * 3], points[i * 3 + 1], points[i * 3 + 2]);
+                order[i] = static_cast<uint32_t>(i);
+            }
+        });
+        parallelRadixSort(codes, order, codeBits, taskCount);
+
+        newPointIndex.resize(pointCount);
+        result.points.resize(meshData.points.size());
+        parallelForRanges(pointCount, taskCount, [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) {
+                newPointIndex[order[i]] = static_cast<uint32_t>(i);
+                std::copy_n(points + static_cast<size_t>(order[i]) * 3, 3, result.points.begin() + i * 3);
+            }
+        });
+        auto oldPoint = [&order](size_t i) { return order[i]; };
+        for (const auto& [name, data] : meshData.pointData) {
+            result.pointData[name] = gatherTuples(data, data.componentsFor(pointCount), pointCount, oldPoint, taskCount);
+        }
+    } else {
+        result.points = meshData.points;
+        result.pointData = meshData.pointData;
+    }
+
+    // Cells: sort by the code of their centroid (invariant under the point reordering)
+    const MeshData::CellArray& cells = meshData.cells;
+    const size_t cellTasks = parallelTaskCount(cellCount, PARALLEL_MIN_REORDER_ITEMS, options.threads);
+    std::vector<uint32_t> cellOrder(cellCount);
+    if (options.reorderCells) {
+        std::vector<uint64_t> codes(cellCount);
+        const float* points = meshData.points.data();
+        parallelForRanges(cellCount, cellTasks, [&](size_t begin, size_t end, size_t) {
+            for (size_t c = begin; c < end; ++c) {
+                const uint32_t* ids = cells.cellPoints(c);
+                const size_t size = cells.cellSize(c);
+                double centroid[3] = {0.0, 0.0, 0.0};
+                for (size_t k = 0; k < size; ++k) {
+                    for (int axis = 0; axis < 3; ++axis) {
+                        centroid[axis] += points[static_cast<size_t>(ids[k]) * 3 + axis];
+                    }
+                }
+                const double weight = size ? 1.0 / static_cast<double>(size) : 0.0;
+                codes[c] = encoder.encode(centroid[0] * weight, centroid[1] * weight, centroid[2] * weight);
+                cellOrder[c] = static_cast<uint32_t>(c);
+            }
+        });
+        parallelRadixSort(codes, cellOrder, codeBits, cellTasks);
+    } else {
+        for (size_t c = 0; c < cellCount; ++c) {
+            cellOrder[c] = static_cast<uint32_t>(c);
+        }
+    }
+
+    // Rebuild the CSR arrays in the new cell order with remapped point indices
+    MeshData::CellArray& outCells = result.cells;
+    outCells.types.resize(cellCount);
+    outCells.offsets.resize(cellCount + 1);
+    outCells.offsets[0] = 0;
+    for (size_t c = 0; c < cellCount; ++c) {
+        outCells.offsets[c + 1] = outCells.offsets[c] + cells.cellSize(cellOrder[c]);
+    }
+    outCells.connectivity.resize(cells.connectivity.size());
+    parallelForRanges(cellCount, cellTasks, [&](size_t begin, size_t end, size_t) {
+        for (size_t c = begin; c < end; ++c) {
+            const uint32_t source = cellOrder[c];
+            outCells.types[c] = cells.types[source];
+            const uint32_t* ids = cells.cellPoints(source);
+            const size_t size = cells.cellSize(source);
+            uint32_t* target = outCells.connectivity.data() + outCells.offsets[c];
+            for (size_t k = 0; k < size; ++k) {
+                target[k] = newPointIndex.empty() ? ids[k] : newPointIndex[ids[k]];
+            }
+        }
+    });
+    auto oldCell = [&cellOrder](size_t c) { return cellOrder[c]; };
+    for (const auto& [name, data] : meshData.cellData) {
+        result.cellData[name] = options.reorderCells ? gatherTuples(data, data.componentsFor(cellCount), cellCount, oldCell, cellTasks) : data;
+    }
+
+    reorderedMesh = std::move(result);
+    reorderedMesh.calculateMetadata();
+    errorCode = MeshErrorCode::SUCCESS;
+    errorMsg.clear();
+    return true;
+}
+
+/**
+ * @brief Build a level-of-detail chain for display
+ * @param meshData Input mesh (volume or surface)
+ * @param[out] levels Output levels, coarsest first
+ * @param options Level-of-detail options
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message
+ * @param onLevel Called with the index and mesh of every level as soon as it is built (optional)
+ * @return Whether processing is successful
+ */
+bool MeshProcessor::buildLevelsOfDetail(const MeshData& meshData,
+                                      std::vector<MeshData>& levels,
+                                      const LodOptions& options,
+                                      MeshErrorCode& errorCode,
+                                      std::string& errorMsg,
+                                      const std::function<void(size_t, const MeshData&)>& onLevel) {
+    // Check input parameters
+    if (options.levelRatio <= 0.0f || options.levelRatio >= 1.0f || options.maxTriangles == 0) {
+        errorCode = MeshErrorCode::PARAM_INVALID;
+        errorMsg = "Level ratio must be between 0-1 and the triangle budget must be positive";
+        return false;
+    }
+    if (meshData.isEmpty()) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Input mesh data is empty";
+        return false;
+    }
+
+    // Geometry to display: the boundary of volume meshes, the polygons of surface meshes
+    const bool volume = meshData.metadata.meshType == MeshType::VOLUME_MESH;
+    const double surfaceShare = volume ? 0.25 : 0.05;
+    MeshData surface;
+    {
+        JobStep step(0.0, surfaceShare);
+        if (volume) {
+            MeshData boundary;
+            if (!extractSurfaceFromVolume(meshData, boundary, true, errorCode, errorMsg)) {
+                return false;
+            }
+            surface = triangleSurface(boundary);
+        } else {
+            surface = triangleSurface(meshData);
+        }
+    }
+    const uint64_t surfaceTriangles = surface.cells.size();
+    if (surfaceTriangles == 0) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Mesh has no surface to display";
+        return false;
+    }
+
+    // Triangle targets from the budget down by levelRatio, built coarsest first
+    std::vector<uint64_t> targets = {std::min(surfaceTriangles, options.maxTriangles)};
+    for (;;) {
+        const uint64_t coarser = static_cast<uint64_t>(static_cast<double>(targets.back()) * options.levelRatio);
+        if (coarser == 0 || coarser < options.minTriangles) {
+            break;
+        }
+        targets.push_back(coarser);
+    }
+    std::reverse(targets.begin(), targets.end());
+
+    std::vector<MeshData> result;
+    result.reserve(targets.size());
+    const double levelShare = (1.0 - surfaceShare) / static_cast<double>(targets.size());
+    for (size_t i = 0; i < targets.size(); ++i) {
+        JobControl::checkpoint();
+        JobStep step(surfaceShare + levelShare * static_cast<double>(i), surfaceShare + levelShare * static_cast<double>(i + 1));
+        if (targets[i] == surfaceTriangles) {
+            result.push_back(surface);
+        } else {
+            SimplificationOptions simplification;
+            const float reduction = static_cast<float>(1.0 - static_cast<double>(targets[i]) / static_cast<double>(surfaceTriangles));
+            simplification.targetReduction = std::min(reduction, std::nextafter(1.0f, 0.0f));
+            simplification.threads = options.threads;
+            MeshData level;
+            if (!simplifyMesh(surface, level, simplification, errorCode, errorMsg)) {
+                return false;
+            }
+            result.push_back(std::move(level));
+        }
+        result.back().calculateMetadata();
+        if (onLevel) {
+            onLevel(i, result.back());
+        }
+    }
 
-    // Temporarily return unimplemented
-    errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
-    errorMsg = "Mesh simplification is not implemented";
-    return false;
+    levels = std::move(result);
+    errorCode = MeshErrorCode::SUCCESS;
+    errorMsg.clear();
+    return true;
 }
@@ -3,8 +3,34 @@
 #include <vector>
 #include <algorithm>
 #include <sstream>
+#include <iostream>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <chrono>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <exception>
+#include <map>
+#include <atomic>
+#include <mutex>
+#include <system_error>
 
 #include "MeshReader.h"
+#include "VTKBridge.h"
+#include "MappedFile.h"
+#include "MeshCache.h"
+#include "MeshHelper.h"
+#include "Profiler.h"
+#include "TextTokenizer.h"
+#include "MeshTextParser.h"
+#include "JobControl.h"
+#include "ParallelFor.h"
+#include "MeshProcessor.h"
+#include "GmshElements.h"
+#include "CgnsSupport.h"
+#include "OpenFoamSupport.h"
 #include <fstream>
 #include <filesystem>
 #include <vtkTetra.h>
@@ -23,10 +49,6 @@
 #include <vtkXMLStructuredGridReader.h>
 #include <vtkXMLRectilinearGridReader.h>
 #include <vtkXMLPolyDataReader.h>
-#ifdef HAVE_CGNS
-#include <vtkCGNSReader.h>
-#include <vtkMultiBlockDataSet.h>
-#endif
 #include <vtkCellData.h>
 #include <vtkPointData.h>
 #include <vtkDataArray.h>
@@ -36,78 +58,2383 @@
 #include <vtkPolyData.h>
 #include <vtkPLYReader.h>
 
-#ifdef _WIN32
-#include <windows.h>
+#ifdef _WIN32
+#include <windows.h>
+
+/**
+ * @brief Convert UTF-8 string to wide string
+ * @param utf8 UTF-8 string
+ * @return Wide string
+ */
+std::wstring utf8ToWide(const std::string& utf8) {
+    if (utf8.empty()) {
+        return std::wstring();
+    }
+    int size_needed = MultiByteToWideChar(CP_UTF8, 0, utf8.c_str(), (int)utf8.size(), NULL, 0);
+    std::wstring wide(size_needed, 0);
+    MultiByteToWideChar(CP_UTF8, 0, utf8.c_str(), (int)utf8.size(), &wide[0], size_needed);
+    return wide;
+}
+
+/**
+ * @brief Set VTK reader file name with UTF-8 support
+ * @param reader VTK reader
+ * @param filePath UTF-8 encoded file path
+ */
+template<typename ReaderType>
+void setVTKReaderFileName(vtkSmartPointer<ReaderType> reader, const std::string& filePath) {
+#ifdef _WIN32
+    // Use SetFileName with UTF-8 encoded path
+    // VTK's SetFileName should handle UTF-8 correctly
+    reader->SetFileName(filePath.c_str());
+#else
+    reader->SetFileName(filePath.c_str());
+#endif
+}
+
+/**
+ * @brief Set VTK reader file name with UTF-8 support (raw pointer version)
+ * @param reader VTK reader
+ * @param filePath UTF-8 encoded file path
+ */
+template<typename ReaderType>
+void setVTKReaderFileName(ReaderType* reader, const std::string& filePath) {
+#ifdef _WIN32
+    // Use SetFileName with UTF-8 encoded path
+    // VTK's SetFileName should handle UTF-8 correctly
+    reader->SetFileName(filePath.c_str());
+#else
+    reader->SetFileName(filePath.c_str());
+#endif
+}
+
+#endif
+
+/**
+ * @brief Check if file exists
+ * @param filePath File path
+ * @return Whether exists
+ */
+bool MeshReader::fileExists(const std::string& filePath) {
+    return std::filesystem::exists(filePath);
+}
+
+namespace {
+
+/**
+ * @brief Open-addressing hash table that merges bit-identical vertices
+ * Appends each new vertex to the point array and returns its index.
+ */
+class ExactVertexWelder {
+public:
+    /**
+     * @brief Constructor
+     * @param points Point array receiving unique vertices
+     * @param expectedVertices Number of vertices that will be inserted (sizing hint)
+     */
+    ExactVertexWelder(std::vector<float>& points, size_t expectedVertices) : points_(points) {
+        // Closed triangle meshes have roughly one unique vertex per six corners
+        size_t capacity = 1024;
+        while (capacity < expectedVertices / 3) {
+            capacity <<= 1;
+        }
+        slots_.assign(capacity, EMPTY_SLOT);
+        points_.reserve(points_.size() + expectedVertices / 6 * 3);
+    }
+
+    /**
+     * @brief Insert a vertex
+     * @param xyz Three little-endian floats (12 bytes, may be unaligned)
+     * @return Index of the (possibly existing) vertex
+     */
+    uint32_t insert(const void* xyz) {
+        uint32_t key[3];
+        std::memcpy(key, xyz, sizeof(key));
+        for (uint32_t& bits : key) {
+            if (bits == 0x80000000u) {
+                bits = 0; // -0.0 and +0.0 are the same position
+            }
+        }
+        
+        const size_t mask = slots_.size() - 1;
+        size_t slot = hashKey(key) & mask;
+        while (slots_[slot] != EMPTY_SLOT) {
+            if (std::memcmp(&points_[static_cast<size_t>(slots_[slot]) * 3], key, sizeof(key)) == 0) {
+                return slots_[slot];
+            }
+            slot = (slot + 1) & mask;
+        }
+        
+        const uint32_t index = static_cast<uint32_t>(points_.size() / 3);
+        const size_t offset = points_.size();
+        points_.resize(offset + 3);
+        std::memcpy(&points_[offset], key, sizeof(key));
+        slots_[slot] = index;
+        
+        // Keep the load factor below 0.5
+        if (static_cast<size_t>(index + 1) * 2 > slots_.size()) {
+            grow();
+        }
+        return index;
+    }
+
+private:
+    static constexpr uint32_t EMPTY_SLOT = 0xFFFFFFFFu;
+
+    static uint64_t hashKey(const uint32_t* key) {
+        uint64_t h = key[0] * 0x9E3779B97F4A7C15ull;
+        h ^= (key[1] + 0x632BE59BD9B4E019ull) * 0xC2B2AE3D27D4EB4Full;
+        h ^= key[2] * 0x165667B19E3779F9ull;
+        return h ^ (h >> 29);
+    }
+
+    void grow() {
+        std::vector<uint32_t> oldSlots(slots_.size() * 2, EMPTY_SLOT);
+        oldSlots.swap(slots_);
+        const size_t mask = slots_.size() - 1;
+        for (uint32_t index : oldSlots) {
+            if (index == EMPTY_SLOT) {
+                continue;
+            }
+            uint32_t key[3];
+            std::memcpy(key, &points_[static_cast<size_t>(index) * 3], sizeof(key));
+            size_t slot = hashKey(key) & mask;
+            while (slots_[slot] != EMPTY_SLOT) {
+                slot = (slot + 1) & mask;
+            }
+            slots_[slot] = index;
+        }
+    }
+
+    std::vector<float>& points_;
+    std::vector<uint32_t> slots_;
+};
+
+/**
+ * @brief Store parse statistics of a reader in the mesh metadata
+ * @param meshData Mesh data that was read
+ * @param bytes Bytes parsed
+ * @param startTime Time at which parsing started
+ */
+template<typename MeshT>
+void recordReadThroughput(MeshT& meshData, size_t bytes, std::chrono::steady_clock::time_point startTime) {
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    meshData.metadata.sourceBytes = bytes;
+    meshData.metadata.readThroughputMBps = TextTokenizer::throughputMBps(bytes, seconds);
+}
+
+// Minimum bytes per chunk for chunk-parallel text parsing (smaller inputs are parsed serially)
+constexpr size_t PARALLEL_CHUNK_MIN_BYTES = 4 * 1024 * 1024;
+
+/**
+ * @brief Number of chunks a text block is split into for parallel parsing
+ * @param bytes Size of the text block
+ * @param readThreads Requested worker threads (0 = hardware concurrency)
+ * @return Chunk count (1 = serial)
+ */
+size_t parallelChunkCount(size_t bytes, unsigned int readThreads) {
+    const size_t threads = readThreads ? readThreads : std::max(1u, std::thread::hardware_concurrency());
+    return std::max<size_t>(1, std::min(threads, bytes / PARALLEL_CHUNK_MIN_BYTES));
+}
+
+/**
+ * @brief Split a text block into chunks that start and end at line boundaries
+ * @param text Text block
+ * @param count Requested chunk count
+ * @return Chunks in file order (fewer than count when lines are long)
+ */
+std::vector<std::string_view> splitAtLines(std::string_view text, size_t count) {
+    std::vector<std::string_view> chunks;
+    const char* begin = text.data();
+    const char* end = begin + text.size();
+    const char* chunkBegin = begin;
+    for (size_t i = 1; i <= count && chunkBegin != end; ++i) {
+        const char* chunkEnd = end;
+        if (i < count) {
+            chunkEnd = std::max(chunkBegin, begin + text.size() / count * i);
+            const char* newline = static_cast<const char*>(std::memchr(chunkEnd, '\n', static_cast<size_t>(end - chunkEnd)));
+            chunkEnd = newline ? newline + 1 : end;
+        }
+        chunks.emplace_back(chunkBegin, static_cast<size_t>(chunkEnd - chunkBegin));
+        chunkBegin = chunkEnd;
+    }
+    return chunks;
+}
+
+/**
+ * @brief Append per-chunk point buffers in order (prefix sum over sizes, parallel copy)
+ * Chunk buffers are released after they are copied.
+ * @param parts Point buffers in file order
+ * @param[in,out] points Destination point array
+ */
+template<typename Real>
+void concatenatePoints(std::vector<std::vector<Real>*> parts, std::vector<Real>& points) {
+    parts.erase(std::remove_if(parts.begin(), parts.end(), [](const std::vector<Real>* part) {
+        return part->empty();
+    }), parts.end());
+    if (parts.size() == 1 && points.empty()) {
+        points = std::move(*parts[0]);
+        return;
+    }
+    std::vector<size_t> base(parts.size() + 1, points.size());
+    for (size_t i = 0; i < parts.size(); ++i) {
+        base[i + 1] = base[i] + parts[i]->size();
+    }
+    points.resize(base.back());
+    runParallel(parts.size(), [&](size_t i) {
+        std::copy(parts[i]->begin(), parts[i]->end(), points.begin() + base[i]);
+        std::vector<Real>().swap(*parts[i]);
+    });
+}
+
+/**
+ * @brief Append per-chunk cell arrays in order (prefix sums over cell and connectivity counts)
+ * Offsets of each chunk are shifted by the connectivity that precedes it; chunk arrays are
+ * released after they are copied.
+ * @param parts Cell arrays in output order
+ * @param[in,out] cells Destination cell array
+ */
+template<typename Index>
+void concatenateCells(std::vector<BasicCellArray<Index>*> parts, BasicCellArray<Index>& cells) {
+    parts.erase(std::remove_if(parts.begin(), parts.end(), [](const BasicCellArray<Index>* part) {
+        return part->empty();
+    }), parts.end());
+    if (parts.size() == 1 && cells.empty()) {
+        cells = std::move(*parts[0]);
+        return;
+    }
+    std::vector<size_t> cellBase(parts.size() + 1, cells.size());
+    std::vector<size_t> connectivityBase(parts.size() + 1, cells.connectivitySize());
+    for (size_t i = 0; i < parts.size(); ++i) {
+        cellBase[i + 1] = cellBase[i] + parts[i]->size();
+        connectivityBase[i + 1] = connectivityBase[i] + parts[i]->connectivitySize();
+    }
+    if (connectivityBase.back() > std::numeric_limits<Index>::max()) {
+        throw std::length_error("cell connectivity exceeds the offset range of the index type");
+    }
+    cells.types.resize(cellBase.back());
+    cells.offsets.resize(cellBase.back() + 1);
+    cells.connectivity.resize(connectivityBase.back());
+    runParallel(parts.size(), [&](size_t i) {
+        BasicCellArray<Index>& part = *parts[i];
+        std::copy(part.types.begin(), part.types.end(), cells.types.begin() + cellBase[i]);
+        std::copy(part.connectivity.begin(), part.connectivity.end(), cells.connectivity.begin() + connectivityBase[i]);
+        const Index shift = static_cast<Index>(connectivityBase[i]);
+        Index* offsets = cells.offsets.data() + cellBase[i] + 1;
+        for (size_t j = 0; j < part.size(); ++j) {
+            offsets[j] = shift + part.offsets[j + 1];
+        }
+        part = BasicCellArray<Index>();
+    });
+}
+
+// Binary Gmsh records converted per task (smaller blocks are converted serially)
+constexpr size_t GMSH_BINARY_RECORDS_PER_TASK = 256 * 1024;
+
+/**
+ * @brief Unsupported Gmsh file version (MSH 1.x, 3.x, 4.0)
+ */
+class GmshVersionError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * @brief Gmsh node tag to point index lookup
+ * Contiguous tags (the common case) map by offset, moderately sparse tags through a dense
+ * table and anything else through binary search over the sorted tags.
+ */
+class GmshNodeIndex {
+public:
+    explicit GmshNodeIndex(const std::vector<uint64_t>& tags) : count_(tags.size()) {
+        if (tags.empty()) {
+            return;
+        }
+        const auto range = std::minmax_element(tags.begin(), tags.end());
+        firstTag_ = *range.first;
+        const uint64_t span = *range.second - firstTag_;
+        contiguous_ = span + 1 == count_;
+        for (size_t i = 0; contiguous_ && i < count_; ++i) {
+            contiguous_ = tags[i] == firstTag_ + i;
+        }
+        if (contiguous_) {
+            return;
+        }
+        if (span / 4 < count_) {
+            dense_.assign(span + 1, MISSING);
+            for (size_t i = 0; i < count_; ++i) {
+                dense_[tags[i] - firstTag_] = i;
+            }
+            return;
+        }
+        sorted_.reserve(count_);
+        for (size_t i = 0; i < count_; ++i) {
+            sorted_.emplace_back(tags[i], i);
+        }
+        std::sort(sorted_.begin(), sorted_.end());
+    }
+
+    /**
+     * @brief Find the point index of a node tag
+     * @param tag Gmsh node tag
+     * @param[out] index Point index (position of the node in file order)
+     * @return Whether the tag belongs to a node
+     */
+    bool find(uint64_t tag, uint64_t& index) const {
+        if (tag < firstTag_) {
+            return false;
+        }
+        const uint64_t offset = tag - firstTag_;
+        if (contiguous_) {
+            index = offset;
+            return offset < count_;
+        }
+        if (!dense_.empty()) {
+            if (offset >= dense_.size() || dense_[offset] == MISSING) {
+                return false;
+            }
+            index = dense_[offset];
+            return true;
+        }
+        const auto it = std::lower_bound(sorted_.begin(), sorted_.end(), std::make_pair(tag, uint64_t(0)));
+        if (it == sorted_.end() || it->first != tag) {
+            return false;
+        }
+        index = it->second;
+        return true;
+    }
+
+private:
+    static constexpr uint64_t MISSING = std::numeric_limits<uint64_t>::max();
+    size_t count_ = 0;                                  // Number of nodes
+    uint64_t firstTag_ = 0;                             // Smallest node tag
+    bool contiguous_ = false;                           // Whether tags are firstTag_, firstTag_ + 1, ...
+    std::vector<uint64_t> dense_;                       // tag - firstTag_ -> index (MISSING for holes)
+    std::vector<std::pair<uint64_t, uint64_t>> sorted_; // (tag, index) sorted by tag
+};
+
+/**
+ * @brief Re-entrant MSH 2.2/4.1 parser (ASCII and binary) over an in-memory file
+ * Sections are walked in file order; large ASCII sections and binary blocks are parsed in
+ * parallel chunks. Element connectivity keeps Gmsh node tags until every node is known and is
+ * resolved to point indices in finish(). Malformed input throws std::runtime_error.
+ */
+template<typename Real, typename Index>
+class GmshParser {
+public:
+    GmshParser(const char* data, size_t size, unsigned int threads) : text_(data, size), threads_(threads) {}
+
+    bool isVersion4() const { return version4_; }           // Whether the file is MSH 4.1
+    const std::string& version() const { return version_; } // $MeshFormat version string
+
+    /**
+     * @brief Parse the whole file
+     * @param[out] meshData Output mesh data (points, cells, physical groups)
+     */
+    void parse(BasicMeshData<Real, Index>& meshData) {
+        std::string_view line;
+        while (text_.nextLine(line)) {
+            line = TextTokenizer::trim(line);
+            if (line.size() < 2 || line[0] != '$') {
+                continue;
+            }
+            const std::string_view section = line.substr(1);
+            if (section == "NOD" || section == "ELM") {
+                throw GmshVersionError("Gmsh MSH 1 files are not supported");
+            }
+            if (section != "MeshFormat" && version_.empty()) {
+                throw std::runtime_error("file does not start with a $MeshFormat section");
+            }
+            if (section == "MeshFormat") {
+                parseMeshFormat();
+            } else if (section == "PhysicalNames") {
+                parsePhysicalNames(meshData.metadata);
+            } else if (section == "Entities" && version4_) {
+                parseEntities();
+            } else if (section == "Nodes") {
+                version4_ ? parseNodes4() : parseNodes2();
+            } else if (section == "Elements") {
+                version4_ ? parseElements4() : parseElements2();
+            }
+            skipSection(section);
+        }
+        if (version_.empty()) {
+            throw std::runtime_error("missing $MeshFormat section");
+        }
+        finish(meshData);
+    }
+
+private:
+    // ----- input helpers -----
+
+    // Next non-empty line as a tokenizer
+    TextTokenizer nextTokens() {
+        std::string_view line;
+        while (text_.nextLine(line)) {
+            if (!TextTokenizer::trim(line).empty()) {
+                return TextTokenizer(line);
+            }
+        }
+        throw std::runtime_error("unexpected end of file");
+    }
+
+    template<typename T>
+    static T expect(TextTokenizer& tokens) {
+        T value;
+        if (!tokens.next(value)) {
+            throw std::runtime_error("invalid section header");
+        }
+        return value;
+    }
+
+    // Pointer to the next bytes of a binary section
+    const char* take(size_t bytes) {
+        if (bytes > text_.size() - text_.position()) {
+            throw std::runtime_error("unexpected end of file in binary section");
+        }
+        const char* data = text_.current();
+        text_.skip(bytes);
+        return data;
+    }
+
+    template<typename T>
+    static T load(const char* data) {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return value;
+    }
+
+    template<typename T>
+    T readBinary() {
+        return load<T>(take(sizeof(T)));
+    }
+
+    // size_t of the writing machine (MSH 4.1 binary counts and tags)
+    uint64_t loadSize(const char* data) const {
+        return dataSize_ == 4 ? load<uint32_t>(data) : load<uint64_t>(data);
+    }
+
+    uint64_t readSize() {
+        return loadSize(take(dataSize_));
+    }
+
+    // Advance over the next count lines and return them as one block
+    std::string_view takeLines(uint64_t count) {
+        const char* blockBegin = text_.current();
+        std::string_view skipped;
+        for (uint64_t i = 0; i < count; ++i) {
+            if (!text_.nextLine(skipped)) {
+                throw std::runtime_error("unexpected end of file");
+            }
+        }
+        return std::string_view(blockBegin, static_cast<size_t>(text_.current() - blockBegin));
+    }
+
+    // Move past the "$End<section>" line
+    void skipSection(std::string_view section) {
+        const std::string endTag = "$End" + std::string(section);
+        const std::string_view rest = text_.rest();
+        const size_t endPos = rest.find(endTag);
+        if (endPos == std::string_view::npos) {
+            throw std::runtime_error("missing " + endTag);
+        }
+        text_.skip(endPos + endTag.size());
+        std::string_view remainder;
+        text_.nextLine(remainder);
+    }
+
+    // ----- sections -----
+
+    void parseMeshFormat() {
+        TextTokenizer tokens = nextTokens();
+        std::string_view versionToken;
+        tokens.nextToken(versionToken);
+        version_ = std::string(versionToken);
+        const int fileType = expect<int>(tokens);
+        dataSize_ = expect<int>(tokens);
+
+        if (versionToken.substr(0, 2) == "2." || versionToken == "2") {
+            version4_ = false;
+        } else if (versionToken.substr(0, 3) == "4.1") {
+            version4_ = true;
+        } else {
+            throw GmshVersionError("Gmsh MSH " + version_ + " is not supported (use MSH 2.2 or 4.1)");
+        }
+        if (dataSize_ != 4 && dataSize_ != 8) {
+            throw std::runtime_error("invalid data size " + std::to_string(dataSize_));
+        }
+
+        binary_ = fileType == 1;
+        if (binary_) {
+            // A binary 1 tells the byte order of the writing machine
+            if (readBinary<int32_t>() != 1) {
+                throw std::runtime_error("binary Gmsh file uses a foreign byte order");
+            }
+        }
+    }
+
+    void parsePhysicalNames(MeshMetadata& metadata) {
+        TextTokenizer header = nextTokens();
+        const uint64_t count = expect<uint64_t>(header);
+        for (uint64_t i = 0; i < count; ++i) {
+            TextTokenizer tokens = nextTokens();
+            expect<int>(tokens); // dimension
+            const int tag = expect<int>(tokens);
+            const std::string_view rest = tokens.rest();
+            const size_t open = rest.find('"');
+            const size_t close = open == std::string_view::npos ? open : rest.find('"', open + 1);
+            metadata.physicalRegionTags.push_back(tag);
+            metadata.physicalRegions.emplace_back(close == std::string_view::npos
+                ? TextTokenizer::trim(rest) : rest.substr(open + 1, close - open - 1));
+        }
+    }
+
+    // Physical group of every entity (first physical tag)
+    void parseEntities() {
+        uint64_t counts[4];
+        if (binary_) {
+            for (uint64_t& count : counts) {
+                count = readSize();
+            }
+        } else {
+            TextTokenizer header = nextTokens();
+            for (uint64_t& count : counts) {
+                count = expect<uint64_t>(header);
+            }
+        }
+        for (int dim = 0; dim < 4; ++dim) {
+            // Points store one coordinate triple, curves/surfaces/volumes a bounding box
+            const int coordinates = dim == 0 ? 3 : 6;
+            for (uint64_t i = 0; i < counts[dim]; ++i) {
+                int tag;
+                int physical = 0;
+                if (binary_) {
+                    tag = readBinary<int32_t>();
+                    take(coordinates * sizeof(double));
+                    const uint64_t physicalCount = readSize();
+                    const char* physicalTags = take(physicalCount * sizeof(int32_t));
+                    if (physicalCount > 0) {
+                        physical = load<int32_t>(physicalTags);
+                    }
+                    if (dim > 0) {
+                        take(readSize() * sizeof(int32_t));
+                    }
+                } else {
+                    TextTokenizer tokens = nextTokens();
+                    tag = expect<int>(tokens);
+                    for (int k = 0; k < coordinates; ++k) {
+                        expect<double>(tokens);
+                    }
+                    if (expect<uint64_t>(tokens) > 0) {
+                        physical = expect<int>(tokens);
+                    }
+                }
+                if (physical != 0) {
+                    entityPhysical_[{dim, tag}] = physical;
+                }
+            }
+        }
+    }
+
+    // Parse line-aligned node text in parallel chunks and append it to the node arrays
+    template<typename ChunkFn>
+    void parseNodeText(std::string_view block, ChunkFn&& parseChunk) {
+        const std::vector<std::string_view> chunkTexts = splitAtLines(block, parallelChunkCount(block.size(), threads_));
+        std::vector<std::vector<uint64_t>> chunkTags(chunkTexts.size());
+        std::vector<std::vector<Real>> chunkPoints(chunkTexts.size());
+        runParallel(chunkTexts.size(), [&](size_t i) {
+            parseChunk(chunkTexts[i], chunkTags[i], chunkPoints[i]);
+        });
+        std::vector<std::vector<uint64_t>*> tagParts;
+        std::vector<std::vector<Real>*> pointParts;
+        for (size_t i = 0; i < chunkTexts.size(); ++i) {
+            tagParts.push_back(&chunkTags[i]);
+            pointParts.push_back(&chunkPoints[i]);
+        }
+        concatenatePoints(tagParts, tags_);
+        concatenatePoints(pointParts, points_);
+    }
+
+    // Convert count binary node records: tag at tagAt(i), coordinates at coordAt(i)
+    template<typename TagFn, typename CoordFn>
+    void addBinaryNodes(uint64_t count, TagFn&& tagAt, CoordFn&& coordAt) {
+        const size_t tagBase = tags_.size();
+        tags_.resize(tagBase + count);
+        points_.resize((tagBase + count) * 3);
+        parallelForRanges(count, parallelTaskCount(count, GMSH_BINARY_RECORDS_PER_TASK, threads_),
+            [&](size_t begin, size_t end, size_t) {
+                for (size_t i = begin; i < end; ++i) {
+                    tags_[tagBase + i] = tagAt(i);
+                    const char* xyz = coordAt(i);
+                    Real* point = points_.data() + (tagBase + i) * 3;
+                    point[0] = static_cast<Real>(load<double>(xyz));
+                    point[1] = static_cast<Real>(load<double>(xyz + sizeof(double)));
+                    point[2] = static_cast<Real>(load<double>(xyz + 2 * sizeof(double)));
+                }
+            });
+    }
+
+    void parseNodes2() {
+        TextTokenizer header = nextTokens();
+        const uint64_t count = expect<uint64_t>(header);
+        if (binary_) {
+            // int32 tag followed by three doubles
+            const size_t recordBytes = sizeof(int32_t) + 3 * sizeof(double);
+            const char* records = take(count * recordBytes);
+            addBinaryNodes(count,
+                [&](size_t i) { return static_cast<uint64_t>(load<int32_t>(records + i * recordBytes)); },
+                [&](size_t i) { return records + i * recordBytes + sizeof(int32_t); });
+            return;
+        }
+        parseNodeText(takeLines(count), [](std::string_view chunk, std::vector<uint64_t>& tags, std::vector<Real>& points) {
+            MeshTextParser::parseGmshNodes(chunk, tags, points);
+        });
+    }
+
+    void parseNodes4() {
+        uint64_t blockCount;
+        if (binary_) {
+            blockCount = readSize();
+            const uint64_t nodeCount = readSize();
+            take(2 * dataSize_); // min/max node tag
+            tags_.reserve(nodeCount);
+            points_.reserve(nodeCount * 3);
+        } else {
+            TextTokenizer header = nextTokens();
+            blockCount = expect<uint64_t>(header);
+            const uint64_t nodeCount = expect<uint64_t>(header);
+            tags_.reserve(nodeCount);
+            points_.reserve(nodeCount * 3);
+        }
+
+        for (uint64_t block = 0; block < blockCount; ++block) {
+            if (binary_) {
+                const int32_t entityDim = readBinary<int32_t>();
+                readBinary<int32_t>(); // entity tag
+                const int32_t parametric = readBinary<int32_t>();
+                const uint64_t count = readSize();
+                // Parametric nodes carry one extra coordinate per entity dimension
+                const size_t coordBytes = (3 + (parametric ? entityDim : 0)) * sizeof(double);
+                const char* tagData = take(count * dataSize_);
+                const char* coordData = take(count * coordBytes);
+                addBinaryNodes(count,
+                    [&](size_t i) { return loadSize(tagData + i * dataSize_); },
+                    [&](size_t i) { return coordData + i * coordBytes; });
+            } else {
+                TextTokenizer header = nextTokens();
+                expect<int>(header); // entity dimension
+                expect<int>(header); // entity tag
+                expect<int>(header); // parametric
+                const uint64_t count = expect<uint64_t>(header);
+                const std::string_view tagText = takeLines(count);
+                const std::string_view coordText = takeLines(count);
+                parseNodeText(tagText, [](std::string_view chunk, std::vector<uint64_t>& tags, std::vector<Real>&) {
+                    MeshTextParser::parseGmshNodeTags(chunk, tags);
+                });
+                parseNodeText(coordText, [](std::string_view chunk, std::vector<uint64_t>&, std::vector<Real>& points) {
+                    MeshTextParser::parseGmshCoordinates(chunk, points);
+                });
+            }
+        }
+    }
+
+    // Parse line-aligned element text in parallel chunks
+    template<typename ChunkFn>
+    void parseElementText(std::string_view block, ChunkFn&& parseChunk) {
+        const std::vector<std::string_view> chunkTexts = splitAtLines(block, parallelChunkCount(block.size(), threads_));
+        const size_t first = elementChunks_.size();
+        elementChunks_.resize(first + chunkTexts.size());
+        runParallel(chunkTexts.size(), [&](size_t i) {
+            parseChunk(chunkTexts[i], elementChunks_[first + i]);
+        });
+        for (size_t i = first; i < elementChunks_.size(); ++i) {
+            if (!elementChunks_[i].error.empty()) {
+                throw std::runtime_error(elementChunks_[i].error);
+            }
+        }
+    }
+
+    // Convert count binary element records; readRecord(i, nodeTags, physical, entity) decodes record i
+    template<typename RecordFn>
+    void addBinaryElements(uint64_t count, const GmshElementInfo& info, RecordFn&& readRecord) {
+        if (count == 0) {
+            return;
+        }
+        const size_t taskCount = parallelTaskCount(count, GMSH_BINARY_RECORDS_PER_TASK, threads_);
+        const size_t first = elementChunks_.size();
+        elementChunks_.resize(first + taskCount);
+        parallelForRanges(count, taskCount, [&](size_t begin, size_t end, size_t task) {
+            MeshTextParser::GmshElementChunk& chunk = elementChunks_[first + task];
+            chunk.cells.reserve(end - begin, (end - begin) * static_cast<size_t>(info.cornerCount));
+            chunk.physicalTags.reserve(end - begin);
+            chunk.entityTags.reserve(end - begin);
+            uint64_t nodeTags[64];
+            for (size_t i = begin; i < end; ++i) {
+                int32_t physical = 0;
+                int32_t entity = 0;
+                readRecord(i, nodeTags, physical, entity);
+                chunk.cells.addCell(info.cellType, nodeTags, static_cast<size_t>(info.cornerCount));
+                chunk.physicalTags.push_back(physical);
+                chunk.entityTags.push_back(entity);
+            }
+        });
+    }
+
+    static GmshElementInfo binaryElementInfo(int gmshType) {
+        const GmshElementInfo info = gmshElementInfo(gmshType);
+        if (info.nodeCount == 0) {
+            // Record sizes of unknown types cannot be told, so the section cannot be skipped
+            throw std::runtime_error("unsupported element type " + std::to_string(gmshType) + " in binary Gmsh file");
+        }
+        return info;
+    }
+
+    void parseElements2() {
+        TextTokenizer header = nextTokens();
+        const uint64_t count = expect<uint64_t>(header);
+        if (!binary_) {
+            parseElementText(takeLines(count), [](std::string_view chunk, MeshTextParser::GmshElementChunk& result) {
+                MeshTextParser::parseGmshElements(chunk, result);
+            });
+            return;
+        }
+
+        // Blocks of elements of one type: int32 header (type, count, tag count), then int32 records
+        for (uint64_t parsed = 0; parsed < count;) {
+            const int32_t gmshType = readBinary<int32_t>();
+            const int32_t blockCount = readBinary<int32_t>();
+            const int32_t tagCount = readBinary<int32_t>();
+            if (blockCount <= 0 || tagCount < 0) {
+                throw std::runtime_error("invalid binary element block header");
+            }
+            const GmshElementInfo info = binaryElementInfo(gmshType);
+            const size_t recordBytes = (1 + static_cast<size_t>(tagCount) + info.nodeCount) * sizeof(int32_t);
+            const char* records = take(static_cast<size_t>(blockCount) * recordBytes);
+            addBinaryElements(static_cast<uint64_t>(blockCount), info,
+                [&](size_t i, uint64_t* nodeTags, int32_t& physical, int32_t& entity) {
+                    const char* record = records + i * recordBytes + sizeof(int32_t);
+                    physical = tagCount > 0 ? load<int32_t>(record) : 0;
+                    entity = tagCount > 1 ? load<int32_t>(record + sizeof(int32_t)) : 0;
+                    const char* nodes = record + tagCount * sizeof(int32_t);
+                    for (int k = 0; k < info.cornerCount; ++k) {
+                        nodeTags[k] = static_cast<uint64_t>(load<int32_t>(nodes + k * sizeof(int32_t)));
+                    }
+                });
+            parsed += static_cast<uint64_t>(blockCount);
+        }
+    }
+
+    void parseElements4() {
+        uint64_t blockCount;
+        if (binary_) {
+            blockCount = readSize();
+            take(3 * dataSize_); // element count, min/max element tag
+        } else {
+            TextTokenizer header = nextTokens();
+            blockCount = expect<uint64_t>(header);
+        }
+
+        for (uint64_t block = 0; block < blockCount; ++block) {
+            int entityDim;
+            int entityTag;
+            int gmshType;
+            uint64_t count;
+            if (binary_) {
+                entityDim = readBinary<int32_t>();
+                entityTag = readBinary<int32_t>();
+                gmshType = readBinary<int32_t>();
+                count = readSize();
+            } else {
+                TextTokenizer header = nextTokens();
+                entityDim = expect<int>(header);
+                entityTag = expect<int>(header);
+                gmshType = expect<int>(header);
+                count = expect<uint64_t>(header);
+            }
+            const auto physicalIt = entityPhysical_.find({entityDim, entityTag});
+            const int physical = physicalIt == entityPhysical_.end() ? 0 : physicalIt->second;
+
+            if (!binary_) {
+                const std::string_view blockText = takeLines(count);
+                if (gmshElementInfo(gmshType).nodeCount == 0) {
+                    continue;
+                }
+                parseElementText(blockText, [&](std::string_view chunk, MeshTextParser::GmshElementChunk& result) {
+                    MeshTextParser::parseGmshElementBlock(chunk, gmshType, entityTag, physical, result);
+                });
+                continue;
+            }
+
+            // size_t element tag followed by size_t node tags
+            const GmshElementInfo info = binaryElementInfo(gmshType);
+            const size_t recordBytes = (1 + static_cast<size_t>(info.nodeCount)) * dataSize_;
+            const char* records = take(count * recordBytes);
+            addBinaryElements(count, info,
+                [&](size_t i, uint64_t* nodeTags, int32_t& elementPhysical, int32_t& entity) {
+                    const char* nodes = records + i * recordBytes + dataSize_;
+                    elementPhysical = physical;
+                    entity = entityTag;
+                    for (int k = 0; k < info.cornerCount; ++k) {
+                        nodeTags[k] = loadSize(nodes + k * dataSize_);
+                    }
+                });
+        }
+    }
+
+    // ----- assembly -----
+
+    void finish(BasicMeshData<Real, Index>& meshData) {
+        if (points_.size() != tags_.size() * 3) {
+            throw std::runtime_error("malformed node section");
+        }
+        if (tags_.size() > static_cast<size_t>(std::numeric_limits<Index>::max())) {
+            throw std::length_error("node count exceeds the range of the index type");
+        }
+        const GmshNodeIndex nodeIndex(tags_);
+        meshData.points = std::move(points_);
+        std::vector<uint64_t>().swap(tags_);
+
+        // Prefix sums over the element chunks, then resolve node tags chunk by chunk
+        std::vector<size_t> cellBase(elementChunks_.size() + 1, 0);
+        std::vector<size_t> connectivityBase(elementChunks_.size() + 1, 0);
+        for (size_t i = 0; i < elementChunks_.size(); ++i) {
+            cellBase[i + 1] = cellBase[i] + elementChunks_[i].cells.size();
+            connectivityBase[i + 1] = connectivityBase[i] + elementChunks_[i].cells.connectivitySize();
+        }
+        if (connectivityBase.back() > std::numeric_limits<Index>::max()) {
+            throw std::length_error("cell connectivity exceeds the offset range of the index type");
+        }
+        BasicCellArray<Index>& cells = meshData.cells;
+        cells.types.resize(cellBase.back());
+        cells.offsets.resize(cellBase.back() + 1);
+        cells.connectivity.resize(connectivityBase.back());
+        std::vector<int32_t> physicalTags(cellBase.back());
+        std::vector<int32_t> entityTags(cellBase.back());
+        std::vector<char> hasPhysical(elementChunks_.size(), 0);
+
+        parallelForRanges(elementChunks_.size(), parallelTaskCount(elementChunks_.size(), 1, threads_),
+            [&](size_t begin, size_t end, size_t) {
+                for (size_t c = begin; c < end; ++c) {
+                    MeshTextParser::GmshElementChunk& chunk = elementChunks_[c];
+                    std::copy(chunk.cells.types.begin(), chunk.cells.types.end(), cells.types.begin() + cellBase[c]);
+                    std::copy(chunk.physicalTags.begin(), chunk.physicalTags.end(), physicalTags.begin() + cellBase[c]);
+                    std::copy(chunk.entityTags.begin(), chunk.entityTags.end(), entityTags.begin() + cellBase[c]);
+                    hasPhysical[c] = std::any_of(chunk.physicalTags.begin(), chunk.physicalTags.end(),
+                                                 [](int32_t tag) { return tag != 0; });
+                    Index* offsets = cells.offsets.data() + cellBase[c] + 1;
+                    for (size_t j = 0; j < chunk.cells.size(); ++j) {
+                        offsets[j] = static_cast<Index>(connectivityBase[c] + chunk.cells.offsets[j + 1]);
+                    }
+                    Index* connectivity = cells.connectivity.data() + connectivityBase[c];
+                    for (size_t j = 0; j < chunk.cells.connectivity.size(); ++j) {
+                        uint64_t index;
+                        if (!nodeIndex.find(chunk.cells.connectivity[j], index)) {
+                            throw std::runtime_error("element references undefined node " +
+                                                     std::to_string(chunk.cells.connectivity[j]));
+                        }
+                        connectivity[j] = static_cast<Index>(index);
+                    }
+                    chunk = MeshTextParser::GmshElementChunk();
+                }
+            });
+        elementChunks_.clear();
+
+        // Physical groups travel as cell data so writers can preserve them
+        if (std::any_of(hasPhysical.begin(), hasPhysical.end(), [](char flag) { return flag != 0; })) {
+            meshData.cellData["gmsh:physical"] = MeshAttribute(std::move(physicalTags));
+            meshData.cellData["gmsh:geometrical"] = MeshAttribute(std::move(entityTags));
+        }
+    }
+
+    TextTokenizer text_;                  // Whole file
+    unsigned int threads_;                // Worker threads (0 = hardware concurrency)
+    std::string version_;                 // $MeshFormat version
+    bool version4_ = false;               // MSH 4.1 layout
+    bool binary_ = false;                 // Binary sections
+    size_t dataSize_ = 8;                 // sizeof(size_t) of the writing machine
+    std::map<std::pair<int, int>, int> entityPhysical_; // (dim, entity tag) -> physical tag (MSH 4.1)
+    std::vector<uint64_t> tags_;          // Node tags in file order
+    std::vector<Real> points_;            // Node coordinates in file order
+    std::vector<MeshTextParser::GmshElementChunk> elementChunks_; // Parsed elements in file order
+};
+
+#ifdef HAVE_CGNS
+// Minimum points/elements per task when converting one CGNS zone
+constexpr size_t CGNS_ITEMS_PER_TASK = 64 * 1024;
+
+/**
+ * @brief Raw arrays of one CGNS zone, bulk-read while the CGNS library lock is held
+ */
+template<typename Real>
+struct CgnsZoneArrays {
+    /**
+     * @brief One element section (connectivity as stored in the file, 1-based)
+     */
+    struct Section {
+        ElementType_t type = ElementTypeNull;
+        cgsize_t start = 0;               // First element number
+        cgsize_t elementCount = 0;        // Number of elements
+        int nodesPerElement = 0;          // Nodes per element (0 for MIXED/NGON_n/NFACE_n)
+        std::vector<cgsize_t> elements;   // Node numbers (MIXED: type code before each element)
+        std::vector<cgsize_t> offsets;    // Start of each element in elements (MIXED/NGON_n/NFACE_n)
+    };
+
+    /**
+     * @brief One solution field
+     */
+    struct Field {
+        std::string name;                 // Field name
+        bool cellCentered = false;        // GridLocation CellCenter (false = Vertex)
+        MeshAttribute values;             // Values in file order
+    };
+
+    std::string name;                     // Zone name
+    bool structured = false;              // Structured zone (cells are implied by the index space)
+    int indexDimension = 1;               // Index dimension (unstructured: 1)
+    cgsize_t vertexDims[3] = {1, 1, 1};   // Vertices per index direction
+    cgsize_t cellDims[3] = {1, 1, 1};     // Cells per index direction
+    std::vector<Real> coordinates[3];     // CoordinateX/Y/Z (missing axes stay empty)
+    std::vector<Section> sections;        // Element sections (unstructured zones)
+    std::vector<Field> fields;            // Vertex and cell-centered solution fields
+};
+
+/**
+ * @brief Bulk-read the coordinates, sections and solution fields of one zone
+ * The caller holds the CGNS library lock; nothing is converted here.
+ * @param file CGNS file id
+ * @param base Base index (1-based)
+ * @param zone Zone index (1-based)
+ * @param[out] arrays Raw zone arrays
+ */
+template<typename Real>
+void readCgnsZoneArrays(int file, int base, int zone, CgnsZoneArrays<Real>& arrays) {
+    char name[33] = {0};
+    cgsize_t size[9] = {0};
+    ZoneType_t zoneType = ZoneTypeNull;
+    cgnsCheck(cg_zone_read(file, base, zone, name, size), "Failed to read CGNS zone");
+    cgnsCheck(cg_zone_type(file, base, zone, &zoneType), "Failed to read CGNS zone type");
+    cgnsCheck(cg_index_dim(file, base, zone, &arrays.indexDimension), "Failed to read CGNS zone index dimension");
+    arrays.name = name;
+    arrays.structured = zoneType == Structured;
+    if (!arrays.structured && zoneType != Unstructured) {
+        throw std::runtime_error("Zone " + arrays.name + " has an unsupported zone type");
+    }
+    if (arrays.structured) {
+        if (arrays.indexDimension < 1 || arrays.indexDimension > 3) {
+            throw std::runtime_error("Zone " + arrays.name + " has an unsupported index dimension");
+        }
+        for (int d = 0; d < arrays.indexDimension; ++d) {
+            arrays.vertexDims[d] = size[d];
+            arrays.cellDims[d] = size[d + arrays.indexDimension];
+        }
+    } else {
+        arrays.indexDimension = 1;
+        arrays.vertexDims[0] = size[0];
+        arrays.cellDims[0] = size[1];
+    }
+    const size_t vertexCount = static_cast<size_t>(arrays.vertexDims[0] * arrays.vertexDims[1] * arrays.vertexDims[2]);
+    const size_t cellCount = static_cast<size_t>(arrays.cellDims[0] * arrays.cellDims[1] * arrays.cellDims[2]);
+    const cgsize_t rangeMin[3] = {1, 1, 1};
+
+    // Cartesian coordinates, converted to Real by the library
+    const DataType_t realType = std::is_same_v<Real, double> ? RealDouble : RealSingle;
+    static const char* const AXIS_NAMES[3] = {"CoordinateX", "CoordinateY", "CoordinateZ"};
+    for (int axis = 0; axis < 3; ++axis) {
+        int coordCount = 0;
+        cgnsCheck(cg_ncoords(file, base, zone, &coordCount), "Failed to read CGNS coordinate count");
+        for (int c = 1; c <= coordCount; ++c) {
+            char coordName[33] = {0};
+            DataType_t dataType = DataTypeNull;
+            cgnsCheck(cg_coord_info(file, base, zone, c, &dataType, coordName), "Failed to read CGNS coordinate info");
+            if (std::strcmp(coordName, AXIS_NAMES[axis]) == 0) {
+                arrays.coordinates[axis].resize(vertexCount);
+                cgnsCheck(cg_coord_read(file, base, zone, coordName, realType, rangeMin, arrays.vertexDims,
+                                        arrays.coordinates[axis].data()), "Failed to read CGNS coordinates");
+                break;
+            }
+        }
+    }
+    if (arrays.coordinates[0].size() != vertexCount) {
+        throw std::runtime_error("Zone " + arrays.name + " has no Cartesian coordinates");
+    }
+
+    // Element sections as stored (fixed-size types at their node count, MIXED/NGON_n with offsets)
+    if (!arrays.structured) {
+        int sectionCount = 0;
+        cgnsCheck(cg_nsections(file, base, zone, &sectionCount), "Failed to read CGNS section count");
+        arrays.sections.resize(sectionCount);
+        for (int s = 1; s <= sectionCount; ++s) {
+            typename CgnsZoneArrays<Real>::Section& section = arrays.sections[s - 1];
+            char sectionName[33] = {0};
+            cgsize_t end = 0;
+            int boundaryCount = 0;
+            int parentFlag = 0;
+            cgsize_t dataSize = 0;
+            cgnsCheck(cg_section_read(file, base, zone, s, sectionName, &section.type, &section.start, &end,
+                                      &boundaryCount, &parentFlag), "Failed to read CGNS section");
+            cgnsCheck(cg_ElementDataSize(file, base, zone, s, &dataSize), "Failed to read CGNS section size");
+            section.elementCount = end - section.start + 1;
+            section.elements.resize(static_cast<size_t>(dataSize));
+            if (section.type == MIXED || section.type == NGON_n || section.type == NFACE_n) {
+                section.offsets.resize(static_cast<size_t>(section.elementCount) + 1);
+                cgnsCheck(cg_poly_elements_read(file, base, zone, s, section.elements.data(), section.offsets.data(), nullptr),
+                          "Failed to read CGNS section elements");
+            } else {
+                cgnsCheck(cg_npe(section.type, &section.nodesPerElement), "Failed to read CGNS element node count");
+                cgnsCheck(cg_elements_read(file, base, zone, s, section.elements.data(), nullptr),
+                          "Failed to read CGNS section elements");
+            }
+        }
+    }
+
+    // Numeric vertex and cell-centered fields of every FlowSolution (first occurrence of a name wins)
+    int solutionCount = 0;
+    cgnsCheck(cg_nsols(file, base, zone, &solutionCount), "Failed to read CGNS solution count");
+    for (int s = 1; s <= solutionCount; ++s) {
+        char solutionName[33] = {0};
+        GridLocation_t location = GridLocationNull;
+        cgnsCheck(cg_sol_info(file, base, zone, s, solutionName, &location), "Failed to read CGNS solution info");
+        if (location != Vertex && location != CellCenter) {
+            continue;
+        }
+        int fieldCount = 0;
+        cgnsCheck(cg_nfields(file, base, zone, s, &fieldCount), "Failed to read CGNS field count");
+        for (int f = 1; f <= fieldCount; ++f) {
+            char fieldName[33] = {0};
+            DataType_t dataType = DataTypeNull;
+            AttributeType type = AttributeType::FLOAT32;
+            cgnsCheck(cg_field_info(file, base, zone, s, f, &dataType, fieldName), "Failed to read CGNS field info");
+            const bool cellCentered = location == CellCenter;
+            const bool duplicate = std::any_of(arrays.fields.begin(), arrays.fields.end(),
+                [&](const typename CgnsZoneArrays<Real>::Field& field) {
+                    return field.cellCentered == cellCentered && field.name == fieldName;
+                });
+            if (duplicate || !cgnsAttributeType(dataType, type)) {
+                continue;
+            }
+            typename CgnsZoneArrays<Real>::Field field;
+            field.name = fieldName;
+            field.cellCentered = cellCentered;
+            field.values = MeshAttribute(type, 1, cellCentered ? cellCount : vertexCount);
+            cgnsCheck(cg_field_read(file, base, zone, s, fieldName, dataType, rangeMin,
+                                    cellCentered ? arrays.cellDims : arrays.vertexDims, field.values.data()),
+                      "Failed to read CGNS field");
+            arrays.fields.push_back(std::move(field));
+        }
+    }
+}
+
+/**
+ * @brief Build the cells of a structured zone (lines, quads or hexahedra over the index space)
+ * @param arrays Raw zone arrays
+ * @param[out] cells Output cells (i fastest, as CellCenter fields are stored)
+ * @param threads Worker threads
+ */
+template<typename Real, typename Index>
+void buildStructuredCgnsCells(const CgnsZoneArrays<Real>& arrays, BasicCellArray<Index>& cells, unsigned int threads) {
+    static const VtkCellType CELL_TYPES[3] = {VtkCellType::LINE, VtkCellType::QUAD, VtkCellType::HEXAHEDRON};
+    const int dimension = arrays.indexDimension;
+    const size_t corners = size_t(1) << dimension;
+    const size_t ni = static_cast<size_t>(arrays.vertexDims[0]);
+    const size_t nj = static_cast<size_t>(arrays.vertexDims[1]);
+    const size_t ci = static_cast<size_t>(arrays.cellDims[0]);
+    const size_t cj = static_cast<size_t>(arrays.cellDims[1]);
+    const size_t cellCount = ci * cj * static_cast<size_t>(arrays.cellDims[2]);
+
+    cells.types.assign(cellCount, CELL_TYPES[dimension - 1]);
+    cells.offsets.resize(cellCount + 1);
+    cells.connectivity.resize(cellCount * corners);
+    parallelForRanges(cellCount, parallelTaskCount(cellCount, CGNS_ITEMS_PER_TASK, threads),
+        [&](size_t begin, size_t end, size_t) {
+            for (size_t c = begin; c < end; ++c) {
+                const size_t i = c % ci;
+                const size_t j = (c / ci) % cj;
+                const size_t k = c / (ci * cj);
+                auto vertex = [&](size_t di, size_t dj, size_t dk) {
+                    return static_cast<Index>((i + di) + ni * ((j + dj) + nj * (k + dk)));
+                };
+                Index* cell = cells.connectivity.data() + c * corners;
+                cells.offsets[c] = static_cast<Index>(c * corners);
+                cell[0] = vertex(0, 0, 0);
+                cell[1] = vertex(1, 0, 0);
+                if (dimension >= 2) {
+                    cell[2] = vertex(1, 1, 0);
+                    cell[3] = vertex(0, 1, 0);
+                }
+                if (dimension == 3) {
+                    cell[4] = vertex(0, 0, 1);
+                    cell[5] = vertex(1, 0, 1);
+                    cell[6] = vertex(1, 1, 1);
+                    cell[7] = vertex(0, 1, 1);
+                }
+            }
+        });
+    cells.offsets[cellCount] = static_cast<Index>(cellCount * corners);
+}
+
+/**
+ * @brief Build the cells of an unstructured zone from its element sections
+ * Higher-order elements keep their corner nodes; unknown element types are skipped.
+ * @param arrays Raw zone arrays
+ * @param[out] cells Output cells in section order
+ * @param[out] elementNumbers CGNS element number of each output cell
+ * @param threads Worker threads
+ */
+template<typename Real, typename Index>
+void buildUnstructuredCgnsCells(const CgnsZoneArrays<Real>& arrays, BasicCellArray<Index>& cells,
+                                std::vector<cgsize_t>& elementNumbers, unsigned int threads) {
+    using Section = typename CgnsZoneArrays<Real>::Section;
+    const cgsize_t vertexCount = arrays.vertexDims[0];
+
+    // Pass 1: cells and connectivity contributed by each section
+    std::vector<size_t> cellBase(arrays.sections.size() + 1, 0);
+    std::vector<size_t> connectivityBase(arrays.sections.size() + 1, 0);
+    for (size_t s = 0; s < arrays.sections.size(); ++s) {
+        const Section& section = arrays.sections[s];
+        size_t sectionCells = 0;
+        size_t sectionConnectivity = 0;
+        if (section.type == NFACE_n) {
+            throw std::runtime_error("Zone " + arrays.name + " has polyhedral (NFACE_n) cells, which are not supported");
+        } else if (section.type == NGON_n) {
+            sectionCells = static_cast<size_t>(section.elementCount);
+            sectionConnectivity = section.elements.size();
+        } else if (section.type == MIXED) {
+            for (cgsize_t e = 0; e < section.elementCount; ++e) {
+                const CgnsElementInfo info = cgnsElementInfo(static_cast<ElementType_t>(section.elements[section.offsets[e]]));
+                if (info.cornerCount > 0) {
+                    ++sectionCells;
+                    sectionConnectivity += static_cast<size_t>(info.cornerCount);
+                }
+            }
+        } else {
+            const CgnsElementInfo info = cgnsElementInfo(section.type);
+            if (info.cornerCount > 0) {
+                sectionCells = static_cast<size_t>(section.elementCount);
+                sectionConnectivity = sectionCells * static_cast<size_t>(info.cornerCount);
+            }
+        }
+        cellBase[s + 1] = cellBase[s] + sectionCells;
+        connectivityBase[s + 1] = connectivityBase[s] + sectionConnectivity;
+    }
+    if (connectivityBase.back() > static_cast<size_t>(std::numeric_limits<Index>::max())) {
+        throw std::runtime_error("Zone " + arrays.name + " exceeds the index range of the mesh layout");
+    }
+
+    // Pass 2: fill the flat arrays (fixed-size sections in parallel)
+    cells.types.resize(cellBase.back());
+    cells.offsets.resize(cellBase.back() + 1);
+    cells.connectivity.resize(connectivityBase.back());
+    elementNumbers.resize(cellBase.back());
+    auto nodeIndex = [&](cgsize_t node) {
+        if (node < 1 || node > vertexCount) {
+            throw std::runtime_error("Zone " + arrays.name + " has an element node outside the zone");
+        }
+        return static_cast<Index>(node - 1);
+    };
+    for (size_t s = 0; s < arrays.sections.size(); ++s) {
+        const Section& section = arrays.sections[s];
+        size_t cell = cellBase[s];
+        size_t slot = connectivityBase[s];
+        if (section.type == NGON_n || section.type == MIXED) {
+            for (cgsize_t e = 0; e < section.elementCount; ++e) {
+                const cgsize_t* element = section.elements.data() + section.offsets[e];
+                const cgsize_t* elementEnd = section.elements.data() + section.offsets[e + 1];
+                CgnsElementInfo info{VtkCellType::POLYGON, static_cast<int>(elementEnd - element), 2};
+                if (section.type == MIXED) {
+                    info = cgnsElementInfo(static_cast<ElementType_t>(*element++));
+                    if (info.cornerCount == 0) {
+                        continue;
+                    }
+                    if (elementEnd - element < info.cornerCount) {
+                        throw std::runtime_error("Zone " + arrays.name + " has a truncated MIXED element");
+                    }
+                }
+                cells.types[cell] = info.cellType;
+                cells.offsets[cell] = static_cast<Index>(slot);
+                elementNumbers[cell] = section.start + e;
+                for (int k = 0; k < info.cornerCount; ++k) {
+                    cells.connectivity[slot++] = nodeIndex(element[k]);
+                }
+                ++cell;
+            }
+            continue;
+        }
+        const CgnsElementInfo info = cgnsElementInfo(section.type);
+        if (info.cornerCount == 0 || cellBase[s + 1] == cellBase[s]) {
+            continue;
+        }
+        const size_t count = cellBase[s + 1] - cellBase[s];
+        const size_t stride = static_cast<size_t>(section.nodesPerElement);
+        const size_t corners = static_cast<size_t>(info.cornerCount);
+        if (section.elements.size() < count * stride || stride < corners) {
+            throw std::runtime_error("Zone " + arrays.name + " has a truncated element section");
+        }
+        parallelForRanges(count, parallelTaskCount(count, CGNS_ITEMS_PER_TASK, threads),
+            [&](size_t begin, size_t end, size_t) {
+                for (size_t e = begin; e < end; ++e) {
+                    const size_t c = cell + e;
+                    const cgsize_t* element = section.elements.data() + e * stride;
+                    cells.types[c] = info.cellType;
+                    cells.offsets[c] = static_cast<Index>(slot + e * corners);
+                    elementNumbers[c] = section.start + static_cast<cgsize_t>(e);
+                    for (size_t k = 0; k < corners; ++k) {
+                        cells.connectivity[slot + e * corners + k] = nodeIndex(element[k]);
+                    }
+                }
+            });
+    }
+    cells.offsets.back() = static_cast<Index>(connectivityBase.back());
+}
+
+/**
+ * @brief Convert the raw arrays of one zone into a mesh
+ * Coordinates are interleaved, cells built from the sections (or the structured index space) and
+ * fields attached; fields named <name>X/Y/Z become one 3-component attribute <name>.
+ * @param arrays Raw zone arrays (released while converting)
+ * @param[out] meshData Output mesh
+ * @param threads Worker threads
+ */
+template<typename Real, typename Index>
+void buildCgnsZone(CgnsZoneArrays<Real>& arrays, BasicMeshData<Real, Index>& meshData, unsigned int threads) {
+    using Field = typename CgnsZoneArrays<Real>::Field;
+    const size_t vertexCount = arrays.coordinates[0].size();
+    if (vertexCount > static_cast<size_t>(std::numeric_limits<Index>::max())) {
+        throw std::runtime_error("Zone " + arrays.name + " exceeds the index range of the mesh layout");
+    }
+
+    meshData.points.resize(vertexCount * 3);
+    parallelForRanges(vertexCount, parallelTaskCount(vertexCount, CGNS_ITEMS_PER_TASK, threads),
+        [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    meshData.points[i * 3 + axis] = arrays.coordinates[axis].empty() ? Real(0) : arrays.coordinates[axis][i];
+                }
+            }
+        });
+    for (std::vector<Real>& axis : arrays.coordinates) {
+        std::vector<Real>().swap(axis);
+    }
+
+    std::vector<cgsize_t> elementNumbers;
+    if (arrays.structured) {
+        buildStructuredCgnsCells(arrays, meshData.cells, threads);
+    } else {
+        buildUnstructuredCgnsCells(arrays, meshData.cells, elementNumbers, threads);
+    }
+    arrays.sections.clear();
+
+    // CellCenter fields cover element numbers 1..cellCount; other cells (e.g. boundary faces) get 0
+    const size_t cellCount = meshData.cells.size();
+    for (Field& field : arrays.fields) {
+        if (!field.cellCentered || arrays.structured) {
+            continue;
+        }
+        MeshAttribute remapped(field.values.type(), 1, cellCount);
+        field.values.visit([&](const auto& source) {
+            using T = typename std::decay_t<decltype(source)>::value_type;
+            std::vector<T>& target = remapped.values<T>();
+            for (size_t c = 0; c < cellCount; ++c) {
+                const cgsize_t number = elementNumbers[c];
+                target[c] = number >= 1 && static_cast<size_t>(number) <= source.size() ? source[number - 1] : T(0);
+            }
+        });
+        field.values = std::move(remapped);
+    }
+
+    // SIDS vector naming: <name>X, <name>Y, <name>Z of the same location and type form one vector
+    std::vector<bool> used(arrays.fields.size(), false);
+    auto findField = [&](const std::string& name, const Field& like) -> size_t {
+        for (size_t f = 0; f < arrays.fields.size(); ++f) {
+            const Field& other = arrays.fields[f];
+            if (!used[f] && other.name == name && other.cellCentered == like.cellCentered
+                && other.values.type() == like.values.type() && other.values.size() == like.values.size()) {
+                return f;
+            }
+        }
+        return arrays.fields.size();
+    };
+    for (size_t f = 0; f < arrays.fields.size(); ++f) {
+        if (used[f]) {
+            continue;
+        }
+        Field& field = arrays.fields[f];
+        AttributeMap& target = field.cellCentered ? meshData.cellData : meshData.pointData;
+        const std::string& name = field.name;
+        if (name.size() > 1 && name.back() == 'X') {
+            const std::string prefix = name.substr(0, name.size() - 1);
+            used[f] = true;
+            const size_t y = findField(prefix + "Y", field);
+            const size_t z = y < arrays.fields.size() ? findField(prefix + "Z", field) : arrays.fields.size();
+            if (z < arrays.fields.size()) {
+                used[y] = used[z] = true;
+                MeshAttribute vector(field.values.type(), 3, field.values.size());
+                field.values.visit([&](const auto& xs) {
+                    using T = typename std::decay_t<decltype(xs)>::value_type;
+                    const std::vector<T>& ys = arrays.fields[y].values.template values<T>();
+                    const std::vector<T>& zs = arrays.fields[z].values.template values<T>();
+                    std::vector<T>& out = vector.values<T>();
+                    for (size_t i = 0; i < xs.size(); ++i) {
+                        out[i * 3] = xs[i];
+                        out[i * 3 + 1] = ys[i];
+                        out[i * 3 + 2] = zs[i];
+                    }
+                });
+                target[prefix] = std::move(vector);
+                continue;
+            }
+        }
+        used[f] = true;
+        target[name] = std::move(field.values);
+    }
+    arrays.fields.clear();
+
+    meshData.calculateMetadata();
+    meshData.metadata.format = MeshFormat::CGNS;
+    meshData.metadata.blockName = arrays.name;
+}
+
+/**
+ * @brief Read the selected zones of one CGNS base, one mesh per zone
+ * Zones are handed to worker tasks one at a time. Each task bulk-reads its zone under the CGNS
+ * library lock (the library is not re-entrant) and converts it outside the lock, so conversion
+ * of one zone overlaps the reads of the next.
+ * @param filePath File path (UTF-8 encoded)
+ * @param options Read options (cgnsBase, cgnsZones, readThreads)
+ * @param[out] zones One mesh per selected zone
+ * @param[out] zoneIndices 0-based file zone index of each mesh
+ */
+template<typename Real, typename Index>
+void readCgnsZones(const std::string& filePath, const FormatReadOptions& options,
+                   std::vector<BasicMeshData<Real, Index>>& zones, std::vector<int>& zoneIndices) {
+    CgnsFile file(filePath, CG_MODE_READ);
+    const int base = options.cgnsBase + 1;
+    int zoneCount = 0;
+    {
+        std::lock_guard<std::recursive_mutex> lock(cgnsLibraryMutex());
+        int baseCount = 0;
+        cgnsCheck(cg_nbases(file.id(), &baseCount), "Failed to read CGNS base count");
+        if (base < 1 || base > baseCount) {
+            throw std::runtime_error("CGNS base " + std::to_string(options.cgnsBase) + " does not exist");
+        }
+        cgnsCheck(cg_nzones(file.id(), base, &zoneCount), "Failed to read CGNS zone count");
+    }
+
+    zoneIndices = options.cgnsZones;
+    if (zoneIndices.empty()) {
+        zoneIndices.resize(zoneCount);
+        std::iota(zoneIndices.begin(), zoneIndices.end(), 0);
+    }
+    for (int zone : zoneIndices) {
+        if (zone < 0 || zone >= zoneCount) {
+            throw std::runtime_error("CGNS zone " + std::to_string(zone) + " does not exist");
+        }
+    }
+    if (zoneIndices.empty()) {
+        throw std::runtime_error("CGNS base has no zones");
+    }
+
+    // Threads left over when there are fewer zones than workers go into the zone conversion
+    const size_t threadCount = options.readThreads ? options.readThreads : std::max(1u, std::thread::hardware_concurrency());
+    const size_t tasks = parallelTaskCount(zoneIndices.size(), 1, options.readThreads);
+    const unsigned int zoneThreads = static_cast<unsigned int>(std::max<size_t>(1, threadCount / tasks));
+    zones.clear();
+    zones.resize(zoneIndices.size());
+    std::atomic<size_t> nextZone{0};
+    runParallel(tasks, [&](size_t) {
+        for (size_t z = nextZone++; z < zoneIndices.size(); z = nextZone++) {
+            CgnsZoneArrays<Real> arrays;
+            {
+                std::lock_guard<std::recursive_mutex> lock(cgnsLibraryMutex());
+                readCgnsZoneArrays(file.id(), base, zoneIndices[z] + 1, arrays);
+            }
+            buildCgnsZone(arrays, zones[z], zoneThreads);
+        }
+    });
+}
+
+/**
+ * @brief Merge zone meshes into one mesh (points are not welded across zone interfaces)
+ * Attributes present in every zone with the same type and width are kept; with more than one
+ * zone the source zone of each cell is stored as INT32 cell data "cgns:zone".
+ * @param zones Zone meshes (released while merging)
+ * @param zoneIndices 0-based file zone index of each mesh
+ * @param[out] meshData Merged mesh
+ * @param threads Worker threads
+ */
+template<typename Real, typename Index>
+void mergeCgnsZones(std::vector<BasicMeshData<Real, Index>>& zones, const std::vector<int>& zoneIndices,
+                    BasicMeshData<Real, Index>& meshData, unsigned int threads) {
+    if (zones.size() == 1) {
+        meshData = std::move(zones[0]);
+        return;
+    }
+
+    std::vector<size_t> pointBase(zones.size() + 1, 0);
+    std::vector<size_t> cellBase(zones.size() + 1, 0);
+    std::vector<size_t> connectivityBase(zones.size() + 1, 0);
+    for (size_t z = 0; z < zones.size(); ++z) {
+        pointBase[z + 1] = pointBase[z] + zones[z].points.size() / 3;
+        cellBase[z + 1] = cellBase[z] + zones[z].cells.size();
+        connectivityBase[z + 1] = connectivityBase[z] + zones[z].cells.connectivitySize();
+    }
+    const size_t indexLimit = static_cast<size_t>(std::numeric_limits<Index>::max());
+    if (pointBase.back() > indexLimit || connectivityBase.back() > indexLimit) {
+        throw std::runtime_error("Merged zones exceed the index range of the mesh layout; read them per zone or into MeshData64");
+    }
+
+    // Attributes shared by every zone
+    auto sharedAttributes = [&](AttributeMap BasicMeshData<Real, Index>::*map, const std::vector<size_t>& tupleBase) {
+        AttributeMap merged;
+        for (const auto& [name, first] : zones[0].*map) {
+            const bool shared = std::all_of(zones.begin(), zones.end(), [&](const BasicMeshData<Real, Index>& zone) {
+                auto it = (zone.*map).find(name);
+                return it != (zone.*map).end() && it->second.type() == first.type() && it->second.components() == first.components();
+            });
+            if (shared) {
+                merged.emplace(name, MeshAttribute(first.type(), first.components(), tupleBase.back()));
+            }
+        }
+        return merged;
+    };
+    meshData.clear();
+    meshData.pointData = sharedAttributes(&BasicMeshData<Real, Index>::pointData, pointBase);
+    meshData.cellData = sharedAttributes(&BasicMeshData<Real, Index>::cellData, cellBase);
+    meshData.points.resize(pointBase.back() * 3);
+    meshData.cells.types.resize(cellBase.back());
+    meshData.cells.offsets.resize(cellBase.back() + 1);
+    meshData.cells.connectivity.resize(connectivityBase.back());
+    std::vector<int32_t> zoneTags(cellBase.back());
+
+    auto copyAttributes = [](AttributeMap& target, const AttributeMap& source, size_t tupleOffset) {
+        for (auto& [name, attribute] : target) {
+            const MeshAttribute& part = source.at(name);
+            const size_t bytes = part.size() * part.elementSize();
+            std::memcpy(static_cast<char*>(attribute.data()) + tupleOffset * attribute.components() * attribute.elementSize(),
+                        part.data(), bytes);
+        }
+    };
+    parallelForRanges(zones.size(), parallelTaskCount(zones.size(), 1, threads), [&](size_t begin, size_t end, size_t) {
+        for (size_t z = begin; z < end; ++z) {
+            BasicMeshData<Real, Index>& zone = zones[z];
+            std::copy(zone.points.begin(), zone.points.end(), meshData.points.begin() + pointBase[z] * 3);
+            std::copy(zone.cells.types.begin(), zone.cells.types.end(), meshData.cells.types.begin() + cellBase[z]);
+            const Index pointOffset = static_cast<Index>(pointBase[z]);
+            const Index connectivityOffset = static_cast<Index>(connectivityBase[z]);
+            for (size_t c = 0; c < zone.cells.size(); ++c) {
+                meshData.cells.offsets[cellBase[z] + c] = zone.cells.offsets[c] + connectivityOffset;
+            }
+            std::transform(zone.cells.connectivity.begin(), zone.cells.connectivity.end(),
+                           meshData.cells.connectivity.begin() + connectivityBase[z],
+                           [pointOffset](Index index) { return index + pointOffset; });
+            std::fill(zoneTags.begin() + cellBase[z], zoneTags.begin() + cellBase[z + 1], zoneIndices[z]);
+            copyAttributes(meshData.pointData, zone.pointData, pointBase[z]);
+            copyAttributes(meshData.cellData, zone.cellData, cellBase[z]);
+            zone = BasicMeshData<Real, Index>();
+        }
+    });
+    meshData.cells.offsets.back() = static_cast<Index>(connectivityBase.back());
+    meshData.cellData["cgns:zone"] = MeshAttribute(std::move(zoneTags));
+    meshData.calculateMetadata();
+    meshData.metadata.format = MeshFormat::CGNS;
+}
+#endif
+
+// Cells per task of the OpenFOAM face-to-cell assembly (smaller meshes are assembled serially)
+constexpr size_t FOAM_CELLS_PER_TASK = 32 * 1024;
+
+/**
+ * @brief FoamFile header entries that decide how the lists of a polyMesh file are stored
+ */
+struct FoamFileHeader {
+    bool binary = false;    // format binary (raw list payloads) or ascii
+    int labelBytes = 4;     // Label width from the arch entry (label=32/64)
+    int scalarBytes = 8;    // Scalar width from the arch entry (scalar=32/64)
+    std::string className;  // class entry (vectorField, faceList, faceCompactList, labelList, ...)
+};
+
+/**
+ * @brief One patch of polyMesh/boundary
+ */
+struct FoamPatch {
+    std::string name;       // Patch name
+    std::string type;       // Patch type (patch, wall, empty, symmetry, processor, ...)
+    uint64_t startFace = 0; // First face of the patch
+    uint64_t faceCount = 0; // Number of faces
+};
+
+/**
+ * @brief Check whether a patch couples processor meshes (its faces are interior after reconstruction)
+ * @param patch Patch
+ * @return Whether the patch is a processor interface
+ */
+bool isProcessorPatch(const FoamPatch& patch) {
+    return patch.type == "processor" || patch.type == "processorCyclic";
+}
+
+/**
+ * @brief Re-entrant parser of one FoamFile (header dictionary followed by ASCII or binary lists)
+ * Works on an in-memory view. Comments are skipped between ASCII tokens, never inside a binary
+ * payload. Malformed input throws std::runtime_error naming the file.
+ */
+class FoamFileParser {
+public:
+    FoamFileParser(const char* data, size_t size, std::string fileName)
+        : begin_(data), cur_(data), end_(data + size), fileName_(std::move(fileName)) {}
+
+    /**
+     * @brief Parse the FoamFile header dictionary (must come first)
+     * @return Header entries
+     */
+    const FoamFileHeader& readHeader() {
+        if (word() != "FoamFile") {
+            fail("missing FoamFile header");
+        }
+        for (const auto& [key, value] : dictionary()) {
+            if (key == "format") {
+                header_.binary = value == "binary";
+            } else if (key == "class") {
+                header_.className = unquote(value);
+            } else if (key == "arch") {
+                parseArch(unquote(value));
+            }
+        }
+        return header_;
+    }
+
+    /**
+     * @brief Read a labelList (N(...) or uniform N{value})
+     * @param[out] labels Labels (negative labels are rejected)
+     */
+    template<typename Index>
+    void readLabels(std::vector<Index>& labels) {
+        const uint64_t count = listSize();
+        labels.resize(count);
+        skipSpace();
+        if (cur_ != end_ && *cur_ == '{') {
+            ++cur_;
+            std::fill(labels.begin(), labels.end(), label<Index>());
+            expect('}');
+            return;
+        }
+        expect('(');
+        readLabelPayload(labels.data(), count);
+        expect(')');
+    }
+
+    /**
+     * @brief Read a vectorField as flat xyz coordinates
+     * @param[out] xyz Coordinates (3 per vector)
+     */
+    template<typename Real>
+    void readVectors(std::vector<Real>& xyz) {
+        const uint64_t count = listSize();
+        xyz.resize(count * 3);
+        expect('(');
+        if (header_.binary) {
+            const size_t bytes = static_cast<size_t>(count) * 3 * header_.scalarBytes;
+            require(bytes);
+            if (header_.scalarBytes == 8) {
+                copyConverted<double>(cur_, xyz.data(), count * 3);
+            } else {
+                copyConverted<float>(cur_, xyz.data(), count * 3);
+            }
+            cur_ += bytes;
+        } else {
+            for (uint64_t i = 0; i < count; ++i) {
+                expect('(');
+                for (int axis = 0; axis < 3; ++axis) {
+                    xyz[i * 3 + axis] = number<Real>();
+                }
+                expect(')');
+            }
+        }
+        expect(')');
+    }
+
+    /**
+     * @brief Read a faceList or faceCompactList into CSR form
+     * @param[out] offsets Start of each face in labels (face count + 1 entries)
+     * @param[out] labels Point labels of all faces
+     */
+    template<typename Index>
+    void readFaces(std::vector<Index>& offsets, std::vector<Index>& labels) {
+        if (header_.className == "faceCompactList") {
+            readLabels(offsets);
+            readLabels(labels);
+            if (offsets.empty() || offsets.front() != 0 || offsets.back() != labels.size()
+                || !std::is_sorted(offsets.begin(), offsets.end())) {
+                fail("inconsistent faceCompactList offsets");
+            }
+            return;
+        }
+
+        const uint64_t count = listSize();
+        offsets.assign(1, 0);
+        offsets.reserve(count + 1);
+        labels.clear();
+        labels.reserve(count * 4);
+        expect('(');
+        for (uint64_t f = 0; f < count; ++f) {
+            const uint64_t size = listSize();
+            const size_t begin = labels.size();
+            labels.resize(begin + size);
+            expect('(');
+            readLabelPayload(labels.data() + begin, size);
+            expect(')');
+            offsets.push_back(static_cast<Index>(labels.size()));
+        }
+        expect(')');
+    }
+
+    /**
+     * @brief Read the patch list of polyMesh/boundary
+     * @return Patches in file order
+     */
+    std::vector<FoamPatch> readBoundary() {
+        const uint64_t count = listSize();
+        std::vector<FoamPatch> patches(count);
+        expect('(');
+        for (FoamPatch& patch : patches) {
+            patch.name = word();
+            for (const auto& [key, value] : dictionary()) {
+                if (key == "type") {
+                    patch.type = value;
+                } else if (key == "nFaces" && !TextTokenizer::parse(value, patch.faceCount)) {
+                    fail("invalid nFaces of patch " + patch.name);
+                } else if (key == "startFace" && !TextTokenizer::parse(value, patch.startFace)) {
+                    fail("invalid startFace of patch " + patch.name);
+                }
+            }
+        }
+        expect(')');
+        return patches;
+    }
+
+private:
+    [[noreturn]] void fail(const std::string& message) const {
+        throw std::runtime_error(fileName_ + ": " + message);
+    }
+
+    // Skip whitespace, // line comments and /* block comments */
+    void skipSpace() {
+        while (cur_ != end_) {
+            if (TextTokenizer::isSpace(*cur_)) {
+                ++cur_;
+            } else if (*cur_ == '/' && end_ - cur_ > 1 && cur_[1] == '/') {
+                const void* lineEnd = std::memchr(cur_, '\n', static_cast<size_t>(end_ - cur_));
+                cur_ = lineEnd ? static_cast<const char*>(lineEnd) : end_;
+            } else if (*cur_ == '/' && end_ - cur_ > 1 && cur_[1] == '*') {
+                const std::string_view rest(cur_ + 2, static_cast<size_t>(end_ - cur_ - 2));
+                const size_t close = rest.find("*/");
+                cur_ = close == std::string_view::npos ? end_ : cur_ + 2 + close + 2;
+            } else {
+                return;
+            }
+        }
+    }
+
+    void expect(char ch) {
+        skipSpace();
+        if (cur_ == end_ || *cur_ != ch) {
+            fail(std::string("expected '") + ch + "' at byte " + std::to_string(position()));
+        }
+        ++cur_;
+    }
+
+    void require(size_t bytes) const {
+        if (static_cast<size_t>(end_ - cur_) < bytes) {
+            fail("truncated binary list");
+        }
+    }
+
+    size_t position() const { return static_cast<size_t>(cur_ - begin_); }
+
+    template<typename T>
+    T number() {
+        skipSpace();
+        T value{};
+        const char* numberEnd = TextTokenizer::parseNumber(cur_, end_, value);
+        if (!numberEnd) {
+            fail("invalid number '" + std::string(cur_, std::min<size_t>(16, static_cast<size_t>(end_ - cur_))) + "'");
+        }
+        cur_ = numberEnd;
+        return value;
+    }
+
+    uint64_t listSize() {
+        return number<uint64_t>();
+    }
+
+    template<typename Index>
+    Index label() {
+        const int64_t value = number<int64_t>();
+        if (value < 0 || static_cast<uint64_t>(value) > std::numeric_limits<Index>::max()) {
+            fail("label " + std::to_string(value) + " out of range");
+        }
+        return static_cast<Index>(value);
+    }
+
+    template<typename Index>
+    void readLabelPayload(Index* labels, uint64_t count) {
+        if (!header_.binary) {
+            for (uint64_t i = 0; i < count; ++i) {
+                labels[i] = label<Index>();
+            }
+            return;
+        }
+        // Binary payload starts right after '('
+        const size_t bytes = static_cast<size_t>(count) * header_.labelBytes;
+        require(bytes);
+        const bool valid = header_.labelBytes == 8 ? copyLabels<int64_t>(cur_, labels, count)
+                                                   : copyLabels<int32_t>(cur_, labels, count);
+        if (!valid) {
+            fail("negative or out-of-range label in binary list");
+        }
+        cur_ += bytes;
+    }
+
+    template<typename Stored, typename Index>
+    static bool copyLabels(const char* source, Index* labels, uint64_t count) {
+        bool valid = true;
+        for (uint64_t i = 0; i < count; ++i) {
+            Stored value;
+            std::memcpy(&value, source + i * sizeof(Stored), sizeof(Stored));
+            valid &= value >= 0 && static_cast<uint64_t>(value) <= std::numeric_limits<Index>::max();
+            labels[i] = static_cast<Index>(value);
+        }
+        return valid;
+    }
+
+    template<typename Stored, typename Real>
+    static void copyConverted(const char* source, Real* values, uint64_t count) {
+        for (uint64_t i = 0; i < count; ++i) {
+            Stored value;
+            std::memcpy(&value, source + i * sizeof(Stored), sizeof(Stored));
+            values[i] = static_cast<Real>(value);
+        }
+    }
+
+    // Keyword or patch name: ends at whitespace or punctuation
+    std::string word() {
+        skipSpace();
+        const char* start = cur_;
+        while (cur_ != end_ && !TextTokenizer::isSpace(*cur_) && std::strchr("{}();", *cur_) == nullptr) {
+            ++cur_;
+        }
+        if (start == cur_) {
+            fail("expected a keyword at byte " + std::to_string(position()));
+        }
+        return std::string(start, cur_);
+    }
+
+    // Entries of a { key value; ... } dictionary (sub-dictionaries are skipped)
+    std::vector<std::pair<std::string, std::string>> dictionary() {
+        std::vector<std::pair<std::string, std::string>> entries;
+        expect('{');
+        while (true) {
+            skipSpace();
+            if (cur_ == end_) {
+                fail("unterminated dictionary");
+            }
+            if (*cur_ == '}') {
+                ++cur_;
+                return entries;
+            }
+            std::string key = word();
+            skipSpace();
+            if (cur_ != end_ && *cur_ == '{') {
+                skipBlock();
+                continue;
+            }
+            const char* start = cur_;
+            bool quoted = false;
+            while (cur_ != end_ && (quoted || *cur_ != ';')) {
+                quoted ^= *cur_ == '"';
+                ++cur_;
+            }
+            if (cur_ == end_) {
+                fail("missing ';' after " + key);
+            }
+            entries.emplace_back(std::move(key), std::string(TextTokenizer::trim(std::string_view(start, static_cast<size_t>(cur_ - start)))));
+            ++cur_;
+        }
+    }
+
+    void skipBlock() {
+        int depth = 0;
+        do {
+            if (cur_ == end_) {
+                fail("unterminated dictionary");
+            }
+            depth += *cur_ == '{' ? 1 : (*cur_ == '}' ? -1 : 0);
+            ++cur_;
+        } while (depth > 0);
+    }
+
+    static std::string unquote(const std::string& value) {
+        return value.size() >= 2 && value.front() == '"' && value.back() == '"' ? value.substr(1, value.size() - 2) : value;
+    }
+
+    // arch "LSB;label=32;scalar=64"
+    void parseArch(const std::string& arch) {
+        if (arch.find("MSB") != std::string::npos) {
+            fail("big-endian binary files are not supported");
+        }
+        header_.labelBytes = arch.find("label=64") != std::string::npos ? 8 : 4;
+        header_.scalarBytes = arch.find("scalar=32") != std::string::npos ? 4 : 8;
+    }
+
+    const char* begin_;
+    const char* cur_;
+    const char* end_;
+    std::string fileName_;
+    FoamFileHeader header_;
+};
+
+/**
+ * @brief Raw lists of one polyMesh directory
+ */
+template<typename Real, typename Index>
+struct FoamPolyMesh {
+    std::vector<Real> points;          // xyz of every point
+    std::vector<Index> faceOffsets;    // CSR offsets of the faces
+    std::vector<Index> faceLabels;     // Point labels of the faces (outward from the owner cell)
+    std::vector<Index> owner;          // Owner cell of every face
+    std::vector<Index> neighbour;      // Neighbour cell of every internal face
+    std::vector<FoamPatch> patches;    // Boundary patches
+    std::vector<Index> pointAddressing; // Global point of every local point (decomposed cases, may be empty)
+    uint64_t bytes = 0;                 // Bytes parsed
+};
+
+/**
+ * @brief Read the lists of a polyMesh directory, one file per thread
+ * @param directory polyMesh directory
+ * @param withAddressing Whether to read the optional pointProcAddressing (processor meshes)
+ * @param[out] mesh Raw lists
+ */
+template<typename Real, typename Index>
+void readFoamPolyMesh(const std::filesystem::path& directory, bool withAddressing, FoamPolyMesh<Real, Index>& mesh) {
+    static const char* const FILES[] = {"points", "faces", "owner", "neighbour", "boundary", "pointProcAddressing"};
+    const size_t fileCount = withAddressing ? 6 : 5;
+    std::vector<uint64_t> bytes(fileCount, 0);
+    runParallel(fileCount, [&](size_t i) {
+        const std::filesystem::path path = directory / FILES[i];
+        std::error_code ec;
+        if (!std::filesystem::exists(path, ec)) {
+            if (i == 5) {
+                return;
+            }
+            if (std::filesystem::exists(path.string() + ".gz", ec)) {
+                throw std::runtime_error(path.filename().string() + ": gzip-compressed polyMesh files are not supported "
+                                         "(write the mesh with writeCompression off)");
+            }
+            throw std::runtime_error("Missing polyMesh file: " + path.string());
+        }
+        MappedFile mappedFile;
+        std::string error;
+        if (!mappedFile.open(path.u8string(), error)) {
+            throw std::runtime_error(error);
+        }
+        FoamFileParser parser(mappedFile.data(), mappedFile.size(), path.filename().string());
+        parser.readHeader();
+        switch (i) {
+            case 0: parser.readVectors(mesh.points); break;
+            case 1: parser.readFaces(mesh.faceOffsets, mesh.faceLabels); break;
+            case 2: parser.readLabels(mesh.owner); break;
+            case 3: parser.readLabels(mesh.neighbour); break;
+            case 4: mesh.patches = parser.readBoundary(); break;
+            default: parser.readLabels(mesh.pointAddressing); break;
+        }
+        bytes[i] = mappedFile.size();
+    });
+    mesh.bytes = std::accumulate(bytes.begin(), bytes.end(), uint64_t(0));
+}
+
+/**
+ * @brief Recognize a tetrahedron, pyramid, wedge or hexahedron from its faces
+ * Cell faces are encoded as face * 2 + flip (flip = the cell is the neighbour, so the stored
+ * face points into it). Corners are collected in VTK order from one outward-facing base face
+ * and the edges leaving it.
+ * @param cellFaces Encoded faces of the cell
+ * @param faceCount Number of faces
+ * @param faceOffsets CSR offsets of the faces
+ * @param faceLabels Point labels of the faces
+ * @param[out] type VTK cell type
+ * @param[out] corners Cell corners in VTK order
+ * @return Whether the cell has one of the four shapes (false for general polyhedra)
+ */
+template<typename Index>
+bool matchFoamCellShape(const Index* cellFaces, size_t faceCount, const Index* faceOffsets, const Index* faceLabels,
+                        VtkCellType& type, Index (&corners)[8]) {
+    auto faceSize = [&](size_t i) {
+        const Index face = cellFaces[i] >> 1;
+        return static_cast<size_t>(faceOffsets[face + 1] - faceOffsets[face]);
+    };
+    // Corner k of face i, walked so that the face points out of this cell
+    auto corner = [&](size_t i, size_t k) {
+        const Index face = cellFaces[i] >> 1;
+        const size_t size = static_cast<size_t>(faceOffsets[face + 1] - faceOffsets[face]);
+        return faceLabels[faceOffsets[face] + ((cellFaces[i] & 1) ? (size - k) % size : k)];
+    };
+
+    size_t triangles = 0;
+    size_t quads = 0;
+    size_t quadFace = 0;
+    for (size_t i = 0; i < faceCount; ++i) {
+        const size_t size = faceSize(i);
+        if (size == 3) {
+            ++triangles;
+        } else if (size == 4) {
+            quadFace = i;
+            ++quads;
+        } else {
+            return false;
+        }
+    }
+
+    size_t base = 0;
+    size_t pointCount = 0;
+    if (faceCount == 4 && triangles == 4) {
+        type = VtkCellType::TETRA;
+        pointCount = 4;
+    } else if (faceCount == 5 && triangles == 4) {
+        type = VtkCellType::PYRAMID;
+        pointCount = 5;
+        base = quadFace;
+    } else if (faceCount == 5 && triangles == 2) {
+        type = VtkCellType::WEDGE;
+        pointCount = 6;
+        while (faceSize(base) != 3) {
+            ++base;
+        }
+    } else if (faceCount == 6 && quads == 6) {
+        type = VtkCellType::HEXAHEDRON;
+        pointCount = 8;
+    } else {
+        return false;
+    }
+
+    // VTK bases point into the cell except the wedge base, which points out of it
+    const size_t baseSize = faceSize(base);
+    for (size_t k = 0; k < baseSize; ++k) {
+        corners[k] = corner(base, type == VtkCellType::WEDGE ? k : (baseSize - k) % baseSize);
+    }
+    auto inBase = [&](Index point) {
+        return std::find(corners, corners + baseSize, point) != corners + baseSize;
+    };
+
+    if (type == VtkCellType::TETRA || type == VtkCellType::PYRAMID) {
+        // Apex: the corner of any other face that is not on the base
+        const size_t side = (base + 1) % faceCount;
+        bool found = false;
+        for (size_t k = 0; k < faceSize(side) && !found; ++k) {
+            if (!inBase(corner(side, k))) {
+                corners[baseSize] = corner(side, k);
+                found = true;
+            }
+        }
+        if (!found) {
+            return false;
+        }
+    } else {
+        // Opposite corner: the neighbour of each base corner along a side face that leaves the base
+        for (size_t b = 0; b < baseSize; ++b) {
+            bool found = false;
+            for (size_t i = 0; i < faceCount && !found; ++i) {
+                const size_t size = faceSize(i);
+                for (size_t k = 0; i != base && k < size && !found; ++k) {
+                    if (corner(i, k) != corners[b]) {
+                        continue;
+                    }
+                    const Index previous = corner(i, (k + size - 1) % size);
+                    const Index next = corner(i, (k + 1) % size);
+                    if (!inBase(previous) || !inBase(next)) {
+                        corners[baseSize + b] = inBase(previous) ? next : previous;
+                        found = true;
+                    }
+                }
+            }
+            if (!found) {
+                return false;
+            }
+        }
+    }
+
+    // Every corner distinct and every face corner among them
+    for (size_t a = 0; a < pointCount; ++a) {
+        for (size_t b = a + 1; b < pointCount; ++b) {
+            if (corners[a] == corners[b]) {
+                return false;
+            }
+        }
+    }
+    for (size_t i = 0; i < faceCount; ++i) {
+        for (size_t k = 0; k < faceSize(i); ++k) {
+            if (std::find(corners, corners + pointCount, corner(i, k)) == corners + pointCount) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Cells of one task of the face-to-cell assembly
+ */
+template<typename Real, typename Index>
+struct FoamCellChunk {
+    BasicCellArray<Index> cells;  // VTK cells (centre points numbered from the mesh point count)
+    std::vector<Real> centres;    // Centre points added for decomposed polyhedra
+    std::vector<int64_t> sources; // Source cell of every VTK cell
+    bool decomposed = false;      // Whether any polyhedron was decomposed
+};
 
 /**
- * @brief Convert UTF-8 string to wide string
- * @param utf8 UTF-8 string
- * @return Wide string
+ * @brief Assemble VTK cells from the faces of a polyMesh
+ * Faces are grouped per cell through a counting sort (one sequential pass over owner and
+ * neighbour), then cells are converted in contiguous ranges on parallel threads. Hexahedra,
+ * wedges, pyramids and tetrahedra are recognized from their faces; every other polyhedron is
+ * split into one pyramid (quad face) or tetrahedra (other faces) per face around a point
+ * added at the cell centre, and "foam:cell" records the source cell of each VTK cell.
+ * Boundary faces of non-processor patches follow as polygons tagged by "foam:patch".
+ * @param foam Raw lists (released while assembling)
+ * @param[out] meshData Output mesh
+ * @param withPatches Whether to add the boundary faces
+ * @param forceCellIds Whether to store "foam:cell" even if no polyhedron was decomposed
+ * @param threads Worker threads
  */
-std::wstring utf8ToWide(const std::string& utf8) {
-    if (utf8.empty()) {
-        return std::wstring();
+template<typename Real, typename Index>
+void buildFoamMesh(FoamPolyMesh<Real, Index>& foam, BasicMeshData<Real, Index>& meshData,
+                   bool withPatches, bool forceCellIds, unsigned int threads) {
+    const size_t pointCount = foam.points.size() / 3;
+    const size_t faceCount = foam.faceOffsets.empty() ? 0 : foam.faceOffsets.size() - 1;
+    const size_t internalCount = foam.neighbour.size();
+    if (foam.owner.size() != faceCount || internalCount > faceCount) {
+        throw std::runtime_error("owner/neighbour sizes do not match the face count");
+    }
+    if (faceCount > static_cast<size_t>(std::numeric_limits<Index>::max() / 2)) {
+        throw std::runtime_error("Face count exceeds the index range of the mesh layout; read into MeshData64");
+    }
+    const Index* faceOffsets = foam.faceOffsets.data();
+    const Index* faceLabels = foam.faceLabels.data();
+    const size_t labelTasks = parallelTaskCount(foam.faceLabels.size(), FOAM_CELLS_PER_TASK * 4, threads);
+    std::vector<char> badLabel(labelTasks, 0);
+    parallelForRanges(foam.faceLabels.size(), labelTasks, [&](size_t begin, size_t end, size_t task) {
+        for (size_t i = begin; i < end; ++i) {
+            badLabel[task] |= faceLabels[i] >= pointCount;
+        }
+    });
+    if (std::find(badLabel.begin(), badLabel.end(), 1) != badLabel.end()) {
+        throw std::runtime_error("Face point label exceeds the point count");
+    }
+    for (size_t f = 0; f < faceCount; ++f) {
+        if (faceOffsets[f + 1] - faceOffsets[f] < 3) {
+            throw std::runtime_error("Face " + std::to_string(f) + " has fewer than 3 points");
+        }
+    }
+
+    // 1. Faces per cell: counting sort of owner and neighbour (internal faces come first)
+    size_t cellCount = 0;
+    for (Index cell : foam.owner) {
+        cellCount = std::max(cellCount, static_cast<size_t>(cell) + 1);
+    }
+    for (Index cell : foam.neighbour) {
+        cellCount = std::max(cellCount, static_cast<size_t>(cell) + 1);
+    }
+    std::vector<Index> cellStart(cellCount + 1, 0);
+    for (Index cell : foam.owner) {
+        ++cellStart[cell + 1];
+    }
+    for (Index cell : foam.neighbour) {
+        ++cellStart[cell + 1];
+    }
+    std::partial_sum(cellStart.begin(), cellStart.end(), cellStart.begin());
+    std::vector<Index> cellFaces(cellStart.back());
+    {
+        std::vector<Index> fill(cellStart.begin(), cellStart.end() - 1);
+        for (size_t f = 0; f < faceCount; ++f) {
+            cellFaces[fill[foam.owner[f]]++] = static_cast<Index>(f * 2);
+            if (f < internalCount) {
+                cellFaces[fill[foam.neighbour[f]]++] = static_cast<Index>(f * 2 + 1);
+            }
+        }
+    }
+
+    // 2. Cells in contiguous ranges
+    const size_t taskCount = parallelTaskCount(cellCount, FOAM_CELLS_PER_TASK, threads);
+    std::vector<FoamCellChunk<Real, Index>> chunks(taskCount);
+    const Real* points = foam.points.data();
+    parallelForRanges(cellCount, taskCount, [&](size_t begin, size_t end, size_t task) {
+        FoamCellChunk<Real, Index>& chunk = chunks[task];
+        chunk.cells.reserve(end - begin, (end - begin) * 8);
+        chunk.sources.reserve(end - begin);
+        std::vector<Index> cellPoints;
+        for (size_t c = begin; c < end; ++c) {
+            const Index* faces = cellFaces.data() + cellStart[c];
+            const size_t count = static_cast<size_t>(cellStart[c + 1] - cellStart[c]);
+            VtkCellType type;
+            Index corners[8];
+            if (matchFoamCellShape(faces, count, faceOffsets, faceLabels, type, corners)) {
+                chunk.cells.addCell(type, corners, type == VtkCellType::TETRA ? 4 : type == VtkCellType::PYRAMID ? 5
+                                                 : type == VtkCellType::WEDGE ? 6 : 8);
+                chunk.sources.push_back(static_cast<int64_t>(c));
+                continue;
+            }
+            if (count == 0) {
+                continue;
+            }
+
+            // General polyhedron: centre = mean of the distinct corners
+            cellPoints.clear();
+            for (size_t i = 0; i < count; ++i) {
+                const Index face = faces[i] >> 1;
+                cellPoints.insert(cellPoints.end(), faceLabels + faceOffsets[face], faceLabels + faceOffsets[face + 1]);
+            }
+            std::sort(cellPoints.begin(), cellPoints.end());
+            cellPoints.erase(std::unique(cellPoints.begin(), cellPoints.end()), cellPoints.end());
+            double centre[3] = {0, 0, 0};
+            for (Index point : cellPoints) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    centre[axis] += static_cast<double>(points[static_cast<size_t>(point) * 3 + axis]);
+                }
+            }
+            const Index centreIndex = static_cast<Index>(pointCount + chunk.centres.size() / 3);
+            for (int axis = 0; axis < 3; ++axis) {
+                chunk.centres.push_back(static_cast<Real>(centre[axis] / static_cast<double>(cellPoints.size())));
+            }
+            chunk.decomposed = true;
+
+            // One pyramid or fan of tetrahedra per face; bases point towards the centre
+            for (size_t i = 0; i < count; ++i) {
+                const Index face = faces[i] >> 1;
+                const size_t size = static_cast<size_t>(faceOffsets[face + 1] - faceOffsets[face]);
+                const Index* labels = faceLabels + faceOffsets[face];
+                auto outward = [&](size_t k) { return labels[(faces[i] & 1) ? (size - k) % size : k]; };
+                if (size == 4) {
+                    chunk.cells.addCell(VtkCellType::PYRAMID, {outward(0), outward(3), outward(2), outward(1), centreIndex});
+                    chunk.sources.push_back(static_cast<int64_t>(c));
+                    continue;
+                }
+                for (size_t k = 1; k + 1 < size; ++k) {
+                    chunk.cells.addCell(VtkCellType::TETRA, {outward(0), outward(k + 1), outward(k), centreIndex});
+                    chunk.sources.push_back(static_cast<int64_t>(c));
+                }
+            }
+        }
+    });
+    std::vector<Index>().swap(cellFaces);
+
+    // 3. Centre points follow the mesh points, numbered in chunk order
+    std::vector<size_t> centreBase(taskCount + 1, pointCount);
+    bool decomposed = false;
+    for (size_t t = 0; t < taskCount; ++t) {
+        centreBase[t + 1] = centreBase[t] + chunks[t].centres.size() / 3;
+        decomposed = decomposed || chunks[t].decomposed;
+    }
+    if (centreBase.back() > static_cast<size_t>(std::numeric_limits<Index>::max())) {
+        throw std::runtime_error("Point count exceeds the index range of the mesh layout; read into MeshData64");
+    }
+    meshData.clear();
+    meshData.points = std::move(foam.points);
+    meshData.points.resize(centreBase.back() * 3);
+    runParallel(taskCount, [&](size_t t) {
+        FoamCellChunk<Real, Index>& chunk = chunks[t];
+        std::copy(chunk.centres.begin(), chunk.centres.end(), meshData.points.begin() + centreBase[t] * 3);
+        const Index shift = static_cast<Index>(centreBase[t] - pointCount);
+        if (shift != 0) {
+            for (Index& point : chunk.cells.connectivity) {
+                point += point >= pointCount ? shift : 0;
+            }
+        }
+    });
+    std::vector<BasicCellArray<Index>*> cellParts;
+    size_t volumeCount = 0;
+    for (FoamCellChunk<Real, Index>& chunk : chunks) {
+        cellParts.push_back(&chunk.cells);
+        volumeCount += chunk.sources.size();
+    }
+    std::vector<int64_t> sources;
+    sources.reserve(volumeCount);
+    for (FoamCellChunk<Real, Index>& chunk : chunks) {
+        sources.insert(sources.end(), chunk.sources.begin(), chunk.sources.end());
+    }
+    concatenateCells(cellParts, meshData.cells);
+
+    // 4. Boundary faces of the physical patches (processor interfaces are interior)
+    std::vector<int32_t> patchTags;
+    for (const FoamPatch& patch : foam.patches) {
+        if (isProcessorPatch(patch)) {
+            continue;
+        }
+        const int32_t tag = static_cast<int32_t>(meshData.metadata.physicalRegions.size());
+        meshData.metadata.physicalRegions.push_back(patch.name);
+        meshData.metadata.physicalRegionTypes.push_back(patch.type);
+        if (!withPatches) {
+            continue;
+        }
+        if (patch.startFace + patch.faceCount > faceCount) {
+            throw std::runtime_error("Patch " + patch.name + " exceeds the face count");
+        }
+        if (patchTags.empty()) {
+            patchTags.assign(meshData.cells.size(), -1);
+        }
+        for (uint64_t f = patch.startFace; f < patch.startFace + patch.faceCount; ++f) {
+            const size_t size = static_cast<size_t>(faceOffsets[f + 1] - faceOffsets[f]);
+            const VtkCellType type = size == 3 ? VtkCellType::TRIANGLE : size == 4 ? VtkCellType::QUAD : VtkCellType::POLYGON;
+            meshData.cells.addCell(type, faceLabels + faceOffsets[f], size);
+            patchTags.push_back(tag);
+        }
+    }
+    if (!patchTags.empty()) {
+        meshData.cellData["foam:patch"] = MeshAttribute(std::move(patchTags));
+    }
+    if (decomposed || forceCellIds) {
+        sources.resize(meshData.cells.size(), -1);
+        meshData.cellData["foam:cell"] = MeshAttribute(std::move(sources));
     }
-    int size_needed = MultiByteToWideChar(CP_UTF8, 0, utf8.c_str(), (int)utf8.size(), NULL, 0);
-    std::wstring wide(size_needed, 0);
-    MultiByteToWideChar(CP_UTF8, 0, utf8.c_str(), (int)utf8.size(), &wide[0], size_needed);
-    return wide;
 }
 
 /**
- * @brief Set VTK reader file name with UTF-8 support
- * @param reader VTK reader
- * @param filePath UTF-8 encoded file path
+ * @brief Read one polyMesh directory into a mesh
+ * @param directory polyMesh directory
+ * @param options Read options (openFoamPatches)
+ * @param decomposed Whether the directory belongs to a processor mesh (reads pointProcAddressing)
+ * @param threads Worker threads of the face-to-cell assembly
+ * @param[out] meshData Output mesh
+ * @param[out] pointAddressing Global point of every file point (empty if unknown)
+ * @return Bytes parsed
  */
-template<typename ReaderType>
-void setVTKReaderFileName(vtkSmartPointer<ReaderType> reader, const std::string& filePath) {
-#ifdef _WIN32
-    // Use SetFileName with UTF-8 encoded path
-    // VTK's SetFileName should handle UTF-8 correctly
-    reader->SetFileName(filePath.c_str());
-#else
-    reader->SetFileName(filePath.c_str());
-#endif
+template<typename Real, typename Index>
+uint64_t readFoamMesh(const std::filesystem::path& directory, const FormatReadOptions& options, bool decomposed,
+                      unsigned int threads, BasicMeshData<Real, Index>& meshData, std::vector<Index>& pointAddressing) {
+    FoamPolyMesh<Real, Index> foam;
+    readFoamPolyMesh(directory, decomposed, foam);
+    if (foam.pointAddressing.size() == foam.points.size() / 3) {
+        pointAddressing = std::move(foam.pointAddressing);
+    } else {
+        pointAddressing.clear();
+    }
+    buildFoamMesh(foam, meshData, options.openFoamPatches, decomposed, threads);
+    return foam.bytes;
 }
 
 /**
- * @brief Set VTK reader file name with UTF-8 support (raw pointer version)
- * @param reader VTK reader
- * @param filePath UTF-8 encoded file path
+ * @brief Merge processor meshes of a decomposed case
+ * With pointProcAddressing in every processor directory the shared interface points are
+ * merged into the undecomposed point numbering; otherwise processor points are appended
+ * (interface points stay duplicated). Patch tags are renumbered over the union of patch
+ * names, and INT32 cell data "foam:processor" stores the source processor of each cell.
+ * @param parts Processor meshes in rank order (released while merging)
+ * @param addressing pointProcAddressing of each processor (empty entries if missing)
+ * @param[out] meshData Merged mesh
+ * @param threads Worker threads
  */
-template<typename ReaderType>
-void setVTKReaderFileName(ReaderType* reader, const std::string& filePath) {
-#ifdef _WIN32
-    // Use SetFileName with UTF-8 encoded path
-    // VTK's SetFileName should handle UTF-8 correctly
-    reader->SetFileName(filePath.c_str());
-#else
-    reader->SetFileName(filePath.c_str());
-#endif
-}
+template<typename Real, typename Index>
+void mergeFoamProcessors(std::vector<BasicMeshData<Real, Index>>& parts, std::vector<std::vector<Index>>& addressing,
+                         BasicMeshData<Real, Index>& meshData, unsigned int threads) {
+    const bool reconstruct = std::all_of(addressing.begin(), addressing.end(),
+                                         [](const std::vector<Index>& map) { return !map.empty(); });
 
-#endif
+    // Global point numbering: addressed points first, then the per-processor extra (centre) points
+    std::vector<size_t> pointBase(parts.size() + 1, 0);
+    size_t globalPoints = 0;
+    if (reconstruct) {
+        for (const std::vector<Index>& map : addressing) {
+            for (Index point : map) {
+                globalPoints = std::max(globalPoints, static_cast<size_t>(point) + 1);
+            }
+        }
+    }
+    pointBase[0] = globalPoints;
+    std::vector<size_t> cellBase(parts.size() + 1, 0);
+    std::vector<size_t> connectivityBase(parts.size() + 1, 0);
+    for (size_t p = 0; p < parts.size(); ++p) {
+        const size_t extra = parts[p].points.size() / 3 - (reconstruct ? addressing[p].size() : 0);
+        pointBase[p + 1] = pointBase[p] + extra;
+        cellBase[p + 1] = cellBase[p] + parts[p].cells.size();
+        connectivityBase[p + 1] = connectivityBase[p] + parts[p].cells.connectivitySize();
+    }
+    const size_t indexLimit = static_cast<size_t>(std::numeric_limits<Index>::max());
+    if (pointBase.back() > indexLimit || connectivityBase.back() > indexLimit) {
+        throw std::runtime_error("Merged processor meshes exceed the index range of the mesh layout; read into MeshData64");
+    }
 
-// Try to include Gmsh API header
-#ifdef HAVE_GMSH
-#ifdef __cplusplus
-extern "C" {
-#endif
-#include "gmshc.h"
-#ifdef __cplusplus
-}
-#endif
-#endif
+    // Patches: union of the names in order of appearance
+    meshData.clear();
+    std::vector<std::vector<int32_t>> patchMap(parts.size());
+    for (size_t p = 0; p < parts.size(); ++p) {
+        const MeshMetadata& metadata = parts[p].metadata;
+        for (size_t r = 0; r < metadata.physicalRegions.size(); ++r) {
+            std::vector<std::string>& names = meshData.metadata.physicalRegions;
+            const auto it = std::find(names.begin(), names.end(), metadata.physicalRegions[r]);
+            patchMap[p].push_back(static_cast<int32_t>(it - names.begin()));
+            if (it == names.end()) {
+                names.push_back(metadata.physicalRegions[r]);
+                meshData.metadata.physicalRegionTypes.push_back(metadata.physicalRegionTypes[r]);
+            }
+        }
+    }
+    const bool hasPatches = std::any_of(parts.begin(), parts.end(), [](const BasicMeshData<Real, Index>& part) {
+        return part.cellData.count("foam:patch") != 0;
+    });
 
-/**
- * @brief Check if file exists
- * @param filePath File path
- * @return Whether exists
- */
-bool MeshReader::fileExists(const std::string& filePath) {
-    return std::filesystem::exists(filePath);
+    // Points: shared interface points are written once per processor with identical values
+    meshData.points.resize(pointBase.back() * 3);
+    for (size_t p = 0; p < parts.size(); ++p) {
+        const std::vector<Real>& points = parts[p].points;
+        const size_t addressed = reconstruct ? addressing[p].size() : 0;
+        for (size_t i = 0; i < addressed; ++i) {
+            std::copy_n(points.begin() + i * 3, 3, meshData.points.begin() + static_cast<size_t>(addressing[p][i]) * 3);
+        }
+        std::copy(points.begin() + addressed * 3, points.end(), meshData.points.begin() + pointBase[p] * 3);
+    }
+
+    meshData.cells.types.resize(cellBase.back());
+    meshData.cells.offsets.resize(cellBase.back() + 1);
+    meshData.cells.connectivity.resize(connectivityBase.back());
+    std::vector<int32_t> processorTags(cellBase.back());
+    std::vector<int32_t> patchTags(hasPatches ? cellBase.back() : 0, -1);
+    std::vector<int64_t> sourceCells(cellBase.back(), -1);
+    parallelForRanges(parts.size(), parallelTaskCount(parts.size(), 1, threads), [&](size_t begin, size_t end, size_t) {
+        for (size_t p = begin; p < end; ++p) {
+            BasicMeshData<Real, Index>& part = parts[p];
+            const std::vector<Index>& map = addressing[p];
+            const size_t addressed = reconstruct ? map.size() : 0;
+            const size_t extraShift = pointBase[p] - addressed;
+            std::copy(part.cells.types.begin(), part.cells.types.end(), meshData.cells.types.begin() + cellBase[p]);
+            const Index connectivityOffset = static_cast<Index>(connectivityBase[p]);
+            for (size_t c = 0; c < part.cells.size(); ++c) {
+                meshData.cells.offsets[cellBase[p] + c] = part.cells.offsets[c] + connectivityOffset;
+            }
+            std::transform(part.cells.connectivity.begin(), part.cells.connectivity.end(),
+                           meshData.cells.connectivity.begin() + connectivityBase[p], [&](Index point) {
+                               return static_cast<size_t>(point) < addressed ? map[point] : static_cast<Index>(point + extraShift);
+                           });
+            std::fill(processorTags.begin() + cellBase[p], processorTags.begin() + cellBase[p + 1], static_cast<int32_t>(p));
+            auto patch = part.cellData.find("foam:patch");
+            if (patch != part.cellData.end()) {
+                const std::vector<int32_t>& tags = patch->second.template values<int32_t>();
+                std::transform(tags.begin(), tags.end(), patchTags.begin() + cellBase[p],
+                               [&](int32_t tag) { return tag < 0 ? tag : patchMap[p][static_cast<size_t>(tag)]; });
+            }
+            auto source = part.cellData.find("foam:cell");
+            if (source != part.cellData.end()) {
+                const std::vector<int64_t>& ids = source->second.template values<int64_t>();
+                std::copy(ids.begin(), ids.end(), sourceCells.begin() + cellBase[p]);
+            }
+            part = BasicMeshData<Real, Index>();
+        }
+    });
+    meshData.cells.offsets.back() = static_cast<Index>(connectivityBase.back());
+    if (hasPatches) {
+        meshData.cellData["foam:patch"] = MeshAttribute(std::move(patchTags));
+    }
+    meshData.cellData["foam:cell"] = MeshAttribute(std::move(sourceCells));
+    meshData.cellData["foam:processor"] = MeshAttribute(std::move(processorTags));
 }
 
+} // namespace
+
 /**
  * @brief Detect format from file header
  * @param filePath File path
@@ -136,24 +2463,8 @@ MeshFormat MeshReader::detectFormatFromHeader(const std::string& filePath) {
         // Will check version later
         return MeshFormat::GMSH_V2;
     } else if (lowerPath.substr(lowerPath.size() - 4) == ".stl") {
-        // Check if it's ASCII or Binary STL
-        std::ifstream file(filePath, std::ios::binary);
-        if (file.is_open()) {
-            char header[80] = {0};
-            file.read(header, 80);
-            std::string headerStr(header);
-            file.close();
-            
-            // Check if header starts with "solid" (case-insensitive)
-            std::string trimmedHeader = headerStr.substr(0, 5);
-            std::transform(trimmedHeader.begin(), trimmedHeader.end(), trimmedHeader.begin(), ::tolower);
-            if (trimmedHeader == "solid") {
-                return MeshFormat::STL_ASCII;
-            } else {
-                return MeshFormat::STL_BINARY;
-            }
-        }
-        return MeshFormat::STL_BINARY;
+        // Check if it's ASCII or Binary STL (same rule as readSTL)
+        return MeshHelper::detectSTLEncoding(filePath);
     } else if (lowerPath.substr(lowerPath.size() - 4) == ".obj") {
         return MeshFormat::OBJ;
     } else if (lowerPath.substr(lowerPath.size() - 4) == ".ply") {
@@ -164,7 +2475,9 @@ MeshFormat MeshReader::detectFormatFromHeader(const std::string& filePath) {
         return MeshFormat::OFF;
     } else if (lowerPath.substr(lowerPath.size() - 4) == ".su2") {
         return MeshFormat::SU2;
-    } else if (std::filesystem::is_directory(filePath) && std::filesystem::exists(filePath + "/polyMesh")) {
+    } else if (lowerPath.substr(lowerPath.size() - 4) == ".mcb") {
+        return MeshFormat::MESH_CACHE;
+    } else if (isOpenFoamCase(filePath)) {
         return MeshFormat::OPENFOAM;
     }
 
@@ -178,10 +2491,12 @@ MeshFormat MeshReader::detectFormatFromHeader(const std::string& filePath) {
     // Read file header
     char header[128] = {0};
     file.read(header, sizeof(header));
-    std::string headerStr(header);
+    std::string headerStr(header, static_cast<size_t>(file.gcount()));
 
     // Detect format
-    if (headerStr.find("# vtk") != std::string::npos) {
+    if (headerStr.compare(0, 8, std::string("MCBMESH\0", 8)) == 0) {
+        return MeshFormat::MESH_CACHE;
+    } else if (headerStr.find("# vtk") != std::string::npos) {
         return MeshFormat::VTK_LEGACY;
     } else if (headerStr.find("<?xml") != std::string::npos && headerStr.find("VTKFile") != std::string::npos) {
         return MeshFormat::VTK_XML;
@@ -223,12 +2538,14 @@ MeshFormat MeshReader::detectFormatFromHeader(const std::string& filePath) {
  * @param[out] meshData Output mesh data
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message (UTF-8)
+ * @param options Read options (format-specific configurations)
  * @return Whether reading is successful (true=success, false=failure)
  */
 bool MeshReader::readAuto(const std::string& filePath,
                          MeshData& meshData,
                          MeshErrorCode& errorCode,
-                         std::string& errorMsg) {
+                         std::string& errorMsg,
+                         const FormatReadOptions& options) {
     // Check if file exists
     if (!fileExists(filePath)) {
         errorCode = MeshErrorCode::FILE_NOT_EXIST;
@@ -244,35 +2561,161 @@ bool MeshReader::readAuto(const std::string& filePath,
         return false;
     }
 
+    ProfileScope scope("read", "read", filePath);
+    if (scope.active()) {
+        scope.setName(MeshHelper::getFormatName(format));
+    }
+    // Inside a job the parsers credit input bytes to this step
+    JobStep step(0.0, 1.0);
+    if (step.active()) {
+        step.setUnits(Profiler::pathBytes(filePath));
+    }
+
     // Call corresponding read method based on format
+    bool success = false;
     switch (format) {
         case MeshFormat::VTK_LEGACY:
         case MeshFormat::VTK_XML:
-            return readVTK(filePath, meshData, errorCode, errorMsg);
+            success = readVTK(filePath, meshData, errorCode, errorMsg);
+            break;
         case MeshFormat::CGNS:
-            return readCGNS(filePath, meshData, errorCode, errorMsg);
+            success = readCGNS(filePath, meshData, errorCode, errorMsg, options);
+            break;
         case MeshFormat::GMSH_V2:
         case MeshFormat::GMSH_V4:
-            return readGmsh(filePath, meshData, errorCode, errorMsg);
+            success = readGmsh(filePath, meshData, errorCode, errorMsg, options);
+            break;
         case MeshFormat::STL_ASCII:
         case MeshFormat::STL_BINARY:
-            return readSTL(filePath, meshData, errorCode, errorMsg);
+            success = readSTL(filePath, meshData, errorCode, errorMsg, options);
+            break;
         case MeshFormat::OBJ:
-            return readOBJ(filePath, meshData, errorCode, errorMsg);
+            success = readOBJ(filePath, meshData, errorCode, errorMsg, options);
+            break;
         case MeshFormat::PLY_ASCII:
         case MeshFormat::PLY_BINARY:
-            return readPLY(filePath, meshData, errorCode, errorMsg);
+            success = readPLY(filePath, meshData, errorCode, errorMsg);
+            break;
         case MeshFormat::OFF:
-            return readOFF(filePath, meshData, errorCode, errorMsg);
+            success = readOFF(filePath, meshData, errorCode, errorMsg);
+            break;
         case MeshFormat::SU2:
-            return readSU2(filePath, meshData, errorCode, errorMsg);
+            success = readSU2(filePath, meshData, errorCode, errorMsg, options);
+            break;
         case MeshFormat::OPENFOAM:
-            return readOpenFOAM(filePath, meshData, errorCode, errorMsg);
+            success = readOpenFOAM(filePath, meshData, errorCode, errorMsg, options);
+            break;
+        case MeshFormat::MESH_CACHE:
+            success = readMeshCache(filePath, meshData, errorCode, errorMsg, options);
+            break;
         default:
             errorCode = MeshErrorCode::FORMAT_UNSUPPORTED;
             errorMsg = "Format not supported: " + filePath;
             return false;
     }
+    if (success && options.weldPoints) {
+        // Optional point welding (shared corners of facet soups, duplicated zone interfaces)
+        ProfileScope weldScope("filter", "weld");
+        weldScope.setInputCells(meshData.cells.size());
+        MeshProcessor::WeldOptions weldOptions;
+        weldOptions.tolerance = options.weldTolerance;
+        weldOptions.threads = options.readThreads;
+        success = MeshProcessor::weldPoints(meshData, meshData, weldOptions, errorCode, errorMsg);
+        weldScope.setCells(meshData.cells.size());
+    }
+    if (success && scope.active()) {
+        scope.setBytes(Profiler::pathBytes(filePath));
+        scope.setCells(meshData.cells.size());
+    }
+    return success;
+}
+
+/**
+ * @brief Automatically detect file format and read mesh data with double coordinates and 64-bit indices
+ * @param filePath File path (UTF-8 encoded)
+ * @param[out] meshData Output mesh data
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @param options Read options (format-specific configurations)
+ * @return Whether reading is successful
+ */
+bool MeshReader::readAuto(const std::string& filePath,
+                         MeshData64& meshData,
+                         MeshErrorCode& errorCode,
+                         std::string& errorMsg,
+                         const FormatReadOptions& options) {
+    meshData.clear();
+    if (!fileExists(filePath)) {
+        errorCode = MeshErrorCode::FILE_NOT_EXIST;
+        errorMsg = "File does not exist: " + filePath;
+        return false;
+    }
+
+    MeshFormat format = detectFormatFromHeader(filePath);
+    if (format == MeshFormat::UNKNOWN) {
+        errorCode = MeshErrorCode::FORMAT_UNSUPPORTED;
+        errorMsg = "Cannot detect file format: " + filePath;
+        return false;
+    }
+
+    const bool preciseSource = format == MeshFormat::GMSH_V2 || format == MeshFormat::GMSH_V4
+        || format == MeshFormat::SU2 || format == MeshFormat::CGNS || format == MeshFormat::OPENFOAM
+        || format == MeshFormat::MESH_CACHE;
+    if (!preciseSource && format != MeshFormat::VTK_LEGACY && format != MeshFormat::VTK_XML) {
+        // Single-precision sources: widening is exact
+        MeshData compactMesh;
+        if (!readAuto(filePath, compactMesh, errorCode, errorMsg, options)) {
+            return false;
+        }
+        convertMeshData(compactMesh, meshData);
+        return true;
+    }
+
+    ProfileScope scope("read", "read", filePath);
+    if (scope.active()) {
+        scope.setName(MeshHelper::getFormatName(format));
+    }
+    JobStep step(0.0, 1.0);
+    if (step.active()) {
+        step.setUnits(Profiler::pathBytes(filePath));
+    }
+
+    // Welding runs on the compact layout, so it is only applied to formats read through it
+    FormatReadOptions preciseOptions = options;
+    preciseOptions.weldPoints = false;
+    bool success = false;
+    switch (format) {
+        case MeshFormat::GMSH_V2:
+        case MeshFormat::GMSH_V4:
+            success = readGmsh(filePath, meshData, errorCode, errorMsg, preciseOptions);
+            break;
+        case MeshFormat::SU2:
+            success = readSU2(filePath, meshData, errorCode, errorMsg, preciseOptions);
+            break;
+        case MeshFormat::CGNS:
+            success = readCGNS(filePath, meshData, errorCode, errorMsg, preciseOptions);
+            break;
+        case MeshFormat::OPENFOAM:
+            success = readOpenFOAM(filePath, meshData, errorCode, errorMsg, preciseOptions);
+            break;
+        case MeshFormat::MESH_CACHE:
+            success = readMeshCache(filePath, meshData, errorCode, errorMsg, preciseOptions);
+            break;
+        default: {
+            // VTK readers keep the point precision of the file
+            vtkSmartPointer<vtkUnstructuredGrid> grid = readVTKToVTK(filePath, errorCode, errorMsg);
+            success = grid && VTKBridge::toMeshData(grid, meshData, errorCode, errorMsg);
+            if (success) {
+                meshData.metadata.format = format;
+            }
+            break;
+        }
+    }
+    if (success && scope.active()) {
+        scope.setBytes(Profiler::pathBytes(filePath));
+        scope.setCells(meshData.cells.size());
+    }
+    return success;
 }
 
 /**
@@ -319,7 +2762,9 @@ bool MeshReader::readVTK(const std::string& filePath,
                 // Use unstructured grid reader
                 vtkSmartPointer<vtkUnstructuredGridReader> ugReader = vtkSmartPointer<vtkUnstructuredGridReader>::New();
                 setVTKReaderFileName(ugReader, filePath);
+                VTKBridge::observeJob(ugReader);
                 ugReader->Update();
+                JobControl::checkpoint();
                 
                 if (ugReader->GetOutput() && ugReader->GetOutput()->GetNumberOfPoints() > 0) {
                     unstructuredGrid = ugReader->GetOutput();
@@ -332,7 +2777,9 @@ bool MeshReader::readVTK(const std::string& filePath,
                 // Use structured grid reader
                 vtkSmartPointer<vtkStructuredGridReader> sgReader = vtkSmartPointer<vtkStructuredGridReader>::New();
                 setVTKReaderFileName(sgReader, filePath);
+                VTKBridge::observeJob(sgReader);
                 sgReader->Update();
+                JobControl::checkpoint();
                 
                 if (sgReader->GetOutput() && sgReader->GetOutput()->GetNumberOfPoints() > 0) {
                     vtkSmartPointer<vtkStructuredGrid> structuredGrid = sgReader->GetOutput();
@@ -400,7 +2847,9 @@ bool MeshReader::readVTK(const std::string& filePath,
                 // Use rectilinear grid reader
                 vtkSmartPointer<vtkRectilinearGridReader> rgReader = vtkSmartPointer<vtkRectilinearGridReader>::New();
                 setVTKReaderFileName(rgReader, filePath);
+                VTKBridge::observeJob(rgReader);
                 rgReader->Update();
+                JobControl::checkpoint();
                 
                 if (rgReader->GetOutput() && rgReader->GetOutput()->GetNumberOfPoints() > 0) {
                     vtkSmartPointer<vtkRectilinearGrid> rectilinearGrid = rgReader->GetOutput();
@@ -483,7 +2932,9 @@ bool MeshReader::readVTK(const std::string& filePath,
                 // Use polydata reader
                 vtkSmartPointer<vtkPolyDataReader> pdReader = vtkSmartPointer<vtkPolyDataReader>::New();
                 setVTKReaderFileName(pdReader, filePath);
+                VTKBridge::observeJob(pdReader);
                 pdReader->Update();
+                JobControl::checkpoint();
                 
                 if (pdReader->GetOutput() && pdReader->GetOutput()->GetNumberOfPoints() > 0) {
                     // Convert polydata to unstructured grid
@@ -521,7 +2972,9 @@ bool MeshReader::readVTK(const std::string& filePath,
             // First try as unstructured grid
             vtkSmartPointer<vtkXMLUnstructuredGridReader> ugReader = vtkSmartPointer<vtkXMLUnstructuredGridReader>::New();
             setVTKReaderFileName(ugReader, filePath);
+            VTKBridge::observeJob(ugReader);
             ugReader->Update();
+            JobControl::checkpoint();
             
             if (ugReader->GetOutput() && ugReader->GetOutput()->GetNumberOfPoints() > 0) {
                 unstructuredGrid = ugReader->GetOutput();
@@ -529,7 +2982,9 @@ bool MeshReader::readVTK(const std::string& filePath,
                 // Try as structured grid
                 vtkSmartPointer<vtkXMLStructuredGridReader> sgReader = vtkSmartPointer<vtkXMLStructuredGridReader>::New();
                 setVTKReaderFileName(sgReader, filePath);
+                VTKBridge::observeJob(sgReader);
                 sgReader->Update();
+                JobControl::checkpoint();
                 
                 if (sgReader->GetOutput() && sgReader->GetOutput()->GetNumberOfPoints() > 0) {
                     vtkSmartPointer<vtkStructuredGrid> structuredGrid = sgReader->GetOutput();
@@ -592,7 +3047,9 @@ bool MeshReader::readVTK(const std::string& filePath,
                     // Try as rectilinear grid
                     vtkSmartPointer<vtkXMLRectilinearGridReader> rgReader = vtkSmartPointer<vtkXMLRectilinearGridReader>::New();
                     setVTKReaderFileName(rgReader, filePath);
+                    VTKBridge::observeJob(rgReader);
                     rgReader->Update();
+                    JobControl::checkpoint();
                     
                     if (rgReader->GetOutput() && rgReader->GetOutput()->GetNumberOfPoints() > 0) {
                         vtkSmartPointer<vtkRectilinearGrid> rectilinearGrid = rgReader->GetOutput();
@@ -668,171 +3125,28 @@ bool MeshReader::readVTK(const std::string& filePath,
                         unstructuredGrid->GetPointData()->ShallowCopy(rectilinearGrid->GetPointData());
                     } else {
                         errorCode = MeshErrorCode::READ_FAILED;
-                        errorMsg = "Failed to read VTK file: unsupported dataset type";
-                        return false;
-                    }
-                }
-            }
-        } else {
-            errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
-            errorMsg = "Not a valid VTK file format";
-            return false;
-        }
-        
-        // Check if reading was successful
-        if (!unstructuredGrid || unstructuredGrid->GetNumberOfPoints() == 0) {
-            errorCode = MeshErrorCode::READ_FAILED;
-            errorMsg = "Failed to read VTK file or file is empty";
-            return false;
-        }
-        
-        // Convert vtkUnstructuredGrid to MeshData
-        // Points
-        vtkIdType numPoints = unstructuredGrid->GetNumberOfPoints();
-        meshData.points.reserve(numPoints * 3);
-        
-        for (vtkIdType i = 0; i < numPoints; ++i) {
-            double point[3];
-            unstructuredGrid->GetPoint(i, point);
-            meshData.points.push_back(static_cast<float>(point[0]));
-            meshData.points.push_back(static_cast<float>(point[1]));
-            meshData.points.push_back(static_cast<float>(point[2]));
-        }
-        
-        // Cells
-        vtkIdType numCells = unstructuredGrid->GetNumberOfCells();
-        meshData.cells.reserve(numCells);
-        
-        for (vtkIdType i = 0; i < numCells; ++i) {
-            vtkCell* cell = unstructuredGrid->GetCell(i);
-            if (!cell) continue;
-            
-            MeshData::Cell meshCell;
-            
-            // Convert VTK cell type to VtkCellType
-            int vtkCellType = cell->GetCellType();
-            switch (vtkCellType) {
-                case VTK_VERTEX:
-                    meshCell.type = VtkCellType::VERTEX;
-                    break;
-                case VTK_LINE:
-                    meshCell.type = VtkCellType::LINE;
-                    break;
-                case VTK_POLY_LINE:
-                    // 处理POLY_LINE类型，使用LINE类型存储
-                    meshCell.type = VtkCellType::LINE;
-                    break;
-                case VTK_TRIANGLE:
-                    meshCell.type = VtkCellType::TRIANGLE;
-                    break;
-                case VTK_TRIANGLE_STRIP:
-                    meshCell.type = VtkCellType::TRIANGLE_STRIP;
-                    break;
-                case VTK_POLYGON:
-                    meshCell.type = VtkCellType::POLYGON;
-                    break;
-                case VTK_PIXEL:
-                    // 处理PIXEL类型，使用QUAD类型存储
-                    meshCell.type = VtkCellType::QUAD;
-                    break;
-                case VTK_QUAD:
-                    meshCell.type = VtkCellType::QUAD;
-                    break;
-                case VTK_TETRA:
-                    meshCell.type = VtkCellType::TETRA;
-                    break;
-                case VTK_VOXEL:
-                    // 处理VOXEL类型，使用HEXAHEDRON类型存储
-                    meshCell.type = VtkCellType::HEXAHEDRON;
-                    break;
-                case VTK_HEXAHEDRON:
-                    meshCell.type = VtkCellType::HEXAHEDRON;
-                    break;
-                case VTK_WEDGE:
-                    meshCell.type = VtkCellType::WEDGE;
-                    break;
-                case VTK_PYRAMID:
-                    meshCell.type = VtkCellType::PYRAMID;
-                    break;
-                default:
-                    // 添加调试信息，查看未处理的单元类型
-                    std::cout << "Warning: Skipping unsupported cell type: " << vtkCellType << std::endl;
-                    continue; // Skip unsupported cell types
-            }
-            
-            // Get point indices
-            vtkIdType numCellPoints = cell->GetNumberOfPoints();
-            meshCell.pointIndices.reserve(numCellPoints);
-            
-            for (vtkIdType j = 0; j < numCellPoints; ++j) {
-                meshCell.pointIndices.push_back(static_cast<uint32_t>(cell->GetPointId(j)));
-            }
-            
-            meshData.cells.push_back(meshCell);
-        }
-        
-        // Cell Data
-        vtkCellData* cellData = unstructuredGrid->GetCellData();
-        if (cellData) {
-            int numCellArrays = cellData->GetNumberOfArrays();
-            for (int i = 0; i < numCellArrays; ++i) {
-                vtkDataArray* array = cellData->GetArray(i);
-                if (array) {
-                    std::string arrayName = array->GetName();
-                    if (arrayName.empty()) {
-                        arrayName = "CellArray_" + std::to_string(i);
-                    }
-                    
-                    vtkIdType numTuples = array->GetNumberOfTuples();
-                    int numComponents = array->GetNumberOfComponents();
-                    
-                    std::vector<float> data;
-                    data.reserve(numTuples * numComponents);
-                    
-                    for (vtkIdType j = 0; j < numTuples; ++j) {
-                        for (int k = 0; k < numComponents; ++k) {
-                            double value = array->GetComponent(j, k);
-                            data.push_back(static_cast<float>(value));
-                        }
-                    }
-                    
-                    meshData.cellData[arrayName] = data;
-                }
-            }
-        }
-        
-        // Point Data
-        vtkPointData* pointData = unstructuredGrid->GetPointData();
-        if (pointData) {
-            int numPointArrays = pointData->GetNumberOfArrays();
-            for (int i = 0; i < numPointArrays; ++i) {
-                vtkDataArray* array = pointData->GetArray(i);
-                if (array) {
-                    std::string arrayName = array->GetName();
-                    if (arrayName.empty()) {
-                        arrayName = "PointArray_" + std::to_string(i);
-                    }
-                    
-                    vtkIdType numTuples = array->GetNumberOfTuples();
-                    int numComponents = array->GetNumberOfComponents();
-                    
-                    std::vector<float> data;
-                    data.reserve(numTuples * numComponents);
-                    
-                    for (vtkIdType j = 0; j < numTuples; ++j) {
-                        for (int k = 0; k < numComponents; ++k) {
-                            double value = array->GetComponent(j, k);
-                            data.push_back(static_cast<float>(value));
-                        }
+                        errorMsg = "Failed to read VTK file: unsupported dataset type";
+                        return false;
                     }
-                    
-                    meshData.pointData[arrayName] = data;
                 }
             }
+        } else {
+            errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
+            errorMsg = "Not a valid VTK file format";
+            return false;
         }
         
-        // Calculate metadata
-        meshData.calculateMetadata();
+        // Check if reading was successful
+        if (!unstructuredGrid || unstructuredGrid->GetNumberOfPoints() == 0) {
+            errorCode = MeshErrorCode::READ_FAILED;
+            errorMsg = "Failed to read VTK file or file is empty";
+            return false;
+        }
+        
+        // Convert vtkUnstructuredGrid to MeshData (bulk copy of the raw VTK arrays)
+        if (!VTKBridge::toMeshData(unstructuredGrid, meshData, errorCode, errorMsg)) {
+            return false;
+        }
         
         return true;
         
@@ -844,392 +3158,183 @@ bool MeshReader::readVTK(const std::string& filePath,
 }
 
 /**
- * @brief Read CGNS format file
+ * @brief Read CGNS format file (all selected zones of one base merged into one mesh)
  * @param filePath File path (UTF-8 encoded)
  * @param[out] meshData Output mesh data
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message (UTF-8)
- * @param baseIndex CGNS Base index (default 0, first Base)
- * @param zoneIndex CGNS Zone index (default 0, first Zone)
+ * @param options Read options (cgnsBase, cgnsZones, readThreads)
  * @return Whether reading is successful
  */
+template<typename Real, typename Index>
 bool MeshReader::readCGNS(const std::string& filePath,
-                         MeshData& meshData,
+                         BasicMeshData<Real, Index>& meshData,
                          MeshErrorCode& errorCode,
                          std::string& errorMsg,
-                         int baseIndex,
-                         int zoneIndex) {
-    // Clear existing data
+                         const FormatReadOptions& options) {
     meshData.clear();
-    
+
 #ifdef HAVE_CGNS
+    if (!fileExists(filePath)) {
+        errorCode = MeshErrorCode::FILE_NOT_EXIST;
+        errorMsg = "File does not exist: " + filePath;
+        return false;
+    }
+
     try {
-        // Use VTK's CGNS reader to read the file
-        vtkSmartPointer<vtkCGNSReader> reader = vtkSmartPointer<vtkCGNSReader>::New();
-        setVTKReaderFileName(reader, filePath);
-        reader->Update();
-        
-        vtkSmartPointer<vtkMultiBlockDataSet> output = reader->GetOutput();
-        
-        // Check if reading was successful
-        if (!output || output->GetNumberOfBlocks() == 0) {
-            errorCode = MeshErrorCode::READ_FAILED;
-            errorMsg = "Failed to read CGNS file or file is empty";
-            return false;
-        }
-        
-        // Find the first unstructured grid in the multi-block dataset
-        vtkSmartPointer<vtkUnstructuredGrid> grid;
-        
-        // Non-recursive approach to find unstructured grid in multi-block dataset
-        std::vector<vtkDataObject*> objectsToCheck;
-        objectsToCheck.push_back(output);
-        
-        while (!objectsToCheck.empty() && !grid) {
-            vtkDataObject* current = objectsToCheck.back();
-            objectsToCheck.pop_back();
-            
-            if (vtkUnstructuredGrid::SafeDownCast(current)) {
-                grid = vtkUnstructuredGrid::SafeDownCast(current);
-            } else if (vtkMultiBlockDataSet* mb = vtkMultiBlockDataSet::SafeDownCast(current)) {
-                for (unsigned int i = 0; i < mb->GetNumberOfBlocks(); ++i) {
-                    vtkDataObject* child = mb->GetBlock(i);
-                    if (child) {
-                        objectsToCheck.push_back(child);
-                    }
-                }
-            }
-        }
-        
-        if (!grid || grid->GetNumberOfPoints() == 0) {
-            errorCode = MeshErrorCode::READ_FAILED;
-            errorMsg = "No unstructured grid found in CGNS file or grid is empty";
-            return false;
-        }
-        
-        // Convert vtkUnstructuredGrid to MeshData
-        // Points
-        vtkIdType numPoints = grid->GetNumberOfPoints();
-        meshData.points.reserve(numPoints * 3);
-        
-        for (vtkIdType i = 0; i < numPoints; ++i) {
-            double point[3];
-            grid->GetPoint(i, point);
-            meshData.points.push_back(static_cast<float>(point[0]));
-            meshData.points.push_back(static_cast<float>(point[1]));
-            meshData.points.push_back(static_cast<float>(point[2]));
-        }
-        
-        // Cells
-        vtkIdType numCells = grid->GetNumberOfCells();
-        meshData.cells.reserve(numCells);
-        
-        for (vtkIdType i = 0; i < numCells; ++i) {
-            vtkCell* cell = grid->GetCell(i);
-            if (!cell) continue;
-            
-            MeshData::Cell meshCell;
-            
-            // Convert VTK cell type to VtkCellType
-            int vtkCellType = cell->GetCellType();
-            switch (vtkCellType) {
-                case VTK_VERTEX:
-                    meshCell.type = VtkCellType::VERTEX;
-                    break;
-                case VTK_LINE:
-                    meshCell.type = VtkCellType::LINE;
-                    break;
-                case VTK_TRIANGLE:
-                    meshCell.type = VtkCellType::TRIANGLE;
-                    break;
-                case VTK_QUAD:
-                    meshCell.type = VtkCellType::QUAD;
-                    break;
-                case VTK_TETRA:
-                    meshCell.type = VtkCellType::TETRA;
-                    break;
-                case VTK_HEXAHEDRON:
-                    meshCell.type = VtkCellType::HEXAHEDRON;
-                    break;
-                case VTK_WEDGE:
-                    meshCell.type = VtkCellType::WEDGE;
-                    break;
-                case VTK_PYRAMID:
-                    meshCell.type = VtkCellType::PYRAMID;
-                    break;
-                default:
-                    continue; // Skip unsupported cell types
-            }
-            
-            // Get point indices
-            vtkIdType numCellPoints = cell->GetNumberOfPoints();
-            meshCell.pointIndices.reserve(numCellPoints);
-            
-            for (vtkIdType j = 0; j < numCellPoints; ++j) {
-                meshCell.pointIndices.push_back(static_cast<uint32_t>(cell->GetPointId(j)));
-            }
-            
-            meshData.cells.push_back(meshCell);
-        }
-        
-        // Calculate metadata
-        meshData.calculateMetadata();
-        
+        const auto startTime = std::chrono::steady_clock::now();
+        std::vector<BasicMeshData<Real, Index>> zones;
+        std::vector<int> zoneIndices;
+        readCgnsZones(filePath, options, zones, zoneIndices);
+        mergeCgnsZones(zones, zoneIndices, meshData, options.readThreads);
+        recordReadThroughput(meshData, static_cast<size_t>(std::filesystem::file_size(std::filesystem::u8path(filePath))), startTime);
+
+        errorCode = MeshErrorCode::SUCCESS;
+        errorMsg = "";
         return true;
-        
+
+    } catch (const std::exception& e) {
+        meshData.clear();
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = std::string("Error reading CGNS file: ") + e.what();
+        return false;
+    }
+#else
+    (void)filePath;
+    (void)options;
+    errorCode = MeshErrorCode::DEPENDENCY_MISSING;
+    errorMsg = "CGNS support is not available (HAVE_CGNS not defined)";
+    return false;
+#endif
+}
+
+template bool MeshReader::readCGNS(const std::string&, MeshData&, MeshErrorCode&, std::string&, const FormatReadOptions&);
+template bool MeshReader::readCGNS(const std::string&, MeshData64&, MeshErrorCode&, std::string&, const FormatReadOptions&);
+
+/**
+ * @brief Read CGNS format file into one mesh per zone
+ * @param filePath File path (UTF-8 encoded)
+ * @param[out] zones Output meshes in selection order (metadata.blockName holds the zone name)
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @param options Read options (cgnsBase, cgnsZones, readThreads)
+ * @return Whether reading is successful
+ */
+template<typename Real, typename Index>
+bool MeshReader::readCGNSZones(const std::string& filePath,
+                              std::vector<BasicMeshData<Real, Index>>& zones,
+                              MeshErrorCode& errorCode,
+                              std::string& errorMsg,
+                              const FormatReadOptions& options) {
+    zones.clear();
+
+#ifdef HAVE_CGNS
+    if (!fileExists(filePath)) {
+        errorCode = MeshErrorCode::FILE_NOT_EXIST;
+        errorMsg = "File does not exist: " + filePath;
+        return false;
+    }
+
+    try {
+        std::vector<int> zoneIndices;
+        readCgnsZones(filePath, options, zones, zoneIndices);
+
+        errorCode = MeshErrorCode::SUCCESS;
+        errorMsg = "";
+        return true;
+
     } catch (const std::exception& e) {
+        zones.clear();
         errorCode = MeshErrorCode::READ_FAILED;
         errorMsg = std::string("Error reading CGNS file: ") + e.what();
         return false;
     }
 #else
+    (void)filePath;
+    (void)options;
     errorCode = MeshErrorCode::DEPENDENCY_MISSING;
     errorMsg = "CGNS support is not available (HAVE_CGNS not defined)";
     return false;
 #endif
 }
 
+template bool MeshReader::readCGNSZones(const std::string&, std::vector<MeshData>&, MeshErrorCode&, std::string&, const FormatReadOptions&);
+template bool MeshReader::readCGNSZones(const std::string&, std::vector<MeshData64>&, MeshErrorCode&, std::string&, const FormatReadOptions&);
+
 /**
- * @brief Read Gmsh format file (support v2/v4 auto-detection)
+ * @brief Read Gmsh format file (MSH 2.2/4.1, ASCII or binary)
+ * The file is parsed natively from a memory-mapped view, so reads are re-entrant.
  * @param filePath File path (UTF-8 encoded)
  * @param[out] meshData Output mesh data
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message (UTF-8)
+ * @param options Read options (readThreads enables chunk-parallel parsing)
  * @return Whether reading is successful
  */
+template<typename Real, typename Index>
 bool MeshReader::readGmsh(const std::string& filePath,
-                         MeshData& meshData,
+                         BasicMeshData<Real, Index>& meshData,
                          MeshErrorCode& errorCode,
-                         std::string& errorMsg) {
-    // Clear existing data
+                         std::string& errorMsg,
+                         const FormatReadOptions& options) {
     meshData.clear();
-    
-    #ifdef HAVE_GMSH
-    // Gmsh C API implementation
-    int ierr = 0;
-    
-    // Initialize Gmsh API
-    gmshInitialize(0, nullptr, 0, 0, &ierr);
-    if (ierr != 0) {
+
+    if (!fileExists(filePath)) {
+        errorCode = MeshErrorCode::FILE_NOT_EXIST;
+        errorMsg = "File does not exist: " + filePath;
+        return false;
+    }
+
+    MappedFile mappedFile;
+    if (!mappedFile.open(filePath, errorMsg)) {
         errorCode = MeshErrorCode::READ_FAILED;
-        errorMsg = "Error initializing Gmsh API";
         return false;
     }
-    
+
     try {
-        // Open the Gmsh file
-#ifdef _WIN32
-        // Gmsh API expects const char* even on Windows
-        gmshOpen(reinterpret_cast<const char*>(filePath.c_str()), &ierr);
-#else
-        gmshOpen(filePath.c_str(), &ierr);
-#endif
-        if (ierr != 0) {
-            errorCode = MeshErrorCode::READ_FAILED;
-            errorMsg = "Error opening Gmsh file: " + filePath;
-            gmshFinalize(&ierr);
-            return false;
-        }
-        
-        // Get all nodes in the mesh
-        size_t *nodeTags = nullptr;
-        size_t nodeTags_n = 0;
-        double *coord = nullptr;
-        size_t coord_n = 0;
-        double *parametricCoord = nullptr;
-        size_t parametricCoord_n = 0;
-        
-        gmshModelMeshGetNodes(&nodeTags, &nodeTags_n, &coord, &coord_n, &parametricCoord, &parametricCoord_n, -1, -1, 0, 0, &ierr);
-        if (ierr != 0) {
-            errorCode = MeshErrorCode::READ_FAILED;
-            errorMsg = "Error getting nodes from Gmsh file";
-            gmshFree(nodeTags);
-            gmshFree(coord);
-            gmshFree(parametricCoord);
-            gmshFinalize(&ierr);
-            return false;
-        }
-        
-        // Convert nodes to meshData.points
-        // Note: coord is [x1, y1, z1, x2, y2, z2, ...]
-        meshData.points.reserve(coord_n);
-        for (size_t i = 0; i < coord_n; ++i) {
-            meshData.points.push_back(static_cast<float>(coord[i]));
-        }
-        
-        // Get all elements in the mesh
-        int *elementTypes = nullptr;
-        size_t elementTypes_n = 0;
-        size_t **elementTags = nullptr;
-        size_t *elementTags_n = nullptr;
-        size_t elementTags_nn = 0;
-        size_t **nodeTagsPerElement = nullptr;
-        size_t *nodeTagsPerElement_n = nullptr;
-        size_t nodeTagsPerElement_nn = 0;
-        
-        gmshModelMeshGetElements(&elementTypes, &elementTypes_n, &elementTags, &elementTags_n, &elementTags_nn, &nodeTagsPerElement, &nodeTagsPerElement_n, &nodeTagsPerElement_nn, -1, -1, &ierr);
-        if (ierr != 0) {
-            errorCode = MeshErrorCode::READ_FAILED;
-            errorMsg = "Error getting elements from Gmsh file";
-            gmshFree(nodeTags);
-            gmshFree(coord);
-            gmshFree(parametricCoord);
-            gmshFinalize(&ierr);
-            return false;
-        }
-        
-        // Process each element type
-        for (size_t i = 0; i < elementTypes_n; ++i) {
-            int elementType = elementTypes[i];
-            const size_t *elements = elementTags[i];
-            size_t elements_n = elementTags_n[i];
-            const size_t *nodes = nodeTagsPerElement[i];
-            size_t nodes_n = nodeTagsPerElement_n[i];
-            
-            // Get element properties to determine number of nodes per element
-            char *elementName = nullptr;
-            int dim = 0;
-            int order = 0;
-            int numNodes = 0;
-            double *localNodeCoord = nullptr;
-            size_t localNodeCoord_n = 0;
-            int numPrimaryNodes = 0;
-            
-            gmshModelMeshGetElementProperties(elementType, &elementName, &dim, &order, &numNodes, &localNodeCoord, &localNodeCoord_n, &numPrimaryNodes, &ierr);
-            if (ierr != 0) {
-                gmshFree(elementName);
-                gmshFree(localNodeCoord);
-                continue;
-            }
-            
-            // Map Gmsh element type to VtkCellType
-            VtkCellType cellType = VtkCellType::VERTEX;
-            bool supportedType = true;
-            
-            switch (elementType) {
-                case 15: // Gmsh node
-                    cellType = VtkCellType::VERTEX;
-                    break;
-                case 1: // Gmsh line
-                    cellType = VtkCellType::LINE;
-                    break;
-                case 2: // Gmsh triangle
-                    cellType = VtkCellType::TRIANGLE;
-                    break;
-                case 3: // Gmsh quad
-                    cellType = VtkCellType::QUAD;
-                    break;
-                case 4: // Gmsh tetrahedron
-                    cellType = VtkCellType::TETRA;
-                    break;
-                case 5: // Gmsh hexahedron
-                    cellType = VtkCellType::HEXAHEDRON;
-                    break;
-                case 6: // Gmsh prism
-                    cellType = VtkCellType::WEDGE;
-                    break;
-                case 7: // Gmsh pyramid
-                    cellType = VtkCellType::PYRAMID;
-                    break;
-                default:
-                    // Skip unsupported cell types
-                    supportedType = false;
-                    break;
-            }
-            
-            // Free element properties memory
-            gmshFree(elementName);
-            gmshFree(localNodeCoord);
-            
-            if (!supportedType) {
-                continue;
-            }
-            
-            // Process each element of this type
-            // Note: nodes vector is [e1n1, e1n2, ..., e1nN, e2n1, ...]
-            size_t nodeIndex = 0;
-            for (size_t j = 0; j < elements_n; ++j) {
-                MeshData::Cell meshCell;
-                meshCell.type = cellType;
-                meshCell.pointIndices.reserve(numNodes);
-                
-                // Read node indices for this element
-                for (int k = 0; k < numNodes; ++k) {
-                    if (nodeIndex >= nodes_n) break;
-                    size_t nodeTag = nodes[nodeIndex++];
-                    // Find the index of this node in nodeTags
-                    // Note: This is necessary because nodeTags may not be contiguous
-                    size_t nodeIdx = 0;
-                    for (; nodeIdx < nodeTags_n; ++nodeIdx) {
-                        if (nodeTags[nodeIdx] == nodeTag) {
-                            break;
-                        }
-                    }
-                    if (nodeIdx < nodeTags_n) {
-                        meshCell.pointIndices.push_back(static_cast<uint32_t>(nodeIdx));
-                    }
-                }
-                
-                meshData.cells.push_back(meshCell);
-            }
-        }
-        
-        // Free memory
-        gmshFree(nodeTags);
-        gmshFree(coord);
-        gmshFree(parametricCoord);
-        gmshFree(elementTypes);
-        for (size_t i = 0; i < elementTypes_n; ++i) {
-            gmshFree(elementTags[i]);
-            gmshFree(nodeTagsPerElement[i]);
-        }
-        gmshFree(elementTags);
-        gmshFree(elementTags_n);
-        gmshFree(nodeTagsPerElement);
-        gmshFree(nodeTagsPerElement_n);
-        
-        // Calculate metadata
+        const auto startTime = std::chrono::steady_clock::now();
+        GmshParser<Real, Index> parser(mappedFile.data(), mappedFile.size(), options.readThreads);
+        parser.parse(meshData);
+
         meshData.calculateMetadata();
-        
-        // Finalize Gmsh API
-        gmshFinalize(&ierr);
-        
+        meshData.metadata.format = parser.isVersion4() ? MeshFormat::GMSH_V4 : MeshFormat::GMSH_V2;
+        meshData.metadata.formatVersion = parser.version();
+        recordReadThroughput(meshData, mappedFile.size(), startTime);
+
+        errorCode = MeshErrorCode::SUCCESS;
+        errorMsg = "";
         return true;
-        
+
+    } catch (const GmshVersionError& e) {
+        meshData.clear();
+        errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
+        errorMsg = e.what();
+        return false;
     } catch (const std::exception& e) {
-        // Finalize Gmsh API before returning
-        gmshFinalize(&ierr);
+        meshData.clear();
         errorCode = MeshErrorCode::READ_FAILED;
         errorMsg = std::string("Error reading Gmsh file: ") + e.what();
         return false;
-    } catch (...) {
-        // Finalize Gmsh API before returning
-        gmshFinalize(&ierr);
-        errorCode = MeshErrorCode::READ_FAILED;
-        errorMsg = "Unknown error reading Gmsh file";
-        return false;
     }
-    #else
-    // Original file I/O implementation as fallback
-    // This ensures backward compatibility when Gmsh API is not available
-    errorCode = MeshErrorCode::READ_FAILED;
-    errorMsg = "Gmsh API is not available. Please install Gmsh and rebuild the project.";
-    return false;
-    #endif
 }
 
+template bool MeshReader::readGmsh(const std::string&, MeshData&, MeshErrorCode&, std::string&, const FormatReadOptions&);
+template bool MeshReader::readGmsh(const std::string&, MeshData64&, MeshErrorCode&, std::string&, const FormatReadOptions&);
+
 /**
  * @brief Read STL format file (ASCII/Binary)
  * @param filePath File path (UTF-8 encoded)
  * @param[out] meshData Output mesh data
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message (UTF-8)
+ * @param options Read options (stlWeldVertices produces an indexed mesh)
  * @return Whether reading is successful
  */
 bool MeshReader::readSTL(const std::string& filePath,
                         MeshData& meshData,
                         MeshErrorCode& errorCode,
-                        std::string& errorMsg) {
+                        std::string& errorMsg,
+                        const FormatReadOptions& options) {
     // Clear existing data
     meshData.clear();
     
@@ -1241,33 +3346,51 @@ bool MeshReader::readSTL(const std::string& filePath,
     }
     
     try {
-        // Open file
-        std::ifstream file(filePath, std::ios::binary);
-        if (!file.is_open()) {
+        // Map file
+        MappedFile mappedFile;
+        if (!mappedFile.open(filePath, errorMsg)) {
             errorCode = MeshErrorCode::READ_FAILED;
-            errorMsg = "Failed to open file: " + filePath;
             return false;
         }
         
-        // Detect STL format
-        MeshFormat format = detectFormatFromHeader(filePath);
-        if (format != MeshFormat::STL_ASCII && format != MeshFormat::STL_BINARY) {
-            errorCode = MeshErrorCode::FORMAT_UNSUPPORTED;
-            errorMsg = "Not a valid STL file format";
-            return false;
+        // A binary STL is exactly 84 + 50 * n bytes; check this first because
+        // many binary exporters also start the 80-byte header with "solid"
+        bool isBinary = false;
+        if (mappedFile.size() >= 84) {
+            uint32_t triangleCount;
+            std::memcpy(&triangleCount, mappedFile.data() + 80, sizeof(triangleCount));
+            isBinary = mappedFile.size() == 84 + static_cast<uint64_t>(triangleCount) * 50;
         }
         
-        // Reset file position
-        file.clear();
-        file.seekg(0, std::ios::beg);
+        if (!isBinary) {
+            // Otherwise fall back to the "solid" keyword (case-insensitive)
+            std::string keyword(mappedFile.data(), std::min<size_t>(mappedFile.size(), 5));
+            std::transform(keyword.begin(), keyword.end(), keyword.begin(), ::tolower);
+            isBinary = keyword != "solid";
+        }
         
-        if (format == MeshFormat::STL_ASCII) {
-            // Read ASCII STL format
-            return readSTLASCII(file, meshData, errorCode, errorMsg);
+        const auto startTime = std::chrono::steady_clock::now();
+        if (isBinary) {
+            // Read Binary STL format straight from the mapped view
+            if (!readSTLBinary(mappedFile.data(), mappedFile.size(), meshData,
+                               options.stlWeldVertices, errorCode, errorMsg)) {
+                return false;
+            }
         } else {
-            // Read Binary STL format
-            return readSTLBinary(file, meshData, errorCode, errorMsg);
+            // Read ASCII STL format
+            if (!readSTLASCII(mappedFile.data(), mappedFile.size(), meshData, errorCode, errorMsg)) {
+                return false;
+            }
+            if (options.stlWeldVertices) {
+                MeshProcessor::WeldOptions weldOptions;
+                weldOptions.threads = options.readThreads;
+                if (!MeshProcessor::weldPoints(meshData, meshData, weldOptions, errorCode, errorMsg)) {
+                    return false;
+                }
+            }
         }
+        recordReadThroughput(meshData, mappedFile.size(), startTime);
+        return true;
         
     } catch (const std::exception& e) {
         errorCode = MeshErrorCode::READ_FAILED;
@@ -1277,172 +3400,123 @@ bool MeshReader::readSTL(const std::string& filePath,
 }
 
 /**
- * @brief Read ASCII STL format
- * @param file Input file stream
+ * @brief Read ASCII STL format from a mapped buffer
+ * @param data File contents
+ * @param size File size in bytes
  * @param[out] meshData Output mesh data
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message (UTF-8)
  * @return Whether reading is successful
  */
-bool MeshReader::readSTLASCII(std::ifstream& file,
+bool MeshReader::readSTLASCII(const char* data,
+                             size_t size,
                              MeshData& meshData,
                              MeshErrorCode& errorCode,
                              std::string& errorMsg) {
-    std::string line;
-    std::vector<float> currentTriangle;
+    TextTokenizer text(data, size);
+    std::string_view line;
+    ProgressMeter meter;
+    
+    // Reads the next line and strips surrounding whitespace
+    auto nextTrimmedLine = [&text, &line, &meter]() {
+        if (!text.nextLine(line)) {
+            return false;
+        }
+        meter.add(line.size() + 1);
+        line = TextTokenizer::trim(line);
+        return true;
+    };
     
     // Skip solid line
-    if (!std::getline(file, line)) {
+    if (!text.nextLine(line)) {
         errorCode = MeshErrorCode::READ_FAILED;
         errorMsg = "Invalid ASCII STL file: empty file";
         return false;
     }
     
     // Process facets
-    while (std::getline(file, line)) {
-        // Skip empty lines
-        if (line.empty()) continue;
-        
-        // Trim whitespace
-        line.erase(line.begin(), std::find_if(line.begin(), line.end(), [](unsigned char ch) {
-            return !std::isspace(ch);
-        }));
-        
+    while (nextTrimmedLine()) {
         // Check for facet start
-        if (line.substr(0, 6) == "facet ") {
-            // Start of new facet, reset current triangle
-            currentTriangle.clear();
-            
+        if (TextTokenizer::startsWith(line, "facet ")) {
             // Read normal vector
-            std::istringstream normalStream(line.substr(6));
-            std::string normalStr;
-            normalStream >> normalStr; // Should be "normal"
+            TextTokenizer normalTokens(line.substr(6));
+            std::string_view normalStr;
+            normalTokens.nextToken(normalStr); // Should be "normal"
             
             float nx, ny, nz;
-            if (!(normalStream >> nx >> ny >> nz)) {
+            if (!(normalTokens.next(nx) && normalTokens.next(ny) && normalTokens.next(nz))) {
                 errorCode = MeshErrorCode::READ_FAILED;
                 errorMsg = "Invalid ASCII STL file: malformed normal vector";
                 return false;
             }
             
             // Read outer loop
-            if (!std::getline(file, line)) {
+            if (!nextTrimmedLine()) {
                 errorCode = MeshErrorCode::READ_FAILED;
                 errorMsg = "Invalid ASCII STL file: unexpected end of file";
                 return false;
             }
-            
-            // Trim whitespace
-            line.erase(line.begin(), std::find_if(line.begin(), line.end(), [](unsigned char ch) {
-                return !std::isspace(ch);
-            }));
-            
-            // Remove trailing whitespace
-            line.erase(std::find_if(line.rbegin(), line.rend(), [](unsigned char ch) {
-                return !std::isspace(ch);
-            }).base(), line.end());
-            
             if (line != "outer loop") {
                 errorCode = MeshErrorCode::READ_FAILED;
-                errorMsg = "Invalid ASCII STL file: expected 'outer loop', got '" + line + "'";
+                errorMsg = "Invalid ASCII STL file: expected 'outer loop', got '" + std::string(line) + "'";
                 return false;
             }
             
             // Read three vertices
+            float triangle[9];
             for (int i = 0; i < 3; ++i) {
-                if (!std::getline(file, line)) {
+                if (!nextTrimmedLine()) {
                     errorCode = MeshErrorCode::READ_FAILED;
                     errorMsg = "Invalid ASCII STL file: unexpected end of file";
                     return false;
                 }
                 
-                // Trim whitespace
-                line.erase(line.begin(), std::find_if(line.begin(), line.end(), [](unsigned char ch) {
-                    return !std::isspace(ch);
-                }));
-                
-                if (line.substr(0, 7) != "vertex ") {
+                if (!TextTokenizer::startsWith(line, "vertex ")) {
                     errorCode = MeshErrorCode::READ_FAILED;
                     errorMsg = "Invalid ASCII STL file: expected 'vertex'";
                     return false;
                 }
                 
                 // Read vertex coordinates
-                std::istringstream vertexStream(line.substr(7));
-                float x, y, z;
-                if (!(vertexStream >> x >> y >> z)) {
+                TextTokenizer vertexTokens(line.substr(7));
+                if (!(vertexTokens.next(triangle[i * 3]) &&
+                      vertexTokens.next(triangle[i * 3 + 1]) &&
+                      vertexTokens.next(triangle[i * 3 + 2]))) {
                     errorCode = MeshErrorCode::READ_FAILED;
                     errorMsg = "Invalid ASCII STL file: malformed vertex coordinates";
                     return false;
                 }
-                
-                // Add vertex to current triangle
-                currentTriangle.push_back(x);
-                currentTriangle.push_back(y);
-                currentTriangle.push_back(z);
             }
             
             // Read endloop
-            if (!std::getline(file, line)) {
+            if (!nextTrimmedLine()) {
                 errorCode = MeshErrorCode::READ_FAILED;
                 errorMsg = "Invalid ASCII STL file: unexpected end of file";
                 return false;
             }
-            
-            // Trim whitespace
-            line.erase(line.begin(), std::find_if(line.begin(), line.end(), [](unsigned char ch) {
-                return !std::isspace(ch);
-            }));
-            
-            // Remove trailing whitespace
-            line.erase(std::find_if(line.rbegin(), line.rend(), [](unsigned char ch) {
-                return !std::isspace(ch);
-            }).base(), line.end());
-            
             if (line != "endloop") {
                 errorCode = MeshErrorCode::READ_FAILED;
-                errorMsg = "Invalid ASCII STL file: expected 'endloop', got '" + line + "'";
+                errorMsg = "Invalid ASCII STL file: expected 'endloop', got '" + std::string(line) + "'";
                 return false;
             }
             
             // Read endfacet
-            if (!std::getline(file, line)) {
+            if (!nextTrimmedLine()) {
                 errorCode = MeshErrorCode::READ_FAILED;
                 errorMsg = "Invalid ASCII STL file: unexpected end of file";
                 return false;
             }
-            
-            // Trim whitespace
-            line.erase(line.begin(), std::find_if(line.begin(), line.end(), [](unsigned char ch) {
-                return !std::isspace(ch);
-            }));
-            
-            // Remove trailing whitespace
-            line.erase(std::find_if(line.rbegin(), line.rend(), [](unsigned char ch) {
-                return !std::isspace(ch);
-            }).base(), line.end());
-            
             if (line != "endfacet") {
                 errorCode = MeshErrorCode::READ_FAILED;
-                errorMsg = "Invalid ASCII STL file: expected 'endfacet', got '" + line + "'";
+                errorMsg = "Invalid ASCII STL file: expected 'endfacet', got '" + std::string(line) + "'";
                 return false;
             }
             
             // Add triangle to mesh data
-            if (currentTriangle.size() == 9) { // 3 vertices * 3 coordinates
-                // Add points
-                size_t startIndex = meshData.points.size() / 3;
-                meshData.points.insert(meshData.points.end(), currentTriangle.begin(), currentTriangle.end());
-                
-                // Add cell
-                MeshData::Cell cell;
-                cell.type = VtkCellType::TRIANGLE;
-                cell.pointIndices.push_back(static_cast<uint32_t>(startIndex));
-                cell.pointIndices.push_back(static_cast<uint32_t>(startIndex + 1));
-                cell.pointIndices.push_back(static_cast<uint32_t>(startIndex + 2));
-                meshData.cells.push_back(cell);
-            }
-        } else if (line.substr(0, 8) == "endsolid") {
+            const uint32_t base = static_cast<uint32_t>(meshData.points.size() / 3);
+            meshData.points.insert(meshData.points.end(), triangle, triangle + 9);
+            meshData.cells.addCell(VtkCellType::TRIANGLE, {base, base + 1, base + 2});
+        } else if (TextTokenizer::startsWith(line, "endsolid")) {
             // End of solid, done reading
             break;
         }
@@ -1462,20 +3536,26 @@ bool MeshReader::readSTLASCII(std::ifstream& file,
 }
 
 /**
- * @brief Read Binary STL format
- * @param file Input file stream
+ * @brief Read Binary STL format from a mapped buffer
+ * @param data File contents
+ * @param size File size in bytes
  * @param[out] meshData Output mesh data
+ * @param weldVertices Whether to merge bit-identical vertices
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message (UTF-8)
  * @return Whether reading is successful
  */
-bool MeshReader::readSTLBinary(std::ifstream& file,
+bool MeshReader::readSTLBinary(const char* data,
+                              size_t size,
                               MeshData& meshData,
+                              bool weldVertices,
                               MeshErrorCode& errorCode,
                               std::string& errorMsg) {
-    // Skip 80-byte header
-    char header[80];
-    if (!file.read(header, 80)) {
+    const size_t HEADER_SIZE = 84;  // 80-byte header + uint32 triangle count
+    const size_t RECORD_SIZE = 50;  // normal (12) + 3 vertices (36) + attribute count (2)
+    const size_t NORMAL_SIZE = 12;
+    
+    if (!data || size < HEADER_SIZE) {
         errorCode = MeshErrorCode::READ_FAILED;
         errorMsg = "Invalid binary STL file: incomplete header";
         return false;
@@ -1483,102 +3563,66 @@ bool MeshReader::readSTLBinary(std::ifstream& file,
     
     // Read number of triangles
     uint32_t triangleCount;
-    if (!file.read(reinterpret_cast<char*>(&triangleCount), sizeof(triangleCount))) {
-        errorCode = MeshErrorCode::READ_FAILED;
-        errorMsg = "Invalid binary STL file: incomplete triangle count";
-        return false;
-    }
+    std::memcpy(&triangleCount, data + 80, sizeof(triangleCount));
     
-    // Validate triangle count
-    const uint32_t MAX_TRIANGLES = 10000000; // 10 million triangles as reasonable limit
+    // Validate triangle count against the actual file size
     if (triangleCount == 0) {
         errorCode = MeshErrorCode::MESH_EMPTY;
         errorMsg = "Binary STL file contains no triangles";
         return false;
     }
-    if (triangleCount > MAX_TRIANGLES) {
-        errorCode = MeshErrorCode::READ_FAILED;
-        errorMsg = "Binary STL file declares too many triangles: " + std::to_string(triangleCount) + 
-                  " (maximum allowed: " + std::to_string(MAX_TRIANGLES) + ")";
-        return false;
-    }
-    
-    // Calculate expected file size to validate
-    std::streampos currentPos = file.tellg();
-    file.seekg(0, std::ios::end);
-    std::streampos fileEnd = file.tellg();
-    file.seekg(currentPos);
-    
-    // Calculate total file size and data size
-    uint64_t totalFileSize = static_cast<uint64_t>(fileEnd);
-    uint64_t expectedDataSize = static_cast<uint64_t>(triangleCount) * 50; // 50 bytes per triangle
-    uint64_t expectedTotalSize = 84 + expectedDataSize; // 84 bytes header + data
-    
-    if (totalFileSize < expectedTotalSize) {
+    const uint64_t expectedTotalSize = HEADER_SIZE + static_cast<uint64_t>(triangleCount) * RECORD_SIZE;
+    if (size < expectedTotalSize) {
         errorCode = MeshErrorCode::READ_FAILED;
         errorMsg = "Binary STL file is too small for declared triangle count";
         return false;
     }
-    
-    // Reserve space for points and cells
-    try {
-        meshData.points.reserve(triangleCount * 9); // 3 vertices * 3 coordinates per triangle
-        meshData.cells.reserve(triangleCount);
-    } catch (const std::bad_alloc&) {
-        errorCode = MeshErrorCode::READ_FAILED;
-        errorMsg = "Insufficient memory to read STL file: triangle count too large";
-        return false;
-    } catch (const std::exception& e) {
+    if (static_cast<uint64_t>(triangleCount) * 3 > std::numeric_limits<uint32_t>::max()) {
         errorCode = MeshErrorCode::READ_FAILED;
-        errorMsg = "Error reserving memory for STL file: " + std::string(e.what());
+        errorMsg = "Binary STL file declares too many triangles: " + std::to_string(triangleCount);
         return false;
     }
     
-    // Read triangles
-    for (uint32_t i = 0; i < triangleCount; ++i) {
-        // Read normal vector (3 floats)
-        float normal[3];
-        if (!file.read(reinterpret_cast<char*>(normal), sizeof(normal))) {
-            errorCode = MeshErrorCode::READ_FAILED;
-            errorMsg = "Invalid binary STL file: incomplete normal vector";
-            return false;
-        }
-        
-        // Read 3 vertices (9 floats)
-        float vertices[9];
-        if (!file.read(reinterpret_cast<char*>(vertices), sizeof(vertices))) {
-            errorCode = MeshErrorCode::READ_FAILED;
-            errorMsg = "Invalid binary STL file: incomplete vertex data";
-            return false;
-        }
-        
-        // Read 2-byte attribute count (usually 0)
-        uint16_t attributeCount;
-        if (!file.read(reinterpret_cast<char*>(&attributeCount), sizeof(attributeCount))) {
-            errorCode = MeshErrorCode::READ_FAILED;
-            errorMsg = "Invalid binary STL file: incomplete attribute count";
-            return false;
+    const size_t n = triangleCount;
+    const char* records = data + HEADER_SIZE;
+    MeshData::CellArray& cells = meshData.cells;
+    
+    try {
+        // Topology is known up front: n triangles with 3 indices each
+        cells.types.assign(n, VtkCellType::TRIANGLE);
+        cells.offsets.resize(n + 1);
+        for (size_t i = 0; i <= n; ++i) {
+            cells.offsets[i] = static_cast<uint32_t>(i * 3);
         }
+        cells.connectivity.resize(n * 3);
         
-        // Add points
-        size_t startIndex = meshData.points.size() / 3;
-        for (int j = 0; j < 9; ++j) {
-            meshData.points.push_back(vertices[j]);
+        if (!weldVertices) {
+            // Copy the 36 vertex bytes of each record directly into the point array
+            meshData.points.resize(n * 9);
+            float* out = meshData.points.data();
+            ProgressMeter meter;
+            for (size_t i = 0; i < n; ++i) {
+                std::memcpy(out + i * 9, records + i * RECORD_SIZE + NORMAL_SIZE, 9 * sizeof(float));
+                meter.add(RECORD_SIZE);
+            }
+            std::iota(cells.connectivity.begin(), cells.connectivity.end(), 0u);
+        } else {
+            // Weld while parsing: every corner is looked up in the hash table once
+            ExactVertexWelder welder(meshData.points, n * 3);
+            uint32_t* connectivity = cells.connectivity.data();
+            ProgressMeter meter;
+            for (size_t i = 0; i < n; ++i) {
+                const char* vertex = records + i * RECORD_SIZE + NORMAL_SIZE;
+                connectivity[i * 3] = welder.insert(vertex);
+                connectivity[i * 3 + 1] = welder.insert(vertex + 12);
+                connectivity[i * 3 + 2] = welder.insert(vertex + 24);
+                meter.add(RECORD_SIZE);
+            }
         }
-        
-        // Add cell
-        MeshData::Cell cell;
-        cell.type = VtkCellType::TRIANGLE;
-        cell.pointIndices.push_back(static_cast<uint32_t>(startIndex));
-        cell.pointIndices.push_back(static_cast<uint32_t>(startIndex + 1));
-        cell.pointIndices.push_back(static_cast<uint32_t>(startIndex + 2));
-        meshData.cells.push_back(cell);
-    }
-    
-    // Check if any triangles were read
-    if (meshData.cells.empty()) {
-        errorCode = MeshErrorCode::MESH_EMPTY;
-        errorMsg = "No triangles found in binary STL file";
+    } catch (const std::bad_alloc&) {
+        meshData.clear();
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = "Insufficient memory to read STL file: triangle count too large";
         return false;
     }
     
@@ -1594,12 +3638,14 @@ bool MeshReader::readSTLBinary(std::ifstream& file,
  * @param[out] meshData Output mesh data
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message (UTF-8)
+ * @param options Read options (readThreads controls chunk-parallel parsing)
  * @return Whether reading is successful
  */
 bool MeshReader::readOBJ(const std::string& filePath,
                         MeshData& meshData,
                         MeshErrorCode& errorCode,
-                        std::string& errorMsg) {
+                        std::string& errorMsg,
+                        const FormatReadOptions& options) {
     // Clear existing data
     meshData.clear();
     
@@ -1611,130 +3657,52 @@ bool MeshReader::readOBJ(const std::string& filePath,
     }
     
     try {
-        // Open file
-        std::ifstream file(filePath);
-        if (!file.is_open()) {
+        // Map file
+        MappedFile mappedFile;
+        if (!mappedFile.open(filePath, errorMsg)) {
             errorCode = MeshErrorCode::READ_FAILED;
-            errorMsg = "Failed to open file: " + filePath;
             return false;
         }
+        const auto startTime = std::chrono::steady_clock::now();
         
-        std::string line;
-        std::vector<float> vertices;
-        std::vector<std::vector<uint32_t>> faces;
+        // Parse line-aligned chunks on separate threads (a single chunk for small files)
+        const std::string_view fileText(mappedFile.data(), mappedFile.size());
+        const std::vector<std::string_view> chunkTexts =
+            splitAtLines(fileText, parallelChunkCount(fileText.size(), options.readThreads));
+        std::vector<MeshTextParser::ObjChunk> chunks(chunkTexts.size());
+        runParallel(chunks.size(), [&](size_t i) {
+            MeshTextParser::parseOBJChunk(chunkTexts[i], chunks[i]);
+        });
         
-        // Read file line by line
-        while (std::getline(file, line)) {
-            // Skip empty lines
-            if (line.empty()) continue;
-            
-            // Trim whitespace
-            line.erase(line.begin(), std::find_if(line.begin(), line.end(), [](unsigned char ch) {
-                return !std::isspace(ch);
-            }));
-            
-            // Skip comments
-            if (line.empty() || line[0] == '#') continue;
-            
-            // Check if it's a vertex definition
-            if (line.substr(0, 2) == "v ") {
-                std::istringstream vertexStream(line.substr(2));
-                float x, y, z;
-                if (vertexStream >> x >> y >> z) {
-                    vertices.push_back(x);
-                    vertices.push_back(y);
-                    vertices.push_back(z);
-                }
-            }
-            // Check if it's a face definition
-            else if (line.substr(0, 2) == "f ") {
-                std::istringstream faceStream(line.substr(2));
-                std::vector<uint32_t> faceIndices;
-                std::string vertexRef;
-                
-                while (faceStream >> vertexRef) {
-                    // OBJ uses 1-based indices, so subtract 1 to make it 0-based
-                    size_t slashPos = vertexRef.find('/');
-                    std::string vertexIndexStr = vertexRef.substr(0, slashPos);
-                    uint32_t vertexIndex = std::stoi(vertexIndexStr) - 1;
-                    faceIndices.push_back(vertexIndex);
-                }
-                
-                if (!faceIndices.empty()) {
-                    faces.push_back(faceIndices);
-                }
-            }
-            // Check if it's a line definition
-            else if (line.substr(0, 2) == "l ") {
-                std::istringstream lineStream(line.substr(2));
-                std::vector<uint32_t> lineIndices;
-                std::string vertexRef;
-                
-                while (lineStream >> vertexRef) {
-                    // OBJ uses 1-based indices, so subtract 1 to make it 0-based
-                    size_t slashPos = vertexRef.find('/');
-                    std::string vertexIndexStr = vertexRef.substr(0, slashPos);
-                    uint32_t vertexIndex = std::stoi(vertexIndexStr) - 1;
-                    lineIndices.push_back(vertexIndex);
-                }
-                
-                if (!lineIndices.empty()) {
-                    // For lines, create line cells
-                    MeshData::Cell cell;
-                    cell.type = VtkCellType::LINE;
-                    
-                    for (uint32_t index : lineIndices) {
-                        cell.pointIndices.push_back(index);
-                    }
-                    
-                    meshData.cells.push_back(cell);
-                }
+        // Report the first error in file order
+        for (const MeshTextParser::ObjChunk& chunk : chunks) {
+            if (!chunk.error.empty()) {
+                errorCode = MeshErrorCode::READ_FAILED;
+                errorMsg = chunk.error;
+                return false;
             }
         }
         
+        // Concatenate vertices, then line cells followed by faces
+        std::vector<std::vector<float>*> vertexParts;
+        std::vector<MeshData::CellArray*> cellParts;
+        for (MeshTextParser::ObjChunk& chunk : chunks) {
+            vertexParts.push_back(&chunk.vertices);
+            cellParts.push_back(&chunk.lines);
+        }
+        for (MeshTextParser::ObjChunk& chunk : chunks) {
+            cellParts.push_back(&chunk.faces);
+        }
+        concatenatePoints(vertexParts, meshData.points);
+        
         // Check if any data was read
-        if (vertices.empty()) {
+        if (meshData.points.empty()) {
             errorCode = MeshErrorCode::MESH_EMPTY;
             errorMsg = "No vertices found in OBJ file";
             return false;
         }
         
-        // Check if vertices form complete triplets
-        if (vertices.size() % 3 != 0) {
-            errorCode = MeshErrorCode::READ_FAILED;
-            errorMsg = "Invalid vertex data in OBJ file";
-            return false;
-        }
-        
-        // Add vertices to meshData
-        meshData.points = vertices;
-        
-        // Add faces to meshData
-        for (const auto& faceIndices : faces) {
-            if (faceIndices.size() < 3) {
-                // Skip faces with less than 3 vertices
-                continue;
-            }
-            
-            MeshData::Cell cell;
-            
-            // Determine cell type based on number of vertices
-            if (faceIndices.size() == 3) {
-                cell.type = VtkCellType::TRIANGLE;
-            } else if (faceIndices.size() == 4) {
-                cell.type = VtkCellType::QUAD;
-            } else {
-                // For polygons with more than 4 vertices, use POLYGON type
-                cell.type = VtkCellType::POLYGON;
-            }
-            
-            // Add vertex indices
-            for (uint32_t index : faceIndices) {
-                cell.pointIndices.push_back(index);
-            }
-            
-            meshData.cells.push_back(cell);
-        }
+        concatenateCells(cellParts, meshData.cells);
         
         // Check if any cells were added
         if (meshData.cells.empty()) {
@@ -1745,6 +3713,7 @@ bool MeshReader::readOBJ(const std::string& filePath,
         
         // Calculate metadata
         meshData.calculateMetadata();
+        recordReadThroughput(meshData, mappedFile.size(), startTime);
         
         return true;
         
@@ -1778,49 +3747,46 @@ bool MeshReader::readPLY(const std::string& filePath,
     }
     
     try {
-        // Open file
-        std::ifstream file(filePath, std::ios::binary);
-        if (!file.is_open()) {
+        // Map file
+        MappedFile mappedFile;
+        if (!mappedFile.open(filePath, errorMsg)) {
             errorCode = MeshErrorCode::READ_FAILED;
-            errorMsg = "Failed to open file: " + filePath;
             return false;
         }
+        const auto startTime = std::chrono::steady_clock::now();
         
         // Read header
-        std::string line;
+        TextTokenizer text(mappedFile.data(), mappedFile.size());
+        std::string_view line;
         bool headerEnd = false;
         bool isBinary = false;
         uint32_t vertexCount = 0;
         uint32_t faceCount = 0;
         
         // Read first line
-        if (!std::getline(file, line)) {
+        if (!text.nextLine(line)) {
             errorCode = MeshErrorCode::READ_FAILED;
             errorMsg = "Invalid PLY file: empty file";
             return false;
         }
         
         // Check if it's a PLY file
-        if (line != "ply") {
+        if (TextTokenizer::trim(line) != "ply") {
             errorCode = MeshErrorCode::READ_FAILED;
             errorMsg = "Invalid PLY file: missing 'ply' header";
             return false;
         }
         
         // Read header lines
-        while (!headerEnd && std::getline(file, line)) {
-            // Trim whitespace
-            line.erase(line.begin(), std::find_if(line.begin(), line.end(), [](unsigned char ch) {
-                return !std::isspace(ch);
-            }));
-            
-            if (line.empty()) continue;
+        while (!headerEnd && text.nextLine(line)) {
+            TextTokenizer tokens(line);
+            std::string_view keyword;
+            if (!tokens.nextToken(keyword)) continue;
             
             // Check for format
-            if (line.substr(0, 7) == "format ") {
-                std::istringstream formatStream(line.substr(7));
-                std::string format, version;
-                formatStream >> format >> version;
+            if (keyword == "format") {
+                std::string_view format;
+                tokens.nextToken(format);
                 
                 if (format == "binary_little_endian") {
                     isBinary = true;
@@ -1835,11 +3801,11 @@ bool MeshReader::readPLY(const std::string& filePath,
                 }
             }
             // Check for element vertex
-            else if (line.substr(0, 8) == "element ") {
-                std::istringstream elementStream(line.substr(8));
-                std::string elementName;
-                uint32_t count;
-                elementStream >> elementName >> count;
+            else if (keyword == "element") {
+                std::string_view elementName;
+                uint32_t count = 0;
+                tokens.nextToken(elementName);
+                tokens.next(count);
                 
                 if (elementName == "vertex") {
                     vertexCount = count;
@@ -1848,7 +3814,7 @@ bool MeshReader::readPLY(const std::string& filePath,
                 }
             }
             // Check for end of header
-            else if (line == "end_header") {
+            else if (keyword == "end_header") {
                 headerEnd = true;
             }
         }
@@ -1866,92 +3832,121 @@ bool MeshReader::readPLY(const std::string& filePath,
             return false;
         }
         
-        // Read vertices
         std::vector<float> vertices;
-        vertices.reserve(vertexCount * 3);
+        MeshData::CellArray cells;
+        std::vector<uint32_t> pointIndices;
         
-        // Read vertex data
-        for (uint32_t i = 0; i < vertexCount; ++i) {
-            float x, y, z;
-            
-            // Read x coordinate
-            if (!file.read(reinterpret_cast<char*>(&x), sizeof(float))) {
-                errorCode = MeshErrorCode::READ_FAILED;
-                errorMsg = "Invalid PLY file: incomplete vertex data";
-                return false;
-            }
-            
-            // Read y coordinate
-            if (!file.read(reinterpret_cast<char*>(&y), sizeof(float))) {
-                errorCode = MeshErrorCode::READ_FAILED;
-                errorMsg = "Invalid PLY file: incomplete vertex data";
-                return false;
+        // Determine cell type based on number of vertices
+        auto faceType = [](size_t count) {
+            if (count == 3) {
+                return VtkCellType::TRIANGLE;
+            } else if (count == 4) {
+                return VtkCellType::QUAD;
             }
+            return VtkCellType::POLYGON;
+        };
+        
+        if (isBinary) {
+            // Binary body: xyz float32 per vertex, uint8 count + int32 indices per face
+            const char* body = text.current();
+            const char* bodyEnd = mappedFile.data() + mappedFile.size();
             
-            // Read z coordinate
-            if (!file.read(reinterpret_cast<char*>(&z), sizeof(float))) {
+            // Read vertex data
+            const size_t vertexBytes = static_cast<size_t>(vertexCount) * 3 * sizeof(float);
+            if (static_cast<size_t>(bodyEnd - body) < vertexBytes) {
                 errorCode = MeshErrorCode::READ_FAILED;
                 errorMsg = "Invalid PLY file: incomplete vertex data";
                 return false;
             }
+            vertices.resize(static_cast<size_t>(vertexCount) * 3);
+            std::memcpy(vertices.data(), body, vertexBytes);
+            body += vertexBytes;
+            ProgressMeter meter;
             
-            // Add vertex
-            vertices.push_back(x);
-            vertices.push_back(y);
-            vertices.push_back(z);
-        }
-        
-        // Read faces
-        std::vector<MeshData::Cell> cells;
-        cells.reserve(faceCount);
-        
-        // Read face data
-        for (uint32_t i = 0; i < faceCount; ++i) {
-            uint8_t vertexCountPerFace;
-            
-            // Read vertex count per face
-            if (!file.read(reinterpret_cast<char*>(&vertexCountPerFace), sizeof(uint8_t))) {
+            // Read face data
+            cells.reserve(faceCount, static_cast<size_t>(faceCount) * 3);
+            for (uint32_t i = 0; i < faceCount; ++i) {
+                meter.reach(static_cast<uint64_t>(body - mappedFile.data()));
                 // Skip face data if we can't read it
                 // This allows us to read the file even if there's an issue with the face data
-                break;
+                if (body == bodyEnd) {
+                    break;
+                }
+                const uint8_t vertexCountPerFace = static_cast<uint8_t>(*body++);
+                const size_t indexBytes = vertexCountPerFace * sizeof(int32_t);
+                if (static_cast<size_t>(bodyEnd - body) < indexBytes) {
+                    break;
+                }
+                
+                pointIndices.resize(vertexCountPerFace);
+                for (uint8_t j = 0; j < vertexCountPerFace; ++j) {
+                    int32_t index;
+                    std::memcpy(&index, body + j * sizeof(int32_t), sizeof(int32_t));
+                    pointIndices[j] = static_cast<uint32_t>(index);
+                }
+                body += indexBytes;
+                
+                if (vertexCountPerFace >= 3) {
+                    cells.addCell(faceType(vertexCountPerFace), pointIndices);
+                }
             }
-            
-            // Read vertex indices
-            std::vector<int> indices(vertexCountPerFace);
-            if (!file.read(reinterpret_cast<char*>(indices.data()), vertexCountPerFace * sizeof(int))) {
-                // Skip face data if we can't read it
-                // This allows us to read the file even if there's an issue with the face data
-                break;
+        } else {
+            // ASCII body: one element per line, extra properties after xyz are ignored
+            ProgressMeter meter;
+            vertices.reserve(static_cast<size_t>(vertexCount) * 3);
+            for (uint32_t i = 0; i < vertexCount; ++i) {
+                float x, y, z;
+                TextTokenizer tokens;
+                if (text.nextLine(line)) {
+                    tokens = TextTokenizer(line);
+                }
+                meter.reach(text.position());
+                if (!(tokens.next(x) && tokens.next(y) && tokens.next(z))) {
+                    errorCode = MeshErrorCode::READ_FAILED;
+                    errorMsg = "Invalid PLY file: incomplete vertex data";
+                    return false;
+                }
+                vertices.push_back(x);
+                vertices.push_back(y);
+                vertices.push_back(z);
             }
             
-            // Create cell
-            if (vertexCountPerFace >= 3) {
-                MeshData::Cell cell;
-                
-                // Determine cell type based on number of vertices
-                if (vertexCountPerFace == 3) {
-                    cell.type = VtkCellType::TRIANGLE;
-                } else if (vertexCountPerFace == 4) {
-                    cell.type = VtkCellType::QUAD;
-                } else {
-                    cell.type = VtkCellType::POLYGON;
+            cells.reserve(faceCount, static_cast<size_t>(faceCount) * 3);
+            for (uint32_t i = 0; i < faceCount; ++i) {
+                if (!text.nextLine(line)) {
+                    break;
+                }
+                meter.reach(text.position());
+                TextTokenizer tokens(line);
+                uint32_t vertexCountPerFace = 0;
+                if (!tokens.next(vertexCountPerFace)) {
+                    break;
                 }
                 
-                // Add vertex indices
-                for (int index : indices) {
-                    cell.pointIndices.push_back(static_cast<uint32_t>(index));
+                pointIndices.resize(vertexCountPerFace);
+                bool complete = true;
+                for (uint32_t j = 0; j < vertexCountPerFace && complete; ++j) {
+                    int64_t index = 0;
+                    complete = tokens.next(index);
+                    pointIndices[j] = static_cast<uint32_t>(index);
+                }
+                if (!complete) {
+                    break;
                 }
                 
-                cells.push_back(cell);
+                if (vertexCountPerFace >= 3) {
+                    cells.addCell(faceType(vertexCountPerFace), pointIndices);
+                }
             }
         }
         
         // Add data to meshData
-        meshData.points = vertices;
-        meshData.cells = cells;
+        meshData.points = std::move(vertices);
+        meshData.cells = std::move(cells);
         
         // Calculate metadata
         meshData.calculateMetadata();
+        recordReadThroughput(meshData, mappedFile.size(), startTime);
         
         return true;
         
@@ -1977,107 +3972,108 @@ bool MeshReader::readOFF(const std::string& filePath,
     // Clear existing mesh data
     meshData.clear();
     
-    // Open file
-    std::ifstream file(filePath);
-    if (!file.is_open()) {
+    // Map file
+    MappedFile mappedFile;
+    std::string mapError;
+    if (!mappedFile.open(filePath, mapError)) {
         errorCode = MeshErrorCode::FILE_NOT_EXIST;
         errorMsg = "File not found or cannot be opened";
         return false;
     }
+    const auto startTime = std::chrono::steady_clock::now();
+    TextTokenizer text(mappedFile.data(), mappedFile.size());
     
     // Read header
-    std::string header;
-    if (!std::getline(file, header)) {
+    std::string_view header;
+    if (!text.nextLine(header)) {
         errorCode = MeshErrorCode::READ_FAILED;
         errorMsg = "Failed to read OFF header";
-        file.close();
         return false;
     }
     
     // Check header
-    std::istringstream headerStream(header);
-    std::string magic;
-    headerStream >> magic;
+    TextTokenizer headerTokens(header);
+    std::string_view magic;
+    headerTokens.nextToken(magic);
     
     if (magic != "OFF") {
         errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
         errorMsg = "Invalid OFF header. Expected 'OFF'";
-        file.close();
         return false;
     }
     
     // Read vertex, face, edge counts
     int numVertices, numFaces, numEdges;
-    if (!(file >> numVertices >> numFaces >> numEdges)) {
+    if (!(text.next(numVertices) && text.next(numFaces) && text.next(numEdges)) ||
+        numVertices < 0 || numFaces < 0) {
         errorCode = MeshErrorCode::READ_FAILED;
         errorMsg = "Failed to read vertex, face, edge counts";
-        file.close();
         return false;
     }
     
     // Read vertices
-    meshData.points.reserve(numVertices * 3);
-    for (int i = 0; i < numVertices; ++i) {
-        float x, y, z;
-        if (!(file >> x >> y >> z)) {
+    ProgressMeter meter;
+    meshData.points.resize(static_cast<size_t>(numVertices) * 3);
+    float* point = meshData.points.data();
+    for (int i = 0; i < numVertices; ++i, point += 3) {
+        meter.reach(text.position());
+        if (!(text.next(point[0]) && text.next(point[1]) && text.next(point[2]))) {
+            meshData.clear();
             errorCode = MeshErrorCode::READ_FAILED;
             errorMsg = "Failed to read vertex coordinates";
-            file.close();
             return false;
         }
-        meshData.points.push_back(x);
-        meshData.points.push_back(y);
-        meshData.points.push_back(z);
     }
     
     // Read faces
-    meshData.cells.reserve(numFaces);
+    meshData.cells.reserve(numFaces, static_cast<size_t>(numFaces) * 3);
+    std::vector<uint32_t> pointIndices;
     for (int i = 0; i < numFaces; ++i) {
+        meter.reach(text.position());
         int numFaceVertices;
-        if (!(file >> numFaceVertices)) {
+        if (!text.next(numFaceVertices) || numFaceVertices < 0) {
+            meshData.clear();
             errorCode = MeshErrorCode::READ_FAILED;
             errorMsg = "Failed to read face vertex count";
-            file.close();
             return false;
         }
         
-        std::vector<uint32_t> pointIndices;
-        pointIndices.reserve(numFaceVertices);
-        
+        pointIndices.resize(numFaceVertices);
         for (int j = 0; j < numFaceVertices; ++j) {
             int vertexIndex;
-            if (!(file >> vertexIndex)) {
+            if (!text.next(vertexIndex)) {
+                meshData.clear();
                 errorCode = MeshErrorCode::READ_FAILED;
                 errorMsg = "Failed to read face vertex index";
-                file.close();
                 return false;
             }
-            pointIndices.push_back(static_cast<uint32_t>(vertexIndex));
+            pointIndices[j] = static_cast<uint32_t>(vertexIndex);
         }
         
+        // Optional per-face color values follow the indices on the same line
+        std::string_view faceRest;
+        text.nextLine(faceRest);
+        
         // Create cell based on number of vertices
-        MeshData::Cell cell;
+        VtkCellType cellType;
         switch (numFaceVertices) {
         case 3:
-            cell.type = VtkCellType::TRIANGLE;
+            cellType = VtkCellType::TRIANGLE;
             break;
         case 4:
-            cell.type = VtkCellType::QUAD;
+            cellType = VtkCellType::QUAD;
             break;
         default:
-            cell.type = VtkCellType::POLYGON;
+            cellType = VtkCellType::POLYGON;
             break;
         }
-        cell.pointIndices = std::move(pointIndices);
-        meshData.cells.push_back(std::move(cell));
+        meshData.cells.addCell(cellType, pointIndices);
     }
     
-    // Close file
-    file.close();
-    
     // Calculate metadata
     meshData.calculateMetadata();
     meshData.metadata.format = MeshFormat::OFF;
+    recordReadThroughput(meshData, mappedFile.size(), startTime);
     
     // Set success
     errorCode = MeshErrorCode::SUCCESS;
@@ -2091,12 +4087,15 @@ bool MeshReader::readOFF(const std::string& filePath,
  * @param[out] meshData Output mesh data
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message (UTF-8)
+ * @param options Read options (readThreads controls chunk-parallel parsing)
  * @return Whether reading is successful
  */
+template<typename Real, typename Index>
 bool MeshReader::readSU2(const std::string& filePath,
-                        MeshData& meshData,
+                        BasicMeshData<Real, Index>& meshData,
                         MeshErrorCode& errorCode,
-                        std::string& errorMsg) {
+                        std::string& errorMsg,
+                        const FormatReadOptions& options) {
     meshData.clear();
 
     if (!fileExists(filePath)) {
@@ -2105,343 +4104,319 @@ bool MeshReader::readSU2(const std::string& filePath,
         return false;
     }
 
-    std::ifstream file(filePath);
-    if (!file.is_open()) {
+    MappedFile mappedFile;
+    if (!mappedFile.open(filePath, errorMsg)) {
         errorCode = MeshErrorCode::READ_FAILED;
-        errorMsg = "Failed to open file: " + filePath;
         return false;
     }
 
     try {
-        std::string line;
+        const auto startTime = std::chrono::steady_clock::now();
+        TextTokenizer text(mappedFile.data(), mappedFile.size());
+        std::string_view line;
         int ndime = 3;
         int nelem = 0;
         int npoin = 0;
 
-        while (std::getline(file, line)) {
+        // Advances over the next count lines and returns them as one block
+        auto takeLines = [&text](int count, std::string_view& block) {
+            const char* blockBegin = text.current();
+            std::string_view skipped;
+            for (int i = 0; i < count; ++i) {
+                if (!text.nextLine(skipped)) {
+                    return false;
+                }
+            }
+            block = std::string_view(blockBegin, static_cast<size_t>(text.current() - blockBegin));
+            return true;
+        };
+
+        while (text.nextLine(line)) {
             if (line.empty() || line[0] == '%') {
                 continue;
             }
 
-            std::istringstream iss(line);
-            std::string key;
-            if (std::getline(iss, key, '=')) {
-                key.erase(0, key.find_first_not_of(" \t"));
-                key.erase(key.find_last_not_of(" \t") + 1);
-                
-                std::string valueStr;
-                if (std::getline(iss, valueStr)) {
-                    valueStr.erase(0, valueStr.find_first_not_of(" \t"));
-                    valueStr.erase(valueStr.find_last_not_of(" \t") + 1);
-                    
-                    if (key == "NDIME") {
-                        ndime = std::stoi(valueStr);
-                    } else if (key == "NELEM") {
-                        nelem = std::stoi(valueStr);
-                        meshData.cells.reserve(nelem);
-
-                        for (int i = 0; i < nelem; ++i) {
-                            if (!std::getline(file, line)) {
-                                errorCode = MeshErrorCode::READ_FAILED;
-                                errorMsg = "Unexpected end of file while reading elements";
-                                return false;
-                            }
-
-                            std::istringstream elemStream(line);
-                            int elemType;
-                            if (!(elemStream >> elemType)) {
-                                continue;
-                            }
-
-                            MeshData::Cell cell;
-                            switch (elemType) {
-                                case 1:
-                                    cell.type = VtkCellType::VERTEX;
-                                    break;
-                                case 3:
-                                    cell.type = VtkCellType::LINE;
-                                    break;
-                                case 5:
-                                    cell.type = VtkCellType::TRIANGLE;
-                                    break;
-                                case 9:
-                                    cell.type = VtkCellType::QUAD;
-                                    break;
-                                case 10:
-                                    cell.type = VtkCellType::TETRA;
-                                    break;
-                                case 12:
-                                    cell.type = VtkCellType::HEXAHEDRON;
-                                    break;
-                                case 13:
-                                    cell.type = VtkCellType::WEDGE;
-                                    break;
-                                case 14:
-                                    cell.type = VtkCellType::PYRAMID;
-                                    break;
-                                default:
-                                    continue;
-                            }
+            const size_t separator = line.find('=');
+            if (separator == std::string_view::npos || separator + 1 == line.size()) {
+                continue;
+            }
+            const std::string_view key = TextTokenizer::trim(line.substr(0, separator));
+            const std::string_view valueStr = TextTokenizer::trim(line.substr(separator + 1));
 
-                            int pointIndex;
-                            while (elemStream >> pointIndex) {
-                                cell.pointIndices.push_back(static_cast<uint32_t>(pointIndex));
-                            }
+            // Integer value of a keyword line
+            auto readCount = [&](int& value) {
+                if (!TextTokenizer::parse(valueStr, value)) {
+                    throw std::invalid_argument("invalid " + std::string(key) + " value '" + std::string(valueStr) + "'");
+                }
+            };
 
-                            if (!cell.pointIndices.empty()) {
-                                cell.pointIndices.pop_back();
-                            }
+            if (key == "NDIME") {
+                readCount(ndime);
+            } else if (key == "NELEM") {
+                readCount(nelem);
 
-                            meshData.cells.push_back(cell);
-                        }
-                    } else if (key == "NPOIN") {
-                        npoin = std::stoi(valueStr);
-                        meshData.points.reserve(npoin * 3);
-
-                        for (int i = 0; i < npoin; ++i) {
-                            if (!std::getline(file, line)) {
-                                errorCode = MeshErrorCode::READ_FAILED;
-                                errorMsg = "Unexpected end of file while reading points";
-                                return false;
-                            }
+                std::string_view block;
+                if (!takeLines(nelem, block)) {
+                    errorCode = MeshErrorCode::READ_FAILED;
+                    errorMsg = "Unexpected end of file while reading elements";
+                    return false;
+                }
 
-                            std::istringstream pointStream(line);
-                            float x = 0.0f, y = 0.0f, z = 0.0f;
-                            int pointId;
+                // Element lines are independent: parse chunks in parallel and concatenate
+                const std::vector<std::string_view> chunkTexts =
+                    splitAtLines(block, parallelChunkCount(block.size(), options.readThreads));
+                std::vector<BasicCellArray<Index>> chunkCells(chunkTexts.size());
+                runParallel(chunkTexts.size(), [&](size_t i) {
+                    MeshTextParser::parseSU2Elements(chunkTexts[i], chunkCells[i]);
+                });
+                std::vector<BasicCellArray<Index>*> cellParts;
+                for (BasicCellArray<Index>& cells : chunkCells) {
+                    cellParts.push_back(&cells);
+                }
+                concatenateCells(cellParts, meshData.cells);
+            } else if (key == "NPOIN") {
+                readCount(npoin);
 
-                            if (ndime == 2) {
-                                if (!(pointStream >> x >> y >> pointId)) {
-                                    continue;
-                                }
-                            } else {
-                                if (!(pointStream >> x >> y >> z >> pointId)) {
-                                    continue;
-                                }
-                            }
+                std::string_view block;
+                if (!takeLines(npoin, block)) {
+                    errorCode = MeshErrorCode::READ_FAILED;
+                    errorMsg = "Unexpected end of file while reading points";
+                    return false;
+                }
 
-                            meshData.points.push_back(x);
-                            meshData.points.push_back(y);
-                            meshData.points.push_back(z);
-                        }
-                    }
+                const std::vector<std::string_view> chunkTexts =
+                    splitAtLines(block, parallelChunkCount(block.size(), options.readThreads));
+                std::vector<std::vector<Real>> chunkPoints(chunkTexts.size());
+                runParallel(chunkTexts.size(), [&](size_t i) {
+                    MeshTextParser::parseSU2Points(chunkTexts[i], ndime, chunkPoints[i]);
+                });
+                std::vector<std::vector<Real>*> pointParts;
+                for (std::vector<Real>& points : chunkPoints) {
+                    pointParts.push_back(&points);
                 }
+                concatenatePoints(pointParts, meshData.points);
             }
         }
 
-        file.close();
-
         meshData.calculateMetadata();
         meshData.metadata.format = MeshFormat::SU2;
+        recordReadThroughput(meshData, mappedFile.size(), startTime);
 
         errorCode = MeshErrorCode::SUCCESS;
         errorMsg = "";
         return true;
 
     } catch (const std::exception& e) {
-        file.close();
         errorCode = MeshErrorCode::READ_FAILED;
         errorMsg = std::string("Error reading SU2 file: ") + e.what();
         return false;
     }
 }
 
+template bool MeshReader::readSU2(const std::string&, MeshData&, MeshErrorCode&, std::string&, const FormatReadOptions&);
+template bool MeshReader::readSU2(const std::string&, MeshData64&, MeshErrorCode&, std::string&, const FormatReadOptions&);
+
 /**
- * @brief Read OpenFOAM format file
- * @param filePath File path (UTF-8 encoded)
+ * @brief Read OpenFOAM polyMesh (ASCII or binary FoamFile lists)
+ * points, faces, owner, neighbour and boundary are parsed natively on one thread each.
+ * Processor directories of a decomposed case are read in parallel and merged.
+ * @param filePath Case directory, its constant directory or the polyMesh directory (UTF-8 encoded)
  * @param[out] meshData Output mesh data
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message (UTF-8)
+ * @param options Read options (openFoamPatches, readThreads)
  * @return Whether reading is successful
  */
+template<typename Real, typename Index>
 bool MeshReader::readOpenFOAM(const std::string& filePath,
-                             MeshData& meshData,
+                             BasicMeshData<Real, Index>& meshData,
                              MeshErrorCode& errorCode,
-                             std::string& errorMsg) {
-    // Implement OpenFOAM format read logic here
-    // Temporarily return unimplemented
-    errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
-    errorMsg = "OpenFOAM format read not implemented";
-    return false;
-}
-
-// --------------------------------------------------------------------------
-// VTK intermediate format related method implementations
-// --------------------------------------------------------------------------
+                             std::string& errorMsg,
+                             const FormatReadOptions& options) {
+    meshData.clear();
 
-/**
- * @brief Convert MeshData to vtkUnstructuredGrid
- * @param meshData Input mesh data
- * @return vtkUnstructuredGrid pointer
- */
-vtkSmartPointer<vtkUnstructuredGrid> MeshReader::meshDataToVTK(const MeshData& meshData) {
-    // Create vtkUnstructuredGrid
-    vtkSmartPointer<vtkUnstructuredGrid> grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
-    
-    // Create point set
-    vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
-    
-    // Add points
-    size_t pointCount = meshData.points.size() / 3;
-    for (size_t i = 0; i < pointCount; ++i) {
-        float x = meshData.points[i * 3];
-        float y = meshData.points[i * 3 + 1];
-        float z = meshData.points[i * 3 + 2];
-        points->InsertNextPoint(x, y, z);
+    if (!fileExists(filePath)) {
+        errorCode = MeshErrorCode::FILE_NOT_EXIST;
+        errorMsg = "File does not exist: " + filePath;
+        return false;
     }
-    
-    grid->SetPoints(points);
-    
-    // Add cells
-    for (const auto& cell : meshData.cells) {
-        switch (cell.type) {
-        case VtkCellType::TETRA:
-            if (cell.pointIndices.size() == 4) {
-                vtkIdType ids[4];
-                for (int i = 0; i < 4; ++i) {
-                    ids[i] = cell.pointIndices[i];
-                }
-                grid->InsertNextCell(VTK_TETRA, 4, ids);
-            }
-            break;
-        case VtkCellType::HEXAHEDRON:
-            if (cell.pointIndices.size() == 8) {
-                vtkIdType ids[8];
-                for (int i = 0; i < 8; ++i) {
-                    ids[i] = cell.pointIndices[i];
-                }
-                grid->InsertNextCell(VTK_HEXAHEDRON, 8, ids);
-            }
-            break;
-        case VtkCellType::WEDGE:
-            if (cell.pointIndices.size() == 6) {
-                vtkIdType ids[6];
-                for (int i = 0; i < 6; ++i) {
-                    ids[i] = cell.pointIndices[i];
-                }
-                grid->InsertNextCell(VTK_WEDGE, 6, ids);
-            }
-            break;
-        case VtkCellType::PYRAMID:
-            if (cell.pointIndices.size() == 5) {
-                vtkIdType ids[5];
-                for (int i = 0; i < 5; ++i) {
-                    ids[i] = cell.pointIndices[i];
-                }
-                grid->InsertNextCell(VTK_PYRAMID, 5, ids);
-            }
-            break;
-        case VtkCellType::TRIANGLE:
-            if (cell.pointIndices.size() == 3) {
-                vtkIdType ids[3];
-                for (int i = 0; i < 3; ++i) {
-                    ids[i] = cell.pointIndices[i];
-                }
-                grid->InsertNextCell(VTK_TRIANGLE, 3, ids);
-            }
-            break;
-        case VtkCellType::QUAD:
-            if (cell.pointIndices.size() == 4) {
-                vtkIdType ids[4];
-                for (int i = 0; i < 4; ++i) {
-                    ids[i] = cell.pointIndices[i];
-                }
-                grid->InsertNextCell(VTK_QUAD, 4, ids);
+
+    try {
+        const auto startTime = std::chrono::steady_clock::now();
+        uint64_t bytes = 0;
+        const std::filesystem::path meshDirectory = openFoamMeshDirectory(filePath);
+        std::vector<std::filesystem::path> processors;
+        if (!openFoamHasMesh(meshDirectory)) {
+            processors = openFoamProcessorDirectories(filePath);
+            if (processors.empty()) {
+                errorCode = MeshErrorCode::FILE_NOT_EXIST;
+                errorMsg = "No polyMesh found in OpenFOAM case: " + filePath;
+                return false;
             }
-            break;
-        case VtkCellType::LINE:
-            if (cell.pointIndices.size() == 2) {
-                vtkIdType ids[2];
-                for (int i = 0; i < 2; ++i) {
-                    ids[i] = cell.pointIndices[i];
+        }
+
+        if (processors.empty()) {
+            std::vector<Index> pointAddressing;
+            bytes = readFoamMesh(meshDirectory, options, false, options.readThreads, meshData, pointAddressing);
+        } else {
+            // Processors are read concurrently; each assembles its cells with a share of the threads
+            const size_t taskCount = parallelTaskCount(processors.size(), 1, options.readThreads);
+            const unsigned int hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+            const unsigned int threads = options.readThreads ? options.readThreads : hardwareThreads;
+            const unsigned int processorThreads = std::max(1u, static_cast<unsigned int>(threads / taskCount));
+            std::vector<BasicMeshData<Real, Index>> parts(processors.size());
+            std::vector<std::vector<Index>> addressing(processors.size());
+            std::vector<uint64_t> processorBytes(processors.size(), 0);
+            parallelForRanges(processors.size(), taskCount, [&](size_t begin, size_t end, size_t) {
+                for (size_t p = begin; p < end; ++p) {
+                    processorBytes[p] = readFoamMesh(processors[p], options, true, processorThreads, parts[p], addressing[p]);
                 }
-                grid->InsertNextCell(VTK_LINE, 2, ids);
-            }
-            break;
-        case VtkCellType::VERTEX:
-            if (cell.pointIndices.size() == 1) {
-                vtkIdType ids[1];
-                ids[0] = cell.pointIndices[0];
-                grid->InsertNextCell(VTK_VERTEX, 1, ids);
-            }
-            break;
-        default:
-            break;
+            });
+            bytes = std::accumulate(processorBytes.begin(), processorBytes.end(), uint64_t(0));
+            mergeFoamProcessors(parts, addressing, meshData, options.readThreads);
         }
+
+        meshData.calculateMetadata();
+        meshData.metadata.format = MeshFormat::OPENFOAM;
+        recordReadThroughput(meshData, static_cast<size_t>(bytes), startTime);
+
+        errorCode = MeshErrorCode::SUCCESS;
+        errorMsg = "";
+        return true;
+
+    } catch (const std::exception& e) {
+        meshData.clear();
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = std::string("Error reading OpenFOAM case: ") + e.what();
+        return false;
     }
-    
-    // Copy point data from meshData to vtkUnstructuredGrid
-    for (const auto& [name, values] : meshData.pointData) {
-        vtkSmartPointer<vtkFloatArray> array = vtkSmartPointer<vtkFloatArray>::New();
-        array->SetName(name.c_str());
-        array->SetNumberOfComponents(1);
-        array->SetNumberOfTuples(values.size());
-        for (size_t i = 0; i < values.size(); ++i) {
-            array->SetValue(i, values[i]);
-        }
-        grid->GetPointData()->AddArray(array);
+}
+
+template bool MeshReader::readOpenFOAM(const std::string&, MeshData&, MeshErrorCode&, std::string&, const FormatReadOptions&);
+template bool MeshReader::readOpenFOAM(const std::string&, MeshData64&, MeshErrorCode&, std::string&, const FormatReadOptions&);
+
+/**
+ * @brief Read native binary mesh cache file (.mcb)
+ * @param filePath File path (UTF-8 encoded)
+ * @param[out] meshData Output mesh data
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @param options Read options (readThreads)
+ * @return Whether reading is successful
+ */
+template<typename Real, typename Index>
+bool MeshReader::readMeshCache(const std::string& filePath,
+                               BasicMeshData<Real, Index>& meshData,
+                               MeshErrorCode& errorCode,
+                               std::string& errorMsg,
+                               const FormatReadOptions& options) {
+    if (!fileExists(filePath)) {
+        meshData.clear();
+        errorCode = MeshErrorCode::FILE_NOT_EXIST;
+        errorMsg = "File does not exist: " + filePath;
+        return false;
     }
-    
-    // Copy cell data from meshData to vtkUnstructuredGrid
-    for (const auto& [name, values] : meshData.cellData) {
-        vtkSmartPointer<vtkFloatArray> array = vtkSmartPointer<vtkFloatArray>::New();
-        array->SetName(name.c_str());
-        array->SetNumberOfComponents(1);
-        array->SetNumberOfTuples(values.size());
-        for (size_t i = 0; i < values.size(); ++i) {
-            array->SetValue(i, values[i]);
-        }
-        grid->GetCellData()->AddArray(array);
+    if (!MeshCache::readFile(filePath, meshData, errorCode, errorMsg, options.readThreads)) {
+        return false;
     }
-    
-    return grid;
+    meshData.metadata.fileName = std::filesystem::path(filePath).filename().string();
+    meshData.metadata.format = MeshFormat::MESH_CACHE;
+    return true;
 }
 
+template bool MeshReader::readMeshCache(const std::string&, MeshData&, MeshErrorCode&, std::string&, const FormatReadOptions&);
+template bool MeshReader::readMeshCache(const std::string&, MeshData64&, MeshErrorCode&, std::string&, const FormatReadOptions&);
+
+// --------------------------------------------------------------------------
+// VTK intermediate format related method implementations
+// --------------------------------------------------------------------------
+
 /**
  * @brief Auto-detect file format and read as vtkUnstructuredGrid
  * @param filePath File path (UTF-8 encoded)
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message (UTF-8)
+ * @param options Read options (format-specific configurations)
  * @return vtkUnstructuredGrid pointer, returns nullptr on failure
  */
 vtkSmartPointer<vtkUnstructuredGrid> MeshReader::readAutoToVTK(const std::string& filePath,
                                                               MeshErrorCode& errorCode,
-                                                              std::string& errorMsg) {
+                                                              std::string& errorMsg,
+                                                              const FormatReadOptions& options) {
+    // Welding runs on MeshData, so take the MeshData path and hand the result to VTK
+    if (options.weldPoints) {
+        MeshData meshData;
+        if (!readAuto(filePath, meshData, errorCode, errorMsg, options)) {
+            return nullptr;
+        }
+        return VTKBridge::adopt(std::move(meshData));
+    }
+
     // Detect format first
     MeshFormat format = detectFormatFromHeader(filePath);
-    
+    if (format == MeshFormat::UNKNOWN || format == MeshFormat::MESH_CACHE) {
+        // Fall back to MeshData method for formats without a dedicated VTK path
+        MeshData meshData;
+        bool success = readAuto(filePath, meshData, errorCode, errorMsg, options);
+        if (!success) {
+            return nullptr;
+        }
+        return VTKBridge::adopt(std::move(meshData));
+    }
+
+    ProfileScope scope("read", "read", filePath);
+    if (scope.active()) {
+        scope.setName(MeshHelper::getFormatName(format));
+    }
+    JobStep step(0.0, 1.0);
+    if (step.active()) {
+        step.setUnits(Profiler::pathBytes(filePath));
+    }
+
     // Use format-specific VTK readers for better compatibility
+    vtkSmartPointer<vtkUnstructuredGrid> grid;
     switch (format) {
         case MeshFormat::PLY_ASCII:
         case MeshFormat::PLY_BINARY:
-            return readPLYToVTK(filePath, errorCode, errorMsg);
+            grid = readPLYToVTK(filePath, errorCode, errorMsg);
+            break;
         case MeshFormat::VTK_LEGACY:
         case MeshFormat::VTK_XML:
-            return readVTKToVTK(filePath, errorCode, errorMsg);
+            grid = readVTKToVTK(filePath, errorCode, errorMsg);
+            break;
         case MeshFormat::CGNS:
-            return readCGNSToVTK(filePath, errorCode, errorMsg);
+            grid = readCGNSToVTK(filePath, errorCode, errorMsg, options);
+            break;
         case MeshFormat::GMSH_V2:
         case MeshFormat::GMSH_V4:
-            return readGmshToVTK(filePath, errorCode, errorMsg);
+            grid = readGmshToVTK(filePath, errorCode, errorMsg, options);
+            break;
         case MeshFormat::STL_ASCII:
         case MeshFormat::STL_BINARY:
-            return readSTLToVTK(filePath, errorCode, errorMsg);
+            grid = readSTLToVTK(filePath, errorCode, errorMsg, options);
+            break;
         case MeshFormat::OBJ:
-            return readOBJToVTK(filePath, errorCode, errorMsg);
+            grid = readOBJToVTK(filePath, errorCode, errorMsg, options);
+            break;
         case MeshFormat::OFF:
-            return readOFFToVTK(filePath, errorCode, errorMsg);
+            grid = readOFFToVTK(filePath, errorCode, errorMsg);
+            break;
         case MeshFormat::SU2:
-            return readSU2ToVTK(filePath, errorCode, errorMsg);
+            grid = readSU2ToVTK(filePath, errorCode, errorMsg, options);
+            break;
         case MeshFormat::OPENFOAM:
-            return readOpenFOAMToVTK(filePath, errorCode, errorMsg);
+            grid = readOpenFOAMToVTK(filePath, errorCode, errorMsg, options);
+            break;
         default:
-            // Fall back to MeshData method for unknown formats
-            MeshData meshData;
-            bool success = readAuto(filePath, meshData, errorCode, errorMsg);
-            if (!success) {
-                return nullptr;
-            }
-            return meshDataToVTK(meshData);
+            errorCode = MeshErrorCode::FORMAT_UNSUPPORTED;
+            errorMsg = "Format not supported: " + filePath;
+            return nullptr;
+    }
+    if (grid && scope.active()) {
+        scope.setBytes(Profiler::pathBytes(filePath));
+        scope.setCells(grid->GetNumberOfCells());
     }
+    return grid;
 }
 
 /**
@@ -2464,14 +4439,18 @@ vtkSmartPointer<vtkUnstructuredGrid> MeshReader::readVTKToVTK(const std::string&
             // First try to read as UnstructuredGrid
             vtkSmartPointer<vtkUnstructuredGridReader> ugReader = vtkSmartPointer<vtkUnstructuredGridReader>::New();
             ugReader->SetFileName(filePath.c_str());
+            VTKBridge::observeJob(ugReader);
             ugReader->Update();
+            JobControl::checkpoint();
             grid = ugReader->GetOutput();
             
             // If UnstructuredGrid failed, try PolyData
             if (!grid || grid->GetNumberOfPoints() == 0) {
                 vtkSmartPointer<vtkPolyDataReader> pdReader = vtkSmartPointer<vtkPolyDataReader>::New();
                 pdReader->SetFileName(filePath.c_str());
+                VTKBridge::observeJob(pdReader);
                 pdReader->Update();
+                JobControl::checkpoint();
                 vtkSmartPointer<vtkPolyData> polyData = pdReader->GetOutput();
                 
                 // Convert PolyData to UnstructuredGrid
@@ -2538,14 +4517,16 @@ vtkSmartPointer<vtkUnstructuredGrid> MeshReader::readVTKToVTK(const std::string&
                     grid->GetCellData()->ShallowCopy(polyData->GetCellData());
                     grid->GetPointData()->ShallowCopy(polyData->GetPointData());
                     
-                    std::cout << "Successfully converted PolyData to UnstructuredGrid" << std::endl;
+                    Profiler::message("Converted VTK PolyData to UnstructuredGrid");
                 }
             }
         } else if (format == MeshFormat::VTK_XML) {
             // Read XML VTK format
             vtkSmartPointer<vtkXMLUnstructuredGridReader> reader = vtkSmartPointer<vtkXMLUnstructuredGridReader>::New();
             reader->SetFileName(filePath.c_str());
+            VTKBridge::observeJob(reader);
             reader->Update();
+            JobControl::checkpoint();
             grid = reader->GetOutput();
         } else {
             errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
@@ -2574,25 +4555,23 @@ vtkSmartPointer<vtkUnstructuredGrid> MeshReader::readVTKToVTK(const std::string&
  * @param filePath File path (UTF-8 encoded)
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message (UTF-8)
- * @param baseIndex CGNS Base index (default 0, first Base)
- * @param zoneIndex CGNS Zone index (default 0, first Zone)
+ * @param options Read options (cgnsBase, cgnsZones, readThreads)
  * @return vtkUnstructuredGrid pointer, returns nullptr on failure
  */
 vtkSmartPointer<vtkUnstructuredGrid> MeshReader::readCGNSToVTK(const std::string& filePath,
                                                               MeshErrorCode& errorCode,
                                                               std::string& errorMsg,
-                                                              int baseIndex,
-                                                              int zoneIndex) {
+                                                              const FormatReadOptions& options) {
 #ifdef HAVE_CGNS
     // First use existing readCGNS method to read as MeshData
     MeshData meshData;
-    bool success = readCGNS(filePath, meshData, errorCode, errorMsg, baseIndex, zoneIndex);
+    bool success = readCGNS(filePath, meshData, errorCode, errorMsg, options);
     if (!success) {
         return nullptr;
     }
     
     // Convert MeshData to vtkUnstructuredGrid
-    return meshDataToVTK(meshData);
+    return VTKBridge::adopt(std::move(meshData));
 #else
     errorCode = MeshErrorCode::DEPENDENCY_MISSING;
     errorMsg = "CGNS support is not available (HAVE_CGNS not defined)";
@@ -2605,20 +4584,22 @@ vtkSmartPointer<vtkUnstructuredGrid> MeshReader::readCGNSToVTK(const std::string
  * @param filePath File path (UTF-8 encoded)
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message (UTF-8)
+ * @param options Read options (readThreads enables chunk-parallel parsing)
  * @return vtkUnstructuredGrid pointer, returns nullptr on failure
  */
 vtkSmartPointer<vtkUnstructuredGrid> MeshReader::readGmshToVTK(const std::string& filePath,
                                                               MeshErrorCode& errorCode,
-                                                              std::string& errorMsg) {
+                                                              std::string& errorMsg,
+                                                              const FormatReadOptions& options) {
     // First use existing readGmsh method to read as MeshData
     MeshData meshData;
-    bool success = readGmsh(filePath, meshData, errorCode, errorMsg);
+    bool success = readGmsh(filePath, meshData, errorCode, errorMsg, options);
     if (!success) {
         return nullptr;
     }
     
     // Convert MeshData to vtkUnstructuredGrid
-    return meshDataToVTK(meshData);
+    return VTKBridge::adopt(std::move(meshData));
 }
 
 /**
@@ -2626,20 +4607,22 @@ vtkSmartPointer<vtkUnstructuredGrid> MeshReader::readGmshToVTK(const std::string
  * @param filePath File path (UTF-8 encoded)
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message (UTF-8)
+ * @param options Read options (stlWeldVertices produces an indexed mesh)
  * @return vtkUnstructuredGrid pointer, returns nullptr on failure
  */
 vtkSmartPointer<vtkUnstructuredGrid> MeshReader::readSTLToVTK(const std::string& filePath,
                                                              MeshErrorCode& errorCode,
-                                                             std::string& errorMsg) {
+                                                             std::string& errorMsg,
+                                                             const FormatReadOptions& options) {
     // First use existing readSTL method to read as MeshData
     MeshData meshData;
-    bool success = readSTL(filePath, meshData, errorCode, errorMsg);
+    bool success = readSTL(filePath, meshData, errorCode, errorMsg, options);
     if (!success) {
         return nullptr;
     }
     
     // Convert MeshData to vtkUnstructuredGrid
-    return meshDataToVTK(meshData);
+    return VTKBridge::adopt(std::move(meshData));
 }
 
 /**
@@ -2647,20 +4630,22 @@ vtkSmartPointer<vtkUnstructuredGrid> MeshReader::readSTLToVTK(const std::string&
  * @param filePath File path (UTF-8 encoded)
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message (UTF-8)
+ * @param options Read options (readThreads controls chunk-parallel parsing)
  * @return vtkUnstructuredGrid pointer, returns nullptr on failure
  */
 vtkSmartPointer<vtkUnstructuredGrid> MeshReader::readOBJToVTK(const std::string& filePath,
                                                              MeshErrorCode& errorCode,
-                                                             std::string& errorMsg) {
+                                                             std::string& errorMsg,
+                                                             const FormatReadOptions& options) {
     // First use existing readOBJ method to read as MeshData
     MeshData meshData;
-    bool success = readOBJ(filePath, meshData, errorCode, errorMsg);
+    bool success = readOBJ(filePath, meshData, errorCode, errorMsg, options);
     if (!success) {
         return nullptr;
     }
     
     // Convert MeshData to vtkUnstructuredGrid
-    return meshDataToVTK(meshData);
+    return VTKBridge::adopt(std::move(meshData));
 }
 
 /**
@@ -2681,7 +4666,7 @@ vtkSmartPointer<vtkUnstructuredGrid> MeshReader::readPLYToVTK(const std::string&
     }
     
     // Convert MeshData to vtkUnstructuredGrid
-    vtkSmartPointer<vtkUnstructuredGrid> grid = meshDataToVTK(meshData);
+    vtkSmartPointer<vtkUnstructuredGrid> grid = VTKBridge::adopt(std::move(meshData));
     
     // If no cells but we have points, create vertex cells for each point
     if (grid && grid->GetNumberOfCells() == 0 && grid->GetNumberOfPoints() > 0) {
@@ -2711,7 +4696,7 @@ vtkSmartPointer<vtkUnstructuredGrid> MeshReader::readOFFToVTK(const std::string&
     }
     
     // Convert MeshData to vtkUnstructuredGrid
-    return meshDataToVTK(meshData);
+    return VTKBridge::adopt(std::move(meshData));
 }
 
 /**
@@ -2719,39 +4704,43 @@ vtkSmartPointer<vtkUnstructuredGrid> MeshReader::readOFFToVTK(const std::string&
  * @param filePath File path (UTF-8 encoded)
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message (UTF-8)
+ * @param options Read options (readThreads controls chunk-parallel parsing)
  * @return vtkUnstructuredGrid pointer, returns nullptr on failure
  */
 vtkSmartPointer<vtkUnstructuredGrid> MeshReader::readSU2ToVTK(const std::string& filePath,
                                                              MeshErrorCode& errorCode,
-                                                             std::string& errorMsg) {
+                                                             std::string& errorMsg,
+                                                             const FormatReadOptions& options) {
     // First use existing readSU2 method to read as MeshData
     MeshData meshData;
-    bool success = readSU2(filePath, meshData, errorCode, errorMsg);
+    bool success = readSU2(filePath, meshData, errorCode, errorMsg, options);
     if (!success) {
         return nullptr;
     }
     
     // Convert MeshData to vtkUnstructuredGrid
-    return meshDataToVTK(meshData);
+    return VTKBridge::adopt(std::move(meshData));
 }
 
 /**
  * @brief Read OpenFOAM format file as vtkUnstructuredGrid
- * @param filePath File path (UTF-8 encoded)
+ * @param filePath Case directory, its constant directory or the polyMesh directory (UTF-8 encoded)
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message (UTF-8)
+ * @param options Read options (openFoamPatches, readThreads)
  * @return vtkUnstructuredGrid pointer, returns nullptr on failure
  */
 vtkSmartPointer<vtkUnstructuredGrid> MeshReader::readOpenFOAMToVTK(const std::string& filePath,
                                                                   MeshErrorCode& errorCode,
-                                                                  std::string& errorMsg) {
+                                                                  std::string& errorMsg,
+                                                                  const FormatReadOptions& options) {
     // First use existing readOpenFOAM method to read as MeshData
     MeshData meshData;
-    bool success = readOpenFOAM(filePath, meshData, errorCode, errorMsg);
+    bool success = readOpenFOAM(filePath, meshData, errorCode, errorMsg, options);
     if (!success) {
         return nullptr;
     }
     
     // Convert MeshData to vtkUnstructuredGrid
-    return meshDataToVTK(meshData);
+    return VTKBridge::adopt(std::move(meshData));
 }
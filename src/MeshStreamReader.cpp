@@ -0,0 +1,913 @@
+#include "MeshStream.h"
+#include "MeshReader.h"
+#include "MeshTextParser.h"
+#include "MappedFile.h"
+#include "TextTokenizer.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <new>
+#include <string_view>
+
+/**
+ * @brief Clear block contents and indices
+ */
+void MeshBlock::clear() {
+    firstPoint = 0;
+    firstCell = 0;
+    points.clear();
+    cells.clear();
+}
+
+namespace {
+
+/**
+ * @brief Cell type of a polygonal face with the given number of corners
+ * @param count Number of corners (at least 3)
+ * @return TRIANGLE, QUAD or POLYGON
+ */
+VtkCellType faceType(size_t count) {
+    if (count == 3) {
+        return VtkCellType::TRIANGLE;
+    } else if (count == 4) {
+        return VtkCellType::QUAD;
+    }
+    return VtkCellType::POLYGON;
+}
+
+/**
+ * @brief Base of the streaming readers: a mapped file consumed front to back
+ */
+class MappedStreamReader : public MeshStreamReader {
+protected:
+    /**
+     * @brief Map the source file
+     * @param filePath File path (UTF-8 encoded)
+     * @param options Streaming options
+     * @param[out] errorCode Output error code
+     * @param[out] errorMsg Output error message
+     * @return Whether mapping is successful
+     */
+    bool mapFile(const std::string& filePath, const MeshStreamOptions& options,
+                 MeshErrorCode& errorCode, std::string& errorMsg) {
+        options_ = options;
+        options_.blockBytes = std::max<size_t>(options_.blockBytes, 4096);
+        if (!file_.open(filePath, errorMsg)) {
+            errorCode = MeshErrorCode::READ_FAILED;
+            return false;
+        }
+        text_ = TextTokenizer(file_.data(), file_.size());
+        return true;
+    }
+
+    /**
+     * @brief Drop the pages consumed since the last call from the resident set
+     */
+    void discardConsumed() {
+        const size_t position = text_.position();
+        if (position > discarded_) {
+            file_.discard(discarded_, position - discarded_);
+            discarded_ = position;
+        }
+    }
+
+    /**
+     * @brief Take whole lines from the current position until about blockBytes are covered
+     * @param maxLines Maximum number of lines (0 = unlimited)
+     * @param[out] lineCount Number of lines taken
+     * @return Line-aligned text (empty at end of file)
+     */
+    std::string_view takeLines(uint64_t maxLines, uint64_t& lineCount) {
+        const char* begin = text_.current();
+        lineCount = 0;
+        std::string_view line;
+        while ((maxLines == 0 || lineCount < maxLines) &&
+               static_cast<size_t>(text_.current() - begin) < options_.blockBytes &&
+               text_.nextLine(line)) {
+            ++lineCount;
+        }
+        return std::string_view(begin, static_cast<size_t>(text_.current() - begin));
+    }
+
+    MappedFile file_;            // Mapped source file
+    TextTokenizer text_;         // Cursor over the mapping
+    size_t discarded_ = 0;       // Bytes already released to the OS
+};
+
+// ==============================
+// STL
+// ==============================
+
+/**
+ * @brief Binary STL: fixed 50-byte records, every block carries its own triangle corners
+ */
+class STLBinaryStreamReader : public MappedStreamReader {
+public:
+    bool openFile(const std::string& filePath, const MeshStreamOptions& options,
+                  MeshErrorCode& errorCode, std::string& errorMsg) {
+        if (!mapFile(filePath, options, errorCode, errorMsg)) {
+            return false;
+        }
+        if (file_.size() < HEADER_SIZE) {
+            errorCode = MeshErrorCode::READ_FAILED;
+            errorMsg = "Invalid binary STL file: incomplete header";
+            return false;
+        }
+        std::memcpy(&triangleCount_, file_.data() + 80, sizeof(triangleCount_));
+        if (file_.size() < HEADER_SIZE + static_cast<uint64_t>(triangleCount_) * RECORD_SIZE) {
+            errorCode = MeshErrorCode::READ_FAILED;
+            errorMsg = "Binary STL file is too small for declared triangle count";
+            return false;
+        }
+        info_.format = MeshFormat::STL_BINARY;
+        info_.meshType = MeshType::SURFACE_MESH;
+        info_.pointCount = static_cast<uint64_t>(triangleCount_) * 3;
+        info_.cellCount = triangleCount_;
+        info_.pointCountKnown = true;
+        info_.cellCountKnown = true;
+        info_.blockLocalCells = true;
+        atEnd_ = triangleCount_ == 0;
+        return true;
+    }
+
+protected:
+    bool parseBlock(MeshBlock& block, MeshErrorCode&, std::string&) override {
+        const uint64_t remaining = triangleCount_ - nextTriangle_;
+        const size_t count = static_cast<size_t>(std::min<uint64_t>(remaining, std::max<size_t>(1, options_.blockBytes / RECORD_SIZE)));
+        const size_t recordOffset = HEADER_SIZE + static_cast<size_t>(nextTriangle_) * RECORD_SIZE;
+        const char* records = file_.data() + recordOffset;
+
+        block.points.resize(count * 9);
+        MeshData::CellArray& cells = block.cells;
+        cells.types.assign(count, VtkCellType::TRIANGLE);
+        cells.offsets.resize(count + 1);
+        cells.connectivity.resize(count * 3);
+        const uint32_t base = static_cast<uint32_t>(block.firstPoint);
+        for (size_t i = 0; i < count; ++i) {
+            std::memcpy(block.points.data() + i * 9, records + i * RECORD_SIZE + NORMAL_SIZE, 9 * sizeof(float));
+            cells.offsets[i + 1] = static_cast<uint32_t>((i + 1) * 3);
+            cells.connectivity[i * 3] = base + static_cast<uint32_t>(i * 3);
+            cells.connectivity[i * 3 + 1] = base + static_cast<uint32_t>(i * 3 + 1);
+            cells.connectivity[i * 3 + 2] = base + static_cast<uint32_t>(i * 3 + 2);
+        }
+
+        file_.discard(recordOffset, count * RECORD_SIZE);
+        nextTriangle_ += count;
+        atEnd_ = nextTriangle_ == triangleCount_;
+        return true;
+    }
+
+private:
+    static constexpr size_t HEADER_SIZE = 84;  // 80-byte header + uint32 triangle count
+    static constexpr size_t RECORD_SIZE = 50;  // normal (12) + 3 vertices (36) + attribute count (2)
+    static constexpr size_t NORMAL_SIZE = 12;
+
+    uint32_t triangleCount_ = 0;
+    uint64_t nextTriangle_ = 0;
+};
+
+/**
+ * @brief ASCII STL: facets are collected from "vertex" lines between "outer loop" and "endloop"
+ */
+class STLASCIIStreamReader : public MappedStreamReader {
+public:
+    bool openFile(const std::string& filePath, const MeshStreamOptions& options,
+                  MeshErrorCode& errorCode, std::string& errorMsg) {
+        if (!mapFile(filePath, options, errorCode, errorMsg)) {
+            return false;
+        }
+        std::string_view line;
+        if (!text_.nextLine(line)) {
+            errorCode = MeshErrorCode::READ_FAILED;
+            errorMsg = "Invalid ASCII STL file: empty file";
+            return false;
+        }
+        info_.format = MeshFormat::STL_ASCII;
+        info_.meshType = MeshType::SURFACE_MESH;
+        info_.blockLocalCells = true;
+        return true;
+    }
+
+protected:
+    bool parseBlock(MeshBlock& block, MeshErrorCode& errorCode, std::string& errorMsg) override {
+        uint64_t lineCount = 0;
+        TextTokenizer lines(takeLines(0, lineCount));
+        std::string_view line;
+        while (lines.nextLine(line)) {
+            line = TextTokenizer::trim(line);
+            if (TextTokenizer::startsWith(line, "vertex ")) {
+                TextTokenizer vertexTokens(line.substr(7));
+                float xyz[3];
+                if (!(vertexTokens.next(xyz[0]) && vertexTokens.next(xyz[1]) && vertexTokens.next(xyz[2]))) {
+                    errorCode = MeshErrorCode::READ_FAILED;
+                    errorMsg = "Invalid ASCII STL file: malformed vertex coordinates";
+                    return false;
+                }
+                facet_.insert(facet_.end(), xyz, xyz + 3);
+            } else if (line == "endloop") {
+                // A facet split across two blocks is emitted with the block that completes it
+                const size_t corners = facet_.size() / 3;
+                if (corners >= 3) {
+                    const uint32_t base = static_cast<uint32_t>(block.firstPoint + block.pointCount());
+                    indices_.resize(corners);
+                    for (size_t i = 0; i < corners; ++i) {
+                        indices_[i] = base + static_cast<uint32_t>(i);
+                    }
+                    block.points.insert(block.points.end(), facet_.begin(), facet_.end());
+                    block.cells.addCell(faceType(corners), indices_);
+                }
+                facet_.clear();
+            } else if (TextTokenizer::startsWith(line, "endsolid")) {
+                atEnd_ = true;
+                break;
+            }
+        }
+
+        discardConsumed();
+        if (text_.atEnd()) {
+            atEnd_ = true;
+        }
+        return true;
+    }
+
+private:
+    std::vector<float> facet_;       // Corners of the facet being read
+    std::vector<uint32_t> indices_;  // Scratch point indices
+};
+
+// ==============================
+// OBJ
+// ==============================
+
+/**
+ * @brief OBJ: line-aligned blocks parsed with the same chunk parser as MeshReader::readOBJ
+ */
+class OBJStreamReader : public MappedStreamReader {
+public:
+    bool openFile(const std::string& filePath, const MeshStreamOptions& options,
+                  MeshErrorCode& errorCode, std::string& errorMsg) {
+        if (!mapFile(filePath, options, errorCode, errorMsg)) {
+            return false;
+        }
+        info_.format = MeshFormat::OBJ;
+        info_.meshType = MeshType::SURFACE_MESH;
+        atEnd_ = text_.atEnd();
+        return true;
+    }
+
+protected:
+    bool parseBlock(MeshBlock& block, MeshErrorCode& errorCode, std::string& errorMsg) override {
+        uint64_t lineCount = 0;
+        MeshTextParser::ObjChunk chunk;
+        MeshTextParser::parseOBJChunk(takeLines(0, lineCount), chunk);
+        if (!chunk.error.empty()) {
+            errorCode = MeshErrorCode::READ_FAILED;
+            errorMsg = chunk.error;
+            return false;
+        }
+        block.points = std::move(chunk.vertices);
+        block.cells = std::move(chunk.lines);
+        block.cells.append(chunk.faces);
+
+        discardConsumed();
+        atEnd_ = text_.atEnd();
+        return true;
+    }
+};
+
+// ==============================
+// PLY
+// ==============================
+
+/**
+ * @brief PLY (ASCII or binary little endian): vertex xyz and the first list property of faces
+ * Properties are decoded by their declared types, so extra vertex/face properties and
+ * additional elements are skipped correctly.
+ */
+class PLYStreamReader : public MappedStreamReader {
+public:
+    bool openFile(const std::string& filePath, const MeshStreamOptions& options,
+                  MeshErrorCode& errorCode, std::string& errorMsg) {
+        if (!mapFile(filePath, options, errorCode, errorMsg)) {
+            return false;
+        }
+        if (!parseHeader(errorCode, errorMsg)) {
+            return false;
+        }
+        info_.format = binary_ ? MeshFormat::PLY_BINARY : MeshFormat::PLY_ASCII;
+        info_.meshType = MeshType::SURFACE_MESH;
+        for (const Element& element : elements_) {
+            if (element.name == "vertex") {
+                info_.pointCount = element.count;
+                info_.pointCountKnown = true;
+            } else if (element.name == "face") {
+                info_.cellCount = element.count;
+                info_.cellCountKnown = true;
+            }
+        }
+        skipFinishedElements();
+        return true;
+    }
+
+protected:
+    bool parseBlock(MeshBlock& block, MeshErrorCode& errorCode, std::string& errorMsg) override {
+        const char* blockBegin = text_.current();
+        while (!atEnd_ && static_cast<size_t>(text_.current() - blockBegin) < options_.blockBytes) {
+            const Element& element = elements_[elementIndex_];
+            const bool ok = binary_ ? readBinaryInstance(element, block) : readASCIIInstance(element, block);
+            if (!ok) {
+                errorCode = MeshErrorCode::READ_FAILED;
+                errorMsg = "Invalid PLY file: incomplete " + element.name + " data";
+                return false;
+            }
+            ++instanceIndex_;
+            skipFinishedElements();
+        }
+        discardConsumed();
+        return true;
+    }
+
+private:
+    enum class Scalar { INT8, UINT8, INT16, UINT16, INT32, UINT32, FLOAT32, FLOAT64, INVALID };
+
+    struct Property {
+        std::string name;
+        Scalar type = Scalar::INVALID;       // Value type (item type for lists)
+        bool isList = false;
+        Scalar countType = Scalar::INVALID;  // List length type
+    };
+
+    struct Element {
+        std::string name;
+        uint64_t count = 0;
+        std::vector<Property> properties;
+    };
+
+    static Scalar scalarType(std::string_view name) {
+        if (name == "char" || name == "int8") return Scalar::INT8;
+        if (name == "uchar" || name == "uint8") return Scalar::UINT8;
+        if (name == "short" || name == "int16") return Scalar::INT16;
+        if (name == "ushort" || name == "uint16") return Scalar::UINT16;
+        if (name == "int" || name == "int32") return Scalar::INT32;
+        if (name == "uint" || name == "uint32") return Scalar::UINT32;
+        if (name == "float" || name == "float32") return Scalar::FLOAT32;
+        if (name == "double" || name == "float64") return Scalar::FLOAT64;
+        return Scalar::INVALID;
+    }
+
+    static size_t scalarSize(Scalar type) {
+        switch (type) {
+            case Scalar::INT8: case Scalar::UINT8: return 1;
+            case Scalar::INT16: case Scalar::UINT16: return 2;
+            case Scalar::INT32: case Scalar::UINT32: case Scalar::FLOAT32: return 4;
+            case Scalar::FLOAT64: return 8;
+            default: return 0;
+        }
+    }
+
+    /**
+     * @brief Decode one little-endian binary value
+     */
+    static double decodeScalar(const char* data, Scalar type) {
+        switch (type) {
+            case Scalar::INT8: { int8_t v; std::memcpy(&v, data, 1); return v; }
+            case Scalar::UINT8: { uint8_t v; std::memcpy(&v, data, 1); return v; }
+            case Scalar::INT16: { int16_t v; std::memcpy(&v, data, 2); return v; }
+            case Scalar::UINT16: { uint16_t v; std::memcpy(&v, data, 2); return v; }
+            case Scalar::INT32: { int32_t v; std::memcpy(&v, data, 4); return v; }
+            case Scalar::UINT32: { uint32_t v; std::memcpy(&v, data, 4); return v; }
+            case Scalar::FLOAT32: { float v; std::memcpy(&v, data, 4); return v; }
+            case Scalar::FLOAT64: { double v; std::memcpy(&v, data, 8); return v; }
+            default: return 0.0;
+        }
+    }
+
+    bool parseHeader(MeshErrorCode& errorCode, std::string& errorMsg) {
+        std::string_view line;
+        if (!text_.nextLine(line) || TextTokenizer::trim(line) != "ply") {
+            errorCode = MeshErrorCode::READ_FAILED;
+            errorMsg = "Invalid PLY file: missing 'ply' header";
+            return false;
+        }
+        bool headerEnd = false;
+        while (!headerEnd && text_.nextLine(line)) {
+            TextTokenizer tokens(line);
+            std::string_view keyword;
+            if (!tokens.nextToken(keyword)) continue;
+
+            if (keyword == "format") {
+                std::string_view format;
+                tokens.nextToken(format);
+                if (format == "ascii") {
+                    binary_ = false;
+                } else if (format == "binary_little_endian") {
+                    binary_ = true;
+                } else {
+                    errorCode = MeshErrorCode::FORMAT_UNSUPPORTED;
+                    errorMsg = "Unsupported PLY format for streaming: " + std::string(format);
+                    return false;
+                }
+            } else if (keyword == "element") {
+                std::string_view name;
+                Element element;
+                tokens.nextToken(name);
+                tokens.next(element.count);
+                element.name = std::string(name);
+                elements_.push_back(element);
+            } else if (keyword == "property" && !elements_.empty()) {
+                std::string_view typeName, name;
+                Property property;
+                tokens.nextToken(typeName);
+                if (typeName == "list") {
+                    std::string_view countName, itemName;
+                    tokens.nextToken(countName);
+                    tokens.nextToken(itemName);
+                    property.isList = true;
+                    property.countType = scalarType(countName);
+                    property.type = scalarType(itemName);
+                } else {
+                    property.type = scalarType(typeName);
+                }
+                tokens.nextToken(name);
+                property.name = std::string(name);
+                if (property.type == Scalar::INVALID || (property.isList && property.countType == Scalar::INVALID)) {
+                    errorCode = MeshErrorCode::READ_FAILED;
+                    errorMsg = "Invalid PLY file: unknown property type in '" + std::string(line) + "'";
+                    return false;
+                }
+                elements_.back().properties.push_back(property);
+            } else if (keyword == "end_header") {
+                headerEnd = true;
+            }
+        }
+        if (!headerEnd) {
+            errorCode = MeshErrorCode::READ_FAILED;
+            errorMsg = "Invalid PLY file: missing 'end_header'";
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Advance past elements whose instances are all read; sets atEnd_ after the last one
+     */
+    void skipFinishedElements() {
+        while (elementIndex_ < elements_.size() && instanceIndex_ >= elements_[elementIndex_].count) {
+            ++elementIndex_;
+            instanceIndex_ = 0;
+        }
+        atEnd_ = elementIndex_ == elements_.size();
+    }
+
+    /**
+     * @brief Store the decoded values of one vertex or face instance
+     * @param element Element being read
+     * @param values Scalar property values in declaration order
+     * @param list First list property values
+     * @param block Output block
+     */
+    void storeInstance(const Element& element, const double* values, const std::vector<uint32_t>& list, MeshBlock& block) {
+        if (element.name == "vertex") {
+            float xyz[3] = {0.0f, 0.0f, 0.0f};
+            for (size_t i = 0; i < element.properties.size(); ++i) {
+                const std::string& name = element.properties[i].name;
+                if (name == "x") xyz[0] = static_cast<float>(values[i]);
+                else if (name == "y") xyz[1] = static_cast<float>(values[i]);
+                else if (name == "z") xyz[2] = static_cast<float>(values[i]);
+            }
+            block.points.insert(block.points.end(), xyz, xyz + 3);
+        } else if (element.name == "face" && list.size() >= 3) {
+            block.cells.addCell(faceType(list.size()), list);
+        }
+    }
+
+    bool readASCIIInstance(const Element& element, MeshBlock& block) {
+        std::string_view line;
+        if (!text_.nextLine(line)) {
+            return false;
+        }
+        TextTokenizer tokens(line);
+        values_.assign(element.properties.size(), 0.0);
+        list_.clear();
+        bool haveList = false;
+        for (size_t i = 0; i < element.properties.size(); ++i) {
+            const Property& property = element.properties[i];
+            if (!property.isList) {
+                if (!tokens.next(values_[i])) {
+                    return false;
+                }
+                continue;
+            }
+            uint64_t count = 0;
+            if (!tokens.next(count)) {
+                return false;
+            }
+            for (uint64_t j = 0; j < count; ++j) {
+                int64_t index = 0;
+                if (!tokens.next(index)) {
+                    return false;
+                }
+                if (!haveList) {
+                    list_.push_back(static_cast<uint32_t>(index));
+                }
+            }
+            haveList = true;
+        }
+        storeInstance(element, values_.data(), list_, block);
+        return true;
+    }
+
+    bool readBinaryInstance(const Element& element, MeshBlock& block) {
+        const char* cursor = text_.current();
+        const char* end = file_.data() + file_.size();
+        values_.assign(element.properties.size(), 0.0);
+        list_.clear();
+        bool haveList = false;
+        for (size_t i = 0; i < element.properties.size(); ++i) {
+            const Property& property = element.properties[i];
+            if (!property.isList) {
+                const size_t size = scalarSize(property.type);
+                if (static_cast<size_t>(end - cursor) < size) {
+                    return false;
+                }
+                values_[i] = decodeScalar(cursor, property.type);
+                cursor += size;
+                continue;
+            }
+            const size_t countSize = scalarSize(property.countType);
+            if (static_cast<size_t>(end - cursor) < countSize) {
+                return false;
+            }
+            const uint64_t count = static_cast<uint64_t>(decodeScalar(cursor, property.countType));
+            cursor += countSize;
+            const size_t itemSize = scalarSize(property.type);
+            if (static_cast<uint64_t>(end - cursor) < count * itemSize) {
+                return false;
+            }
+            if (!haveList) {
+                for (uint64_t j = 0; j < count; ++j) {
+                    list_.push_back(static_cast<uint32_t>(decodeScalar(cursor + j * itemSize, property.type)));
+                }
+            }
+            cursor += count * itemSize;
+            haveList = true;
+        }
+        text_.skip(static_cast<size_t>(cursor - text_.current()));
+        storeInstance(element, values_.data(), list_, block);
+        return true;
+    }
+
+    bool binary_ = false;
+    std::vector<Element> elements_;
+    size_t elementIndex_ = 0;        // Element being read
+    uint64_t instanceIndex_ = 0;     // Next instance of that element
+    std::vector<double> values_;     // Scratch scalar values
+    std::vector<uint32_t> list_;     // Scratch list values
+};
+
+// ==============================
+// OFF
+// ==============================
+
+/**
+ * @brief OFF: counts header, then vertex coordinates, then one face per line
+ */
+class OFFStreamReader : public MappedStreamReader {
+public:
+    bool openFile(const std::string& filePath, const MeshStreamOptions& options,
+                  MeshErrorCode& errorCode, std::string& errorMsg) {
+        if (!mapFile(filePath, options, errorCode, errorMsg)) {
+            return false;
+        }
+        std::string_view header;
+        std::string_view magic;
+        if (text_.nextLine(header)) {
+            TextTokenizer(header).nextToken(magic);
+        }
+        if (magic != "OFF") {
+            errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
+            errorMsg = "Invalid OFF header. Expected 'OFF'";
+            return false;
+        }
+        int64_t numEdges = 0;
+        if (!(text_.next(vertexCount_) && text_.next(faceCount_) && text_.next(numEdges))) {
+            errorCode = MeshErrorCode::READ_FAILED;
+            errorMsg = "Failed to read vertex, face, edge counts";
+            return false;
+        }
+        info_.format = MeshFormat::OFF;
+        info_.meshType = MeshType::SURFACE_MESH;
+        info_.pointCount = vertexCount_;
+        info_.cellCount = faceCount_;
+        info_.pointCountKnown = true;
+        info_.cellCountKnown = true;
+        atEnd_ = vertexCount_ == 0 && faceCount_ == 0;
+        return true;
+    }
+
+protected:
+    bool parseBlock(MeshBlock& block, MeshErrorCode& errorCode, std::string& errorMsg) override {
+        const char* blockBegin = text_.current();
+        auto blockFull = [&]() { return static_cast<size_t>(text_.current() - blockBegin) >= options_.blockBytes; };
+
+        while (verticesRead_ < vertexCount_ && !blockFull()) {
+            float xyz[3];
+            if (!(text_.next(xyz[0]) && text_.next(xyz[1]) && text_.next(xyz[2]))) {
+                errorCode = MeshErrorCode::READ_FAILED;
+                errorMsg = "Failed to read vertex coordinates";
+                return false;
+            }
+            block.points.insert(block.points.end(), xyz, xyz + 3);
+            ++verticesRead_;
+        }
+
+        while (verticesRead_ == vertexCount_ && facesRead_ < faceCount_ && !blockFull()) {
+            uint64_t corners = 0;
+            if (!text_.next(corners)) {
+                errorCode = MeshErrorCode::READ_FAILED;
+                errorMsg = "Failed to read face vertex count";
+                return false;
+            }
+            indices_.resize(static_cast<size_t>(corners));
+            for (uint32_t& index : indices_) {
+                if (!text_.next(index)) {
+                    errorCode = MeshErrorCode::READ_FAILED;
+                    errorMsg = "Failed to read face vertex index";
+                    return false;
+                }
+            }
+            // Optional per-face color values follow the indices on the same line
+            std::string_view faceRest;
+            text_.nextLine(faceRest);
+            block.cells.addCell(faceType(indices_.size()), indices_);
+            ++facesRead_;
+        }
+
+        discardConsumed();
+        atEnd_ = verticesRead_ == vertexCount_ && facesRead_ == faceCount_;
+        return true;
+    }
+
+private:
+    uint64_t vertexCount_ = 0;
+    uint64_t faceCount_ = 0;
+    uint64_t verticesRead_ = 0;
+    uint64_t facesRead_ = 0;
+    std::vector<uint32_t> indices_;  // Scratch point indices
+};
+
+// ==============================
+// SU2
+// ==============================
+
+/**
+ * @brief SU2: keyword sections; NELEM and NPOIN blocks use the MeshReader::readSU2 line parsers
+ * Elements normally precede the points they reference, so writers must not assume point order.
+ */
+class SU2StreamReader : public MappedStreamReader {
+public:
+    bool openFile(const std::string& filePath, const MeshStreamOptions& options,
+                  MeshErrorCode& errorCode, std::string& errorMsg) {
+        if (!mapFile(filePath, options, errorCode, errorMsg)) {
+            return false;
+        }
+        info_.format = MeshFormat::SU2;
+        info_.meshType = MeshType::VOLUME_MESH;
+        if (!seekSection(errorCode, errorMsg)) {
+            return false;
+        }
+        if (section_ == Section::ELEMENTS) {
+            info_.cellCount = sectionRemaining_;
+            info_.cellCountKnown = true;
+        } else if (section_ == Section::POINTS) {
+            info_.pointCount = sectionRemaining_;
+            info_.pointCountKnown = true;
+        }
+        return true;
+    }
+
+protected:
+    bool parseBlock(MeshBlock& block, MeshErrorCode& errorCode, std::string& errorMsg) override {
+        if (section_ != Section::NONE) {
+            uint64_t lineCount = 0;
+            const std::string_view lines = takeLines(sectionRemaining_, lineCount);
+            if (lineCount == 0) {
+                errorCode = MeshErrorCode::READ_FAILED;
+                errorMsg = section_ == Section::ELEMENTS ? "Unexpected end of file while reading elements"
+                                                         : "Unexpected end of file while reading points";
+                return false;
+            }
+            if (section_ == Section::ELEMENTS) {
+                MeshTextParser::parseSU2Elements(lines, block.cells);
+            } else {
+                MeshTextParser::parseSU2Points(lines, ndime_, block.points);
+            }
+            sectionRemaining_ -= lineCount;
+            if (sectionRemaining_ == 0) {
+                section_ = Section::NONE;
+            }
+        }
+        discardConsumed();
+        return section_ != Section::NONE || seekSection(errorCode, errorMsg);
+    }
+
+private:
+    enum class Section { NONE, ELEMENTS, POINTS };
+
+    /**
+     * @brief Scan keyword lines up to the next NELEM/NPOIN section (sets atEnd_ at end of file)
+     */
+    bool seekSection(MeshErrorCode& errorCode, std::string& errorMsg) {
+        std::string_view line;
+        while (text_.nextLine(line)) {
+            if (line.empty() || line[0] == '%') {
+                continue;
+            }
+            const size_t separator = line.find('=');
+            if (separator == std::string_view::npos || separator + 1 == line.size()) {
+                continue;
+            }
+            const std::string_view key = TextTokenizer::trim(line.substr(0, separator));
+            const std::string_view valueStr = TextTokenizer::trim(line.substr(separator + 1));
+            if (key != "NDIME" && key != "NELEM" && key != "NPOIN") {
+                continue;
+            }
+
+            int64_t value = 0;
+            if (!TextTokenizer::parse(valueStr, value) || value < 0) {
+                errorCode = MeshErrorCode::READ_FAILED;
+                errorMsg = "Error reading SU2 file: invalid " + std::string(key) + " value '" + std::string(valueStr) + "'";
+                return false;
+            }
+            if (key == "NDIME") {
+                ndime_ = static_cast<int>(value);
+            } else if (value > 0) {
+                section_ = key == "NELEM" ? Section::ELEMENTS : Section::POINTS;
+                sectionRemaining_ = static_cast<uint64_t>(value);
+                return true;
+            }
+        }
+        atEnd_ = true;
+        return true;
+    }
+
+    int ndime_ = 3;
+    Section section_ = Section::NONE;
+    uint64_t sectionRemaining_ = 0;  // Lines left in the current section
+};
+
+/**
+ * @brief Open a concrete reader
+ */
+template<typename ReaderType>
+std::unique_ptr<MeshStreamReader> openReader(const std::string& filePath, const MeshStreamOptions& options,
+                                             MeshErrorCode& errorCode, std::string& errorMsg) {
+    auto reader = std::make_unique<ReaderType>();
+    if (!reader->openFile(filePath, options, errorCode, errorMsg)) {
+        return nullptr;
+    }
+    return reader;
+}
+
+/**
+ * @brief Whether a mapped STL file is binary (same rule as MeshReader::readSTL)
+ */
+bool isBinarySTL(const std::string& filePath) {
+    MappedFile file;
+    std::string mapError;
+    if (!file.open(filePath, mapError)) {
+        return true;
+    }
+    if (file.size() >= 84) {
+        uint32_t triangleCount;
+        std::memcpy(&triangleCount, file.data() + 80, sizeof(triangleCount));
+        if (file.size() == 84 + static_cast<uint64_t>(triangleCount) * 50) {
+            return true;
+        }
+    }
+    std::string keyword(file.data() ? file.data() : "", std::min<size_t>(file.size(), 5));
+    std::transform(keyword.begin(), keyword.end(), keyword.begin(), ::tolower);
+    return keyword != "solid";
+}
+
+} // namespace
+
+// ==============================
+// MeshStreamReader
+// ==============================
+
+/**
+ * @brief Check whether a format can be read as a stream
+ * @param format Mesh format
+ * @return Whether open() accepts the format
+ */
+bool MeshStreamReader::supportsFormat(MeshFormat format) {
+    switch (format) {
+        case MeshFormat::STL_ASCII:
+        case MeshFormat::STL_BINARY:
+        case MeshFormat::OBJ:
+        case MeshFormat::PLY_ASCII:
+        case MeshFormat::PLY_BINARY:
+        case MeshFormat::OFF:
+        case MeshFormat::SU2:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Open a file for streaming and parse its header
+ * @param filePath File path (UTF-8 encoded)
+ * @param format Source format (MeshFormat::UNKNOWN = auto detect)
+ * @param options Streaming options
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @return Reader positioned at the first block, nullptr on failure
+ */
+std::unique_ptr<MeshStreamReader> MeshStreamReader::open(const std::string& filePath,
+                                                         MeshFormat format,
+                                                         const MeshStreamOptions& options,
+                                                         MeshErrorCode& errorCode,
+                                                         std::string& errorMsg) {
+    if (!std::filesystem::exists(filePath)) {
+        errorCode = MeshErrorCode::FILE_NOT_EXIST;
+        errorMsg = "File does not exist: " + filePath;
+        return nullptr;
+    }
+    if (format == MeshFormat::UNKNOWN) {
+        format = MeshReader::detectFormatFromHeader(filePath);
+    }
+
+    try {
+        switch (format) {
+            case MeshFormat::STL_ASCII:
+            case MeshFormat::STL_BINARY:
+                // Binary exporters often start the header with "solid" as well
+                if (isBinarySTL(filePath)) {
+                    return openReader<STLBinaryStreamReader>(filePath, options, errorCode, errorMsg);
+                }
+                return openReader<STLASCIIStreamReader>(filePath, options, errorCode, errorMsg);
+            case MeshFormat::OBJ:
+                return openReader<OBJStreamReader>(filePath, options, errorCode, errorMsg);
+            case MeshFormat::PLY_ASCII:
+            case MeshFormat::PLY_BINARY:
+                return openReader<PLYStreamReader>(filePath, options, errorCode, errorMsg);
+            case MeshFormat::OFF:
+                return openReader<OFFStreamReader>(filePath, options, errorCode, errorMsg);
+            case MeshFormat::SU2:
+                return openReader<SU2StreamReader>(filePath, options, errorCode, errorMsg);
+            default:
+                errorCode = MeshErrorCode::FORMAT_UNSUPPORTED;
+                errorMsg = "Streaming read not supported for this format: " + filePath;
+                return nullptr;
+        }
+    } catch (const std::exception& e) {
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = std::string("Error opening mesh stream: ") + e.what();
+        return nullptr;
+    }
+}
+
+/**
+ * @brief Read the next block
+ * @param[out] block Output block (cleared first; may be empty at the end of the stream)
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @return Whether reading is successful
+ */
+bool MeshStreamReader::readBlock(MeshBlock& block, MeshErrorCode& errorCode, std::string& errorMsg) {
+    block.clear();
+    block.firstPoint = pointsRead_;
+    block.firstCell = cellsRead_;
+    if (atEnd_) {
+        errorCode = MeshErrorCode::SUCCESS;
+        return true;
+    }
+
+    try {
+        if (!parseBlock(block, errorCode, errorMsg)) {
+            return false;
+        }
+    } catch (const std::bad_alloc&) {
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = "Insufficient memory for stream block; reduce MeshStreamOptions::blockBytes";
+        return false;
+    } catch (const std::exception& e) {
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = std::string("Error reading mesh stream: ") + e.what();
+        return false;
+    }
+
+    pointsRead_ += block.pointCount();
+    cellsRead_ += block.cells.size();
+    // Cell connectivity uses 32-bit point indices
+    if (pointsRead_ > std::numeric_limits<uint32_t>::max()) {
+        errorCode = MeshErrorCode::READ_FAILED;
+        errorMsg = "Mesh stream exceeds the 32-bit point index range";
+        return false;
+    }
+    errorCode = MeshErrorCode::SUCCESS;
+    return true;
+}
@@ -0,0 +1,785 @@
+#include "MeshStream.h"
+#include "MappedFile.h"
+#include "OutputBuffer.h"
+#include "SurfaceCells.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <new>
+#include <system_error>
+
+MeshStreamWriter::~MeshStreamWriter() = default;
+
+namespace {
+
+// Width reserved for counts that are patched into headers by finish()
+constexpr int COUNT_FIELD_WIDTH = 20;
+// Points per chunk when ASCII point sections are formatted on several threads
+constexpr size_t FORMAT_CHUNK_ITEMS = 64 * 1024;
+// Initial size of the per-writer text block and the size at which facets are flushed
+constexpr size_t TEXT_BLOCK_BYTES = 1024 * 1024;
+
+/**
+ * @brief Temporary file holding a section that is merged into the output by finish()
+ * The file is removed when the object is destroyed.
+ */
+class SpoolFile {
+public:
+    ~SpoolFile() {
+        stream_.close();
+        if (!path_.empty()) {
+            std::error_code removeError;
+            std::filesystem::remove(path_, removeError);
+        }
+    }
+
+    /**
+     * @brief Create the spool file
+     * @param path Spool file path
+     * @return Whether the file was created
+     */
+    bool open(const std::string& path) {
+        path_ = path;
+        stream_.open(path, std::ios::binary | std::ios::trunc);
+        return stream_.is_open();
+    }
+
+    bool isOpen() const { return stream_.is_open(); }
+    std::ofstream& stream() { return stream_; }
+    const std::string& path() const { return path_; }
+
+    /**
+     * @brief Finish writing so the spool can be read back
+     * @return Whether all spooled data reached the disk
+     */
+    bool close() {
+        if (!stream_.is_open()) {
+            return true;
+        }
+        stream_.flush();
+        const bool ok = !stream_.fail();
+        stream_.close();
+        return ok;
+    }
+
+    /**
+     * @brief Copy the spooled bytes to the end of a stream
+     * @param out Destination stream
+     * @return Whether copying is successful
+     */
+    bool appendTo(std::ostream& out) {
+        if (!close()) {
+            return false;
+        }
+        std::ifstream in(path_, std::ios::binary);
+        if (!in.is_open()) {
+            return false;
+        }
+        if (in.peek() != std::ifstream::traits_type::eof()) {
+            out << in.rdbuf();
+        }
+        return !out.fail();
+    }
+
+private:
+    std::string path_;
+    std::ofstream stream_;
+};
+
+/**
+ * @brief Base of the streaming writers: output file, spool files and header count patching
+ */
+class FileStreamWriter : public MeshStreamWriter {
+public:
+    /**
+     * @brief Create the output file
+     * @return Whether the file was created
+     */
+    bool openOutput(const std::string& filePath, const FormatWriteOptions& writeOptions,
+                    const MeshStreamInfo& sourceInfo, const MeshStreamOptions& options,
+                    MeshErrorCode& errorCode, std::string& errorMsg) {
+        filePath_ = filePath;
+        writeOptions_ = writeOptions;
+        sourceInfo_ = sourceInfo;
+        options_ = options;
+
+        const std::filesystem::path parent = std::filesystem::path(filePath).parent_path();
+        std::error_code dirError;
+        if (!parent.empty()) {
+            std::filesystem::create_directories(parent, dirError);
+        }
+        out_.open(filePath, std::ios::binary | std::ios::trunc);
+        if (!out_.is_open()) {
+            errorCode = MeshErrorCode::WRITE_FAILED;
+            errorMsg = "Failed to open file for writing: " + filePath;
+            return false;
+        }
+        return true;
+    }
+
+protected:
+    /**
+     * @brief Create a spool file next to the output (or in MeshStreamOptions::tempDirectory)
+     * @param spool Spool to open
+     * @param tag Name suffix distinguishing the spools of one writer
+     * @return Whether the spool was created
+     */
+    bool openSpool(SpoolFile& spool, const char* tag, MeshErrorCode& errorCode, std::string& errorMsg) {
+        const std::filesystem::path output(filePath_);
+        std::filesystem::path directory = options_.tempDirectory.empty() ? output.parent_path()
+                                                                          : std::filesystem::path(options_.tempDirectory);
+        const std::filesystem::path spoolPath = directory / (output.filename().string() + "." + tag + ".spool");
+        if (!spool.open(spoolPath.string())) {
+            errorCode = MeshErrorCode::WRITE_FAILED;
+            errorMsg = "Failed to create spool file: " + spoolPath.string();
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Reserve a fixed-width field for a count that finish() will patch
+     * @return Position of the field in the output
+     */
+    std::streampos reserveCount() {
+        const std::streampos position = out_.tellp();
+        out_ << std::string(COUNT_FIELD_WIDTH, ' ');
+        return position;
+    }
+
+    /**
+     * @brief Write a count into a field reserved by reserveCount() (left aligned, space padded)
+     */
+    void patchCount(std::streampos position, uint64_t value) {
+        const std::streampos end = out_.tellp();
+        out_.seekp(position);
+        out_ << value;
+        out_.seekp(end);
+    }
+
+    /**
+     * @brief Flush the output and report write errors
+     */
+    bool closeOutput(MeshErrorCode& errorCode, std::string& errorMsg) {
+        out_.flush();
+        if (out_.fail()) {
+            errorCode = MeshErrorCode::WRITE_FAILED;
+            errorMsg = "Failed to write to file: " + filePath_;
+            return false;
+        }
+        out_.close();
+        if (pointsWritten_ == 0 || cellsWritten_ == 0) {
+            errorCode = MeshErrorCode::MESH_EMPTY;
+            errorMsg = "Mesh has no points or cells supported by the target format";
+            return false;
+        }
+        errorCode = MeshErrorCode::SUCCESS;
+        errorMsg = "";
+        return true;
+    }
+
+    /**
+     * @brief Write the text formatted into text_ to a stream and reset the block
+     * @param sink Output or spool stream
+     */
+    void flushText(std::ostream& sink) {
+        const std::string_view text = text_.pending();
+        if (!text.empty()) {
+            sink.write(text.data(), static_cast<std::streamsize>(text.size()));
+        }
+        text_.clear();
+    }
+
+    /**
+     * @brief Format "<prefix>x y z<suffix>" lines for the points of a block into text_
+     * @param block Block whose points are formatted
+     * @param prefix Text written before each point ("v " for OBJ)
+     */
+    void formatPointLines(const MeshBlock& block, std::string_view prefix) {
+        const float* points = block.points.data();
+        const int precision = writeOptions_.precision;
+        appendFormatted(text_, block.pointCount(), FORMAT_CHUNK_ITEMS, writeOptions_.formatThreads,
+            [&](OutputBuffer& sink, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    const float* point = points + i * 3;
+                    sink.append(prefix);
+                    sink.appendFloat(point[0], precision);
+                    sink.append(' ');
+                    sink.appendFloat(point[1], precision);
+                    sink.append(' ');
+                    sink.appendFloat(point[2], precision);
+                    sink.append('\n');
+                }
+            });
+    }
+
+    /**
+     * @brief Whether every point of the stream has been consumed (only known for counted sources)
+     */
+    bool allPointsWritten() const {
+        return sourceInfo_.pointCountKnown && pointsWritten_ == sourceInfo_.pointCount;
+    }
+
+    std::string filePath_;
+    FormatWriteOptions writeOptions_;
+    MeshStreamInfo sourceInfo_;
+    MeshStreamOptions options_;
+    std::ofstream out_;
+    OutputBuffer text_{TEXT_BLOCK_BYTES};  // In-memory text of the section being written (never opened)
+};
+
+// ==============================
+// PLY / OFF
+// ==============================
+
+/**
+ * @brief PLY (ASCII or binary little endian) and OFF: counted header, vertices, then faces
+ * Faces are written straight to the output once all vertices of a counted source are known;
+ * otherwise they are spooled and appended in finish().
+ */
+class FaceListStreamWriter : public FileStreamWriter {
+public:
+    enum class Flavor { PLY_ASCII, PLY_BINARY, OFF };
+
+    explicit FaceListStreamWriter(Flavor flavor) : flavor_(flavor) {}
+
+    bool writeHeader() {
+        if (flavor_ == Flavor::OFF) {
+            out_ << "OFF\n";
+            vertexCountField_ = reserveCount();
+            out_ << ' ';
+            faceCountField_ = reserveCount();
+            out_ << " 0\n";
+        } else {
+            out_ << "ply\n";
+            out_ << (flavor_ == Flavor::PLY_BINARY ? "format binary_little_endian 1.0\n" : "format ascii 1.0\n");
+            out_ << "comment Generated by MeshFormatConverter\n";
+            out_ << "element vertex ";
+            vertexCountField_ = reserveCount();
+            out_ << "\nproperty float x\nproperty float y\nproperty float z\n";
+            out_ << "element face ";
+            faceCountField_ = reserveCount();
+            out_ << "\nproperty list uchar int vertex_indices\nend_header\n";
+        }
+        return !out_.fail();
+    }
+
+    bool writeBlock(const MeshBlock& block, MeshErrorCode& errorCode, std::string& errorMsg) override {
+        const float* point = block.points.data();
+        const size_t pointCount = block.pointCount();
+        if (flavor_ == Flavor::PLY_BINARY) {
+            // Binary values are written in host byte order (little endian on all supported platforms)
+            out_.write(reinterpret_cast<const char*>(point), static_cast<std::streamsize>(pointCount * 3 * sizeof(float)));
+        } else {
+            formatPointLines(block, "");
+            flushText(out_);
+        }
+        pointsWritten_ += pointCount;
+
+        if (block.cells.empty()) {
+            return !out_.fail() || fail(errorCode, errorMsg);
+        }
+        if (!spooling_ && !allPointsWritten()) {
+            if (!openSpool(faces_, "faces", errorCode, errorMsg)) {
+                return false;
+            }
+            spooling_ = true;
+        }
+        std::ostream& sink = spooling_ ? static_cast<std::ostream&>(faces_.stream()) : out_;
+
+        bool tooLarge = false;
+        forEachFace(block.cells, [&](const uint32_t* indices, size_t count) {
+            if (flavor_ == Flavor::PLY_BINARY) {
+                // The list length is stored as uchar
+                if (count > std::numeric_limits<uint8_t>::max()) {
+                    tooLarge = true;
+                    return;
+                }
+                const uint8_t corners = static_cast<uint8_t>(count);
+                sink.write(reinterpret_cast<const char*>(&corners), 1);
+                sink.write(reinterpret_cast<const char*>(indices), static_cast<std::streamsize>(count * sizeof(uint32_t)));
+            } else {
+                text_.appendInt(count);
+                for (size_t k = 0; k < count; ++k) {
+                    text_.append(' ');
+                    text_.appendInt(indices[k]);
+                }
+                text_.append('\n');
+            }
+            ++cellsWritten_;
+        });
+        flushText(sink);
+        if (tooLarge) {
+            errorCode = MeshErrorCode::WRITE_FAILED;
+            errorMsg = "Binary PLY faces are limited to 255 vertices";
+            return false;
+        }
+        return !(out_.fail() || sink.fail()) || fail(errorCode, errorMsg);
+    }
+
+    bool finish(MeshErrorCode& errorCode, std::string& errorMsg) override {
+        if (spooling_ && !faces_.appendTo(out_)) {
+            return fail(errorCode, errorMsg);
+        }
+        patchCount(vertexCountField_, pointsWritten_);
+        patchCount(faceCountField_, cellsWritten_);
+        return closeOutput(errorCode, errorMsg);
+    }
+
+private:
+    bool fail(MeshErrorCode& errorCode, std::string& errorMsg) const {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        errorMsg = "Failed to write to file: " + filePath_;
+        return false;
+    }
+
+    Flavor flavor_;
+    std::streampos vertexCountField_;
+    std::streampos faceCountField_;
+    bool spooling_ = false;  // Whether faces go to the spool
+    SpoolFile faces_;
+};
+
+// ==============================
+// OBJ
+// ==============================
+
+/**
+ * @brief OBJ: "v", "f" and "l" lines in arrival order
+ * Cells are spooled (and appended in finish()) once a block references a vertex that has
+ * not been written yet, e.g. when the source lists elements before points.
+ */
+class OBJStreamWriter : public FileStreamWriter {
+public:
+    bool writeHeader() {
+        out_ << "# OBJ file generated by MeshFormatConverter\n";
+        return !out_.fail();
+    }
+
+    bool writeBlock(const MeshBlock& block, MeshErrorCode& errorCode, std::string& errorMsg) override {
+        formatPointLines(block, "v ");
+        flushText(out_);
+        pointsWritten_ += block.pointCount();
+
+        if (block.cells.empty()) {
+            return checkStreams(errorCode, errorMsg);
+        }
+        if (!spooling_) {
+            const auto& connectivity = block.cells.connectivity;
+            const bool forwardReference = std::any_of(connectivity.begin(), connectivity.end(),
+                [this](uint32_t index) { return index >= pointsWritten_; });
+            if (forwardReference) {
+                if (!openSpool(cells_, "cells", errorCode, errorMsg)) {
+                    return false;
+                }
+                spooling_ = true;
+            }
+        }
+        std::ostream& sink = spooling_ ? static_cast<std::ostream&>(cells_.stream()) : out_;
+
+        // OBJ indices are 1-based
+        for (size_t i = 0; i < block.cells.size(); ++i) {
+            if (block.cells.types[i] == VtkCellType::LINE && block.cells.cellSize(i) >= 2) {
+                text_.append('l');
+                const uint32_t* indices = block.cells.cellPoints(i);
+                for (size_t k = 0; k < block.cells.cellSize(i); ++k) {
+                    text_.append(' ');
+                    text_.appendInt(static_cast<uint64_t>(indices[k]) + 1);
+                }
+                text_.append('\n');
+                ++cellsWritten_;
+            }
+        }
+        forEachFace(block.cells, [&](const uint32_t* indices, size_t count) {
+            text_.append('f');
+            for (size_t k = 0; k < count; ++k) {
+                text_.append(' ');
+                text_.appendInt(static_cast<uint64_t>(indices[k]) + 1);
+            }
+            text_.append('\n');
+            ++cellsWritten_;
+        });
+        flushText(sink);
+        return checkStreams(errorCode, errorMsg);
+    }
+
+    bool finish(MeshErrorCode& errorCode, std::string& errorMsg) override {
+        if (spooling_ && !cells_.appendTo(out_)) {
+            errorCode = MeshErrorCode::WRITE_FAILED;
+            errorMsg = "Failed to write to file: " + filePath_;
+            return false;
+        }
+        return closeOutput(errorCode, errorMsg);
+    }
+
+private:
+    bool checkStreams(MeshErrorCode& errorCode, std::string& errorMsg) {
+        if (out_.fail() || (spooling_ && cells_.stream().fail())) {
+            errorCode = MeshErrorCode::WRITE_FAILED;
+            errorMsg = "Failed to write to file: " + filePath_;
+            return false;
+        }
+        return true;
+    }
+
+    bool spooling_ = false;  // Whether cells go to the spool
+    SpoolFile cells_;
+};
+
+// ==============================
+// STL
+// ==============================
+
+/**
+ * @brief STL (ASCII or binary): one facet per triangle, normals computed from the corners
+ * Triangles whose corners are in the current block are written immediately (always the case
+ * for STL sources). Otherwise points and the remaining triangles are spooled, and finish()
+ * resolves the corners through a memory mapping of the point spool.
+ */
+class STLStreamWriter : public FileStreamWriter {
+public:
+    explicit STLStreamWriter(bool binary) : binary_(binary) {}
+
+    bool writeHeader(MeshErrorCode& errorCode, std::string& errorMsg) {
+        if (binary_) {
+            char header[80] = {0};
+            const char title[] = "Binary STL generated by MeshFormatConverter";
+            std::memcpy(header, title, sizeof(title) - 1);
+            out_.write(header, sizeof(header));
+            const uint32_t placeholder = 0;
+            out_.write(reinterpret_cast<const char*>(&placeholder), sizeof(placeholder));
+        } else {
+            out_ << "solid " << writeOptions_.stlSolidName << '\n';
+        }
+        // Cells of non-STL sources may reference points of any earlier block
+        if (!sourceInfo_.blockLocalCells && !openSpool(points_, "points", errorCode, errorMsg)) {
+            return false;
+        }
+        return !out_.fail();
+    }
+
+    bool writeBlock(const MeshBlock& block, MeshErrorCode& errorCode, std::string& errorMsg) override {
+        if (points_.isOpen()) {
+            points_.stream().write(reinterpret_cast<const char*>(block.points.data()),
+                                   static_cast<std::streamsize>(block.points.size() * sizeof(float)));
+        }
+        pointsWritten_ += block.pointCount();
+
+        const uint64_t blockEnd = block.firstPoint + block.pointCount();
+        bool deferredHere = false;
+        forEachTriangle(block.cells, [&](uint32_t a, uint32_t b, uint32_t c) {
+            const bool local = a >= block.firstPoint && b >= block.firstPoint && c >= block.firstPoint &&
+                               a < blockEnd && b < blockEnd && c < blockEnd;
+            if (deferring_ || !local) {
+                deferredHere = true;
+                if (!deferring_) {
+                    deferring_ = true;
+                    if (!cells_.isOpen() && !openSpool(cells_, "triangles", errorCode, errorMsg)) {
+                        return;
+                    }
+                }
+                const uint32_t triangle[3] = {a, b, c};
+                cells_.stream().write(reinterpret_cast<const char*>(triangle), sizeof(triangle));
+                return;
+            }
+            const float* base = block.points.data() - block.firstPoint * 3;
+            writeFacet(base + static_cast<size_t>(a) * 3, base + static_cast<size_t>(b) * 3, base + static_cast<size_t>(c) * 3);
+        });
+        if (deferredHere && !points_.isOpen()) {
+            // STL sources never reference other blocks; anything else needs the point spool
+            errorCode = MeshErrorCode::WRITE_FAILED;
+            errorMsg = "STL stream cell references a point outside its block";
+            return false;
+        }
+        if (deferring_ && !cells_.isOpen()) {
+            return false;
+        }
+        return checkStreams(errorCode, errorMsg);
+    }
+
+    bool finish(MeshErrorCode& errorCode, std::string& errorMsg) override {
+        if (deferring_) {
+            if (!points_.close() || !cells_.close()) {
+                errorCode = MeshErrorCode::WRITE_FAILED;
+                errorMsg = "Failed to write spool files for " + filePath_;
+                return false;
+            }
+            MappedFile pointFile;
+            MappedFile triangleFile;
+            if (!pointFile.open(points_.path(), errorMsg) || !triangleFile.open(cells_.path(), errorMsg)) {
+                errorCode = MeshErrorCode::WRITE_FAILED;
+                return false;
+            }
+            const float* points = reinterpret_cast<const float*>(pointFile.data());
+            const size_t pointCount = pointFile.size() / (3 * sizeof(float));
+            const size_t triangleCount = triangleFile.size() / (3 * sizeof(uint32_t));
+            for (size_t i = 0; i < triangleCount; ++i) {
+                uint32_t triangle[3];
+                std::memcpy(triangle, triangleFile.data() + i * sizeof(triangle), sizeof(triangle));
+                if (triangle[0] >= pointCount || triangle[1] >= pointCount || triangle[2] >= pointCount) {
+                    errorCode = MeshErrorCode::WRITE_FAILED;
+                    errorMsg = "STL stream cell references a missing point";
+                    return false;
+                }
+                writeFacet(points + static_cast<size_t>(triangle[0]) * 3,
+                           points + static_cast<size_t>(triangle[1]) * 3,
+                           points + static_cast<size_t>(triangle[2]) * 3);
+            }
+            flushText(out_);
+        }
+
+        if (binary_) {
+            if (cellsWritten_ > std::numeric_limits<uint32_t>::max()) {
+                errorCode = MeshErrorCode::WRITE_FAILED;
+                errorMsg = "Binary STL is limited to 2^32-1 triangles";
+                return false;
+            }
+            const uint32_t triangleCount = static_cast<uint32_t>(cellsWritten_);
+            out_.seekp(80);
+            out_.write(reinterpret_cast<const char*>(&triangleCount), sizeof(triangleCount));
+            out_.seekp(0, std::ios::end);
+        } else {
+            out_ << "endsolid " << writeOptions_.stlSolidName << '\n';
+        }
+        return closeOutput(errorCode, errorMsg);
+    }
+
+private:
+    void writeFacet(const float* a, const float* b, const float* c) {
+        float normal[3];
+        facetNormal(a, b, c, normal);
+
+        if (binary_) {
+            char record[50];
+            std::memcpy(record, normal, 12);
+            std::memcpy(record + 12, a, 12);
+            std::memcpy(record + 24, b, 12);
+            std::memcpy(record + 36, c, 12);
+            std::memset(record + 48, 0, 2);
+            text_.append(record, sizeof(record));
+        } else {
+            const int precision = writeOptions_.precision;
+            text_.append("facet normal ");
+            appendVector(normal, precision);
+            text_.append("\n outer loop\n");
+            for (const float* corner : {a, b, c}) {
+                text_.append("  vertex ");
+                appendVector(corner, precision);
+                text_.append('\n');
+            }
+            text_.append(" endloop\nendfacet\n");
+        }
+        if (text_.pending().size() >= TEXT_BLOCK_BYTES) {
+            flushText(out_);
+        }
+        ++cellsWritten_;
+    }
+
+    void appendVector(const float* xyz, int precision) {
+        text_.appendFloat(xyz[0], precision);
+        text_.append(' ');
+        text_.appendFloat(xyz[1], precision);
+        text_.append(' ');
+        text_.appendFloat(xyz[2], precision);
+    }
+
+    bool checkStreams(MeshErrorCode& errorCode, std::string& errorMsg) {
+        flushText(out_);
+        if (out_.fail() || (points_.isOpen() && points_.stream().fail()) ||
+            (cells_.isOpen() && cells_.stream().fail())) {
+            errorCode = MeshErrorCode::WRITE_FAILED;
+            errorMsg = "Failed to write to file: " + filePath_;
+            return false;
+        }
+        return true;
+    }
+
+    bool binary_;
+    bool deferring_ = false;  // Whether triangles go to the spool
+    SpoolFile points_;        // Raw xyz floats of all points (non-STL sources)
+    SpoolFile cells_;         // Deferred triangles as uint32 triples
+};
+
+// ==============================
+// SU2
+// ==============================
+
+/**
+ * @brief SU2: NELEM section written directly, NPOIN section spooled and appended in finish()
+ * Same layout as MeshWriter::writeSU2 (elements from forEachSU2Element, in cell order).
+ */
+class SU2StreamWriter : public FileStreamWriter {
+public:
+    bool writeHeader(MeshErrorCode& errorCode, std::string& errorMsg) {
+        out_ << "% SU2 mesh file generated by MeshFormatConverter\n";
+        out_ << "%\n";
+        out_ << "NDIME= 3\n\n";
+        out_ << "NELEM= ";
+        elementCountField_ = reserveCount();
+        out_ << '\n';
+        if (!openSpool(points_, "points", errorCode, errorMsg)) {
+            return false;
+        }
+        return !out_.fail();
+    }
+
+    bool writeBlock(const MeshBlock& block, MeshErrorCode& errorCode, std::string& errorMsg) override {
+        // NPOIN lines use fixed notation with writeOptions_.precision decimals
+        std::ostream& points = points_.stream();
+        const float* blockPoints = block.points.data();
+        const int precision = writeOptions_.precision;
+        const uint64_t firstPoint = pointsWritten_;
+        appendFormatted(text_, block.pointCount(), FORMAT_CHUNK_ITEMS, writeOptions_.formatThreads,
+            [&](OutputBuffer& sink, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    const float* point = blockPoints + i * 3;
+                    sink.appendFixed(point[0], precision);
+                    sink.append(' ');
+                    sink.appendFixed(point[1], precision);
+                    sink.append(' ');
+                    sink.appendFixed(point[2], precision);
+                    sink.append(' ');
+                    sink.appendInt(firstPoint + i);
+                    sink.append('\n');
+                }
+            });
+        flushText(points);
+        pointsWritten_ += block.pointCount();
+
+        forEachSU2Element(block.cells, 0, block.cells.size(), [this](int type, const uint32_t* indices, size_t count) {
+            writeElement(type, indices, count);
+        });
+        flushText(out_);
+
+        if (out_.fail() || points.fail()) {
+            errorCode = MeshErrorCode::WRITE_FAILED;
+            errorMsg = "Failed to write to file: " + filePath_;
+            return false;
+        }
+        return true;
+    }
+
+    bool finish(MeshErrorCode& errorCode, std::string& errorMsg) override {
+        patchCount(elementCountField_, cellsWritten_);
+        out_ << "\nNPOIN= " << pointsWritten_ << '\n';
+        if (!points_.appendTo(out_)) {
+            errorCode = MeshErrorCode::WRITE_FAILED;
+            errorMsg = "Failed to write to file: " + filePath_;
+            return false;
+        }
+        out_ << "\nNMARK= 0\n";
+        return closeOutput(errorCode, errorMsg);
+    }
+
+private:
+    void writeElement(int type, const uint32_t* indices, size_t count) {
+        text_.appendInt(type);
+        for (size_t k = 0; k < count; ++k) {
+            text_.append(' ');
+            text_.appendInt(indices[k]);
+        }
+        text_.append(" 0\n");
+        ++cellsWritten_;
+    }
+
+    std::streampos elementCountField_;
+    SpoolFile points_;  // NPOIN lines
+};
+
+} // namespace
+
+// ==============================
+// MeshStreamWriter
+// ==============================
+
+/**
+ * @brief Check whether a format can be written as a stream
+ * @param format Mesh format
+ * @return Whether create() accepts the format
+ */
+bool MeshStreamWriter::supportsFormat(MeshFormat format) {
+    switch (format) {
+        case MeshFormat::STL_ASCII:
+        case MeshFormat::STL_BINARY:
+        case MeshFormat::OBJ:
+        case MeshFormat::PLY_ASCII:
+        case MeshFormat::PLY_BINARY:
+        case MeshFormat::OFF:
+        case MeshFormat::SU2:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Create the output file and write its header
+ * @param filePath Output file path (UTF-8 encoded)
+ * @param format Target format (STL_ASCII/PLY_ASCII write text, STL_BINARY/PLY_BINARY binary)
+ * @param writeOptions Write options (precision, STL solid name)
+ * @param sourceInfo Description of the stream that will be written
+ * @param options Streaming options
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @return Writer ready for writeBlock(), nullptr on failure
+ */
+std::unique_ptr<MeshStreamWriter> MeshStreamWriter::create(const std::string& filePath,
+                                                           MeshFormat format,
+                                                           const FormatWriteOptions& writeOptions,
+                                                           const MeshStreamInfo& sourceInfo,
+                                                           const MeshStreamOptions& options,
+                                                           MeshErrorCode& errorCode,
+                                                           std::string& errorMsg) {
+    try {
+        switch (format) {
+            case MeshFormat::STL_ASCII:
+            case MeshFormat::STL_BINARY: {
+                auto writer = std::make_unique<STLStreamWriter>(format == MeshFormat::STL_BINARY);
+                if (!writer->openOutput(filePath, writeOptions, sourceInfo, options, errorCode, errorMsg) ||
+                    !writer->writeHeader(errorCode, errorMsg)) {
+                    return nullptr;
+                }
+                return writer;
+            }
+            case MeshFormat::OBJ: {
+                auto writer = std::make_unique<OBJStreamWriter>();
+                if (!writer->openOutput(filePath, writeOptions, sourceInfo, options, errorCode, errorMsg)) {
+                    return nullptr;
+                }
+                writer->writeHeader();
+                return writer;
+            }
+            case MeshFormat::PLY_ASCII:
+            case MeshFormat::PLY_BINARY:
+            case MeshFormat::OFF: {
+                const auto flavor = format == MeshFormat::OFF ? FaceListStreamWriter::Flavor::OFF
+                                  : format == MeshFormat::PLY_BINARY ? FaceListStreamWriter::Flavor::PLY_BINARY
+                                  : FaceListStreamWriter::Flavor::PLY_ASCII;
+                auto writer = std::make_unique<FaceListStreamWriter>(flavor);
+                if (!writer->openOutput(filePath, writeOptions, sourceInfo, options, errorCode, errorMsg)) {
+                    return nullptr;
+                }
+                writer->writeHeader();
+                return writer;
+            }
+            case MeshFormat::SU2: {
+                auto writer = std::make_unique<SU2StreamWriter>();
+                if (!writer->openOutput(filePath, writeOptions, sourceInfo, options, errorCode, errorMsg) ||
+                    !writer->writeHeader(errorCode, errorMsg)) {
+                    return nullptr;
+                }
+                return writer;
+            }
+            default:
+                errorCode = MeshErrorCode::FORMAT_UNSUPPORTED;
+                errorMsg = "Streaming write not supported for this format";
+                return nullptr;
+        }
+    } catch (const std::exception& e) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        errorMsg = std::string("Error creating mesh stream writer: ") + e.what();
+        return nullptr;
+    }
+}
@@ -0,0 +1,347 @@
+#include "MeshTextParser.h"
+#include "GmshElements.h"
+#include "JobControl.h"
+#include "TextTokenizer.h"
+#include <cstdint>
+
+/**
+ * @brief Parse the "v", "f" and "l" lines of an OBJ text chunk
+ * OBJ indices are absolute, so chunks need no index fix-up when they are concatenated.
+ * @param chunkText Line-aligned part of the file
+ * @param[out] chunk Parse result
+ */
+void MeshTextParser::parseOBJChunk(std::string_view chunkText, ObjChunk& chunk) {
+    TextTokenizer text(chunkText);
+    std::string_view line;
+    std::vector<uint32_t> refIndices;
+    
+    // Parses "v", "v/vt" or "v/vt/vn" references; OBJ indices are 1-based
+    auto readVertexRefs = [&refIndices](TextTokenizer& tokens) {
+        refIndices.clear();
+        std::string_view vertexRef;
+        while (tokens.nextToken(vertexRef)) {
+            int64_t vertexIndex;
+            if (!TextTokenizer::parse(vertexRef.substr(0, vertexRef.find('/')), vertexIndex)) {
+                return false;
+            }
+            refIndices.push_back(static_cast<uint32_t>(vertexIndex - 1));
+        }
+        return true;
+    };
+    
+    // Read chunk line by line
+    ProgressMeter meter;
+    while (text.nextLine(line)) {
+        meter.add(line.size() + 1);
+        TextTokenizer tokens(line);
+        std::string_view keyword;
+        
+        // Skip empty lines and comments
+        if (!tokens.nextToken(keyword) || keyword[0] == '#') continue;
+        
+        // Check if it's a vertex definition
+        if (keyword == "v") {
+            float x, y, z;
+            if (tokens.next(x) && tokens.next(y) && tokens.next(z)) {
+                chunk.vertices.push_back(x);
+                chunk.vertices.push_back(y);
+                chunk.vertices.push_back(z);
+            }
+        }
+        // Check if it's a face definition
+        else if (keyword == "f") {
+            if (!readVertexRefs(tokens)) {
+                chunk.error = "Invalid face index in OBJ file: " + std::string(line);
+                return;
+            }
+            
+            // Skip faces with less than 3 vertices
+            if (refIndices.size() < 3) {
+                continue;
+            }
+            
+            // Determine cell type based on number of vertices
+            VtkCellType cellType;
+            if (refIndices.size() == 3) {
+                cellType = VtkCellType::TRIANGLE;
+            } else if (refIndices.size() == 4) {
+                cellType = VtkCellType::QUAD;
+            } else {
+                // For polygons with more than 4 vertices, use POLYGON type
+                cellType = VtkCellType::POLYGON;
+            }
+            chunk.faces.addCell(cellType, refIndices);
+        }
+        // Check if it's a line definition
+        else if (keyword == "l") {
+            if (!readVertexRefs(tokens)) {
+                chunk.error = "Invalid line index in OBJ file: " + std::string(line);
+                return;
+            }
+            
+            // For lines, create line cells
+            if (!refIndices.empty()) {
+                chunk.lines.addCell(VtkCellType::LINE, refIndices);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Parse the element lines of an SU2 NELEM section
+ * Lines with an unknown element type are skipped; the trailing element index is dropped.
+ * @param blockText Line-aligned part of the section
+ * @param[out] cells Parsed cells
+ */
+template<typename Index>
+void MeshTextParser::parseSU2Elements(std::string_view blockText, BasicCellArray<Index>& cells) {
+    TextTokenizer text(blockText);
+    std::string_view line;
+    std::vector<Index> pointIndices;
+    
+    ProgressMeter meter;
+    while (text.nextLine(line)) {
+        meter.add(line.size() + 1);
+        TextTokenizer elemTokens(line);
+        int elemType;
+        if (!elemTokens.next(elemType)) {
+            continue;
+        }
+
+        VtkCellType cellType;
+        switch (elemType) {
+            case 1:
+                cellType = VtkCellType::VERTEX;
+                break;
+            case 3:
+                cellType = VtkCellType::LINE;
+                break;
+            case 5:
+                cellType = VtkCellType::TRIANGLE;
+                break;
+            case 9:
+                cellType = VtkCellType::QUAD;
+                break;
+            case 10:
+                cellType = VtkCellType::TETRA;
+                break;
+            case 12:
+                cellType = VtkCellType::HEXAHEDRON;
+                break;
+            case 13:
+                cellType = VtkCellType::WEDGE;
+                break;
+            case 14:
+                cellType = VtkCellType::PYRAMID;
+                break;
+            default:
+                continue;
+        }
+
+        pointIndices.clear();
+        int64_t pointIndex;
+        while (elemTokens.next(pointIndex)) {
+            pointIndices.push_back(static_cast<Index>(pointIndex));
+        }
+
+        // The last value is the element index
+        if (!pointIndices.empty()) {
+            pointIndices.pop_back();
+        }
+
+        cells.addCell(cellType, pointIndices);
+    }
+}
+
+/**
+ * @brief Parse the point lines of an SU2 NPOIN section
+ * Lines without the expected coordinates and point index are skipped.
+ * @param blockText Line-aligned part of the section
+ * @param ndime Mesh dimension (2 or 3)
+ * @param[out] points Parsed xyz coordinates (z = 0 for 2D meshes)
+ */
+template<typename Real>
+void MeshTextParser::parseSU2Points(std::string_view blockText, int ndime, std::vector<Real>& points) {
+    TextTokenizer text(blockText);
+    std::string_view line;
+    
+    ProgressMeter meter;
+    while (text.nextLine(line)) {
+        meter.add(line.size() + 1);
+        TextTokenizer pointTokens(line);
+        Real x = 0, y = 0, z = 0;
+        int64_t pointId;
+
+        if (ndime == 2) {
+            if (!(pointTokens.next(x) && pointTokens.next(y) && pointTokens.next(pointId))) {
+                continue;
+            }
+        } else {
+            if (!(pointTokens.next(x) && pointTokens.next(y) && pointTokens.next(z) && pointTokens.next(pointId))) {
+                continue;
+            }
+        }
+
+        points.push_back(x);
+        points.push_back(y);
+        points.push_back(z);
+    }
+}
+
+/**
+ * @brief Parse the "tag x y z" lines of an MSH 2.2 $Nodes section
+ * @param blockText Line-aligned part of the section
+ * @param[out] tags Node tags in file order
+ * @param[out] points Parsed xyz coordinates
+ */
+template<typename Real>
+void MeshTextParser::parseGmshNodes(std::string_view blockText, std::vector<uint64_t>& tags, std::vector<Real>& points) {
+    TextTokenizer text(blockText);
+    std::string_view line;
+
+    ProgressMeter meter;
+    while (text.nextLine(line)) {
+        meter.add(line.size() + 1);
+        TextTokenizer nodeTokens(line);
+        uint64_t tag;
+        Real x, y, z;
+        if (nodeTokens.next(tag) && nodeTokens.next(x) && nodeTokens.next(y) && nodeTokens.next(z)) {
+            tags.push_back(tag);
+            points.push_back(x);
+            points.push_back(y);
+            points.push_back(z);
+        }
+    }
+}
+
+/**
+ * @brief Parse the tag lines of an MSH 4.1 node block
+ * @param blockText Line-aligned part of the block
+ * @param[out] values Node tags
+ */
+void MeshTextParser::parseGmshNodeTags(std::string_view blockText, std::vector<uint64_t>& values) {
+    TextTokenizer text(blockText);
+    ProgressMeter meter;
+    uint64_t tag;
+    while (text.next(tag)) {
+        values.push_back(tag);
+        meter.reach(text.position());
+    }
+}
+
+/**
+ * @brief Parse the "x y z [u v w]" lines of an MSH 4.1 node block
+ * @param blockText Line-aligned part of the block
+ * @param[out] values xyz coordinates (parametric coordinates are dropped)
+ */
+template<typename Real>
+void MeshTextParser::parseGmshCoordinates(std::string_view blockText, std::vector<Real>& values) {
+    TextTokenizer text(blockText);
+    std::string_view line;
+
+    ProgressMeter meter;
+    while (text.nextLine(line)) {
+        meter.add(line.size() + 1);
+        TextTokenizer coordTokens(line);
+        Real x, y, z;
+        if (coordTokens.next(x) && coordTokens.next(y) && coordTokens.next(z)) {
+            values.push_back(x);
+            values.push_back(y);
+            values.push_back(z);
+        }
+    }
+}
+
+/**
+ * @brief Parse the "id type ntags tags... nodes..." lines of an MSH 2.2 $Elements section
+ * Lines with an unknown element type are skipped; higher-order elements keep their corners.
+ * @param blockText Line-aligned part of the section
+ * @param[out] chunk Parse result
+ */
+void MeshTextParser::parseGmshElements(std::string_view blockText, GmshElementChunk& chunk) {
+    TextTokenizer text(blockText);
+    std::string_view line;
+    uint64_t nodeTags[64];
+
+    ProgressMeter meter;
+    while (text.nextLine(line)) {
+        meter.add(line.size() + 1);
+        TextTokenizer elemTokens(line);
+        uint64_t elementId;
+        int gmshType;
+        int tagCount;
+        if (!(elemTokens.next(elementId) && elemTokens.next(gmshType) && elemTokens.next(tagCount))) {
+            continue;
+        }
+        const GmshElementInfo info = gmshElementInfo(gmshType);
+        if (info.nodeCount == 0) {
+            continue;
+        }
+
+        // By convention the first tag is the physical group and the second the elementary entity
+        int32_t tags[2] = {0, 0};
+        for (int k = 0; k < tagCount; ++k) {
+            int32_t tag;
+            if (!elemTokens.next(tag)) {
+                chunk.error = "Invalid element tags in Gmsh file: " + std::string(line);
+                return;
+            }
+            if (k < 2) {
+                tags[k] = tag;
+            }
+        }
+        for (int k = 0; k < info.nodeCount; ++k) {
+            if (!elemTokens.next(nodeTags[k])) {
+                chunk.error = "Element has too few nodes in Gmsh file: " + std::string(line);
+                return;
+            }
+        }
+        chunk.cells.addCell(info.cellType, nodeTags, static_cast<size_t>(info.cornerCount));
+        chunk.physicalTags.push_back(tags[0]);
+        chunk.entityTags.push_back(tags[1]);
+    }
+}
+
+/**
+ * @brief Parse the "id nodes..." lines of an MSH 4.1 element block
+ * @param blockText Line-aligned part of the block
+ * @param gmshType Element type of the block
+ * @param entityTag Entity the block belongs to
+ * @param physicalTag Physical group of the entity (0 = none)
+ * @param[out] chunk Parse result
+ */
+void MeshTextParser::parseGmshElementBlock(std::string_view blockText, int gmshType, int entityTag, int physicalTag,
+                                           GmshElementChunk& chunk) {
+    const GmshElementInfo info = gmshElementInfo(gmshType);
+    TextTokenizer text(blockText);
+    std::string_view line;
+    uint64_t nodeTags[64];
+
+    ProgressMeter meter;
+    while (text.nextLine(line)) {
+        meter.add(line.size() + 1);
+        TextTokenizer elemTokens(line);
+        uint64_t elementId;
+        if (!elemTokens.next(elementId)) {
+            continue;
+        }
+        for (int k = 0; k < info.nodeCount; ++k) {
+            if (!elemTokens.next(nodeTags[k])) {
+                chunk.error = "Element has too few nodes in Gmsh file: " + std::string(line);
+                return;
+            }
+        }
+        chunk.cells.addCell(info.cellType, nodeTags, static_cast<size_t>(info.cornerCount));
+        chunk.physicalTags.push_back(physicalTag);
+        chunk.entityTags.push_back(entityTag);
+    }
+}
+
+template void MeshTextParser::parseSU2Elements<uint32_t>(std::string_view, BasicCellArray<uint32_t>&);
+template void MeshTextParser::parseSU2Elements<uint64_t>(std::string_view, BasicCellArray<uint64_t>&);
+template void MeshTextParser::parseSU2Points<float>(std::string_view, int, std::vector<float>&);
+template void MeshTextParser::parseSU2Points<double>(std::string_view, int, std::vector<double>&);
+template void MeshTextParser::parseGmshNodes<float>(std::string_view, std::vector<uint64_t>&, std::vector<float>&);
+template void MeshTextParser::parseGmshNodes<double>(std::string_view, std::vector<uint64_t>&, std::vector<double>&);
+template void MeshTextParser::parseGmshCoordinates<float>(std::string_view, std::vector<float>&);
+template void MeshTextParser::parseGmshCoordinates<double>(std::string_view, std::vector<double>&);
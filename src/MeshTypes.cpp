@@ -1,9 +1,234 @@
 #include "MeshTypes.h"
+#include "MeshKernels.h"
+
+#include <algorithm>
+
+// ==============================================================================
+// BasicCellArray
+// ==============================================================================
+
+/**
+ * @brief Remove all cells (keeps the leading zero offset)
+ */
+template<typename Index>
+void BasicCellArray<Index>::clear() {
+    types.clear();
+    offsets.assign(1, 0);
+    connectivity.clear();
+}
+
+/**
+ * @brief Reserve storage for cells
+ * @param cellCount Expected cell count
+ * @param connectivityCount Expected total number of point indices (0 = unknown)
+ */
+template<typename Index>
+void BasicCellArray<Index>::reserve(size_t cellCount, size_t connectivityCount) {
+    types.reserve(cellCount);
+    offsets.reserve(cellCount + 1);
+    if (connectivityCount > 0) {
+        connectivity.reserve(connectivityCount);
+    }
+}
+
+/**
+ * @brief Append one cell
+ * @param type Cell type
+ * @param pointIndices Point indices of the cell
+ * @param count Number of point indices
+ */
+template<typename Index>
+void BasicCellArray<Index>::addCell(VtkCellType type, const Index* pointIndices, size_t count) {
+    types.push_back(type);
+    connectivity.insert(connectivity.end(), pointIndices, pointIndices + count);
+    offsets.push_back(static_cast<Index>(connectivity.size()));
+}
+
+/**
+ * @brief Append all cells of another cell array
+ * @param other Cells to append
+ * @param pointOffset Value added to every appended point index (for merging meshes)
+ */
+template<typename Index>
+void BasicCellArray<Index>::append(const BasicCellArray& other, Index pointOffset) {
+    const Index base = static_cast<Index>(connectivity.size());
+    types.insert(types.end(), other.types.begin(), other.types.end());
+
+    offsets.reserve(offsets.size() + other.size());
+    for (size_t i = 1; i < other.offsets.size(); ++i) {
+        offsets.push_back(base + other.offsets[i]);
+    }
+
+    if (pointOffset == 0) {
+        connectivity.insert(connectivity.end(), other.connectivity.begin(), other.connectivity.end());
+    } else {
+        connectivity.reserve(connectivity.size() + other.connectivity.size());
+        for (Index index : other.connectivity) {
+            connectivity.push_back(index + pointOffset);
+        }
+    }
+}
+
+/**
+ * @brief Replace contents with cells in the legacy per-cell form
+ * @param cells Legacy cells
+ */
+template<typename Index>
+void BasicCellArray<Index>::assign(const std::vector<Cell>& cells) {
+    size_t connectivityCount = 0;
+    for (const auto& cell : cells) {
+        connectivityCount += cell.pointIndices.size();
+    }
+
+    clear();
+    reserve(cells.size(), connectivityCount);
+    for (const auto& cell : cells) {
+        addCell(cell.type, cell.pointIndices);
+    }
+}
+
+/**
+ * @brief Convert to the legacy per-cell form (one allocation per cell, avoid on hot paths)
+ * @return Legacy cells
+ */
+template<typename Index>
+std::vector<typename BasicCellArray<Index>::Cell> BasicCellArray<Index>::toCells() const {
+    std::vector<Cell> result;
+    result.reserve(size());
+    for (size_t i = 0; i < size(); ++i) {
+        result.push_back((*this)[i].toCell());
+    }
+    return result;
+}
+
+// ==============================================================================
+// MeshAttribute
+// ==============================================================================
+
+/**
+ * @brief Create a value-initialized attribute
+ * @param type Element type
+ * @param components Components per tuple
+ * @param tupleCount Number of tuples
+ */
+MeshAttribute::MeshAttribute(AttributeType type, int components, size_t tupleCount) {
+    switch (type) {
+        case AttributeType::INT32:   storage_ = std::vector<int32_t>(); break;
+        case AttributeType::INT64:   storage_ = std::vector<int64_t>(); break;
+        case AttributeType::FLOAT64: storage_ = std::vector<double>(); break;
+        default:                     storage_ = std::vector<float>(); break;
+    }
+    setComponents(components);
+    resize(tupleCount);
+}
+
+/**
+ * @brief Get number of scalar values
+ * @return tupleCount * components
+ */
+size_t MeshAttribute::size() const {
+    return visit([](const auto& values) { return values.size(); });
+}
+
+/**
+ * @brief Get the tuple width for a tuple count
+ * A single-component buffer whose length is a multiple of the tuple count is a flat list with
+ * several values per tuple (the untyped layout), so its width is inferred from the length.
+ * @param tuples Number of tuples the attribute belongs to (points or cells)
+ * @return Components per tuple, or 0 when the length does not fit the tuple count
+ */
+int MeshAttribute::componentsFor(size_t tuples) const {
+    const size_t count = size();
+    if (count == tuples * static_cast<size_t>(components_)) {
+        return components_;
+    }
+    if (components_ == 1 && tuples > 0 && count % tuples == 0) {
+        return static_cast<int>(count / tuples);
+    }
+    return 0;
+}
+
+/**
+ * @brief Get bytes per scalar value
+ * @return Element size
+ */
+size_t MeshAttribute::elementSize() const {
+    return visit([](const auto& values) { return sizeof(values[0]); });
+}
+
+/**
+ * @brief Get the contiguous value buffer
+ * @return Pointer to the first value (element type given by type())
+ */
+void* MeshAttribute::data() {
+    return visit([](auto& values) -> void* { return values.data(); });
+}
+
+const void* MeshAttribute::data() const {
+    return visit([](const auto& values) -> const void* { return values.data(); });
+}
+
+/**
+ * @brief Read a value converted to double
+ * @param index Flat value index (tuple * components + component)
+ * @return Value
+ */
+double MeshAttribute::value(size_t index) const {
+    return visit([index](const auto& values) { return static_cast<double>(values[index]); });
+}
+
+/**
+ * @brief Store a value converted from double (integers are rounded to nearest)
+ * @param index Flat value index (tuple * components + component)
+ * @param value Value
+ */
+void MeshAttribute::setValue(size_t index, double value) {
+    visit([index, value](auto& values) {
+        using T = typename std::decay_t<decltype(values)>::value_type;
+        values[index] = attributeCast<T>(value);
+    });
+}
+
+/**
+ * @brief Copy all values as float (for consumers that only handle single precision)
+ * @return Float values
+ */
+std::vector<float> MeshAttribute::toFloat() const {
+    return visit([](const auto& values) {
+        using T = typename std::decay_t<decltype(values)>::value_type;
+        if constexpr (std::is_same_v<T, float>) {
+            return values;
+        } else {
+            return std::vector<float>(values.begin(), values.end());
+        }
+    });
+}
+
+/**
+ * @brief Resize to a tuple count (new values are zero)
+ * @param tuples Number of tuples
+ */
+void MeshAttribute::resize(size_t tuples) {
+    const size_t count = tuples * static_cast<size_t>(components_);
+    visit([count](auto& values) { values.resize(count); });
+}
+
+/**
+ * @brief Remove all values (type and component count are kept)
+ */
+void MeshAttribute::clear() {
+    visit([](auto& values) { values.clear(); });
+}
+
+// ==============================================================================
+// BasicMeshData
+// ==============================================================================
 
 /**
  * @brief Clear all data
  */
-void MeshData::clear() {
+template<typename Real, typename Index>
+void BasicMeshData<Real, Index>::clear() {
     points.clear();
     cells.clear();
     pointData.clear();
@@ -15,24 +240,31 @@ void MeshData::clear() {
  * @brief Check if mesh is empty
  * @return Whether empty
  */
-bool MeshData::isEmpty() const {
+template<typename Real, typename Index>
+bool BasicMeshData<Real, Index>::isEmpty() const {
     return points.empty() && cells.empty();
 }
 
 /**
  * @brief Calculate metadata from geometry/topology data
  */
-void MeshData::calculateMetadata() {
+template<typename Real, typename Index>
+void BasicMeshData<Real, Index>::calculateMetadata() {
     // Calculate point count
     metadata.pointCount = points.size() / 3;
     
     // Calculate cell count
     metadata.cellCount = cells.size();
+    metadata.pointCountKnown = true;
+    metadata.cellCountKnown = true;
     
-    // Calculate count of each cell type
+    // Calculate count of each cell type and classify the mesh in one parallel pass over the type array
+    const std::array<uint64_t, 256> typeCount = MeshKernels::countCellTypes(cells.types);
     metadata.cellTypeCount.clear();
-    for (const auto& cell : cells) {
-        metadata.cellTypeCount[cell.type]++;
+    for (size_t t = 0; t < typeCount.size(); ++t) {
+        if (typeCount[t] > 0) {
+            metadata.cellTypeCount[static_cast<VtkCellType>(t)] = typeCount[t];
+        }
     }
     
     // Extract point attribute names
@@ -52,19 +284,11 @@ void MeshData::calculateMetadata() {
         metadata.meshType = MeshType::UNKNOWN;
     } else {
         // Simple判断：如果包含体单元则为体网格，否则为面网格
-        bool hasVolumeCells = false;
-        for (const auto& cell : cells) {
-            switch (cell.type) {
-                case VtkCellType::TETRA:
-                case VtkCellType::HEXAHEDRON:
-                case VtkCellType::WEDGE:
-                case VtkCellType::PYRAMID:
-                    hasVolumeCells = true;
-                    break;
-                default:
-                    break;
-            }
-        }
-        metadata.meshType = hasVolumeCells ? MeshType::VOLUME_MESH : MeshType::SURFACE_MESH;
+        metadata.meshType = MeshKernels::hasVolumeCells(typeCount) ? MeshType::VOLUME_MESH : MeshType::SURFACE_MESH;
     }
 }
+
+template class BasicCellArray<uint32_t>;
+template class BasicCellArray<uint64_t>;
+template class BasicMeshData<float, uint32_t>;
+template class BasicMeshData<double, uint64_t>;
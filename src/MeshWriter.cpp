@@ -1,7 +1,1338 @@
 #include "MeshWriter.h"
-#include <fstream>
+#include "CellFaces.h"
+#include "CgnsSupport.h"
+#include "GmshElements.h"
+#include "JobControl.h"
+#include "MeshCache.h"
+#include "MeshHelper.h"
+#include "MeshKernels.h"
+#include "MeshProcessor.h"
+#include "OpenFoamSupport.h"
+#include "OutputBuffer.h"
+#include "ParallelFor.h"
+#include "Profiler.h"
+#include "SurfaceCells.h"
+#include "VTKBridge.h"
+#include <vtkDataCompressor.h>
+#include <vtkLZ4DataCompressor.h>
+#include <vtkLZMADataCompressor.h>
+#include <vtkSmartPointer.h>
+#include <vtkZLibDataCompressor.h>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
 #include <filesystem>
-#include <iomanip>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+namespace {
+
+// Points/elements per chunk when ASCII sections are formatted on several threads
+constexpr size_t FORMAT_CHUNK_ITEMS = 64 * 1024;
+
+/**
+ * @brief Pick the polygons a surface format writer emits
+ * Volume meshes are reduced to their boundary faces; surface meshes are written as they are.
+ * @param meshData Input mesh data
+ * @param[out] boundary Storage for the extracted boundary (volume meshes only)
+ * @param[out] surface Mesh whose polygons are written
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message
+ * @return Whether a valid surface was selected
+ */
+bool selectSurface(const MeshData& meshData,
+                   MeshData& boundary,
+                   const MeshData*& surface,
+                   MeshErrorCode& errorCode,
+                   std::string& errorMsg) {
+    surface = &meshData;
+    if (meshData.metadata.meshType == MeshType::VOLUME_MESH) {
+        if (!MeshProcessor::extractSurfaceFromVolume(meshData, boundary, true, errorCode, errorMsg)) {
+            return false;
+        }
+        surface = &boundary;
+    }
+
+    const uint64_t pointCount = surface->points.size() / 3;
+    const std::vector<uint32_t>& connectivity = surface->cells.connectivity;
+    for (size_t i = 0; i < connectivity.size(); ++i) {
+        if (connectivity[i] >= pointCount) {
+            errorCode = MeshErrorCode::PARAM_INVALID;
+            errorMsg = "Cell point index " + std::to_string(connectivity[i]) + " exceeds point count " + std::to_string(pointCount);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Count the polygonal faces of a surface
+ * @param cells Cells to visit
+ * @param[out] maxFaceSize Largest face point count
+ * @return Number of faces
+ */
+uint64_t countFaces(const MeshData::CellArray& cells, size_t& maxFaceSize) {
+    uint64_t faceCount = 0;
+    maxFaceSize = 0;
+    forEachFace(cells, [&](const uint32_t*, size_t count) {
+        ++faceCount;
+        maxFaceSize = (std::max)(maxFaceSize, count);
+    });
+    return faceCount;
+}
+
+/**
+ * @brief Append "x y z" with the requested number of significant digits
+ * @param out Output buffer
+ * @param point Point coordinates
+ * @param precision Significant digits
+ */
+void appendPoint(OutputBuffer& out, const float* point, int precision) {
+    out.appendFloat(point[0], precision);
+    out.append(' ');
+    out.appendFloat(point[1], precision);
+    out.append(' ');
+    out.appendFloat(point[2], precision);
+}
+
+/**
+ * @brief Append one "<prefix>x y z" line per point
+ * @param out Output buffer
+ * @param points Point coordinates (xyz)
+ * @param pointCount Number of points
+ * @param prefix Text written before each point ("v " for OBJ)
+ * @param options Write options (precision, formatThreads)
+ */
+void appendPointLines(OutputBuffer& out, const float* points, size_t pointCount,
+                      std::string_view prefix, const FormatWriteOptions& options) {
+    appendFormatted(out, pointCount, FORMAT_CHUNK_ITEMS, options.formatThreads,
+        [&](OutputBuffer& sink, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                sink.append(prefix);
+                appendPoint(sink, points + i * 3, options.precision);
+                sink.append('\n');
+            }
+        });
+}
+
+/**
+ * @brief Append one "<count> i0 i1 ..." line per face (PLY/OFF ASCII)
+ * @param out Output buffer
+ * @param cells Cells whose faces are written
+ * @param options Write options (formatThreads)
+ */
+void appendFaceLines(OutputBuffer& out, const MeshData::CellArray& cells, const FormatWriteOptions& options) {
+    appendFormatted(out, cells.size(), FORMAT_CHUNK_ITEMS, options.formatThreads,
+        [&](OutputBuffer& sink, size_t begin, size_t end) {
+            forEachFace(cells, begin, end, [&sink](const uint32_t* indices, size_t count) {
+                sink.appendInt(count);
+                for (size_t k = 0; k < count; ++k) {
+                    sink.append(' ');
+                    sink.appendInt(indices[k]);
+                }
+                sink.append('\n');
+            });
+        });
+}
+
+/**
+ * @brief Entities and element blocks of a Gmsh file
+ * Cells are grouped by (entity, element type). Without physical groups every dimension has a
+ * single entity; with them each distinct (dimension, source entity, physical group) is one.
+ */
+struct GmshLayout {
+    static constexpr uint32_t NO_BLOCK = std::numeric_limits<uint32_t>::max();
+
+    struct Entity {
+        int dimension;     // Topological dimension (0..3)
+        int tag;           // Entity tag (1-based per dimension)
+        int32_t physical;  // Physical group (0 = none)
+        size_t firstCell;  // First cell of the entity
+    };
+    struct Block {
+        size_t entity;     // Index into entities
+        int gmshType;      // Gmsh element type
+        uint64_t count;    // Cells in the block
+    };
+
+    std::vector<Entity> entities;
+    std::vector<Block> blocks;
+    std::vector<uint32_t> cellBlock;  // Block of every cell (NO_BLOCK = no Gmsh element type)
+    std::vector<uint64_t> order;      // Written cells grouped by block
+    std::vector<uint64_t> blockBegin; // First position of each block in order
+    uint64_t elementCount = 0;        // Cells that are written
+    int maxDimension = 0;             // Highest element dimension
+};
+
+/**
+ * @brief Group the cells of a mesh into Gmsh entities and element blocks
+ * @param cells Cells to write
+ * @param physical "gmsh:physical" cell data (nullptr = no physical groups)
+ * @param entity "gmsh:geometrical" cell data (nullptr = one entity per physical group)
+ * @return Layout (cells of one block keep their source order)
+ */
+template<typename Index>
+GmshLayout buildGmshLayout(const BasicCellArray<Index>& cells, const MeshAttribute* physical, const MeshAttribute* entity) {
+    GmshLayout layout;
+    layout.cellBlock.assign(cells.size(), GmshLayout::NO_BLOCK);
+    std::map<std::tuple<int, int64_t, int32_t>, size_t> entityIds;
+    std::map<std::pair<size_t, int>, uint32_t> blockIds;
+    int nextTag[4] = {1, 1, 1, 1};
+
+    // Consecutive cells usually share their group, so the last lookup is cached
+    std::tuple<int, int64_t, int32_t> lastEntityKey{-1, 0, 0};
+    std::pair<size_t, int> lastBlockKey{0, 0};
+    size_t lastEntity = 0;
+    uint32_t lastBlock = GmshLayout::NO_BLOCK;
+    for (size_t i = 0; i < cells.size(); ++i) {
+        const int gmshType = gmshElementType(cells.types[i]);
+        if (gmshType == 0) {
+            continue;
+        }
+        const int dimension = gmshElementInfo(gmshType).dimension;
+        const int32_t physicalTag = physical ? static_cast<int32_t>(physical->value(i)) : 0;
+        const int64_t sourceEntity = entity ? static_cast<int64_t>(entity->value(i)) : 0;
+        const std::tuple<int, int64_t, int32_t> entityKey{dimension, sourceEntity, physicalTag};
+        if (entityKey != lastEntityKey) {
+            auto inserted = entityIds.emplace(entityKey, layout.entities.size());
+            if (inserted.second) {
+                layout.entities.push_back({dimension, nextTag[dimension]++, physicalTag, i});
+            }
+            lastEntityKey = entityKey;
+            lastEntity = inserted.first->second;
+            lastBlock = GmshLayout::NO_BLOCK;
+        }
+        const std::pair<size_t, int> blockKey{lastEntity, gmshType};
+        if (lastBlock == GmshLayout::NO_BLOCK || blockKey != lastBlockKey) {
+            auto inserted = blockIds.emplace(blockKey, static_cast<uint32_t>(layout.blocks.size()));
+            if (inserted.second) {
+                layout.blocks.push_back({lastEntity, gmshType, 0});
+            }
+            lastBlockKey = blockKey;
+            lastBlock = inserted.first->second;
+        }
+        layout.cellBlock[i] = lastBlock;
+        ++layout.blocks[lastBlock].count;
+        ++layout.elementCount;
+        layout.maxDimension = (std::max)(layout.maxDimension, dimension);
+    }
+
+    // Stable counting sort of the written cells by block
+    layout.blockBegin.assign(layout.blocks.size() + 1, 0);
+    for (size_t b = 0; b < layout.blocks.size(); ++b) {
+        layout.blockBegin[b + 1] = layout.blockBegin[b] + layout.blocks[b].count;
+    }
+    layout.order.resize(layout.elementCount);
+    std::vector<uint64_t> next(layout.blockBegin.begin(), layout.blockBegin.end() - 1);
+    for (size_t i = 0; i < cells.size(); ++i) {
+        if (layout.cellBlock[i] != GmshLayout::NO_BLOCK) {
+            layout.order[next[layout.cellBlock[i]]++] = i;
+        }
+    }
+    return layout;
+}
+
+/**
+ * @brief Find a single-component cell data array with one value per cell
+ * @param cellData Cell data of the mesh
+ * @param name Array name
+ * @param cellCount Number of cells
+ * @return Array, or nullptr if missing or of another length
+ */
+const MeshAttribute* findCellScalars(const AttributeMap& cellData, const std::string& name, size_t cellCount) {
+    const auto it = cellData.find(name);
+    if (it == cellData.end() || it->second.componentsFor(cellCount) != 1) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+/**
+ * @brief Close the output file and report a write failure
+ * @param out Output buffer
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message
+ * @return Whether every byte reached the file
+ */
+bool closeOutput(OutputBuffer& out, MeshErrorCode& errorCode, std::string& errorMsg) {
+    if (!out.close(errorMsg)) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        return false;
+    }
+    errorCode = MeshErrorCode::SUCCESS;
+    errorMsg.clear();
+    return true;
+}
+
+// Values converted per block when a binary FoamFile list is written
+constexpr size_t FOAM_BINARY_BLOCK = 64 * 1024;
+
+// Cells per task of the face matching (smaller meshes are matched serially)
+constexpr size_t FOAM_CELLS_PER_TASK = 32 * 1024;
+
+/**
+ * @brief polyMesh lists derived from the volume cells of a mesh
+ */
+template<typename Index>
+struct FoamLayout {
+    std::vector<Index> faceOffsets{0};   // CSR offsets of the faces
+    std::vector<Index> faceLabels;       // Point labels of the faces (outward from the owner)
+    std::vector<Index> owner;            // Owner cell of every face
+    std::vector<Index> neighbour;        // Neighbour cell of every internal face
+    std::vector<std::string> patchNames; // Boundary patches in file order
+    std::vector<std::string> patchTypes; // Patch type of every patch
+    std::vector<uint64_t> patchSizes;    // Faces of every patch
+    size_t cellCount = 0;                // Volume cells
+};
+
+/**
+ * @brief Face of a cell keyed by its sorted corners
+ */
+template<typename Index>
+struct FoamFaceRecord {
+    std::array<Index, 4> key; // Ascending corners (padded with the largest index for triangles)
+    Index cell;               // OpenFOAM cell (rank among the volume cells) or patch tag of a boundary polygon
+    uint8_t face;             // Local face of the cell face table
+};
+
+/**
+ * @brief Sorted corner key of a face
+ * @param corners Face corners
+ * @param count Number of corners (3 or 4)
+ * @return Key
+ */
+template<typename Index>
+std::array<Index, 4> foamFaceKey(const Index* corners, size_t count) {
+    std::array<Index, 4> key;
+    key.fill(std::numeric_limits<Index>::max());
+    std::copy(corners, corners + count, key.begin());
+    std::sort(key.begin(), key.begin() + count);
+    return key;
+}
+
+/**
+ * @brief Patch types written unchanged (coupled types need entries this writer does not have)
+ * @param type Patch type of the source mesh
+ * @return Type written to polyMesh/boundary
+ */
+std::string foamPatchType(const std::string& type) {
+    static const char* const PLAIN_TYPES[] = {"patch", "wall", "empty", "symmetry", "symmetryPlane", "wedge"};
+    for (const char* plain : PLAIN_TYPES) {
+        if (type == plain) {
+            return type;
+        }
+    }
+    return "patch";
+}
+
+/**
+ * @brief Derive owner/neighbour faces from the volume cells of a mesh
+ * Cell faces (outward winding from the VTK face tables) are matched by sorting their corner
+ * keys: a key seen twice is an internal face owned by the lower cell, a key seen once is a
+ * boundary face. Internal faces are ordered by owner then neighbour (upper-triangular order).
+ * Boundary faces are grouped into patches from the triangles/quads that cover them: cell data
+ * "foam:patch" (or "gmsh:physical" through metadata.physicalRegionTags) names the patch, the
+ * remaining faces go to "defaultFaces".
+ * @param meshData Input mesh
+ * @param threads Worker threads
+ * @param[out] layout polyMesh lists
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message
+ * @return Whether the mesh has volume cells and every face is shared by at most two cells
+ */
+template<typename Real, typename Index>
+bool buildFoamLayout(const BasicMeshData<Real, Index>& meshData, unsigned int threads, FoamLayout<Index>& layout,
+                     MeshErrorCode& errorCode, std::string& errorMsg) {
+    const BasicCellArray<Index>& cells = meshData.cells;
+    const size_t pointCount = meshData.points.size() / 3;
+
+    // 1. Volume cells and their face records
+    std::vector<size_t> volumeCells;
+    std::vector<size_t> recordBase{0};
+    for (size_t c = 0; c < cells.size(); ++c) {
+        const CellFaceTable* table = cellFaceTable(cells.types[c]);
+        if (!table) {
+            continue;
+        }
+        const Index* corners = cells.cellPoints(c);
+        bool valid = cells.cellSize(c) >= table->pointCount;
+        for (uint8_t k = 0; valid && k < table->pointCount; ++k) {
+            valid = static_cast<size_t>(corners[k]) < pointCount;
+        }
+        if (!valid) {
+            errorCode = MeshErrorCode::PARAM_INVALID;
+            errorMsg = "Cell " + std::to_string(c) + " has too few points or an invalid point index";
+            return false;
+        }
+        volumeCells.push_back(c);
+        recordBase.push_back(recordBase.back() + table->faceCount);
+    }
+    if (volumeCells.empty()) {
+        errorCode = MeshErrorCode::PARAM_INVALID;
+        errorMsg = "OpenFOAM polyMesh requires volume cells (tetrahedra, hexahedra, wedges or pyramids)";
+        return false;
+    }
+    if (volumeCells.size() > static_cast<size_t>(std::numeric_limits<Index>::max())) {
+        errorCode = MeshErrorCode::PARAM_INVALID;
+        errorMsg = "Too many volume cells for the index type";
+        return false;
+    }
+    layout.cellCount = volumeCells.size();
+
+    const size_t taskCount = parallelTaskCount(volumeCells.size(), FOAM_CELLS_PER_TASK, threads);
+    std::vector<FoamFaceRecord<Index>> records(recordBase.back());
+    parallelForRanges(volumeCells.size(), taskCount, [&](size_t begin, size_t end, size_t) {
+        for (size_t v = begin; v < end; ++v) {
+            const CellFaceTable& table = *cellFaceTable(cells.types[volumeCells[v]]);
+            const Index* cellPoints = cells.cellPoints(volumeCells[v]);
+            for (uint8_t f = 0; f < table.faceCount; ++f) {
+                Index corners[4];
+                for (uint8_t k = 0; k < table.faceSize[f]; ++k) {
+                    corners[k] = cellPoints[table.corners[f][k]];
+                }
+                records[recordBase[v] + f] = {foamFaceKey(corners, table.faceSize[f]), static_cast<Index>(v), f};
+            }
+        }
+    });
+    auto keyLess = [](const FoamFaceRecord<Index>& a, const FoamFaceRecord<Index>& b) {
+        return a.key != b.key ? a.key < b.key : (a.cell != b.cell ? a.cell < b.cell : a.face < b.face);
+    };
+    parallelSort(records.begin(), records.end(), keyLess, taskCount);
+
+    // 2. Matched keys are internal faces, single keys boundary faces
+    struct OrderedFace {
+        Index owner;
+        Index neighbour; // Patch of a boundary face
+        size_t record;
+    };
+    std::vector<OrderedFace> internal;
+    std::vector<OrderedFace> boundary;
+    internal.reserve(records.size() / 2);
+    for (size_t i = 0; i < records.size();) {
+        size_t run = i + 1;
+        while (run < records.size() && records[run].key == records[i].key) {
+            ++run;
+        }
+        if (run - i > 2 || (run - i == 2 && records[i].cell == records[i + 1].cell)) {
+            errorCode = MeshErrorCode::PARAM_INVALID;
+            errorMsg = "Face shared by more than two cells (cell " + std::to_string(volumeCells[records[i].cell]) + ")";
+            return false;
+        }
+        if (run - i == 2) {
+            internal.push_back({records[i].cell, records[i + 1].cell, i});
+        } else {
+            boundary.push_back({records[i].cell, 0, i});
+        }
+        i = run;
+    }
+    parallelSort(internal.begin(), internal.end(), [](const OrderedFace& a, const OrderedFace& b) {
+        return a.owner != b.owner ? a.owner < b.owner : a.neighbour < b.neighbour;
+    }, taskCount);
+
+    // 3. Patch of every boundary face from the polygons covering it
+    const std::vector<std::string>& regions = meshData.metadata.physicalRegions;
+    const MeshAttribute* foamPatch = findCellScalars(meshData.cellData, "foam:patch", cells.size());
+    const MeshAttribute* gmshPhysical = foamPatch ? nullptr : findCellScalars(meshData.cellData, "gmsh:physical", cells.size());
+    const std::vector<int>& regionTags = meshData.metadata.physicalRegionTags;
+    if (gmshPhysical && regionTags.size() != regions.size()) {
+        gmshPhysical = nullptr;
+    }
+    std::vector<FoamFaceRecord<Index>> polygons;
+    if (foamPatch || gmshPhysical) {
+        for (size_t c = 0; c < cells.size(); ++c) {
+            const size_t size = cells.cellSize(c);
+            if ((cells.types[c] != VtkCellType::TRIANGLE && cells.types[c] != VtkCellType::QUAD) || (size != 3 && size != 4)) {
+                continue;
+            }
+            int64_t region = -1;
+            if (foamPatch) {
+                region = static_cast<int64_t>(foamPatch->value(c));
+            } else {
+                const auto it = std::find(regionTags.begin(), regionTags.end(), static_cast<int>(gmshPhysical->value(c)));
+                region = it == regionTags.end() ? -1 : static_cast<int64_t>(it - regionTags.begin());
+            }
+            if (region >= 0 && static_cast<size_t>(region) < regions.size()) {
+                polygons.push_back({foamFaceKey(cells.cellPoints(c), size), static_cast<Index>(region), 0});
+            }
+        }
+        std::sort(polygons.begin(), polygons.end(), keyLess);
+    }
+    const Index defaultPatch = static_cast<Index>(polygons.empty() ? 0 : regions.size());
+    bool usesDefault = false;
+    for (OrderedFace& face : boundary) {
+        const FoamFaceRecord<Index> probe{records[face.record].key, 0, 0};
+        const auto it = std::lower_bound(polygons.begin(), polygons.end(), probe, keyLess);
+        const bool covered = it != polygons.end() && it->key == probe.key;
+        face.neighbour = covered ? it->cell : defaultPatch;
+        usesDefault = usesDefault || !covered;
+    }
+    std::stable_sort(boundary.begin(), boundary.end(), [](const OrderedFace& a, const OrderedFace& b) {
+        return a.neighbour != b.neighbour ? a.neighbour < b.neighbour : a.owner < b.owner;
+    });
+
+    // Named patches are all written (possibly empty) so a read/write round trip keeps them
+    const size_t namedPatches = polygons.empty() ? 0 : regions.size();
+    for (size_t r = 0; r < namedPatches; ++r) {
+        layout.patchNames.push_back(regions[r]);
+        layout.patchTypes.push_back(foamPatchType(r < meshData.metadata.physicalRegionTypes.size()
+                                                  ? meshData.metadata.physicalRegionTypes[r] : std::string()));
+    }
+    if (usesDefault) {
+        layout.patchNames.push_back("defaultFaces");
+        layout.patchTypes.push_back("patch");
+    }
+    layout.patchSizes.assign(layout.patchNames.size(), 0);
+    for (const OrderedFace& face : boundary) {
+        ++layout.patchSizes[face.neighbour];
+    }
+
+    // 4. Face lists: corners in the owner's outward winding
+    const size_t faceCount = internal.size() + boundary.size();
+    layout.faceOffsets.resize(faceCount + 1);
+    layout.owner.resize(faceCount);
+    layout.neighbour.resize(internal.size());
+    auto faceOf = [&](size_t f) -> const OrderedFace& {
+        return f < internal.size() ? internal[f] : boundary[f - internal.size()];
+    };
+    auto faceSize = [&](const OrderedFace& face) {
+        const FoamFaceRecord<Index>& record = records[face.record];
+        return static_cast<size_t>(cellFaceTable(cells.types[volumeCells[record.cell]])->faceSize[record.face]);
+    };
+    layout.faceOffsets[0] = 0;
+    for (size_t f = 0; f < faceCount; ++f) {
+        layout.faceOffsets[f + 1] = static_cast<Index>(layout.faceOffsets[f] + faceSize(faceOf(f)));
+    }
+    layout.faceLabels.resize(static_cast<size_t>(layout.faceOffsets.back()));
+    parallelForRanges(faceCount, parallelTaskCount(faceCount, FOAM_CELLS_PER_TASK, threads), [&](size_t begin, size_t end, size_t) {
+        for (size_t f = begin; f < end; ++f) {
+            const OrderedFace& face = faceOf(f);
+            const FoamFaceRecord<Index>& record = records[face.record];
+            const size_t cell = volumeCells[record.cell];
+            const CellFaceTable& table = *cellFaceTable(cells.types[cell]);
+            const Index* cellPoints = cells.cellPoints(cell);
+            Index* labels = layout.faceLabels.data() + layout.faceOffsets[f];
+            for (uint8_t k = 0; k < table.faceSize[record.face]; ++k) {
+                labels[k] = cellPoints[table.corners[record.face][k]];
+            }
+            layout.owner[f] = face.owner;
+            if (f < internal.size()) {
+                layout.neighbour[f] = face.neighbour;
+            }
+        }
+    });
+    return true;
+}
+
+/**
+ * @brief Append the FoamFile header of a polyMesh file
+ * @param out Output buffer
+ * @param className class entry
+ * @param object object entry (file name)
+ * @param binary Whether lists are binary
+ * @param labelBits Label width (32/64)
+ * @param note note entry (empty = none)
+ */
+void appendFoamHeader(OutputBuffer& out, const char* className, const char* object, bool binary, int labelBits,
+                      const std::string& note) {
+    out.append("// OpenFOAM polyMesh generated by MeshFormatConverter\n");
+    out.append("FoamFile\n{\n    version     2.0;\n    format      ");
+    out.append(binary ? "binary" : "ascii");
+    out.append(";\n    arch        \"LSB;label=");
+    out.appendInt(labelBits);
+    out.append(";scalar=64\";\n    class       ");
+    out.append(className);
+    out.append(";\n");
+    if (!note.empty()) {
+        out.append("    note        \"");
+        out.append(note);
+        out.append("\";\n");
+    }
+    out.append("    location    \"constant/polyMesh\";\n    object      ");
+    out.append(object);
+    out.append(";\n}\n\n");
+}
+
+/**
+ * @brief Append a binary list payload converted to the stored type, "N\n(" ... ")\n"
+ * @param out Output buffer
+ * @param values Source values
+ * @param count Number of values
+ * @param listSize Size written before the list (values per entry may exceed one)
+ */
+template<typename Stored, typename Source>
+void appendFoamBinaryList(OutputBuffer& out, const Source* values, size_t count, size_t listSize) {
+    out.appendInt(listSize);
+    out.append("\n(");
+    if constexpr (std::is_same_v<Stored, Source>) {
+        out.append(values, count * sizeof(Stored));
+    } else {
+        std::vector<Stored> block;
+        for (size_t begin = 0; begin < count; begin += FOAM_BINARY_BLOCK) {
+            const size_t end = (std::min)(count, begin + FOAM_BINARY_BLOCK);
+            block.assign(values + begin, values + end);
+            out.append(block.data(), block.size() * sizeof(Stored));
+        }
+    }
+    out.append(")\n");
+}
+
+/**
+ * @brief Append a labelList (ASCII: one label per line, formatted in parallel chunks)
+ * @param out Output buffer
+ * @param labels Labels
+ * @param binary Whether the list is binary
+ * @param labelBits Label width (32/64)
+ * @param threads Formatting threads
+ */
+template<typename Index>
+void appendFoamLabels(OutputBuffer& out, const std::vector<Index>& labels, bool binary, int labelBits, unsigned int threads) {
+    if (binary) {
+        if (labelBits == 64) {
+            appendFoamBinaryList<int64_t>(out, labels.data(), labels.size(), labels.size());
+        } else {
+            appendFoamBinaryList<int32_t>(out, labels.data(), labels.size(), labels.size());
+        }
+        return;
+    }
+    out.appendInt(labels.size());
+    out.append("\n(\n");
+    appendFormatted(out, labels.size(), FORMAT_CHUNK_ITEMS, threads, [&](OutputBuffer& sink, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            sink.appendInt(labels[i]);
+            sink.append('\n');
+        }
+    });
+    out.append(")\n");
+}
+
+/**
+ * @brief Write one polyMesh file
+ * @param directory polyMesh directory
+ * @param file File index (0 points, 1 faces, 2 owner, 3 neighbour, 4 boundary)
+ * @param meshData Input mesh (points)
+ * @param layout polyMesh lists
+ * @param options Write options (isBinary, precision, formatThreads)
+ * @param[out] errorMsg Output error message
+ * @return Whether writing is successful
+ */
+template<typename Real, typename Index>
+bool writeFoamFile(const std::filesystem::path& directory, size_t file, const BasicMeshData<Real, Index>& meshData,
+                   const FoamLayout<Index>& layout, const FormatWriteOptions& options, std::string& errorMsg) {
+    static const char* const FILES[] = {"points", "faces", "owner", "neighbour", "boundary"};
+    const bool binary = options.isBinary && file != 4;
+    const size_t pointCount = meshData.points.size() / 3;
+    const size_t faceCount = layout.owner.size();
+    const uint64_t int32Limit = static_cast<uint64_t>(std::numeric_limits<int32_t>::max());
+    const int labelBits = (pointCount > int32Limit || layout.faceLabels.size() > int32Limit) ? 64 : 32;
+
+    OutputBuffer out;
+    if (!out.open((directory / FILES[file]).u8string(), errorMsg)) {
+        return false;
+    }
+    const std::string note = file == 2 || file == 3
+        ? "nPoints:" + std::to_string(pointCount) + " nCells:" + std::to_string(layout.cellCount) + " nFaces:"
+          + std::to_string(faceCount) + " nInternalFaces:" + std::to_string(layout.neighbour.size())
+        : std::string();
+    const char* className = file == 0 ? "vectorField" : file == 1 ? (binary ? "faceCompactList" : "faceList")
+                          : file == 4 ? "polyBoundaryMesh" : "labelList";
+    appendFoamHeader(out, className, FILES[file], binary, labelBits, note);
+
+    switch (file) {
+        case 0:
+            if (binary) {
+                appendFoamBinaryList<double>(out, meshData.points.data(), meshData.points.size(), pointCount);
+                break;
+            }
+            out.appendInt(pointCount);
+            out.append("\n(\n");
+            appendFormatted(out, pointCount, FORMAT_CHUNK_ITEMS, options.formatThreads,
+                [&](OutputBuffer& sink, size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i) {
+                        const Real* point = meshData.points.data() + i * 3;
+                        sink.append('(');
+                        sink.appendFloat(point[0], options.precision);
+                        sink.append(' ');
+                        sink.appendFloat(point[1], options.precision);
+                        sink.append(' ');
+                        sink.appendFloat(point[2], options.precision);
+                        sink.append(")\n");
+                    }
+                });
+            out.append(")\n");
+            break;
+        case 1:
+            if (binary) {
+                // faceCompactList: offsets, then the flat labels
+                appendFoamLabels(out, layout.faceOffsets, true, labelBits, 1);
+                out.append('\n');
+                appendFoamLabels(out, layout.faceLabels, true, labelBits, 1);
+                break;
+            }
+            out.appendInt(faceCount);
+            out.append("\n(\n");
+            appendFormatted(out, faceCount, FORMAT_CHUNK_ITEMS, options.formatThreads,
+                [&](OutputBuffer& sink, size_t begin, size_t end) {
+                    for (size_t f = begin; f < end; ++f) {
+                        sink.appendInt(layout.faceOffsets[f + 1] - layout.faceOffsets[f]);
+                        sink.append('(');
+                        for (Index k = layout.faceOffsets[f]; k < layout.faceOffsets[f + 1]; ++k) {
+                            if (k != layout.faceOffsets[f]) {
+                                sink.append(' ');
+                            }
+                            sink.appendInt(layout.faceLabels[k]);
+                        }
+                        sink.append(")\n");
+                    }
+                });
+            out.append(")\n");
+            break;
+        case 2:
+            appendFoamLabels(out, layout.owner, binary, labelBits, options.formatThreads);
+            break;
+        case 3:
+            appendFoamLabels(out, layout.neighbour, binary, labelBits, options.formatThreads);
+            break;
+        default: {
+            uint64_t startFace = layout.neighbour.size();
+            out.appendInt(layout.patchNames.size());
+            out.append("\n(\n");
+            for (size_t p = 0; p < layout.patchNames.size(); ++p) {
+                out.append("    ");
+                out.append(layout.patchNames[p]);
+                out.append("\n    {\n        type            ");
+                out.append(layout.patchTypes[p]);
+                out.append(";\n        nFaces          ");
+                out.appendInt(layout.patchSizes[p]);
+                out.append(";\n        startFace       ");
+                out.appendInt(startFace);
+                out.append(";\n    }\n");
+                startFace += layout.patchSizes[p];
+            }
+            out.append(")\n");
+            break;
+        }
+    }
+    return out.close(errorMsg);
+}
+
+#ifdef HAVE_CGNS
+// zlib level of compressed CGNS datasets (FormatWriteOptions::compress)
+constexpr int CGNS_COMPRESSION_LEVEL = 6;
+
+// Longest CGNS node name
+constexpr size_t CGNS_NAME_LENGTH = 32;
+
+/**
+ * @brief Topological dimension of a cell type
+ * @param type VTK cell type
+ * @return Dimension (0..3)
+ */
+int cellDimension(VtkCellType type) {
+    switch (type) {
+        case VtkCellType::VERTEX: return 0;
+        case VtkCellType::LINE: return 1;
+        case VtkCellType::TETRA:
+        case VtkCellType::HEXAHEDRON:
+        case VtkCellType::WEDGE:
+        case VtkCellType::PYRAMID: return 3;
+        default: return 2;
+    }
+}
+
+/**
+ * @brief Arrays of one zone in CGNS layout, prepared before the CGNS library lock is taken
+ */
+template<typename Real>
+struct CgnsZoneOutput {
+    /**
+     * @brief One element section (1-based node numbers)
+     */
+    struct Section {
+        const char* name = "";            // Section name
+        ElementType_t type = ElementTypeNull;
+        cgsize_t start = 0;               // First element number
+        cgsize_t end = 0;                 // Last element number
+        std::vector<cgsize_t> elements;   // Node numbers
+        std::vector<cgsize_t> offsets;    // Element offsets (NGON_n only)
+    };
+
+    /**
+     * @brief One scalar solution field
+     */
+    struct Field {
+        std::string name;                 // Field name (at most 32 characters)
+        bool cellCentered = false;        // GridLocation CellCenter (false = Vertex)
+        MeshAttribute values;             // One value per vertex or zone cell
+    };
+
+    std::string name;                     // Zone name
+    cgsize_t size[3] = {0, 0, 0};         // Vertices, cells of the base dimension, boundary vertices
+    std::vector<Real> coordinates[3];     // CoordinateX/Y/Z
+    std::vector<Section> sections;        // Element sections, zone cells first
+    std::vector<Field> fields;            // Vertex and cell-centered fields
+};
+
+/**
+ * @brief Split an attribute into CGNS scalar fields
+ * One component keeps the name, three become <name>X/Y/Z (SIDS vector naming) and other widths
+ * <name>_<k>. Names are cut to the 32-character CGNS limit.
+ * @param name Attribute name
+ * @param attribute Attribute (tuples already in output order)
+ * @param cellCentered Whether the attribute belongs to cells
+ * @param[in,out] fields Output fields
+ */
+template<typename Real>
+void appendCgnsFields(const std::string& name, const MeshAttribute& attribute, bool cellCentered,
+                      std::vector<typename CgnsZoneOutput<Real>::Field>& fields) {
+    static const char* const VECTOR_SUFFIX[3] = {"X", "Y", "Z"};
+    const int components = attribute.components();
+    const size_t tuples = attribute.tupleCount();
+    for (int k = 0; k < components; ++k) {
+        const std::string suffix = components == 1 ? std::string() : components == 3 ? VECTOR_SUFFIX[k] : "_" + std::to_string(k);
+        typename CgnsZoneOutput<Real>::Field field;
+        field.name = name.substr(0, CGNS_NAME_LENGTH - std::min(suffix.size(), CGNS_NAME_LENGTH)) + suffix;
+        field.cellCentered = cellCentered;
+        field.values = MeshAttribute(attribute.type(), 1, tuples);
+        attribute.visit([&](const auto& source) {
+            using T = typename std::decay_t<decltype(source)>::value_type;
+            std::vector<T>& target = field.values.template values<T>();
+            for (size_t t = 0; t < tuples; ++t) {
+                target[t] = source[t * components + k];
+            }
+        });
+        fields.push_back(std::move(field));
+    }
+}
+
+/**
+ * @brief Convert one zone into CGNS layout
+ * Cells are grouped into one section per type, cells of the base dimension first so that they
+ * are elements 1..size[1]; cell data is written for those cells. Triangle strips are skipped.
+ * @param meshData Zone mesh
+ * @param name Zone name
+ * @param baseDimension Cell dimension of the base
+ * @param physicalDimension Number of coordinates written (2 or 3)
+ * @param threads Worker threads
+ * @param[out] zone Zone arrays
+ */
+template<typename Real, typename Index>
+void prepareCgnsZone(const BasicMeshData<Real, Index>& meshData, const std::string& name, int baseDimension,
+                     int physicalDimension, unsigned int threads, CgnsZoneOutput<Real>& zone) {
+    struct Group {
+        VtkCellType cellType;
+        const char* name;
+    };
+    // Section order: highest dimension first
+    static const Group GROUPS[] = {
+        {VtkCellType::HEXAHEDRON, "Hexahedra"}, {VtkCellType::WEDGE, "Prisms"}, {VtkCellType::PYRAMID, "Pyramids"},
+        {VtkCellType::TETRA, "Tetrahedra"}, {VtkCellType::QUAD, "Quadrilaterals"}, {VtkCellType::TRIANGLE, "Triangles"},
+        {VtkCellType::POLYGON, "Polygons"}, {VtkCellType::LINE, "Bars"}, {VtkCellType::VERTEX, "Nodes"}};
+
+    const typename BasicMeshData<Real, Index>::CellArray& cells = meshData.cells;
+    const size_t vertexCount = meshData.points.size() / 3;
+    zone.name = name;
+    zone.size[0] = static_cast<cgsize_t>(vertexCount);
+
+    // Coordinates, one contiguous array per axis
+    for (int axis = 0; axis < physicalDimension; ++axis) {
+        zone.coordinates[axis].resize(vertexCount);
+    }
+    parallelForRanges(vertexCount, parallelTaskCount(vertexCount, FORMAT_CHUNK_ITEMS, threads),
+        [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; ++i) {
+                for (int axis = 0; axis < physicalDimension; ++axis) {
+                    zone.coordinates[axis][i] = meshData.points[i * 3 + axis];
+                }
+            }
+        });
+
+    // Cells grouped by type (stable within a group)
+    std::vector<std::vector<size_t>> groupCells(std::size(GROUPS));
+    for (size_t c = 0; c < cells.size(); ++c) {
+        for (size_t g = 0; g < std::size(GROUPS); ++g) {
+            if (GROUPS[g].cellType == cells.types[c]) {
+                groupCells[g].push_back(c);
+                break;
+            }
+        }
+    }
+    std::vector<size_t> zoneCells;
+    cgsize_t nextElement = 1;
+    for (size_t g = 0; g < std::size(GROUPS); ++g) {
+        const std::vector<size_t>& members = groupCells[g];
+        if (members.empty()) {
+            continue;
+        }
+        typename CgnsZoneOutput<Real>::Section section;
+        section.name = GROUPS[g].name;
+        section.type = cgnsElementType(GROUPS[g].cellType);
+        section.start = nextElement;
+        section.end = nextElement + static_cast<cgsize_t>(members.size()) - 1;
+        nextElement = section.end + 1;
+
+        // Element node lists (polygons additionally get their offsets)
+        std::vector<size_t> base(members.size() + 1, 0);
+        for (size_t e = 0; e < members.size(); ++e) {
+            base[e + 1] = base[e] + cells.cellSize(members[e]);
+        }
+        section.elements.resize(base.back());
+        if (section.type == NGON_n) {
+            section.offsets.assign(base.begin(), base.end());
+        }
+        parallelForRanges(members.size(), parallelTaskCount(members.size(), FORMAT_CHUNK_ITEMS, threads),
+            [&](size_t begin, size_t end, size_t) {
+                for (size_t e = begin; e < end; ++e) {
+                    const Index* points = cells.cellPoints(members[e]);
+                    for (size_t k = 0; k < base[e + 1] - base[e]; ++k) {
+                        section.elements[base[e] + k] = static_cast<cgsize_t>(points[k]) + 1;
+                    }
+                }
+            });
+        if (cellDimension(GROUPS[g].cellType) == baseDimension) {
+            zoneCells.insert(zoneCells.end(), members.begin(), members.end());
+        }
+        zone.sections.push_back(std::move(section));
+    }
+    zone.size[1] = static_cast<cgsize_t>(zoneCells.size());
+
+    // Vertex fields as they are, cell fields for the zone cells in section order
+    for (const auto& [attributeName, attribute] : meshData.pointData) {
+        if (attribute.tupleCount() == vertexCount && vertexCount > 0) {
+            appendCgnsFields<Real>(attributeName, attribute, false, zone.fields);
+        }
+    }
+    for (const auto& [attributeName, attribute] : meshData.cellData) {
+        if (attribute.tupleCount() != cells.size() || zoneCells.empty()) {
+            continue;
+        }
+        const int components = attribute.components();
+        MeshAttribute ordered(attribute.type(), components, zoneCells.size());
+        attribute.visit([&](const auto& source) {
+            using T = typename std::decay_t<decltype(source)>::value_type;
+            std::vector<T>& target = ordered.values<T>();
+            for (size_t c = 0; c < zoneCells.size(); ++c) {
+                std::copy_n(source.begin() + zoneCells[c] * components, components, target.begin() + c * components);
+            }
+        });
+        appendCgnsFields<Real>(attributeName, ordered, true, zone.fields);
+    }
+}
+
+/**
+ * @brief Write prepared zones into one HDF5 CGNS file (caller holds the CGNS library lock)
+ * With compress the library stores every dataset chunked and deflate-compressed.
+ * @param filePath Output file path (UTF-8 encoded)
+ * @param zones Prepared zones
+ * @param baseDimension Cell dimension of the base
+ * @param physicalDimension Physical dimension of the base
+ * @param options Write options (cgnsBaseName, compress)
+ */
+template<typename Real>
+void writeCgnsFile(const std::string& filePath, std::vector<CgnsZoneOutput<Real>>& zones, int baseDimension,
+                   int physicalDimension, const FormatWriteOptions& options) {
+    // File type and compression are library-wide settings: restore the defaults afterwards
+    struct SettingsGuard {
+        ~SettingsGuard() {
+            cg_configure(CG_CONFIG_HDF5_COMPRESS, reinterpret_cast<void*>(static_cast<intptr_t>(0)));
+            cg_set_file_type(CG_FILE_NONE);
+        }
+    } settingsGuard;
+    cgnsCheck(cg_set_file_type(CG_FILE_HDF5), "Failed to select the HDF5 CGNS file type");
+    if (options.compress) {
+        cgnsCheck(cg_configure(CG_CONFIG_HDF5_COMPRESS, reinterpret_cast<void*>(static_cast<intptr_t>(CGNS_COMPRESSION_LEVEL))),
+                  "Failed to enable CGNS compression");
+    }
+
+    static const char* const AXIS_NAMES[3] = {"CoordinateX", "CoordinateY", "CoordinateZ"};
+    const DataType_t realType = std::is_same_v<Real, double> ? RealDouble : RealSingle;
+    CgnsFile file(filePath, CG_MODE_WRITE);
+    int base = 0;
+    cgnsCheck(cg_base_write(file.id(), options.cgnsBaseName.substr(0, CGNS_NAME_LENGTH).c_str(), baseDimension,
+                            physicalDimension, &base), "Failed to create CGNS base");
+    for (CgnsZoneOutput<Real>& zone : zones) {
+        int zoneIndex = 0;
+        cgnsCheck(cg_zone_write(file.id(), base, zone.name.c_str(), zone.size, Unstructured, &zoneIndex),
+                  "Failed to create CGNS zone");
+        for (int axis = 0; axis < physicalDimension; ++axis) {
+            int coord = 0;
+            cgnsCheck(cg_coord_write(file.id(), base, zoneIndex, realType, AXIS_NAMES[axis], zone.coordinates[axis].data(), &coord),
+                      "Failed to write CGNS coordinates");
+            std::vector<Real>().swap(zone.coordinates[axis]);
+        }
+        for (typename CgnsZoneOutput<Real>::Section& section : zone.sections) {
+            int sectionIndex = 0;
+            if (section.type == NGON_n) {
+                cgnsCheck(cg_poly_section_write(file.id(), base, zoneIndex, section.name, section.type, section.start, section.end,
+                                                0, section.elements.data(), section.offsets.data(), &sectionIndex),
+                          "Failed to write CGNS section");
+            } else {
+                cgnsCheck(cg_section_write(file.id(), base, zoneIndex, section.name, section.type, section.start, section.end,
+                                           0, section.elements.data(), &sectionIndex),
+                          "Failed to write CGNS section");
+            }
+            section = typename CgnsZoneOutput<Real>::Section();
+        }
+        for (const bool cellCentered : {false, true}) {
+            int solution = 0;
+            for (const typename CgnsZoneOutput<Real>::Field& field : zone.fields) {
+                if (field.cellCentered != cellCentered) {
+                    continue;
+                }
+                if (solution == 0) {
+                    cgnsCheck(cg_sol_write(file.id(), base, zoneIndex, cellCentered ? "CellSolution" : "VertexSolution",
+                                           cellCentered ? CellCenter : Vertex, &solution),
+                              "Failed to create CGNS solution");
+                }
+                int fieldIndex = 0;
+                cgnsCheck(cg_field_write(file.id(), base, zoneIndex, solution, cgnsDataType(field.values.type()),
+                                         field.name.c_str(), field.values.data(), &fieldIndex),
+                          "Failed to write CGNS field");
+            }
+        }
+        zone.fields.clear();
+    }
+    file.close();
+}
+
+/**
+ * @brief Write zone meshes into one CGNS base
+ * Zones are converted to CGNS layout in parallel; the file itself is written under the CGNS
+ * library lock.
+ * @param zones Zone meshes
+ * @param filePath Output file path (UTF-8 encoded)
+ * @param options Write options (cgnsBaseName, cgnsZoneName, cgnsDimension, compress, formatThreads)
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message
+ * @return Whether writing is successful
+ */
+template<typename Real, typename Index>
+bool writeCgnsZones(const std::vector<const BasicMeshData<Real, Index>*>& zones, const std::string& filePath,
+                    const FormatWriteOptions& options, MeshErrorCode& errorCode, std::string& errorMsg) {
+    if (zones.empty() || std::any_of(zones.begin(), zones.end(), [](const BasicMeshData<Real, Index>* zone) {
+            return zone->isEmpty();
+        })) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Mesh data is empty";
+        return false;
+    }
+
+    try {
+        // Base cell dimension: highest cell dimension of any zone
+        int baseDimension = 1;
+        for (const BasicMeshData<Real, Index>* zone : zones) {
+            const std::array<uint64_t, 256> typeCount = MeshKernels::countCellTypes(zone->cells.types, options.formatThreads);
+            for (size_t t = 0; t < typeCount.size(); ++t) {
+                if (typeCount[t] > 0) {
+                    baseDimension = std::max(baseDimension, cellDimension(static_cast<VtkCellType>(t)));
+                }
+            }
+        }
+        const int physicalDimension = std::max(baseDimension, std::min(3, std::max(2, options.cgnsDimension)));
+
+        // Zone names: source block name, else cgnsZoneName (numbered when there are several zones)
+        std::vector<std::string> names(zones.size());
+        for (size_t z = 0; z < zones.size(); ++z) {
+            std::string name = zones[z]->metadata.blockName;
+            if (name.empty()) {
+                name = zones.size() == 1 ? options.cgnsZoneName : options.cgnsZoneName + "_" + std::to_string(z + 1);
+            }
+            name = name.substr(0, CGNS_NAME_LENGTH);
+            while (std::find(names.begin(), names.begin() + z, name) != names.begin() + z) {
+                const std::string suffix = "_" + std::to_string(z + 1);
+                name = name.substr(0, CGNS_NAME_LENGTH - suffix.size()) + suffix;
+            }
+            names[z] = name;
+        }
+
+        const size_t threadCount = options.formatThreads ? options.formatThreads : std::max(1u, std::thread::hardware_concurrency());
+        const size_t tasks = parallelTaskCount(zones.size(), 1, options.formatThreads);
+        const unsigned int zoneThreads = static_cast<unsigned int>(std::max<size_t>(1, threadCount / tasks));
+        std::vector<CgnsZoneOutput<Real>> outputs(zones.size());
+        parallelForRanges(zones.size(), tasks, [&](size_t begin, size_t end, size_t) {
+            for (size_t z = begin; z < end; ++z) {
+                prepareCgnsZone(*zones[z], names[z], baseDimension, physicalDimension, zoneThreads, outputs[z]);
+            }
+        });
+
+        std::lock_guard<std::recursive_mutex> lock(cgnsLibraryMutex());
+        writeCgnsFile(filePath, outputs, baseDimension, physicalDimension, options);
+        errorCode = MeshErrorCode::SUCCESS;
+        errorMsg = "";
+        return true;
+    } catch (const std::exception& e) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        errorMsg = std::string("Error writing CGNS file: ") + e.what();
+        return false;
+    }
+}
+#endif
+
+// Width of the zero-padded offset attributes, patched once the appended data of an array is written
+constexpr size_t VTK_OFFSET_DIGITS = 20;
+
+// Compression blocks per task and round (memory stays around two rounds of compressed blocks)
+constexpr size_t VTK_BLOCKS_PER_TASK = 2;
+
+/**
+ * @brief One DataArray of a VTK XML file and the source of its appended values
+ */
+struct VtkXmlArray {
+    std::string name;                 // Name attribute
+    const char* type = "UInt8";       // VTK scalar type name
+    int components = 1;               // NumberOfComponents
+    size_t elementSize = 1;           // Bytes per value
+    size_t count = 0;                 // Number of values
+    const void* data = nullptr;       // Contiguous values (nullptr = produced by fill)
+    std::function<void(size_t, size_t, void*)> fill; // Writes values [begin, end) to the destination
+    uint64_t progressUnits = 0;       // Points/cells credited once the array is written
+    uint64_t offsetPosition = 0;      // File position of the offset placeholder
+};
+
+/**
+ * @brief VTK scalar type name of a value type
+ */
+template<typename T>
+const char* vtkXmlTypeName() {
+    if constexpr (std::is_same_v<T, float>) {
+        return "Float32";
+    } else if constexpr (std::is_same_v<T, double>) {
+        return "Float64";
+    } else if constexpr (std::is_same_v<T, int32_t>) {
+        return "Int32";
+    } else if constexpr (std::is_same_v<T, int64_t>) {
+        return "Int64";
+    } else if constexpr (std::is_same_v<T, uint32_t>) {
+        return "UInt32";
+    } else if constexpr (std::is_same_v<T, uint64_t>) {
+        return "UInt64";
+    } else {
+        static_assert(sizeof(T) == 1, "Unsupported VTK XML value type");
+        return "UInt8";
+    }
+}
+
+/**
+ * @brief Array streamed straight from contiguous memory
+ * @param name Array name
+ * @param data First value
+ * @param count Number of values
+ * @param components Values per tuple
+ * @return Array description
+ */
+template<typename T>
+VtkXmlArray vtkXmlArray(std::string name, const T* data, size_t count, int components = 1) {
+    VtkXmlArray array;
+    array.name = std::move(name);
+    array.type = vtkXmlTypeName<T>();
+    array.components = components;
+    array.elementSize = sizeof(T);
+    array.count = count;
+    array.data = data;
+    return array;
+}
+
+/**
+ * @brief Array of a point or cell attribute
+ * @param name Attribute name
+ * @param attribute Attribute values
+ * @param order Source tuple of every written tuple (empty = source order, streamed directly)
+ * @return Array description
+ */
+template<typename Index>
+VtkXmlArray vtkXmlAttributeArray(const std::string& name, const MeshAttribute& attribute, const std::vector<Index>& order) {
+    return attribute.visit([&](const auto& values) {
+        using T = typename std::decay_t<decltype(values)>::value_type;
+        VtkXmlArray array = vtkXmlArray(name, values.data(), values.size(), attribute.components());
+        if (!order.empty()) {
+            const size_t components = static_cast<size_t>(attribute.components());
+            array.data = nullptr;
+            array.fill = [&values, &order, components](size_t begin, size_t end, void* destination) {
+                T* out = static_cast<T*>(destination);
+                for (size_t v = begin; v < end; ++v) {
+                    *out++ = values[static_cast<size_t>(order[v / components]) * components + v % components];
+                }
+            };
+        }
+        return array;
+    });
+}
+
+/**
+ * @brief Append text with the XML attribute special characters escaped
+ * @param out Output buffer
+ * @param text Text (UTF-8)
+ */
+void appendXmlEscaped(OutputBuffer& out, std::string_view text) {
+    for (const char ch : text) {
+        switch (ch) {
+            case '&': out.append("&amp;"); break;
+            case '<': out.append("&lt;"); break;
+            case '>': out.append("&gt;"); break;
+            case '"': out.append("&quot;"); break;
+            default: out.append(ch); break;
+        }
+    }
+}
+
+/**
+ * @brief Append the DataArray element of an array and remember where its offset goes
+ * @param out Output buffer
+ * @param array Array (offsetPosition is set)
+ */
+void appendVtkXmlArrayTag(OutputBuffer& out, VtkXmlArray& array) {
+    out.append("        <DataArray type=\"");
+    out.append(array.type);
+    out.append("\" Name=\"");
+    appendXmlEscaped(out, array.name);
+    if (array.components != 1) {
+        out.append("\" NumberOfComponents=\"");
+        out.appendInt(array.components);
+    }
+    out.append("\" format=\"appended\" offset=\"");
+    array.offsetPosition = out.bytesWritten();
+    out.append(std::string(VTK_OFFSET_DIGITS, '0'));
+    out.append("\"/>\n");
+}
+
+/**
+ * @brief VTK class name of a block codec (compressor attribute of the VTKFile element)
+ */
+const char* vtkCompressorClassName(VtkCompressor codec) {
+    switch (codec) {
+        case VtkCompressor::LZ4: return "vtkLZ4DataCompressor";
+        case VtkCompressor::LZMA: return "vtkLZMADataCompressor";
+        default: return "vtkZLibDataCompressor";
+    }
+}
+
+/**
+ * @brief Create a compressor for a block codec (one per task: compressors are not thread-safe)
+ */
+vtkSmartPointer<vtkDataCompressor> createVtkCompressor(VtkCompressor codec) {
+    switch (codec) {
+        case VtkCompressor::LZ4: return vtkSmartPointer<vtkLZ4DataCompressor>::New();
+        case VtkCompressor::LZMA: return vtkSmartPointer<vtkLZMADataCompressor>::New();
+        default: return vtkSmartPointer<vtkZLibDataCompressor>::New();
+    }
+}
+
+/**
+ * @brief Append the values of an array to the appended data section and patch its offset
+ *
+ * Uncompressed arrays are a UInt64 byte count followed by the raw values. Compressed arrays are
+ * the VTK block header (block count, block size, size of a partial last block, compressed size
+ * of every block) followed by the blocks. Blocks are compressed straight from the source array
+ * (fill-produced arrays through one scratch block per task) in rounds of a few blocks per task
+ * on parallel threads, and each round is appended in order; the header is patched at the end.
+ * @param out Output buffer
+ * @param dataStart File position of the first appended byte (after the '_' marker)
+ * @param array Array to write
+ * @param blockBytes Uncompressed bytes per block (multiple of 8)
+ * @param options Write options (compress, vtkCompressor, formatThreads)
+ * @return Whether every block was compressed and written
+ */
+bool appendVtkXmlArrayData(OutputBuffer& out, uint64_t dataStart, const VtkXmlArray& array,
+                           size_t blockBytes, const FormatWriteOptions& options) {
+    char digits[VTK_OFFSET_DIGITS];
+    for (uint64_t offset = out.bytesWritten() - dataStart, i = VTK_OFFSET_DIGITS; i-- > 0; offset /= 10) {
+        digits[i] = static_cast<char>('0' + offset % 10);
+    }
+    out.patch(array.offsetPosition, digits, sizeof(digits));
+
+    const size_t byteCount = array.count * array.elementSize;
+    const size_t valuesPerBlock = blockBytes / array.elementSize;
+    if (!options.compress) {
+        out.appendBinary(static_cast<uint64_t>(byteCount));
+        if (array.data) {
+            out.append(array.data, byteCount);
+            return !out.failed();
+        }
+        std::vector<char> block(blockBytes);
+        for (size_t begin = 0; begin < array.count; begin += valuesPerBlock) {
+            JobControl::checkpoint();
+            const size_t end = std::min(array.count, begin + valuesPerBlock);
+            array.fill(begin, end, block.data());
+            out.append(block.data(), (end - begin) * array.elementSize);
+        }
+        return !out.failed();
+    }
+
+    const size_t blockCount = (byteCount + blockBytes - 1) / blockBytes;
+    std::vector<uint64_t> header(3 + blockCount, 0);
+    header[0] = blockCount;
+    header[1] = blockBytes;
+    header[2] = byteCount % blockBytes;
+    const uint64_t headerPosition = out.bytesWritten();
+    out.append(header.data(), header.size() * sizeof(uint64_t));
+
+    const size_t taskCount = parallelTaskCount(blockCount, 1, options.formatThreads);
+    const size_t roundBlocks = taskCount * VTK_BLOCKS_PER_TASK;
+    std::vector<std::vector<unsigned char>> packed(std::min(roundBlocks, blockCount));
+    std::vector<std::vector<char>> scratch(array.data ? 0 : taskCount);
+    std::vector<char> blockFailed(packed.size(), 0);
+    for (size_t firstBlock = 0; firstBlock < blockCount; firstBlock += roundBlocks) {
+        const size_t roundCount = std::min(roundBlocks, blockCount - firstBlock);
+        parallelForRanges(roundCount, taskCount, [&](size_t begin, size_t end, size_t task) {
+            vtkSmartPointer<vtkDataCompressor> compressor = createVtkCompressor(options.vtkCompressor);
+            for (size_t b = begin; b < end; ++b) {
+                const size_t offset = (firstBlock + b) * blockBytes;
+                const size_t size = std::min(blockBytes, byteCount - offset);
+                const unsigned char* source = nullptr;
+                if (array.data) {
+                    source = static_cast<const unsigned char*>(array.data) + offset;
+                } else {
+                    std::vector<char>& block = scratch[task];
+                    block.resize(blockBytes);
+                    array.fill(offset / array.elementSize, (offset + size) / array.elementSize, block.data());
+                    source = reinterpret_cast<const unsigned char*>(block.data());
+                }
+                packed[b].resize(compressor->GetMaximumCompressionSpace(size));
+                const size_t packedBytes = compressor->Compress(source, size, packed[b].data(), packed[b].size());
+                blockFailed[b] = packedBytes == 0;
+                packed[b].resize(packedBytes);
+            }
+        });
+        for (size_t b = 0; b < roundCount; ++b) {
+            if (blockFailed[b]) {
+                return false;
+            }
+            header[3 + firstBlock + b] = packed[b].size();
+            out.append(packed[b].data(), packed[b].size());
+        }
+    }
+    return out.patch(headerPosition, header.data(), header.size() * sizeof(uint64_t));
+}
+
+/**
+ * @brief Poly data cell list of a cell type in vtkPolyData cell order
+ * @param type Cell type
+ * @return 0 = Verts, 1 = Lines, 2 = Polys, 3 = Strips, -1 = not a poly data cell
+ */
+int vtkPolyDataSection(VtkCellType type) {
+    switch (static_cast<int>(type)) {
+        case 1:  // VERTEX
+        case 2:  // POLY_VERTEX
+            return 0;
+        case 3:  // LINE
+        case 4:  // POLY_LINE
+            return 1;
+        case 5:  // TRIANGLE
+        case 7:  // POLYGON
+        case 9:  // QUAD
+            return 2;
+        case 6:  // TRIANGLE_STRIP
+            return 3;
+        default:
+            return -1;
+    }
+}
+
+} // namespace
 
 /**
  * @brief Ensure directory exists
@@ -67,40 +1398,155 @@ bool MeshWriter::write(const MeshData& meshData,
         return false;
     }
 
+    // Optional space-filling-curve reordering: write the reordered copy in its own order
+    if (options.reorder != MeshReorder::NONE) {
+        MeshProcessor::ReorderOptions reorderOptions;
+        reorderOptions.curve = options.reorder;
+        MeshData reorderedMesh;
+        if (!MeshProcessor::reorderMesh(meshData, reorderedMesh, reorderOptions, errorCode, errorMsg)) {
+            return false;
+        }
+        FormatWriteOptions sourceOrder = options;
+        sourceOrder.reorder = MeshReorder::NONE;
+        return write(reorderedMesh, filePath, targetFormat, sourceOrder, errorCode, errorMsg);
+    }
+
+    // The target format decides ASCII/binary for formats that have both flavours
+    FormatWriteOptions formatOptions = options;
+    if (targetFormat == MeshFormat::STL_BINARY || targetFormat == MeshFormat::PLY_BINARY) {
+        formatOptions.isBinary = true;
+    } else if (targetFormat == MeshFormat::STL_ASCII || targetFormat == MeshFormat::PLY_ASCII) {
+        formatOptions.isBinary = false;
+    }
+
+    ProfileScope scope("write", "write", filePath);
+    if (scope.active()) {
+        scope.setName(MeshHelper::getFormatName(targetFormat));
+        scope.setInputCells(meshData.cells.size());
+    }
+    // Inside a job the formatted point and cell sections are credited to this step
+    JobStep step(0.0, 1.0);
+    step.setUnits(meshData.points.size() / 3 + meshData.cells.size());
+
     // Call corresponding write method based on format
+    bool success = false;
     switch (targetFormat) {
         case MeshFormat::VTK_LEGACY:
-            return writeVTK(meshData, filePath, false, options, errorCode, errorMsg);
+            success = writeVTK(meshData, filePath, false, options, errorCode, errorMsg);
+            break;
         case MeshFormat::VTK_XML:
-            return writeVTK(meshData, filePath, true, options, errorCode, errorMsg);
+            success = writeVTK(meshData, filePath, true, options, errorCode, errorMsg);
+            break;
         case MeshFormat::CGNS:
-            return writeCGNS(meshData, filePath, options, errorCode, errorMsg);
+            success = writeCGNS(meshData, filePath, options, errorCode, errorMsg);
+            break;
         case MeshFormat::GMSH_V2:
         case MeshFormat::GMSH_V4:
-            return writeGmsh(meshData, filePath, options, errorCode, errorMsg);
+            success = writeGmsh(meshData, filePath, targetFormat == MeshFormat::GMSH_V4, options, errorCode, errorMsg);
+            break;
         case MeshFormat::STL_ASCII:
         case MeshFormat::STL_BINARY:
-            return writeSTL(meshData, filePath, options, errorCode, errorMsg);
+            success = writeSTL(meshData, filePath, formatOptions, errorCode, errorMsg);
+            break;
         case MeshFormat::OBJ:
-            return writeOBJ(meshData, filePath, options, errorCode, errorMsg);
+            success = writeOBJ(meshData, filePath, options, errorCode, errorMsg);
+            break;
         case MeshFormat::PLY_ASCII:
         case MeshFormat::PLY_BINARY:
-            return writePLY(meshData, filePath, options, errorCode, errorMsg);
+            success = writePLY(meshData, filePath, formatOptions, errorCode, errorMsg);
+            break;
         case MeshFormat::OFF:
-            return writeOFF(meshData, filePath, options, errorCode, errorMsg);
+            success = writeOFF(meshData, filePath, options, errorCode, errorMsg);
+            break;
         case MeshFormat::SU2:
-            return writeSU2(meshData, filePath, options, errorCode, errorMsg);
+            success = writeSU2(meshData, filePath, options, errorCode, errorMsg);
+            break;
         case MeshFormat::OPENFOAM:
-            return writeOpenFOAM(meshData, filePath, options, errorCode, errorMsg);
+            success = writeOpenFOAM(meshData, filePath, options, errorCode, errorMsg);
+            break;
+        case MeshFormat::MESH_CACHE:
+            success = writeMeshCache(meshData, filePath, options, errorCode, errorMsg);
+            break;
         default:
             errorCode = MeshErrorCode::FORMAT_UNSUPPORTED;
             errorMsg = "Format not supported";
             return false;
     }
+    if (success && scope.active()) {
+        scope.setCells(meshData.cells.size());
+        scope.setBytes(Profiler::pathBytes(filePath));
+    }
+    return success;
+}
+
+/**
+ * @brief Write double-precision / 64-bit index mesh data to specified format file
+ * @param meshData Input mesh data
+ * @param filePath Output file path (UTF-8 encoded)
+ * @param targetFormat Target format
+ * @param options Write options (format-specific configurations)
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @return Whether writing is successful
+ */
+bool MeshWriter::write(const MeshData64& meshData,
+                      const std::string& filePath,
+                      MeshFormat targetFormat,
+                      const FormatWriteOptions& options,
+                      MeshErrorCode& errorCode,
+                      std::string& errorMsg) {
+    if (meshData.isEmpty()) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Mesh data is empty";
+        return false;
+    }
+
+    // SU2, Gmsh, CGNS, OpenFOAM, VTK XML and the mesh cache keep the full precision; everything else is written from the compact layout
+    const bool fullPrecision = targetFormat == MeshFormat::SU2 || targetFormat == MeshFormat::GMSH_V2
+        || targetFormat == MeshFormat::GMSH_V4 || targetFormat == MeshFormat::CGNS
+        || targetFormat == MeshFormat::OPENFOAM || targetFormat == MeshFormat::VTK_XML
+        || targetFormat == MeshFormat::MESH_CACHE;
+    if (options.reorder == MeshReorder::NONE && fullPrecision) {
+        ProfileScope scope("write", "write", filePath);
+        if (scope.active()) {
+            scope.setName(MeshHelper::getFormatName(targetFormat));
+            scope.setInputCells(meshData.cells.size());
+        }
+        JobStep step(0.0, 1.0);
+        step.setUnits(meshData.points.size() / 3 + meshData.cells.size());
+        bool success = false;
+        if (targetFormat == MeshFormat::SU2) {
+            success = writeSU2(meshData, filePath, options, errorCode, errorMsg);
+        } else if (targetFormat == MeshFormat::GMSH_V2 || targetFormat == MeshFormat::GMSH_V4) {
+            success = writeGmsh(meshData, filePath, targetFormat == MeshFormat::GMSH_V4, options, errorCode, errorMsg);
+        } else if (targetFormat == MeshFormat::CGNS) {
+            success = writeCGNS(meshData, filePath, options, errorCode, errorMsg);
+        } else if (targetFormat == MeshFormat::OPENFOAM) {
+            success = writeOpenFOAM(meshData, filePath, options, errorCode, errorMsg);
+        } else if (targetFormat == MeshFormat::VTK_XML) {
+            success = writeVTKXML(meshData, filePath, options, errorCode, errorMsg);
+        } else {
+            success = writeMeshCache(meshData, filePath, options, errorCode, errorMsg);
+        }
+        if (success && scope.active()) {
+            scope.setCells(meshData.cells.size());
+            scope.setBytes(Profiler::pathBytes(filePath));
+        }
+        return success;
+    }
+
+    MeshData compactMesh;
+    if (!convertMeshData(meshData, compactMesh)) {
+        errorCode = MeshErrorCode::PARAM_INVALID;
+        errorMsg = "Mesh indices exceed the 32-bit range of the target writer";
+        return false;
+    }
+    return write(compactMesh, filePath, targetFormat, options, errorCode, errorMsg);
 }
 
 /**
  * @brief Write VTK format file (automatically distinguish Legacy/XML)
+ * XML is written natively (writeVTKXML); Legacy output goes through VTKConverter.
  * @param meshData Input mesh data
  * @param filePath Output file path (UTF-8 encoded)
  * @param isXml Whether to write XML format (false=Legacy, true=XML)
@@ -115,15 +1561,269 @@ bool MeshWriter::writeVTK(const MeshData& meshData,
                          const FormatWriteOptions& options,
                          MeshErrorCode& errorCode,
                          std::string& errorMsg) {
-    // Use VTK library to implement specific write logic
-    // Temporarily return unimplemented
+    if (isXml) {
+        return writeVTKXML(meshData, filePath, options, errorCode, errorMsg);
+    }
+    // Legacy files are written by VTKConverter through the VTK library
     errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
     errorMsg = "VTK format write not implemented";
     return false;
 }
 
 /**
- * @brief Write CGNS format file
+ * @brief Write VTK XML file (.vtu unstructured grid, .vtp poly data) with raw appended data
+ *
+ * The XML header is written first with zero-padded placeholder offsets; every array then streams
+ * into the appended section (raw, not base64) and its offset is patched in place. Points, cell
+ * arrays and attributes are written straight from the mesh vectors. Poly data needs its cells
+ * grouped as verts, lines, polys, strips: meshes already in that order stream directly, other
+ * meshes are written through a cell order index (connectivity is gathered block by block, never
+ * copied as a whole).
+ * @param meshData Input mesh data
+ * @param filePath Output file path (UTF-8 encoded)
+ * @param options Write options (compress, vtkCompressor, vtkBlockSize, formatThreads, vtkPreserveAllAttributes)
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message
+ * @return Whether writing is successful
+ */
+template<typename Real, typename Index>
+bool MeshWriter::writeVTKXML(const BasicMeshData<Real, Index>& meshData,
+                            const std::string& filePath,
+                            const FormatWriteOptions& options,
+                            MeshErrorCode& errorCode,
+                            std::string& errorMsg) {
+    static const char* const SECTION_NAMES[4] = {"Verts", "Lines", "Polys", "Strips"};
+
+    std::string ext = std::filesystem::u8path(filePath).extension().u8string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+    if (ext == ".vti" || ext == ".vts") {
+        errorCode = MeshErrorCode::FORMAT_UNSUPPORTED;
+        errorMsg = "Image and structured grid files cannot hold an unstructured mesh (use .vtu or .vtp)";
+        return false;
+    }
+    const bool polyData = ext == ".vtp";
+
+    const auto& cells = meshData.cells;
+    const size_t pointCount = meshData.points.size() / 3;
+    const size_t cellCount = cells.size();
+    if (cells.offsets.size() != cellCount + 1 || cells.offsets.back() != cells.connectivity.size()) {
+        errorCode = MeshErrorCode::PARAM_INVALID;
+        errorMsg = "Cell offsets do not match the connectivity";
+        return false;
+    }
+    if (!ensureDirectoryExists(filePath)) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        errorMsg = "Cannot create output directory";
+        return false;
+    }
+
+    try {
+        // 1. Poly data: cell list of every cell, and a grouping order when the lists interleave
+        std::array<size_t, 5> sectionBegin{};     // First written cell of each list (in written order)
+        std::vector<Index> cellOrder;             // Source cell of every written cell (empty = source order)
+        std::array<std::vector<Index>, 4> sectionOffsets; // End offsets of each list (order index only)
+        if (polyData) {
+            std::vector<uint8_t> sections(cellCount);
+            bool grouped = true;
+            for (size_t i = 0; i < cellCount; ++i) {
+                const int section = vtkPolyDataSection(cells.types[i]);
+                if (section < 0) {
+                    errorCode = MeshErrorCode::PARAM_INVALID;
+                    errorMsg = "VTK poly data holds vertices, lines, polygons and strips only (write volume meshes as .vtu)";
+                    return false;
+                }
+                sections[i] = static_cast<uint8_t>(section);
+                grouped = grouped && (i == 0 || sections[i - 1] <= section);
+                ++sectionBegin[section + 1];
+            }
+            for (size_t s = 1; s < sectionBegin.size(); ++s) {
+                sectionBegin[s] += sectionBegin[s - 1];
+            }
+            if (!grouped) {
+                cellOrder.resize(cellCount);
+                std::array<size_t, 4> next = {sectionBegin[0], sectionBegin[1], sectionBegin[2], sectionBegin[3]};
+                for (size_t i = 0; i < cellCount; ++i) {
+                    cellOrder[next[sections[i]]++] = static_cast<Index>(i);
+                }
+                for (size_t s = 0; s < 4; ++s) {
+                    Index end = 0;
+                    for (size_t c = sectionBegin[s]; c < sectionBegin[s + 1]; ++c) {
+                        end += static_cast<Index>(cells.cellSize(static_cast<size_t>(cellOrder[c])));
+                        sectionOffsets[s].push_back(end);
+                    }
+                }
+            }
+        }
+
+        // 2. Arrays in file order: point data, cell data, points, cell lists
+        std::vector<VtkXmlArray> arrays;
+        auto addAttributes = [&](const AttributeMap& attributes, size_t tupleCount, const std::vector<Index>& order) {
+            std::vector<const std::pair<const std::string, MeshAttribute>*> sorted;
+            for (const auto& entry : attributes) {
+                const MeshAttribute& attribute = entry.second;
+                if (attribute.tupleCount() == tupleCount && attribute.size() == tupleCount * static_cast<size_t>(attribute.components())) {
+                    sorted.push_back(&entry);
+                }
+            }
+            std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+            for (const auto* entry : sorted) {
+                arrays.push_back(vtkXmlAttributeArray(entry->first, entry->second, order));
+            }
+            return sorted.size();
+        };
+        const std::vector<Index> sourceOrder;
+        const size_t pointDataCount = options.vtkPreserveAllAttributes ? addAttributes(meshData.pointData, pointCount, sourceOrder) : 0;
+        const size_t cellDataCount = options.vtkPreserveAllAttributes ? addAttributes(meshData.cellData, cellCount, cellOrder) : 0;
+        arrays.push_back(vtkXmlArray("Points", meshData.points.data(), pointCount * 3, 3));
+        arrays.back().progressUnits = pointCount;
+
+        std::array<size_t, 4> sectionArray{};     // First array of each poly data cell list
+        if (!polyData) {
+            arrays.push_back(vtkXmlArray("connectivity", cells.connectivity.data(), cells.connectivity.size()));
+            arrays.push_back(vtkXmlArray("offsets", cells.offsets.data() + 1, cellCount));
+            arrays.push_back(vtkXmlArray("types", reinterpret_cast<const uint8_t*>(cells.types.data()), cellCount));
+            arrays.back().progressUnits = cellCount;
+        }
+        for (size_t s = 0; polyData && s < 4; ++s) {
+            const size_t first = sectionBegin[s];
+            const size_t last = sectionBegin[s + 1];
+            sectionArray[s] = arrays.size();
+            if (first == last) {
+                continue;
+            }
+            if (cellOrder.empty()) {
+                // Grouped cells: the list is a contiguous range of the connectivity
+                const Index base = cells.offsets[first];
+                arrays.push_back(vtkXmlArray("connectivity", cells.connectivity.data() + base,
+                                             static_cast<size_t>(cells.offsets[last] - base)));
+                arrays.push_back(vtkXmlArray("offsets", cells.offsets.data() + first + 1, last - first));
+                if (base != 0) {
+                    arrays.back().data = nullptr;
+                    arrays.back().fill = [ends = cells.offsets.data() + first + 1, base](size_t begin, size_t end, void* destination) {
+                        Index* out = static_cast<Index*>(destination);
+                        for (size_t i = begin; i < end; ++i) {
+                            *out++ = ends[i] - base;
+                        }
+                    };
+                }
+            } else {
+                // Interleaved cells: gather the point lists of the list's cells block by block
+                const std::vector<Index>& ends = sectionOffsets[s];
+                const Index* listCells = cellOrder.data() + first;
+                arrays.push_back(vtkXmlArray("connectivity", cells.connectivity.data(), static_cast<size_t>(ends.back())));
+                arrays.back().data = nullptr;
+                arrays.back().fill = [&cells, &ends, listCells](size_t begin, size_t end, void* destination) {
+                    Index* out = static_cast<Index*>(destination);
+                    size_t c = static_cast<size_t>(std::upper_bound(ends.begin(), ends.end(), static_cast<Index>(begin)) - ends.begin());
+                    for (size_t position = begin; position < end; ++c) {
+                        const size_t cellStart = c ? static_cast<size_t>(ends[c - 1]) : 0;
+                        const size_t take = std::min(end, static_cast<size_t>(ends[c])) - position;
+                        const Index* source = cells.connectivity.data() + cells.offsets[listCells[c]] + (position - cellStart);
+                        out = std::copy_n(source, take, out);
+                        position += take;
+                    }
+                };
+                arrays.push_back(vtkXmlArray("offsets", ends.data(), ends.size()));
+            }
+            arrays.back().progressUnits = last - first;
+        }
+
+        // 3. XML header with placeholder offsets
+        OutputBuffer out;
+        if (!out.open(filePath, errorMsg)) {
+            errorCode = MeshErrorCode::WRITE_FAILED;
+            return false;
+        }
+        const uint16_t byteOrderProbe = 1;
+        const bool littleEndian = *reinterpret_cast<const uint8_t*>(&byteOrderProbe) == 1;
+        const char* dataSetType = polyData ? "PolyData" : "UnstructuredGrid";
+        out.append("<?xml version=\"1.0\"?>\n<VTKFile type=\"");
+        out.append(dataSetType);
+        out.append("\" version=\"1.0\" byte_order=\"");
+        out.append(littleEndian ? "LittleEndian" : "BigEndian");
+        out.append("\" header_type=\"UInt64\"");
+        if (options.compress) {
+            out.append(" compressor=\"");
+            out.append(vtkCompressorClassName(options.vtkCompressor));
+            out.append('"');
+        }
+        out.append(">\n  <");
+        out.append(dataSetType);
+        out.append(">\n    <Piece NumberOfPoints=\"");
+        out.appendInt(static_cast<uint64_t>(pointCount));
+        if (polyData) {
+            for (size_t s = 0; s < 4; ++s) {
+                out.append("\" NumberOf");
+                out.append(SECTION_NAMES[s]);
+                out.append("=\"");
+                out.appendInt(static_cast<uint64_t>(sectionBegin[s + 1] - sectionBegin[s]));
+            }
+        } else {
+            out.append("\" NumberOfCells=\"");
+            out.appendInt(static_cast<uint64_t>(cellCount));
+        }
+        out.append("\">\n");
+        auto appendSection = [&](const char* element, size_t first, size_t last) {
+            out.append("      <");
+            out.append(element);
+            out.append(">\n");
+            for (size_t a = first; a < last; ++a) {
+                appendVtkXmlArrayTag(out, arrays[a]);
+            }
+            out.append("      </");
+            out.append(element);
+            out.append(">\n");
+        };
+        appendSection("PointData", 0, pointDataCount);
+        appendSection("CellData", pointDataCount, pointDataCount + cellDataCount);
+        appendSection("Points", pointDataCount + cellDataCount, pointDataCount + cellDataCount + 1);
+        if (polyData) {
+            for (size_t s = 0; s < 4; ++s) {
+                if (sectionBegin[s + 1] > sectionBegin[s]) {
+                    appendSection(SECTION_NAMES[s], sectionArray[s], sectionArray[s] + 2);
+                }
+            }
+        } else {
+            appendSection("Cells", arrays.size() - 3, arrays.size());
+        }
+        out.append("    </Piece>\n  </");
+        out.append(dataSetType);
+        out.append(">\n  <AppendedData encoding=\"raw\">\n   _");
+
+        // 4. Appended data: each array in tag order, offsets patched as the arrays are written
+        const size_t blockBytes = (std::max<size_t>(options.vtkBlockSize, 8) + 7) / 8 * 8;
+        const uint64_t dataStart = out.bytesWritten();
+        ProgressMeter meter(1);
+        for (const VtkXmlArray& array : arrays) {
+            if (!appendVtkXmlArrayData(out, dataStart, array, blockBytes, options)) {
+                errorCode = MeshErrorCode::WRITE_FAILED;
+                errorMsg = "Failed to write VTK XML array: " + array.name;
+                return false;
+            }
+            if (array.progressUnits > 0) {
+                meter.add(array.progressUnits);
+            }
+        }
+        out.append("\n  </AppendedData>\n</VTKFile>\n");
+        if (!out.close(errorMsg)) {
+            errorCode = MeshErrorCode::WRITE_FAILED;
+            return false;
+        }
+        errorCode = MeshErrorCode::SUCCESS;
+        errorMsg.clear();
+        return true;
+    } catch (const std::exception& e) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        errorMsg = std::string("Error writing VTK XML file: ") + e.what();
+        return false;
+    }
+}
+
+template bool MeshWriter::writeVTKXML(const MeshData&, const std::string&, const FormatWriteOptions&, MeshErrorCode&, std::string&);
+template bool MeshWriter::writeVTKXML(const MeshData64&, const std::string&, const FormatWriteOptions&, MeshErrorCode&, std::string&);
+
+/**
+ * @brief Write CGNS format file (one unstructured zone in an HDF5 file)
  * @param meshData Input mesh data
  * @param filePath Output file path (UTF-8 encoded)
  * @param options Write options (need to specify cgnsBaseName/cgnsZoneName, etc.)
@@ -131,53 +1831,454 @@ bool MeshWriter::writeVTK(const MeshData& meshData,
  * @param[out] errorMsg Output error message
  * @return Whether writing is successful
  */
-bool MeshWriter::writeCGNS(const MeshData& meshData,
-                          const std::string& filePath,
-                          const FormatWriteOptions& options,
-                          MeshErrorCode& errorCode,
-                          std::string& errorMsg) {
-    // Check if there is CGNS dependency
-#ifndef HAVE_CGNS
+template<typename Real, typename Index>
+bool MeshWriter::writeCGNS(const BasicMeshData<Real, Index>& meshData,
+                          const std::string& filePath,
+                          const FormatWriteOptions& options,
+                          MeshErrorCode& errorCode,
+                          std::string& errorMsg) {
+#ifdef HAVE_CGNS
+    if (!ensureDirectoryExists(filePath)) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        errorMsg = "Cannot create output directory";
+        return false;
+    }
+    return writeCgnsZones<Real, Index>({&meshData}, filePath, options, errorCode, errorMsg);
+#else
+    (void)meshData;
+    (void)filePath;
+    (void)options;
+    errorCode = MeshErrorCode::DEPENDENCY_MISSING;
+    errorMsg = "CGNS dependency library missing";
+    return false;
+#endif
+}
+
+template bool MeshWriter::writeCGNS(const MeshData&, const std::string&, const FormatWriteOptions&, MeshErrorCode&, std::string&);
+template bool MeshWriter::writeCGNS(const MeshData64&, const std::string&, const FormatWriteOptions&, MeshErrorCode&, std::string&);
+
+/**
+ * @brief Write several meshes as the zones of one CGNS base (HDF5 file)
+ * @param zones Zone meshes (metadata.blockName names the zone; cgnsZoneName_<n> if empty)
+ * @param filePath Output file path (UTF-8 encoded)
+ * @param options Write options (cgnsBaseName, cgnsZoneName, cgnsDimension, compress, formatThreads)
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message
+ * @return Whether writing is successful
+ */
+template<typename Real, typename Index>
+bool MeshWriter::writeCGNSZones(const std::vector<BasicMeshData<Real, Index>>& zones,
+                               const std::string& filePath,
+                               const FormatWriteOptions& options,
+                               MeshErrorCode& errorCode,
+                               std::string& errorMsg) {
+#ifdef HAVE_CGNS
+    if (!ensureDirectoryExists(filePath)) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        errorMsg = "Cannot create output directory";
+        return false;
+    }
+    std::vector<const BasicMeshData<Real, Index>*> zonePointers;
+    for (const BasicMeshData<Real, Index>& zone : zones) {
+        zonePointers.push_back(&zone);
+    }
+    return writeCgnsZones(zonePointers, filePath, options, errorCode, errorMsg);
+#else
+    (void)zones;
+    (void)filePath;
+    (void)options;
     errorCode = MeshErrorCode::DEPENDENCY_MISSING;
     errorMsg = "CGNS dependency library missing";
     return false;
 #endif
-
-    // Use CGNS library to implement specific write logic
-    // Temporarily return unimplemented
-    errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
-    errorMsg = "CGNS format write not implemented";
-    return false;
 }
 
+template bool MeshWriter::writeCGNSZones(const std::vector<MeshData>&, const std::string&, const FormatWriteOptions&, MeshErrorCode&, std::string&);
+template bool MeshWriter::writeCGNSZones(const std::vector<MeshData64>&, const std::string&, const FormatWriteOptions&, MeshErrorCode&, std::string&);
+
 /**
- * @brief Write Gmsh format file
+ * @brief Write Gmsh format file (MSH 2.2 or 4.1, ASCII or binary by options.isBinary)
  * @param meshData Input mesh data
  * @param filePath Output file path (UTF-8 encoded)
- * @param options Write options
+ * @param isVersion4 Whether to write MSH 4.1 (false = MSH 2.2)
+ * @param options Write options (isBinary, precision, gmshPreservePhysicalGroups, formatThreads)
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message
  * @return Whether writing is successful
  */
-bool MeshWriter::writeGmsh(const MeshData& meshData,
+template<typename Real, typename Index>
+bool MeshWriter::writeGmsh(const BasicMeshData<Real, Index>& meshData,
                           const std::string& filePath,
+                          bool isVersion4,
                           const FormatWriteOptions& options,
                           MeshErrorCode& errorCode,
                           std::string& errorMsg) {
-    // Check if there is Gmsh dependency
-#ifndef HAVE_GMSH
-    errorCode = MeshErrorCode::DEPENDENCY_MISSING;
-    errorMsg = "Gmsh dependency library missing";
-    return false;
-#endif
+    if (meshData.isEmpty()) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Mesh data is empty";
+        return false;
+    }
 
-    // Use Gmsh library to implement specific write logic
-    // Temporarily return unimplemented
-    errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
-    errorMsg = "Gmsh format write not implemented";
-    return false;
+    if (!ensureDirectoryExists(filePath)) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        errorMsg = "Cannot create output directory";
+        return false;
+    }
+
+    // Physical groups come back from the cell data a Gmsh read produced
+    const typename BasicMeshData<Real, Index>::CellArray& cells = meshData.cells;
+    const MeshAttribute* physical = nullptr;
+    const MeshAttribute* geometrical = nullptr;
+    if (options.gmshPreservePhysicalGroups) {
+        physical = findCellScalars(meshData.cellData, "gmsh:physical", cells.size());
+        geometrical = physical ? findCellScalars(meshData.cellData, "gmsh:geometrical", cells.size()) : nullptr;
+    }
+    const GmshLayout layout = buildGmshLayout(cells, physical, geometrical);
+    const uint64_t numPoints = meshData.points.size() / 3;
+    if (numPoints == 0 || layout.elementCount == 0) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Mesh has no points or cells with a Gmsh element type";
+        return false;
+    }
+    if (!isVersion4 && (numPoints >= static_cast<uint64_t>(std::numeric_limits<int32_t>::max())
+                        || cells.size() >= static_cast<size_t>(std::numeric_limits<int32_t>::max()))) {
+        errorCode = MeshErrorCode::PARAM_INVALID;
+        errorMsg = "Mesh is too large for MSH 2.2 (32-bit tags); write MSH 4.1 instead";
+        return false;
+    }
+
+    const bool binary = options.isBinary;
+    const Real* points = meshData.points.data();
+    // Node tags are point index + 1, element tags cell index + 1
+    auto appendNodes = [&](OutputBuffer& sink, const Index* indices, size_t count) {
+        for (size_t k = 0; k < count; ++k) {
+            sink.append(' ');
+            sink.appendInt(static_cast<uint64_t>(indices[k]) + 1);
+        }
+    };
+    auto appendCoordinates = [&](OutputBuffer& sink, size_t i) {
+        const Real* point = points + i * 3;
+        sink.appendFloat(point[0], options.precision);
+        sink.append(' ');
+        sink.appendFloat(point[1], options.precision);
+        sink.append(' ');
+        sink.appendFloat(point[2], options.precision);
+    };
+    auto appendBinaryCoordinates = [&](OutputBuffer& sink, size_t i) {
+        const Real* point = points + i * 3;
+        const double xyz[3] = {static_cast<double>(point[0]), static_cast<double>(point[1]), static_cast<double>(point[2])};
+        sink.append(xyz, sizeof(xyz));
+    };
+
+    try {
+        OutputBuffer out;
+        if (!out.open(filePath, errorMsg)) {
+            errorCode = MeshErrorCode::WRITE_FAILED;
+            return false;
+        }
+
+        out.append("$MeshFormat\n");
+        out.append(isVersion4 ? "4.1 " : "2.2 ");
+        out.append(binary ? "1 8\n" : "0 8\n");
+        if (binary) {
+            out.appendBinary<int32_t>(1);
+            out.append('\n');
+        }
+        out.append("$EndMeshFormat\n");
+
+        // Physical names with the dimension of the entities that carry them
+        const std::vector<std::string>& regionNames = meshData.metadata.physicalRegions;
+        const std::vector<int>& regionTags = meshData.metadata.physicalRegionTags;
+        if (physical && !regionNames.empty() && regionNames.size() == regionTags.size()) {
+            out.append("$PhysicalNames\n");
+            out.appendInt(regionNames.size());
+            out.append('\n');
+            for (size_t r = 0; r < regionNames.size(); ++r) {
+                int dimension = -1;
+                for (const GmshLayout::Entity& entity : layout.entities) {
+                    if (entity.physical == regionTags[r]) {
+                        dimension = (std::max)(dimension, entity.dimension);
+                    }
+                }
+                out.appendInt(dimension < 0 ? layout.maxDimension : dimension);
+                out.append(' ');
+                out.appendInt(regionTags[r]);
+                out.append(" \"");
+                out.append(regionNames[r]);
+                out.append("\"\n");
+            }
+            out.append("$EndPhysicalNames\n");
+        }
+
+        if (!isVersion4) {
+            out.append("$Nodes\n");
+            out.appendInt(numPoints);
+            out.append('\n');
+            appendFormatted(out, numPoints, FORMAT_CHUNK_ITEMS, options.formatThreads,
+                [&](OutputBuffer& sink, size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i) {
+                        if (binary) {
+                            sink.appendBinary(static_cast<int32_t>(i + 1));
+                            appendBinaryCoordinates(sink, i);
+                        } else {
+                            sink.appendInt(i + 1);
+                            sink.append(' ');
+                            appendCoordinates(sink, i);
+                            sink.append('\n');
+                        }
+                    }
+                });
+            out.append(binary ? "\n$EndNodes\n" : "$EndNodes\n");
+
+            // Every element carries two tags: physical group and elementary entity
+            out.append("$Elements\n");
+            out.appendInt(layout.elementCount);
+            out.append('\n');
+            auto appendElements = [&](OutputBuffer& sink, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    const uint32_t block = layout.cellBlock[i];
+                    if (block == GmshLayout::NO_BLOCK) {
+                        continue;
+                    }
+                    const GmshLayout::Entity& entity = layout.entities[layout.blocks[block].entity];
+                    const Index* indices = cells.cellPoints(i);
+                    if (binary) {
+                        sink.appendBinary(static_cast<int32_t>(i + 1));
+                        sink.appendBinary(entity.physical);
+                        sink.appendBinary(static_cast<int32_t>(entity.tag));
+                        for (size_t k = 0; k < cells.cellSize(i); ++k) {
+                            sink.appendBinary(static_cast<int32_t>(indices[k] + 1));
+                        }
+                    } else {
+                        sink.appendInt(i + 1);
+                        sink.append(' ');
+                        sink.appendInt(layout.blocks[block].gmshType);
+                        sink.append(" 2 ");
+                        sink.appendInt(entity.physical);
+                        sink.append(' ');
+                        sink.appendInt(entity.tag);
+                        appendNodes(sink, indices, cells.cellSize(i));
+                        sink.append('\n');
+                    }
+                }
+            };
+            if (!binary) {
+                appendFormatted(out, cells.size(), FORMAT_CHUNK_ITEMS, options.formatThreads, appendElements);
+            } else {
+                // Binary elements come in runs of one type, each behind a (type, count, tag count) header
+                for (size_t runBegin = 0; runBegin < cells.size();) {
+                    const uint32_t block = layout.cellBlock[runBegin];
+                    if (block == GmshLayout::NO_BLOCK) {
+                        ++runBegin;
+                        continue;
+                    }
+                    const int gmshType = layout.blocks[block].gmshType;
+                    size_t runEnd = runBegin + 1;
+                    while (runEnd < cells.size() && layout.cellBlock[runEnd] != GmshLayout::NO_BLOCK
+                           && layout.blocks[layout.cellBlock[runEnd]].gmshType == gmshType) {
+                        ++runEnd;
+                    }
+                    out.appendBinary<int32_t>(gmshType);
+                    out.appendBinary(static_cast<int32_t>(runEnd - runBegin));
+                    out.appendBinary<int32_t>(2);
+                    appendFormatted(out, runEnd - runBegin, FORMAT_CHUNK_ITEMS, options.formatThreads,
+                        [&](OutputBuffer& sink, size_t begin, size_t end) {
+                            appendElements(sink, runBegin + begin, runBegin + end);
+                        });
+                    runBegin = runEnd;
+                }
+                out.append('\n');
+            }
+            out.append("$EndElements\n");
+            return closeOutput(out, errorCode, errorMsg);
+        }
+
+        // MSH 4.1: entities (bounding boxes are the mesh bounds; Gmsh only uses them for display)
+        double bounds[6] = {0, 0, 0, 0, 0, 0};
+        for (uint64_t i = 0; i < numPoints; ++i) {
+            for (int axis = 0; axis < 3; ++axis) {
+                const double value = static_cast<double>(points[i * 3 + axis]);
+                if (i == 0 || value < bounds[axis]) bounds[axis] = value;
+                if (i == 0 || value > bounds[axis + 3]) bounds[axis + 3] = value;
+            }
+        }
+        size_t entityCount[4] = {0, 0, 0, 0};
+        for (const GmshLayout::Entity& entity : layout.entities) {
+            ++entityCount[entity.dimension];
+        }
+        out.append("$Entities\n");
+        for (int dimension = 0; dimension < 4; ++dimension) {
+            if (binary) {
+                out.appendBinary<uint64_t>(entityCount[dimension]);
+            } else {
+                out.appendInt(entityCount[dimension]);
+                out.append(dimension < 3 ? ' ' : '\n');
+            }
+        }
+        for (int dimension = 0; dimension < 4; ++dimension) {
+            for (const GmshLayout::Entity& entity : layout.entities) {
+                if (entity.dimension != dimension) {
+                    continue;
+                }
+                // Point entities store their position, the others a bounding box and no boundary
+                double box[6];
+                int boxValues = 6;
+                if (dimension == 0) {
+                    const Real* point = points + static_cast<size_t>(cells.cellPoints(entity.firstCell)[0]) * 3;
+                    box[0] = point[0];
+                    box[1] = point[1];
+                    box[2] = point[2];
+                    boxValues = 3;
+                } else {
+                    std::copy(bounds, bounds + 6, box);
+                }
+                const uint64_t physicalCount = entity.physical != 0 ? 1 : 0;
+                if (binary) {
+                    out.appendBinary(static_cast<int32_t>(entity.tag));
+                    out.append(box, boxValues * sizeof(double));
+                    out.appendBinary(physicalCount);
+                    if (physicalCount) {
+                        out.appendBinary(entity.physical);
+                    }
+                    if (dimension > 0) {
+                        out.appendBinary<uint64_t>(0);
+                    }
+                } else {
+                    out.appendInt(entity.tag);
+                    for (int k = 0; k < boxValues; ++k) {
+                        out.append(' ');
+                        out.appendFloat(box[k], 17);
+                    }
+                    out.append(' ');
+                    out.appendInt(physicalCount);
+                    if (physicalCount) {
+                        out.append(' ');
+                        out.appendInt(entity.physical);
+                    }
+                    out.append(dimension > 0 ? " 0\n" : "\n");
+                }
+            }
+        }
+        out.append(binary ? "\n$EndEntities\n" : "$EndEntities\n");
+
+        // All nodes in one block on the first entity of the highest dimension
+        const GmshLayout::Entity* nodeEntity = nullptr;
+        for (const GmshLayout::Entity& entity : layout.entities) {
+            if (entity.dimension == layout.maxDimension) {
+                nodeEntity = &entity;
+                break;
+            }
+        }
+        out.append("$Nodes\n");
+        if (binary) {
+            const uint64_t header[4] = {1, numPoints, 1, numPoints};
+            out.append(header, sizeof(header));
+            const int32_t blockHeader[3] = {nodeEntity->dimension, nodeEntity->tag, 0};
+            out.append(blockHeader, sizeof(blockHeader));
+            out.appendBinary(numPoints);
+        } else {
+            out.append("1 ");
+            out.appendInt(numPoints);
+            out.append(" 1 ");
+            out.appendInt(numPoints);
+            out.append('\n');
+            out.appendInt(nodeEntity->dimension);
+            out.append(' ');
+            out.appendInt(nodeEntity->tag);
+            out.append(" 0 ");
+            out.appendInt(numPoints);
+            out.append('\n');
+        }
+        appendFormatted(out, numPoints, FORMAT_CHUNK_ITEMS, options.formatThreads,
+            [&](OutputBuffer& sink, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    if (binary) {
+                        sink.appendBinary(static_cast<uint64_t>(i + 1));
+                    } else {
+                        sink.appendInt(i + 1);
+                        sink.append('\n');
+                    }
+                }
+            });
+        appendFormatted(out, numPoints, FORMAT_CHUNK_ITEMS, options.formatThreads,
+            [&](OutputBuffer& sink, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    if (binary) {
+                        appendBinaryCoordinates(sink, i);
+                    } else {
+                        appendCoordinates(sink, i);
+                        sink.append('\n');
+                    }
+                }
+            });
+        out.append(binary ? "\n$EndNodes\n" : "$EndNodes\n");
+
+        // One element block per (entity, element type)
+        const uint64_t minTag = *std::min_element(layout.order.begin(), layout.order.end()) + 1;
+        const uint64_t maxTag = *std::max_element(layout.order.begin(), layout.order.end()) + 1;
+        out.append("$Elements\n");
+        if (binary) {
+            const uint64_t header[4] = {layout.blocks.size(), layout.elementCount, minTag, maxTag};
+            out.append(header, sizeof(header));
+        } else {
+            out.appendInt(layout.blocks.size());
+            out.append(' ');
+            out.appendInt(layout.elementCount);
+            out.append(' ');
+            out.appendInt(minTag);
+            out.append(' ');
+            out.appendInt(maxTag);
+            out.append('\n');
+        }
+        for (size_t b = 0; b < layout.blocks.size(); ++b) {
+            const GmshLayout::Block& block = layout.blocks[b];
+            const GmshLayout::Entity& entity = layout.entities[block.entity];
+            if (binary) {
+                const int32_t blockHeader[3] = {entity.dimension, entity.tag, block.gmshType};
+                out.append(blockHeader, sizeof(blockHeader));
+                out.appendBinary(block.count);
+            } else {
+                out.appendInt(entity.dimension);
+                out.append(' ');
+                out.appendInt(entity.tag);
+                out.append(' ');
+                out.appendInt(block.gmshType);
+                out.append(' ');
+                out.appendInt(block.count);
+                out.append('\n');
+            }
+            const uint64_t* blockCells = layout.order.data() + layout.blockBegin[b];
+            appendFormatted(out, block.count, FORMAT_CHUNK_ITEMS, options.formatThreads,
+                [&](OutputBuffer& sink, size_t begin, size_t end) {
+                    for (size_t j = begin; j < end; ++j) {
+                        const size_t i = blockCells[j];
+                        const Index* indices = cells.cellPoints(i);
+                        if (binary) {
+                            sink.appendBinary(static_cast<uint64_t>(i + 1));
+                            for (size_t k = 0; k < cells.cellSize(i); ++k) {
+                                sink.appendBinary(static_cast<uint64_t>(indices[k]) + 1);
+                            }
+                        } else {
+                            sink.appendInt(i + 1);
+                            appendNodes(sink, indices, cells.cellSize(i));
+                            sink.append('\n');
+                        }
+                    }
+                });
+        }
+        out.append(binary ? "\n$EndElements\n" : "$EndElements\n");
+
+        return closeOutput(out, errorCode, errorMsg);
+    } catch (const std::exception& e) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        errorMsg = std::string("Exception while writing Gmsh file: ") + e.what();
+        return false;
+    }
 }
 
+template bool MeshWriter::writeGmsh(const MeshData&, const std::string&, bool, const FormatWriteOptions&, MeshErrorCode&, std::string&);
+template bool MeshWriter::writeGmsh(const MeshData64&, const std::string&, bool, const FormatWriteOptions&, MeshErrorCode&, std::string&);
+
 /**
  * @brief Write STL format file
  * @param meshData Input mesh data
@@ -192,11 +2293,86 @@ bool MeshWriter::writeSTL(const MeshData& meshData,
                          const FormatWriteOptions& options,
                          MeshErrorCode& errorCode,
                          std::string& errorMsg) {
-    // Implement STL format write logic here
-    // Temporarily return unimplemented
-    errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
-    errorMsg = "STL format write not implemented";
-    return false;
+    if (isMeshEmpty(meshData)) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Mesh data is empty";
+        return false;
+    }
+    if (!ensureDirectoryExists(filePath)) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        errorMsg = "Cannot create output directory";
+        return false;
+    }
+
+    MeshData boundary;
+    const MeshData* surface = nullptr;
+    if (!selectSurface(meshData, boundary, surface, errorCode, errorMsg)) {
+        return false;
+    }
+    const float* points = surface->points.data();
+    uint64_t triangleCount = 0;
+    forEachTriangle(surface->cells, [&triangleCount](uint32_t, uint32_t, uint32_t) { ++triangleCount; });
+    if (triangleCount == 0) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Mesh has no faces to write as STL";
+        return false;
+    }
+    if (options.isBinary && triangleCount > std::numeric_limits<uint32_t>::max()) {
+        errorCode = MeshErrorCode::PARAM_INVALID;
+        errorMsg = "Too many triangles for binary STL: " + std::to_string(triangleCount);
+        return false;
+    }
+
+    OutputBuffer out;
+    if (!out.open(filePath, errorMsg)) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        return false;
+    }
+
+    if (options.isBinary) {
+        // 80-byte header, uint32 triangle count, then 50-byte records (normal, 3 vertices, attribute)
+        char header[80] = {};
+        const char text[] = "Binary STL generated by MeshFormatConverter";
+        std::memcpy(header, text, sizeof(text) - 1);
+        out.append(header, sizeof(header));
+        out.appendBinary(static_cast<uint32_t>(triangleCount));
+        forEachTriangle(surface->cells, [&](uint32_t a, uint32_t b, uint32_t c) {
+            float record[12];
+            facetNormal(points + a * 3, points + b * 3, points + c * 3, record);
+            std::memcpy(record + 3, points + a * 3, 3 * sizeof(float));
+            std::memcpy(record + 6, points + b * 3, 3 * sizeof(float));
+            std::memcpy(record + 9, points + c * 3, 3 * sizeof(float));
+            out.append(record, sizeof(record));
+            out.appendBinary(static_cast<uint16_t>(0));
+        });
+    } else {
+        const std::string& solidName = options.stlSolidName;
+        out.append("solid ");
+        out.append(solidName);
+        out.append('\n');
+        appendFormatted(out, surface->cells.size(), FORMAT_CHUNK_ITEMS, options.formatThreads,
+            [&](OutputBuffer& sink, size_t begin, size_t end) {
+                forEachTriangle(surface->cells, begin, end, [&](uint32_t a, uint32_t b, uint32_t c) {
+                    const float* corners[3] = {points + a * 3, points + b * 3, points + c * 3};
+                    float normal[3];
+                    facetNormal(corners[0], corners[1], corners[2], normal);
+                    sink.append("facet normal ");
+                    appendPoint(sink, normal, options.precision);
+                    sink.append("\n outer loop\n");
+                    for (const float* corner : corners) {
+                        sink.append("  vertex ");
+                        appendPoint(sink, corner, options.precision);
+                        sink.append('\n');
+                    }
+                    sink.append(" endloop\nendfacet\n");
+                });
+            });
+        out.append("endsolid ");
+        out.append(solidName);
+        out.append('\n');
+    }
+
+    return closeOutput(out, errorCode, errorMsg);
 }
 
 /**
@@ -213,11 +2389,65 @@ bool MeshWriter::writeOBJ(const MeshData& meshData,
                         const FormatWriteOptions& options,
                         MeshErrorCode& errorCode,
                         std::string& errorMsg) {
-    // Implement OBJ format write logic here
-    // Temporarily return unimplemented
-    errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
-    errorMsg = "OBJ format write not implemented";
-    return false;
+    if (isMeshEmpty(meshData)) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Mesh data is empty";
+        return false;
+    }
+    if (!ensureDirectoryExists(filePath)) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        errorMsg = "Cannot create output directory";
+        return false;
+    }
+
+    MeshData boundary;
+    const MeshData* surface = nullptr;
+    if (!selectSurface(meshData, boundary, surface, errorCode, errorMsg)) {
+        return false;
+    }
+    const float* points = surface->points.data();
+    const uint64_t pointCount = surface->points.size() / 3;
+
+    OutputBuffer out;
+    if (!out.open(filePath, errorMsg)) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        return false;
+    }
+
+    out.append("# OBJ file generated by MeshFormatConverter\n");
+    appendPointLines(out, points, pointCount, "v ", options);
+
+    // OBJ indices are 1-based; line cells are kept as "l" records
+    const MeshData::CellArray& cells = surface->cells;
+    for (size_t i = 0; i < cells.size(); ++i) {
+        if (cells.types[i] != VtkCellType::LINE) {
+            continue;
+        }
+        const uint32_t* indices = cells.cellPoints(i);
+        const size_t count = cells.cellSize(i);
+        if (count < 2) {
+            continue;
+        }
+        out.append('l');
+        for (size_t k = 0; k < count; ++k) {
+            out.append(' ');
+            out.appendInt(static_cast<uint64_t>(indices[k]) + 1);
+        }
+        out.append('\n');
+    }
+    appendFormatted(out, cells.size(), FORMAT_CHUNK_ITEMS, options.formatThreads,
+        [&cells](OutputBuffer& sink, size_t begin, size_t end) {
+            forEachFace(cells, begin, end, [&sink](const uint32_t* indices, size_t count) {
+                sink.append('f');
+                for (size_t k = 0; k < count; ++k) {
+                    sink.append(' ');
+                    sink.appendInt(static_cast<uint64_t>(indices[k]) + 1);
+                }
+                sink.append('\n');
+            });
+        });
+
+    return closeOutput(out, errorCode, errorMsg);
 }
 
 /**
@@ -234,11 +2464,60 @@ bool MeshWriter::writePLY(const MeshData& meshData,
                         const FormatWriteOptions& options,
                         MeshErrorCode& errorCode,
                         std::string& errorMsg) {
-    // Implement PLY format write logic here
-    // Temporarily return unimplemented
-    errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
-    errorMsg = "PLY format write not implemented";
-    return false;
+    if (isMeshEmpty(meshData)) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Mesh data is empty";
+        return false;
+    }
+    if (!ensureDirectoryExists(filePath)) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        errorMsg = "Cannot create output directory";
+        return false;
+    }
+
+    MeshData boundary;
+    const MeshData* surface = nullptr;
+    if (!selectSurface(meshData, boundary, surface, errorCode, errorMsg)) {
+        return false;
+    }
+    const float* points = surface->points.data();
+    const uint64_t pointCount = surface->points.size() / 3;
+    size_t maxFaceSize = 0;
+    const uint64_t faceCount = countFaces(surface->cells, maxFaceSize);
+    if (options.isBinary && maxFaceSize > std::numeric_limits<uint8_t>::max()) {
+        errorCode = MeshErrorCode::PARAM_INVALID;
+        errorMsg = "Binary PLY face list count is limited to 255 points, mesh has a face with " + std::to_string(maxFaceSize);
+        return false;
+    }
+
+    OutputBuffer out;
+    if (!out.open(filePath, errorMsg)) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        return false;
+    }
+
+    out.append(options.isBinary ? "ply\nformat binary_little_endian 1.0\n" : "ply\nformat ascii 1.0\n");
+    out.append("comment Generated by MeshFormatConverter\nelement vertex ");
+    out.appendInt(pointCount);
+    out.append("\nproperty float x\nproperty float y\nproperty float z\nelement face ");
+    out.appendInt(faceCount);
+    out.append("\nproperty list uchar int vertex_indices\nend_header\n");
+
+    if (options.isBinary) {
+        // float32 xyz records match the in-memory point array, so it goes out in one write
+        out.append(points, surface->points.size() * sizeof(float));
+        forEachFace(surface->cells, [&out](const uint32_t* indices, size_t count) {
+            out.appendBinary(static_cast<uint8_t>(count));
+            for (size_t k = 0; k < count; ++k) {
+                out.appendBinary(static_cast<int32_t>(indices[k]));
+            }
+        });
+    } else {
+        appendPointLines(out, points, pointCount, "", options);
+        appendFaceLines(out, surface->cells, options);
+    }
+
+    return closeOutput(out, errorCode, errorMsg);
 }
 
 /**
@@ -255,11 +2534,42 @@ bool MeshWriter::writeOFF(const MeshData& meshData,
                         const FormatWriteOptions& options,
                         MeshErrorCode& errorCode,
                         std::string& errorMsg) {
-    // Implement OFF format write logic here
-    // Temporarily return unimplemented
-    errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
-    errorMsg = "OFF format write not implemented";
-    return false;
+    if (isMeshEmpty(meshData)) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Mesh data is empty";
+        return false;
+    }
+    if (!ensureDirectoryExists(filePath)) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        errorMsg = "Cannot create output directory";
+        return false;
+    }
+
+    MeshData boundary;
+    const MeshData* surface = nullptr;
+    if (!selectSurface(meshData, boundary, surface, errorCode, errorMsg)) {
+        return false;
+    }
+    const float* points = surface->points.data();
+    const uint64_t pointCount = surface->points.size() / 3;
+    size_t maxFaceSize = 0;
+    const uint64_t faceCount = countFaces(surface->cells, maxFaceSize);
+
+    OutputBuffer out;
+    if (!out.open(filePath, errorMsg)) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        return false;
+    }
+
+    out.append("OFF\n");
+    out.appendInt(pointCount);
+    out.append(' ');
+    out.appendInt(faceCount);
+    out.append(" 0\n");
+    appendPointLines(out, points, pointCount, "", options);
+    appendFaceLines(out, surface->cells, options);
+
+    return closeOutput(out, errorCode, errorMsg);
 }
 
 /**
@@ -271,12 +2581,13 @@ bool MeshWriter::writeOFF(const MeshData& meshData,
  * @param[out] errorMsg Output error message
  * @return Whether writing is successful
  */
-bool MeshWriter::writeSU2(const MeshData& meshData,
+template<typename Real, typename Index>
+bool MeshWriter::writeSU2(const BasicMeshData<Real, Index>& meshData,
                         const std::string& filePath,
                         const FormatWriteOptions& options,
                         MeshErrorCode& errorCode,
                         std::string& errorMsg) {
-    if (isMeshEmpty(meshData)) {
+    if (meshData.isEmpty()) {
         errorCode = MeshErrorCode::MESH_EMPTY;
         errorMsg = "Mesh data is empty";
         return false;
@@ -288,94 +2599,69 @@ bool MeshWriter::writeSU2(const MeshData& meshData,
         return false;
     }
 
-    std::ofstream file(filePath);
-    if (!file.is_open()) {
-        errorCode = MeshErrorCode::WRITE_FAILED;
-        errorMsg = "Failed to open file for writing: " + filePath;
+    // Elements in cell order; polygons and strips are triangulated in place, other types skipped
+    const typename BasicMeshData<Real, Index>::CellArray& cells = meshData.cells;
+    const size_t numPoints = meshData.points.size() / 3;
+    size_t numCells = 0;
+    forEachSU2Element(cells, 0, cells.size(), [&numCells](int, const Index*, size_t) { ++numCells; });
+    if (numPoints == 0 || numCells == 0) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Mesh has no points or cells";
         return false;
     }
 
     try {
-        file << "% SU2 mesh file generated by MeshFormatConverter\n";
-        file << "%\n";
-
-        size_t numPoints = meshData.metadata.pointCount;
-        size_t numCells = meshData.metadata.cellCount;
-
-        if (numPoints == 0 || numCells == 0) {
-            errorCode = MeshErrorCode::MESH_EMPTY;
-            errorMsg = "Mesh has no points or cells";
+        OutputBuffer out;
+        if (!out.open(filePath, errorMsg)) {
+            errorCode = MeshErrorCode::WRITE_FAILED;
             return false;
         }
 
-        int ndime = 3;
-        file << "NDIME= " << ndime << "\n\n";
-
-        file << "NELEM= " << numCells << "\n";
-        for (const auto& cell : meshData.cells) {
-            int su2Type;
-            switch (cell.type) {
-                case VtkCellType::VERTEX:
-                    su2Type = 1;
-                    break;
-                case VtkCellType::LINE:
-                    su2Type = 3;
-                    break;
-                case VtkCellType::TRIANGLE:
-                    su2Type = 5;
-                    break;
-                case VtkCellType::QUAD:
-                    su2Type = 9;
-                    break;
-                case VtkCellType::TETRA:
-                    su2Type = 10;
-                    break;
-                case VtkCellType::HEXAHEDRON:
-                    su2Type = 12;
-                    break;
-                case VtkCellType::WEDGE:
-                    su2Type = 13;
-                    break;
-                case VtkCellType::PYRAMID:
-                    su2Type = 14;
-                    break;
-                default:
-                    continue;
-            }
-
-            file << su2Type;
-            for (uint32_t idx : cell.pointIndices) {
-                file << " " << idx;
-            }
-            file << " 0\n";
-        }
-        file << "\n";
-
-        file << "NPOIN= " << numPoints << "\n";
-        for (size_t i = 0; i < numPoints; ++i) {
-            size_t idx = i * 3;
-            float x = meshData.points[idx];
-            float y = meshData.points[idx + 1];
-            float z = meshData.points[idx + 2];
-            file << std::fixed << std::setprecision(options.precision);
-            file << x << " " << y << " " << z << " " << i << "\n";
-        }
-        file << "\n";
+        out.append("% SU2 mesh file generated by MeshFormatConverter\n");
+        out.append("%\n");
+        out.append("NDIME= 3\n\n");
 
-        file << "NMARK= 0\n";
+        out.append("NELEM= ");
+        out.appendInt(numCells);
+        out.append('\n');
+        // Walk the flat CSR arrays directly
+        appendFormatted(out, cells.size(), FORMAT_CHUNK_ITEMS, options.formatThreads,
+            [&](OutputBuffer& sink, size_t begin, size_t end) {
+                forEachSU2Element(cells, begin, end, [&sink](int type, const Index* indices, size_t count) {
+                    sink.appendInt(type);
+                    for (size_t k = 0; k < count; ++k) {
+                        sink.append(' ');
+                        sink.appendInt(indices[k]);
+                    }
+                    sink.append(" 0\n");
+                });
+            });
+        out.append('\n');
 
-        file.flush();
-        if (file.fail()) {
-            errorCode = MeshErrorCode::WRITE_FAILED;
-            errorMsg = "Failed to write to file";
-            return false;
-        }
+        // Points use fixed notation with options.precision decimals
+        out.append("NPOIN= ");
+        out.appendInt(numPoints);
+        out.append('\n');
+        const Real* points = meshData.points.data();
+        appendFormatted(out, numPoints, FORMAT_CHUNK_ITEMS, options.formatThreads,
+            [&](OutputBuffer& sink, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    const Real* point = points + i * 3;
+                    sink.appendFixed(point[0], options.precision);
+                    sink.append(' ');
+                    sink.appendFixed(point[1], options.precision);
+                    sink.append(' ');
+                    sink.appendFixed(point[2], options.precision);
+                    sink.append(' ');
+                    sink.appendInt(i);
+                    sink.append('\n');
+                }
+            });
+        out.append('\n');
 
-        file.close();
-        errorCode = MeshErrorCode::SUCCESS;
-        errorMsg = "";
-        return true;
+        out.append("NMARK= 0\n");
 
+        return closeOutput(out, errorCode, errorMsg);
     } catch (const std::exception& e) {
         errorCode = MeshErrorCode::WRITE_FAILED;
         errorMsg = std::string("Exception while writing SU2 file: ") + e.what();
@@ -383,27 +2669,89 @@ bool MeshWriter::writeSU2(const MeshData& meshData,
     }
 }
 
+template bool MeshWriter::writeSU2(const MeshData&, const std::string&, const FormatWriteOptions&, MeshErrorCode&, std::string&);
+template bool MeshWriter::writeSU2(const MeshData64&, const std::string&, const FormatWriteOptions&, MeshErrorCode&, std::string&);
+
 /**
- * @brief Write OpenFOAM format file
+ * @brief Write OpenFOAM polyMesh (points, faces, owner, neighbour, boundary)
  * @param meshData Input mesh data
- * @param filePath Output file path (UTF-8 encoded)
- * @param options Write options
+ * @param filePath Case, constant or polyMesh directory (UTF-8 encoded)
+ * @param options Write options (isBinary, precision, formatThreads)
  * @param[out] errorCode Output error code
  * @param[out] errorMsg Output error message
  * @return Whether writing is successful
  */
-bool MeshWriter::writeOpenFOAM(const MeshData& meshData,
+template<typename Real, typename Index>
+bool MeshWriter::writeOpenFOAM(const BasicMeshData<Real, Index>& meshData,
                              const std::string& filePath,
                              const FormatWriteOptions& options,
                              MeshErrorCode& errorCode,
                              std::string& errorMsg) {
-    // Implement OpenFOAM format write logic here
-    // Temporarily return unimplemented
-    errorCode = MeshErrorCode::FORMAT_VERSION_INVALID;
-    errorMsg = "OpenFOAM format write not implemented";
-    return false;
+    FoamLayout<Index> layout;
+    if (!buildFoamLayout(meshData, options.formatThreads, layout, errorCode, errorMsg)) {
+        return false;
+    }
+
+    const std::filesystem::path directory = openFoamMeshDirectory(filePath);
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec) {
+        errorCode = MeshErrorCode::WRITE_FAILED;
+        errorMsg = "Cannot create polyMesh directory: " + ec.message();
+        return false;
+    }
+
+    // The five files are independent: each goes through its own buffer and thread
+    constexpr size_t FILE_COUNT = 5;
+    std::vector<std::string> fileErrors(FILE_COUNT);
+    std::vector<char> fileWritten(FILE_COUNT, 0);
+    FormatWriteOptions fileOptions = options;
+    const unsigned int threads = options.formatThreads ? options.formatThreads : std::max(1u, std::thread::hardware_concurrency());
+    fileOptions.formatThreads = std::max(1u, threads / static_cast<unsigned int>(FILE_COUNT));
+    runParallel(FILE_COUNT, [&](size_t file) {
+        fileWritten[file] = writeFoamFile(directory, file, meshData, layout, fileOptions, fileErrors[file]) ? 1 : 0;
+    });
+    for (size_t file = 0; file < FILE_COUNT; ++file) {
+        if (!fileWritten[file]) {
+            errorCode = MeshErrorCode::WRITE_FAILED;
+            errorMsg = fileErrors[file];
+            return false;
+        }
+    }
+    errorCode = MeshErrorCode::SUCCESS;
+    errorMsg.clear();
+    return true;
+}
+
+template bool MeshWriter::writeOpenFOAM(const MeshData&, const std::string&, const FormatWriteOptions&, MeshErrorCode&, std::string&);
+template bool MeshWriter::writeOpenFOAM(const MeshData64&, const std::string&, const FormatWriteOptions&, MeshErrorCode&, std::string&);
+
+/**
+ * @brief Write native binary mesh cache file (.mcb)
+ * @param meshData Input mesh data
+ * @param filePath Output file path (UTF-8 encoded)
+ * @param options Write options (compress, formatThreads)
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message
+ * @return Whether writing is successful
+ */
+template<typename Real, typename Index>
+bool MeshWriter::writeMeshCache(const BasicMeshData<Real, Index>& meshData,
+                                const std::string& filePath,
+                                const FormatWriteOptions& options,
+                                MeshErrorCode& errorCode,
+                                std::string& errorMsg) {
+    if (meshData.isEmpty()) {
+        errorCode = MeshErrorCode::MESH_EMPTY;
+        errorMsg = "Mesh data is empty";
+        return false;
+    }
+    return MeshCache::writeFile(meshData, filePath, options, MeshCache::SourceKey(), errorCode, errorMsg);
 }
 
+template bool MeshWriter::writeMeshCache(const MeshData&, const std::string&, const FormatWriteOptions&, MeshErrorCode&, std::string&);
+template bool MeshWriter::writeMeshCache(const MeshData64&, const std::string&, const FormatWriteOptions&, MeshErrorCode&, std::string&);
+
 // --------------------------------------------------------------------------
 // VTK intermediate format related method implementations
 // --------------------------------------------------------------------------
@@ -416,92 +2764,14 @@ bool MeshWriter::writeOpenFOAM(const MeshData& meshData,
  */
 bool MeshWriter::vtkToMeshData(const vtkSmartPointer<vtkUnstructuredGrid>& grid,
                              MeshData& meshData) {
-    // Clear existing data
-    meshData.points.clear();
-    meshData.cells.clear();
-    meshData.pointData.clear();
-    meshData.cellData.clear();
-    
-    // Reset metadata
-    meshData.metadata = MeshMetadata();
-    
-    // Get point set
-    vtkPoints* points = grid->GetPoints();
-    if (!points) {
+    if (!grid || !grid->GetPoints()) {
         return false;
     }
     
-    // Add points
-    vtkIdType numPoints = points->GetNumberOfPoints();
-    for (vtkIdType i = 0; i < numPoints; ++i) {
-        double coords[3];
-        points->GetPoint(i, coords);
-        
-        meshData.points.push_back(static_cast<float>(coords[0]));
-        meshData.points.push_back(static_cast<float>(coords[1]));
-        meshData.points.push_back(static_cast<float>(coords[2]));
-    }
-    
-    // Add cells
-    vtkIdType numCells = grid->GetNumberOfCells();
-    for (vtkIdType i = 0; i < numCells; ++i) {
-        vtkCell* cell = grid->GetCell(i);
-        if (!cell) {
-            continue;
-        }
-        
-        MeshData::Cell newCell;
-        
-        // Determine cell type
-        int cellType = cell->GetCellType();
-        switch (cellType) {
-        case VTK_TETRA:
-            newCell.type = VtkCellType::TETRA;
-            break;
-        case VTK_HEXAHEDRON:
-            newCell.type = VtkCellType::HEXAHEDRON;
-            break;
-        case VTK_WEDGE:
-            newCell.type = VtkCellType::WEDGE;
-            break;
-        case VTK_PYRAMID:
-            newCell.type = VtkCellType::PYRAMID;
-            break;
-        case VTK_TRIANGLE:
-            newCell.type = VtkCellType::TRIANGLE;
-            break;
-        case VTK_QUAD:
-            newCell.type = VtkCellType::QUAD;
-            break;
-        case VTK_LINE:
-            newCell.type = VtkCellType::LINE;
-            break;
-        case VTK_VERTEX:
-            newCell.type = VtkCellType::VERTEX;
-            break;
-        case VTK_TRIANGLE_STRIP:
-            newCell.type = VtkCellType::TRIANGLE_STRIP;
-            break;
-        case VTK_POLYGON:
-            newCell.type = VtkCellType::POLYGON;
-            break;
-        default:
-            continue;
-        }
-        
-        // Add node IDs
-        vtkIdType numCellPoints = cell->GetNumberOfPoints();
-        for (vtkIdType j = 0; j < numCellPoints; ++j) {
-            newCell.pointIndices.push_back(static_cast<uint32_t>(cell->GetPointId(j)));
-        }
-        
-        meshData.cells.push_back(newCell);
-    }
-    
-    // Calculate metadata
-    meshData.calculateMetadata();
-    
-    return true;
+    // Bulk copy of the raw VTK point/cell/attribute arrays
+    MeshErrorCode errorCode;
+    std::string errorMsg;
+    return VTKBridge::toMeshData(grid, meshData, errorCode, errorMsg);
 }
 
 /**
@@ -612,8 +2882,8 @@ bool MeshWriter::writeVTKToGmsh(const vtkSmartPointer<vtkUnstructuredGrid>& grid
         return false;
     }
     
-    // Use existing writeGmsh method to write
-    return writeGmsh(meshData, filePath, options, errorCode, errorMsg);
+    // Use existing writeGmsh method to write (MSH 4.1)
+    return writeGmsh(meshData, filePath, true, options, errorCode, errorMsg);
 }
 
 /**
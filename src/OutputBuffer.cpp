@@ -0,0 +1,126 @@
+#include "OutputBuffer.h"
+#include <algorithm>
+
+/**
+ * @brief Constructor
+ * @param capacity Buffer size in bytes
+ */
+OutputBuffer::OutputBuffer(size_t capacity)
+    : buffer_((std::max)(capacity, MAX_NUMBER_CHARS * 4)) {}
+
+OutputBuffer::~OutputBuffer() {
+    if (file_.is_open()) {
+        flush();
+    }
+}
+
+/**
+ * @brief Create (truncate) the output file
+ * @param filePath File path (UTF-8 encoded)
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @return Whether the file was opened
+ */
+bool OutputBuffer::open(const std::string& filePath, std::string& errorMsg) {
+    filePath_ = filePath;
+    used_ = 0;
+    flushed_ = 0;
+    failed_ = false;
+    // The stream's own buffer is disabled: every flush() is a single write of the whole block
+    file_.rdbuf()->pubsetbuf(nullptr, 0);
+    file_.open(filePath, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open()) {
+        errorMsg = "Failed to open file for writing: " + filePath;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Flush the buffer and close the file
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @return Whether every byte reached the file
+ */
+bool OutputBuffer::close(std::string& errorMsg) {
+    if (!file_.is_open()) {
+        errorMsg = "Output file is not open";
+        return false;
+    }
+    flush();
+    file_.close();
+    if (failed_ || file_.fail()) {
+        errorMsg = "Failed to write to file: " + filePath_;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Hand the buffered bytes to the OS
+ * @return Whether writing is successful
+ */
+bool OutputBuffer::flush() {
+    if (used_ > 0 && !failed_) {
+        file_.write(buffer_.data(), static_cast<std::streamsize>(used_));
+        failed_ = file_.fail();
+    }
+    flushed_ += used_;
+    used_ = 0;
+    return !failed_;
+}
+
+/**
+ * @brief Overwrite bytes appended earlier
+ * Bytes still pending are replaced in memory; flushed bytes are rewritten in place in the file.
+ * @param offset Position of the first byte (from the start of the output)
+ * @param data Replacement bytes
+ * @param size Number of bytes (the range must already have been appended)
+ * @return Whether writing is successful
+ */
+bool OutputBuffer::patch(uint64_t offset, const void* data, size_t size) {
+    if (offset >= flushed_) {
+        std::memcpy(buffer_.data() + (offset - flushed_), data, size);
+        return true;
+    }
+    flush();
+    if (!failed_) {
+        file_.seekp(static_cast<std::streamoff>(offset));
+        file_.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        file_.seekp(0, std::ios::end);
+        failed_ = file_.fail();
+    }
+    return !failed_;
+}
+
+/**
+ * @brief Make room for size more bytes: flush to the file, or grow an in-memory block
+ * @param size Number of bytes about to be appended
+ */
+void OutputBuffer::makeRoom(size_t size) {
+    if (file_.is_open()) {
+        flush();
+        if (size <= buffer_.size()) {
+            return;
+        }
+    }
+    buffer_.resize((std::max)(buffer_.size() * 2, used_ + size));
+}
+
+/**
+ * @brief Write a large payload directly from the caller's memory
+ * @param data Bytes to write
+ * @param size Number of bytes
+ */
+void OutputBuffer::appendLarge(const void* data, size_t size) {
+    if (!file_.is_open()) {
+        reserve(size);
+        std::memcpy(buffer_.data() + used_, data, size);
+        used_ += size;
+        return;
+    }
+    flush();
+    if (!failed_) {
+        file_.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        failed_ = file_.fail();
+    }
+    flushed_ += size;
+}
@@ -0,0 +1,372 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <system_error>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#include <sys/resource.h>
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+std::atomic<bool> profilerEnabled{false};  // Any sink attached
+
+/**
+ * @brief Sink list shared by all threads
+ */
+struct SinkRegistry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ProfileSink>> sinks;
+};
+
+SinkRegistry& registry() {
+    static SinkRegistry instance;
+    return instance;
+}
+
+/**
+ * @brief Sink forwarding events to a callback
+ */
+class CallbackSink : public ProfileSink {
+public:
+    explicit CallbackSink(std::function<void(const ProfileEvent&)> callback) : callback_(std::move(callback)) {}
+    void onEvent(const ProfileEvent& event) override { callback_(event); }
+
+private:
+    std::function<void(const ProfileEvent&)> callback_;
+};
+
+const std::chrono::steady_clock::time_point& epoch() {
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return start;
+}
+
+double toMB(uint64_t bytes) {
+    return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+void appendJsonString(std::string& out, const std::string& text) {
+    out += '"';
+    for (char ch : text) {
+        switch (ch) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(ch) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(ch));
+                    out += escaped;
+                } else {
+                    out += ch;
+                }
+        }
+    }
+    out += '"';
+}
+
+/**
+ * @brief Trace timestamps are microseconds; keep the nanosecond fraction
+ */
+std::string microseconds(uint64_t ns) {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%llu.%03u", static_cast<unsigned long long>(ns / 1000), static_cast<unsigned>(ns % 1000));
+    return text;
+}
+
+} // namespace
+
+bool Profiler::enabled() {
+    return profilerEnabled.load(std::memory_order_relaxed);
+}
+
+void Profiler::addSink(std::shared_ptr<ProfileSink> sink) {
+    if (!sink) {
+        return;
+    }
+    SinkRegistry& sinks = registry();
+    std::lock_guard<std::mutex> lock(sinks.mutex);
+    epoch();
+    sinks.sinks.push_back(std::move(sink));
+    profilerEnabled.store(true, std::memory_order_relaxed);
+}
+
+std::shared_ptr<ProfileSink> Profiler::addCallback(std::function<void(const ProfileEvent&)> callback) {
+    std::shared_ptr<ProfileSink> sink = std::make_shared<CallbackSink>(std::move(callback));
+    addSink(sink);
+    return sink;
+}
+
+void Profiler::removeSink(const std::shared_ptr<ProfileSink>& sink) {
+    SinkRegistry& sinks = registry();
+    std::lock_guard<std::mutex> lock(sinks.mutex);
+    sinks.sinks.erase(std::remove(sinks.sinks.begin(), sinks.sinks.end(), sink), sinks.sinks.end());
+    profilerEnabled.store(!sinks.sinks.empty(), std::memory_order_relaxed);
+}
+
+void Profiler::clearSinks() {
+    SinkRegistry& sinks = registry();
+    std::lock_guard<std::mutex> lock(sinks.mutex);
+    sinks.sinks.clear();
+    profilerEnabled.store(false, std::memory_order_relaxed);
+}
+
+void Profiler::emit(const ProfileEvent& event) {
+    SinkRegistry& sinks = registry();
+    std::lock_guard<std::mutex> lock(sinks.mutex);
+    for (const std::shared_ptr<ProfileSink>& sink : sinks.sinks) {
+        sink->onEvent(event);
+    }
+}
+
+void Profiler::emitCounter(const char* name, double value) {
+    ProfileEvent event;
+    event.type = ProfileEvent::Type::COUNTER;
+    event.name = name;
+    event.startNs = nowNs();
+    event.threadId = threadId();
+    event.value = value;
+    emit(event);
+}
+
+void Profiler::emitMessage(const std::string& text) {
+    ProfileEvent event;
+    event.type = ProfileEvent::Type::MESSAGE;
+    event.name = text;
+    event.startNs = nowNs();
+    event.threadId = threadId();
+    emit(event);
+}
+
+uint64_t Profiler::nowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - epoch()).count());
+}
+
+uint64_t Profiler::currentRssBytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<uint64_t>(counters.WorkingSetSize);
+    }
+    return 0;
+#elif defined(__APPLE__)
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+        return static_cast<uint64_t>(info.resident_size);
+    }
+    return 0;
+#else
+    // Second field of statm: resident pages
+    FILE* statm = std::fopen("/proc/self/statm", "r");
+    if (!statm) {
+        return 0;
+    }
+    unsigned long long size = 0;
+    unsigned long long resident = 0;
+    const int fields = std::fscanf(statm, "%llu %llu", &size, &resident);
+    std::fclose(statm);
+    return fields == 2 ? static_cast<uint64_t>(resident) * static_cast<uint64_t>(sysconf(_SC_PAGESIZE)) : 0;
+#endif
+}
+
+uint64_t Profiler::peakRssBytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<uint64_t>(counters.PeakWorkingSetSize);
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if defined(__APPLE__)
+    return static_cast<uint64_t>(usage.ru_maxrss);         // bytes
+#else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;  // kilobytes
+#endif
+#endif
+}
+
+uint64_t Profiler::pathBytes(const std::string& path) {
+    std::error_code ec;
+    const std::filesystem::path fsPath = std::filesystem::u8path(path);
+    if (!std::filesystem::is_directory(fsPath, ec)) {
+        const std::uintmax_t size = std::filesystem::file_size(fsPath, ec);
+        return ec ? 0 : static_cast<uint64_t>(size);
+    }
+    uint64_t bytes = 0;
+    for (std::filesystem::recursive_directory_iterator it(fsPath, ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->is_regular_file(ec)) {
+            bytes += static_cast<uint64_t>(it->file_size(ec));
+        }
+    }
+    return bytes;
+}
+
+uint32_t Profiler::threadId() {
+    static std::atomic<uint32_t> nextId{1};
+    thread_local const uint32_t id = nextId.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+void ProfileScope::begin(const char* category, const char* name, const std::string& detail) {
+    event_.type = ProfileEvent::Type::STAGE;
+    event_.category = category;
+    event_.name = name;
+    event_.detail = detail;
+    event_.threadId = Profiler::threadId();
+    startPeakRss_ = Profiler::peakRssBytes();
+    event_.startNs = Profiler::nowNs();
+}
+
+void ProfileScope::end() {
+    event_.durationNs = Profiler::nowNs() - event_.startNs;
+    event_.bytes = bytes_;
+    event_.inputCells = inputCells_;
+    event_.cells = cells_;
+    event_.rssBytes = Profiler::currentRssBytes();
+    const uint64_t peak = Profiler::peakRssBytes();
+    event_.peakGrowthBytes = peak > startPeakRss_ ? peak - startPeakRss_ : 0;
+    Profiler::emit(event_);
+}
+
+void ConsoleProfileSink::onEvent(const ProfileEvent& event) {
+    if (event.type == ProfileEvent::Type::MESSAGE) {
+        std::cout << event.name << std::endl;
+        return;
+    }
+    if (event.type != ProfileEvent::Type::STAGE || !stages_) {
+        return;
+    }
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(3);
+    line << "[" << event.category << "] " << event.name << ": " << event.durationNs * 1e-9 << " s";
+    if (event.inputCells || event.cells) {
+        line << ", ";
+        if (event.inputCells) {
+            line << event.inputCells << " -> ";
+        }
+        line << event.cells << " cells";
+    }
+    if (event.bytes) {
+        line << ", " << std::setprecision(1) << toMB(event.bytes) << " MB";
+    }
+    if (event.peakGrowthBytes) {
+        line << ", peak +" << std::setprecision(1) << toMB(event.peakGrowthBytes) << " MB";
+    }
+    if (!event.detail.empty()) {
+        line << " (" << event.detail << ")";
+    }
+    std::cout << line.str() << std::endl;
+}
+
+void StageSummarySink::onEvent(const ProfileEvent& event) {
+    if (event.type != ProfileEvent::Type::STAGE) {
+        return;
+    }
+    StageTotals& totals = totals_[{event.category, event.name}];
+    const double seconds = event.durationNs * 1e-9;
+    totals.count++;
+    totals.seconds += seconds;
+    totals.maxSeconds = std::max(totals.maxSeconds, seconds);
+    totals.bytes += event.bytes;
+    totals.cells += event.cells;
+    totals.peakGrowthBytes = std::max(totals.peakGrowthBytes, event.peakGrowthBytes);
+}
+
+std::string StageSummarySink::toString() const {
+    std::ostringstream out;
+    out << std::fixed;
+    out << std::left << std::setw(28) << "Stage" << std::right
+        << std::setw(7) << "Count" << std::setw(11) << "Total s" << std::setw(10) << "Max s"
+        << std::setw(11) << "MB" << std::setw(10) << "MB/s" << std::setw(12) << "Mcells/s"
+        << std::setw(12) << "Peak +MB" << "\n";
+    for (const auto& [key, totals] : totals_) {
+        const std::string stage = key.first + "/" + key.second;
+        out << std::left << std::setw(28) << stage << std::right
+            << std::setw(7) << totals.count
+            << std::setprecision(3) << std::setw(11) << totals.seconds << std::setw(10) << totals.maxSeconds
+            << std::setprecision(1) << std::setw(11) << toMB(totals.bytes)
+            << std::setw(10) << (totals.bytes && totals.seconds > 0.0 ? toMB(totals.bytes) / totals.seconds : 0.0)
+            << std::setprecision(2) << std::setw(12) << (totals.cells && totals.seconds > 0.0 ? totals.cells * 1e-6 / totals.seconds : 0.0)
+            << std::setprecision(1) << std::setw(12) << toMB(totals.peakGrowthBytes) << "\n";
+    }
+    out << "Peak resident set: " << std::setprecision(1) << toMB(Profiler::peakRssBytes()) << " MB\n";
+    return out.str();
+}
+
+void ChromeTraceSink::onEvent(const ProfileEvent& event) {
+    events_.push_back(event);
+}
+
+bool ChromeTraceSink::write(const std::string& filePath, std::string& errorMsg) const {
+    std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const ProfileEvent& event : events_) {
+        json += first ? "\n" : ",\n";
+        first = false;
+        json += "{\"pid\":1,\"tid\":" + std::to_string(event.threadId) + ",\"ts\":" + microseconds(event.startNs) + ",\"name\":";
+        appendJsonString(json, event.name);
+        switch (event.type) {
+            case ProfileEvent::Type::STAGE:
+                json += ",\"cat\":";
+                appendJsonString(json, event.category);
+                json += ",\"ph\":\"X\",\"dur\":" + microseconds(event.durationNs) + ",\"args\":{";
+                json += "\"bytes\":" + std::to_string(event.bytes);
+                json += ",\"inputCells\":" + std::to_string(event.inputCells);
+                json += ",\"cells\":" + std::to_string(event.cells);
+                json += ",\"rssBytes\":" + std::to_string(event.rssBytes);
+                json += ",\"peakGrowthBytes\":" + std::to_string(event.peakGrowthBytes);
+                if (!event.detail.empty()) {
+                    json += ",\"detail\":";
+                    appendJsonString(json, event.detail);
+                }
+                json += "}}";
+                break;
+            case ProfileEvent::Type::COUNTER: {
+                char value[32];
+                std::snprintf(value, sizeof(value), "%.17g", event.value);
+                json += ",\"ph\":\"C\",\"args\":{\"value\":";
+                json += value;
+                json += "}}";
+                break;
+            }
+            case ProfileEvent::Type::MESSAGE:
+                json += ",\"ph\":\"i\",\"s\":\"t\"}";
+                break;
+        }
+    }
+    json += "\n]}\n";
+
+    std::ofstream file(std::filesystem::u8path(filePath), std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        errorMsg = "Cannot open trace file for writing: " + filePath;
+        return false;
+    }
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+    if (!file.good()) {
+        errorMsg = "Failed to write trace file: " + filePath;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,270 @@
+#include "TaskPool.h"
+
+#include <algorithm>
+#include <numeric>
+
+// ==============================
+// TaskPool::TaskGroup
+// ==============================
+
+/**
+ * @brief Block until all tasks submitted with this group have finished
+ */
+void TaskPool::TaskGroup::wait() {
+    std::unique_lock<std::mutex> lock(doneMutex_);
+    doneCondition_.wait(lock, [this] { return unfinished_ == 0; });
+}
+
+/**
+ * @brief Check whether one more task of the given cost may start (pool mutex held)
+ * @param memoryCost Estimated memory of the task in bytes
+ * @return Whether the task is admitted
+ */
+bool TaskPool::TaskGroup::admits(uint64_t memoryCost) const {
+    if (maxConcurrency_ > 0 && running_ >= maxConcurrency_) {
+        return false;
+    }
+    // An oversized task is admitted once nothing else of the group is running
+    return memoryBudget_ == 0 || running_ == 0 || memoryInUse_ + memoryCost <= memoryBudget_;
+}
+
+// ==============================
+// TaskPool
+// ==============================
+
+/**
+ * @brief Constructor
+ * @param threadCount Number of worker threads (0 = hardware concurrency)
+ */
+TaskPool::TaskPool(size_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    queues_.resize(threadCount);
+    workers_.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        workers_.emplace_back(&TaskPool::workerLoop, this, i);
+    }
+}
+
+/**
+ * @brief Destructor, finishes queued tasks and joins the workers
+ */
+TaskPool::~TaskPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    condition_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Process-wide pool shared by MeshConverter, the command line tool and the Qt app
+ * @return Shared pool (hardware concurrency workers)
+ */
+TaskPool& TaskPool::shared() {
+    // Never destroyed: joining threads during static destruction (DLL unload) can deadlock
+    static TaskPool* pool = new TaskPool();
+    return *pool;
+}
+
+/**
+ * @brief Queue a task
+ * @param task Task to run
+ * @param memoryCost Estimated peak memory of the task in bytes
+ * @param group Optional group providing limits and wait()
+ */
+void TaskPool::submit(std::function<void()> task,
+                      uint64_t memoryCost,
+                      const std::shared_ptr<TaskGroup>& group) {
+    std::vector<std::function<void()>> tasks;
+    tasks.push_back(std::move(task));
+    submitBatch(std::move(tasks), {memoryCost}, group);
+}
+
+/**
+ * @brief Queue several tasks, largest memory cost first, spread across the worker deques
+ * @param tasks Tasks to run
+ * @param memoryCosts Estimated peak memory of each task in bytes (same size as tasks)
+ * @param group Optional group providing limits and wait()
+ */
+void TaskPool::submitBatch(std::vector<std::function<void()>> tasks,
+                           const std::vector<uint64_t>& memoryCosts,
+                           const std::shared_ptr<TaskGroup>& group) {
+    if (tasks.empty()) {
+        return;
+    }
+    if (group) {
+        std::lock_guard<std::mutex> lock(group->doneMutex_);
+        group->unfinished_ += tasks.size();
+    }
+
+    // Deal tasks largest first so every worker starts on one of the biggest inputs
+    std::vector<size_t> order(tasks.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&memoryCosts](size_t a, size_t b) {
+        return memoryCosts[a] > memoryCosts[b];
+    });
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t index : order) {
+            Task task{std::move(tasks[index]), memoryCosts[index], group};
+            std::vector<Lane>& queue = queues_[nextQueue_];
+            nextQueue_ = (nextQueue_ + 1) % queues_.size();
+
+            auto lane = std::find_if(queue.begin(), queue.end(), [&group](const Lane& candidate) {
+                return candidate.group == group.get();
+            });
+            if (lane == queue.end()) {
+                lane = queue.insert(queue.end(), Lane{group.get(), {}});
+            }
+
+            // Keep each lane sorted by descending cost (a sorted batch only appends)
+            std::deque<Task>& laneTasks = lane->tasks;
+            if (laneTasks.empty() || laneTasks.back().memoryCost >= task.memoryCost) {
+                laneTasks.push_back(std::move(task));
+            } else {
+                auto position = std::upper_bound(laneTasks.begin(), laneTasks.end(), task.memoryCost,
+                    [](uint64_t cost, const Task& queued) { return cost > queued.memoryCost; });
+                laneTasks.insert(position, std::move(task));
+            }
+        }
+        pendingTasks_ += order.size();
+    }
+    if (order.size() == 1) {
+        condition_.notify_one();
+    } else {
+        condition_.notify_all();
+    }
+}
+
+/**
+ * @brief Pick the next task for a worker (pool mutex held)
+ * Takes the largest lane head across all queues (the worker's own queue wins ties, other queues
+ * are stolen from). When the largest pending task of a group does not fit the group's limits,
+ * no smaller task of that group is started in its place, so large inputs are not starved by a
+ * stream of small ones; the lanes of such a group are skipped without being walked.
+ * @param workerIndex Index of the calling worker
+ * @param[out] task Task to run
+ * @return Whether a task was taken
+ */
+bool TaskPool::takeTask(size_t workerIndex, Task& task) {
+    if (pendingTasks_ == 0) {
+        return false;
+    }
+
+    // Largest pending task of every group with queued tasks (few groups, so a flat list)
+    struct GroupHead {
+        TaskGroup* group;
+        uint64_t memoryCost;
+        bool admitted;
+    };
+    std::vector<GroupHead> groupHeads;
+    for (const std::vector<Lane>& queue : queues_) {
+        for (const Lane& lane : queue) {
+            if (!lane.group) {
+                continue;
+            }
+            const uint64_t cost = lane.tasks.front().memoryCost;
+            auto head = std::find_if(groupHeads.begin(), groupHeads.end(),
+                [&lane](const GroupHead& entry) { return entry.group == lane.group; });
+            if (head == groupHeads.end()) {
+                groupHeads.push_back({lane.group, cost, false});
+            } else {
+                head->memoryCost = std::max(head->memoryCost, cost);
+            }
+        }
+    }
+    for (GroupHead& head : groupHeads) {
+        head.admitted = head.group->admits(head.memoryCost);
+        heldBack_ = heldBack_ || !head.admitted;
+    }
+
+    // Largest admitted lane head; strict comparison keeps the own (first visited) queue on ties
+    std::vector<Lane>* bestQueue = nullptr;
+    size_t bestLane = 0;
+    for (size_t i = 0; i < queues_.size(); ++i) {
+        std::vector<Lane>& queue = queues_[(workerIndex + i) % queues_.size()];
+        for (size_t l = 0; l < queue.size(); ++l) {
+            const Lane& lane = queue[l];
+            if (lane.group) {
+                auto head = std::find_if(groupHeads.begin(), groupHeads.end(),
+                    [&lane](const GroupHead& entry) { return entry.group == lane.group; });
+                if (!head->admitted) {
+                    continue;
+                }
+            }
+            if (!bestQueue || lane.tasks.front().memoryCost > (*bestQueue)[bestLane].tasks.front().memoryCost) {
+                bestQueue = &queue;
+                bestLane = l;
+            }
+        }
+    }
+    if (!bestQueue) {
+        return false;
+    }
+
+    Lane& lane = (*bestQueue)[bestLane];
+    task = std::move(lane.tasks.front());
+    lane.tasks.pop_front();
+    if (lane.tasks.empty()) {
+        bestQueue->erase(bestQueue->begin() + static_cast<std::ptrdiff_t>(bestLane));
+    }
+    --pendingTasks_;
+    if (task.group) {
+        task.group->running_++;
+        task.group->memoryInUse_ += task.memoryCost;
+    }
+    return true;
+}
+
+/**
+ * @brief Worker thread main loop
+ * @param workerIndex Index of this worker (owner of queues_[workerIndex])
+ */
+void TaskPool::workerLoop(size_t workerIndex) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        Task task;
+        if (!takeTask(workerIndex, task)) {
+            if (stopping_ && pendingTasks_ == 0) {
+                return;
+            }
+            // Wait for new tasks or for a running task to release its admission
+            condition_.wait(lock);
+            continue;
+        }
+
+        lock.unlock();
+        try {
+            task.run();
+        } catch (...) {
+            // Tasks report their own errors; never let one take the worker down
+        }
+        task.run = nullptr;
+
+        if (task.group) {
+            lock.lock();
+            task.group->running_--;
+            task.group->memoryInUse_ -= task.memoryCost;
+            // Admission opened up: wake the workers only if one held tasks back
+            const bool wake = heldBack_;
+            heldBack_ = false;
+            lock.unlock();
+            if (wake) {
+                condition_.notify_all();
+            }
+            {
+                std::lock_guard<std::mutex> doneLock(task.group->doneMutex_);
+                task.group->unfinished_--;
+            }
+            task.group->doneCondition_.notify_all();
+            task.group.reset();
+        }
+        lock.lock();
+    }
+}
@@ -0,0 +1,18 @@
+#include "TextTokenizer.h"
+
+#include <cstdlib>
+#include <string>
+
+/**
+ * @brief Fallback for values std::from_chars reports as out of range
+ * @param first Start of the number
+ * @param last End of the number as reported by std::from_chars
+ * @param[out] value Clamped value (denormal/zero on underflow, +-HUGE_VAL on overflow)
+ * @return Pointer past the number
+ */
+const char* TextTokenizer::parseOutOfRange(const char* first, const char* last, double& value) {
+    // strtod needs a terminated string; out-of-range numbers are rare, so a copy is fine
+    const std::string number(first, last);
+    value = std::strtod(number.c_str(), nullptr);
+    return last;
+}
@@ -0,0 +1,791 @@
+#include "VTKBridge.h"
+#include "JobControl.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <vtkAlgorithm.h>
+#include <vtkAOSDataArrayTemplate.h>
+#include <vtkCallbackCommand.h>
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkCellType.h>
+#include <vtkDataSetAttributes.h>
+#include <vtkDoubleArray.h>
+#include <vtkFloatArray.h>
+#include <vtkIdList.h>
+#include <vtkIdTypeArray.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkTypeInt32Array.h>
+#include <vtkTypeInt64Array.h>
+#include <vtkUnsignedCharArray.h>
+
+namespace {
+
+// ------------------------------------------------------------------------------
+// Cell type helpers
+// ------------------------------------------------------------------------------
+
+/**
+ * @brief Expected point count of a cell type
+ * @param type Cell type
+ * @return Point count for fixed-size types, 0 for variable-size types (polygon, strip)
+ */
+size_t fixedCellSize(VtkCellType type) {
+    switch (type) {
+        case VtkCellType::VERTEX:     return 1;
+        case VtkCellType::LINE:       return 2;
+        case VtkCellType::TRIANGLE:   return 3;
+        case VtkCellType::QUAD:       return 4;
+        case VtkCellType::TETRA:      return 4;
+        case VtkCellType::HEXAHEDRON: return 8;
+        case VtkCellType::WEDGE:      return 6;
+        case VtkCellType::PYRAMID:    return 5;
+        default:                      return 0;
+    }
+}
+
+/**
+ * @brief Check whether a cell has a valid point count for its type
+ * @param type Cell type
+ * @param count Number of point indices
+ * @return Whether valid
+ */
+bool isValidCellSize(VtkCellType type, size_t count) {
+    const size_t expected = fixedCellSize(type);
+    return expected > 0 ? count == expected : count >= 3;
+}
+
+/**
+ * @brief Check whether a VTK cell type id exists unchanged in VtkCellType
+ * @param vtkType VTK cell type id
+ * @return Whether the type can be copied without remapping
+ */
+bool isDirectCellType(unsigned char vtkType) {
+    switch (vtkType) {
+        case VTK_VERTEX:
+        case VTK_LINE:
+        case VTK_TRIANGLE:
+        case VTK_TRIANGLE_STRIP:
+        case VTK_POLYGON:
+        case VTK_QUAD:
+        case VTK_TETRA:
+        case VTK_HEXAHEDRON:
+        case VTK_WEDGE:
+        case VTK_PYRAMID:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// ------------------------------------------------------------------------------
+// Ownership transfer of std::vector buffers to VTK arrays
+// ------------------------------------------------------------------------------
+
+/**
+ * @brief Keeps adopted MeshData buffers alive until the owning VTK array frees them
+ * VTK's free callback only receives the raw pointer, so owners are looked up by address.
+ */
+class SharedBufferRegistry {
+public:
+    static SharedBufferRegistry& instance() {
+        // Intentionally leaked: VTK arrays may be released during static destruction
+        static SharedBufferRegistry* registry = new SharedBufferRegistry();
+        return *registry;
+    }
+
+    void retain(void* buffer, std::shared_ptr<void> owner) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        owners_[buffer] = std::move(owner);
+    }
+
+    void release(void* buffer) {
+        std::shared_ptr<void> owner;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = owners_.find(buffer);
+            if (it == owners_.end()) {
+                return;
+            }
+            owner = std::move(it->second);
+            owners_.erase(it);
+        }
+        // Buffer is freed here, outside the lock
+    }
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<void*, std::shared_ptr<void>> owners_;
+};
+
+/**
+ * @brief Free callback registered on adopted VTK arrays
+ * @param buffer Array memory passed to SetArray()
+ */
+void releaseSharedBuffer(void* buffer) {
+    SharedBufferRegistry::instance().release(buffer);
+}
+
+/**
+ * @brief Create a VTK array that shares the memory of a std::vector
+ * @param values Source values (moved from when adopt is true)
+ * @param numComponents Number of components of the VTK array
+ * @param adopt true = VTK takes ownership, false = VTK borrows (save=1)
+ * @return VTK array referencing the vector memory
+ */
+template <typename ArrayT, typename T>
+vtkSmartPointer<ArrayT> makeSharedArray(std::vector<T>& values, int numComponents, bool adopt) {
+    using ValueType = typename ArrayT::ValueType;
+    static_assert(sizeof(ValueType) == sizeof(T), "Shared VTK array must match element size");
+
+    vtkSmartPointer<ArrayT> array = vtkSmartPointer<ArrayT>::New();
+    array->SetNumberOfComponents(numComponents);
+    if (values.empty()) {
+        return array;
+    }
+
+    const vtkIdType size = static_cast<vtkIdType>(values.size());
+    if (adopt) {
+        auto owner = std::make_shared<std::vector<T>>(std::move(values));
+        ValueType* buffer = reinterpret_cast<ValueType*>(owner->data());
+        SharedBufferRegistry::instance().retain(buffer, owner);
+        array->SetArray(buffer, size, 0, vtkAbstractArray::VTK_DATA_ARRAY_USER_DEFINED);
+        array->SetArrayFreeFunction(&releaseSharedBuffer);
+    } else {
+        array->SetArray(reinterpret_cast<ValueType*>(values.data()), size, 1);
+    }
+    return array;
+}
+
+/**
+ * @brief VTK array class with the same value type as an attribute element type
+ */
+template <typename T> struct AttributeArrayOf;
+template <> struct AttributeArrayOf<int32_t> { using type = vtkTypeInt32Array; };
+template <> struct AttributeArrayOf<int64_t> { using type = vtkTypeInt64Array; };
+template <> struct AttributeArrayOf<float> { using type = vtkFloatArray; };
+template <> struct AttributeArrayOf<double> { using type = vtkDoubleArray; };
+
+/**
+ * @brief VTK array class with the same layout as a CSR index type (vtkCellArray storage)
+ */
+template <typename Index> struct IndexArrayOf;
+template <> struct IndexArrayOf<uint32_t> { using type = vtkTypeInt32Array; };
+template <> struct IndexArrayOf<uint64_t> { using type = vtkTypeInt64Array; };
+
+/**
+ * @brief Get the VTK component count of an attribute
+ * @param attribute Attribute
+ * @param tupleCount Number of points or cells
+ * @return Component count (1 when the length does not fit the tuple count)
+ */
+int attributeComponents(const MeshAttribute& attribute, size_t tupleCount) {
+    return std::max(attribute.componentsFor(tupleCount), 1);
+}
+
+/**
+ * @brief Build a grid referencing MeshData buffers
+ * @param meshData Input mesh data (moved from when adopt is true)
+ * @param adopt Whether VTK takes ownership of the buffers
+ * @return vtkUnstructuredGrid pointer
+ */
+template <typename Real, typename Index>
+vtkSmartPointer<vtkUnstructuredGrid> buildSharedGrid(BasicMeshData<Real, Index>& meshData, bool adopt) {
+    vtkSmartPointer<vtkUnstructuredGrid> grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+    const size_t pointCount = meshData.points.size() / 3;
+    const size_t cellCount = meshData.cells.size();
+
+    // Points: float/double xyz is exactly a 3-component vtkFloatArray/vtkDoubleArray
+    vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+    points->SetData(makeSharedArray<typename AttributeArrayOf<Real>::type>(meshData.points, 3, adopt));
+    grid->SetPoints(points);
+
+    // Cells: VtkCellType ids equal VTK ids, CSR offsets/connectivity match vtkCellArray 32/64-bit storage
+    if (cellCount > 0) {
+        using IndexArray = typename IndexArrayOf<Index>::type;
+        typename BasicMeshData<Real, Index>::CellArray& cells = meshData.cells;
+        vtkSmartPointer<vtkUnsignedCharArray> types = makeSharedArray<vtkUnsignedCharArray>(cells.types, 1, adopt);
+        vtkSmartPointer<IndexArray> offsets = makeSharedArray<IndexArray>(cells.offsets, 1, adopt);
+        vtkSmartPointer<IndexArray> connectivity = makeSharedArray<IndexArray>(cells.connectivity, 1, adopt);
+
+        vtkSmartPointer<vtkCellArray> cellArray = vtkSmartPointer<vtkCellArray>::New();
+        cellArray->SetData(offsets, connectivity);
+        grid->SetCells(types, cellArray);
+    }
+
+    // Attributes: each element type maps to the VTK array of the same value type
+    auto shareAttribute = [adopt](vtkDataSetAttributes* target, const std::string& name,
+                                  MeshAttribute& attribute, size_t tupleCount) {
+        const int numComponents = attributeComponents(attribute, tupleCount);
+        attribute.visit([&](auto& values) {
+            using ArrayT = typename AttributeArrayOf<typename std::decay_t<decltype(values)>::value_type>::type;
+            vtkSmartPointer<ArrayT> array = makeSharedArray<ArrayT>(values, numComponents, adopt);
+            array->SetName(name.c_str());
+            target->AddArray(array);
+        });
+    };
+    for (auto& [name, attribute] : meshData.pointData) {
+        shareAttribute(grid->GetPointData(), name, attribute, pointCount);
+    }
+    for (auto& [name, attribute] : meshData.cellData) {
+        shareAttribute(grid->GetCellData(), name, attribute, cellCount);
+    }
+
+    return grid;
+}
+
+// ------------------------------------------------------------------------------
+// Bulk copies from VTK arrays
+// ------------------------------------------------------------------------------
+
+/**
+ * @brief Copy values of an AOS array of a known value type as Out (float or double)
+ * @param array Source array
+ * @param[out] out Destination (GetNumberOfValues() values)
+ * @return Whether the array had value type T
+ */
+template <typename T, typename Out>
+bool copyTypedValues(vtkDataArray* array, Out* out) {
+    auto* typed = vtkAOSDataArrayTemplate<T>::FastDownCast(array);
+    if (!typed) {
+        return false;
+    }
+    const vtkIdType count = typed->GetNumberOfValues();
+    if (count == 0) {
+        return true;
+    }
+    const T* src = typed->GetPointer(0);
+    if constexpr (std::is_same<T, Out>::value) {
+        std::memcpy(out, src, static_cast<size_t>(count) * sizeof(Out));
+    } else {
+        std::transform(src, src + count, out, [](T value) { return static_cast<Out>(value); });
+    }
+    return true;
+}
+
+/**
+ * @brief Copy all values of a data array as float or double (tuple-interleaved)
+ * @param array Source array
+ * @param[out] out Destination (tuples * components values)
+ */
+template <typename Out>
+void copyValues(vtkDataArray* array, Out* out) {
+    if (copyTypedValues<float>(array, out) ||
+        copyTypedValues<double>(array, out) ||
+        copyTypedValues<int>(array, out) ||
+        copyTypedValues<vtkIdType>(array, out) ||
+        copyTypedValues<unsigned char>(array, out)) {
+        return;
+    }
+
+    // Generic fallback for other array types
+    const vtkIdType numTuples = array->GetNumberOfTuples();
+    const int numComponents = array->GetNumberOfComponents();
+    for (vtkIdType j = 0; j < numTuples; ++j) {
+        for (int k = 0; k < numComponents; ++k) {
+            *out++ = static_cast<Out>(array->GetComponent(j, k));
+        }
+    }
+}
+
+/**
+ * @brief Copy an AOS array of a known value type into an attribute with element type S
+ * Equal value types are copied with one memcpy; smaller integer types are widened losslessly.
+ * @param array Source array
+ * @param[out] out Destination attribute
+ * @return Whether the array had value type T
+ */
+template <typename T, typename S>
+bool copyTypedAttribute(vtkDataArray* array, MeshAttribute& out) {
+    auto* typed = vtkAOSDataArrayTemplate<T>::FastDownCast(array);
+    if (!typed) {
+        return false;
+    }
+    std::vector<S> values(static_cast<size_t>(typed->GetNumberOfValues()));
+    if (!values.empty()) {
+        const T* src = typed->GetPointer(0);
+        constexpr bool sameLayout = std::is_same<T, S>::value ||
+            (std::is_integral<T>::value && std::is_integral<S>::value &&
+             std::is_signed<T>::value == std::is_signed<S>::value && sizeof(T) == sizeof(S));
+        if constexpr (sameLayout) {
+            std::memcpy(values.data(), src, values.size() * sizeof(S));
+        } else {
+            std::transform(src, src + values.size(), values.begin(), [](T value) { return static_cast<S>(value); });
+        }
+    }
+    out = MeshAttribute(std::move(values), typed->GetNumberOfComponents());
+    return true;
+}
+
+/**
+ * @brief Copy a data array into a typed attribute in its native precision
+ * @param array Source array
+ * @param[out] out Destination attribute
+ */
+void copyAttribute(vtkDataArray* array, MeshAttribute& out) {
+    if (copyTypedAttribute<float, float>(array, out) ||
+        copyTypedAttribute<double, double>(array, out) ||
+        copyTypedAttribute<vtkTypeInt32, int32_t>(array, out) ||
+        copyTypedAttribute<vtkTypeInt64, int64_t>(array, out) ||
+        copyTypedAttribute<vtkIdType, int64_t>(array, out) ||
+        copyTypedAttribute<long, int64_t>(array, out) ||
+        copyTypedAttribute<unsigned int, int64_t>(array, out) ||
+        copyTypedAttribute<unsigned char, int32_t>(array, out) ||
+        copyTypedAttribute<signed char, int32_t>(array, out) ||
+        copyTypedAttribute<char, int32_t>(array, out) ||
+        copyTypedAttribute<short, int32_t>(array, out) ||
+        copyTypedAttribute<unsigned short, int32_t>(array, out)) {
+        return;
+    }
+
+    // Generic fallback for other array types (non-AOS layouts, unsigned 64-bit)
+    const vtkIdType numTuples = array->GetNumberOfTuples();
+    const int numComponents = array->GetNumberOfComponents();
+    out = MeshAttribute(AttributeType::FLOAT64, numComponents, static_cast<size_t>(numTuples));
+    double* values = out.values<double>().data();
+    for (vtkIdType j = 0; j < numTuples; ++j) {
+        for (int k = 0; k < numComponents; ++k) {
+            *values++ = array->GetComponent(j, k);
+        }
+    }
+}
+
+/**
+ * @brief Copy all arrays of a point/cell attribute set
+ * @param attributes Source attributes
+ * @param prefix Name prefix for unnamed arrays
+ * @param[out] out Destination map
+ */
+void copyAttributes(vtkDataSetAttributes* attributes,
+                    const std::string& prefix,
+                    AttributeMap& out) {
+    if (!attributes) {
+        return;
+    }
+    const int numArrays = attributes->GetNumberOfArrays();
+    for (int i = 0; i < numArrays; ++i) {
+        vtkDataArray* array = attributes->GetArray(i);
+        if (!array) {
+            continue;
+        }
+        std::string arrayName = array->GetName() ? array->GetName() : "";
+        if (arrayName.empty()) {
+            arrayName = prefix + std::to_string(i);
+        }
+
+        copyAttribute(array, out[arrayName]);
+    }
+}
+
+/**
+ * @brief Bulk copy of cell arrays whose types all map directly to VtkCellType
+ * @param vtkTypes VTK cell type ids
+ * @param offsets VTK offsets (numCells + 1 values)
+ * @param connectivity VTK connectivity
+ * @param numCells Number of cells
+ * @param[out] cells Destination cell array
+ */
+template <typename OffsetT, typename ConnT, typename Index>
+void bulkCopyCells(const unsigned char* vtkTypes,
+                   const OffsetT* offsets,
+                   const ConnT* connectivity,
+                   size_t numCells,
+                   BasicCellArray<Index>& cells) {
+    cells.types.resize(numCells);
+    std::memcpy(cells.types.data(), vtkTypes, numCells);
+
+    cells.offsets.resize(numCells + 1);
+    std::transform(offsets, offsets + numCells + 1, cells.offsets.begin(),
+                   [](OffsetT value) { return static_cast<Index>(value); });
+
+    const size_t connectivitySize = static_cast<size_t>(offsets[numCells]);
+    cells.connectivity.resize(connectivitySize);
+    std::transform(connectivity, connectivity + connectivitySize, cells.connectivity.begin(),
+                   [](ConnT value) { return static_cast<Index>(value); });
+}
+
+/**
+ * @brief Copy cells of a grid into CSR form
+ * @param grid Source grid
+ * @param[out] cells Destination cell array
+ */
+template <typename Index>
+void copyCells(vtkUnstructuredGrid* grid, BasicCellArray<Index>& cells) {
+    const vtkIdType numCells = grid->GetNumberOfCells();
+    vtkCellArray* cellArray = grid->GetCells();
+    vtkUnsignedCharArray* typeArray = grid->GetCellTypesArray();
+    if (numCells == 0 || !cellArray || !typeArray) {
+        return;
+    }
+    const unsigned char* vtkTypes = typeArray->GetPointer(0);
+
+    // Fast path: every type maps 1:1, copy the raw CSR arrays
+    if (std::all_of(vtkTypes, vtkTypes + numCells, isDirectCellType)) {
+        vtkDataArray* offsetsArray = cellArray->GetOffsetsArray();
+        vtkDataArray* connectivityArray = cellArray->GetConnectivityArray();
+        auto* offsets64 = vtkTypeInt64Array::FastDownCast(offsetsArray);
+        auto* connectivity64 = vtkTypeInt64Array::FastDownCast(connectivityArray);
+        if (offsets64 && connectivity64) {
+            bulkCopyCells(vtkTypes, offsets64->GetPointer(0), connectivity64->GetPointer(0),
+                          static_cast<size_t>(numCells), cells);
+            return;
+        }
+        auto* offsets32 = vtkTypeInt32Array::FastDownCast(offsetsArray);
+        auto* connectivity32 = vtkTypeInt32Array::FastDownCast(connectivityArray);
+        if (offsets32 && connectivity32) {
+            bulkCopyCells(vtkTypes, offsets32->GetPointer(0), connectivity32->GetPointer(0),
+                          static_cast<size_t>(numCells), cells);
+            return;
+        }
+    }
+
+    // Slow path: remap legacy/derived types, skip unsupported ones
+    cells.clear();
+    cells.reserve(static_cast<size_t>(numCells), static_cast<size_t>(cellArray->GetNumberOfConnectivityIds()));
+    vtkSmartPointer<vtkIdList> scratch = vtkSmartPointer<vtkIdList>::New();
+    Index ids[8];
+    for (vtkIdType i = 0; i < numCells; ++i) {
+        vtkIdType npts = 0;
+        const vtkIdType* pts = nullptr;
+        cellArray->GetCellAtId(i, npts, pts, scratch);
+
+        const unsigned char vtkType = vtkTypes[i];
+        if (isDirectCellType(vtkType)) {
+            cells.types.push_back(static_cast<VtkCellType>(vtkType));
+            for (vtkIdType j = 0; j < npts; ++j) {
+                cells.connectivity.push_back(static_cast<Index>(pts[j]));
+            }
+            cells.offsets.push_back(static_cast<Index>(cells.connectivity.size()));
+        } else if (vtkType == VTK_PIXEL && npts == 4) {
+            // Pixel is axis-aligned quad with lexicographic point order
+            ids[0] = static_cast<Index>(pts[0]);
+            ids[1] = static_cast<Index>(pts[1]);
+            ids[2] = static_cast<Index>(pts[3]);
+            ids[3] = static_cast<Index>(pts[2]);
+            cells.addCell(VtkCellType::QUAD, ids, 4);
+        } else if (vtkType == VTK_VOXEL && npts == 8) {
+            // Voxel is axis-aligned hexahedron with lexicographic point order
+            const int order[8] = {0, 1, 3, 2, 4, 5, 7, 6};
+            for (int j = 0; j < 8; ++j) {
+                ids[j] = static_cast<Index>(pts[order[j]]);
+            }
+            cells.addCell(VtkCellType::HEXAHEDRON, ids, 8);
+        } else if (vtkType == VTK_POLY_LINE) {
+            // Store poly line as consecutive line segments
+            for (vtkIdType j = 0; j + 1 < npts; ++j) {
+                ids[0] = static_cast<Index>(pts[j]);
+                ids[1] = static_cast<Index>(pts[j + 1]);
+                cells.addCell(VtkCellType::LINE, ids, 2);
+            }
+        }
+        // Other types (quadratic, polyhedron, ...) are skipped
+    }
+}
+
+/**
+ * @brief Check whether MeshData buffers can be handed to VTK without copying
+ * @param meshData Input mesh data
+ * @return Whether zero-copy sharing is possible
+ */
+template <typename Real, typename Index>
+bool canShareMesh(const BasicMeshData<Real, Index>& meshData) {
+    using SignedIndex = std::make_signed_t<Index>;
+    const auto& cells = meshData.cells;
+    constexpr size_t maxIndex = static_cast<size_t>(std::numeric_limits<SignedIndex>::max());
+
+    if (meshData.points.size() % 3 != 0 || meshData.points.size() / 3 > maxIndex) {
+        return false;
+    }
+    if (cells.offsets.size() != cells.types.size() + 1 ||
+        cells.offsets.back() != cells.connectivity.size() ||
+        cells.connectivity.size() > maxIndex) {
+        return false;
+    }
+    for (size_t i = 0; i < cells.size(); ++i) {
+        if (!isValidCellSize(cells.types[i], cells.cellSize(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Real, typename Index>
+vtkSmartPointer<vtkUnstructuredGrid> copyMesh(const BasicMeshData<Real, Index>& meshData);
+
+/**
+ * @brief Wrap MeshData buffers as a vtkUnstructuredGrid without copying (borrowed)
+ * @param meshData Input mesh data
+ * @return vtkUnstructuredGrid pointer
+ */
+template <typename Real, typename Index>
+vtkSmartPointer<vtkUnstructuredGrid> wrapMesh(BasicMeshData<Real, Index>& meshData) {
+    if (!canShareMesh(meshData)) {
+        return copyMesh(meshData);
+    }
+    return buildSharedGrid(meshData, false);
+}
+
+/**
+ * @brief Move MeshData buffers into a vtkUnstructuredGrid without copying (owned by VTK)
+ * @param meshData Input mesh data (moved from)
+ * @return vtkUnstructuredGrid pointer
+ */
+template <typename Real, typename Index>
+vtkSmartPointer<vtkUnstructuredGrid> adoptMesh(BasicMeshData<Real, Index>&& meshData) {
+    vtkSmartPointer<vtkUnstructuredGrid> grid =
+        canShareMesh(meshData) ? buildSharedGrid(meshData, true) : copyMesh(meshData);
+    meshData.clear();
+    return grid;
+}
+
+/**
+ * @brief Copy MeshData into a new vtkUnstructuredGrid
+ * @param meshData Input mesh data
+ * @return vtkUnstructuredGrid pointer
+ */
+template <typename Real, typename Index>
+vtkSmartPointer<vtkUnstructuredGrid> copyMesh(const BasicMeshData<Real, Index>& meshData) {
+    vtkSmartPointer<vtkUnstructuredGrid> grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+
+    // Points (vtkFloatArray or vtkDoubleArray, matching the coordinate type)
+    const size_t pointCount = meshData.points.size() / 3;
+    using PointArray = typename AttributeArrayOf<Real>::type;
+    vtkSmartPointer<PointArray> coords = vtkSmartPointer<PointArray>::New();
+    coords->SetNumberOfComponents(3);
+    coords->SetNumberOfTuples(static_cast<vtkIdType>(pointCount));
+    if (pointCount > 0) {
+        std::memcpy(coords->GetPointer(0), meshData.points.data(), pointCount * 3 * sizeof(Real));
+    }
+    vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+    points->SetData(coords);
+    grid->SetPoints(points);
+
+    // Cells: walk the CSR arrays, skipping cells VTK cannot represent
+    const auto& cells = meshData.cells;
+    vtkSmartPointer<vtkUnsignedCharArray> cellTypes = vtkSmartPointer<vtkUnsignedCharArray>::New();
+    vtkSmartPointer<vtkIdTypeArray> offsets = vtkSmartPointer<vtkIdTypeArray>::New();
+    vtkSmartPointer<vtkIdTypeArray> connectivity = vtkSmartPointer<vtkIdTypeArray>::New();
+    cellTypes->Allocate(static_cast<vtkIdType>(cells.size()));
+    offsets->Allocate(static_cast<vtkIdType>(cells.size() + 1));
+    connectivity->Allocate(static_cast<vtkIdType>(cells.connectivitySize()));
+    offsets->InsertNextValue(0);
+
+    // Source index of every cell that was kept (cell data follows the cells)
+    std::vector<size_t> keptCells;
+    keptCells.reserve(cells.size());
+    for (size_t i = 0; i < cells.size(); ++i) {
+        const size_t count = cells.cellSize(i);
+        if (!isValidCellSize(cells.types[i], count)) {
+            continue;
+        }
+        const Index* ids = cells.cellPoints(i);
+        for (size_t j = 0; j < count; ++j) {
+            connectivity->InsertNextValue(static_cast<vtkIdType>(ids[j]));
+        }
+        offsets->InsertNextValue(connectivity->GetNumberOfValues());
+        cellTypes->InsertNextValue(static_cast<unsigned char>(cells.types[i]));
+        keptCells.push_back(i);
+    }
+
+    vtkSmartPointer<vtkCellArray> cellArray = vtkSmartPointer<vtkCellArray>::New();
+    cellArray->SetData(offsets, connectivity);
+    grid->SetCells(cellTypes, cellArray);
+
+    // Attributes: one memcpy per array into the VTK array of the same value type; when cells
+    // were skipped, cell data tuples are gathered through keptCells instead
+    auto copyAttribute = [](vtkDataSetAttributes* target, const std::string& name,
+                            const MeshAttribute& attribute, size_t tupleCount,
+                            const std::vector<size_t>* keptTuples) {
+        const int numComponents = attributeComponents(attribute, tupleCount);
+        if (keptTuples && attribute.componentsFor(tupleCount) == 0) {
+            keptTuples = nullptr;  // Not one tuple per source entity: copied as is
+        }
+        attribute.visit([&](const auto& values) {
+            using ArrayT = typename AttributeArrayOf<typename std::decay_t<decltype(values)>::value_type>::type;
+            const size_t width = static_cast<size_t>(numComponents);
+            vtkSmartPointer<ArrayT> array = vtkSmartPointer<ArrayT>::New();
+            array->SetName(name.c_str());
+            array->SetNumberOfComponents(numComponents);
+            array->SetNumberOfTuples(static_cast<vtkIdType>(keptTuples ? keptTuples->size() : values.size() / width));
+            if (keptTuples) {
+                auto* gathered = array->GetPointer(0);
+                for (size_t t = 0; t < keptTuples->size(); ++t) {
+                    std::copy_n(values.data() + (*keptTuples)[t] * width, width, gathered + t * width);
+                }
+            } else if (!values.empty()) {
+                std::memcpy(array->GetPointer(0), values.data(), values.size() * sizeof(values[0]));
+            }
+            target->AddArray(array);
+        });
+    };
+    for (const auto& [name, attribute] : meshData.pointData) {
+        copyAttribute(grid->GetPointData(), name, attribute, pointCount, nullptr);
+    }
+    const std::vector<size_t>* keptCellTuples = keptCells.size() < cells.size() ? &keptCells : nullptr;
+    for (const auto& [name, attribute] : meshData.cellData) {
+        copyAttribute(grid->GetCellData(), name, attribute, cells.size(), keptCellTuples);
+    }
+
+    return grid;
+}
+
+/**
+ * @brief Convert vtkUnstructuredGrid to MeshData using bulk array copies
+ * @param grid Input VTK unstructured grid
+ * @param[out] meshData Output mesh data
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @return Whether conversion is successful
+ */
+template <typename Real, typename Index>
+bool toMesh(vtkUnstructuredGrid* grid,
+            BasicMeshData<Real, Index>& meshData,
+            MeshErrorCode& errorCode,
+            std::string& errorMsg) {
+    if (!grid) {
+        errorCode = MeshErrorCode::PARAM_INVALID;
+        errorMsg = "Input VTK grid is null";
+        return false;
+    }
+
+    try {
+        meshData.clear();
+
+        // Points
+        vtkPoints* points = grid->GetPoints();
+        if (points && points->GetNumberOfPoints() > 0) {
+            meshData.points.resize(static_cast<size_t>(points->GetNumberOfPoints()) * 3);
+            copyValues(points->GetData(), meshData.points.data());
+        }
+
+        // Cells
+        copyCells(grid, meshData.cells);
+
+        // Attributes
+        copyAttributes(grid->GetPointData(), "PointArray_", meshData.pointData);
+        copyAttributes(grid->GetCellData(), "CellArray_", meshData.cellData);
+
+        meshData.calculateMetadata();
+
+        errorCode = MeshErrorCode::SUCCESS;
+        errorMsg = "";
+        return true;
+    } catch (const std::exception& e) {
+        errorCode = MeshErrorCode::FORMAT_UNSUPPORTED;
+        errorMsg = std::string("Error converting VTK to MeshData: ") + e.what();
+        return false;
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Check whether MeshData buffers can be handed to VTK without copying
+ * @param meshData Input mesh data
+ * @return Whether zero-copy sharing is possible
+ */
+bool VTKBridge::canShare(const MeshData& meshData) {
+    return canShareMesh(meshData);
+}
+
+bool VTKBridge::canShare(const MeshData64& meshData) {
+    return canShareMesh(meshData);
+}
+
+/**
+ * @brief Wrap MeshData buffers as a vtkUnstructuredGrid without copying (borrowed)
+ * @param meshData Input mesh data
+ * @return vtkUnstructuredGrid pointer
+ */
+vtkSmartPointer<vtkUnstructuredGrid> VTKBridge::wrap(MeshData& meshData) {
+    return wrapMesh(meshData);
+}
+
+vtkSmartPointer<vtkUnstructuredGrid> VTKBridge::wrap(MeshData64& meshData) {
+    return wrapMesh(meshData);
+}
+
+/**
+ * @brief Move MeshData buffers into a vtkUnstructuredGrid without copying (owned by VTK)
+ * @param meshData Input mesh data (moved from)
+ * @return vtkUnstructuredGrid pointer
+ */
+vtkSmartPointer<vtkUnstructuredGrid> VTKBridge::adopt(MeshData&& meshData) {
+    return adoptMesh(std::move(meshData));
+}
+
+vtkSmartPointer<vtkUnstructuredGrid> VTKBridge::adopt(MeshData64&& meshData) {
+    return adoptMesh(std::move(meshData));
+}
+
+/**
+ * @brief Copy MeshData into a new vtkUnstructuredGrid
+ * @param meshData Input mesh data
+ * @return vtkUnstructuredGrid pointer
+ */
+vtkSmartPointer<vtkUnstructuredGrid> VTKBridge::copy(const MeshData& meshData) {
+    return copyMesh(meshData);
+}
+
+vtkSmartPointer<vtkUnstructuredGrid> VTKBridge::copy(const MeshData64& meshData) {
+    return copyMesh(meshData);
+}
+
+/**
+ * @brief Convert vtkUnstructuredGrid to MeshData using bulk array copies
+ * @param grid Input VTK unstructured grid
+ * @param[out] meshData Output mesh data
+ * @param[out] errorCode Output error code
+ * @param[out] errorMsg Output error message (UTF-8)
+ * @return Whether conversion is successful
+ */
+bool VTKBridge::toMeshData(vtkUnstructuredGrid* grid,
+                           MeshData& meshData,
+                           MeshErrorCode& errorCode,
+                           std::string& errorMsg) {
+    return toMesh(grid, meshData, errorCode, errorMsg);
+}
+
+bool VTKBridge::toMeshData(vtkUnstructuredGrid* grid,
+                           MeshData64& meshData,
+                           MeshErrorCode& errorCode,
+                           std::string& errorMsg) {
+    return toMesh(grid, meshData, errorCode, errorMsg);
+}
+
+/**
+ * @brief Forward the progress events of a VTK algorithm to the job of the calling thread and
+ * abort its execution once the job is cancelled
+ * @param algorithm Algorithm about to be updated
+ */
+void VTKBridge::observeJob(vtkAlgorithm* algorithm) {
+    const JobControl::Context job = JobControl::context();
+    if (!job.job || !algorithm) {
+        return;
+    }
+    // The observer keeps its own copy of the context; VTK deletes it with the command
+    vtkNew<vtkCallbackCommand> callback;
+    callback->SetClientData(new JobControl::Context(job));
+    callback->SetClientDataDeleteCallback([](void* clientData) {
+        delete static_cast<JobControl::Context*>(clientData);
+    });
+    callback->SetCallback([](vtkObject* caller, unsigned long, void* clientData, void* callData) {
+        const JobControl::Context* context = static_cast<const JobControl::Context*>(clientData);
+        if (context->step && callData) {
+            context->step->setFraction(*static_cast<const double*>(callData));
+        }
+        if (context->job->isCancelled()) {
+            static_cast<vtkAlgorithm*>(caller)->SetAbortExecute(1);
+        }
+    });
+    algorithm->AddObserver(vtkCommand::ProgressEvent, callback);
+}
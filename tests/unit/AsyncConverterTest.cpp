@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+#include "AsyncConverter.h"
+#include "MeshWriter.h"
+
+#include <atomic>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+/**
+ * @brief 每个测试独占的临时目录与单线程任务池
+ */
+class AsyncConverterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        root_ = fs::temp_directory_path()
+            / (std::string("meshconv_async_") + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        fs::remove_all(root_);
+        fs::create_directories(root_);
+        options_.pool = &pool_;
+        options_.group = group_;
+    }
+
+    void TearDown() override {
+        group_->wait();
+        std::error_code ec;
+        fs::remove_all(root_, ec);
+    }
+
+    std::string file(const std::string& name) const { return (root_ / name).u8string(); }
+
+    /**
+     * @brief 占住唯一的工作线程，直到返回的promise被设置
+     */
+    std::shared_ptr<std::promise<void>> blockWorker() {
+        auto release = std::make_shared<std::promise<void>>();
+        std::shared_future<void> released = release->get_future().share();
+        auto started = std::make_shared<std::promise<void>>();
+        std::future<void> running = started->get_future();
+        AsyncConverter::submit<JobResult>([released, started](JobResult& result) {
+            started->set_value();
+            released.wait();
+            result.success = true;
+        }, 0, nullptr, options_);
+        running.wait();
+        return release;
+    }
+
+    fs::path root_;
+    TaskPool pool_{1};
+    std::shared_ptr<TaskPool::TaskGroup> group_ = std::make_shared<TaskPool::TaskGroup>();
+    AsyncOptions options_;
+};
+
+/**
+ * @brief 构造n×n个四边形（拆成三角形）的网格面
+ */
+std::shared_ptr<MeshData> triangleGrid(size_t n) {
+    auto mesh = std::make_shared<MeshData>();
+    for (size_t j = 0; j <= n; ++j) {
+        for (size_t i = 0; i <= n; ++i) {
+            mesh->points.insert(mesh->points.end(), {static_cast<float>(i) / 3.0f, static_cast<float>(j) / 7.0f,
+                                                     static_cast<float>((i * j) % 11)});
+        }
+    }
+    for (size_t j = 0; j < n; ++j) {
+        for (size_t i = 0; i < n; ++i) {
+            const uint32_t a = static_cast<uint32_t>(j * (n + 1) + i);
+            const uint32_t d = a + static_cast<uint32_t>(n + 1);
+            mesh->cells.addCell(VtkCellType::TRIANGLE, {a, a + 1, d + 1});
+            mesh->cells.addCell(VtkCellType::TRIANGLE, {a, d + 1, d});
+        }
+    }
+    mesh->calculateMetadata();
+    return mesh;
+}
+
+} // namespace
+
+/**
+ * @brief 测试排队中被取消的写出与转换任务以CANCELLED结束且不留下输出文件
+ */
+TEST_F(AsyncConverterTest, CancelWhileQueued) {
+    const std::string source = file("source.stl");
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+    std::string errorMsg;
+    ASSERT_TRUE(MeshWriter::writeSTL(*triangleGrid(4), source, FormatWriteOptions(), errorCode, errorMsg)) << errorMsg;
+
+    auto release = blockWorker();
+    std::atomic<int> callbacks{0};
+    auto onComplete = [&callbacks](const JobResult&) { callbacks.fetch_add(1); };
+    JobHandle<JobResult> write = AsyncConverter::write(triangleGrid(4), file("written.su2"), MeshFormat::SU2,
+                                                       FormatWriteOptions(), onComplete, options_);
+    JobHandle<JobResult> convert = AsyncConverter::convert(source, file("converted.obj"), MeshFormat::UNKNOWN,
+                                                           MeshFormat::OBJ, FormatWriteOptions(), onComplete, options_);
+    JobHandle<MeshReadResult<MeshData>> read = AsyncConverter::read<MeshData>(source, FormatReadOptions(), nullptr, options_);
+    write.cancel();
+    convert.cancel();
+    read.cancel();
+    EXPECT_FALSE(write.isReady());
+    release->set_value();
+
+    for (const JobResult* result : {&write.get(), &convert.get(), static_cast<const JobResult*>(&read.get())}) {
+        EXPECT_FALSE(result->success);
+        EXPECT_EQ(result->errorCode, MeshErrorCode::CANCELLED);
+    }
+    EXPECT_TRUE(read.get().mesh.isEmpty());
+    EXPECT_TRUE(write.isCancelled());
+    EXPECT_LT(write.progress(), 1.0);
+    group_->wait();
+    EXPECT_EQ(callbacks.load(), 2);
+    EXPECT_FALSE(fs::exists(fs::u8path(file("written.su2"))));
+    EXPECT_FALSE(fs::exists(fs::u8path(file("converted.obj"))));
+}
+
+/**
+ * @brief 测试写出过程中取消：要么在察觉取消前已完成，要么以CANCELLED结束并删除部分输出
+ */
+TEST_F(AsyncConverterTest, CancelWhileWritingRemovesPartialOutput) {
+    const std::string path = file("large.su2");
+    FormatWriteOptions writeOptions;
+    writeOptions.isBinary = false;
+    JobHandle<JobResult> job = AsyncConverter::write(triangleGrid(1500), path, MeshFormat::SU2, writeOptions, nullptr, options_);
+    while (!job.isReady() && job.progress() == 0.0) {
+        std::this_thread::yield();
+    }
+    job.cancel();
+
+    const JobResult& result = job.get();
+    if (result.success) {
+        EXPECT_TRUE(fs::exists(fs::u8path(path)));
+        EXPECT_EQ(job.progress(), 1.0);
+    } else {
+        EXPECT_EQ(result.errorCode, MeshErrorCode::CANCELLED);
+        EXPECT_FALSE(fs::exists(fs::u8path(path)));
+    }
+}
+
+/**
+ * @brief 测试读取与写出任务的进度单调不减，成功后为1
+ */
+TEST_F(AsyncConverterTest, ProgressIsMonotonic) {
+    const std::string path = file("progress.obj");
+    const std::shared_ptr<MeshData> mesh = triangleGrid(1200);
+
+    auto sampleUntilReady = [](const auto& job) {
+        std::vector<double> samples;
+        while (!job.isReady()) {
+            samples.push_back(job.progress());
+            std::this_thread::yield();
+        }
+        samples.push_back(job.progress());
+        return samples;
+    };
+    auto expectMonotonic = [](const std::vector<double>& samples) {
+        ASSERT_FALSE(samples.empty());
+        for (size_t i = 0; i < samples.size(); ++i) {
+            EXPECT_GE(samples[i], 0.0);
+            EXPECT_LE(samples[i], 1.0);
+            if (i > 0) {
+                EXPECT_GE(samples[i], samples[i - 1]) << "sample " << i;
+            }
+        }
+        EXPECT_EQ(samples.back(), 1.0);
+    };
+
+    JobHandle<JobResult> write = AsyncConverter::write(mesh, path, MeshFormat::OBJ, FormatWriteOptions(), nullptr, options_);
+    expectMonotonic(sampleUntilReady(write));
+    ASSERT_TRUE(write.get().success) << write.get().errorMsg;
+
+    FormatReadOptions readOptions;
+    readOptions.readThreads = 4;
+    JobHandle<MeshReadResult<MeshData>> read = AsyncConverter::read<MeshData>(path, readOptions, nullptr, options_);
+    expectMonotonic(sampleUntilReady(read));
+    ASSERT_TRUE(read.get().success) << read.get().errorMsg;
+    EXPECT_EQ(read.get().mesh.cells.size(), mesh->cells.size());
+}
+
+/**
+ * @brief 测试完成回调在成功、失败、异常与取消时都恰好调用一次，且收到的结果与future一致
+ */
+TEST_F(AsyncConverterTest, CallbackFiresExactlyOnce) {
+    constexpr size_t kJobs = 40;
+    std::vector<std::atomic<int>> calls(kJobs);
+    std::vector<MeshErrorCode> seen(kJobs, MeshErrorCode::SUCCESS);
+    std::vector<JobHandle<JobResult>> jobs;
+
+    auto release = blockWorker();
+    for (size_t i = 0; i < kJobs; ++i) {
+        auto onComplete = [&calls, &seen, i](const JobResult& result) {
+            calls[i].fetch_add(1);
+            seen[i] = result.errorCode;
+        };
+        switch (i % 4) {
+            case 0:  // 成功
+                jobs.push_back(AsyncConverter::submit<JobResult>([](JobResult& result) { result.success = true; },
+                                                                 0, onComplete, options_));
+                break;
+            case 1:  // 没有网格可写，参数错误
+                jobs.push_back(AsyncConverter::write(nullptr, file("none.su2"), MeshFormat::SU2,
+                                                     FormatWriteOptions(), onComplete, options_));
+                break;
+            case 2:  // 任务抛出异常
+                jobs.push_back(AsyncConverter::submit<JobResult>([](JobResult&) { throw std::runtime_error("boom"); },
+                                                                 0, onComplete, options_));
+                break;
+            default:  // 排队中被取消
+                jobs.push_back(AsyncConverter::submit<JobResult>([](JobResult& result) { result.success = true; },
+                                                                 0, onComplete, options_));
+                jobs.back().cancel();
+                break;
+        }
+    }
+    release->set_value();
+    group_->wait();
+
+    for (size_t i = 0; i < kJobs; ++i) {
+        SCOPED_TRACE(i);
+        EXPECT_EQ(calls[i].load(), 1);
+        ASSERT_TRUE(jobs[i].isReady());
+        EXPECT_EQ(seen[i], jobs[i].get().errorCode);
+        EXPECT_EQ(jobs[i].get().success, i % 4 == 0);
+    }
+    EXPECT_EQ(jobs[1].get().errorCode, MeshErrorCode::PARAM_INVALID);
+    EXPECT_EQ(jobs[2].get().errorCode, MeshErrorCode::READ_FAILED);
+    EXPECT_EQ(jobs[3].get().errorCode, MeshErrorCode::CANCELLED);
+}
@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+#include "ConversionManifest.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+/**
+ * @brief 在临时目录中模拟增量批量转换
+ */
+class ConversionManifestTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        root_ = fs::temp_directory_path()
+            / (std::string("meshconv_manifest_") + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        fs::remove_all(root_);
+        fs::create_directories(root_ / "src");
+        fs::create_directories(root_ / "dst");
+        manifestPath_ = ConversionManifest::defaultPath((root_ / "dst").u8string());
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        fs::remove_all(root_, ec);
+    }
+
+    static void writeText(const fs::path& path, const std::string& text) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << text;
+    }
+
+    std::string source(const std::string& name) const { return (root_ / "src" / name).u8string(); }
+    std::string output(const std::string& name) const { return (root_ / "dst" / (name + ".out")).u8string(); }
+
+    /**
+     * @brief 运行一次批量转换（加载清单、跳过未变化的文件、保存清单）
+     * @return 实际重新转换的源文件
+     */
+    std::vector<std::string> runBatch(const std::vector<std::string>& names, uint64_t settings) {
+        ConversionManifest manifest;
+        manifest.load(manifestPath_);
+        std::vector<std::string> converted;
+        for (const std::string& name : names) {
+            ConversionManifest::Entry current;
+            if (manifest.lookup(source(name), output(name), settings, current)) {
+                continue;
+            }
+            std::ifstream in(fs::u8path(source(name)), std::ios::binary);
+            std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            writeText(fs::u8path(output(name)), "converted:" + content);
+            manifest.record(source(name), current);
+            converted.push_back(name);
+        }
+        std::string errorMsg;
+        EXPECT_TRUE(manifest.save(errorMsg)) << errorMsg;
+        return converted;
+    }
+
+    fs::path root_;
+    std::string manifestPath_;
+};
+
+uint64_t defaultSettings() {
+    return ConversionManifest::settingsHash(MeshFormat::VTK_XML, FormatWriteOptions());
+}
+
+} // namespace
+
+/**
+ * @brief 测试第二次运行跳过未变化的文件
+ */
+TEST_F(ConversionManifestTest, SecondRunSkipsUnchangedFiles) {
+    writeText(source("a.stl"), "solid a");
+    writeText(source("b.stl"), "solid b");
+
+    EXPECT_EQ(runBatch({"a.stl", "b.stl"}, defaultSettings()).size(), 2u);
+    EXPECT_TRUE(runBatch({"a.stl", "b.stl"}, defaultSettings()).empty());
+
+    // 新增文件只转换新文件
+    writeText(source("c.stl"), "solid c");
+    const auto converted = runBatch({"a.stl", "b.stl", "c.stl"}, defaultSettings());
+    ASSERT_EQ(converted.size(), 1u);
+    EXPECT_EQ(converted[0], "c.stl");
+}
+
+/**
+ * @brief 测试仅修改时间变化（内容不变）时仍然跳过
+ */
+TEST_F(ConversionManifestTest, TouchWithoutContentChangeSkips) {
+    writeText(source("a.stl"), "solid a");
+    runBatch({"a.stl"}, defaultSettings());
+
+    const fs::path path = fs::u8path(source("a.stl"));
+    fs::last_write_time(path, fs::last_write_time(path) + std::chrono::hours(1));
+    EXPECT_TRUE(runBatch({"a.stl"}, defaultSettings()).empty());
+    // 新的修改时间已记入清单，再次运行同样跳过
+    EXPECT_TRUE(runBatch({"a.stl"}, defaultSettings()).empty());
+}
+
+/**
+ * @brief 测试内容变化（大小不变）时重新转换
+ */
+TEST_F(ConversionManifestTest, ChangedContentReconverts) {
+    writeText(source("a.stl"), "solid a");
+    runBatch({"a.stl"}, defaultSettings());
+
+    const fs::path path = fs::u8path(source("a.stl"));
+    const auto modified = fs::last_write_time(path);
+    writeText(path, "solid b");
+    fs::last_write_time(path, modified + std::chrono::seconds(1));
+    EXPECT_EQ(runBatch({"a.stl"}, defaultSettings()).size(), 1u);
+
+    std::ifstream in(fs::u8path(output("a.stl")));
+    std::string content;
+    std::getline(in, content);
+    EXPECT_EQ(content, "converted:solid b");
+}
+
+/**
+ * @brief 测试输出被删除或改动后重新转换
+ */
+TEST_F(ConversionManifestTest, MissingOrAlteredOutputReconverts) {
+    writeText(source("a.stl"), "solid a");
+    writeText(source("b.stl"), "solid b");
+    runBatch({"a.stl", "b.stl"}, defaultSettings());
+
+    fs::remove(fs::u8path(output("a.stl")));
+    writeText(fs::u8path(output("b.stl")), "truncated");
+    EXPECT_EQ(runBatch({"a.stl", "b.stl"}, defaultSettings()).size(), 2u);
+    EXPECT_TRUE(runBatch({"a.stl", "b.stl"}, defaultSettings()).empty());
+}
+
+/**
+ * @brief 测试转换设置变化使所有记录失效
+ */
+TEST_F(ConversionManifestTest, SettingsChangeInvalidatesEveryEntry) {
+    writeText(source("a.stl"), "solid a");
+    writeText(source("b.stl"), "solid b");
+    runBatch({"a.stl", "b.stl"}, defaultSettings());
+
+    FormatWriteOptions options;
+    options.precision += 2;
+    const uint64_t changed = ConversionManifest::settingsHash(MeshFormat::VTK_XML, options);
+    EXPECT_NE(changed, defaultSettings());
+    EXPECT_NE(ConversionManifest::settingsHash(MeshFormat::SU2, FormatWriteOptions()), defaultSettings());
+    EXPECT_NE(ConversionManifest::settingsHash(MeshFormat::VTK_XML, FormatWriteOptions(), FormatReadOptions(), 1),
+              defaultSettings());
+
+    EXPECT_EQ(runBatch({"a.stl", "b.stl"}, changed).size(), 2u);
+    EXPECT_TRUE(runBatch({"a.stl", "b.stl"}, changed).empty());
+}
+
+/**
+ * @brief 测试目录形式的输出（OpenFOAM算例）同样被记录并跳过
+ */
+TEST_F(ConversionManifestTest, DirectoryOutputIsRecorded) {
+    writeText(source("case.msh"), "mesh");
+    const fs::path caseDir = fs::u8path(output("case.msh"));
+    const uint64_t settings = ConversionManifest::settingsHash(MeshFormat::OPENFOAM, FormatWriteOptions());
+
+    auto convertCase = [&]() {
+        ConversionManifest manifest;
+        manifest.load(manifestPath_);
+        ConversionManifest::Entry current;
+        if (manifest.lookup(source("case.msh"), caseDir.u8string(), settings, current)) {
+            return false;
+        }
+        fs::create_directories(caseDir / "constant" / "polyMesh");
+        writeText(caseDir / "constant" / "polyMesh" / "points", "points");
+        writeText(caseDir / "constant" / "polyMesh" / "faces", "faces");
+        manifest.record(source("case.msh"), current);
+        EXPECT_EQ(manifest.size(), 1u);
+        std::string errorMsg;
+        EXPECT_TRUE(manifest.save(errorMsg)) << errorMsg;
+        return true;
+    };
+
+    EXPECT_TRUE(convertCase());
+    EXPECT_FALSE(convertCase());
+
+    // 删除算例中的文件后重新转换
+    fs::remove(caseDir / "constant" / "polyMesh" / "faces");
+    EXPECT_TRUE(convertCase());
+    EXPECT_FALSE(convertCase());
+}
+
+/**
+ * @brief 测试损坏或缺失的清单按空清单处理
+ */
+TEST_F(ConversionManifestTest, MalformedManifestIsEmpty) {
+    ConversionManifest missing;
+    missing.load(manifestPath_);
+    EXPECT_EQ(missing.size(), 0u);
+
+    writeText(fs::u8path(manifestPath_), "# meshconv manifest 1\nnot\ta\tvalid\tline\n");
+    ConversionManifest malformed;
+    malformed.load(manifestPath_);
+    EXPECT_EQ(malformed.size(), 0u);
+}
+
+/**
+ * @brief 测试分块哈希与内容相关且与线程数无关
+ */
+TEST(ConversionManifestHashTest, HashFileMatchesAcrossThreads) {
+    const fs::path path = fs::temp_directory_path() / "meshconv_manifest_hash.bin";
+    std::string content(40 * 1024 * 1024 + 123, '\0');
+    for (size_t i = 0; i < content.size(); ++i) {
+        content[i] = static_cast<char>((i * 2654435761u) >> 13);
+    }
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    uint64_t serial = 0, parallel = 0;
+    std::string errorMsg;
+    ASSERT_TRUE(ConversionManifest::hashFile(path.u8string(), serial, errorMsg, 1)) << errorMsg;
+    ASSERT_TRUE(ConversionManifest::hashFile(path.u8string(), parallel, errorMsg, 8)) << errorMsg;
+    EXPECT_EQ(serial, parallel);
+
+    EXPECT_EQ(ConversionManifest::hashBytes("abc", 3), ConversionManifest::hashBytes("abc", 3));
+    EXPECT_NE(ConversionManifest::hashBytes("abc", 3), ConversionManifest::hashBytes("abd", 3));
+    std::error_code ec;
+    fs::remove(path, ec);
+}
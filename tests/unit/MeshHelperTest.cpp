@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+#include "MeshHelper.h"
+#include "MeshReader.h"
+#include "MeshWriter.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+/**
+ * @brief 在临时目录中写出网格并比较头部扫描与完整读取的结果
+ */
+class MeshHelperTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        root_ = fs::temp_directory_path()
+            / (std::string("meshconv_helper_") + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        fs::remove_all(root_);
+        fs::create_directories(root_);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        fs::remove_all(root_, ec);
+    }
+
+    std::string file(const std::string& name) const { return (root_ / name).u8string(); }
+
+    /**
+     * @brief 扫描文件头，并检查计数与完整读取（readAuto）的结果一致
+     * @param path 文件路径
+     * @param format 期望识别出的格式
+     * @param[out] metadata 头部扫描得到的元数据
+     */
+    static void expectScanMatchesRead(const std::string& path, MeshFormat format, MeshMetadata& metadata) {
+        SCOPED_TRACE(path);
+        MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+        std::string errorMsg;
+        ASSERT_TRUE(MeshHelper::extractMetadata(path, metadata, errorCode, errorMsg)) << errorMsg;
+        EXPECT_EQ(metadata.format, format);
+
+        FormatReadOptions options;
+        options.openFoamPatches = false;
+        MeshData mesh;
+        ASSERT_TRUE(MeshReader::readAuto(path, mesh, errorCode, errorMsg, options)) << errorMsg;
+        ASSERT_TRUE(metadata.pointCountKnown);
+        ASSERT_TRUE(metadata.cellCountKnown);
+        EXPECT_EQ(metadata.pointCount, mesh.points.size() / 3);
+        EXPECT_EQ(metadata.cellCount, mesh.cells.size());
+        EXPECT_EQ(metadata.meshType, mesh.metadata.meshType);
+        // 按类型计数（若头部给出）与实际单元一致
+        for (const auto& [type, count] : metadata.cellTypeCount) {
+            EXPECT_EQ(count, static_cast<uint64_t>(std::count(mesh.cells.types.begin(), mesh.cells.types.end(), type)))
+                << "cell type " << static_cast<int>(type);
+        }
+    }
+
+    fs::path root_;
+};
+
+/**
+ * @brief 构造2×2×2六面体块，另加一个四面体、两个三角形和一条线
+ */
+MeshData volumeMesh(bool hexOnly) {
+    MeshData mesh;
+    for (int k = 0; k <= 2; ++k) {
+        for (int j = 0; j <= 2; ++j) {
+            for (int i = 0; i <= 2; ++i) {
+                mesh.points.insert(mesh.points.end(), {0.5f * static_cast<float>(i), 0.25f * static_cast<float>(j),
+                                                       static_cast<float>(k)});
+            }
+        }
+    }
+    auto id = [](int i, int j, int k) { return static_cast<uint32_t>((k * 3 + j) * 3 + i); };
+    for (int k = 0; k < 2; ++k) {
+        for (int j = 0; j < 2; ++j) {
+            for (int i = 0; i < 2; ++i) {
+                mesh.cells.addCell(VtkCellType::HEXAHEDRON,
+                                   {id(i, j, k), id(i + 1, j, k), id(i + 1, j + 1, k), id(i, j + 1, k),
+                                    id(i, j, k + 1), id(i + 1, j, k + 1), id(i + 1, j + 1, k + 1), id(i, j + 1, k + 1)});
+            }
+        }
+    }
+    if (!hexOnly) {
+        mesh.cells.addCell(VtkCellType::TETRA, {id(0, 0, 0), id(1, 0, 0), id(0, 1, 0), id(0, 0, 1)});
+        mesh.cells.addCell(VtkCellType::TRIANGLE, {id(0, 0, 2), id(1, 0, 2), id(1, 1, 2)});
+        mesh.cells.addCell(VtkCellType::TRIANGLE, {id(1, 1, 2), id(2, 1, 2), id(2, 2, 2)});
+        mesh.cells.addCell(VtkCellType::LINE, {id(0, 0, 0), id(2, 2, 2)});
+    }
+    mesh.calculateMetadata();
+    return mesh;
+}
+
+/**
+ * @brief 构造含三角形、四边形与五边形的表面网格
+ */
+MeshData surfaceMesh() {
+    MeshData mesh;
+    mesh.points = {0, 0, 0,  1, 0, 0,  1, 1, 0,  0, 1, 0,  0.5f, 1.5f, 0.25f,  2, 0, 0.5f,  2, 1, -0.5f};
+    mesh.cells.addCell(VtkCellType::TRIANGLE, {0, 1, 3});
+    mesh.cells.addCell(VtkCellType::QUAD, {1, 5, 6, 2});
+    mesh.cells.addCell(VtkCellType::POLYGON, {1, 2, 4, 3, 0});
+    mesh.calculateMetadata();
+    return mesh;
+}
+
+} // namespace
+
+/**
+ * @brief 测试表面格式（二进制STL、PLY、OFF）头部扫描的计数与完整读取一致
+ */
+TEST_F(MeshHelperTest, SurfaceHeaderCountsMatchFullRead) {
+    const MeshData surface = surfaceMesh();
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+    std::string errorMsg;
+    FormatWriteOptions binary;
+    FormatWriteOptions ascii;
+    ascii.isBinary = false;
+    MeshMetadata metadata;
+
+    ASSERT_TRUE(MeshWriter::writeSTL(surface, file("surface.stl"), binary, errorCode, errorMsg)) << errorMsg;
+    expectScanMatchesRead(file("surface.stl"), MeshFormat::STL_BINARY, metadata);
+    EXPECT_EQ(metadata.cellCount, 6u);
+
+    ASSERT_TRUE(MeshWriter::writePLY(surface, file("binary.ply"), binary, errorCode, errorMsg)) << errorMsg;
+    expectScanMatchesRead(file("binary.ply"), MeshFormat::PLY_BINARY, metadata);
+    EXPECT_EQ(metadata.cellCount, 3u);
+    ASSERT_TRUE(MeshWriter::writePLY(surface, file("ascii.ply"), ascii, errorCode, errorMsg)) << errorMsg;
+    expectScanMatchesRead(file("ascii.ply"), MeshFormat::PLY_ASCII, metadata);
+
+    ASSERT_TRUE(MeshWriter::writeOFF(surface, file("surface.off"), ascii, errorCode, errorMsg)) << errorMsg;
+    expectScanMatchesRead(file("surface.off"), MeshFormat::OFF, metadata);
+    EXPECT_EQ(metadata.pointCount, 7u);
+}
+
+/**
+ * @brief 测试体网格格式（SU2、Gmsh MSH2/MSH4、OpenFOAM、.mcb）头部扫描的计数与完整读取一致
+ */
+TEST_F(MeshHelperTest, VolumeHeaderCountsMatchFullRead) {
+    const MeshData mesh = volumeMesh(false);
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+    std::string errorMsg;
+    MeshMetadata metadata;
+
+    ASSERT_TRUE(MeshWriter::writeSU2(mesh, file("mesh.su2"), FormatWriteOptions(), errorCode, errorMsg)) << errorMsg;
+    expectScanMatchesRead(file("mesh.su2"), MeshFormat::SU2, metadata);
+    EXPECT_EQ(metadata.cellCount, 12u);
+
+    for (const bool binary : {false, true}) {
+        FormatWriteOptions options;
+        options.isBinary = binary;
+        const std::string suffix = binary ? "_bin.msh" : "_ascii.msh";
+        ASSERT_TRUE(MeshWriter::writeGmsh(mesh, file("v2" + suffix), false, options, errorCode, errorMsg)) << errorMsg;
+        expectScanMatchesRead(file("v2" + suffix), MeshFormat::GMSH_V2, metadata);
+        ASSERT_TRUE(MeshWriter::writeGmsh(mesh, file("v4" + suffix), true, options, errorCode, errorMsg)) << errorMsg;
+        expectScanMatchesRead(file("v4" + suffix), MeshFormat::GMSH_V4, metadata);
+    }
+
+    ASSERT_TRUE(MeshWriter::writeMeshCache(mesh, file("mesh.mcb"), FormatWriteOptions(), errorCode, errorMsg)) << errorMsg;
+    expectScanMatchesRead(file("mesh.mcb"), MeshFormat::MESH_CACHE, metadata);
+
+    // OpenFOAM只保存体单元
+    const MeshData hexes = volumeMesh(true);
+    ASSERT_TRUE(MeshWriter::writeOpenFOAM(hexes, file("case"), FormatWriteOptions(), errorCode, errorMsg)) << errorMsg;
+    expectScanMatchesRead(file("case"), MeshFormat::OPENFOAM, metadata);
+    EXPECT_EQ(metadata.cellCount, 8u);
+    EXPECT_EQ(metadata.pointCount, 27u);
+}
+
+/**
+ * @brief 测试原生VTK XML文件的头部计数与写出的网格一致
+ */
+TEST_F(MeshHelperTest, VtkXmlHeaderCounts) {
+    const MeshData mesh = volumeMesh(false);
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+    std::string errorMsg;
+    ASSERT_TRUE(MeshWriter::writeVTKXML(mesh, file("mesh.vtu"), FormatWriteOptions(), errorCode, errorMsg)) << errorMsg;
+
+    MeshMetadata metadata;
+    ASSERT_TRUE(MeshHelper::extractMetadata(file("mesh.vtu"), metadata, errorCode, errorMsg)) << errorMsg;
+    EXPECT_EQ(metadata.format, MeshFormat::VTK_XML);
+    ASSERT_TRUE(metadata.pointCountKnown);
+    ASSERT_TRUE(metadata.cellCountKnown);
+    EXPECT_EQ(metadata.pointCount, 27u);
+    EXPECT_EQ(metadata.cellCount, 12u);
+}
+
+/**
+ * @brief 测试没有头部计数的格式（OBJ、ASCII STL）不给出计数
+ */
+TEST_F(MeshHelperTest, HeaderlessFormatsLeaveCountsUnknown) {
+    const MeshData surface = surfaceMesh();
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+    std::string errorMsg;
+    FormatWriteOptions ascii;
+    ascii.isBinary = false;
+    ASSERT_TRUE(MeshWriter::writeOBJ(surface, file("surface.obj"), ascii, errorCode, errorMsg)) << errorMsg;
+    ASSERT_TRUE(MeshWriter::writeSTL(surface, file("ascii.stl"), ascii, errorCode, errorMsg)) << errorMsg;
+
+    for (const std::string& path : {file("surface.obj"), file("ascii.stl")}) {
+        MeshMetadata metadata;
+        ASSERT_TRUE(MeshHelper::extractMetadata(path, metadata, errorCode, errorMsg)) << errorMsg;
+        EXPECT_FALSE(metadata.pointCountKnown) << path;
+        EXPECT_FALSE(metadata.cellCountKnown) << path;
+        EXPECT_EQ(metadata.meshType, MeshType::SURFACE_MESH) << path;
+    }
+}
@@ -0,0 +1,382 @@
+#include <gtest/gtest.h>
+#include "MeshProcessor.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief 构造n×n个四边形的起伏网格面（可选每个四边形独立使用4个点）
+ * 点数据"height"等于点的z坐标，单元数据"id"等于四边形序号。
+ * @param n 每边的四边形数
+ * @param triangles 是否将每个四边形拆成两个三角形
+ * @param separateQuads 是否为每个四边形复制独立的点（用于焊接）
+ */
+MeshData wavyGrid(size_t n, bool triangles, bool separateQuads = false) {
+    MeshData mesh;
+    auto height = [n](size_t i, size_t j) {
+        return 0.05f * std::sin(static_cast<float>(i) * 0.31f) * std::cos(static_cast<float>(j) * 0.17f)
+            + 0.01f * static_cast<float>((i * 7 + j * 13) % 5) / static_cast<float>(n);
+    };
+    std::vector<float> heights;
+    auto addPoint = [&](size_t i, size_t j) {
+        const float z = height(i, j);
+        mesh.points.insert(mesh.points.end(), {static_cast<float>(i) / static_cast<float>(n),
+                                               static_cast<float>(j) / static_cast<float>(n), z});
+        heights.push_back(z);
+        return static_cast<uint32_t>(heights.size() - 1);
+    };
+    if (!separateQuads) {
+        for (size_t j = 0; j <= n; ++j) {
+            for (size_t i = 0; i <= n; ++i) {
+                addPoint(i, j);
+            }
+        }
+    }
+    std::vector<int32_t> ids;
+    for (size_t j = 0; j < n; ++j) {
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t a, b, c, d;
+            if (separateQuads) {
+                a = addPoint(i, j);
+                b = addPoint(i + 1, j);
+                c = addPoint(i + 1, j + 1);
+                d = addPoint(i, j + 1);
+            } else {
+                a = static_cast<uint32_t>(j * (n + 1) + i);
+                b = a + 1;
+                d = a + static_cast<uint32_t>(n + 1);
+                c = d + 1;
+            }
+            const int32_t id = static_cast<int32_t>(j * n + i);
+            if (triangles) {
+                mesh.cells.addCell(VtkCellType::TRIANGLE, {a, b, c});
+                mesh.cells.addCell(VtkCellType::TRIANGLE, {a, c, d});
+                ids.insert(ids.end(), {id, id});
+            } else {
+                mesh.cells.addCell(VtkCellType::QUAD, {a, b, c, d});
+                ids.push_back(id);
+            }
+        }
+    }
+    mesh.pointData["height"] = MeshAttribute(std::move(heights));
+    mesh.cellData["id"] = MeshAttribute(std::move(ids));
+    mesh.calculateMetadata();
+    return mesh;
+}
+
+/**
+ * @brief 逐位比较两个网格的点、单元与属性
+ */
+void expectIdentical(const MeshData& expected, const MeshData& actual) {
+    EXPECT_EQ(actual.points, expected.points);
+    EXPECT_EQ(actual.cells.types, expected.cells.types);
+    EXPECT_EQ(actual.cells.offsets, expected.cells.offsets);
+    EXPECT_EQ(actual.cells.connectivity, expected.cells.connectivity);
+    EXPECT_TRUE(actual.pointData == expected.pointData);
+    EXPECT_TRUE(actual.cellData == expected.cellData);
+}
+
+/**
+ * @brief 单元各点坐标（排序后，与点的编号无关）
+ */
+std::vector<std::array<float, 3>> cellCoordinates(const MeshData& mesh, size_t cell) {
+    std::vector<std::array<float, 3>> coordinates;
+    const uint32_t* points = mesh.cells.cellPoints(cell);
+    for (size_t k = 0; k < mesh.cells.cellSize(cell); ++k) {
+        const float* p = mesh.points.data() + static_cast<size_t>(points[k]) * 3;
+        coordinates.push_back({p[0], p[1], p[2]});
+    }
+    std::sort(coordinates.begin(), coordinates.end());
+    return coordinates;
+}
+
+} // namespace
+
+/**
+ * @brief 测试平滑在串行与8线程下结果逐位一致
+ */
+TEST(MeshProcessorTest, SmoothMatchesAcrossThreads) {
+    const MeshData mesh = wavyGrid(256, false);
+    for (MeshProcessor::SmoothingMethod method : {MeshProcessor::SmoothingMethod::LAPLACIAN,
+                                                  MeshProcessor::SmoothingMethod::TAUBIN}) {
+        MeshProcessor::SmoothingOptions options;
+        options.method = method;
+        options.iterations = 5;
+        MeshData serial, parallel;
+        MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+        std::string errorMsg;
+        options.threads = 1;
+        ASSERT_TRUE(MeshProcessor::smoothMesh(mesh, serial, options, errorCode, errorMsg)) << errorMsg;
+        options.threads = 8;
+        ASSERT_TRUE(MeshProcessor::smoothMesh(mesh, parallel, options, errorCode, errorMsg)) << errorMsg;
+        expectIdentical(serial, parallel);
+        EXPECT_NE(serial.points, mesh.points);
+    }
+}
+
+/**
+ * @brief 测试简化在串行与8线程下结果逐位一致（网格足够大，会分区并行抽取）
+ */
+TEST(MeshProcessorTest, SimplifyMatchesAcrossThreads) {
+    const MeshData mesh = wavyGrid(520, true);
+    ASSERT_GE(mesh.cells.size(), 2u * 256 * 1024);
+    MeshProcessor::SimplificationOptions options;
+    options.targetReduction = 0.75f;
+    MeshData serial, parallel;
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+    std::string errorMsg;
+    options.threads = 1;
+    ASSERT_TRUE(MeshProcessor::simplifyMesh(mesh, serial, options, errorCode, errorMsg)) << errorMsg;
+    options.threads = 8;
+    ASSERT_TRUE(MeshProcessor::simplifyMesh(mesh, parallel, options, errorCode, errorMsg)) << errorMsg;
+    expectIdentical(serial, parallel);
+    EXPECT_LE(serial.cells.size(), mesh.cells.size() / 4);
+}
+
+/**
+ * @brief 测试焊接在串行与8线程下结果逐位一致
+ */
+TEST(MeshProcessorTest, WeldMatchesAcrossThreads) {
+    const MeshData mesh = wavyGrid(200, false, true);
+    ASSERT_GE(mesh.points.size() / 3, 2u * 64 * 1024);
+    for (bool averageMerged : {false, true}) {
+        MeshProcessor::WeldOptions options;
+        options.averageMerged = averageMerged;
+        MeshData serial, parallel;
+        MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+        std::string errorMsg;
+        options.threads = 1;
+        ASSERT_TRUE(MeshProcessor::weldPoints(mesh, serial, options, errorCode, errorMsg)) << errorMsg;
+        options.threads = 8;
+        ASSERT_TRUE(MeshProcessor::weldPoints(mesh, parallel, options, errorCode, errorMsg)) << errorMsg;
+        expectIdentical(serial, parallel);
+        EXPECT_EQ(serial.points.size() / 3, 201u * 201u);
+        EXPECT_EQ(serial.cells.size(), mesh.cells.size());
+    }
+}
+
+/**
+ * @brief 测试重排在串行与8线程下结果逐位一致
+ */
+TEST(MeshProcessorTest, ReorderMatchesAcrossThreads) {
+    const MeshData mesh = wavyGrid(400, true);
+    ASSERT_GE(mesh.points.size() / 3, 2u * 64 * 1024);
+    for (MeshReorder curve : {MeshReorder::MORTON, MeshReorder::HILBERT}) {
+        MeshProcessor::ReorderOptions options;
+        options.curve = curve;
+        MeshData serial, parallel;
+        MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+        std::string errorMsg;
+        options.threads = 1;
+        ASSERT_TRUE(MeshProcessor::reorderMesh(mesh, serial, options, errorCode, errorMsg)) << errorMsg;
+        options.threads = 8;
+        ASSERT_TRUE(MeshProcessor::reorderMesh(mesh, parallel, options, errorCode, errorMsg)) << errorMsg;
+        expectIdentical(serial, parallel);
+    }
+}
+
+/**
+ * @brief 测试焊接合并完全重合的点，退化单元连同其单元数据一起删除
+ */
+TEST(MeshProcessorTest, WeldMergesDuplicatesAndDropsCollapsedCells) {
+    MeshData mesh;
+    mesh.points = {
+        0, 0, 0,  1, 0, 0,  0, 1, 0,  // 0 1 2
+        0, 0, 0,  1, 0, 0,            // 3 = 0，4 = 1
+        1, 1, 0,                      // 5
+    };
+    mesh.cells.addCell(VtkCellType::TRIANGLE, {0, 1, 2});
+    mesh.cells.addCell(VtkCellType::TRIANGLE, {0, 3, 2});      // 焊接后退化，删除
+    mesh.cells.addCell(VtkCellType::QUAD, {4, 5, 2, 3});       // 重映射为1 5 2 0
+    mesh.cells.addCell(VtkCellType::LINE, {1, 4});             // 焊接后退化，删除
+    mesh.cells.addCell(VtkCellType::QUAD, {0, 3, 1, 5});       // 丢失一个角点，收缩为三角形
+    mesh.pointData["index"] = MeshAttribute(std::vector<int32_t>{0, 1, 2, 3, 4, 5});
+    mesh.cellData["id"] = MeshAttribute(std::vector<int32_t>{10, 11, 12, 13, 14});
+    mesh.cellData["normal"] = MeshAttribute(std::vector<float>{0, 0, 1, 0, 0, 2, 0, 0, 3, 0, 0, 4, 0, 0, 5}, 3);
+    mesh.calculateMetadata();
+
+    MeshData welded;
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+    std::string errorMsg;
+    ASSERT_TRUE(MeshProcessor::weldPoints(mesh, welded, MeshProcessor::WeldOptions(), errorCode, errorMsg)) << errorMsg;
+
+    // 保留每组重合点中编号最小的点
+    EXPECT_EQ(welded.points, (std::vector<float>{0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 1, 0}));
+    EXPECT_EQ(welded.pointData.at("index").values<int32_t>(), (std::vector<int32_t>{0, 1, 2, 5}));
+
+    ASSERT_EQ(welded.cells.size(), 3u);
+    EXPECT_EQ(welded.cells.types, (std::vector<VtkCellType>{VtkCellType::TRIANGLE, VtkCellType::QUAD,
+                                                             VtkCellType::TRIANGLE}));
+    EXPECT_EQ(welded.cells.connectivity, (std::vector<uint32_t>{0, 1, 2, 1, 3, 2, 0, 0, 1, 3}));
+    EXPECT_EQ(welded.cellData.at("id").values<int32_t>(), (std::vector<int32_t>{10, 12, 14}));
+    EXPECT_EQ(welded.cellData.at("normal").components(), 3);
+    EXPECT_EQ(welded.cellData.at("normal").values<float>(), (std::vector<float>{0, 0, 1, 0, 0, 3, 0, 0, 5}));
+}
+
+/**
+ * @brief 测试重排后每个单元的点坐标不变，点数据与单元数据随实体移动
+ */
+TEST(MeshProcessorTest, ReorderKeepsGeometryAndAttributes) {
+    const MeshData mesh = wavyGrid(40, true);
+    for (MeshReorder curve : {MeshReorder::MORTON, MeshReorder::HILBERT}) {
+        MeshProcessor::ReorderOptions options;
+        options.curve = curve;
+        MeshData reordered;
+        MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+        std::string errorMsg;
+        ASSERT_TRUE(MeshProcessor::reorderMesh(mesh, reordered, options, errorCode, errorMsg)) << errorMsg;
+        ASSERT_EQ(reordered.points.size(), mesh.points.size());
+        ASSERT_EQ(reordered.cells.size(), mesh.cells.size());
+        EXPECT_NE(reordered.points, mesh.points);
+
+        // 点数据"height"始终等于点的z坐标
+        const std::vector<float>& heights = reordered.pointData.at("height").values<float>();
+        ASSERT_EQ(heights.size(), reordered.points.size() / 3);
+        for (size_t v = 0; v < heights.size(); ++v) {
+            EXPECT_EQ(heights[v], reordered.points[v * 3 + 2]) << "point " << v;
+        }
+
+        // 按单元数据"id"与三角形在四边形中的位置找回原单元，比较其点坐标
+        std::map<std::pair<int32_t, int>, size_t> sourceOf;
+        const std::vector<int32_t>& sourceIds = mesh.cellData.at("id").values<int32_t>();
+        for (size_t c = 0; c < mesh.cells.size(); ++c) {
+            sourceOf[{sourceIds[c], static_cast<int>(c % 2)}] = c;
+        }
+        const std::vector<int32_t>& ids = reordered.cellData.at("id").values<int32_t>();
+        ASSERT_EQ(ids.size(), reordered.cells.size());
+        for (size_t c = 0; c < reordered.cells.size(); ++c) {
+            const auto coordinates = cellCoordinates(reordered, c);
+            const bool first = coordinates == cellCoordinates(mesh, sourceOf.at({ids[c], 0}));
+            const bool second = coordinates == cellCoordinates(mesh, sourceOf.at({ids[c], 1}));
+            EXPECT_TRUE(first || second) << "cell " << c << " id " << ids[c];
+        }
+    }
+}
+
+/**
+ * @brief 测试简化达到目标三角形数，点数据插值、单元数据随源单元保留
+ */
+TEST(MeshProcessorTest, SimplifyReachesTargetAndCarriesAttributes) {
+    const MeshData mesh = wavyGrid(64, false);
+    const size_t triangles = mesh.cells.size() * 2;
+    for (bool preserveBoundary : {true, false}) {
+        MeshProcessor::SimplificationOptions options;
+        options.targetReduction = 0.8f;
+        options.preserveBoundary = preserveBoundary;
+        MeshData simplified;
+        MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+        std::string errorMsg;
+        ASSERT_TRUE(MeshProcessor::simplifyMesh(mesh, simplified, options, errorCode, errorMsg)) << errorMsg;
+
+        const size_t target = static_cast<size_t>(static_cast<double>(triangles) * (1.0 - options.targetReduction));
+        EXPECT_LE(simplified.cells.size(), target);
+        EXPECT_GE(simplified.cells.size() + 2, target);
+        for (VtkCellType type : simplified.cells.types) {
+            EXPECT_EQ(type, VtkCellType::TRIANGLE);
+        }
+
+        // 点数据随点插值：高度场光滑，插值结果与点的z坐标接近
+        const MeshAttribute& heights = simplified.pointData.at("height");
+        ASSERT_EQ(heights.type(), AttributeType::FLOAT32);
+        ASSERT_EQ(heights.tupleCount(), simplified.points.size() / 3);
+        for (size_t v = 0; v < heights.tupleCount(); ++v) {
+            EXPECT_NEAR(heights.values<float>()[v], simplified.points[v * 3 + 2], 0.01f) << "point " << v;
+        }
+
+        // 每个三角形保留其源四边形的编号
+        const MeshAttribute& ids = simplified.cellData.at("id");
+        ASSERT_EQ(ids.type(), AttributeType::INT32);
+        ASSERT_EQ(ids.tupleCount(), simplified.cells.size());
+        for (size_t c = 0; c < simplified.cells.size(); ++c) {
+            const int32_t id = ids.values<int32_t>()[c];
+            ASSERT_GE(id, 0);
+            ASSERT_LT(id, 64 * 64);
+            EXPECT_EQ(simplified.cells.cellSize(c), 3u);
+        }
+    }
+}
+
+/**
+ * @brief 测试2×2×2六面体块的表面提取：24个外表面四边形，法向朝外，单元数据取自所属六面体
+ */
+TEST(MeshProcessorTest, ExtractSurfaceOfHexBlock) {
+    MeshData block;
+    for (int k = 0; k <= 2; ++k) {
+        for (int j = 0; j <= 2; ++j) {
+            for (int i = 0; i <= 2; ++i) {
+                block.points.insert(block.points.end(), {static_cast<float>(i), static_cast<float>(j), static_cast<float>(k)});
+            }
+        }
+    }
+    auto id = [](int i, int j, int k) { return static_cast<uint32_t>((k * 3 + j) * 3 + i); };
+    std::vector<int32_t> hexIds;
+    std::vector<std::vector<uint32_t>> hexPoints;
+    for (int k = 0; k < 2; ++k) {
+        for (int j = 0; j < 2; ++j) {
+            for (int i = 0; i < 2; ++i) {
+                hexPoints.push_back({id(i, j, k), id(i + 1, j, k), id(i + 1, j + 1, k), id(i, j + 1, k),
+                                     id(i, j, k + 1), id(i + 1, j, k + 1), id(i + 1, j + 1, k + 1), id(i, j + 1, k + 1)});
+                block.cells.addCell(VtkCellType::HEXAHEDRON, hexPoints.back().data(), 8);
+                hexIds.push_back(static_cast<int32_t>(hexIds.size()));
+            }
+        }
+    }
+    block.cells.addCell(VtkCellType::LINE, {id(0, 0, 0), id(2, 2, 2)});  // 低维单元被忽略
+    hexIds.push_back(-1);
+    block.cellData["id"] = MeshAttribute(std::move(hexIds));
+    block.calculateMetadata();
+
+    MeshData surface;
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+    std::string errorMsg;
+    ASSERT_TRUE(MeshProcessor::extractSurfaceFromVolume(block, surface, true, errorCode, errorMsg)) << errorMsg;
+    ASSERT_EQ(surface.cells.size(), 24u);
+    EXPECT_EQ(surface.points.size() / 3, 26u);  // 中心点不在表面上
+    const std::vector<int32_t>& ids = surface.cellData.at("id").values<int32_t>();
+    ASSERT_EQ(ids.size(), 24u);
+
+    std::map<std::array<float, 3>, size_t> sourcePoint;
+    for (size_t p = 0; p < block.points.size() / 3; ++p) {
+        sourcePoint[{block.points[p * 3], block.points[p * 3 + 1], block.points[p * 3 + 2]}] = p;
+    }
+    for (size_t c = 0; c < surface.cells.size(); ++c) {
+        ASSERT_EQ(surface.cells.types[c], VtkCellType::QUAD);
+        const uint32_t* face = surface.cells.cellPoints(c);
+        std::array<std::array<float, 3>, 4> corners;
+        std::array<float, 3> centre = {0, 0, 0};
+        for (size_t k = 0; k < 4; ++k) {
+            for (size_t a = 0; a < 3; ++a) {
+                corners[k][a] = surface.points[static_cast<size_t>(face[k]) * 3 + a];
+                centre[a] += corners[k][a] / 4;
+            }
+        }
+        // 面的所有点都属于单元数据所指的六面体
+        ASSERT_GE(ids[c], 0);
+        ASSERT_LT(ids[c], 8);
+        const std::vector<uint32_t>& owner = hexPoints[static_cast<size_t>(ids[c])];
+        for (const auto& corner : corners) {
+            EXPECT_NE(std::find(owner.begin(), owner.end(), sourcePoint.at(corner)), owner.end()) << "face " << c;
+        }
+        // 对角线叉积给出的法向背离块中心(1,1,1)
+        std::array<float, 3> d0, d1;
+        for (size_t a = 0; a < 3; ++a) {
+            d0[a] = corners[2][a] - corners[0][a];
+            d1[a] = corners[3][a] - corners[1][a];
+        }
+        const std::array<float, 3> normal = {d0[1] * d1[2] - d0[2] * d1[1], d0[2] * d1[0] - d0[0] * d1[2],
+                                             d0[0] * d1[1] - d0[1] * d1[0]};
+        const float outward = normal[0] * (centre[0] - 1) + normal[1] * (centre[1] - 1) + normal[2] * (centre[2] - 1);
+        EXPECT_GT(outward, 0.0f) << "face " << c;
+    }
+
+    // 不只取边界时每个不同的面输出一次：3个方向×3层×4个
+    ASSERT_TRUE(MeshProcessor::extractSurfaceFromVolume(block, surface, false, errorCode, errorMsg)) << errorMsg;
+    EXPECT_EQ(surface.cells.size(), 36u);
+    EXPECT_EQ(surface.points.size() / 3, 27u);
+}
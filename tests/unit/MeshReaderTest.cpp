@@ -0,0 +1,665 @@
+#include <gtest/gtest.h>
+#include "MeshHelper.h"
+#include "MeshReader.h"
+#include "MeshWriter.h"
+#include "SurfaceCells.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+/**
+ * @brief 每个测试独占的临时目录
+ */
+class TempDirectory {
+public:
+    TempDirectory() {
+        path_ = fs::temp_directory_path()
+            / (std::string("meshconv_reader_") + ::testing::UnitTest::GetInstance()->current_test_info()->test_suite_name()
+               + "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        fs::remove_all(path_);
+        fs::create_directories(path_);
+    }
+    ~TempDirectory() {
+        std::error_code ec;
+        fs::remove_all(path_, ec);
+    }
+    std::string file(const std::string& name) const { return (path_ / name).u8string(); }
+
+private:
+    fs::path path_;
+};
+
+/**
+ * @brief 构造2×2×1六面体块加上四面体、三棱柱、金字塔、三角形、四边形、线和顶点的混合网格
+ * 坐标取二进制可精确表示的值，ASCII格式按默认精度写出后不损失精度。
+ */
+template<typename Mesh>
+Mesh mixedVolumeMesh() {
+    using Index = typename Mesh::IndexType;
+    Mesh mesh;
+    for (int k = 0; k < 2; ++k) {
+        for (int j = 0; j < 3; ++j) {
+            for (int i = 0; i < 3; ++i) {
+                mesh.points.push_back(static_cast<typename Mesh::RealType>(i * 0.5));
+                mesh.points.push_back(static_cast<typename Mesh::RealType>(j * 0.25));
+                mesh.points.push_back(static_cast<typename Mesh::RealType>(k * 1.0));
+            }
+        }
+    }
+    auto id = [](int i, int j, int k) { return static_cast<Index>((k * 3 + j) * 3 + i); };
+    for (int j = 0; j < 2; ++j) {
+        for (int i = 0; i < 2; ++i) {
+            mesh.cells.addCell(VtkCellType::HEXAHEDRON,
+                               {id(i, j, 0), id(i + 1, j, 0), id(i + 1, j + 1, 0), id(i, j + 1, 0),
+                                id(i, j, 1), id(i + 1, j, 1), id(i + 1, j + 1, 1), id(i, j + 1, 1)});
+        }
+    }
+    mesh.cells.addCell(VtkCellType::TETRA, {id(0, 0, 0), id(1, 0, 0), id(0, 1, 0), id(0, 0, 1)});
+    mesh.cells.addCell(VtkCellType::WEDGE, {id(0, 0, 0), id(1, 0, 0), id(0, 1, 0), id(0, 0, 1), id(1, 0, 1), id(0, 1, 1)});
+    mesh.cells.addCell(VtkCellType::PYRAMID, {id(0, 0, 0), id(1, 0, 0), id(1, 1, 0), id(0, 1, 0), id(0, 0, 1)});
+    mesh.cells.addCell(VtkCellType::TRIANGLE, {id(0, 0, 1), id(1, 0, 1), id(1, 1, 1)});
+    mesh.cells.addCell(VtkCellType::QUAD, {id(1, 1, 1), id(2, 1, 1), id(2, 2, 1), id(1, 2, 1)});
+    mesh.cells.addCell(VtkCellType::LINE, {id(0, 0, 0), id(2, 2, 1)});
+    mesh.cells.addCell(VtkCellType::VERTEX, {id(2, 0, 0)});
+    mesh.calculateMetadata();
+    return mesh;
+}
+
+template<typename Mesh>
+void expectSameGeometry(const Mesh& expected, const Mesh& actual) {
+    ASSERT_EQ(actual.points.size(), expected.points.size());
+    for (size_t i = 0; i < expected.points.size(); ++i) {
+        EXPECT_DOUBLE_EQ(static_cast<double>(actual.points[i]), static_cast<double>(expected.points[i])) << "coordinate " << i;
+    }
+    EXPECT_EQ(actual.cells.types, expected.cells.types);
+    EXPECT_EQ(actual.cells.offsets, expected.cells.offsets);
+    EXPECT_EQ(actual.cells.connectivity, expected.cells.connectivity);
+}
+
+template<typename Mesh>
+class MeshRoundTripTest : public ::testing::Test {};
+
+using MeshLayouts = ::testing::Types<MeshData, MeshData64>;
+TYPED_TEST_SUITE(MeshRoundTripTest, MeshLayouts);
+
+/**
+ * @brief 向量差与叉积（方向检查用）
+ */
+std::array<double, 3> sub(const std::array<double, 3>& a, const std::array<double, 3>& b) {
+    return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+}
+
+std::array<double, 3> cross(const std::array<double, 3>& a, const std::array<double, 3>& b) {
+    return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+}
+
+double dot(const std::array<double, 3>& a, const std::array<double, 3>& b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+template<typename Mesh>
+std::array<double, 3> pointOf(const Mesh& mesh, size_t index) {
+    return {static_cast<double>(mesh.points[index * 3]), static_cast<double>(mesh.points[index * 3 + 1]),
+            static_cast<double>(mesh.points[index * 3 + 2])};
+}
+
+/**
+ * @brief 以VTK点序计算单元在角点0处的有向体积（正值 = 右手定向）
+ */
+template<typename Mesh>
+double cornerVolume(const Mesh& mesh, size_t cell) {
+    const auto* ids = mesh.cells.cellPoints(cell);
+    const auto p0 = pointOf(mesh, ids[0]);
+    switch (mesh.cells.types[cell]) {
+        case VtkCellType::TETRA:
+            return dot(cross(sub(pointOf(mesh, ids[1]), p0), sub(pointOf(mesh, ids[2]), p0)), sub(pointOf(mesh, ids[3]), p0));
+        case VtkCellType::HEXAHEDRON:
+            return dot(cross(sub(pointOf(mesh, ids[1]), p0), sub(pointOf(mesh, ids[3]), p0)), sub(pointOf(mesh, ids[4]), p0));
+        default:
+            return 0.0;
+    }
+}
+
+template<typename Mesh>
+std::vector<std::vector<uint64_t>> sortedCellPoints(const Mesh& mesh) {
+    std::vector<std::vector<uint64_t>> cells;
+    for (size_t c = 0; c < mesh.cells.size(); ++c) {
+        std::vector<uint64_t> ids(mesh.cells.cellPoints(c), mesh.cells.cellPoints(c) + mesh.cells.cellSize(c));
+        std::sort(ids.begin(), ids.end());
+        cells.push_back(std::move(ids));
+    }
+    std::sort(cells.begin(), cells.end());
+    return cells;
+}
+
+} // namespace
+
+/**
+ * @brief 测试Gmsh MSH 2.2/4.1（ASCII与二进制）写出后读回的点与单元一致
+ */
+TYPED_TEST(MeshRoundTripTest, GmshAsciiAndBinary) {
+    TempDirectory dir;
+    const TypeParam mesh = mixedVolumeMesh<TypeParam>();
+    for (const bool version4 : {false, true}) {
+        for (const bool binary : {false, true}) {
+            SCOPED_TRACE(std::string(version4 ? "MSH4" : "MSH2") + (binary ? " binary" : " ASCII"));
+            const std::string path = dir.file(std::string("mesh") + (version4 ? "4" : "2") + (binary ? "b" : "a") + ".msh");
+            FormatWriteOptions options;
+            options.isBinary = binary;
+            MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+            std::string errorMsg;
+            ASSERT_TRUE(MeshWriter::writeGmsh(mesh, path, version4, options, errorCode, errorMsg)) << errorMsg;
+
+            for (const unsigned int threads : {1u, 4u}) {
+                FormatReadOptions readOptions;
+                readOptions.readThreads = threads;
+                TypeParam readBack;
+                ASSERT_TRUE(MeshReader::readGmsh(path, readBack, errorCode, errorMsg, readOptions)) << errorMsg;
+                expectSameGeometry(mesh, readBack);
+                EXPECT_EQ(readBack.metadata.formatVersion.rfind(version4 ? "4" : "2", 0), 0u)
+                    << readBack.metadata.formatVersion;
+            }
+        }
+    }
+}
+
+/**
+ * @brief 测试OpenFOAM写出后读回：六面体与四面体的点集不变、定向为正，边界面法向朝外
+ */
+TYPED_TEST(MeshRoundTripTest, OpenFoamOrientation) {
+    using Index = typename TypeParam::IndexType;
+    TempDirectory dir;
+    // 2×2×1六面体块，旁边是两个共享一个三角形面的四面体
+    TypeParam mesh;
+    auto addPoint = [&mesh](double x, double y, double z) {
+        mesh.points.insert(mesh.points.end(), {static_cast<typename TypeParam::RealType>(x),
+                                               static_cast<typename TypeParam::RealType>(y),
+                                               static_cast<typename TypeParam::RealType>(z)});
+        return static_cast<Index>(mesh.points.size() / 3 - 1);
+    };
+    for (int k = 0; k < 2; ++k) {
+        for (int j = 0; j < 3; ++j) {
+            for (int i = 0; i < 3; ++i) {
+                addPoint(i * 0.5, j * 0.5, k * 0.5);
+            }
+        }
+    }
+    auto id = [](int i, int j, int k) { return static_cast<Index>((k * 3 + j) * 3 + i); };
+    for (int j = 0; j < 2; ++j) {
+        for (int i = 0; i < 2; ++i) {
+            mesh.cells.addCell(VtkCellType::HEXAHEDRON,
+                               {id(i, j, 0), id(i + 1, j, 0), id(i + 1, j + 1, 0), id(i, j + 1, 0),
+                                id(i, j, 1), id(i + 1, j, 1), id(i + 1, j + 1, 1), id(i, j + 1, 1)});
+        }
+    }
+    const Index a = addPoint(1.5, 0.0, 0.0);
+    const Index b = addPoint(2.0, 0.0, 0.0);
+    const Index c = addPoint(1.5, 0.5, 0.0);
+    const Index d = addPoint(1.5, 0.0, 0.5);
+    const Index e = addPoint(2.0, 0.5, 0.5);
+    mesh.cells.addCell(VtkCellType::TETRA, {a, b, c, d});
+    mesh.cells.addCell(VtkCellType::TETRA, {b, c, d, e});
+    mesh.calculateMetadata();
+    for (size_t cell = 0; cell < mesh.cells.size(); ++cell) {
+        ASSERT_GT(cornerVolume(mesh, cell), 0.0);
+    }
+
+    for (const bool binary : {false, true}) {
+        SCOPED_TRACE(binary ? "binary" : "ASCII");
+        const std::string caseDir = dir.file(binary ? "binaryCase" : "asciiCase");
+        FormatWriteOptions options;
+        options.isBinary = binary;
+        MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+        std::string errorMsg;
+        ASSERT_TRUE(MeshWriter::writeOpenFOAM(mesh, caseDir, options, errorCode, errorMsg)) << errorMsg;
+
+        FormatReadOptions readOptions;
+        readOptions.openFoamPatches = false;
+        TypeParam volume;
+        ASSERT_TRUE(MeshReader::readOpenFOAM(caseDir, volume, errorCode, errorMsg, readOptions)) << errorMsg;
+        ASSERT_EQ(volume.points.size(), mesh.points.size());
+        for (size_t i = 0; i < mesh.points.size(); ++i) {
+            EXPECT_DOUBLE_EQ(static_cast<double>(volume.points[i]), static_cast<double>(mesh.points[i]));
+        }
+        ASSERT_EQ(volume.cells.size(), mesh.cells.size());
+        EXPECT_EQ(sortedCellPoints(volume), sortedCellPoints(mesh));
+        size_t hexCount = 0, tetCount = 0;
+        for (size_t c = 0; c < volume.cells.size(); ++c) {
+            hexCount += volume.cells.types[c] == VtkCellType::HEXAHEDRON;
+            tetCount += volume.cells.types[c] == VtkCellType::TETRA;
+            EXPECT_GT(cornerVolume(volume, c), 0.0) << "cell " << c;
+        }
+        EXPECT_EQ(hexCount, 4u);
+        EXPECT_EQ(tetCount, 2u);
+
+        // 边界面（多边形）的法向背离所属单元的中心
+        readOptions.openFoamPatches = true;
+        TypeParam withPatches;
+        ASSERT_TRUE(MeshReader::readOpenFOAM(caseDir, withPatches, errorCode, errorMsg, readOptions)) << errorMsg;
+        ASSERT_TRUE(withPatches.cellData.count("foam:patch"));
+        size_t boundaryFaces = 0;
+        for (size_t f = 0; f < withPatches.cells.size(); ++f) {
+            const VtkCellType type = withPatches.cells.types[f];
+            if (type == VtkCellType::HEXAHEDRON || type == VtkCellType::TETRA) {
+                continue;
+            }
+            ++boundaryFaces;
+            const auto* ids = withPatches.cells.cellPoints(f);
+            const size_t count = withPatches.cells.cellSize(f);
+            std::array<double, 3> centre{0.0, 0.0, 0.0};
+            std::array<double, 3> normal{0.0, 0.0, 0.0};
+            for (size_t k = 0; k < count; ++k) {
+                const auto a = pointOf(withPatches, ids[k]);
+                const auto b = pointOf(withPatches, ids[(k + 1) % count]);
+                const auto n = cross(a, b);
+                for (int d = 0; d < 3; ++d) {
+                    centre[d] += a[d] / static_cast<double>(count);
+                    normal[d] += n[d];
+                }
+            }
+            // 找到包含该面全部点的体单元
+            std::vector<uint64_t> facePoints(ids, ids + count);
+            std::sort(facePoints.begin(), facePoints.end());
+            bool owned = false;
+            for (size_t c = 0; c < volume.cells.size() && !owned; ++c) {
+                std::vector<uint64_t> cellPoints(volume.cells.cellPoints(c), volume.cells.cellPoints(c) + volume.cells.cellSize(c));
+                std::sort(cellPoints.begin(), cellPoints.end());
+                if (!std::includes(cellPoints.begin(), cellPoints.end(), facePoints.begin(), facePoints.end())) {
+                    continue;
+                }
+                owned = true;
+                std::array<double, 3> cellCentre{0.0, 0.0, 0.0};
+                for (uint64_t p : cellPoints) {
+                    const auto point = pointOf(volume, p);
+                    for (int d = 0; d < 3; ++d) {
+                        cellCentre[d] += point[d] / static_cast<double>(cellPoints.size());
+                    }
+                }
+                EXPECT_GT(dot(normal, sub(centre, cellCentre)), 0.0) << "boundary face " << f;
+            }
+            EXPECT_TRUE(owned) << "boundary face " << f;
+        }
+        // 六面体块外表面16个四边形，两个四面体外表面6个三角形
+        EXPECT_EQ(boundaryFaces, 22u);
+    }
+}
+
+/**
+ * @brief 测试.mcb缓存（未压缩与LZ4）写出后读回：几何、属性与元数据完全一致
+ */
+TYPED_TEST(MeshRoundTripTest, MeshCacheRawAndLz4) {
+    TempDirectory dir;
+    TypeParam mesh = mixedVolumeMesh<TypeParam>();
+    const size_t pointCount = mesh.points.size() / 3;
+    const size_t cellCount = mesh.cells.size();
+    std::vector<double> temperature;
+    std::vector<float> velocity;
+    for (size_t p = 0; p < pointCount; ++p) {
+        temperature.push_back(1.0 / 3.0 + static_cast<double>(p));
+        velocity.insert(velocity.end(), {static_cast<float>(p), 0.5f, -static_cast<float>(p)});
+    }
+    std::vector<int32_t> region;
+    std::vector<int64_t> globalId;
+    for (size_t c = 0; c < cellCount; ++c) {
+        region.push_back(static_cast<int32_t>(c % 3));
+        globalId.push_back(static_cast<int64_t>(c) + (int64_t(1) << 40));
+    }
+    mesh.pointData["temperature"] = MeshAttribute(std::move(temperature));
+    mesh.pointData["velocity"] = MeshAttribute(std::move(velocity), 3);
+    mesh.cellData["region"] = MeshAttribute(std::move(region));
+    mesh.cellData["globalId"] = MeshAttribute(std::move(globalId));
+
+    for (const bool compress : {false, true}) {
+        SCOPED_TRACE(compress ? "LZ4" : "raw");
+        const std::string path = dir.file(compress ? "mesh_lz4.mcb" : "mesh_raw.mcb");
+        FormatWriteOptions options;
+        options.compress = compress;
+        options.formatThreads = 4;
+        MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+        std::string errorMsg;
+        ASSERT_TRUE(MeshWriter::writeMeshCache(mesh, path, options, errorCode, errorMsg)) << errorMsg;
+
+        TypeParam readBack;
+        ASSERT_TRUE(MeshReader::readMeshCache(path, readBack, errorCode, errorMsg)) << errorMsg;
+        EXPECT_EQ(readBack.points, mesh.points);
+        EXPECT_EQ(readBack.cells.types, mesh.cells.types);
+        EXPECT_EQ(readBack.cells.offsets, mesh.cells.offsets);
+        EXPECT_EQ(readBack.cells.connectivity, mesh.cells.connectivity);
+        EXPECT_EQ(readBack.metadata.pointCount, mesh.metadata.pointCount);
+        EXPECT_EQ(readBack.metadata.cellCount, mesh.metadata.cellCount);
+
+        ASSERT_EQ(readBack.pointData.size(), 2u);
+        EXPECT_EQ(readBack.pointData.at("temperature").template values<double>(), mesh.pointData.at("temperature").template values<double>());
+        EXPECT_EQ(readBack.pointData.at("velocity").template values<float>(), mesh.pointData.at("velocity").template values<float>());
+        EXPECT_EQ(readBack.pointData.at("velocity").components(), 3);
+        ASSERT_EQ(readBack.cellData.size(), 2u);
+        EXPECT_EQ(readBack.cellData.at("region").template values<int32_t>(), mesh.cellData.at("region").template values<int32_t>());
+        EXPECT_EQ(readBack.cellData.at("globalId").template values<int64_t>(), mesh.cellData.at("globalId").template values<int64_t>());
+    }
+}
+
+namespace {
+
+void writeText(const std::string& path, const std::string& text) {
+    std::ofstream file(fs::u8path(path), std::ios::binary | std::ios::trunc);
+    file.write(text.data(), static_cast<std::streamsize>(text.size()));
+}
+
+/**
+ * @brief 构造n×n个四边形（拆成三角形）的网格面，坐标位数各不相同，使文本行长短不一
+ */
+template<typename Mesh>
+Mesh triangleGrid(size_t n) {
+    using Index = typename Mesh::IndexType;
+    using Real = typename Mesh::RealType;
+    Mesh mesh;
+    for (size_t j = 0; j <= n; ++j) {
+        for (size_t i = 0; i <= n; ++i) {
+            mesh.points.push_back(static_cast<Real>(i) * static_cast<Real>(0.125));
+            mesh.points.push_back(static_cast<Real>(j) * static_cast<Real>(0.375) - static_cast<Real>(100));
+            mesh.points.push_back(static_cast<Real>((i * j) % 7) * static_cast<Real>(1024.5));
+        }
+    }
+    for (size_t j = 0; j < n; ++j) {
+        for (size_t i = 0; i < n; ++i) {
+            const Index a = static_cast<Index>(j * (n + 1) + i);
+            const Index d = static_cast<Index>(a + n + 1);
+            mesh.cells.addCell(VtkCellType::TRIANGLE, {a, static_cast<Index>(a + 1), static_cast<Index>(d + 1)});
+            mesh.cells.addCell(VtkCellType::TRIANGLE, {a, static_cast<Index>(d + 1), d});
+        }
+    }
+    mesh.calculateMetadata();
+    return mesh;
+}
+
+/**
+ * @brief 各三角形的角点坐标（三角形内与三角形间均排序，与编号及点是否共享无关）
+ */
+std::vector<std::array<float, 9>> triangleCoordinates(const MeshData& mesh) {
+    std::vector<std::array<float, 9>> triangles;
+    forEachTriangle(mesh.cells, [&](uint32_t a, uint32_t b, uint32_t c) {
+        std::array<std::array<float, 3>, 3> corners;
+        const uint32_t indices[3] = {a, b, c};
+        for (size_t k = 0; k < 3; ++k) {
+            std::copy_n(mesh.points.begin() + static_cast<size_t>(indices[k]) * 3, 3, corners[k].begin());
+        }
+        std::sort(corners.begin(), corners.end());
+        std::array<float, 9> flat;
+        for (size_t k = 0; k < 3; ++k) {
+            std::copy(corners[k].begin(), corners[k].end(), flat.begin() + k * 3);
+        }
+        triangles.push_back(flat);
+    });
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+/**
+ * @brief 构造二进制STL文件内容（80字节头 + 三角形数 + 每个三角形50字节）
+ */
+std::string binaryStl(const std::string& header, const std::vector<std::array<float, 9>>& triangles) {
+    std::string data(84 + triangles.size() * 50, '\0');
+    std::memcpy(&data[0], header.data(), std::min<size_t>(header.size(), 80));
+    const uint32_t count = static_cast<uint32_t>(triangles.size());
+    std::memcpy(&data[80], &count, sizeof(count));
+    for (size_t t = 0; t < triangles.size(); ++t) {
+        std::memcpy(&data[84 + t * 50 + 12], triangles[t].data(), 36);
+    }
+    return data;
+}
+
+/**
+ * @brief 构造含三角形、四边形与五边形的表面网格
+ */
+MeshData polygonSurface() {
+    MeshData mesh;
+    mesh.points = {0, 0, 0,  1, 0, 0,  1, 1, 0,  0, 1, 0,  0.5f, 1.5f, 0.25f,  2, 0, 0.5f,  2, 1, -0.5f};
+    mesh.cells.addCell(VtkCellType::TRIANGLE, {0, 1, 3});
+    mesh.cells.addCell(VtkCellType::QUAD, {1, 5, 6, 2});
+    mesh.cells.addCell(VtkCellType::POLYGON, {1, 2, 4, 3, 0});
+    mesh.calculateMetadata();
+    return mesh;
+}
+
+} // namespace
+
+/**
+ * @brief 测试分块并行解析OBJ与串行结果一致（块边界落在行中间与超长行中）
+ */
+TEST(MeshReaderTest, ChunkParallelObjMatchesSerial) {
+    TempDirectory dir;
+    const MeshData grid = triangleGrid<MeshData>(700);
+    const size_t pointCount = grid.points.size() / 3;
+    std::string text = "# chunk-parallel test\nmtllib none.mtl\n";
+    char line[128];
+    size_t written = 0;
+    size_t cell = 0;
+    for (size_t p = 0; p < pointCount; ++p) {
+        std::snprintf(line, sizeof(line), "v %.9g %.9g %.9g\n", grid.points[p * 3], grid.points[p * 3 + 1], grid.points[p * 3 + 2]);
+        text += line;
+        if (p % 997 == 0) {
+            text += "vn 0 0 1\nvt 0.5 0.5\n";
+        }
+        // 面紧随其引用的点输出，v与f行交错
+        for (; cell < grid.cells.size() && grid.cells.cellPoints(cell)[1] <= p && grid.cells.cellPoints(cell)[2] <= p; ++cell) {
+            const uint32_t* c = grid.cells.cellPoints(cell);
+            if (cell % 3 == 0) {
+                std::snprintf(line, sizeof(line), "f %u/%u/1 %u/%u/1 %u/%u/1\n", c[0] + 1, c[0] + 1, c[1] + 1, c[1] + 1, c[2] + 1, c[2] + 1);
+            } else {
+                std::snprintf(line, sizeof(line), "f %u %u %u\n", c[0] + 1, c[1] + 1, c[2] + 1);
+            }
+            text += line;
+        }
+        if (p == pointCount / 2 && written == 0) {
+            // 比一个块还长的注释行
+            text += "# " + std::string(5 * 1024 * 1024, 'x') + "\n";
+            written = 1;
+        }
+    }
+    ASSERT_EQ(cell, grid.cells.size());
+    text += "l 1 2 3\n";
+    ASSERT_GT(text.size(), 16u * 1024 * 1024);
+    const std::string path = dir.file("grid.obj");
+    writeText(path, text);
+
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+    std::string errorMsg;
+    FormatReadOptions options;
+    options.readThreads = 1;
+    MeshData serial;
+    ASSERT_TRUE(MeshReader::readOBJ(path, serial, errorCode, errorMsg, options)) << errorMsg;
+    for (unsigned int threads : {2u, 3u, 8u}) {
+        SCOPED_TRACE(threads);
+        options.readThreads = threads;
+        MeshData parallel;
+        ASSERT_TRUE(MeshReader::readOBJ(path, parallel, errorCode, errorMsg, options)) << errorMsg;
+        expectSameGeometry(serial, parallel);
+    }
+    EXPECT_EQ(serial.points, grid.points);
+    EXPECT_EQ(serial.cells.size(), grid.cells.size() + 1);
+}
+
+/**
+ * @brief 测试分块并行解析SU2与Gmsh（MSH2/MSH4 ASCII）与串行结果一致
+ */
+TYPED_TEST(MeshRoundTripTest, ChunkParallelTextMatchesSerial) {
+    TempDirectory dir;
+    const TypeParam grid = triangleGrid<TypeParam>(800);
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+    std::string errorMsg;
+    FormatWriteOptions writeOptions;
+    writeOptions.isBinary = false;
+    writeOptions.precision = 9;
+    const std::string su2 = dir.file("grid.su2");
+    const std::string msh2 = dir.file("grid2.msh");
+    const std::string msh4 = dir.file("grid4.msh");
+    ASSERT_TRUE(MeshWriter::writeSU2(grid, su2, writeOptions, errorCode, errorMsg)) << errorMsg;
+    ASSERT_TRUE(MeshWriter::writeGmsh(grid, msh2, false, writeOptions, errorCode, errorMsg)) << errorMsg;
+    ASSERT_TRUE(MeshWriter::writeGmsh(grid, msh4, true, writeOptions, errorCode, errorMsg)) << errorMsg;
+    ASSERT_GT(fs::file_size(fs::u8path(su2)), 16u * 1024 * 1024);
+
+    for (const std::string& path : {su2, msh2, msh4}) {
+        SCOPED_TRACE(path);
+        const bool isSU2 = path == su2;
+        auto read = [&](unsigned int threads, TypeParam& mesh) {
+            FormatReadOptions options;
+            options.readThreads = threads;
+            return isSU2 ? MeshReader::readSU2(path, mesh, errorCode, errorMsg, options)
+                         : MeshReader::readGmsh(path, mesh, errorCode, errorMsg, options);
+        };
+        TypeParam serial;
+        ASSERT_TRUE(read(1, serial)) << errorMsg;
+        expectSameGeometry(grid, serial);
+        for (unsigned int threads : {3u, 8u}) {
+            SCOPED_TRACE(threads);
+            TypeParam parallel;
+            ASSERT_TRUE(read(threads, parallel)) << errorMsg;
+            expectSameGeometry(serial, parallel);
+            for (const auto& [name, data] : serial.cellData) {
+                EXPECT_TRUE(parallel.cellData.count(name) && parallel.cellData.at(name) == data) << name;
+            }
+        }
+    }
+}
+
+/**
+ * @brief 测试文件大小恰为84+50n时的二进制/ASCII STL判定
+ */
+TEST(MeshReaderTest, StlBinaryDetectionBySize) {
+    TempDirectory dir;
+    const std::vector<std::array<float, 9>> triangles = {
+        {0, 0, 0, 1, 0, 0, 0, 1, 0},
+        {1, 0, 0, 1, 1, 0, 0, 1, 0},
+        {0, 0, 0, 0, 1, 0, 0, 0, 1},
+    };
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+    std::string errorMsg;
+
+    // 二进制文件的80字节头以"solid"开头（许多导出器如此），按大小识别为二进制
+    const std::string binary = dir.file("solid_header.stl");
+    writeText(binary, binaryStl("solid exported by a CAD tool", triangles));
+    ASSERT_EQ(fs::file_size(fs::u8path(binary)), 84u + 50u * triangles.size());
+    EXPECT_EQ(MeshHelper::detectFormat(binary), MeshFormat::STL_BINARY);
+    EXPECT_EQ(MeshReader::detectFormatFromHeader(binary), MeshFormat::STL_BINARY);
+    MeshData mesh;
+    ASSERT_TRUE(MeshReader::readSTL(binary, mesh, errorCode, errorMsg)) << errorMsg;
+    EXPECT_EQ(mesh.cells.size(), 3u);
+    EXPECT_EQ(mesh.points.size(), 27u);
+    EXPECT_EQ(triangleCoordinates(mesh), triangleCoordinates([&]() {
+        MeshData expected;
+        for (const auto& triangle : triangles) {
+            const uint32_t first = static_cast<uint32_t>(expected.points.size() / 3);
+            expected.points.insert(expected.points.end(), triangle.begin(), triangle.end());
+            expected.cells.addCell(VtkCellType::TRIANGLE, {first, first + 1, first + 2});
+        }
+        return expected;
+    }()));
+
+    // 焊接后得到带索引的网格：5个不同的点
+    FormatReadOptions weld;
+    weld.stlWeldVertices = true;
+    ASSERT_TRUE(MeshReader::readSTL(binary, mesh, errorCode, errorMsg, weld)) << errorMsg;
+    EXPECT_EQ(mesh.cells.size(), 3u);
+    EXPECT_EQ(mesh.points.size(), 15u);
+
+    // ASCII文件补齐到84+50n字节：第80-83字节是文本，与三角形数不符，仍按ASCII读取
+    std::string ascii = "solid padded\n";
+    for (const auto& triangle : triangles) {
+        ascii += "facet normal 0 0 0\nouter loop\n";
+        for (size_t k = 0; k < 3; ++k) {
+            ascii += "vertex " + std::to_string(triangle[k * 3]) + " " + std::to_string(triangle[k * 3 + 1]) + " "
+                + std::to_string(triangle[k * 3 + 2]) + "\n";
+        }
+        ascii += "endloop\nendfacet\n";
+    }
+    ascii += "endsolid padded\n";
+    ascii.append(50 - (ascii.size() - 84) % 50, ' ');
+    const std::string asciiPath = dir.file("padded_ascii.stl");
+    writeText(asciiPath, ascii);
+    ASSERT_EQ((fs::file_size(fs::u8path(asciiPath)) - 84) % 50, 0u);
+    EXPECT_EQ(MeshHelper::detectFormat(asciiPath), MeshFormat::STL_ASCII);
+    EXPECT_EQ(MeshReader::detectFormatFromHeader(asciiPath), MeshFormat::STL_ASCII);
+    MeshData asciiMesh;
+    ASSERT_TRUE(MeshReader::readSTL(asciiPath, asciiMesh, errorCode, errorMsg)) << errorMsg;
+    EXPECT_EQ(triangleCoordinates(asciiMesh), triangleCoordinates(mesh));
+
+    MeshMetadata metadata;
+    ASSERT_TRUE(MeshHelper::extractMetadata(binary, metadata, errorCode, errorMsg)) << errorMsg;
+    EXPECT_EQ(metadata.formatVersion, "binary");
+    EXPECT_EQ(metadata.cellCount, 3u);
+    ASSERT_TRUE(MeshHelper::extractMetadata(asciiPath, metadata, errorCode, errorMsg)) << errorMsg;
+    EXPECT_EQ(metadata.formatVersion, "ascii");
+    EXPECT_FALSE(metadata.cellCountKnown);
+}
+
+/**
+ * @brief 测试原生STL/OBJ/PLY/OFF写出器（二进制与ASCII）的输出可以读回
+ */
+TEST(MeshReaderTest, NativeSurfaceWritersReadBack) {
+    TempDirectory dir;
+    const MeshData mesh = polygonSurface();
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+    std::string errorMsg;
+    for (const bool binary : {true, false}) {
+        SCOPED_TRACE(binary ? "binary" : "ascii");
+        FormatWriteOptions options;
+        options.isBinary = binary;
+        const std::string suffix = binary ? "_bin" : "_ascii";
+
+        // STL只存三角形：多边形按扇形三角化
+        const std::string stl = dir.file("surface" + suffix + ".stl");
+        ASSERT_TRUE(MeshWriter::writeSTL(mesh, stl, options, errorCode, errorMsg)) << errorMsg;
+        MeshData stlMesh;
+        ASSERT_TRUE(MeshReader::readSTL(stl, stlMesh, errorCode, errorMsg)) << errorMsg;
+        EXPECT_EQ(stlMesh.cells.size(), 6u);
+        EXPECT_EQ(triangleCoordinates(stlMesh), triangleCoordinates(mesh));
+
+        // PLY保留多边形
+        const std::string ply = dir.file("surface" + suffix + ".ply");
+        ASSERT_TRUE(MeshWriter::writePLY(mesh, ply, options, errorCode, errorMsg)) << errorMsg;
+        MeshData plyMesh;
+        ASSERT_TRUE(MeshReader::readPLY(ply, plyMesh, errorCode, errorMsg)) << errorMsg;
+        expectSameGeometry(mesh, plyMesh);
+    }
+
+    // OBJ与OFF只有ASCII形式
+    const std::string obj = dir.file("surface.obj");
+    ASSERT_TRUE(MeshWriter::writeOBJ(mesh, obj, FormatWriteOptions(), errorCode, errorMsg)) << errorMsg;
+    MeshData objMesh;
+    ASSERT_TRUE(MeshReader::readOBJ(obj, objMesh, errorCode, errorMsg)) << errorMsg;
+    expectSameGeometry(mesh, objMesh);
+
+    const std::string off = dir.file("surface.off");
+    ASSERT_TRUE(MeshWriter::writeOFF(mesh, off, FormatWriteOptions(), errorCode, errorMsg)) << errorMsg;
+    MeshData offMesh;
+    ASSERT_TRUE(MeshReader::readOFF(off, offMesh, errorCode, errorMsg)) << errorMsg;
+    expectSameGeometry(mesh, offMesh);
+}
+
+/**
+ * @brief 测试原生SU2写出器的输出可以读回（所有单元类型，不同精度）
+ */
+TYPED_TEST(MeshRoundTripTest, NativeSu2WriterReadBack) {
+    TempDirectory dir;
+    const TypeParam mesh = mixedVolumeMesh<TypeParam>();
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+    std::string errorMsg;
+    for (unsigned int threads : {1u, 4u}) {
+        FormatWriteOptions options;
+        options.formatThreads = threads;
+        const std::string path = dir.file("mesh" + std::to_string(threads) + ".su2");
+        ASSERT_TRUE(MeshWriter::writeSU2(mesh, path, options, errorCode, errorMsg)) << errorMsg;
+        TypeParam readBack;
+        ASSERT_TRUE(MeshReader::readSU2(path, readBack, errorCode, errorMsg)) << errorMsg;
+        expectSameGeometry(mesh, readBack);
+    }
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include "MeshStream.h"
+#include "MeshReader.h"
+#include "MeshWriter.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+/**
+ * @brief 构造包含所有单元类型的混合网格（多边形与三角带夹在其他单元之间）
+ */
+MeshData mixedCellMesh() {
+    MeshData mesh;
+    for (int i = 0; i < 12; ++i) {
+        mesh.points.push_back(0.25f * static_cast<float>(i % 3));
+        mesh.points.push_back(0.5f * static_cast<float>((i / 3) % 2));
+        mesh.points.push_back(1.0f * static_cast<float>(i / 6));
+    }
+    mesh.cells.addCell(VtkCellType::TETRA, {0, 1, 3, 6});
+    mesh.cells.addCell(VtkCellType::POLYGON, {0, 1, 2, 5, 4});
+    mesh.cells.addCell(VtkCellType::HEXAHEDRON, {0, 1, 4, 3, 6, 7, 10, 9});
+    mesh.cells.addCell(VtkCellType::TRIANGLE_STRIP, {6, 7, 9, 10, 11});
+    mesh.cells.addCell(VtkCellType::VERTEX, {8});
+    mesh.cells.addCell(VtkCellType::LINE, {2, 8});
+    mesh.cells.addCell(VtkCellType::TRIANGLE, {1, 2, 5});
+    mesh.cells.addCell(VtkCellType::QUAD, {6, 7, 10, 9});
+    mesh.cells.addCell(VtkCellType::WEDGE, {0, 1, 3, 6, 7, 9});
+    mesh.cells.addCell(VtkCellType::PYRAMID, {0, 1, 4, 3, 8});
+    mesh.calculateMetadata();
+    return mesh;
+}
+
+/**
+ * @brief 读取文本文件的各行（去掉行尾空白，流式写出器的计数字段以空格补齐）
+ */
+std::vector<std::string> readLines(const fs::path& path) {
+    std::ifstream file(path);
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(file, line)) {
+        line.erase(line.find_last_not_of(" \r") + 1);
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+/**
+ * @brief 将网格分成两个块流式写出
+ */
+bool streamMesh(const MeshData& mesh, const fs::path& path, MeshFormat format) {
+    MeshStreamInfo info;
+    info.format = MeshFormat::SU2;
+    info.meshType = MeshType::VOLUME_MESH;
+    info.pointCount = mesh.points.size() / 3;
+    info.cellCount = mesh.cells.size();
+    info.pointCountKnown = true;
+    info.cellCountKnown = true;
+
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+    std::string errorMsg;
+    auto writer = MeshStreamWriter::create(path.u8string(), format, FormatWriteOptions(), info,
+                                           MeshStreamOptions(), errorCode, errorMsg);
+    if (!writer) {
+        ADD_FAILURE() << errorMsg;
+        return false;
+    }
+
+    const size_t pointSplit = 5;
+    const size_t cellSplit = 4;
+    MeshBlock first;
+    first.points.assign(mesh.points.begin(), mesh.points.begin() + pointSplit * 3);
+    MeshBlock second;
+    second.firstPoint = pointSplit;
+    second.firstCell = cellSplit;
+    second.points.assign(mesh.points.begin() + pointSplit * 3, mesh.points.end());
+    for (size_t i = 0; i < mesh.cells.size(); ++i) {
+        MeshBlock& block = i < cellSplit ? first : second;
+        block.cells.addCell(mesh.cells.types[i], mesh.cells.cellPoints(i), mesh.cells.cellSize(i));
+    }
+
+    const bool success = writer->writeBlock(first, errorCode, errorMsg)
+        && writer->writeBlock(second, errorCode, errorMsg)
+        && writer->finish(errorCode, errorMsg);
+    EXPECT_TRUE(success) << errorMsg;
+    return success;
+}
+
+} // namespace
+
+/**
+ * @brief 测试SU2流式写出与内存写出的结果一致（多边形与三角带原位三角化，单元顺序不变）
+ */
+TEST(MeshStreamTest, SU2StreamMatchesInMemoryWriter) {
+    const fs::path dir = fs::temp_directory_path() / "meshconv_stream_su2";
+    fs::create_directories(dir);
+    const MeshData mesh = mixedCellMesh();
+    MeshData64 mesh64;
+    convertMeshData(mesh, mesh64);
+
+    MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+    std::string errorMsg;
+    ASSERT_TRUE(MeshWriter::writeSU2(mesh, (dir / "memory.su2").u8string(), FormatWriteOptions(), errorCode, errorMsg))
+        << errorMsg;
+    ASSERT_TRUE(MeshWriter::writeSU2(mesh64, (dir / "memory64.su2").u8string(), FormatWriteOptions(), errorCode, errorMsg))
+        << errorMsg;
+    ASSERT_TRUE(streamMesh(mesh, dir / "stream.su2", MeshFormat::SU2));
+
+    const std::vector<std::string> memory = readLines(dir / "memory.su2");
+    EXPECT_EQ(readLines(dir / "stream.su2"), memory);
+    EXPECT_EQ(readLines(dir / "memory64.su2"), memory);
+
+    // 五边形拆成3个三角形，5点三角带拆成3个三角形，紧随前一单元输出
+    const std::vector<std::string> expectedElements = {
+        "NELEM= 14",
+        "10 0 1 3 6 0",
+        "5 0 1 2 0", "5 0 2 5 0", "5 0 5 4 0",
+        "12 0 1 4 3 6 7 10 9 0",
+        "5 6 7 9 0", "5 7 10 9 0", "5 9 10 11 0",
+        "1 8 0",
+        "3 2 8 0",
+        "5 1 2 5 0",
+        "9 6 7 10 9 0",
+        "13 0 1 3 6 7 9 0",
+        "14 0 1 4 3 8 0",
+    };
+    auto nelem = std::find(memory.begin(), memory.end(), "NELEM= 14");
+    ASSERT_NE(nelem, memory.end());
+    ASSERT_GE(static_cast<size_t>(memory.end() - nelem), expectedElements.size());
+    EXPECT_EQ(std::vector<std::string>(nelem, nelem + expectedElements.size()), expectedElements);
+
+    // 读回后单元数与三角化后的单元数一致
+    MeshData readBack;
+    ASSERT_TRUE(MeshReader::readSU2((dir / "stream.su2").u8string(), readBack, errorCode, errorMsg)) << errorMsg;
+    EXPECT_EQ(readBack.cells.size(), 14u);
+    EXPECT_EQ(readBack.points.size(), mesh.points.size());
+
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+}
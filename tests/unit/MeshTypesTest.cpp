@@ -67,3 +67,105 @@ TEST(MeshTypesTest, AttributeData) {
     EXPECT_EQ(meshData.metadata.pointDataNames.size(), 2);
     EXPECT_EQ(meshData.metadata.cellDataNames.size(), 1);
 }
+
+/**
+ * @brief 测试类型化属性存储（原生精度与分量数）
+ */
+TEST(MeshTypesTest, TypedAttributeData) {
+    MeshAttribute ids(std::vector<int64_t>{10000000001LL, 2});
+    EXPECT_EQ(ids.type(), AttributeType::INT64);
+    EXPECT_EQ(ids.values<int64_t>()[0], 10000000001LL);
+
+    MeshAttribute velocity(AttributeType::FLOAT64, 3, 2);
+    EXPECT_EQ(velocity.size(), 6u);
+    EXPECT_EQ(velocity.tupleCount(), 2u);
+    EXPECT_EQ(velocity.componentsFor(2), 3);
+    EXPECT_EQ(velocity.componentsFor(4), 0);
+    velocity.setValue(4, 0.1);
+    EXPECT_EQ(velocity.values<double>()[4], 0.1);
+
+    // 整数属性写入时四舍五入
+    MeshAttribute region(AttributeType::INT32, 1, 1);
+    region.setValue(0, -2.6);
+    EXPECT_EQ(region.values<int32_t>()[0], -3);
+
+    // 未声明分量数的平铺列表由长度推断
+    MeshAttribute flat = {0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f};
+    EXPECT_EQ(flat.componentsFor(2), 3);
+}
+
+/**
+ * @brief 测试CSR单元连接存储
+ */
+TEST(MeshTypesTest, CellArrayLayout) {
+    MeshData::CellArray cells;
+    EXPECT_TRUE(cells.empty());
+    ASSERT_EQ(cells.offsets.size(), 1u);
+
+    cells.addCell(VtkCellType::TRIANGLE, {0, 1, 2});
+    cells.push_back({VtkCellType::QUAD, {2, 3, 4, 5}});
+    cells.addCell(VtkCellType::VERTEX, {7});
+
+    EXPECT_EQ(cells.size(), 3u);
+    EXPECT_EQ(cells.connectivitySize(), 8u);
+    EXPECT_EQ(cells.offsets, (std::vector<uint32_t>{0, 3, 7, 8}));
+    EXPECT_EQ(cells.cellSize(1), 4u);
+    EXPECT_EQ(cells[1].type, VtkCellType::QUAD);
+    EXPECT_EQ(cells[1].pointIndices[3], 5u);
+
+    // 迭代器与旧版Cell形式互相转换
+    size_t count = 0;
+    for (const auto& cell : cells) {
+        EXPECT_EQ(cell.pointIndices.size(), cells.cellSize(count));
+        ++count;
+    }
+    EXPECT_EQ(count, 3u);
+
+    std::vector<MeshData::Cell> legacy = cells.toCells();
+    ASSERT_EQ(legacy.size(), 3u);
+    EXPECT_EQ(legacy[0].pointIndices, (std::vector<uint32_t>{0, 1, 2}));
+
+    MeshData::CellArray rebuilt;
+    rebuilt.assign(legacy);
+    EXPECT_EQ(rebuilt.connectivity, cells.connectivity);
+    EXPECT_EQ(rebuilt.offsets, cells.offsets);
+
+    // 追加时对点索引加偏移
+    rebuilt.append(cells, 10);
+    EXPECT_EQ(rebuilt.size(), 6u);
+    EXPECT_EQ(rebuilt[3].pointIndices[0], 10u);
+    EXPECT_EQ(rebuilt.offsets.back(), 16u);
+
+    cells.clear();
+    EXPECT_TRUE(cells.empty());
+    EXPECT_EQ(cells.offsets.size(), 1u);
+}
+
+/**
+ * @brief 测试双精度/64位索引网格布局及与紧凑布局的转换
+ */
+TEST(MeshTypesTest, PreciseMeshLayout) {
+    MeshData64 mesh;
+    mesh.points = {0.0, 0.0, 0.0, 1.0 + 1e-12, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+    mesh.cells.addCell(VtkCellType::TETRA, {0, 1, 2, 3});
+    mesh.calculateMetadata();
+    EXPECT_EQ(mesh.metadata.pointCount, 4u);
+    EXPECT_EQ(mesh.metadata.meshType, MeshType::VOLUME_MESH);
+    EXPECT_EQ(mesh.cells.offsets, (std::vector<uint64_t>{0, 4}));
+
+    // 双精度坐标在本布局中不丢失
+    EXPECT_DOUBLE_EQ(mesh.points[3], 1.0 + 1e-12);
+
+    MeshData compact;
+    ASSERT_TRUE(convertMeshData(mesh, compact));
+    EXPECT_EQ(compact.cells.connectivity, (std::vector<uint32_t>{0, 1, 2, 3}));
+    EXPECT_FLOAT_EQ(compact.points[3], 1.0f);
+
+    MeshData64 widened;
+    ASSERT_TRUE(convertMeshData(compact, widened));
+    EXPECT_EQ(widened.cells.connectivity, (std::vector<uint64_t>{0, 1, 2, 3}));
+
+    // 超出32位范围的索引无法转换为紧凑布局
+    mesh.cells.addCell(VtkCellType::VERTEX, {uint64_t(1) << 33});
+    EXPECT_FALSE(convertMeshData(mesh, compact));
+}
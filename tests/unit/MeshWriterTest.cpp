@@ -0,0 +1,319 @@
+#include <gtest/gtest.h>
+#include "MeshWriter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+#include <vtkNew.h>
+#include <vtkZLibDataCompressor.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+/**
+ * @brief 附加数据段中的一个数组（已解码）
+ */
+struct DecodedArray {
+    std::string section;        // 所在元素（PointData/CellData/Points/Cells/Polys等）
+    std::string type;           // DataArray的type属性
+    uint64_t offset = 0;        // offset属性（相对附加数据起点）
+    uint64_t encodedBytes = 0;  // 在附加数据段中占用的字节数（含头）
+    std::vector<char> bytes;    // 解码后的原始字节
+};
+
+/**
+ * @brief 解码后的VTK XML文件
+ */
+struct DecodedVtkXml {
+    std::string text;                            // 整个文件
+    std::map<std::string, DecodedArray> arrays;  // 键 = 所在元素/数组名
+};
+
+std::string attributeValue(const std::string& tag, const std::string& name) {
+    const std::string key = " " + name + "=\"";
+    const size_t begin = tag.find(key);
+    if (begin == std::string::npos) {
+        return std::string();
+    }
+    const size_t valueBegin = begin + key.size();
+    return tag.substr(valueBegin, tag.find('"', valueBegin) - valueBegin);
+}
+
+template<typename T>
+T readValue(const std::string& text, size_t position) {
+    T value;
+    std::memcpy(&value, text.data() + position, sizeof(T));
+    return value;
+}
+
+/**
+ * @brief 读取并解码raw附加数据格式的VTK XML文件，同时检查块头与各数组的偏移
+ * @param blockBytes 压缩时期望的块大小（0 = 未压缩）
+ */
+void decodeVtkXml(const fs::path& path, uint64_t blockBytes, DecodedVtkXml& decoded) {
+    std::ifstream file(path, std::ios::binary);
+    decoded.text.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    const std::string& text = decoded.text;
+
+    const size_t appended = text.find("<AppendedData encoding=\"raw\">");
+    ASSERT_NE(appended, std::string::npos);
+    const size_t dataStart = text.find('_', appended) + 1;
+    const std::string header = text.substr(0, dataStart);
+    const std::string trailer = "\n  </AppendedData>\n</VTKFile>\n";
+    ASSERT_GE(text.size(), dataStart + trailer.size());
+    ASSERT_EQ(text.compare(text.size() - trailer.size(), trailer.size(), trailer), 0);
+    const uint64_t dataEnd = text.size() - trailer.size() - dataStart;
+
+    EXPECT_NE(header.find("header_type=\"UInt64\""), std::string::npos);
+    const bool compressed = header.find("compressor=\"") != std::string::npos;
+    EXPECT_EQ(compressed, blockBytes > 0);
+
+    std::string section;
+    for (size_t position = 0; position < header.size();) {
+        const size_t lineEnd = std::min(header.find('\n', position), header.size());
+        const std::string line = header.substr(position, lineEnd - position);
+        position = lineEnd + 1;
+        const size_t open = line.find('<');
+        if (open == std::string::npos || line.compare(open, 10, "<DataArray") != 0) {
+            if (open != std::string::npos && line.back() == '>' && line[open + 1] != '/') {
+                section = line.substr(open + 1, line.find_first_of(" >", open) - open - 1);
+            }
+            continue;
+        }
+        DecodedArray array;
+        array.section = section;
+        array.type = attributeValue(line, "type");
+        array.offset = std::stoull(attributeValue(line, "offset"));
+        ASSERT_LT(array.offset + 8, dataEnd);
+        const size_t start = dataStart + array.offset;
+        if (!compressed) {
+            const uint64_t size = readValue<uint64_t>(text, start);
+            array.encodedBytes = 8 + size;
+            ASSERT_LE(array.offset + array.encodedBytes, dataEnd);
+            array.bytes.assign(text.data() + start + 8, text.data() + start + 8 + size);
+        } else {
+            // 块头：块数、块大小、末块大小（0 = 满块）、各块压缩后大小
+            const uint64_t blockCount = readValue<uint64_t>(text, start);
+            const uint64_t blockSize = readValue<uint64_t>(text, start + 8);
+            const uint64_t lastBlock = readValue<uint64_t>(text, start + 16);
+            EXPECT_EQ(blockSize, blockBytes) << array.section;
+            EXPECT_LT(lastBlock, blockSize);
+            size_t packed = start + 24 + blockCount * 8;
+            ASSERT_LE(packed, dataStart + dataEnd);
+            vtkNew<vtkZLibDataCompressor> compressor;
+            for (uint64_t b = 0; b < blockCount; ++b) {
+                const uint64_t packedBytes = readValue<uint64_t>(text, start + 24 + b * 8);
+                const uint64_t rawBytes = (b + 1 < blockCount || lastBlock == 0) ? blockSize : lastBlock;
+                ASSERT_LE(packed + packedBytes, dataStart + dataEnd);
+                const size_t first = array.bytes.size();
+                array.bytes.resize(first + rawBytes);
+                const size_t unpacked = compressor->Uncompress(
+                    reinterpret_cast<const unsigned char*>(text.data() + packed), packedBytes,
+                    reinterpret_cast<unsigned char*>(array.bytes.data() + first), rawBytes);
+                ASSERT_EQ(unpacked, rawBytes) << "block " << b;
+                packed += packedBytes;
+            }
+            EXPECT_EQ(blockCount, (array.bytes.size() + blockSize - 1) / blockSize);
+            EXPECT_EQ(lastBlock, array.bytes.size() % blockSize);
+            array.encodedBytes = packed - start;
+        }
+        const std::string key = section + "/" + attributeValue(line, "Name");
+        EXPECT_EQ(decoded.arrays.count(key), 0u) << key;
+        decoded.arrays[key] = std::move(array);
+    }
+
+    // 各数组首尾相接：偏移从0开始，每个偏移等于前一数组的结束位置，最后一个数组结束于段尾
+    std::vector<const DecodedArray*> byOffset;
+    for (const auto& [key, array] : decoded.arrays) {
+        byOffset.push_back(&array);
+    }
+    std::sort(byOffset.begin(), byOffset.end(),
+              [](const DecodedArray* a, const DecodedArray* b) { return a->offset < b->offset; });
+    uint64_t expectedOffset = 0;
+    for (const DecodedArray* array : byOffset) {
+        EXPECT_EQ(array->offset, expectedOffset) << array->section;
+        expectedOffset = array->offset + array->encodedBytes;
+    }
+    EXPECT_EQ(expectedOffset, dataEnd);
+}
+
+template<typename T>
+std::vector<T> valuesOf(const DecodedVtkXml& decoded, const std::string& key) {
+    const auto it = decoded.arrays.find(key);
+    if (it == decoded.arrays.end()) {
+        ADD_FAILURE() << "missing array " << key;
+        return {};
+    }
+    std::vector<T> values(it->second.bytes.size() / sizeof(T));
+    std::memcpy(values.data(), it->second.bytes.data(), values.size() * sizeof(T));
+    return values;
+}
+
+/**
+ * @brief 构造带点/单元属性的六面体网格（数组足够大，压缩时跨越多个块）
+ */
+MeshData hexBlockMesh(size_t n) {
+    MeshData mesh;
+    const size_t m = n + 1;
+    for (size_t k = 0; k < m; ++k) {
+        for (size_t j = 0; j < m; ++j) {
+            for (size_t i = 0; i < m; ++i) {
+                mesh.points.push_back(static_cast<float>(i) * 0.5f);
+                mesh.points.push_back(static_cast<float>(j) * 0.25f);
+                mesh.points.push_back(static_cast<float>(k));
+            }
+        }
+    }
+    auto id = [m](size_t i, size_t j, size_t k) { return static_cast<uint32_t>((k * m + j) * m + i); };
+    std::vector<int32_t> cellIds;
+    for (size_t k = 0; k < n; ++k) {
+        for (size_t j = 0; j < n; ++j) {
+            for (size_t i = 0; i < n; ++i) {
+                mesh.cells.addCell(VtkCellType::HEXAHEDRON,
+                                   {id(i, j, k), id(i + 1, j, k), id(i + 1, j + 1, k), id(i, j + 1, k),
+                                    id(i, j, k + 1), id(i + 1, j, k + 1), id(i + 1, j + 1, k + 1), id(i, j + 1, k + 1)});
+                cellIds.push_back(static_cast<int32_t>(cellIds.size()));
+            }
+        }
+    }
+    std::vector<double> temperature;
+    for (size_t p = 0; p < mesh.points.size() / 3; ++p) {
+        temperature.push_back(static_cast<double>(p) * 0.125);
+    }
+    mesh.pointData["temperature"] = MeshAttribute(std::move(temperature));
+    mesh.cellData["id"] = MeshAttribute(std::move(cellIds));
+    mesh.calculateMetadata();
+    return mesh;
+}
+
+std::string readFile(const fs::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+class MeshWriterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        dir_ = fs::temp_directory_path()
+            / (std::string("meshconv_writer_") + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        fs::remove_all(dir_);
+        fs::create_directories(dir_);
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        fs::remove_all(dir_, ec);
+    }
+
+    template<typename Mesh>
+    void write(const Mesh& mesh, const std::string& name, const FormatWriteOptions& options) {
+        MeshErrorCode errorCode = MeshErrorCode::SUCCESS;
+        std::string errorMsg;
+        ASSERT_TRUE(MeshWriter::writeVTKXML(mesh, (dir_ / name).u8string(), options, errorCode, errorMsg)) << errorMsg;
+    }
+
+    fs::path dir_;
+};
+
+} // namespace
+
+/**
+ * @brief 测试未压缩VTU：UInt64长度头、偏移连续、数组内容与网格一致
+ */
+TEST_F(MeshWriterTest, VtkXmlRawAppendedLayout) {
+    const MeshData mesh = hexBlockMesh(6);
+    FormatWriteOptions options;
+    options.compress = false;
+    write(mesh, "raw.vtu", options);
+
+    DecodedVtkXml decoded;
+    decodeVtkXml(dir_ / "raw.vtu", 0, decoded);
+    EXPECT_EQ(decoded.arrays.at("Points/Points").type, "Float32");
+    EXPECT_EQ(valuesOf<float>(decoded, "Points/Points"), mesh.points);
+    EXPECT_EQ(valuesOf<uint32_t>(decoded, "Cells/connectivity"), mesh.cells.connectivity);
+    const std::vector<uint32_t> ends(mesh.cells.offsets.begin() + 1, mesh.cells.offsets.end());
+    EXPECT_EQ(valuesOf<uint32_t>(decoded, "Cells/offsets"), ends);
+    EXPECT_EQ(valuesOf<uint8_t>(decoded, "Cells/types"), std::vector<uint8_t>(mesh.cells.size(), 12));
+    EXPECT_EQ(valuesOf<double>(decoded, "PointData/temperature"), mesh.pointData.at("temperature").values<double>());
+    EXPECT_EQ(valuesOf<int32_t>(decoded, "CellData/id"), mesh.cellData.at("id").values<int32_t>());
+}
+
+/**
+ * @brief 测试压缩VTU：块头（块数、块大小取整到8的倍数、末块大小）正确且解压结果与未压缩一致
+ */
+TEST_F(MeshWriterTest, VtkXmlCompressedBlockHeaders) {
+    const MeshData mesh = hexBlockMesh(6);
+    FormatWriteOptions options;
+    options.compress = false;
+    write(mesh, "raw.vtu", options);
+    options.compress = true;
+    options.vtkCompressor = VtkCompressor::ZLIB;
+    options.vtkBlockSize = 1001;
+    write(mesh, "zlib.vtu", options);
+
+    DecodedVtkXml raw;
+    DecodedVtkXml compressed;
+    decodeVtkXml(dir_ / "raw.vtu", 0, raw);
+    decodeVtkXml(dir_ / "zlib.vtu", 1008, compressed);
+    ASSERT_EQ(compressed.arrays.size(), raw.arrays.size());
+    for (const auto& [key, array] : raw.arrays) {
+        ASSERT_EQ(compressed.arrays.count(key), 1u) << key;
+        EXPECT_EQ(compressed.arrays.at(key).bytes, array.bytes) << key;
+    }
+    // 点坐标跨越多个块且末块不满
+    EXPECT_GT(raw.arrays.at("Points/Points").bytes.size(), 3 * 1008u);
+}
+
+/**
+ * @brief 测试单线程与多线程写出的文件逐字节一致（未压缩/压缩、VTU/VTP、MeshData/MeshData64）
+ */
+TEST_F(MeshWriterTest, VtkXmlThreadCountDoesNotChangeOutput) {
+    const MeshData mesh = hexBlockMesh(8);
+    MeshData64 mesh64;
+    convertMeshData(mesh, mesh64);
+
+    // 多边形数据：三角形与线、顶点交错，连接关系经由分块填充写出
+    MeshData surface;
+    surface.points = mesh.points;
+    for (uint32_t i = 0; i + 2 < static_cast<uint32_t>(mesh.points.size() / 3); i += 3) {
+        surface.cells.addCell(VtkCellType::TRIANGLE, {i, i + 1, i + 2});
+        if (i % 9 == 0) {
+            surface.cells.addCell(VtkCellType::LINE, {i, i + 2});
+            surface.cells.addCell(VtkCellType::VERTEX, {i + 1});
+        }
+    }
+    surface.calculateMetadata();
+
+    for (const bool compress : {false, true}) {
+        FormatWriteOptions options;
+        options.compress = compress;
+        options.vtkBlockSize = 4096;
+        for (const unsigned int threads : {1u, 8u}) {
+            options.formatThreads = threads;
+            const std::string suffix = std::to_string(threads) + (compress ? "z" : "r");
+            write(mesh, "mesh" + suffix + ".vtu", options);
+            write(mesh64, "mesh64" + suffix + ".vtu", options);
+            write(surface, "surface" + suffix + ".vtp", options);
+        }
+        const std::string mode = compress ? "z" : "r";
+        for (const std::string name : {"mesh", "mesh64", "surface"}) {
+            const std::string extension = name == "surface" ? ".vtp" : ".vtu";
+            const std::string serial = readFile(dir_ / (name + "1" + mode + extension));
+            EXPECT_FALSE(serial.empty());
+            EXPECT_EQ(serial, readFile(dir_ / (name + "8" + mode + extension))) << name << mode;
+        }
+
+        DecodedVtkXml decoded;
+        decodeVtkXml(dir_ / ("surface8" + mode + ".vtp"), compress ? 4096 : 0, decoded);
+        EXPECT_EQ(decoded.arrays.at("Points/Points").bytes.size(), surface.points.size() * sizeof(float));
+        EXPECT_EQ(decoded.arrays.count("Polys/connectivity"), 1u);
+        EXPECT_EQ(decoded.arrays.count("Lines/connectivity"), 1u);
+        EXPECT_EQ(decoded.arrays.count("Verts/connectivity"), 1u);
+    }
+}
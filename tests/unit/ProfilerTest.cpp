@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include "Profiler.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief 记录收到的所有事件的接收器
+ */
+class RecordingSink : public ProfileSink {
+public:
+    void onEvent(const ProfileEvent& event) override { events.push_back(event); }
+
+    std::vector<ProfileEvent> events;
+};
+
+/**
+ * @brief 每个测试前后清空全局接收器列表
+ */
+class ProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override { Profiler::clearSinks(); }
+    void TearDown() override { Profiler::clearSinks(); }
+};
+
+} // namespace
+
+/**
+ * @brief 测试接收器挂接后收到阶段、计数与消息事件，移除后不再收到
+ */
+TEST_F(ProfilerTest, SinkAttachAndDetach) {
+    EXPECT_FALSE(Profiler::enabled());
+    auto first = std::make_shared<RecordingSink>();
+    auto second = std::make_shared<RecordingSink>();
+    Profiler::addSink(first);
+    EXPECT_TRUE(Profiler::enabled());
+    Profiler::addSink(second);
+
+    {
+        ProfileScope scope("read", "STL", "mesh.stl");
+        EXPECT_TRUE(scope.active());
+        scope.setBytes(84);
+        scope.setCells(1);
+    }
+    Profiler::counter("points", 3.0);
+    Profiler::message("done");
+
+    ASSERT_EQ(first->events.size(), 3u);
+    EXPECT_EQ(first->events[0].type, ProfileEvent::Type::STAGE);
+    EXPECT_STREQ(first->events[0].category, "read");
+    EXPECT_EQ(first->events[0].name, "STL");
+    EXPECT_EQ(first->events[0].detail, "mesh.stl");
+    EXPECT_EQ(first->events[0].bytes, 84u);
+    EXPECT_EQ(first->events[0].cells, 1u);
+    EXPECT_EQ(first->events[1].type, ProfileEvent::Type::COUNTER);
+    EXPECT_EQ(first->events[1].value, 3.0);
+    EXPECT_EQ(first->events[2].type, ProfileEvent::Type::MESSAGE);
+    EXPECT_EQ(first->events[2].name, "done");
+    EXPECT_EQ(second->events.size(), 3u);
+
+    // 移除一个接收器后另一个仍然收到事件
+    Profiler::removeSink(first);
+    EXPECT_TRUE(Profiler::enabled());
+    Profiler::message("second only");
+    EXPECT_EQ(first->events.size(), 3u);
+    EXPECT_EQ(second->events.size(), 4u);
+
+    Profiler::removeSink(second);
+    EXPECT_FALSE(Profiler::enabled());
+    Profiler::message("nobody");
+    EXPECT_EQ(second->events.size(), 4u);
+}
+
+/**
+ * @brief 测试回调接收器与clearSinks
+ */
+TEST_F(ProfilerTest, CallbackSinkAndClear) {
+    int messages = 0;
+    std::shared_ptr<ProfileSink> sink = Profiler::addCallback([&messages](const ProfileEvent& event) {
+        if (event.type == ProfileEvent::Type::MESSAGE) {
+            ++messages;
+        }
+    });
+    Profiler::message("one");
+    Profiler::message("two");
+    EXPECT_EQ(messages, 2);
+
+    Profiler::clearSinks();
+    EXPECT_FALSE(Profiler::enabled());
+    Profiler::message("three");
+    EXPECT_EQ(messages, 2);
+
+    // 重复移除已移除的接收器不受影响
+    Profiler::removeSink(sink);
+    EXPECT_FALSE(Profiler::enabled());
+}
+
+/**
+ * @brief 测试分析器关闭时ProfileScope不记录任何内容（之后才挂接的接收器也收不到）
+ */
+TEST_F(ProfilerTest, ScopeIsInertWhileDisabled) {
+    auto sink = std::make_shared<RecordingSink>();
+    {
+        ProfileScope scope("write", "SU2");
+        EXPECT_FALSE(scope.active());
+        scope.setName("renamed");
+        scope.setBytes(100);
+        Profiler::addSink(sink);
+    }
+    EXPECT_TRUE(sink->events.empty());
+
+    // 挂接后新建的阶段正常记录，可改名
+    {
+        ProfileScope scope("write", "SU2");
+        scope.setName("SU2 ascii");
+    }
+    ASSERT_EQ(sink->events.size(), 1u);
+    EXPECT_EQ(sink->events[0].name, "SU2 ascii");
+}
+
+/**
+ * @brief 测试阶段汇总接收器按类别与名称累计
+ */
+TEST_F(ProfilerTest, StageSummaryAggregates) {
+    auto summary = std::make_shared<StageSummarySink>();
+    Profiler::addSink(summary);
+    for (int i = 0; i < 3; ++i) {
+        ProfileScope scope("read", "OBJ");
+        scope.setBytes(10);
+        scope.setCells(2);
+    }
+    {
+        ProfileScope scope("write", "STL");
+    }
+    Profiler::removeSink(summary);
+
+    const auto& totals = summary->totals();
+    ASSERT_EQ(totals.size(), 2u);
+    const StageSummarySink::StageTotals& read = totals.at({"read", "OBJ"});
+    EXPECT_EQ(read.count, 3u);
+    EXPECT_EQ(read.bytes, 30u);
+    EXPECT_EQ(read.cells, 6u);
+    EXPECT_LE(read.maxSeconds, read.seconds);
+    EXPECT_EQ(totals.at({"write", "STL"}).count, 1u);
+    EXPECT_NE(summary->toString().find("OBJ"), std::string::npos);
+}
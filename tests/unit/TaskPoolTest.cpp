@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include "TaskPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief 记录并发峰值的计数器
+ */
+struct PeakCounter {
+    std::atomic<int64_t> current{0};
+    std::atomic<int64_t> peak{0};
+
+    void enter(int64_t amount) {
+        const int64_t now = current.fetch_add(amount) + amount;
+        int64_t seen = peak.load();
+        while (now > seen && !peak.compare_exchange_weak(seen, now)) {
+        }
+    }
+
+    void leave(int64_t amount) { current.fetch_sub(amount); }
+};
+
+void briefWork() {
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+}
+
+} // namespace
+
+/**
+ * @brief 测试多线程并发提交时每个任务恰好执行一次
+ */
+TEST(TaskPoolTest, EveryTaskRunsExactlyOnce) {
+    TaskPool pool(8);
+    constexpr size_t kSubmitters = 4;
+    constexpr size_t kTasksPerSubmitter = 2000;
+    std::vector<std::atomic<int>> runs(kSubmitters * kTasksPerSubmitter);
+    auto group = std::make_shared<TaskPool::TaskGroup>();
+
+    std::vector<std::thread> submitters;
+    for (size_t s = 0; s < kSubmitters; ++s) {
+        submitters.emplace_back([&, s]() {
+            for (size_t i = 0; i < kTasksPerSubmitter; ++i) {
+                const size_t id = s * kTasksPerSubmitter + i;
+                // 不同的内存代价使任务在各队列内排序并被窃取
+                pool.submit([&runs, id]() { runs[id].fetch_add(1); }, id % 97, group);
+            }
+        });
+    }
+    for (auto& thread : submitters) {
+        thread.join();
+    }
+    group->wait();
+
+    for (size_t id = 0; id < runs.size(); ++id) {
+        EXPECT_EQ(runs[id].load(), 1) << "task " << id;
+    }
+}
+
+/**
+ * @brief 测试批量提交与无分组任务同样恰好执行一次
+ */
+TEST(TaskPoolTest, BatchAndUngroupedTasksRunOnce) {
+    constexpr size_t kTasks = 500;
+    std::vector<std::atomic<int>> runs(kTasks * 2);
+    {
+        TaskPool pool(4);
+        std::vector<std::function<void()>> batch;
+        std::vector<uint64_t> costs;
+        for (size_t i = 0; i < kTasks; ++i) {
+            batch.push_back([&runs, i]() { runs[i].fetch_add(1); });
+            costs.push_back(i);
+            pool.submit([&runs, i]() { runs[kTasks + i].fetch_add(1); }, i);
+        }
+        pool.submitBatch(std::move(batch), costs);
+        // 析构函数完成所有排队任务后才返回
+    }
+
+    for (size_t id = 0; id < runs.size(); ++id) {
+        EXPECT_EQ(runs[id].load(), 1) << "task " << id;
+    }
+}
+
+/**
+ * @brief 测试分组的并发上限不会被突破
+ */
+TEST(TaskPoolTest, MaxConcurrencyIsRespected) {
+    TaskPool pool(8);
+    auto limited = std::make_shared<TaskPool::TaskGroup>(2);
+    auto unlimited = std::make_shared<TaskPool::TaskGroup>();
+    PeakCounter limitedRunning;
+    PeakCounter unlimitedRunning;
+
+    for (int i = 0; i < 200; ++i) {
+        pool.submit([&]() {
+            limitedRunning.enter(1);
+            briefWork();
+            limitedRunning.leave(1);
+        }, 0, limited);
+        pool.submit([&]() {
+            unlimitedRunning.enter(1);
+            briefWork();
+            unlimitedRunning.leave(1);
+        }, 0, unlimited);
+    }
+    limited->wait();
+    unlimited->wait();
+
+    EXPECT_LE(limitedRunning.peak.load(), 2);
+    EXPECT_GE(limitedRunning.peak.load(), 1);
+    // 受限分组不应阻塞其他分组占用剩余线程
+    EXPECT_GT(unlimitedRunning.peak.load(), 1);
+}
+
+/**
+ * @brief 测试分组的内存预算不会被突破，超出预算的任务单独运行
+ */
+TEST(TaskPoolTest, MemoryBudgetIsRespected) {
+    TaskPool pool(8);
+    constexpr uint64_t kBudget = 1000;
+    auto group = std::make_shared<TaskPool::TaskGroup>(0, kBudget);
+    PeakCounter memory;
+    PeakCounter running;
+    std::atomic<bool> oversizedShared{false};
+
+    for (int i = 0; i < 300; ++i) {
+        const uint64_t cost = (i % 10 == 0) ? 2 * kBudget : 100 + (i % 7) * 50;
+        pool.submit([&, cost]() {
+            memory.enter(static_cast<int64_t>(cost));
+            running.enter(1);
+            if (cost > kBudget && running.current.load() > 1) {
+                oversizedShared = true;
+            }
+            briefWork();
+            running.leave(1);
+            memory.leave(static_cast<int64_t>(cost));
+        }, cost, group);
+    }
+    group->wait();
+
+    // 预算内的任务合计不超过预算；超大任务运行时没有其他任务
+    EXPECT_FALSE(oversizedShared.load());
+    EXPECT_LE(memory.peak.load(), static_cast<int64_t>(2 * kBudget));
+    EXPECT_GT(running.peak.load(), 1);
+}
+
+/**
+ * @brief 测试预算内任务的内存总量峰值不超过预算
+ */
+TEST(TaskPoolTest, MemoryBudgetCapsSmallTasks) {
+    TaskPool pool(8);
+    constexpr uint64_t kBudget = 1000;
+    auto group = std::make_shared<TaskPool::TaskGroup>(0, kBudget);
+    PeakCounter memory;
+
+    for (int i = 0; i < 300; ++i) {
+        const uint64_t cost = 150 + (i % 5) * 100;
+        pool.submit([&, cost]() {
+            memory.enter(static_cast<int64_t>(cost));
+            briefWork();
+            memory.leave(static_cast<int64_t>(cost));
+        }, cost, group);
+    }
+    group->wait();
+
+    EXPECT_LE(memory.peak.load(), static_cast<int64_t>(kBudget));
+}
+
+/**
+ * @brief 测试等待空分组立即返回
+ */
+TEST(TaskPoolTest, WaitOnEmptyGroupReturns) {
+    TaskPool pool(2);
+    auto group = std::make_shared<TaskPool::TaskGroup>(1, 100);
+    group->wait();
+
+    // 任务全部完成后再次等待同样立即返回
+    std::atomic<int> runs{0};
+    pool.submit([&runs]() { runs.fetch_add(1); }, 10, group);
+    group->wait();
+    group->wait();
+    EXPECT_EQ(runs.load(), 1);
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include "TextTokenizer.h"
+
+/**
+ * @brief 测试按行读取（LF/CRLF、末行无换行）
+ */
+TEST(TextTokenizerTest, LineSplitting) {
+    TextTokenizer text(std::string_view("v 1 2 3\r\n\nf 1 2 3"));
+    std::string_view line;
+
+    ASSERT_TRUE(text.nextLine(line));
+    EXPECT_EQ(line, "v 1 2 3");
+    ASSERT_TRUE(text.nextLine(line));
+    EXPECT_TRUE(line.empty());
+    ASSERT_TRUE(text.nextLine(line));
+    EXPECT_EQ(line, "f 1 2 3");
+    EXPECT_FALSE(text.nextLine(line));
+    EXPECT_TRUE(text.atEnd());
+}
+
+/**
+ * @brief 测试数值与单词解析（与operator>>的分词规则一致）
+ */
+TEST(TextTokenizerTest, NumberParsing) {
+    TextTokenizer tokens(std::string_view("  vertex +1.5 -2e-3\t7 1e-60 abc"));
+    std::string_view keyword;
+    float x = 0.0f, y = 0.0f, tiny = 1.0f;
+    int index = 0;
+
+    ASSERT_TRUE(tokens.nextToken(keyword));
+    EXPECT_EQ(keyword, "vertex");
+    ASSERT_TRUE(tokens.next(x));
+    ASSERT_TRUE(tokens.next(y));
+    ASSERT_TRUE(tokens.next(index));
+    EXPECT_FLOAT_EQ(x, 1.5f);
+    EXPECT_FLOAT_EQ(y, -2e-3f);
+    EXPECT_EQ(index, 7);
+
+    // 下溢的数值按strtod规则截断，不视为解析失败
+    ASSERT_TRUE(tokens.next(tiny));
+    EXPECT_EQ(tiny, 0.0f);
+
+    // 非数值不消耗输入
+    EXPECT_FALSE(tokens.next(x));
+    ASSERT_TRUE(tokens.nextToken(keyword));
+    EXPECT_EQ(keyword, "abc");
+
+    int vertexIndex = 0;
+    EXPECT_TRUE(TextTokenizer::parse(std::string_view("12/4/9"), vertexIndex));
+    EXPECT_EQ(vertexIndex, 12);
+    EXPECT_EQ(TextTokenizer::trim(std::string_view(" \tend_header \r")), "end_header");
+}
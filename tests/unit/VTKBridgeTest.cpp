@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include "VTKBridge.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vtkCellData.h>
+#include <vtkDataArray.h>
+#include <vtkPoints.h>
+#include <vtkUnstructuredGrid.h>
+
+namespace {
+
+// 被监视的缓冲区地址及其释放次数（由下方替换的全局operator delete记录）
+std::atomic<const void*> watchedBuffer{nullptr};
+std::atomic<int> watchedFrees{0};
+
+void noteFree(void* pointer) {
+    if (pointer != nullptr && pointer == watchedBuffer.load()) {
+        watchedFrees.fetch_add(1);
+    }
+}
+
+/**
+ * @brief 构造可零拷贝共享的四面体+三角形网格
+ */
+MeshData shareableMesh() {
+    MeshData mesh;
+    mesh.points = {0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+    mesh.cells.addCell(VtkCellType::TETRA, {0, 1, 2, 3});
+    mesh.cells.addCell(VtkCellType::TRIANGLE, {0, 1, 2});
+    mesh.pointData["temperature"] = MeshAttribute(std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f});
+    mesh.calculateMetadata();
+    return mesh;
+}
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    if (void* pointer = std::malloc(size > 0 ? size : 1)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+    noteFree(pointer);
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    noteFree(pointer);
+    std::free(pointer);
+}
+
+/**
+ * @brief 测试adopt后的缓冲区由VTK释放且只释放一次
+ */
+TEST(VTKBridgeTest, AdoptedBufferIsFreedOnce) {
+    MeshData mesh = shareableMesh();
+    ASSERT_TRUE(VTKBridge::canShare(mesh));
+    const void* buffer = mesh.points.data();
+    watchedFrees = 0;
+    watchedBuffer = buffer;
+
+    vtkSmartPointer<vtkUnstructuredGrid> grid = VTKBridge::adopt(std::move(mesh));
+    ASSERT_NE(grid.GetPointer(), nullptr);
+    EXPECT_EQ(grid->GetPoints()->GetData()->GetVoidPointer(0), buffer);
+    EXPECT_EQ(grid->GetNumberOfCells(), 2);
+    EXPECT_TRUE(mesh.points.empty());
+    EXPECT_EQ(watchedFrees.load(), 0);
+
+    grid = nullptr;
+    EXPECT_EQ(watchedFrees.load(), 1);
+    watchedBuffer = nullptr;
+}
+
+/**
+ * @brief 测试wrap借用的缓冲区不会被VTK释放
+ */
+TEST(VTKBridgeTest, BorrowedBufferIsNeverFreed) {
+    MeshData mesh = shareableMesh();
+    const void* buffer = mesh.points.data();
+    watchedFrees = 0;
+    watchedBuffer = buffer;
+
+    {
+        vtkSmartPointer<vtkUnstructuredGrid> grid = VTKBridge::wrap(mesh);
+        ASSERT_NE(grid.GetPointer(), nullptr);
+        EXPECT_EQ(grid->GetPoints()->GetData()->GetVoidPointer(0), buffer);
+    }
+    EXPECT_EQ(watchedFrees.load(), 0);
+    EXPECT_EQ(mesh.points.data(), buffer);
+    EXPECT_FLOAT_EQ(mesh.points[3], 1.0f);
+
+    // 只有MeshData自身析构时释放一次
+    mesh = MeshData();
+    EXPECT_EQ(watchedFrees.load(), 1);
+    watchedBuffer = nullptr;
+}
+
+/**
+ * @brief 测试复制时跳过的无效单元同时丢弃其单元数据
+ */
+TEST(VTKBridgeTest, CopySkipsInvalidCellsWithTheirCellData) {
+    MeshData mesh = shareableMesh();
+    mesh.cells = MeshData::CellArray();
+    mesh.cells.addCell(VtkCellType::TETRA, {0, 1, 2, 3});
+    mesh.cells.addCell(VtkCellType::TRIANGLE, {0, 1});  // 点数错误，被跳过
+    mesh.cells.addCell(VtkCellType::TRIANGLE, {1, 2, 3});
+    mesh.cells.addCell(VtkCellType::QUAD, {0, 1, 2});   // 点数错误，被跳过
+    mesh.cells.addCell(VtkCellType::LINE, {0, 3});
+    mesh.cellData["id"] = MeshAttribute(std::vector<int32_t>{10, 11, 12, 13, 14});
+    mesh.cellData["vector"] = MeshAttribute(std::vector<double>{0, 0.5, 1, 1.5, 2, 2.5, 3, 3.5, 4, 4.5}, 2);
+    mesh.calculateMetadata();
+    ASSERT_FALSE(VTKBridge::canShare(mesh));
+
+    for (vtkSmartPointer<vtkUnstructuredGrid> grid : {VTKBridge::copy(mesh), VTKBridge::adopt(MeshData(mesh))}) {
+        ASSERT_NE(grid.GetPointer(), nullptr);
+        ASSERT_EQ(grid->GetNumberOfCells(), 3);
+
+        vtkDataArray* ids = grid->GetCellData()->GetArray("id");
+        ASSERT_NE(ids, nullptr);
+        ASSERT_EQ(ids->GetNumberOfTuples(), 3);
+        EXPECT_EQ(ids->GetTuple1(0), 10.0);
+        EXPECT_EQ(ids->GetTuple1(1), 12.0);
+        EXPECT_EQ(ids->GetTuple1(2), 14.0);
+
+        vtkDataArray* vectors = grid->GetCellData()->GetArray("vector");
+        ASSERT_NE(vectors, nullptr);
+        ASSERT_EQ(vectors->GetNumberOfComponents(), 2);
+        ASSERT_EQ(vectors->GetNumberOfTuples(), 3);
+        EXPECT_EQ(vectors->GetComponent(1, 0), 2.0);
+        EXPECT_EQ(vectors->GetComponent(1, 1), 2.5);
+        EXPECT_EQ(vectors->GetComponent(2, 1), 4.5);
+    }
+}